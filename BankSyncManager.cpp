@@ -0,0 +1,194 @@
+#include "BankSyncManager.h"
+#include "MidiManager.h"
+#include "DisplayManager.h"
+#include "StudioOneProtocol.h"
+
+extern MidiManager midiManager;
+extern DisplayManager displayManager;
+
+BankSyncManager::BankSyncManager()
+  : phase(BANK_SYNC_IDLE), bank(0), phaseStart(0), switchStartMicros(0),
+    pendingValues(0), pendingColors(0), inFlight(0), nextTrack(0),
+    switches(0), bulkCompletions(0), pacedFallbacks(0), incompleteSyncs(0),
+    requestsSent(0), retries(0), lastConsistentMicros(0), maxConsistentMicros(0),
+    totalConsistentMicros(0), consistentSamples(0)
+{
+  memset(requestTime, 0, sizeof(requestTime));
+  memset(attempts, 0, sizeof(attempts));
+}
+
+BankSyncManager::~BankSyncManager() {}
+
+bool BankSyncManager::initialize() {
+  phase = BANK_SYNC_IDLE;
+  pendingValues = 0;
+  pendingColors = 0;
+  inFlight = 0;
+  return true;
+}
+
+void BankSyncManager::startBankSwitch(uint8_t newBank, bool requestColors) {
+  // Un cambio durante otro refresco lo sustituye; las respuestas del banco
+  // anterior se siguen guardando en su banco pero ya no cuentan aquí
+  bank = newBank;
+  switchStartMicros = micros();
+  phaseStart = millis();
+  pendingValues = 0xFFFF;
+  pendingColors = requestColors ? 0xFFFF : 0;
+  inFlight = 0;
+  nextTrack = 0;
+  memset(attempts, 0, sizeof(attempts));
+  switches++;
+
+  displayManager.markAllChannelsDirty();
+
+  // Una sola petición de estado en bloque; si no hay hueco, pista a pista.
+  // Nombres y colores solo cuando el banco no está poblado todavía.
+  if (midiManager.getSysExSlotsFree() > 0) {
+    uint8_t sections = BANK_STATE_VALUES | BANK_STATE_FLAGS | BANK_STATE_SEQ;
+    if (requestColors) sections |= BANK_STATE_COLORS | BANK_STATE_NAMES;
+    midiManager.sendStudioOneBankStateRequest(bank, sections);
+    requestsSent++;
+    phase = BANK_SYNC_WAIT_STATE;
+  } else {
+    phase = BANK_SYNC_PACED;
+    pacedFallbacks++;
+  }
+}
+
+void BankSyncManager::update() {
+  if (phase == BANK_SYNC_IDLE || phase == BANK_SYNC_WAIT_FRAME) return;
+
+  unsigned long now = millis();
+
+  if (phase == BANK_SYNC_WAIT_STATE) {
+    // phaseStart se renueva con cada respuesta: solo caduca si el DAW calla
+    if (now - phaseStart < BANK_SYNC_STATE_TIMEOUT_MS) return;
+    phase = BANK_SYNC_PACED;
+    pacedFallbacks++;
+  }
+
+  updatePaced(now);
+}
+
+void BankSyncManager::updatePaced(unsigned long now) {
+  // Reintentos de peticiones sin respuesta
+  for (uint8_t track = 0; track < NUM_ENCODERS; track++) {
+    uint16_t bit = 1 << track;
+    if ((inFlight & bit) && now - requestTime[track] >= BANK_SYNC_RETRY_MS) {
+      inFlight &= ~bit;
+      if (attempts[track] >= BANK_SYNC_MAX_ATTEMPTS) {
+        pendingValues &= ~bit;
+        pendingColors &= ~bit;
+        incompleteSyncs++;
+      } else {
+        retries++;
+      }
+    }
+  }
+
+  if (!getPendingMask()) {
+    finishData();
+    return;
+  }
+
+  // Rellenar la ventana de peticiones sin saturar la cola SysEx de salida
+  uint8_t inFlightCount = __builtin_popcount(inFlight);
+  for (uint8_t scanned = 0; scanned < NUM_ENCODERS && inFlightCount < BANK_SYNC_MAX_INFLIGHT; scanned++) {
+    uint8_t track = nextTrack;
+    nextTrack = (nextTrack + 1) % NUM_ENCODERS;
+
+    uint16_t bit = 1 << track;
+    if (!(getPendingMask() & bit) || (inFlight & bit)) continue;
+    if (!sendTrackRequest(track, now)) break;
+    inFlightCount++;
+  }
+}
+
+bool BankSyncManager::sendTrackRequest(uint8_t track, unsigned long now) {
+  uint16_t bit = 1 << track;
+  uint8_t needed = ((pendingValues & bit) ? 1 : 0) + ((pendingColors & bit) ? 1 : 0);
+  if (midiManager.getSysExSlotsFree() < needed) return false;
+
+  if (pendingValues & bit) {
+    midiManager.sendStudioOneValueRequest(track, bank);
+    requestsSent++;
+  }
+  if (pendingColors & bit) {
+    midiManager.sendStudioOneColorRequest(track, bank);
+    requestsSent++;
+  }
+
+  inFlight |= bit;
+  requestTime[track] = now;
+  attempts[track]++;
+  return true;
+}
+
+void BankSyncManager::onValueReceived(uint8_t track, uint8_t fromBank) {
+  if (phase == BANK_SYNC_IDLE || fromBank != bank || track >= NUM_ENCODERS) return;
+
+  uint16_t bit = 1 << track;
+  pendingValues &= ~bit;
+  if (!(pendingColors & bit)) inFlight &= ~bit;
+  phaseStart = millis();
+
+  if (!getPendingMask()) finishData();
+}
+
+void BankSyncManager::onColorReceived(uint8_t track, uint8_t fromBank) {
+  if (phase == BANK_SYNC_IDLE || fromBank != bank || track >= NUM_ENCODERS) return;
+
+  uint16_t bit = 1 << track;
+  pendingColors &= ~bit;
+  if (!(pendingValues & bit)) inFlight &= ~bit;
+  phaseStart = millis();
+
+  if (!getPendingMask()) finishData();
+}
+
+void BankSyncManager::onBankStateReceived(uint8_t fromBank, uint8_t sections, uint16_t trackMask) {
+  if (phase == BANK_SYNC_IDLE || fromBank != bank) return;
+
+  if (sections & BANK_STATE_VALUES) pendingValues &= ~trackMask;
+  if (sections & BANK_STATE_COLORS) pendingColors &= ~trackMask;
+  inFlight &= pendingValues | pendingColors;
+  phaseStart = millis();
+
+  if (!getPendingMask()) finishData();
+}
+
+void BankSyncManager::finishData() {
+  if (phase == BANK_SYNC_WAIT_FRAME || phase == BANK_SYNC_IDLE) return;
+  if (phase == BANK_SYNC_WAIT_STATE) bulkCompletions++;
+  inFlight = 0;
+  phase = BANK_SYNC_WAIT_FRAME;
+}
+
+void BankSyncManager::onFrameDrawn() {
+  if (phase != BANK_SYNC_WAIT_FRAME) return;
+
+  // Pantalla coherente: todos los datos del banco recibidos y ya dibujados
+  lastConsistentMicros = micros() - switchStartMicros;
+  if (lastConsistentMicros > maxConsistentMicros) {
+    maxConsistentMicros = lastConsistentMicros;
+  }
+  totalConsistentMicros += lastConsistentMicros;
+  consistentSamples++;
+  phase = BANK_SYNC_IDLE;
+}
+
+void BankSyncManager::printStatistics() const {
+  Serial.println(F("\n=== SINCRONIZACIÓN DE BANCOS ==="));
+  Serial.print(F("Cambios de banco: ")); Serial.println(switches);
+  Serial.print(F("Estados en bloque completos: ")); Serial.println(bulkCompletions);
+  Serial.print(F("Recurso pista a pista: ")); Serial.println(pacedFallbacks);
+  Serial.print(F("Pistas sin respuesta: ")); Serial.println(incompleteSyncs);
+  Serial.print(F("Peticiones enviadas: ")); Serial.print(requestsSent);
+  Serial.print(F(" | reintentos ")); Serial.println(retries);
+  Serial.print(F("Pantalla coherente (us): ")); Serial.print(lastConsistentMicros);
+  Serial.print(F(" | media "));
+  Serial.print(consistentSamples ? (uint32_t)(totalConsistentMicros / consistentSamples) : 0);
+  Serial.print(F(" | máx ")); Serial.println(maxConsistentMicros);
+  Serial.println(F("================================\n"));
+}
@@ -0,0 +1,78 @@
+#ifndef BANK_SYNC_MANAGER_H
+#define BANK_SYNC_MANAGER_H
+
+#include "Config.h"
+#include <Arduino.h>
+
+// Tiempos y límites del refresco de banco desde el DAW
+#define BANK_SYNC_STATE_TIMEOUT_MS  150   // Espera al estado en bloque antes de pedir pista a pista
+#define BANK_SYNC_RETRY_MS          100   // Reenvío de una petición sin respuesta
+#define BANK_SYNC_MAX_INFLIGHT      4     // Pistas con petición pendiente a la vez
+#define BANK_SYNC_MAX_ATTEMPTS      3     // Intentos por pista antes de rendirse
+
+enum BankSyncPhase {
+  BANK_SYNC_IDLE = 0,
+  BANK_SYNC_WAIT_STATE,    // Estado en bloque pedido, esperando respuesta
+  BANK_SYNC_PACED,         // Sin respuesta en bloque: peticiones pista a pista con control de flujo
+  BANK_SYNC_WAIT_FRAME     // Datos completos, falta el primer frame que los muestre
+};
+
+class BankSyncManager {
+private:
+  BankSyncPhase phase;
+  uint8_t bank;
+  unsigned long phaseStart;
+  uint32_t switchStartMicros;
+
+  // Bit por encoder (0-15)
+  uint16_t pendingValues;
+  uint16_t pendingColors;
+  uint16_t inFlight;
+  unsigned long requestTime[NUM_ENCODERS];
+  uint8_t attempts[NUM_ENCODERS];
+  uint8_t nextTrack;
+
+  // Estadísticas
+  uint32_t switches;
+  uint32_t bulkCompletions;
+  uint32_t pacedFallbacks;
+  uint32_t incompleteSyncs;
+  uint32_t requestsSent;
+  uint32_t retries;
+  uint32_t lastConsistentMicros;
+  uint32_t maxConsistentMicros;
+  uint64_t totalConsistentMicros;
+  uint32_t consistentSamples;
+
+  void updatePaced(unsigned long now);
+  bool sendTrackRequest(uint8_t track, unsigned long now);
+  void finishData();
+
+public:
+  BankSyncManager();
+  ~BankSyncManager();
+
+  bool initialize();
+
+  // Inicia el refresco del banco recién seleccionado. La pantalla ya muestra
+  // los valores en caché de EncoderManager; aquí solo se pide lo que falte.
+  void startBankSwitch(uint8_t newBank, bool requestColors);
+  void update();
+
+  // Respuestas del DAW (llamadas desde los callbacks de Studio One)
+  void onValueReceived(uint8_t track, uint8_t fromBank);
+  void onColorReceived(uint8_t track, uint8_t fromBank);
+  void onBankStateReceived(uint8_t fromBank, uint8_t sections, uint16_t trackMask);
+
+  // Llamar tras cada frame de la pantalla principal
+  void onFrameDrawn();
+
+  bool isSyncing() const { return phase != BANK_SYNC_IDLE; }
+  uint16_t getPendingMask() const { return pendingValues | pendingColors; }
+  uint32_t getLastConsistentMicros() const { return lastConsistentMicros; }
+  void printStatistics() const;
+};
+
+extern BankSyncManager bankSyncManager;
+
+#endif // BANK_SYNC_MANAGER_H
@@ -19,6 +19,7 @@
 #define TFT_SCLK        12
 #define TFT_MOSI        11
 #define TFT_MISO        13
+#define TFT_TE          -1    // Salida TE (tearing effect) de la ST7796S; -1 = sin cablear
 
 #define SD_CS           4     // GPIO4
 #define SD_SCLK         12
@@ -31,6 +32,10 @@
 #define INT_MCP2_A      3     // GPIO3 (RX0)
 #define INT_MCP2_B      8     // GPIO8
 
+// Puerto MIDI DIN de 5 pines (UART1, optoacoplador en RX)
+#define DIN_MIDI_RX_PIN 18    // GPIO18
+#define DIN_MIDI_TX_PIN 17    // GPIO17
+
 // Direcciones I2C de los MCP23017
 #define MCP_ENCODERS_VOL_ADDR   0x20
 #define MCP_ENCODERS_PAN_ADDR   0x21
@@ -44,7 +49,8 @@
 
 // ==================== CONFIGURACIÓN DEL SISTEMA ====================
 #define NUM_ENCODERS    16
-#define NUM_BANKS       4
+#define MAX_BANKS       32  // Capacidad máxima (máscaras de 32 bits)
+#define DEFAULT_BANK_COUNT 4
 #define NUM_SWITCHES    16
 #define NUM_BUTTONS     5
 
@@ -55,17 +61,42 @@
 #define ENCODER_DEBOUNCE_MS     1
 #define BUTTON_DEBOUNCE_MS      50
 #define SCREENSAVER_CHECK_MS    1000
+#define BACKGROUND_TASK_INTERVAL_MS 200
 
 // Tiempos de actualización optimizados
 #define MIDI_UPDATE_INTERVAL      2    // ms entre procesamientos MIDI
-#define VU_UPDATE_INTERVAL        50   // ms entre actualizaciones de VU
-#define DISPLAY_PARTIAL_UPDATE    20   // ms para actualizaciones parciales
+#define VU_UPDATE_INTERVAL        50   // ms entre pasos de caída de los VU
+#define DISPLAY_PARTIAL_UPDATE    20   // ms entre volcados de medidores y faders
+
+// Planificador de pantalla: sin TE se supone un barrido de periodo fijo
+#define DISPLAY_SCANOUT_US        16667  // Refresco del panel (~60 Hz)
+#define DISPLAY_SCAN_LINES        480    // Líneas nativas del barrido
+#define DISPLAY_FRAME_BUDGET_US   8000   // Volcado máximo por pasada; el resto espera
+#define DISPLAY_MAX_DEFER_MS      250    // Espera máxima de una región con MIDI ocupado
+#define DISPLAY_REFRESH_INTERVAL  5000   // ms entre repasos de todos los widgets
+
+// Reposo del panel (salvapantallas). La ST7796S pide 120 ms entre SLPIN y
+// SLPOUT, en los dos sentidos, y 5 ms tras SLPOUT antes de otro comando
+#define DISPLAY_SLEEP_GUARD_US    120000
+#define DISPLAY_SLEEP_OUT_US      5000
+#define SCREENSAVER_MAX_SECONDS   3600   // AppConfig::screensaverTimeout va en segundos
 
 // ==================== CONFIGURACIÓN MIDI ====================
 #define MIDI_CHANNEL_DEFAULT    1
-#define MTC_FRAME_RATE         30
+#define MTC_DEFAULT_RATE       MTC_RATE_30   // Hasta recibir la tasa del DAW
 #define ENCODER_ACCELERATION   true
 
+// Cables (puertos virtuales) del interfaz USB-MIDI, más el puerto DIN
+#define USB_MIDI_CABLES        3
+#define MIDI_OUTPUT_PORTS      (USB_MIDI_CABLES + 1)
+#define DIN_MIDI_BAUD          31250
+enum MidiCable {
+  CABLE_MAIN = 0,        // Mackie principal: transporte y script de Studio One
+  CABLE_EXTENDER = 1,    // Extensor Mackie
+  CABLE_GENERIC = 2,     // CC/notas genéricos para MIDI Learn
+  CABLE_DIN = 3          // Salida DIN (UART), fuera del interfaz USB
+};
+
 #define MIDI_PLAY              0xFA
 #define MIDI_STOP              0xFC  
 #define MIDI_RECORD            0xFB
@@ -80,8 +111,12 @@
 #define MAX_BRIGHTNESS         100
 
 #define MIDI_BUFFER_SIZE       32
-#define SYSEX_BUFFER_SIZE      16
-#define MAX_PRESET_NAME        10
+#define MIDI_PRIORITY_SLOTS    8    // Transporte, mute y solo: adelantan a la cola normal
+#define MIDI_OUTPUT_RATE_DEFAULT 4  // Mensajes USB por ms (0 = sin límite)
+#define MIDI_OUTPUT_BURST      16   // Mensajes que se pueden acumular sin enviar
+#define MIDI_CREDIT_DEPTH      8    // Ocupación de cola a partir de la cual los encoders esperan
+#define MIDI_BUSY_BURST        8    // Mensajes leídos en una pasada que cuentan como ráfaga
+#define SYSEX_BUFFER_SIZE      64   // Caben las respuestas de identidad, latencia y diagnóstico (63)
 #define MAX_FILENAME_LENGTH    12
 
 // ==================== COLORES STUDIO ONE 7 (RGB565) ====================
@@ -114,7 +149,30 @@ static const uint16_t STUDIO_ONE_COLORS[NUM_COLORS] = {
 enum ControlType {
   CT_CC = 0,
   CT_NOTE = 1,
-  CT_PITCH = 2
+  CT_PITCH = 2,
+  // Relativos (CC): solo se envía el desplazamiento, sin valor absoluto
+  CT_REL_TWOS = 3,       // Complemento a 2: 1..63 horario, 127..65 antihorario
+  CT_REL_SIGNED = 4,     // Signo y magnitud (V-Pot MCU): bit 6 = antihorario
+  CT_REL_OFFSET = 5      // Binario desplazado: 64 = sin cambio, 65.. horario, ..63 antihorario
+};
+
+// Resolución de salida; en CT_PITCH cualquier modo de 14 bits da pitch bend completo
+enum OutputResolution {
+  RES_7BIT = 0,
+  RES_14BIT_CC = 1,      // Par MSB/LSB: CC n y n+32 (solo n < 32)
+  RES_NRPN = 2           // NRPN: parámetro = número de control, Data Entry 6/38
+};
+
+// Pasos de 14 bits por paso del encoder: 8 pasos por unidad de 7 bits
+#define HIRES_STEP             16
+#define SENT_LSB_NONE          0xFF
+
+// Cómo recupera el encoder el control cuando su valor y el del DAW difieren
+enum TakeoverMode {
+  TAKEOVER_FOLLOW = 0,   // El valor local se iguala al del DAW (salvo mientras se toca)
+  TAKEOVER_JUMP = 1,     // El valor local manda; el DAW salta a él al mover
+  TAKEOVER_PICKUP = 2,   // Sin salida hasta que el valor local alcanza al del DAW
+  TAKEOVER_SCALED = 3    // La salida converge proporcionalmente hacia el valor local
 };
 
 enum ButtonIndex {
@@ -132,6 +190,14 @@ enum DisplayOrientation {
   ORIENT_270 = 3
 };
 
+// Vistas de la pantalla principal (ver MixerScene)
+enum MixerView {
+  VIEW_STRIPS_8 = 0,    // 8 canales: volumen y pan en la misma tira
+  VIEW_STRIPS_16,       // Una tira estrecha por encoder
+  VIEW_SINGLE,          // El último canal tocado, con medidor grande
+  VIEW_COUNT
+};
+
 enum MenuValueType {
   MENU_ACTION = 0,
   MENU_INTEGER = 1,
@@ -167,31 +233,75 @@ enum TransportStateEx {
     TRANSPORT_REWIND
 };
 // ==================== ESTRUCTURAS DE DATOS ====================
+#define TRACK_NAME_LENGTH      6   // 5 caracteres + terminador
+
+// Configuración de un encoder (datos fríos: menú, presets)
 struct EncoderConfig {
   uint8_t channel : 4;
   uint8_t control : 7;
-  uint8_t controlType : 2;
+  uint8_t controlType : 3;
   bool isPan : 1;
-  int8_t value;
-  int8_t dawValue;
+  uint8_t takeover : 2;
+  uint8_t resolution : 2;
+  uint8_t cable : 2;
   int8_t minValue;
   int8_t maxValue;
-  bool isMute : 1;
-  bool isSolo : 1;
-  uint16_t trackColor;
-  char trackName[3];
+  char trackName[TRACK_NAME_LENGTH];
 
   EncoderConfig() : channel(1), control(7), controlType(CT_CC), isPan(false),
-                   value(64), dawValue(64), minValue(0), maxValue(127),
-                   isMute(false), isSolo(false), trackColor(0xFFFF) {
-    strncpy(trackName, "Trk", 3);
-    trackName[2] = '\0';
+                   takeover(TAKEOVER_FOLLOW), resolution(RES_7BIT), cable(CABLE_GENERIC),
+                   minValue(0), maxValue(127) {
+    strncpy(trackName, "Trk", TRACK_NAME_LENGTH);
+  }
+};
+
+// Estado de ejecución de un banco (datos calientes): un array por campo
+// para que el encoder y el refresco de pantalla recorran memoria contigua
+struct EncoderBankState {
+  int8_t value[NUM_ENCODERS];
+  int8_t dawValue[NUM_ENCODERS];        // Lo que se muestra: confirmado o predicción local
+  int8_t confirmedValue[NUM_ENCODERS];  // Último valor que dio el DAW; base de sus deltas
+  int8_t sentValue[NUM_ENCODERS];   // Último valor enviado (o confirmado por el DAW); -1 = ninguno
+  uint16_t value14[NUM_ENCODERS];   // Acumulador fino; value = value14 >> 7
+  uint8_t sentLsb[NUM_ENCODERS];    // LSB del último envío de 14 bits; SENT_LSB_NONE = desconocido
+  uint16_t trackColor[NUM_ENCODERS];
+  uint16_t muteMask;   // bit n = encoder n
+  uint16_t soloMask;
+  uint16_t pickupMask; // bit n = encoder n en recogida (PICKUP/SCALED)
+
+  EncoderBankState() : muteMask(0), soloMask(0), pickupMask(0) {
+    memset(value, 64, sizeof(value));
+    memset(dawValue, 64, sizeof(dawValue));
+    memset(confirmedValue, 64, sizeof(confirmedValue));
+    memset(sentValue, -1, sizeof(sentValue));
+    memset(sentLsb, SENT_LSB_NONE, sizeof(sentLsb));
+    for (uint8_t i = 0; i < NUM_ENCODERS; i++) value14[i] = 64 << 7;
+    for (uint8_t i = 0; i < NUM_ENCODERS; i++) trackColor[i] = 0xFFFF;
   }
+
+  bool isMute(uint8_t enc) const { return muteMask & (1 << enc); }
+  bool isSolo(uint8_t enc) const { return soloMask & (1 << enc); }
 };
 
+// Memoria de un banco: configuración + estado
+#define ENCODER_BANK_BYTES  (sizeof(EncoderConfig) * NUM_ENCODERS + sizeof(EncoderBankState))
+
+// Cabecera de la tabla de encoders en ficheros de configuración y presets.
+// Le siguen bankCount bancos de configuración y después bankCount estados.
+#define ENCODER_IMAGE_MAGIC  0x434E4542  // "BENC"
+
+struct EncoderImageHeader {
+  uint32_t magic;
+  uint8_t bankCount;
+  uint8_t reserved[3];
+  uint32_t populatedMask;
+};
+
+#define ENCODER_IMAGE_MAX_SIZE  (sizeof(EncoderImageHeader) + ENCODER_BANK_BYTES * MAX_BANKS)
+
 struct AppConfig {
   uint8_t brightness;
-  uint16_t screensaverTimeout;
+  uint16_t screensaverTimeout;  // Segundos, 0 = nunca
   uint8_t currentBank;
   int8_t mtcOffset;
   bool encoderAcceleration;
@@ -200,7 +310,10 @@ struct AppConfig {
   bool autoSave;
   uint8_t encoderSensitivity;
   uint16_t vuMeterDecay;
-
+  uint8_t bankCount;
+  uint8_t midiOutputRate;       // Mensajes USB por ms, 0 = sin límite
+  uint8_t mixerView;            // MixerView
+  
   AppConfig() {
     brightness = DEFAULT_BRIGHTNESS;
     screensaverTimeout = 300;
@@ -212,17 +325,40 @@ struct AppConfig {
     autoSave = true;
     encoderSensitivity = 5;
     vuMeterDecay = 1000;
+    bankCount = DEFAULT_BANK_COUNT;
+    midiOutputRate = MIDI_OUTPUT_RATE_DEFAULT;
+    mixerView = VIEW_STRIPS_8;
   }
 };
 
+// Tasas de MTC, con el valor de los bits rr de la pieza 7 y del frame completo
+enum MtcRate {
+  MTC_RATE_24 = 0,
+  MTC_RATE_25 = 1,
+  MTC_RATE_2997_DF = 2,   // 29,97 drop-frame
+  MTC_RATE_30 = 3
+};
+
 struct MtcData {
   uint8_t hours;
   uint8_t minutes;
   uint8_t seconds;
   uint8_t frames;
+  uint8_t frameRate;   // MtcRate
   bool isRunning;
   
-  MtcData() : hours(0), minutes(0), seconds(0), frames(0), isRunning(false) {}
+  MtcData() : hours(0), minutes(0), seconds(0), frames(0), frameRate(MTC_RATE_30), isRunning(false) {}
+};
+
+// Tempo y posición a partir del reloj MIDI y el Song Position Pointer
+struct ClockData {
+  uint16_t bpmX10;      // Décimas de BPM; 0 = sin reloj
+  uint16_t bar;         // Compás, desde 1 (4/4)
+  uint8_t beat;         // Tiempo en el compás (1-4)
+  uint8_t sixteenth;    // Semicorchea en el tiempo (1-4)
+  bool running;
+  
+  ClockData() : bpmX10(0), bar(1), beat(1), sixteenth(1), running(false) {}
 };
 
 struct TransportState {
@@ -238,6 +374,8 @@ struct SystemState {
   unsigned long lastPollTime;
   unsigned long lastDisplayUpdate;
   unsigned long lastDiagnostic;
+  unsigned long lastBackgroundTask;
+  unsigned long bankSwitchStart;   // micros() del último cambio de banco, 0 = ninguno
   bool screensaverActive;
   bool inMenu;
   uint8_t currentBank;
@@ -251,6 +389,8 @@ struct SystemState {
     lastPollTime = 0;
     lastDisplayUpdate = 0;
     lastDiagnostic = 0;
+    lastBackgroundTask = 0;
+    bankSwitchStart = 0;
     screensaverActive = false;
     inMenu = false;
     currentBank = 0;
@@ -267,7 +407,15 @@ struct InterruptFlags {
   volatile bool mcp2A;
   volatile bool mcp2B;
   
-  InterruptFlags() : mcp1A(false), mcp1B(false), mcp2A(false), mcp2B(false) {}
+  // micros() de la primera interrupción sin atender de cada puerto: origen
+  // de la latencia encoder -> USB
+  volatile uint32_t mcp1ATime;
+  volatile uint32_t mcp1BTime;
+  volatile uint32_t mcp2ATime;
+  volatile uint32_t mcp2BTime;
+  
+  InterruptFlags() : mcp1A(false), mcp1B(false), mcp2A(false), mcp2B(false),
+                     mcp1ATime(0), mcp1BTime(0), mcp2ATime(0), mcp2BTime(0) {}
 };
 
 // ==================== DECLARACIONES EXTERNAS ====================
@@ -276,7 +424,7 @@ extern AppConfig appConfig;
 extern volatile InterruptFlags interruptFlags;
 
 // Callbacks del sistema
-extern void onEncoderChange(uint8_t encoderIndex, int8_t change);
+extern void onEncoderChange(uint8_t encoderIndex, int8_t change, uint32_t eventTime);
 extern void onSwitchPress(uint8_t switchIndex);
 extern void onButtonPress(uint8_t buttonIndex);
 extern void onNavigationEncoderChange(int8_t change);
@@ -295,5 +443,9 @@ extern void syncEncoderColorFromDAW(uint8_t track, uint8_t bank, uint16_t color)
 extern void updateVUMeterLevel(uint8_t track, uint8_t level);
 extern void syncEncoderValueFromDAW(uint8_t track, uint8_t bank, uint8_t value);
 extern void syncEncoderNameFromDAW(uint8_t track, uint8_t bank, const char* name);
+struct BankStateMessage;
+extern void syncBankStateFromDAW(const BankStateMessage& state);
+struct ValueDeltaMessage;
+extern void syncValueDeltaFromDAW(const ValueDeltaMessage& delta);
 
 #endif // CONFIG_H
\ No newline at end of file
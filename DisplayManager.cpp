@@ -1,15 +1,54 @@
 #include "DisplayManager.h"
 #include "Strings.h"
+#include "SpiBusManager.h"
 #include <SPI.h>
 
+#define ST7796S_SLPIN    0x10
+#define ST7796S_SLPOUT   0x11
+#define ST7796S_DISPOFF  0x28
+#define ST7796S_DISPON   0x29
+#define ST7796S_TEON     0x35
+
+// Widgets que dibuja cada región del planificador
+static const uint16_t regionWidgets[REGION_COUNT] = {
+  WIDGET_BIT(WIDGET_METER),
+  WIDGET_BIT(WIDGET_FADER) | WIDGET_BIT(WIDGET_PAN),
+  WIDGET_BIT(WIDGET_LABEL) | WIDGET_BIT(WIDGET_BANK) | WIDGET_BIT(WIDGET_TIMECODE) |
+    WIDGET_BIT(WIDGET_CLOCK) | WIDGET_BIT(WIDGET_TRANSPORT)
+};
+
+// Flancos de la señal TE: el panel empieza a leer la RAM desde la primera línea
+static volatile uint32_t teLastMicros = 0;
+static volatile uint32_t tePeriodMicros = 0;
+static volatile uint32_t teEdges = 0;
+
+#if TFT_TE >= 0
+static void IRAM_ATTR handleTearingEffect() {
+  uint32_t now = micros();
+  if (teEdges) tePeriodMicros = now - teLastMicros;
+  teLastMicros = now;
+  teEdges++;
+}
+#endif
+
 DisplayManager::DisplayManager() 
   : tft(TFT_CS, TFT_DC, TFT_RST), initialized(false), currentBrightness(100),
-    currentOrientation(ORIENT_270), needsFullRedraw(true), lastFullRedraw(0),
-    transportDirty(false), mtcDirty(false)
+    currentOrientation(ORIENT_270), mixerView(VIEW_STRIPS_8), focusChannel(0), widgetsDrawn(0),
+    midiBusy(false), frameOverruns(0), scanEpoch(0), statsWindowStart(0),
+    lastTransportFlags(0xFF),
+    textSpansDrawn(0), textSpansSkipped(0), textPixels(0), textMicros(0),
+    needsFullRedraw(true), lastFullRedraw(0),
+    powerState(PANEL_ACTIVE), powerStateSince(0), powerCommandMicros(0), sleepOutSent(false),
+    sleepCount(0), wakeStart(0), wakeLatencyLast(0), wakeLatencyMax(0), wakeLatencyTotal(0), wakeCount(0)
 {
+  memset(powerResidency, 0, sizeof(powerResidency));
   memset(vuLevels, 0, sizeof(vuLevels));
   memset(lastVuUpdate, 0, sizeof(lastVuUpdate));
-  memset(channelDirty, true, sizeof(channelDirty)); // Inicializar todos como sucios
+  memset(regions, 0, sizeof(regions));
+  regions[REGION_METERS].periodMs = DISPLAY_PARTIAL_UPDATE;
+  regions[REGION_FADERS].periodMs = DISPLAY_PARTIAL_UPDATE;
+  regions[REGION_LABELS].periodMs = DISPLAY_UPDATE_INTERVAL;
+  invalidateDrawn();
   calculateLayout();
 }
 
@@ -20,9 +59,14 @@ bool DisplayManager::initialize(DisplayOrientation orientation, uint8_t brightne
   Serial.println(F("Inicializando pantalla ST7796..."));
   
   initializePins();
-  setupSPI();
   
+  SpiBusLock busLock(SPI_DEVICE_TFT);
   tft.init(); // Elimina la verificación de retorno
+  setupSPI();
+  setupTearingEffect();
+  
+  // Sin atlas el texto sigue saliendo por la fuente de Adafruit_GFX
+  glyphs.build();
   
   // Verifica la conexión con un test personalizado
   if (!testDisplayConnection()) {
@@ -60,8 +104,21 @@ void DisplayManager::initializePins() {
 }
 
 void DisplayManager::setupSPI() {
-  SPI.begin(TFT_SCLK, TFT_MISO, TFT_MOSI, TFT_CS);
-  SPI.setFrequency(40000000); // 40MHz
+  // El bus lo inicializa SpiBusManager; aquí solo se fija el reloj de la pantalla
+  tft.setSPISpeed(spiBusManager.getClock(SPI_DEVICE_TFT));
+}
+
+// Con TE cableada el panel avisa de cada barrido (solo V-blank); sin ella el
+// planificador supone un barrido de DISPLAY_SCANOUT_US desde el arranque
+void DisplayManager::setupTearingEffect() {
+  scanEpoch = micros();
+#if TFT_TE >= 0
+  const uint8_t vblankOnly = 0x00;
+  pinMode(TFT_TE, INPUT);
+  tft.sendCommand(ST7796S_TEON, &vblankOnly, 1);
+  attachInterrupt(digitalPinToInterrupt(TFT_TE), handleTearingEffect, RISING);
+  Serial.println(F("Pantalla: sincronismo TE activo"));
+#endif
 }
 
 bool DisplayManager::testDisplayConnection() {
@@ -82,221 +139,621 @@ bool DisplayManager::testDisplayConnection() {
 }
 
 void DisplayManager::setOrientation(DisplayOrientation orientation) {
+  SpiBusLock busLock(SPI_DEVICE_TFT);
   currentOrientation = orientation;
   tft.setRotation((uint8_t)orientation);
   calculateLayout();
   needsFullRedraw = true;
 }
 
+void DisplayManager::setMixerView(MixerView view) {
+  if (view >= VIEW_COUNT) view = VIEW_STRIPS_8;
+  if (view == mixerView) return;
+  
+  mixerView = view;
+  calculateLayout();
+  needsFullRedraw = true;
+}
+
+// Las otras vistas ya muestran todas las pistas: solo cambia la de un canal,
+// y lo que no varíe entre pistas (marcos, textos iguales) no se repinta
+void DisplayManager::setFocusChannel(uint8_t encoder) {
+  uint8_t track = encoder % (NUM_ENCODERS / 2);
+  if (track == focusChannel) return;
+  
+  focusChannel = track;
+  if (mixerView == VIEW_SINGLE) scene.invalidate(0, (1 << CHANNEL_WIDGETS) - 1);
+}
+
+// Tira de la escena que muestra el encoder, SCENE_NO_CHANNEL si no está a la vista
+uint8_t DisplayManager::stripForEncoder(uint8_t encoder) const {
+  switch (mixerView) {
+    case VIEW_STRIPS_16:
+      return encoder;
+    case VIEW_SINGLE:
+      return encoder % (NUM_ENCODERS / 2) == focusChannel ? 0 : SCENE_NO_CHANNEL;
+    default:
+      return encoder % (NUM_ENCODERS / 2);
+  }
+}
+
+// Encoder cuyo número, valor y nombre lleva la etiqueta de la tira
+uint8_t DisplayManager::stripEncoder(uint8_t strip) const {
+  return mixerView == VIEW_SINGLE ? focusChannel : strip;
+}
+
+// Dormido solo se guarda: se aplica al despertar
 void DisplayManager::setBrightness(uint8_t brightness) {
   currentBrightness = constrain(brightness, 0, 100);
-  analogWrite(TFT_BL, map(currentBrightness, 0, 100, 0, 255));
+  if (powerState == PANEL_ACTIVE) analogWrite(TFT_BL, map(currentBrightness, 0, 100, 0, 255));
 }
 
-void DisplayManager::calculateLayout() {
-  uint16_t effectiveWidth = TFT_WIDTH - 20;
-  uint16_t channelSpacing = effectiveWidth / 8;
+void DisplayManager::setPowerState(PanelPower state) {
+  unsigned long currentTime = millis();
+  powerResidency[powerState] += currentTime - powerStateSince;
+  powerStateSince = currentTime;
+  powerState = state;
+}
+
+bool DisplayManager::sleep() {
+  if (!initialized || powerState == PANEL_WAKING) return false;
+  if (powerState == PANEL_SLEEP) return true;
+  if (micros() - powerCommandMicros < DISPLAY_SLEEP_GUARD_US) return false;
+  
+  analogWrite(TFT_BL, 0);
+  SpiBusLock busLock(SPI_DEVICE_TFT);
+  tft.sendCommand(ST7796S_DISPOFF);
+  tft.sendCommand(ST7796S_SLPIN);
+  powerCommandMicros = micros();
+  setPowerState(PANEL_SLEEP);
+  sleepCount++;
+  return true;
+}
+
+// Sin borrar ni repintar entero: la escena ha seguido marcando lo que cambiaba
+// y el primer frame lleva solo eso
+void DisplayManager::wake() {
+  if (powerState != PANEL_SLEEP) return;
+  
+  wakeStart = micros();
+  sleepOutSent = false;
+  setPowerState(PANEL_WAKING);
+  updatePower();
+}
+
+void DisplayManager::updatePower() {
+  if (powerState != PANEL_WAKING) return;
+  unsigned long now = micros();
+  
+  if (!sleepOutSent) {
+    if (now - powerCommandMicros < DISPLAY_SLEEP_GUARD_US) return;
+    SpiBusLock busLock(SPI_DEVICE_TFT);
+    tft.sendCommand(ST7796S_SLPOUT);
+    powerCommandMicros = now;
+    sleepOutSent = true;
+    return;
+  }
+  if (now - powerCommandMicros < DISPLAY_SLEEP_OUT_US) return;
   
-  for (int i = 0; i < 8; i++) {
-    layout.channelX[i] = 10 + (i * channelSpacing) + (channelSpacing - CHANNEL_WIDTH) / 2;
+  {
+    SpiBusLock busLock(SPI_DEVICE_TFT);
+    tft.sendCommand(ST7796S_DISPON);
   }
+  setPowerState(PANEL_ACTIVE);
+  setBrightness(currentBrightness);
   
-  layout.headerY = 10;
-  layout.volumeBarY = HEADER_HEIGHT + 10;
-  layout.panBarY = layout.volumeBarY + VOLUME_BAR_HEIGHT + 10;
-  layout.textY = layout.panBarY + PAN_BAR_HEIGHT + 15;
+  // El tiempo dormido no cuenta como frames perdidos ni adelanta el repaso
+  // completo; todas las regiones tocan ya
+  unsigned long currentTime = millis();
+  lastFullRedraw = currentTime;
+  for (uint8_t r = 0; r < REGION_COUNT; r++) {
+    regions[r].lastFlush = currentTime - regions[r].periodMs;
+    regions[r].deferred = false;
+  }
+}
+
+void DisplayManager::frameShown() {
+  if (!wakeStart || powerState != PANEL_ACTIVE) return;
+  
+  wakeLatencyLast = micros() - wakeStart;
+  if (wakeLatencyLast > wakeLatencyMax) wakeLatencyMax = wakeLatencyLast;
+  wakeLatencyTotal += wakeLatencyLast;
+  wakeCount++;
+  wakeStart = 0;
+}
+
+// La escena se calcula con las dimensiones ya giradas: 480x320 en horizontal
+// y 320x480 en vertical
+void DisplayManager::calculateLayout() {
+  bool portrait = currentOrientation == ORIENT_0 || currentOrientation == ORIENT_180;
+  uint16_t width = portrait ? TFT_HEIGHT : TFT_WIDTH;
+  uint16_t height = portrait ? TFT_WIDTH : TFT_HEIGHT;
   
-  layout.mtcX = TFT_WIDTH / 2 - 80;
-  layout.mtcY = 15;
-  layout.bankX = 20;
-  layout.bankY = 15;
+  if (!scene.build(width, height, mixerView)) {
+    Serial.println(F("ERROR: Disposición de pantalla no válida"));
+  }
 }
 
-void DisplayManager::drawMainScreen(const EncoderConfig encoders[NUM_ENCODERS], 
+bool DisplayManager::drawMainScreen(const EncoderBankState& state, const EncoderConfig configs[NUM_ENCODERS], 
                                   const MtcData& mtc, uint8_t currentBank, 
-                                  const TransportState& transport) {
-  if (!initialized) return;
+                                  const TransportState& transport, const ClockData& clock) {
+  if (!initialized || powerState != PANEL_ACTIVE) return false;
   
   unsigned long currentTime = millis();
+  updateVUMeters();
+  
+  // El repaso periódico sólo ensucia los widgets: pasa por las regiones, el
+  // presupuesto y la espera por MIDI como cualquier otro cambio
+  if (!needsFullRedraw && currentTime - lastFullRedraw > DISPLAY_REFRESH_INTERVAL) {
+    markAllChannelsDirty();
+    lastFullRedraw = currentTime;
+  }
+  
+  // Sólo el borrado completo se dibuja entero, sin presupuesto
+  bool fullFrame = needsFullRedraw;
+  uint8_t due = fullFrame ? (1 << REGION_COUNT) - 1 : dueRegions(currentTime);
+  if (!due) return false;
   
-  if (needsFullRedraw || (currentTime - lastFullRedraw > 5000)) {
+  SpiBusLock busLock(SPI_DEVICE_TFT);
+  
+  if (fullFrame) {
     clearScreen(COLOR_BLACK);
     drawHeader();
     needsFullRedraw = false;
     lastFullRedraw = currentTime;
+    markAllChannelsDirty();
+    // Tras un frame completo los plazos empiezan de nuevo
+    for (uint8_t r = 0; r < REGION_COUNT; r++) {
+      regions[r].lastFlush = currentTime;
+      regions[r].deferred = false;
+    }
   }
   
-  updateVUMeters();
+  // Tipos de widget que toca dibujar en esta pasada
+  uint8_t typeMask = 0;
+  for (uint8_t r = 0; r < REGION_COUNT; r++) {
+    if (due & (1 << r)) typeMask |= regionWidgets[r];
+  }
   
-  for (int i = 0; i < 8; i++) {
-    const EncoderConfig& volEncoder = encoders[i];
-    const EncoderConfig& panEncoder = encoders[i + 8];
-    
-    drawVolumeBar(i, volEncoder.dawValue, volEncoder.trackColor, 
-                 volEncoder.isSolo || volEncoder.isMute);
-    drawVUMeter(i, vuLevels[i], volEncoder.trackColor);
+  // Volumen en los encoders 0-7, pan en 8-15. Cada tira muestra la pista de
+  // su encoder: en la vista de 16 las tiras 8-15 son los pan de las 0-7
+  uint16_t highlightMask = state.muteMask | state.soloMask;
+  uint8_t channels = scene.getChannelCount();
+  uint8_t order[SCENE_MAX_CHANNELS];
+  scanOrder(order);
+  
+  unsigned long frameStart = micros();
+  bool overrun = false;
+  
+  for (uint8_t n = 0; n < channels; n++) {
+    uint8_t i = order[n];
+    uint8_t encoder = stripEncoder(i);
+    uint8_t track = encoder % (NUM_ENCODERS / 2);
+        
+    // Lo que no quepa en el presupuesto sigue sucio para la siguiente pasada
+    if (!fullFrame && micros() - frameStart > DISPLAY_FRAME_BUDGET_US) {
+      overrun = true;
+      break;
+    }
     
-    drawPanBar(i, panEncoder.dawValue, panEncoder.trackColor);
+    for (uint8_t type = 0; type < CHANNEL_WIDGETS; type++) {
+      Widget& widget = scene.channelWidget(i, type);
+      if (!widget.dirty || !(typeMask & WIDGET_BIT(type))) continue;
+      widget.dirty = false;
+      widgetsDrawn++;
+      
+      switch (type) {
+        case WIDGET_FADER:
+          drawVolumeBar(widget, state.dawValue[track], state.trackColor[track], highlightMask & (1 << track));
+          break;
+        case WIDGET_PAN:
+          drawPanBar(widget, state.dawValue[track + 8], state.trackColor[track + 8]);
+          break;
+        case WIDGET_METER:
+          drawVUMeter(widget, vuLevels[track]);
+          break;
+        case WIDGET_LABEL:
+          drawChannelInfo(widget, configs[encoder], state, encoder);
+          break;
+      }
+    }
     
-    drawChannelInfo(i, volEncoder);
+    // Un canal completo es un volcado largo: dejar pasar a la SD si espera
+    spiBusManager.yieldIfContended(SPI_DEVICE_TFT);
   }
   
-  drawMTCInfo(mtc);
-  drawTransportInfo(transport, currentBank);
+  // Los globales comparan su texto con lo ya dibujado: se pasan en cada pasada
+  if ((due & (1 << REGION_LABELS)) && !overrun) {
+    drawMTCInfo(mtc);
+    drawTransportInfo(transport, currentBank);
+    drawClockInfo(clock);
+  }
+  
+  if (overrun) frameOverruns++;
+  bool complete = true;
+  for (uint8_t r = 0; r < REGION_COUNT; r++) {
+    bool pending = scene.isDirty(regionWidgets[r]) || (r == REGION_LABELS && overrun);
+    if ((due & (1 << r)) && !pending) completeRegion(r, currentTime);
+    complete = complete && !pending;
+  }
+  if (complete) frameShown();
+  return complete;
+}
+
+// Regiones a volcar en esta pasada. Una región sin cambios no cuenta como
+// frame; con MIDI ocupado los faders y el texto esperan (hasta
+// DISPLAY_MAX_DEFER_MS) y los medidores siguen a su ritmo
+uint8_t DisplayManager::dueRegions(unsigned long currentTime) {
+  uint8_t due = 0;
+  
+  for (uint8_t r = 0; r < REGION_COUNT; r++) {
+    RegionSchedule& region = regions[r];
+    unsigned long elapsed = currentTime - region.lastFlush;
+    if (elapsed < region.periodMs) continue;
+    
+    // El texto global se revisa en cada pasada de etiquetas
+    if (r != REGION_LABELS && !scene.isDirty(regionWidgets[r])) {
+      region.lastFlush = currentTime;
+      continue;
+    }
+    
+    if (midiBusy && r != REGION_METERS && elapsed < DISPLAY_MAX_DEFER_MS) {
+      region.deferred = true;
+      continue;
+    }
+    due |= 1 << r;
+  }
+  return due;
+}
+
+void DisplayManager::completeRegion(uint8_t region, unsigned long currentTime) {
+  RegionSchedule& schedule = regions[region];
+  uint32_t periods = (currentTime - schedule.lastFlush) / schedule.periodMs;
+  
+  // Cada periodo de más es un frame: cedido a MIDI o, si no, perdido
+  if (schedule.deferred) {
+    if (periods > 1) schedule.dropped += periods - 1;
+    schedule.deferred = false;
+  } else if (schedule.flushes && periods > 1) {
+    schedule.missed++;
+  }
+  schedule.lastFlush = currentTime;
+  schedule.flushes++;
+  schedule.windowFlushes++;
+}
+
+// Línea que el panel está leyendo, 0 a DISPLAY_SCAN_LINES - 1. Sin TE (o si
+// deja de llegar) se usa el barrido supuesto: sirve para repartir los volcados
+// a lo largo del frame, no para evitar el tearing
+uint16_t DisplayManager::scanLine(unsigned long nowMicros) const {
+  uint32_t period = tePeriodMicros;
+  uint32_t elapsed = nowMicros - teLastMicros;
+  
+  if (!period || elapsed >= 2 * period) {
+    period = DISPLAY_SCANOUT_US;
+    elapsed = nowMicros - scanEpoch;
+  }
+  return (elapsed % period) * DISPLAY_SCAN_LINES / period;
 }
 
-void DisplayManager::drawVolumeBar(uint8_t channel, uint8_t value, uint16_t color, bool highlighted) {
-  uint16_t x = layout.channelX[channel];
-  uint16_t y = layout.volumeBarY;
+// Orden de volcado de los canales: primero los que el barrido acaba de dejar
+// atrás, que son los que más tardará en volver a leer. El panel es 320x480 en
+// nativo y barre a lo largo: en horizontal cada columna de canales cae en su
+// propio tramo de líneas y en vertical cada fila
+void DisplayManager::scanOrder(uint8_t order[SCENE_MAX_CHANNELS]) const {
+  uint8_t channels = scene.getChannelCount();
+  bool portrait = currentOrientation == ORIENT_0 || currentOrientation == ORIENT_180;
+  bool reversed = currentOrientation == ORIENT_180 || currentOrientation == ORIENT_270;
+  
+  uint16_t line = scanLine(micros());
+  uint16_t behind[SCENE_MAX_CHANNELS];
+  for (uint8_t i = 0; i < channels; i++) {
+    // La etiqueta está en todas las vistas y centrada con la tira
+    const Widget& label = scene.channelWidget(i, WIDGET_LABEL);
+    uint16_t center = portrait ? label.y + label.h / 2 : label.x + label.w / 2;
+    uint16_t channelLine = reversed ? DISPLAY_SCAN_LINES - 1 - center : center;
+    behind[i] = (line + DISPLAY_SCAN_LINES - channelLine) % DISPLAY_SCAN_LINES;
+    order[i] = i;
+  }
   
-  tft.drawRect(x, y, VOLUME_BAR_WIDTH, VOLUME_BAR_HEIGHT, COLOR_LIGHT_GRAY);
-  tft.fillRect(x + 1, y + 1, VOLUME_BAR_WIDTH - 2, VOLUME_BAR_HEIGHT - 2, COLOR_BLACK);
+  for (uint8_t i = 1; i < channels; i++) {
+    uint8_t channel = order[i];
+    int8_t j = i - 1;
+    while (j >= 0 && behind[order[j]] > behind[channel]) {
+      order[j + 1] = order[j];
+      j--;
+    }
+    order[j + 1] = channel;
+  }
+}
+
+// Posiciones de los campos de la etiqueta normal y la compacta (vista de 16)
+struct LabelStyle {
+  uint8_t numberFont;
+  uint8_t numberHeight;
+  uint8_t valueY;
+  uint8_t flagsY;
+  uint8_t nameY;
+  uint8_t nameHeight;
+  uint8_t nameChars;
+};
+
+static const LabelStyle labelStyles[2] = {
+  { FONT_SMOOTH_MEDIUM, 16, 20, 30, 40, 14, 5 },
+  { FONT_SMOOTH_SMALL,  12, 14, 26, 38, 12, 3 }
+};
+
+// El rectángulo del widget incluye la marca de 0 dB, 2 píxeles más ancha por
+// lado. Con el marco ya en pantalla solo se vuelca el tramo de barra que cambia
+void DisplayManager::drawVolumeBar(const Widget& widget, uint8_t value, uint16_t color, bool highlighted) {
+  StripCache& cache = stripCache[widget.channel];
+  uint16_t x = widget.x + 2;
+  uint16_t y = widget.y;
+  uint16_t w = widget.w - 4;
+  uint16_t h = widget.h;
+  uint16_t bottom = y + h - 2;
+  uint16_t barHeight = map(value, 0, 127, 0, h - 4);
+  uint16_t barColor = highlighted ? COLOR_RED : color;
+  
+  if (cache.faderFill == STRIP_UNDRAWN) {
+    tft.drawRect(x, y, w, h, COLOR_LIGHT_GRAY);
+    tft.fillRect(x + 1, y + 1, w - 2, h - 2, COLOR_BLACK);
+    cache.faderFill = 0;
+  } else if (cache.faderFill == barHeight && cache.faderColor == barColor) {
+    return;
+  }
   
-  uint16_t barHeight = map(value, 0, 127, 0, VOLUME_BAR_HEIGHT - 4);
-  if (barHeight > 0) {
-    uint16_t barColor = highlighted ? COLOR_RED : color;
-    tft.fillRect(x + 2, y + VOLUME_BAR_HEIGHT - 2 - barHeight, 
-                VOLUME_BAR_WIDTH - 4, barHeight, barColor);
+  if (barColor != cache.faderColor) {
+    // Otro color (mute/solo o pista): la barra entera
+    tft.fillRect(x + 2, bottom - barHeight, w - 4, barHeight, barColor);
+  } else if (barHeight > cache.faderFill) {
+    tft.fillRect(x + 2, bottom - barHeight, w - 4, barHeight - cache.faderFill, barColor);
   }
+  if (barHeight < cache.faderFill) {
+    tft.fillRect(x + 2, bottom - cache.faderFill, w - 4, cache.faderFill - barHeight, COLOR_BLACK);
+  }
+  cache.faderFill = barHeight;
+  cache.faderColor = barColor;
   
-  uint16_t zeroDbY = y + VOLUME_BAR_HEIGHT - map(100, 0, 127, 0, VOLUME_BAR_HEIGHT - 4);
-  tft.drawFastHLine(x - 2, zeroDbY, VOLUME_BAR_WIDTH + 4, COLOR_YELLOW);
+  uint16_t zeroDbY = y + h - map(100, 0, 127, 0, h - 4);
+  tft.drawFastHLine(x - 2, zeroDbY, w + 4, COLOR_YELLOW);
 }
 
-void DisplayManager::drawPanBar(uint8_t channel, uint8_t value, uint16_t color) {
-  uint16_t x = layout.channelX[channel] + 25;
-  uint16_t y = layout.panBarY;
-  
-  tft.drawRect(x, y, PAN_BAR_WIDTH, PAN_BAR_HEIGHT, COLOR_LIGHT_GRAY);
-  tft.fillRect(x + 1, y + 1, PAN_BAR_WIDTH - 2, PAN_BAR_HEIGHT - 2, COLOR_BLACK);
+// Al moverse solo se borra el marcador anterior y se pinta el nuevo
+void DisplayManager::drawPanBar(const Widget& widget, uint8_t value, uint16_t color) {
+  StripCache& cache = stripCache[widget.channel];
+  uint16_t x = widget.x + 2;
+  uint16_t y = widget.y;
+  uint16_t w = widget.w - 4;
+  uint16_t h = widget.h;
+  uint16_t panY = map(value, 0, 127, y + h - 6, y + 2);
+  
+  if (cache.panY == STRIP_UNDRAWN) {
+    tft.drawRect(x, y, w, h, COLOR_LIGHT_GRAY);
+    tft.fillRect(x + 1, y + 1, w - 2, h - 2, COLOR_BLACK);
+  } else if (cache.panY == panY && cache.panColor == color) {
+    return;
+  } else {
+    tft.fillRect(x + 2, cache.panY, w - 4, 4, COLOR_BLACK);
+  }
   
-  uint16_t centerY = y + PAN_BAR_HEIGHT / 2;
-  tft.drawFastHLine(x - 2, centerY, PAN_BAR_WIDTH + 4, COLOR_WHITE);
+  uint16_t centerY = y + h / 2;
+  tft.drawFastHLine(x - 2, centerY, w + 4, COLOR_WHITE);
   
-  uint16_t panY = map(value, 0, 127, y + PAN_BAR_HEIGHT - 6, y + 2);
-  tft.fillRect(x + 2, panY, PAN_BAR_WIDTH - 4, 4, color);
+  tft.fillRect(x + 2, panY, w - 4, 4, color);
+  cache.panY = panY;
+  cache.panColor = color;
 }
 
-// Mejora la función drawVUMeter para ser más responsive
-void DisplayManager::drawVUMeter(uint8_t channel, uint8_t level, uint16_t color) {
-    if (channel >= 8) return;
-    
-    uint16_t x = layout.channelX[channel] + 42;
-    uint16_t y = layout.volumeBarY;
-    
-    // Limpiar el área del VU meter
-    tft.fillRect(x, y, 3, VOLUME_BAR_HEIGHT, COLOR_BLACK);
-    
-    if (level > 0) {
-        uint16_t meterHeight = map(level, 0, 127, 0, VOLUME_BAR_HEIGHT);
-        
-        // Dibujar el VU meter con colores según el nivel
-        for (int i = 0; i < meterHeight; i++) {
-            uint16_t vuColor;
-            uint8_t levelPercent = map(i, 0, VOLUME_BAR_HEIGHT, 0, 100);
-            
-            if (levelPercent < 60) vuColor = COLOR_GREEN;
-            else if (levelPercent < 80) vuColor = COLOR_YELLOW;
-            else vuColor = COLOR_RED;
-            
-            tft.drawFastHLine(x, y + VOLUME_BAR_HEIGHT - i - 1, 3, vuColor);
-        }
-    }
+// Verde hasta el 60 %, amarillo hasta el 80 % y rojo el resto. Al subir se
+// pintan los tramos que faltan y al bajar se borra lo que sobra: un medidor
+// cayendo no repinta la columna entera en cada frame
+void DisplayManager::drawVUMeter(const Widget& widget, uint8_t level) {
+  static const uint16_t zoneColors[3] = { COLOR_GREEN, COLOR_YELLOW, COLOR_RED };
+  StripCache& cache = stripCache[widget.channel];
+  uint16_t h = widget.h;
+  uint16_t bottom = widget.y + h;
+  uint16_t lit = map(level, 0, 127, 0, h);
+  
+  if (cache.meterFill == STRIP_UNDRAWN) {
+    tft.fillRect(widget.x, widget.y, widget.w, h, COLOR_BLACK);
+    cache.meterFill = 0;
+  }
+  
+  if (lit < cache.meterFill) {
+    tft.fillRect(widget.x, bottom - cache.meterFill, widget.w, cache.meterFill - lit, COLOR_BLACK);
+  }
+  
+  uint16_t zoneTop[3] = { (uint16_t)(h * 60 / 100), (uint16_t)(h * 80 / 100), h };
+  uint16_t zoneStart = 0;
+  for (uint8_t z = 0; z < 3; z++) {
+    uint16_t from = max(cache.meterFill, zoneStart);
+    uint16_t to = min(lit, zoneTop[z]);
+    if (to > from) tft.fillRect(widget.x, bottom - to, widget.w, to - from, zoneColors[z]);
+    zoneStart = zoneTop[z];
+  }
+  cache.meterFill = lit;
 }
 
-void DisplayManager::drawChannelInfo(uint8_t channel, const EncoderConfig& config) {
-  uint16_t x = layout.channelX[channel];
-  uint16_t y = layout.textY;
+void DisplayManager::drawChannelInfo(const Widget& widget, const EncoderConfig& config, const EncoderBankState& state,
+                                     uint8_t encoder) {
+  uint8_t track = encoder % (NUM_ENCODERS / 2);
+  if (scene.getView() == VIEW_SINGLE) {
+    drawChannelDetail(widget, config, state, track);
+    return;
+  }
   
-  char channelStr[3];
-  snprintf(channelStr, sizeof(channelStr), "%d", channel + 1);
-  drawCenteredText(channelStr, x, y, CHANNEL_WIDTH, 16, COLOR_WHITE, FONT_SIZE_MEDIUM);
+  const LabelStyle& style = labelStyles[scene.getView() == VIEW_STRIPS_16 ? 1 : 0];
+  uint8_t channel = widget.channel;
+  uint16_t x = widget.x;
+  uint16_t y = widget.y;
+  uint16_t w = widget.w;
+  TextSlot* slots = channelText[channel];
   
-  char valueStr[4];
-  snprintf(valueStr, sizeof(valueStr), "%d", config.dawValue);
-  drawCenteredText(valueStr, x, y + 20, CHANNEL_WIDTH, 12, COLOR_LIGHT_GRAY, FONT_SIZE_SMALL);
+  // Cada campo vuelca su propio fondo: no hace falta limpiar el canal entero
+  char channelStr[4];
+  snprintf(channelStr, sizeof(channelStr), "%d", encoder + 1);
+  drawTextField(slots[0], channelStr, x, y, w, style.numberHeight, COLOR_WHITE, COLOR_BLACK, style.numberFont);
+  
+  char valueStr[5];
+  snprintf(valueStr, sizeof(valueStr), "%d", state.dawValue[encoder]);
+  drawTextField(slots[1], valueStr, x, y + style.valueY, w, 10, COLOR_LIGHT_GRAY, COLOR_BLACK, FONT_SMOOTH_SMALL);
   
   char nameDisplay[7];
-  snprintf(nameDisplay, sizeof(nameDisplay), "%.5s", config.trackName);
-  drawCenteredText(nameDisplay, x, y + 40, CHANNEL_WIDTH, 12, 
-                   COLOR_LIGHT_GRAY, FONT_SIZE_SMALL);
+  snprintf(nameDisplay, sizeof(nameDisplay), "%.*s", style.nameChars, config.trackName);
+  drawTextField(slots[2], nameDisplay, x, y + style.nameY, w, style.nameHeight,
+                COLOR_LIGHT_GRAY, COLOR_BLACK, FONT_SMOOTH_SMALL);
+  
+  // Indicadores sobre círculo: solo cuando cambian
+  uint8_t flags = (state.isMute(track) ? 0x01 : 0) | (state.isSolo(track) ? 0x02 : 0);
+  if (flags == channelFlags[channel]) return;
+  channelFlags[channel] = flags;
+  
+  uint16_t flagsY = y + style.flagsY;
+  tft.fillRect(x, flagsY, w, 10, COLOR_BLACK);
                    
-  if (config.isMute) {
-    tft.fillCircle(x + 5, y + 35, 4, COLOR_RED);
-    drawCenteredText("M", x, y + 30, 12, 12, COLOR_WHITE, FONT_SIZE_SMALL);
+  if (flags & 0x01) {
+    tft.fillCircle(x + 5, flagsY + 5, 4, COLOR_RED);
+    drawCenteredText("M", x, flagsY, 12, 12, COLOR_WHITE, FONT_SIZE_SMALL);
   }
   
-  if (config.isSolo) {
-    tft.fillCircle(x + CHANNEL_WIDTH - 10, y + 35, 4, COLOR_YELLOW);
-    drawCenteredText("S", x + CHANNEL_WIDTH - 15, y + 30, 12, 12, COLOR_BLACK, FONT_SIZE_SMALL);
+  if (flags & 0x02) {
+    tft.fillCircle(x + w - 10, flagsY + 5, 4, COLOR_YELLOW);
+    drawCenteredText("S", x + w - 15, flagsY, 12, 12, COLOR_BLACK, FONT_SIZE_SMALL);
   }
 }
 
+// Vista de un canal: número grande, nombre y los valores de volumen y pan
+void DisplayManager::drawChannelDetail(const Widget& widget, const EncoderConfig& config, const EncoderBankState& state,
+                                       uint8_t track) {
+  uint16_t x = widget.x;
+  uint16_t y = widget.y;
+  uint16_t w = widget.w;
+  TextSlot* slots = channelText[widget.channel];
+  char text[TEXT_SLOT_CHARS];
+  
+  snprintf(text, sizeof(text), "Canal %d", track + 1);
+  drawTextField(slots[0], text, x, y, w, 30, COLOR_WHITE, COLOR_BLACK, FONT_SMOOTH_LARGE, false);
+  
+  drawTextField(slots[2], config.trackName, x, y + 36, w, 24, COLOR_LIGHT_GRAY, COLOR_BLACK,
+                FONT_SMOOTH_MEDIUM, false);
+  
+  snprintf(text, sizeof(text), "Vol %d", state.dawValue[track]);
+  drawTextField(slots[1], text, x, y + 66, w, 24, COLOR_WHITE, COLOR_BLACK, FONT_SMOOTH_MEDIUM, false);
+  
+  snprintf(text, sizeof(text), "Pan %d", state.dawValue[track + 8]);
+  drawTextField(slots[3], text, x, y + 96, w, 24, COLOR_WHITE, COLOR_BLACK, FONT_SMOOTH_MEDIUM, false);
+  
+  uint8_t flags = (state.isMute(track) ? 0x01 : 0) | (state.isSolo(track) ? 0x02 : 0);
+  if (flags == channelFlags[widget.channel]) return;
+  channelFlags[widget.channel] = flags;
+  
+  drawTextBox(flags & 0x01 ? "MUTE" : "", x, y + 130, 70, 24, COLOR_WHITE,
+              flags & 0x01 ? COLOR_RED : COLOR_BLACK, FONT_SMOOTH_MEDIUM);
+  drawTextBox(flags & 0x02 ? "SOLO" : "", x + 80, y + 130, 70, 24, COLOR_BLACK,
+              flags & 0x02 ? COLOR_YELLOW : COLOR_BLACK, FONT_SMOOTH_MEDIUM);
+}
+
 void DisplayManager::drawHeader() {
-  tft.drawFastHLine(0, HEADER_HEIGHT, TFT_WIDTH, COLOR_LIGHT_GRAY);
+  tft.drawFastHLine(0, scene.getHeaderHeight(), scene.getWidth(), COLOR_LIGHT_GRAY);
 }
 
+// Un widget global marcado sucio olvida el texto dibujado y se repinta entero
 void DisplayManager::drawMTCInfo(const MtcData& mtc) {
-  char timeStr[12];
-  snprintf(timeStr, sizeof(timeStr), "%02d:%02d:%02d:%02d", 
-           mtc.hours, mtc.minutes, mtc.seconds, mtc.frames);
+  Widget& widget = scene.globalWidget(WIDGET_TIMECODE);
+  if (widget.dirty) {
+    mtcText.valid = false;
+    widget.dirty = false;
+  }
   
-  tft.fillRect(layout.mtcX - 5, layout.mtcY - 2, 160, 25, COLOR_DARK_GRAY);
+  // En drop-frame el separador de frames es ';'
+  char timeStr[16];
+  snprintf(timeStr, sizeof(timeStr), "%02d:%02d:%02d%c%02d", 
+           mtc.hours, mtc.minutes, mtc.seconds,
+           mtc.frameRate == MTC_RATE_2997_DF ? ';' : ':', mtc.frames);
   
-  tft.setTextColor(mtc.isRunning ? COLOR_GREEN : COLOR_WHITE);
-  tft.setTextSize(FONT_SIZE_LARGE);
-  tft.setCursor(layout.mtcX, layout.mtcY);
-  tft.print(timeStr);
+  // El tiempo interpolado se pide en cada frame de pantalla: repintar solo al cambiar
+  drawTextField(mtcText, timeStr, widget.x, widget.y, widget.w, widget.h,
+                mtc.isRunning ? COLOR_GREEN : COLOR_WHITE, COLOR_DARK_GRAY, FONT_SMOOTH_LARGE);
 }
 
 void DisplayManager::drawTransportInfo(const TransportState& transport, uint8_t currentBank) {
-  char bankStr[3];
+  Widget& bank = scene.globalWidget(WIDGET_BANK);
+  if (bank.dirty) {
+    bankText.valid = false;
+    bank.dirty = false;
+  }
+  
+  char bankStr[5];
   snprintf(bankStr, sizeof(bankStr), "B%d", currentBank + 1);
   
-  tft.fillRect(layout.bankX - 2, layout.bankY - 2, 40, 25, COLOR_DARK_GRAY);
-  tft.setTextColor(COLOR_CYAN);
-  tft.setTextSize(FONT_SIZE_MEDIUM);
-  tft.setCursor(layout.bankX, layout.bankY);
-  tft.print(bankStr);
+  drawTextField(bankText, bankStr, bank.x, bank.y, bank.w, bank.h,
+                COLOR_CYAN, COLOR_DARK_GRAY, FONT_SMOOTH_MEDIUM);
+  
+  Widget& widget = scene.globalWidget(WIDGET_TRANSPORT);
+  if (widget.dirty) {
+    lastTransportFlags = 0xFF;
+    widget.dirty = false;
+  }
+  
+  uint8_t flags = (transport.isPlaying ? 0x01 : 0) | (transport.isRecording ? 0x02 : 0);
+  if (flags == lastTransportFlags) return;
+  lastTransportFlags = flags;
   
-  uint16_t transportX = TFT_WIDTH - 80;
+  // Reproducción y grabación: círculos de radio 6 con centro a 6 y 26 píxeles
+  tft.fillRect(widget.x, widget.y, widget.w, widget.h, COLOR_BLACK);
+  uint16_t centerY = widget.y + 6;
   
   if (transport.isPlaying) {
-    tft.fillCircle(transportX, layout.bankY + 10, 6, COLOR_GREEN);
-    drawCenteredText("P", transportX - 3, layout.bankY + 5, 8, 12, COLOR_BLACK, FONT_SIZE_SMALL);
+    tft.fillCircle(widget.x + 6, centerY, 6, COLOR_GREEN);
+    drawCenteredText("P", widget.x + 3, centerY - 5, 8, 12, COLOR_BLACK, FONT_SIZE_SMALL);
   }
   
   if (transport.isRecording) {
-    tft.fillCircle(transportX + 20, layout.bankY + 10, 6, COLOR_RED);
-    drawCenteredText("R", transportX + 17, layout.bankY + 5, 8, 12, COLOR_WHITE, FONT_SIZE_SMALL);
+    tft.fillCircle(widget.x + 26, centerY, 6, COLOR_RED);
+    drawCenteredText("R", widget.x + 23, centerY - 5, 8, 12, COLOR_WHITE, FONT_SIZE_SMALL);
   }
 }
 
-void DisplayManager::drawScreensaver(const MtcData& mtc, uint8_t currentBank) {
-  clearScreen(COLOR_BLACK);
-  drawMTCInfo(mtc);
+void DisplayManager::drawClockInfo(const ClockData& clock) {
+  Widget& widget = scene.globalWidget(WIDGET_CLOCK);
+  if (widget.dirty) {
+    clockText[0].valid = false;
+    clockText[1].valid = false;
+    widget.dirty = false;
+  }
   
-  char bankStr[8];
-  snprintf(bankStr, sizeof(bankStr), "Bank %d", currentBank + 1);
-  tft.setTextColor(COLOR_DARK_GRAY);
-  tft.setTextSize(FONT_SIZE_SMALL);
-  tft.setCursor(10, TFT_HEIGHT - 20);
-  tft.print(bankStr);
+  char tempo[TEXT_SLOT_CHARS];
+  if (clock.bpmX10) {
+    snprintf(tempo, sizeof(tempo), "%3u.%u BPM", clock.bpmX10 / 10, clock.bpmX10 % 10);
+  } else {
+    snprintf(tempo, sizeof(tempo), "--- BPM");
+  }
+  char position[TEXT_SLOT_CHARS];
+  snprintf(position, sizeof(position), "%u.%u.%u", clock.bar, clock.beat, clock.sixteenth);
+  
+  // La posición cambia cada semicorchea y el tempo casi nunca: cada línea por separado
+  uint16_t color = clock.running ? COLOR_GREEN : COLOR_WHITE;
+  uint16_t lineHeight = widget.h / 2;
+  drawTextField(clockText[0], tempo, widget.x, widget.y, widget.w, lineHeight,
+                color, COLOR_BLACK, FONT_SMOOTH_SMALL, false);
+  drawTextField(clockText[1], position, widget.x, widget.y + lineHeight, widget.w, lineHeight,
+                color, COLOR_BLACK, FONT_SMOOTH_SMALL, false);
 }
 
 void DisplayManager::drawBootScreen() {
   clearScreen(COLOR_BLACK);
   
-  drawCenteredText("MACKIE MIDI", TFT_WIDTH/2 - 100, TFT_HEIGHT/2 - 60, 
-                   200, 30, COLOR_CYAN, FONT_SIZE_LARGE);
-  drawCenteredText("CONTROLLER", TFT_WIDTH/2 - 100, TFT_HEIGHT/2 - 30, 
-                   200, 30, COLOR_CYAN, FONT_SIZE_LARGE);
+  drawTextBox("MACKIE MIDI", TFT_WIDTH/2 - 100, TFT_HEIGHT/2 - 60, 
+              200, 30, COLOR_CYAN, COLOR_BLACK, FONT_SMOOTH_LARGE);
+  drawTextBox("CONTROLLER", TFT_WIDTH/2 - 100, TFT_HEIGHT/2 - 30, 
+              200, 30, COLOR_CYAN, COLOR_BLACK, FONT_SMOOTH_LARGE);
   
   char version[20];
   snprintf(version, sizeof(version), "v%d.%d.%d", 
            FIRMWARE_VERSION_MAJOR, FIRMWARE_VERSION_MINOR, FIRMWARE_VERSION_PATCH);
-  drawCenteredText(version, TFT_WIDTH/2 - 50, TFT_HEIGHT/2 + 10, 
-                   100, 20, COLOR_WHITE, FONT_SIZE_MEDIUM);
+  drawTextBox(version, TFT_WIDTH/2 - 50, TFT_HEIGHT/2 + 10, 
+              100, 20, COLOR_WHITE, COLOR_BLACK, FONT_SMOOTH_MEDIUM);
   
   for (int i = 0; i <= 100; i += 10) {
     drawProgressBar(TFT_WIDTH/2 - 100, TFT_HEIGHT/2 + 40, 200, 8, i, COLOR_GREEN);
@@ -312,12 +769,12 @@ void DisplayManager::updateVUMeters() {
     unsigned long currentTime = millis();
     
     for (int i = 0; i < 8; i++) {
-        if (currentTime - lastVuUpdate[i] >= 100) {
+        if (currentTime - lastVuUpdate[i] >= VU_UPDATE_INTERVAL) {
             if (vuLevels[i] > 0) {
                 uint8_t decayedLevel = calculateVUDecay(vuLevels[i], currentTime - lastVuUpdate[i]);
                 if (decayedLevel != vuLevels[i]) {
                     vuLevels[i] = decayedLevel;
-                    markChannelDirty(i); // Marcar como sucio si cambió
+                    scene.invalidate(stripForEncoder(i), WIDGET_BIT(WIDGET_METER));
                     lastVuUpdate[i] = currentTime;
                 }
             }
@@ -328,7 +785,7 @@ void DisplayManager::updateVUMeters() {
 uint8_t DisplayManager::calculateVUDecay(uint8_t currentLevel, unsigned long timeSinceUpdate) {
     // Decaimiento más rápido para niveles altos, más lento para niveles bajos
     float decayRate = METER_DECAY_RATE * (1.0 + (currentLevel / 127.0) * 2.0);
-    uint8_t decayAmount = (timeSinceUpdate / 100) * decayRate;
+    uint8_t decayAmount = min(timeSinceUpdate * decayRate / 100, 255.0f);
     
     if (currentLevel <= decayAmount) {
         return 0;
@@ -340,10 +797,13 @@ uint8_t DisplayManager::calculateVUDecay(uint8_t currentLevel, unsigned long tim
 void DisplayManager::clearScreen(uint16_t color) {
   if (!initialized) return;
   tft.fillScreen(color);
+  invalidateDrawn();
 }
 
 void DisplayManager::drawCenteredText(const char* text, uint16_t x, uint16_t y, uint16_t w, uint16_t h, 
                                     uint16_t color, uint8_t size) {
+  // Sin fondo conocido no se puede suavizar: fuente de Adafruit_GFX equivalente
+  if (size & FONT_SMOOTH) size = (size & ~FONT_SMOOTH) + 1;
   tft.setTextSize(size);
   tft.setTextColor(color);
   
@@ -357,8 +817,218 @@ void DisplayManager::drawCenteredText(const char* text, uint16_t x, uint16_t y,
   tft.print(text);
 }
 
+void DisplayManager::drawTextBox(const char* text, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                                 uint16_t color, uint16_t bg, uint8_t size, bool centered) {
+  if (w == 0 || h == 0) return;
+  
+  if (size & FONT_SMOOTH) {
+    drawSmoothBox(text, x, y, w, h, color, bg, size & ~FONT_SMOOTH, centered);
+    return;
+  }
+  
+  if (!glyphs.isBuilt()) {
+    tft.fillRect(x, y, w, h, bg);
+    drawCenteredText(text, x, y, w, h, color, size);
+    return;
+  }
+  
+  unsigned long startTime = micros();
+  w = min(w, (uint16_t)TFT_WIDTH);
+  uint8_t length = min(strlen(text), (size_t)255);
+  uint16_t textW = min(GlyphAtlas::textWidth(length, size), w);
+  uint16_t textH = GlyphAtlas::textHeight(size);
+  uint16_t left = centered ? (w - textW) / 2 : 0;
+  uint16_t top = h > textH ? (h - textH) / 2 : 0;
+  
+  // Una ventana para todo el campo; las filas de fondo y las repetidas por
+  // la escala reutilizan el mismo buffer
+  for (uint16_t i = 0; i < w; i++) textRow[i] = bg;
+  
+  tft.startWrite();
+  tft.setAddrWindow(x, y, w, h);
+  
+  uint16_t row = 0;
+  for (; row < top; row++) tft.writePixels(textRow, w);
+  
+  for (uint8_t fontRow = 0; fontRow < GLYPH_HEIGHT && row < h; fontRow++) {
+    glyphs.renderRow(text, length, size, fontRow, color, bg, textRow + left, textW);
+    for (uint8_t s = 0; s < size && row < h; s++, row++) tft.writePixels(textRow, w);
+  }
+  
+  for (uint16_t i = left; i < left + textW; i++) textRow[i] = bg;
+  for (; row < h; row++) tft.writePixels(textRow, w);
+  
+  tft.endWrite();
+  
+  textSpansDrawn++;
+  textPixels += (uint32_t)w * h;
+  textMicros += micros() - startTime;
+}
+
+void DisplayManager::drawSmoothBox(const char* text, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                                   uint16_t color, uint16_t bg, uint8_t fontId, bool centered) {
+  unsigned long startTime = micros();
+  w = min(w, (uint16_t)TFT_WIDTH);
+  
+  smoothText.begin(text, fontId, w, h, centered, color, bg);
+  
+  tft.startWrite();
+  tft.setAddrWindow(x, y, w, h);
+  for (uint16_t row = 0; row < h; row++) {
+    smoothText.renderRow(row, textRow, w);
+    tft.writePixels(textRow, w);
+  }
+  tft.endWrite();
+  
+  smoothText.end();
+  
+  textSpansDrawn++;
+  textPixels += (uint32_t)w * h;
+  textMicros += micros() - startTime;
+}
+
+bool DisplayManager::drawTextField(TextSlot& slot, const char* text, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                                   uint16_t color, uint16_t bg, uint8_t size, bool centered) {
+  if (slot.valid && slot.color == color && slot.bg == bg &&
+      strncmp(slot.text, text, TEXT_SLOT_CHARS) == 0) {
+    textSpansSkipped++;
+    return false;
+  }
+  
+  strncpy(slot.text, text, TEXT_SLOT_CHARS - 1);
+  slot.text[TEXT_SLOT_CHARS - 1] = '\0';
+  slot.color = color;
+  slot.bg = bg;
+  slot.valid = true;
+  
+  drawTextBox(text, x, y, w, h, color, bg, size, centered);
+  return true;
+}
+
+// Sólo tras borrar la pantalla: lo dibujado ya no está y todos los campos,
+// barras y medidores se repintan enteros. El repaso periódico no la llama
+void DisplayManager::invalidateDrawn() {
+  for (uint8_t i = 0; i < SCENE_MAX_CHANNELS; i++) {
+    for (uint8_t f = 0; f < CHANNEL_TEXT_FIELDS; f++) channelText[i][f].valid = false;
+  }
+  memset(channelFlags, 0xFF, sizeof(channelFlags));
+  memset(stripCache, 0xFF, sizeof(stripCache));
+  mtcText.valid = false;
+  bankText.valid = false;
+  clockText[0].valid = false;
+  clockText[1].valid = false;
+  lastTransportFlags = 0xFF;
+}
+
+void DisplayManager::printTextStatistics() const {
+  Serial.print(F("Texto: campos ")); Serial.print(textSpansDrawn);
+  Serial.print(F(" | sin cambios ")); Serial.print(textSpansSkipped);
+  Serial.print(F(" | pixeles ")); Serial.print(textPixels);
+  Serial.print(F(" | glifos suavizados ")); Serial.print(smoothText.getGlyphsDecoded());
+  Serial.print(F(" | media "));
+  Serial.print(textSpansDrawn ? textMicros / textSpansDrawn : 0);
+  Serial.println(F(" us"));
+}
+
+// Llamar una vez por segundo
+void DisplayManager::updateFrameStatistics() {
+  unsigned long currentTime = millis();
+  unsigned long elapsed = currentTime - statsWindowStart;
+  if (elapsed == 0) return;
+  
+  for (uint8_t r = 0; r < REGION_COUNT; r++) {
+    regions[r].fps = regions[r].windowFlushes * 1000UL / elapsed;
+    regions[r].windowFlushes = 0;
+  }
+  statsWindowStart = currentTime;
+}
+
+// Campos de DIAG_SECTION_DISPLAY, en el orden que espera tools/diag_cli.py
+uint8_t DisplayManager::getFrameDiagnostics(uint32_t* fields) const {
+  uint8_t count = 0;
+  for (uint8_t r = 0; r < REGION_COUNT; r++) fields[count++] = regions[r].fps;
+  for (uint8_t r = 0; r < REGION_COUNT; r++) fields[count++] = regions[r].missed;
+  for (uint8_t r = 0; r < REGION_COUNT; r++) fields[count++] = regions[r].dropped;
+  fields[count++] = frameOverruns;
+  fields[count++] = tePeriodMicros;
+  fields[count++] = textSpansDrawn;
+  return count;
+}
+
+// Índice 1 de DIAG_SECTION_DISPLAY: ms en cada estado del panel (el actual
+// incluido), veces dormido y latencia de despertar hasta el primer frame
+uint8_t DisplayManager::getPowerDiagnostics(uint32_t* fields) const {
+  uint8_t count = 0;
+  for (uint8_t s = 0; s < PANEL_POWER_COUNT; s++) {
+    fields[count++] = powerResidency[s] + (s == powerState ? millis() - powerStateSince : 0);
+  }
+  fields[count++] = sleepCount;
+  fields[count++] = wakeCount;
+  fields[count++] = wakeLatencyLast;
+  fields[count++] = wakeLatencyMax;
+  fields[count++] = wakeCount ? wakeLatencyTotal / wakeCount : 0;
+  return count;
+}
+
+void DisplayManager::printFrameStatistics() const {
+  static const char* const names[REGION_COUNT] = { "Medidores", "Faders", "Texto" };
+  
+  Serial.println(F("\n=== PLANIFICADOR DE PANTALLA ==="));
+  for (uint8_t r = 0; r < REGION_COUNT; r++) {
+    const RegionSchedule& region = regions[r];
+    Serial.print(names[r]);
+    Serial.print(F(": ")); Serial.print(region.fps);
+    Serial.print(F(" fps (cada ")); Serial.print(region.periodMs);
+    Serial.print(F(" ms) | volcados ")); Serial.print(region.flushes);
+    Serial.print(F(" | perdidos ")); Serial.print(region.missed);
+    Serial.print(F(" | cedidos a MIDI ")); Serial.println(region.dropped);
+  }
+  Serial.print(F("Pasadas cortadas por presupuesto: ")); Serial.println(frameOverruns);
+  Serial.print(F("Widgets dibujados: ")); Serial.print(widgetsDrawn);
+  Serial.print(F(" (escena de ")); Serial.print(scene.getWidgetCount()); Serial.println(F(")"));
+  Serial.print(F("Barrido: "));
+  if (tePeriodMicros) {
+    Serial.print(F("TE cada ")); Serial.print(tePeriodMicros);
+    Serial.print(F(" us, flancos ")); Serial.println(teEdges);
+  } else {
+    Serial.print(F("supuesto de ")); Serial.print(DISPLAY_SCANOUT_US);
+    Serial.println(F(" us (sin TE)"));
+  }
+  
+  uint32_t power[8];
+  getPowerDiagnostics(power);
+  Serial.print(F("Panel: activo ")); Serial.print(power[PANEL_ACTIVE] / 1000);
+  Serial.print(F(" s | dormido ")); Serial.print(power[PANEL_SLEEP] / 1000);
+  Serial.print(F(" s (")); Serial.print(sleepCount);
+  Serial.print(F(" veces) | despertar ")); Serial.print(wakeCount ? wakeLatencyTotal / wakeCount : 0);
+  Serial.print(F(" us medio, ")); Serial.print(wakeLatencyMax);
+  Serial.println(F(" us max"));
+}
+
+void DisplayManager::resetFrameStatistics() {
+  for (uint8_t r = 0; r < REGION_COUNT; r++) {
+    regions[r].flushes = 0;
+    regions[r].missed = 0;
+    regions[r].dropped = 0;
+  }
+  frameOverruns = 0;
+  widgetsDrawn = 0;
+  memset(powerResidency, 0, sizeof(powerResidency));
+  powerStateSince = millis();
+  sleepCount = 0;
+  wakeCount = 0;
+  wakeLatencyLast = 0;
+  wakeLatencyMax = 0;
+  wakeLatencyTotal = 0;
+  textSpansDrawn = 0;
+  textSpansSkipped = 0;
+  textPixels = 0;
+  textMicros = 0;
+}
+
 void DisplayManager::drawRightAlignedText(const char* text, uint16_t x, uint16_t y, 
                                         uint16_t color, uint8_t size) {
+  if (size & FONT_SMOOTH) size = (size & ~FONT_SMOOTH) + 1;
   tft.setTextSize(size);
   tft.setTextColor(color);
   
@@ -379,11 +1049,13 @@ void DisplayManager::drawProgressBar(uint16_t x, uint16_t y, uint16_t w, uint16_
 }
 
 uint16_t DisplayManager::getTextWidth(const char* text, uint8_t size) {
-  return strlen(text) * 6 * size;
+  if (size & FONT_SMOOTH) return SmoothText::textWidth(text, size & ~FONT_SMOOTH);
+  return GlyphAtlas::textWidth(strlen(text), size);
 }
 
 uint16_t DisplayManager::getTextHeight(uint8_t size) {
-  return 8 * size;
+  if (size & FONT_SMOOTH) return SmoothText::lineHeight(size & ~FONT_SMOOTH);
+  return GlyphAtlas::textHeight(size);
 }
 
 void DisplayManager::setVULevel(uint8_t channel, uint8_t level) {
@@ -393,13 +1065,8 @@ void DisplayManager::setVULevel(uint8_t channel, uint8_t level) {
         vuLevels[channel] = filteredLevel;
         lastVuUpdate[channel] = millis();
         
-        // Marcar este canal como sucio para redibujar
-        markChannelDirty(channel);
-        
-        // Si el nivel es significativo, forzar una actualización más rápida
-        if (level > 10) {
-            lastFullRedraw = millis() - 4000; // Forzar redibujado más pronto
-        }
+        // Solo el medidor: la región de medidores tiene su propio ritmo
+        scene.invalidate(stripForEncoder(channel), WIDGET_BIT(WIDGET_METER));
     }
 }
 
@@ -429,8 +1096,8 @@ void DisplayManager::drawMessage(const char* message) {
   tft.drawRect(msgX, msgY, msgWidth, msgHeight, COLOR_WHITE);
   
   if (message) {
-    drawCenteredText(message, msgX + 10, msgY + 10, msgWidth - 20, msgHeight - 20, 
-                     COLOR_WHITE, FONT_SIZE_MEDIUM);
+    drawTextBox(message, msgX + 10, msgY + 10, msgWidth - 20, msgHeight - 20, 
+                COLOR_WHITE, COLOR_DARK_GRAY, FONT_SMOOTH_MEDIUM);
   }
 }
 
@@ -444,29 +1111,34 @@ void DisplayManager::drawConfirmDialog(const char* message) {
   tft.drawRect(dlgX, dlgY, dlgWidth, dlgHeight, COLOR_WHITE);
   
   if (message) {
-    drawCenteredText(message, dlgX + 10, dlgY + 10, dlgWidth - 20, 40, 
-                     COLOR_WHITE, FONT_SIZE_MEDIUM);
+    drawTextBox(message, dlgX + 10, dlgY + 10, dlgWidth - 20, 40, 
+                COLOR_WHITE, COLOR_DARK_GRAY, FONT_SMOOTH_MEDIUM);
   }
   
-  drawCenteredText("Presiona para confirmar", dlgX + 10, dlgY + 60, dlgWidth - 20, 20, 
-                   COLOR_YELLOW, FONT_SIZE_SMALL);
-  drawCenteredText("Volver para cancelar", dlgX + 10, dlgY + 80, dlgWidth - 20, 20, 
-                   COLOR_LIGHT_GRAY, FONT_SIZE_SMALL);
+  drawTextBox("Presiona para confirmar", dlgX + 10, dlgY + 60, dlgWidth - 20, 20, 
+              COLOR_YELLOW, COLOR_DARK_GRAY, FONT_SMOOTH_SMALL);
+  drawTextBox("Volver para cancelar", dlgX + 10, dlgY + 80, dlgWidth - 20, 20, 
+              COLOR_LIGHT_GRAY, COLOR_DARK_GRAY, FONT_SMOOTH_SMALL);
 }
 
 void DisplayManager::runDisplayTest() {
   Serial.println(F("Ejecutando test de pantalla..."));
   
+  // Cada fase dibuja con el bus tomado y lo suelta durante la pausa, para
+  // que el volcado del registro a la SD no espere segundos
   const uint16_t testColors[] = {COLOR_RED, COLOR_GREEN, COLOR_BLUE, COLOR_WHITE, 
                                 COLOR_YELLOW, COLOR_CYAN, COLOR_MAGENTA};
   const char* colorNames[] = {"ROJO", "VERDE", "AZUL", "BLANCO", 
                              "AMARILLO", "CIAN", "MAGENTA"};
   
   for (int i = 0; i < 7; i++) {
-    clearScreen(testColors[i]);
-    
-    uint16_t textColor = (testColors[i] == COLOR_WHITE) ? COLOR_BLACK : COLOR_WHITE;
-    drawCenteredText(colorNames[i], 0, TFT_HEIGHT/2 - 20, TFT_WIDTH, 40, textColor, FONT_SIZE_LARGE);
+    {
+      SpiBusLock busLock(SPI_DEVICE_TFT);
+      clearScreen(testColors[i]);
+      
+      uint16_t textColor = (testColors[i] == COLOR_WHITE) ? COLOR_BLACK : COLOR_WHITE;
+      drawCenteredText(colorNames[i], 0, TFT_HEIGHT/2 - 20, TFT_WIDTH, 40, textColor, FONT_SIZE_LARGE);
+    }
     
     unsigned long startTime = millis();
     while (millis() - startTime < 800) {
@@ -474,24 +1146,27 @@ void DisplayManager::runDisplayTest() {
     }
   }
   
-  clearScreen(COLOR_BLACK);
-  drawCenteredText("TEST GEOMETRIA", 0, 20, TFT_WIDTH, 30, COLOR_WHITE, FONT_SIZE_MEDIUM);
-  
-  for (int i = 0; i < 5; i++) {
-    uint16_t color = STUDIO_ONE_COLORS[(i) % NUM_COLORS];
-    tft.drawRect(50 + i * 15, 80, 60, 40, color);
-    tft.fillRect(50 + i * 15 + 5, 85, 50, 30, color);
-  }
-  
-  for (int i = 0; i < 8; i++) {
-    uint16_t color = STUDIO_ONE_COLORS[(i + 8) % NUM_COLORS];
-    tft.drawCircle(60 + i * 45, 180, 20, color);
-    tft.fillCircle(60 + i * 45, 180, 15, color);
-  }
-  
-  for (int i = 0; i < 10; i++) {
-    uint16_t color = STUDIO_ONE_COLORS[(i + 16) % NUM_COLORS];
-    tft.drawLine(0, 220 + i * 8, TFT_WIDTH, 220 + i * 8, color);
+  {
+    SpiBusLock busLock(SPI_DEVICE_TFT);
+    clearScreen(COLOR_BLACK);
+    drawCenteredText("TEST GEOMETRIA", 0, 20, TFT_WIDTH, 30, COLOR_WHITE, FONT_SIZE_MEDIUM);
+    
+    for (int i = 0; i < 5; i++) {
+      uint16_t color = STUDIO_ONE_COLORS[(i) % NUM_COLORS];
+      tft.drawRect(50 + i * 15, 80, 60, 40, color);
+      tft.fillRect(50 + i * 15 + 5, 85, 50, 30, color);
+    }
+    
+    for (int i = 0; i < 8; i++) {
+      uint16_t color = STUDIO_ONE_COLORS[(i + 8) % NUM_COLORS];
+      tft.drawCircle(60 + i * 45, 180, 20, color);
+      tft.fillCircle(60 + i * 45, 180, 15, color);
+    }
+    
+    for (int i = 0; i < 10; i++) {
+      uint16_t color = STUDIO_ONE_COLORS[(i + 16) % NUM_COLORS];
+      tft.drawLine(0, 220 + i * 8, TFT_WIDTH, 220 + i * 8, color);
+    }
   }
   
   unsigned long startTime = millis();
@@ -499,15 +1174,18 @@ void DisplayManager::runDisplayTest() {
     // Espera no bloqueante
   }
   
-  clearScreen(COLOR_BLACK);
-  const char* testText[] = {"Font Size 1", "Font Size 2", "Font Size 3", "Font Size 4"};
-  
-  for (int i = 0; i < 4; i++) {
-    uint16_t color = STUDIO_ONE_COLORS[(i * 4) % NUM_COLORS];
-    tft.setTextColor(color);
-    tft.setTextSize(i + 1);
-    tft.setCursor(10, 20 + i * 40);
-    tft.print(testText[i]);
+  {
+    SpiBusLock busLock(SPI_DEVICE_TFT);
+    clearScreen(COLOR_BLACK);
+    const char* testText[] = {"Font Size 1", "Font Size 2", "Font Size 3", "Font Size 4"};
+    
+    for (int i = 0; i < 4; i++) {
+      uint16_t color = STUDIO_ONE_COLORS[(i * 4) % NUM_COLORS];
+      tft.setTextColor(color);
+      tft.setTextSize(i + 1);
+      tft.setCursor(10, 20 + i * 40);
+      tft.print(testText[i]);
+    }
   }
   
   startTime = millis();
@@ -515,44 +1193,48 @@ void DisplayManager::runDisplayTest() {
     // Espera no bloqueante
   }
   
+  SpiBusLock busLock(SPI_DEVICE_TFT);
   clearScreen(COLOR_BLACK);
   Serial.println(F("Test de pantalla completado"));
 }
 
 void DisplayManager::showDiagnostics() {
-  clearScreen(COLOR_BLACK);
-  
-  tft.setTextColor(COLOR_WHITE);
-  tft.setTextSize(FONT_SIZE_MEDIUM);
-  
-  tft.setCursor(10, 20);
-  tft.print("DIAGNOSTICOS PANTALLA");
-  
-  tft.setCursor(10, 50);
-  tft.print("Resolucion: ");
-  tft.print(TFT_WIDTH);
-  tft.print("x");
-  tft.print(TFT_HEIGHT);
-  
-  tft.setCursor(10, 80);
-  tft.print("Brillo: ");
-  tft.print(currentBrightness);
-  tft.print("%");
-  
-  tft.setCursor(10, 110);
-  tft.print("Orientacion: ");
-  tft.print((int)currentOrientation);
-  
-  tft.setCursor(10, 140);
-  tft.print("Inicializada: ");
-  tft.print(initialized ? "Si" : "No");
+  {
+    SpiBusLock busLock(SPI_DEVICE_TFT);
+    clearScreen(COLOR_BLACK);
   
-  tft.setCursor(10, 180);
-  tft.print("Test Brillo:");
-  for (int i = 0; i < 10; i++) {
-    uint8_t gray = map(i, 0, 9, 0, 255);
-    uint16_t grayColor = ((gray & 0xF8) << 8) | ((gray & 0xFC) << 3) | (gray >> 3);
-    tft.fillRect(10 + i * 40, 200, 35, 20, grayColor);
+    tft.setTextColor(COLOR_WHITE);
+    tft.setTextSize(FONT_SIZE_MEDIUM);
+  
+    tft.setCursor(10, 20);
+    tft.print("DIAGNOSTICOS PANTALLA");
+  
+    tft.setCursor(10, 50);
+    tft.print("Resolucion: ");
+    tft.print(TFT_WIDTH);
+    tft.print("x");
+    tft.print(TFT_HEIGHT);
+  
+    tft.setCursor(10, 80);
+    tft.print("Brillo: ");
+    tft.print(currentBrightness);
+    tft.print("%");
+  
+    tft.setCursor(10, 110);
+    tft.print("Orientacion: ");
+    tft.print((int)currentOrientation);
+  
+    tft.setCursor(10, 140);
+    tft.print("Inicializada: ");
+    tft.print(initialized ? "Si" : "No");
+  
+    tft.setCursor(10, 180);
+    tft.print("Test Brillo:");
+    for (int i = 0; i < 10; i++) {
+      uint8_t gray = map(i, 0, 9, 0, 255);
+      uint16_t grayColor = ((gray & 0xF8) << 8) | ((gray & 0xFC) << 3) | (gray >> 3);
+      tft.fillRect(10 + i * 40, 200, 35, 20, grayColor);
+    }
   }
   
   unsigned long startTime = millis();
@@ -576,15 +1258,10 @@ void DisplayManager::drawMenuItem(const char* text, uint16_t y, bool selected, b
   }
   
   uint16_t textColor = editing ? COLOR_YELLOW : COLOR_WHITE;
-  tft.setTextColor(textColor);
-  tft.setTextSize(FONT_SIZE_MEDIUM);
-  tft.setCursor(20, y);
-  tft.print(buffer);
+  drawTextBox(buffer, 20, y - 4, TFT_WIDTH - 40, 23, textColor, bgColor, FONT_SMOOTH_MEDIUM, false);
   
   if (selected) {
-    tft.setCursor(5, y);
-    tft.setTextColor(COLOR_WHITE);
-    tft.print("▶");
+    drawTextBox("»", 5, y - 4, 10, 23, COLOR_WHITE, bgColor, FONT_SMOOTH_MEDIUM);
   }
 }
 
@@ -594,19 +1271,15 @@ void DisplayManager::drawMenuValue(const char* value, uint16_t x, uint16_t y, bo
   buffer[sizeof(buffer) - 1] = '\0';
   
   uint16_t color = editing ? COLOR_YELLOW : COLOR_CYAN;
-  tft.setTextColor(color);
-  tft.setTextSize(FONT_SIZE_MEDIUM);
-  
-  uint16_t textW = getTextWidth(buffer, FONT_SIZE_MEDIUM);
+  uint16_t textW = getTextWidth(buffer, FONT_SMOOTH_MEDIUM);
   uint16_t drawX = x - textW;
   
-  fillRect(drawX - 5, y - 5, textW + 10, 25, COLOR_BLACK);
-  tft.setCursor(drawX, y);
-  tft.print(buffer);
+  drawTextBox(buffer, drawX - 5, y - 5, textW + 10, 25, color, COLOR_BLACK, FONT_SMOOTH_MEDIUM);
 }
 
 void DisplayManager::benchmarkDisplay() {
   Serial.println(F("Ejecutando benchmark de pantalla..."));
+  SpiBusLock busLock(SPI_DEVICE_TFT);
   
   unsigned long startTime, endTime;
   uint32_t operations;
@@ -651,20 +1324,66 @@ void DisplayManager::benchmarkDisplay() {
   Serial.print(F("Lineas por segundo: "));
   Serial.println(operations);
   
+  // Texto del MTC: fuente de Adafruit_GFX (rectángulo por píxel) frente al atlas
+  clearScreen(COLOR_BLACK);
+  startTime = micros();
+  for (int i = 0; i < 100; i++) {
+    tft.fillRect(10, 10, scene.globalWidget(WIDGET_TIMECODE).w, 26, COLOR_DARK_GRAY);
+    tft.setTextColor(COLOR_WHITE);
+    tft.setTextSize(FONT_SIZE_LARGE);
+    tft.setCursor(15, 11);
+    tft.print("00:00:00:00");
+  }
+  endTime = micros();
+  Serial.print(F("Texto GFX (us): "));
+  Serial.println((endTime - startTime) / 100);
+  
+  startTime = micros();
+  for (int i = 0; i < 100; i++) {
+    drawTextBox("00:00:00:00", 10, 10, scene.globalWidget(WIDGET_TIMECODE).w, 26, COLOR_WHITE, COLOR_DARK_GRAY, FONT_SIZE_LARGE);
+  }
+  endTime = micros();
+  Serial.print(F("Texto atlas (us): "));
+  Serial.println((endTime - startTime) / 100);
+  
+  startTime = micros();
+  for (int i = 0; i < 100; i++) {
+    drawTextBox("00:00:00:00", 10, 10, scene.globalWidget(WIDGET_TIMECODE).w, 26, COLOR_WHITE, COLOR_DARK_GRAY, FONT_SMOOTH_LARGE);
+  }
+  endTime = micros();
+  Serial.print(F("Texto suavizado (us): "));
+  Serial.println((endTime - startTime) / 100);
+  printTextStatistics();
+  
   clearScreen(COLOR_BLACK);
   Serial.println(F("Benchmark completado"));
 }
 
+// Encoders 0-7 (volumen) y 8-15 (pan) comparten columna en pantalla; cada uno
+// invalida solo los widgets que lo muestran
 void DisplayManager::markChannelDirty(uint8_t channel) {
-    if (channel < 8) channelDirty[channel] = true;
+    if (channel >= NUM_ENCODERS) return;
+    
+    // En la vista de 8 la etiqueta solo lleva el valor del volumen
+    uint8_t mask = channel < 8 ? WIDGET_BIT(WIDGET_FADER) : WIDGET_BIT(WIDGET_PAN);
+    if (channel < 8 || mixerView != VIEW_STRIPS_8) mask |= WIDGET_BIT(WIDGET_LABEL);
+    scene.invalidate(stripForEncoder(channel), mask);
+}
+
+void DisplayManager::invalidateWidgets(uint8_t encoder, uint8_t typeMask) {
+    if (encoder < NUM_ENCODERS) scene.invalidate(stripForEncoder(encoder), typeMask);
+}
+
+void DisplayManager::markAllChannelsDirty() {
+    scene.invalidateAll();
 }
 
 void DisplayManager::markTransportDirty() {
-    transportDirty = true;
+    scene.invalidateGlobal(WIDGET_TRANSPORT);
 }
 
 void DisplayManager::markMtcDirty() {
-    mtcDirty = true;
+    scene.invalidateGlobal(WIDGET_TIMECODE);
 }
 /*void DisplayManager::updateFromMidi(const EncoderConfig encoders[NUM_ENCODERS]) {
     // Esta función debería ser llamada cuando se reciben actualizaciones MIDI
@@ -2,16 +2,13 @@
 #define DISPLAY_MANAGER_H
 
 #include "Config.h"
+#include "GlyphAtlas.h"
+#include "SmoothFont.h"
+#include "MixerScene.h"
 #include <Adafruit_ST7796S.h>
 #include <Adafruit_GFX.h>
 #include <SPI.h>
 
-#define VOLUME_BAR_WIDTH    20
-#define VOLUME_BAR_HEIGHT   120
-#define PAN_BAR_WIDTH       15
-#define PAN_BAR_HEIGHT      50
-#define CHANNEL_WIDTH       55
-#define HEADER_HEIGHT       40
 #define FOOTER_HEIGHT       30
 #define METER_DECAY_RATE    2
 
@@ -20,6 +17,65 @@
 #define FONT_SIZE_LARGE     3
 #define FONT_SIZE_XLARGE    4
 
+// Fuentes suavizadas: FONT_SMOOTH más el índice de SmoothFont. Donde solo hay
+// fuente de Adafruit_GFX se usa el tamaño equivalente (índice + 1)
+#define FONT_SMOOTH         0x10
+#define FONT_SMOOTH_SMALL   (FONT_SMOOTH | SMOOTH_FONT_SMALL)
+#define FONT_SMOOTH_MEDIUM  (FONT_SMOOTH | SMOOTH_FONT_MEDIUM)
+#define FONT_SMOOTH_LARGE   (FONT_SMOOTH | SMOOTH_FONT_LARGE)
+
+#define TEXT_SLOT_CHARS     16   // Texto más largo de un campo cacheado (15 + '\0')
+#define CHANNEL_TEXT_FIELDS 4    // Número, valor, nombre y pan (vista de un canal)
+#define STRIP_UNDRAWN       0xFFFF
+
+// Regiones de la pantalla principal, de más a menos frecuentes. Los medidores
+// se vuelcan cada DISPLAY_PARTIAL_UPDATE y el texto cada DISPLAY_UPDATE_INTERVAL;
+// con MIDI ocupado se aplazan primero el texto y luego los faders
+enum DisplayRegion {
+  REGION_METERS = 0,   // VU
+  REGION_FADERS,       // Barras de volumen y pan
+  REGION_LABELS,       // Texto de canal, MTC, banco, transporte y reloj
+  REGION_COUNT
+};
+
+struct RegionSchedule {
+  uint16_t periodMs;
+  unsigned long lastFlush;
+  uint32_t flushes;
+  uint32_t missed;          // Volcados con más de un periodo de retraso sin ceder a MIDI
+  uint32_t dropped;         // Frames cedidos a MIDI
+  uint32_t windowFlushes;   // Para los frames por segundo
+  uint16_t fps;
+  bool deferred;            // Esperando a que MIDI quede libre
+};
+
+// Estado del panel. Dormida la ST7796S conserva su RAM: al despertar la
+// pantalla sigue como estaba y solo se vuelca lo que cambió mientras tanto
+enum PanelPower {
+  PANEL_ACTIVE = 0,
+  PANEL_SLEEP,          // DISPOFF + SLPIN y retroiluminación apagada
+  PANEL_WAKING,         // Esperando los plazos de SLPOUT antes de DISPON
+  PANEL_POWER_COUNT
+};
+
+// Lo último volcado en cada tira: las barras y el medidor repintan solo la
+// diferencia con lo que ya hay en pantalla
+struct StripCache {
+  uint16_t faderFill;       // Alto de la barra (STRIP_UNDRAWN = marco sin dibujar)
+  uint16_t faderColor;
+  uint16_t panY;            // Fila del marcador de pan
+  uint16_t panColor;
+  uint16_t meterFill;
+};
+
+// Último texto volcado en un campo de pantalla: si no cambia, no se repinta
+struct TextSlot {
+  char text[TEXT_SLOT_CHARS];
+  uint16_t color;
+  uint16_t bg;
+  bool valid;
+};
+
 class DisplayManager {
 private:
   Adafruit_ST7796S tft;
@@ -29,30 +85,75 @@ private:
   
   uint8_t vuLevels[8];
   unsigned long lastVuUpdate[8];
-  bool channelDirty[8];
-    bool transportDirty;
-    bool mtcDirty;
+  // Disposición de la pantalla principal y widgets pendientes de dibujar
+  MixerScene scene;
+  MixerView mixerView;
+  uint8_t focusChannel;         // Pista 0-7 de la vista de un canal
+  StripCache stripCache[SCENE_MAX_CHANNELS];
+  uint32_t widgetsDrawn;
+  RegionSchedule regions[REGION_COUNT];
+  bool midiBusy;
+  uint32_t frameOverruns;       // Pasadas cortadas por DISPLAY_FRAME_BUDGET_US
+  unsigned long scanEpoch;      // Origen del barrido supuesto (sin TE)
+  unsigned long statsWindowStart;
+  
+  // Campos de texto compuestos con el atlas; se repintan solo si cambian
+  GlyphAtlas glyphs;
+  SmoothText smoothText;
+  uint16_t textRow[TFT_WIDTH];
+  TextSlot channelText[SCENE_MAX_CHANNELS][CHANNEL_TEXT_FIELDS];
+  uint8_t channelFlags[SCENE_MAX_CHANNELS];   // Mute/solo dibujados (0xFF = sin dibujar)
+  TextSlot mtcText;
+  TextSlot bankText;
+  TextSlot clockText[2];        // Tempo y posición
+  uint8_t lastTransportFlags;
+  
+  // Estadísticas de texto
+  uint32_t textSpansDrawn;
+  uint32_t textSpansSkipped;
+  uint32_t textPixels;
+  uint32_t textMicros;
 
   bool needsFullRedraw;
   unsigned long lastFullRedraw;
   
-  struct LayoutPositions {
-    uint16_t channelX[8];
-    uint16_t volumeBarY;
-    uint16_t panBarY;
-    uint16_t textY;
-    uint16_t headerY;
-    uint16_t mtcX, mtcY;
-    uint16_t bankX, bankY;
-  } layout;
+  // Reposo del panel y sus estadísticas
+  PanelPower powerState;
+  unsigned long powerStateSince;        // millis() del último cambio de estado
+  unsigned long powerCommandMicros;     // Último SLPIN o SLPOUT
+  bool sleepOutSent;
+  uint32_t powerResidency[PANEL_POWER_COUNT];   // ms acumulados en cada estado
+  uint32_t sleepCount;
+  unsigned long wakeStart;              // micros() de la petición, 0 = ninguna
+  uint32_t wakeLatencyLast;
+  uint32_t wakeLatencyMax;
+  uint32_t wakeLatencyTotal;
+  uint32_t wakeCount;
   
   void calculateLayout();
-  void drawVolumeBar(uint8_t channel, uint8_t value, uint16_t color, bool highlighted);
-  void drawPanBar(uint8_t channel, uint8_t value, uint16_t color);
-  void drawVUMeter(uint8_t channel, uint8_t level, uint16_t color);
-  void drawChannelInfo(uint8_t channel, const EncoderConfig& config);
+  void drawVolumeBar(const Widget& widget, uint8_t value, uint16_t color, bool highlighted);
+  void drawPanBar(const Widget& widget, uint8_t value, uint16_t color);
+  void drawVUMeter(const Widget& widget, uint8_t level);
+  void drawChannelInfo(const Widget& widget, const EncoderConfig& config, const EncoderBankState& state,
+                       uint8_t encoder);
+  void drawChannelDetail(const Widget& widget, const EncoderConfig& config, const EncoderBankState& state,
+                         uint8_t track);
   void drawHeader();
   void drawFooter(const TransportState& transport);
+  void drawSmoothBox(const char* text, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                     uint16_t color, uint16_t bg, uint8_t fontId, bool centered);
+  bool drawTextField(TextSlot& slot, const char* text, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                     uint16_t color, uint16_t bg, uint8_t size, bool centered = true);
+  void invalidateDrawn();
+  uint8_t stripForEncoder(uint8_t encoder) const;
+  uint8_t stripEncoder(uint8_t strip) const;
+  
+  void setupTearingEffect();
+  void setPowerState(PanelPower state);
+  uint16_t scanLine(unsigned long nowMicros) const;
+  void scanOrder(uint8_t order[SCENE_MAX_CHANNELS]) const;
+  uint8_t dueRegions(unsigned long currentTime);
+  void completeRegion(uint8_t region, unsigned long currentTime);
   
   void updateVUMeters();
   uint8_t calculateVUDecay(uint8_t currentLevel, unsigned long timeSinceUpdate);
@@ -66,13 +167,27 @@ public:
   
   bool initialize(DisplayOrientation orientation = ORIENT_270, uint8_t brightness = 100);
   void setOrientation(DisplayOrientation orientation);
+  void setMixerView(MixerView view);
+  MixerView getMixerView() const { return mixerView; }
+  // Encoder tocado en local: en la vista de un canal pasa a mostrar su pista
+  void setFocusChannel(uint8_t encoder);
   void setBrightness(uint8_t brightness);
   uint8_t getBrightness() const { return currentBrightness; }
   
-  void drawMainScreen(const EncoderConfig encoders[NUM_ENCODERS], 
+  // Salvapantallas: el panel duerme y no se dibuja ni se usa el bus hasta
+  // wake(). sleep() devuelve false si el panel aún no admite SLPIN
+  bool sleep();
+  void wake();
+  // Avanza el despertar según los plazos del panel; llamar en cada pasada
+  void updatePower();
+  bool isAwake() const { return powerState == PANEL_ACTIVE; }
+  // Primer frame tras despertar: cierra la medida de latencia
+  void frameShown();
+  
+  // true cuando el frame queda completo (nada pendiente en ninguna región)
+  bool drawMainScreen(const EncoderBankState& state, const EncoderConfig configs[NUM_ENCODERS], 
                      const MtcData& mtc, uint8_t currentBank, 
-                     const TransportState& transport);
-  void drawScreensaver(const MtcData& mtc, uint8_t currentBank);
+                     const TransportState& transport, const ClockData& clock);
   void drawBootScreen();
   void drawErrorScreen(const char* error);
   
@@ -80,6 +195,9 @@ public:
                        uint16_t color, uint8_t size = FONT_SIZE_MEDIUM);
   void drawRightAlignedText(const char* text, uint16_t x, uint16_t y, 
                            uint16_t color, uint8_t size = FONT_SIZE_MEDIUM);
+  // Texto sobre fondo liso: se compone en RGB565 y se vuelca en una sola ventana
+  void drawTextBox(const char* text, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                   uint16_t color, uint16_t bg, uint8_t size = FONT_SIZE_MEDIUM, bool centered = true);
   uint16_t getTextWidth(const char* text, uint8_t size = FONT_SIZE_MEDIUM);
   uint16_t getTextHeight(uint8_t size = FONT_SIZE_MEDIUM);
   
@@ -98,6 +216,7 @@ public:
   
   void drawMTCInfo(const MtcData& mtc);
   void drawTransportInfo(const TransportState& transport, uint8_t currentBank);
+  void drawClockInfo(const ClockData& clock);
   void drawMessage(const char* message);
   void drawConfirmDialog(const char* message);
   
@@ -107,18 +226,29 @@ public:
   void runDisplayTest();
   void showDiagnostics();
   void benchmarkDisplay();
+  void printTextStatistics() const;
   void setForceRedraw(bool force) { needsFullRedraw = force; lastFullRedraw = 0; }
+  // Encoders 0-7: fader y etiquetas; 8-15: pan (y su etiqueta si la vista la muestra)
   void markChannelDirty(uint8_t channel);
+  // Solo los widgets de typeMask (WIDGET_BIT) de la tira que muestra el encoder
+  void invalidateWidgets(uint8_t encoder, uint8_t typeMask);
+  void markAllChannelsDirty();
+  // Ráfaga MIDI en curso: la pantalla aplaza lo que pueda esperar
+  void setMidiBusy(bool busy) { midiBusy = busy; }
+  void updateFrameStatistics();
+  uint8_t getFrameDiagnostics(uint32_t* fields) const;
+  uint8_t getPowerDiagnostics(uint32_t* fields) const;
+  void printFrameStatistics() const;
+  void resetFrameStatistics();
     void markTransportDirty();
     void markMtcDirty();
 
 
-  uint16_t getWidth() const { return TFT_WIDTH; }
-  uint16_t getHeight() const { return TFT_HEIGHT; }
+  uint16_t getWidth() const { return scene.getWidth(); }
+  uint16_t getHeight() const { return scene.getHeight(); }
   DisplayOrientation getOrientation() const { return currentOrientation; }
   
 private:
-  //bool channelDirty[8]; // Añade este miembro privado
 
   void initializePins();
   bool testDisplayConnection();
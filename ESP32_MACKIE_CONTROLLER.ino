@@ -11,6 +11,11 @@
 #include "EncoderManager.h"
 #include "MenuManager.h"
 #include "FileManager.h"
+#include "PresetCacheManager.h"
+#include "LogManager.h"
+#include "SpiBusManager.h"
+#include "BankSyncManager.h"
+#include "FeedbackManager.h"
 
 // Instancias globales de los managers
 SystemManager systemManager;
@@ -20,6 +25,11 @@ MidiManager midiManager;
 EncoderManager encoderManager;
 MenuManager menuManager;
 FileManager fileManager;
+PresetCacheManager presetCacheManager;
+LogManager logManager;
+SpiBusManager spiBusManager;
+BankSyncManager bankSyncManager;
+FeedbackManager feedbackManager;
 
 // Variables globales
 AppConfig appConfig;
@@ -27,8 +37,8 @@ SystemState systemState;
 volatile InterruptFlags interruptFlags;
 
 // ==================== CALLBACKS DEL SISTEMA ====================
-void onEncoderChange(uint8_t encoderIndex, int8_t change) {
-  encoderManager.processEncoderChange(encoderIndex, change, systemState.currentBank);
+void onEncoderChange(uint8_t encoderIndex, int8_t change, uint32_t eventTime) {
+  encoderManager.processEncoderChange(encoderIndex, change, systemState.currentBank, eventTime);
   resetActivity();
 }
 
@@ -69,8 +79,9 @@ void onNavigationButtonPress() {
 
 void onMenuExit() {
   systemState.inMenu = false;
+  displayManager.forceFullRedraw();
   if (appConfig.autoSave) {
-    fileManager.saveConfiguration(appConfig, encoderManager.getEncoderBanks());
+    fileManager.saveConfiguration(appConfig, encoderManager);
   }
 }
 
@@ -78,28 +89,30 @@ void resetActivity() {
   systemState.lastActivityTime = millis();
   if (systemState.screensaverActive) {
     systemState.screensaverActive = false;
-    displayManager.setBrightness(appConfig.brightness);
+    displayManager.wake();
   }
 }
 
 void changeBankSafely(int8_t direction) {
-  uint8_t newBank = (systemState.currentBank + direction + NUM_BANKS) % NUM_BANKS;
+  uint8_t bankCount = encoderManager.getBankCount();
+  uint8_t newBank = (systemState.currentBank + direction + bankCount) % bankCount;
   if (newBank != systemState.currentBank) {
+    systemState.bankSwitchStart = micros();
     systemState.currentBank = newBank;
     appConfig.currentBank = newBank;
     encoderManager.setCurrentBank(newBank);
+    systemState.displayNeedsUpdate = true;
     
-    // Solicitar actualización de valores al DAW
-    for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
-      midiManager.sendStudioOneValueRequest(i, newBank);
-      midiManager.sendStudioOneColorRequest(i, newBank);
-    }
+    // La pantalla muestra ya la caché del banco; el refresco desde el DAW
+    // corre en segundo plano. Los colores solo se piden la primera vez.
+    bankSyncManager.startBankSwitch(newBank, !encoderManager.isBankPopulated(newBank));
   }
 }
 
 // ==================== CALLBACKS DE STUDIO ONE ====================
 void syncEncoderColorFromDAW(uint8_t track, uint8_t bank, uint16_t color) {
    encoderManager.updateFromDAW(track, bank, color);
+   bankSyncManager.onColorReceived(track, bank);
 }
 
 void updateVUMeterLevel(uint8_t track, uint8_t level) {
@@ -108,11 +121,14 @@ void updateVUMeterLevel(uint8_t track, uint8_t level) {
 
 void syncEncoderValueFromDAW(uint8_t track, uint8_t bank, uint8_t value) {
     encoderManager.updateFromDAW(track, bank, value);
+    bankSyncManager.onValueReceived(track, bank);
 }
 
 // Función combinada para valor y color (si se reciben juntos)
 void syncEncoderFromDAW(uint8_t track, uint8_t bank, uint8_t value, uint16_t color) {
     encoderManager.updateFromDAW(track, bank, value, color);
+    bankSyncManager.onValueReceived(track, bank);
+    bankSyncManager.onColorReceived(track, bank);
 }
 
 
@@ -120,15 +136,32 @@ void syncEncoderNameFromDAW(uint8_t track, uint8_t bank, const char* name) {
     encoderManager.syncNameFromDAW(track, bank, name);
 }
 
+// Estado de banco en bloque: 16 pistas en un solo mensaje
+void syncBankStateFromDAW(const BankStateMessage& state) {
+    encoderManager.applyBankState(state);
+    bankSyncManager.onBankStateReceived(state.bank, state.sections, state.trackMask);
+    
+    // Con secuencia, el estado hace de fotograma clave para los deltas
+    if (state.sections & BANK_STATE_SEQ) {
+        feedbackManager.onKeyframe(state.bank, state.seq);
+    }
+}
+
+void syncValueDeltaFromDAW(const ValueDeltaMessage& delta) {
+    feedbackManager.onDelta(delta);
+}
+
 // ==================== ISRs ====================
-void handleMCP1AInterrupt() { interruptFlags.mcp1A = true; }
-void handleMCP1BInterrupt() { interruptFlags.mcp1B = true; }
-void handleMCP2AInterrupt() { interruptFlags.mcp2A = true; }  
-void handleMCP2BInterrupt() { interruptFlags.mcp2B = true; }
+// Se guarda la hora de la primera interrupción hasta que el loop la atiende
+void handleMCP1AInterrupt() { if (!interruptFlags.mcp1A) interruptFlags.mcp1ATime = micros(); interruptFlags.mcp1A = true; }
+void handleMCP1BInterrupt() { if (!interruptFlags.mcp1B) interruptFlags.mcp1BTime = micros(); interruptFlags.mcp1B = true; }
+void handleMCP2AInterrupt() { if (!interruptFlags.mcp2A) interruptFlags.mcp2ATime = micros(); interruptFlags.mcp2A = true; }
+void handleMCP2BInterrupt() { if (!interruptFlags.mcp2B) interruptFlags.mcp2BTime = micros(); interruptFlags.mcp2B = true; }
 
 // ==================== SETUP ====================
 void setup() {
-  // Inicializar USB primero
+  // Registrar el interfaz USB-MIDI y arrancar el USB una sola vez
+  MidiManager::registerUsbInterface();
   USB.begin();
   // Inicializar comunicación serie
   Serial.begin(115200);
@@ -147,6 +180,11 @@ void setup() {
     }
   }
 
+  // Inicializar bus SPI compartido (pantalla y SD)
+  if (!spiBusManager.initialize()) {
+    Serial.println(F("ERROR: Fallo en inicialización del bus SPI"));
+  }
+
   // Inicializar pantalla
   if (!displayManager.initialize(appConfig.orientation, appConfig.brightness)) {
     Serial.println(F("ERROR: Fallo en inicialización de la pantalla"));
@@ -157,6 +195,8 @@ void setup() {
 
   // Inicializar encoders
   encoderManager.initialize(&appConfig);
+  bankSyncManager.initialize();
+  feedbackManager.initialize();
 
   // Inicializar menú
   menuManager.initialize(&appConfig, &systemState);
@@ -166,10 +206,28 @@ void setup() {
     Serial.println(F("ERROR: Fallo en inicialización del sistema de archivos"));
   }
 
+  // Inicializar log binario (se vuelca a /logs desde su propia tarea)
+  logManager.initialize();
+  logManager.startFlushTask();
+
+  // Inicializar caché de presets en flash y sincronizarla desde la SD
+  if (presetCacheManager.initialize()) {
+    presetCacheManager.startSync();
+  }
+
   // Cargar configuración
-  if (!fileManager.loadConfiguration(appConfig, encoderManager.getEncoderBanks())) {
+  if (!fileManager.loadConfiguration(appConfig, encoderManager)) {
     Serial.println(F("ERROR: No se pudo cargar la configuración"));
   }
+  if (appConfig.mixerView >= VIEW_COUNT) appConfig.mixerView = VIEW_STRIPS_8;
+  // Versiones anteriores del menú guardaban milisegundos recortados a 16 bits
+  if (appConfig.screensaverTimeout > SCREENSAVER_MAX_SECONDS) appConfig.screensaverTimeout = 300;
+  displayManager.setMixerView((MixerView)appConfig.mixerView);
+  
+  // Reglas de filtrado/transformación MIDI (opcionales)
+  if (fileManager.isInitialized()) {
+    midiManager.loadFilterRules();
+  }
 
   // Configurar interrupciones
   hardwareManager.setupInterrupts();
@@ -178,8 +236,12 @@ void setup() {
   systemState.lastActivityTime = millis();
   systemState.screensaverActive = false;
   systemState.inMenu = false;
-  systemState.currentBank = appConfig.currentBank;
-
+  systemState.currentBank = min(appConfig.currentBank, (uint8_t)(encoderManager.getBankCount() - 1));
+  encoderManager.setCurrentBank(systemState.currentBank);
+  
+  // Traer del DAW el estado del banco inicial
+  bankSyncManager.startBankSwitch(systemState.currentBank, !encoderManager.isBankPopulated(systemState.currentBank));
+  
   Serial.println(F("Sistema inicializado correctamente"));
   Serial.print(F("Memoria libre: "));
   Serial.println(systemManager.getFreeMemory());
@@ -188,6 +250,7 @@ void setup() {
 // ==================== LOOP PRINCIPAL OPTIMIZADO ====================
 void loop() {
   unsigned long currentTime = millis();
+  uint32_t loopStart = micros();
   static unsigned long lastLoopTime = 0;
   const unsigned long LOOP_INTERVAL = 1; // 1ms entre loops
 
@@ -196,19 +259,19 @@ void loop() {
 
   // 2. Procesar interrupciones pendientes
   if (interruptFlags.mcp1A) {
-    hardwareManager.processMCP1AEncoders();
+    hardwareManager.processMCP1AEncoders(interruptFlags.mcp1ATime);
     interruptFlags.mcp1A = false;
   }
   if (interruptFlags.mcp1B) {
-    hardwareManager.processMCP1BEncoders();
+    hardwareManager.processMCP1BEncoders(interruptFlags.mcp1BTime);
     interruptFlags.mcp1B = false;
   }
   if (interruptFlags.mcp2A) {
-    hardwareManager.processMCP2AEncoders();
+    hardwareManager.processMCP2AEncoders(interruptFlags.mcp2ATime);
     interruptFlags.mcp2A = false;
   }
   if (interruptFlags.mcp2B) {
-    hardwareManager.processMCP2BEncoders();
+    hardwareManager.processMCP2BEncoders(interruptFlags.mcp2BTime);
     interruptFlags.mcp2B = false;
   }
 
@@ -225,47 +288,72 @@ void loop() {
   midiManager.processMidiInput();
 
   // 6. Procesar salida MIDI
+  encoderManager.updateOutput();
+  bankSyncManager.update();
+  feedbackManager.update();
   midiManager.processMidiOutput();
 
 if (systemState.displayNeedsUpdate) {
         systemState.displayNeedsUpdate = false;
         systemState.lastDisplayUpdate = 0; // Forzar redibujado
+        displayManager.markAllChannelsDirty();
     }
-
-  // 7. Actualizar pantalla
-  if (currentTime - systemState.lastDisplayUpdate >= DISPLAY_UPDATE_INTERVAL) {
-    if (systemState.screensaverActive) {
-      displayManager.drawScreensaver(midiManager.getMtcData(), systemState.currentBank);
-    } else if (systemState.inMenu) {
-      menuManager.draw(displayManager);
-    } else {
-      displayManager.drawMainScreen(
-        encoderManager.getEncoderBanks()[systemState.currentBank],
-        midiManager.getMtcData(),
-        systemState.currentBank,
-        midiManager.getTransportState()
-      );
+  
+  // 7. Actualizar pantalla. La principal se llama en cada pasada: su
+  // planificador decide qué regiones tocan y cede a las ráfagas MIDI. Con el
+  // panel dormido o despertando no se dibuja nada ni se usa el bus
+  displayManager.updatePower();
+  if (!displayManager.isAwake()) {
+    // Salvapantallas: la pantalla se queda como estaba en la RAM del panel
+  } else if (!systemState.inMenu) {
+    displayManager.setMidiBusy(midiManager.isBusy());
+    bool frameComplete = displayManager.drawMainScreen(
+      encoderManager.getBankState(systemState.currentBank),
+      encoderManager.getBankConfigs()[systemState.currentBank],
+      midiManager.getMtcData(),
+      systemState.currentBank,
+      midiManager.getTransportState(),
+      midiManager.getClockData()
+    );
+    
+    // Latencia desde el cambio de banco hasta el primer frame completo
+    if (frameComplete) {
+      if (systemState.bankSwitchStart) {
+        encoderManager.recordBankSwitch(micros() - systemState.bankSwitchStart);
+        systemState.bankSwitchStart = 0;
+      }
+      bankSyncManager.onFrameDrawn();
     }
+  } else if (currentTime - systemState.lastDisplayUpdate >= DISPLAY_UPDATE_INTERVAL) {
+    menuManager.draw(displayManager);
+    displayManager.frameShown();
     systemState.lastDisplayUpdate = currentTime;
   }
-
-  // 8. Gestión del salvapantallas
-  if (appConfig.screensaverTimeout > 0) {
-    if (!systemState.screensaverActive && 
-        (currentTime - systemState.lastActivityTime) > appConfig.screensaverTimeout) {
-      systemState.screensaverActive = true;
-      displayManager.setBrightness(0);
-    }
+  
+  // 8. Gestión del salvapantallas (screensaverTimeout en segundos). Si el
+  // panel aún no admite SLPIN se reintenta en la siguiente pasada
+  if (appConfig.screensaverTimeout > 0 && !systemState.screensaverActive &&
+      currentTime - systemState.lastActivityTime > appConfig.screensaverTimeout * 1000UL) {
+    systemState.screensaverActive = displayManager.sleep();
   }
 
   // 9. Actualizar diagnósticos
   if (currentTime - systemState.lastDiagnostic >= 1000) {
     systemState.freeMemory = systemManager.getFreeMemory();
     systemManager.updateDiagnostics();
+    spiBusManager.updateStatistics();
+    displayManager.updateFrameStatistics();
     systemState.lastDiagnostic = currentTime;
   }
 
-  // 10. Control de frecuencia de ejecución
+  // 10. Tareas en segundo plano
+  if (systemManager.shouldRunTask(PRIORITY_BACKGROUND, systemState.lastBackgroundTask, BACKGROUND_TASK_INTERVAL_MS)) {
+    presetCacheManager.update();
+    systemState.lastBackgroundTask = currentTime;
+  }
+
+  // 11. Control de frecuencia de ejecución
+  systemManager.recordLoopTime(micros() - loopStart);
   unsigned long elapsedTime = currentTime - lastLoopTime;
   if (elapsedTime < LOOP_INTERVAL) {
     // Esperar el tiempo restante sin bloquear
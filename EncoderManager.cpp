@@ -1,142 +1,542 @@
 #include "EncoderManager.h"
 #include "MidiManager.h"
 #include "DisplayManager.h"  // Add this include
+#include "LogManager.h"
+#include <esp_heap_caps.h>
 
 extern MidiManager midiManager;
 extern DisplayManager displayManager;  // Declare once at the top
 
-EncoderManager::EncoderManager() 
-    : encoderAccelerationEnabled(true), currentBank(0) 
+EncoderManager::EncoderManager()
+    : bankStates(nullptr), bankConfigs(nullptr), bankCount(0), populatedMask(0),
+      tablesInPsram(false), encoderAccelerationEnabled(true), currentBank(0),
+      lastBankSwitchMicros(0), maxBankSwitchMicros(0),
+      pickupSuppressed(0), redundantSuppressed(0), takeoversCompleted(0),
+      outputBytes7(0), outputBytes14(0),
+      lastRelativeFlush(0), relativeDetents(0), relativeMessages(0),
+      pendingMask(0), nextOutputEncoder(0), coalescedUpdates(0), deferredOutputs(0), heldMask(0)
 {
-    for (int bank = 0; bank < NUM_BANKS; bank++) {
-        for (int enc = 0; enc < NUM_ENCODERS; enc++) {
-            encoderBanks[bank][enc] = EncoderConfig();
-        }
-    }
+    memset(touchTime, 0, sizeof(touchTime));
+    memset(relativePending, 0, sizeof(relativePending));
+    memset(pendingOutput14, 0, sizeof(pendingOutput14));
+    memset(pendingSince, 0, sizeof(pendingSince));
+    memset(maxStalenessMicros, 0, sizeof(maxStalenessMicros));
 }
 
-EncoderManager::~EncoderManager() {}
+EncoderManager::~EncoderManager() {
+    heap_caps_free(bankStates);
+    heap_caps_free(bankConfigs);
+}
 
 bool EncoderManager::initialize(AppConfig* config) {
     Serial.println(F("Inicializando gestor de encoders..."));
     encoderAccelerationEnabled = config->encoderAcceleration;
-    currentBank = config->currentBank;
+    
+    if (!setBankCount(config->bankCount)) {
+        Serial.println(F("ERROR: No hay memoria para los bancos de encoders"));
+        return false;
+    }
+    
+    currentBank = min(config->currentBank, (uint8_t)(bankCount - 1));
     return true;
 }
 
 void EncoderManager::setCurrentBank(uint8_t bank) {
+    // Los envíos pendientes pertenecen a la configuración del banco que se deja
+    flushOutput();
+    // Los toques del banco anterior no deben retener los ecos del nuevo; lo
+    // retenido en él se aplica antes de dejarlo
+    memset(touchTime, 0, sizeof(touchTime));
+    for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+        if (heldMask & (1 << i)) releaseHeld(i);
+    }
     currentBank = bank;
 }
 
+// Redimensiona las tablas conservando los bancos existentes.
+// Los bancos nuevos arrancan con valores por defecto y sin poblar.
+bool EncoderManager::setBankCount(uint8_t count) {
+    count = constrain(count, 1, MAX_BANKS);
+    if (count == bankCount && bankStates) return true;
+    
+    size_t stateSize = sizeof(EncoderBankState) * count;
+    size_t configSize = sizeof(EncoderConfig) * NUM_ENCODERS * count;
+    
+    // PSRAM preferente; si no hay, memoria interna
+    bool psram = true;
+    void* newStates = heap_caps_realloc(bankStates, stateSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!newStates) {
+        psram = false;
+        newStates = heap_caps_realloc(bankStates, stateSize, MALLOC_CAP_8BIT);
+    }
+    if (!newStates) return false;
+    bankStates = (EncoderBankState*)newStates;
+    
+    void* newConfigs = heap_caps_realloc(bankConfigs, configSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!newConfigs) {
+        psram = false;
+        newConfigs = heap_caps_realloc(bankConfigs, configSize, MALLOC_CAP_8BIT);
+    }
+    if (!newConfigs) return false;
+    bankConfigs = (EncoderConfig (*)[NUM_ENCODERS])newConfigs;
+    
+    for (uint8_t bank = bankCount; bank < count; bank++) {
+        bankStates[bank] = EncoderBankState();
+        for (uint8_t enc = 0; enc < NUM_ENCODERS; enc++) {
+            bankConfigs[bank][enc] = EncoderConfig();
+        }
+    }
+    
+    if (count < MAX_BANKS) {
+        populatedMask &= (1UL << count) - 1;
+    }
+    bankCount = count;
+    tablesInPsram = psram;
+    
+    if (currentBank >= bankCount) {
+        currentBank = bankCount - 1;
+    }
+    
+    Serial.print(F("Bancos de encoders: "));
+    Serial.print(bankCount);
+    Serial.print(F(" ("));
+    Serial.print(bankCount * ENCODER_BANK_BYTES);
+    Serial.println(psram ? F(" bytes en PSRAM)") : F(" bytes en RAM interna)"));
+    return true;
+}
+
 EncoderConfig EncoderManager::getEncoderConfig(uint8_t index, uint8_t bank) {
-    if (index < NUM_ENCODERS && bank < NUM_BANKS) {
-        return encoderBanks[bank][index];
+    if (index < NUM_ENCODERS && bank < bankCount) {
+        return bankConfigs[bank][index];
     }
     return EncoderConfig();
 }
 
 EncoderConfig& EncoderManager::getEncoderConfigMutable(uint8_t index, uint8_t bank) {
     static EncoderConfig dummy;
-    if (index < NUM_ENCODERS && bank < NUM_BANKS) {
-        return encoderBanks[bank][index];
+    if (index < NUM_ENCODERS && bank < bankCount) {
+        return bankConfigs[bank][index];
     }
     return dummy;
 }
 
-EncoderConfig (*EncoderManager::getEncoderBanks())[NUM_BANKS] {
-    return encoderBanks;
+EncoderConfig (*EncoderManager::getBankConfigs())[NUM_ENCODERS] {
+    return bankConfigs;
 }
 
-void EncoderManager::processEncoderChange(uint8_t encoderIndex, int8_t change, uint8_t bank) {
-    if (encoderIndex >= NUM_ENCODERS || bank >= NUM_BANKS) return;
+const EncoderConfig (*EncoderManager::getBankConfigs() const)[NUM_ENCODERS] {
+    return bankConfigs;
+}
+
+EncoderBankState* EncoderManager::getBankStates() {
+    return bankStates;
+}
+
+const EncoderBankState* EncoderManager::getBankStates() const {
+    return bankStates;
+}
+
+const EncoderBankState& EncoderManager::getBankState(uint8_t bank) const {
+    static const EncoderBankState empty;
+    if (!bankStates) return empty;
+    return bankStates[bank < bankCount ? bank : 0];
+}
+
+EncoderImageHeader EncoderManager::getImageHeader() const {
+    EncoderImageHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = ENCODER_IMAGE_MAGIC;
+    header.bankCount = bankCount;
+    header.populatedMask = populatedMask;
+    return header;
+}
+
+bool EncoderManager::applyImageHeader(const EncoderImageHeader& header) {
+    if (header.magic != ENCODER_IMAGE_MAGIC ||
+        header.bankCount == 0 || header.bankCount > MAX_BANKS) {
+        return false;
+    }
     
-    EncoderConfig& config = encoderBanks[bank][encoderIndex];
-    config.value = constrain(config.value + change, config.minValue, config.maxValue);
+    if (!setBankCount(header.bankCount)) return false;
+    populatedMask = header.populatedMask;
+    return true;
+}
+
+size_t EncoderManager::getImageSize() const {
+    return sizeof(EncoderImageHeader) + getConfigDataSize() + getStateDataSize();
+}
+
+size_t EncoderManager::exportImage(uint8_t* buffer, size_t maxSize) const {
+    size_t size = getImageSize();
+    if (!buffer || size > maxSize) return 0;
     
+    EncoderImageHeader header = getImageHeader();
+    memcpy(buffer, &header, sizeof(header));
+    buffer += sizeof(header);
+    memcpy(buffer, bankConfigs, getConfigDataSize());
+    buffer += getConfigDataSize();
+    memcpy(buffer, bankStates, getStateDataSize());
+    return size;
+}
+
+bool EncoderManager::importImage(const uint8_t* image, size_t size) {
+    if (!image || size < sizeof(EncoderImageHeader)) return false;
+    
+    EncoderImageHeader header;
+    memcpy(&header, image, sizeof(header));
+    
+    size_t expected = sizeof(EncoderImageHeader) +
+                      (size_t)header.bankCount * ENCODER_BANK_BYTES;
+    if (size != expected || !applyImageHeader(header)) return false;
+    
+    image += sizeof(header);
+    memcpy(bankConfigs, image, getConfigDataSize());
+    image += getConfigDataSize();
+    memcpy(bankStates, image, getStateDataSize());
+    return true;
+}
+
+void EncoderManager::processEncoderChange(uint8_t encoderIndex, int8_t change, uint8_t bank, uint32_t eventTime) {
+    if (encoderIndex >= NUM_ENCODERS || bank >= bankCount) return;
+    if (!eventTime) eventTime = micros();
+    if (bank == currentBank) displayManager.setFocusChannel(encoderIndex);
+    
+    const EncoderConfig& config = bankConfigs[bank][encoderIndex];
+    
+    // Relativos: no hay valor absoluto que mantener, solo se acumulan pasos
+    if (config.controlType >= CT_REL_TWOS) {
+        relativeDetents += abs(change);
+        if (bank == currentBank) {
+            if (relativePending[encoderIndex] == 0) pendingSince[encoderIndex] = eventTime;
+            relativePending[encoderIndex] += change;
+        } else {
+            sendRelative(config, change, eventTime);
+        }
+        return;
+    }
+    
+    EncoderBankState& state = bankStates[bank];
+    uint16_t bit = 1 << encoderIndex;
+    bool hiRes = isHiRes(config);
+    if (bank == currentBank) touchTime[encoderIndex] = millis();
+    
+    int8_t previous = state.value[encoderIndex];
+    int8_t value;
+    if (hiRes) {
+        int32_t fine = (int32_t)state.value14[encoderIndex] + change * HIRES_STEP;
+        fine = constrain(fine, config.minValue << 7, (config.maxValue << 7) | 0x7F);
+        state.value14[encoderIndex] = fine;
+        value = fine >> 7;
+    } else {
+        value = constrain(previous + change, config.minValue, config.maxValue);
+        state.value14[encoderIndex] = value << 7;
+    }
+    state.value[encoderIndex] = value;
+    
+    if (state.pickupMask & bit) {
+        int8_t target = state.dawValue[encoderIndex];
+        
+        if (config.takeover == TAKEOVER_SCALED) {
+            value = scaleTowards(previous, value, target, config);
+            if (abs(value - state.value[encoderIndex]) <= 1) {
+                state.value[encoderIndex] = value;
+                state.value14[encoderIndex] = value << 7;
+                state.pickupMask &= ~bit;
+                takeoversCompleted++;
+            }
+        } else if ((previous - target) * (value - target) > 0) {
+            // PICKUP: sin salida hasta alcanzar o cruzar el valor del DAW
+            pickupSuppressed++;
+            return;
+        } else {
+            state.pickupMask &= ~bit;
+            takeoversCompleted++;
+        }
+    }
+    
+    // En escalado la salida no es el valor local: va sin bits finos
+    uint16_t output14 = (value == state.value[encoderIndex]) ? state.value14[encoderIndex] : (uint16_t)(value << 7);
+    
+    // Banco actual: el valor se envía en su turno de updateOutput(); los
+    // cambios que lleguen antes se agrupan en uno (las notas no se agrupan)
+    if (bank == currentBank && config.controlType != CT_NOTE) {
+        if (pendingMask & bit) {
+            coalescedUpdates++;
+        } else {
+            pendingMask |= bit;
+            pendingSince[encoderIndex] = eventTime;   // El más antiguo de los agrupados
+        }
+        pendingOutput14[encoderIndex] = output14;
+        
+        // El DAW tomará este valor: mostrarlo ya, sin esperar al envío ni al eco
+        if (state.dawValue[encoderIndex] != value) {
+            state.dawValue[encoderIndex] = value;
+            displayManager.markChannelDirty(encoderIndex);
+        }
+        return;
+    }
+    
+    sendAbsolute(encoderIndex, bank, output14, change > 0, eventTime);
+}
+
+// Envía la salida de un encoder absoluto salvo que repita lo último enviado
+void EncoderManager::sendAbsolute(uint8_t encoderIndex, uint8_t bank, uint16_t output14, bool noteOn,
+                                  uint32_t eventTime) {
+    const EncoderConfig& config = bankConfigs[bank][encoderIndex];
+    EncoderBankState& state = bankStates[bank];
+    bool hiRes = isHiRes(config);
+    int8_t value = output14 >> 7;
+    uint8_t lsb = output14 & 0x7F;
+    bool msbChanged = value != state.sentValue[encoderIndex];
+    
+    // Mismo valor que el último enviado (tope del rango, eco ya confirmado...)
+    if (config.controlType != CT_NOTE && !msbChanged && (!hiRes || lsb == state.sentLsb[encoderIndex])) {
+        redundantSuppressed++;
+        return;
+    }
+    state.sentValue[encoderIndex] = value;
+    state.sentLsb[encoderIndex] = hiRes ? lsb : SENT_LSB_NONE;
+    
+    // El DAW tomará este valor: mostrarlo ya, sin esperar al eco
+    if (state.dawValue[encoderIndex] != value) {
+        state.dawValue[encoderIndex] = value;
+        if (bank == currentBank) displayManager.markChannelDirty(encoderIndex);
+    }
+    
+    // Los mensajes llevan la marca del evento de entrada hasta la cola de salida
+    midiManager.setEventTime(eventTime);
+    uint8_t messages = 1;
     switch (config.controlType) {
         case CT_CC:
-            midiManager.sendControlChange(config.channel, config.control, config.value);
+            if (!hiRes) {
+                midiManager.sendControlChange(config.channel, config.control, value, config.cable);
+            } else if (config.resolution == RES_NRPN) {
+                messages = midiManager.sendNrpn(config.channel, config.control, output14, msbChanged, config.cable);
+            } else {
+                messages = midiManager.sendControlChange14(config.channel, config.control, output14, msbChanged,
+                                                           config.cable);
+            }
             break;
         case CT_NOTE:
-            if (change > 0) {
-                midiManager.sendNoteOn(config.channel, config.control, config.value);
+            if (noteOn) {
+                midiManager.sendNoteOn(config.channel, config.control, value, config.cable);
             } else {
-                midiManager.sendNoteOff(config.channel, config.control, 0);
+                midiManager.sendNoteOff(config.channel, config.control, 0, config.cable);
             }
             break;
         case CT_PITCH:
-            midiManager.sendPitchBend(config.channel, map(config.value, 0, 127, -8192, 8191));
+            if (hiRes) {
+                midiManager.sendPitchBend(config.channel, (int16_t)output14 - 8192, config.cable);
+            } else {
+                midiManager.sendPitchBend(config.channel, map(value, 0, 127, -8192, 8191), config.cable);
+            }
             break;
     }
+    midiManager.setEventTime(0);
+    
+    if (hiRes) {
+        outputBytes14 += messages * 3;
+    } else {
+        outputBytes7 += messages * 3;
+    }
+}
+
+// El par MSB/LSB solo existe para los controles 0-31; por encima se envía en 7 bits
+bool EncoderManager::isHiRes(const EncoderConfig& config) {
+    switch (config.resolution) {
+        case RES_14BIT_CC:
+            return config.controlType == CT_PITCH ||
+                   (config.controlType == CT_CC && config.control < CC_LSB_OFFSET);
+        case RES_NRPN:
+            return config.controlType == CT_CC || config.controlType == CT_PITCH;
+        default:
+            return false;
+    }
+}
+
+// Mensajes que puede necesitar un envío del encoder (NRPN: selección + dato)
+uint8_t EncoderManager::messagesPerUpdate(const EncoderConfig& config) {
+    if (!isHiRes(config)) return 1;
+    return config.resolution == RES_NRPN ? 4 : 2;
+}
+
+// Turno rotatorio entre los encoders con salida pendiente, limitado por el
+// crédito de MidiManager (presupuesto de mensajes y hueco en la cola). El
+// encoder que se queda sin crédito abre el turno siguiente, así que en un
+// barrido de los 16 ninguno espera más de una vuelta.
+void EncoderManager::updateOutput() {
+    if (!bankConfigs || currentBank >= bankCount) return;
+    
+    unsigned long now = millis();
+    bool relativeDue = now - lastRelativeFlush >= RELATIVE_TICK_MS;
+    if (relativeDue) lastRelativeFlush = now;
+    
+    for (uint8_t i = 0; heldMask && i < NUM_ENCODERS; i++) {
+        if ((heldMask & (1 << i)) && !isTouched(i, currentBank)) releaseHeld(i);
+    }
+    
+    for (uint8_t n = 0; n < NUM_ENCODERS; n++) {
+        uint8_t i = (nextOutputEncoder + n) % NUM_ENCODERS;
+        bool absolute = pendingMask & (1 << i);
+        bool relative = relativeDue && relativePending[i] != 0;
+        if (!absolute && !relative) continue;
+        
+        const EncoderConfig& config = bankConfigs[currentBank][i];
+        if (midiManager.getOutputCredit(config.cable) < messagesPerUpdate(config)) {
+            deferredOutputs++;
+            nextOutputEncoder = i;
+            return;
+        }
+        
+        if (absolute) {
+            pendingMask &= ~(1 << i);
+            sendAbsolute(i, currentBank, pendingOutput14[i], true, pendingSince[i]);
+            recordStaleness(i);
+        } else {
+            // Un mensaje por tick; lo que exceda RELATIVE_MAX_DELTA sale en el siguiente
+            int8_t delta = constrain(relativePending[i], -RELATIVE_MAX_DELTA, RELATIVE_MAX_DELTA);
+            relativePending[i] -= delta;
+            sendRelative(config, delta, pendingSince[i]);
+            if (relativePending[i] == 0) recordStaleness(i);
+        }
+    }
+    nextOutputEncoder = (nextOutputEncoder + 1) % NUM_ENCODERS;
+}
+
+// Al cambiar de banco se vacía todo, sin esperar crédito
+void EncoderManager::flushOutput() {
+    if (!bankConfigs || currentBank >= bankCount) return;
+    
+    for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+        while (relativePending[i] != 0) {
+            int8_t delta = constrain(relativePending[i], -RELATIVE_MAX_DELTA, RELATIVE_MAX_DELTA);
+            relativePending[i] -= delta;
+            sendRelative(bankConfigs[currentBank][i], delta, pendingSince[i]);
+        }
+        if (pendingMask & (1 << i)) {
+            sendAbsolute(i, currentBank, pendingOutput14[i], true, pendingSince[i]);
+            recordStaleness(i);
+        }
+    }
+    pendingMask = 0;
+}
+
+void EncoderManager::recordStaleness(uint8_t encoderIndex) {
+    uint32_t staleness = micros() - pendingSince[encoderIndex];
+    if (staleness > maxStalenessMicros[encoderIndex]) {
+        maxStalenessMicros[encoderIndex] = staleness;
+    }
+}
+
+uint8_t EncoderManager::encodeRelative(uint8_t controlType, int8_t delta) {
+    switch (controlType) {
+        case CT_REL_SIGNED:
+            return delta < 0 ? (0x40 | -delta) : delta;
+        case CT_REL_OFFSET:
+            return 64 + delta;
+        default:
+            return delta & 0x7F;
+    }
+}
+
+void EncoderManager::sendRelative(const EncoderConfig& config, int8_t delta, uint32_t eventTime) {
+    midiManager.setEventTime(eventTime);
+    midiManager.sendControlChange(config.channel, config.control, encodeRelative(config.controlType, delta),
+                                  config.cable);
+    midiManager.setEventTime(0);
+    relativeMessages++;
+    outputBytes7 += 3;
 }
 
 void EncoderManager::processSwitchPress(uint8_t switchIndex, uint8_t bank) {
     if (switchIndex < 8) {
         uint8_t track = switchIndex;
-        if (track < NUM_ENCODERS && bank < NUM_BANKS) {
-            encoderBanks[bank][track].isMute = !encoderBanks[bank][track].isMute;
-            midiManager.sendControlChange(encoderBanks[bank][track].channel, 120 + track, encoderBanks[bank][track].isMute ? 127 : 0);
+        if (track < NUM_ENCODERS && bank < bankCount) {
+            EncoderBankState& state = bankStates[bank];
+            state.muteMask ^= (1 << track);
+            if (bank == currentBank) displayManager.markChannelDirty(track);
+            const EncoderConfig& config = bankConfigs[bank][track];
+            midiManager.sendControlChange(config.channel, 120 + track, state.isMute(track) ? 127 : 0, config.cable, true);
         }
     } else if (switchIndex < 16) {
         uint8_t track = switchIndex - 8;
-        if (track < NUM_ENCODERS && bank < NUM_BANKS) {
-            encoderBanks[bank][track].isSolo = !encoderBanks[bank][track].isSolo;
-            midiManager.sendControlChange(encoderBanks[bank][track].channel, 110 + track, encoderBanks[bank][track].isSolo ? 127 : 0);
+        if (track < NUM_ENCODERS && bank < bankCount) {
+            EncoderBankState& state = bankStates[bank];
+            state.soloMask ^= (1 << track);
+            if (bank == currentBank) displayManager.markChannelDirty(track);
+            const EncoderConfig& config = bankConfigs[bank][track];
+            midiManager.sendControlChange(config.channel, 110 + track, state.isSolo(track) ? 127 : 0, config.cable, true);
         }
     }
 }
 
 void EncoderManager::syncFromDAW(uint8_t track, uint8_t bank, uint8_t value, uint16_t color) {
-    if (track < NUM_ENCODERS && bank < NUM_BANKS) {
-        encoderBanks[bank][track].dawValue = value;
-        encoderBanks[bank][track].trackColor = color;
+    if (track < NUM_ENCODERS && bank < bankCount) {
+        bankStates[bank].dawValue[track] = value;
+        bankStates[bank].confirmedValue[track] = value;
+        bankStates[bank].trackColor[track] = color;
     }
 }
 
 void EncoderManager::setEncoderDAWValue(uint8_t track, uint8_t bank, uint8_t value) {
-    if (track < NUM_ENCODERS && bank < NUM_BANKS) {
-        encoderBanks[bank][track].dawValue = value;
+    if (track < NUM_ENCODERS && bank < bankCount) {
+        bankStates[bank].dawValue[track] = value;
+        bankStates[bank].confirmedValue[track] = value;
     }
 }
 
 // En EncoderManager.cpp
 uint8_t EncoderManager::getEncoderDAWValue(uint8_t track, uint8_t bank) {
-    if (track < NUM_ENCODERS && bank < NUM_BANKS) {
-        return encoderBanks[bank][track].dawValue;
+    if (track < NUM_ENCODERS && bank < bankCount) {
+        return bankStates[bank].dawValue[track];
     }
     return 0;
 }
 
 // En EncoderManager.cpp
 void EncoderManager::syncNameFromDAW(uint8_t track, uint8_t bank, const char* name) {
-    if (track < NUM_ENCODERS && bank < NUM_BANKS && name != nullptr) {
-        strncpy(encoderBanks[bank][track].trackName, name, 5);
-        encoderBanks[bank][track].trackName[4] = '\0';
+    if (track < NUM_ENCODERS && bank < bankCount && name != nullptr) {
+        char* trackName = bankConfigs[bank][track].trackName;
+        strncpy(trackName, name, TRACK_NAME_LENGTH - 1);
+        trackName[TRACK_NAME_LENGTH - 1] = '\0';
         
         if (bank == currentBank) {
             extern DisplayManager displayManager;
-            displayManager.markChannelDirty(track);
-            
-            Serial.print(F("DAW Name Update - Track: "));
-            Serial.print(track);
-            Serial.print(F(", Bank: "));
-            Serial.print(bank);
-            Serial.print(F(", Name: "));
-            Serial.println(name);
+            displayManager.invalidateWidgets(track, WIDGET_BIT(WIDGET_LABEL));
         }
+        
+        uint32_t packedName = 0;
+        memcpy(&packedName, trackName, 4);
+        markBankPopulated(bank);
+        LOG_INFO(LOG_EVT_DAW_NAME, track, bank, 0, packedName);
     }
 }
 
 void EncoderManager::resetEncoderConfig(uint8_t index, uint8_t bank) {
-    if (index < NUM_ENCODERS && bank < NUM_BANKS) {
-        encoderBanks[bank][index] = EncoderConfig();
+    if (index < NUM_ENCODERS && bank < bankCount) {
+        bankConfigs[bank][index] = EncoderConfig();
+        
+        EncoderBankState& state = bankStates[bank];
+        const EncoderBankState defaults;
+        state.value[index] = defaults.value[index];
+        state.dawValue[index] = defaults.dawValue[index];
+        state.confirmedValue[index] = defaults.confirmedValue[index];
+        state.sentValue[index] = defaults.sentValue[index];
+        state.value14[index] = defaults.value14[index];
+        state.sentLsb[index] = defaults.sentLsb[index];
+        state.pickupMask &= ~(1 << index);
+        state.trackColor[index] = defaults.trackColor[index];
+        state.muteMask &= ~(1 << index);
+        state.soloMask &= ~(1 << index);
     }
 }
 
 void EncoderManager::resetAllBanks() {
-    for (int bank = 0; bank < NUM_BANKS; bank++) {
+    populatedMask = 0;
+    for (int bank = 0; bank < bankCount; bank++) {
+        bankStates[bank] = EncoderBankState();
         for (int enc = 0; enc < NUM_ENCODERS; enc++) {
-            encoderBanks[bank][enc] = EncoderConfig();
+            bankConfigs[bank][enc] = EncoderConfig();
         }
     }
 }
@@ -150,80 +550,123 @@ void EncoderManager::setEncoderAcceleration(bool enabled) {
 }
 
 void EncoderManager::updateFromDAW(uint8_t track, uint8_t bank, uint8_t value, uint16_t color) {
-    if (track < NUM_ENCODERS && bank < NUM_BANKS) {
-        EncoderConfig& config = encoderBanks[bank][track];
+    if (track < NUM_ENCODERS && bank < bankCount) {
+        EncoderBankState& state = bankStates[bank];
+        bool changed = state.trackColor[track] != color;
         
         // Actualizar valores del DAW
-        config.dawValue = value;
-        config.trackColor = color;
+        changed |= confirmDawValue(track, bank, value);
+        state.trackColor[track] = color;
         
-        // Si es el banco actual, sincronizar el valor físico del encoder
-        if (bank == currentBank) {
-            config.value = value; // Sincronizar el encoder físico con el valor del DAW
-            
-            // Forzar actualización visual de este canal
+        // Redibujar solo si la respuesta trae algo distinto de la caché
+        if (bank == currentBank && changed) {
             extern DisplayManager displayManager;
             displayManager.markChannelDirty(track);
-            
-            // También actualizar el canal correspondiente de pan (si aplica)
-            if (track < 8) {
-                displayManager.markChannelDirty(track);
-            }
         }
         
-        Serial.print(F("DAW Update - Track: "));
-        Serial.print(track);
-        Serial.print(F(", Bank: "));
-        Serial.print(bank);
-        Serial.print(F(", Value: "));
-        Serial.print(value);
-        Serial.print(F(", Color: 0x"));
-        Serial.println(color, HEX);
+        markBankPopulated(bank);
+        LOG_INFO(LOG_EVT_DAW_VALUE_COLOR, track, bank, color, value);
     }
 }
 
 // Función sobrecargada para actualizar solo el valor
 void EncoderManager::updateFromDAW(uint8_t track, uint8_t bank, uint8_t value) {
-    if (track < NUM_ENCODERS && bank < NUM_BANKS) {
-        EncoderConfig& config = encoderBanks[bank][track];
-        config.dawValue = value;
+    if (track < NUM_ENCODERS && bank < bankCount) {
+        bool changed = confirmDawValue(track, bank, value);
         
-        if (bank == currentBank) {
-            config.value = value;
-            
+        if (bank == currentBank && changed) {
             extern DisplayManager displayManager;
             displayManager.markChannelDirty(track);
-            
-            Serial.print(F("DAW Value Update - Track: "));
-            Serial.print(track);
-            Serial.print(F(", Bank: "));
-            Serial.print(bank);
-            Serial.print(F(", Value: "));
-            Serial.println(value);
         }
+        
+        markBankPopulated(bank);
+        LOG_INFO(LOG_EVT_DAW_VALUE, track, bank, value, 0);
     }
 }
 
 // Función sobrecargada para actualizar solo el color
 void EncoderManager::updateFromDAW(uint8_t track, uint8_t bank, uint16_t color) {
-    if (track < NUM_ENCODERS && bank < NUM_BANKS) {
-        EncoderConfig& config = encoderBanks[bank][track];
-        config.trackColor = color;
+    if (track < NUM_ENCODERS && bank < bankCount) {
+        bool changed = bankStates[bank].trackColor[track] != color;
+        bankStates[bank].trackColor[track] = color;
         
-        if (bank == currentBank) {
+        if (bank == currentBank && changed) {
             extern DisplayManager displayManager;
             displayManager.markChannelDirty(track);
-            
-            Serial.print(F("DAW Color Update - Track: "));
-            Serial.print(track);
-            Serial.print(F(", Bank: "));
-            Serial.print(bank);
-            Serial.print(F(", Color: 0x"));
-            Serial.println(color, HEX);
         }
+        
+        markBankPopulated(bank);
+        LOG_INFO(LOG_EVT_DAW_COLOR, track, bank, color, 0);
     }
 }
 
+// Estado de banco en bloque: aplica solo las secciones y pistas presentes
+// y marca sucios únicamente los canales que cambian
+void EncoderManager::applyBankState(const BankStateMessage& msg) {
+    if (msg.bank >= bankCount) return;
+    
+    EncoderBankState& state = bankStates[msg.bank];
+    uint16_t changedMask = 0;
+    
+    for (uint8_t track = 0; track < NUM_ENCODERS; track++) {
+        uint16_t bit = 1 << track;
+        if (!(msg.trackMask & bit)) continue;
+        
+        if (msg.sections & BANK_STATE_VALUES) {
+            if (confirmDawValue(track, msg.bank, msg.values[track])) changedMask |= bit;
+        }
+        
+        if (msg.sections & BANK_STATE_COLORS) {
+            if (state.trackColor[track] != msg.colors[track]) changedMask |= bit;
+            state.trackColor[track] = msg.colors[track];
+        }
+        
+        if (msg.sections & BANK_STATE_NAMES) {
+            char* trackName = bankConfigs[msg.bank][track].trackName;
+            if (strncmp(trackName, msg.names[track], TRACK_NAME_LENGTH) != 0) changedMask |= bit;
+            memcpy(trackName, msg.names[track], TRACK_NAME_LENGTH);
+        }
+    }
+    
+    if (msg.sections & BANK_STATE_FLAGS) {
+        changedMask |= (state.muteMask ^ msg.muteMask) | (state.soloMask ^ msg.soloMask);
+        state.muteMask = msg.muteMask;
+        state.soloMask = msg.soloMask;
+    }
+    
+    if (msg.bank == currentBank) {
+        for (uint8_t track = 0; track < NUM_ENCODERS; track++) {
+            if (changedMask & (1 << track)) displayManager.markChannelDirty(track);
+        }
+    }
+    
+    markBankPopulated(msg.bank);
+    LOG_INFO(LOG_EVT_DAW_BANK_STATE, msg.bank, msg.sections, msg.trackMask, changedMask);
+}
+
+// Delta secuenciado del DAW (FeedbackManager garantiza el orden)
+void EncoderManager::applyValueDelta(uint8_t bank, const ValueDelta& delta) {
+    if (delta.track >= NUM_ENCODERS || bank >= bankCount) return;
+    
+    // Los relativos parten del último valor del DAW, no de dawValue: ahí
+    // puede estar ya nuestra predicción y el paso se contaría dos veces
+    int8_t base = bankStates[bank].confirmedValue[delta.track];
+    int16_t value = delta.amount;
+    if (!(delta.flags & DELTA_ABSOLUTE)) {
+        value = (delta.flags & DELTA_NEGATIVE) ? base - delta.amount : base + delta.amount;
+    }
+    value = constrain(value, 0, 127);
+    
+    bool changed = confirmDawValue(delta.track, bank, value);
+        
+    if (bank == currentBank && changed) {
+        displayManager.markChannelDirty(delta.track);
+    }
+    
+    markBankPopulated(bank);
+    LOG_DEBUG(LOG_EVT_DAW_VALUE, delta.track, bank, value, 0);
+}
+
 // Añade esta función a EncoderManager.cpp
 void EncoderManager::updateVULevel(uint8_t track, uint8_t level) {
     if (track < NUM_ENCODERS) {
@@ -240,8 +683,179 @@ void EncoderManager::updateVULevel(uint8_t track, uint8_t level) {
 }
 
 void EncoderManager::updateTrackName(uint8_t track, uint8_t bank, const char* name) {
-    if (track < NUM_ENCODERS && bank < NUM_BANKS && name != nullptr) {
-        strncpy(encoderBanks[bank][track].trackName, name, 4);
-        encoderBanks[bank][track].trackName[3] = '\0';
+    if (track < NUM_ENCODERS && bank < bankCount && name != nullptr) {
+        char* trackName = bankConfigs[bank][track].trackName;
+        strncpy(trackName, name, TRACK_NAME_LENGTH - 1);
+        trackName[TRACK_NAME_LENGTH - 1] = '\0';
+    }
+}
+
+// Valor dado por el DAW (absoluto o tras aplicar un delta): pasa a ser la
+// base confirmada y lo que se muestra. Devuelve si cambia lo mostrado.
+bool EncoderManager::confirmDawValue(uint8_t track, uint8_t bank, int8_t value) {
+    EncoderBankState& state = bankStates[bank];
+    state.confirmedValue[track] = value;
+    
+    // Mientras se toca el encoder lo que llega es eco de nuestros envíos:
+    // se queda en confirmedValue, sin pisar la predicción ni lo enviado,
+    // hasta que updateOutput() vea el toque expirado
+    if (isTouched(track, bank)) {
+        heldMask |= 1 << track;
+        return false;
+    }
+    
+    bool changed = state.dawValue[track] != value;
+    state.dawValue[track] = value;
+    syncTakeover(track, bank);
+    return changed;
+}
+
+// Fin del toque: se muestra lo último que confirmó el DAW y el encoder se
+// reengancha a ello según su modo
+void EncoderManager::releaseHeld(uint8_t track) {
+    heldMask &= ~(1 << track);
+    
+    EncoderBankState& state = bankStates[currentBank];
+    bool changed = state.dawValue[track] != state.confirmedValue[track];
+    state.dawValue[track] = state.confirmedValue[track];
+    syncTakeover(track, currentBank);
+    if (changed) displayManager.markChannelDirty(track);
+}
+
+// Nuevo valor del DAW para un encoder: el valor local lo sigue o entra en
+// recogida según su modo. Vale para cualquier banco, no solo el actual, para
+// que al volver a un banco no se envíe desde una base obsoleta.
+void EncoderManager::syncTakeover(uint8_t track, uint8_t bank) {
+    EncoderBankState& state = bankStates[bank];
+    uint16_t bit = 1 << track;
+    
+    // El DAW ya tiene este valor: reenviarlo sería redundante. La
+    // realimentación es de 7 bits, así que el LSB enviado queda desconocido.
+    state.sentValue[track] = state.dawValue[track];
+    state.sentLsb[track] = SENT_LSB_NONE;
+    
+    switch (bankConfigs[bank][track].takeover) {
+        case TAKEOVER_FOLLOW:
+            state.value[track] = state.dawValue[track];
+            // Conservar los bits finos si el DAW confirma el mismo MSB
+            if ((state.value14[track] >> 7) != state.value[track]) {
+                state.value14[track] = state.value[track] << 7;
+            }
+            state.pickupMask &= ~bit;
+            break;
+        case TAKEOVER_JUMP:
+            break;
+        default:
+            if (state.value[track] != state.dawValue[track]) {
+                state.pickupMask |= bit;
+            } else {
+                state.pickupMask &= ~bit;
+            }
+            break;
+    }
+}
+
+// Escalado: la salida recorre lo que le queda hasta el extremo en la misma
+// proporción que el valor local, de modo que ambos llegan juntos al tope
+int8_t EncoderManager::scaleTowards(int8_t previous, int8_t value, int8_t target,
+                                    const EncoderConfig& config) const {
+    int16_t moved = value - previous;
+    if (moved == 0) return target;
+    
+    int16_t result;
+    if (moved > 0) {
+        int16_t localRoom = config.maxValue - previous;
+        int16_t targetRoom = config.maxValue - target;
+        result = localRoom > 0 ? target + (targetRoom * moved + localRoom - 1) / localRoom : config.maxValue;
+    } else {
+        int16_t localRoom = previous - config.minValue;
+        int16_t targetRoom = target - config.minValue;
+        result = localRoom > 0 ? target - (targetRoom * -moved + localRoom - 1) / localRoom : config.minValue;
+    }
+    return constrain(result, config.minValue, config.maxValue);
+}
+
+bool EncoderManager::isTouched(uint8_t track, uint8_t bank) const {
+    return bank == currentBank && touchTime[track] != 0 &&
+           millis() - touchTime[track] < TOUCH_HOLD_MS;
+}
+
+bool EncoderManager::isPickupPending(uint8_t track, uint8_t bank) const {
+    if (track >= NUM_ENCODERS || bank >= bankCount) return false;
+    return bankStates[bank].pickupMask & (1 << track);
+}
+
+void EncoderManager::recordBankSwitch(uint32_t elapsedMicros) {
+    lastBankSwitchMicros = elapsedMicros;
+    if (elapsedMicros > maxBankSwitchMicros) {
+        maxBankSwitchMicros = elapsedMicros;
+    }
+}
+
+// Campos de DIAG_SECTION_ENCODERS, en el orden que espera tools/diag_cli.py
+uint8_t EncoderManager::getDiagnostics(uint32_t* fields) const {
+    uint32_t maxStaleness = 0;
+    for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+        maxStaleness = max(maxStaleness, maxStalenessMicros[i]);
+    }
+    
+    uint8_t count = 0;
+    fields[count++] = redundantSuppressed;
+    fields[count++] = pickupSuppressed;
+    fields[count++] = takeoversCompleted;
+    fields[count++] = outputBytes7;
+    fields[count++] = outputBytes14;
+    fields[count++] = relativeDetents;
+    fields[count++] = relativeMessages;
+    fields[count++] = coalescedUpdates;
+    fields[count++] = deferredOutputs;
+    fields[count++] = maxStaleness;
+    fields[count++] = maxBankSwitchMicros;
+    return count;
+}
+
+void EncoderManager::resetStatistics() {
+    redundantSuppressed = 0;
+    pickupSuppressed = 0;
+    takeoversCompleted = 0;
+    outputBytes7 = 0;
+    outputBytes14 = 0;
+    relativeDetents = 0;
+    relativeMessages = 0;
+    coalescedUpdates = 0;
+    deferredOutputs = 0;
+    maxBankSwitchMicros = 0;
+    memset(maxStalenessMicros, 0, sizeof(maxStalenessMicros));
+}
+
+void EncoderManager::printStatistics() const {
+    uint8_t populated = 0;
+    for (uint8_t bank = 0; bank < bankCount; bank++) {
+        if (isBankPopulated(bank)) populated++;
+    }
+    
+    Serial.println(F("\n=== BANCOS DE ENCODERS ==="));
+    Serial.print(F("Bancos: ")); Serial.print(populated);
+    Serial.print(F("/")); Serial.print(bankCount); Serial.println(F(" poblados"));
+    Serial.print(F("Bytes por banco: ")); Serial.println(ENCODER_BANK_BYTES);
+    Serial.print(F("Memoria total: ")); Serial.print(bankCount * ENCODER_BANK_BYTES);
+    Serial.println(tablesInPsram ? F(" bytes (PSRAM)") : F(" bytes (RAM interna)"));
+    Serial.print(F("Cambio de banco (us): ")); Serial.print(lastBankSwitchMicros);
+    Serial.print(F(" | máx ")); Serial.println(maxBankSwitchMicros);
+    Serial.print(F("Recogidas completadas: ")); Serial.print(takeoversCompleted);
+    Serial.print(F(" | envíos mudos ")); Serial.print(pickupSuppressed);
+    Serial.print(F(" | redundantes ")); Serial.println(redundantSuppressed);
+    Serial.print(F("Bytes de salida 7 bits: ")); Serial.print(outputBytes7);
+    Serial.print(F(" | 14 bits ")); Serial.println(outputBytes14);
+    Serial.print(F("Relativos: ")); Serial.print(relativeDetents);
+    Serial.print(F(" pasos en ")); Serial.print(relativeMessages);
+    Serial.println(F(" mensajes"));
+    Serial.print(F("Salida agrupada: ")); Serial.print(coalescedUpdates);
+    Serial.print(F(" | aplazada sin crédito ")); Serial.println(deferredOutputs);
+    Serial.print(F("Espera máx. por encoder (us):"));
+    for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+        Serial.print(' '); Serial.print(maxStalenessMicros[i]);
     }
+    Serial.println();
+    Serial.println(F("==========================\n"));
 }
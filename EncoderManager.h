@@ -2,14 +2,75 @@
 #define ENCODER_MANAGER_H
 
 #include "Config.h"
+#include "StudioOneProtocol.h"
 #include <Arduino.h>
 
+// Tras mover un encoder, las actualizaciones del DAW son eco de nuestros envíos
+#define TOUCH_HOLD_MS  250
+
+// Salida relativa: los pasos de un tick se agrupan en un solo mensaje
+#define RELATIVE_TICK_MS     5
+#define RELATIVE_MAX_DELTA   63
+
 class EncoderManager {
 private:
-    EncoderConfig encoderBanks[NUM_ENCODERS][NUM_BANKS];
+    // Estado caliente por banco (SoA) y configuración fría, separados.
+    // Ambas tablas son contiguas, en PSRAM, y crecen con bankCount.
+    EncoderBankState* bankStates;
+    EncoderConfig (*bankConfigs)[NUM_ENCODERS];
+    uint8_t bankCount;
+    uint32_t populatedMask;   // Bancos con datos del DAW o de fichero
+    bool tablesInPsram;
     bool encoderAccelerationEnabled;
     uint8_t currentBank;
     
+    uint32_t lastBankSwitchMicros;
+    uint32_t maxBankSwitchMicros;
+    
+    // Toque por encoder del banco actual y estadísticas de recogida
+    unsigned long touchTime[NUM_ENCODERS];
+    uint32_t pickupSuppressed;
+    uint32_t redundantSuppressed;
+    uint32_t takeoversCompleted;
+    
+    // Bytes MIDI emitidos por los encoders según resolución
+    uint32_t outputBytes7;
+    uint32_t outputBytes14;
+    
+    // Pasos relativos pendientes del banco actual
+    int16_t relativePending[NUM_ENCODERS];
+    unsigned long lastRelativeFlush;
+    uint32_t relativeDetents;
+    uint32_t relativeMessages;
+    
+    // Salida absoluta pendiente del banco actual: un valor por encoder, el
+    // último, que sale en su turno (rotatorio) cuando hay crédito de salida
+    uint16_t pendingMask;
+    uint16_t pendingOutput14[NUM_ENCODERS];
+    uint32_t pendingSince[NUM_ENCODERS];
+    uint32_t maxStalenessMicros[NUM_ENCODERS];
+    uint8_t nextOutputEncoder;
+    uint32_t coalescedUpdates;
+    uint32_t deferredOutputs;
+    
+    // Pistas del banco actual con valores del DAW retenidos durante el toque
+    uint16_t heldMask;
+        
+    bool confirmDawValue(uint8_t track, uint8_t bank, int8_t value);
+    void releaseHeld(uint8_t track);
+    void syncTakeover(uint8_t track, uint8_t bank);
+    int8_t scaleTowards(int8_t previous, int8_t value, int8_t target, const EncoderConfig& config) const;
+    bool isTouched(uint8_t track, uint8_t bank) const;
+    static bool isHiRes(const EncoderConfig& config);
+    static uint8_t encodeRelative(uint8_t controlType, int8_t delta);
+    void sendRelative(const EncoderConfig& config, int8_t delta, uint32_t eventTime);
+    void sendAbsolute(uint8_t encoderIndex, uint8_t bank, uint16_t output14, bool noteOn, uint32_t eventTime);
+    static uint8_t messagesPerUpdate(const EncoderConfig& config);
+    void flushOutput();
+    void recordStaleness(uint8_t encoderIndex);
+    
+    void markBankPopulated(uint8_t bank) { populatedMask |= (1UL << bank); }
+    
 public:
     EncoderManager();
     ~EncoderManager();
@@ -19,15 +80,43 @@ public:
     
     EncoderConfig getEncoderConfig(uint8_t index, uint8_t bank);
     EncoderConfig& getEncoderConfigMutable(uint8_t index, uint8_t bank);
-    EncoderConfig (*getEncoderBanks())[NUM_BANKS];
+    bool setBankCount(uint8_t count);
+    uint8_t getBankCount() const { return bankCount; }
+    bool isBankPopulated(uint8_t bank) const { return populatedMask & (1UL << bank); }
+    bool isPickupPending(uint8_t track, uint8_t bank) const;
+    
+    EncoderConfig (*getBankConfigs())[NUM_ENCODERS];
+    const EncoderConfig (*getBankConfigs() const)[NUM_ENCODERS];
+    EncoderBankState* getBankStates();
+    const EncoderBankState* getBankStates() const;
+    const EncoderBankState& getBankState(uint8_t bank) const;
+    
+    // Imagen serializada (cabecera + configuraciones + estados) para ficheros y caché
+    EncoderImageHeader getImageHeader() const;
+    bool applyImageHeader(const EncoderImageHeader& header);
+    size_t getConfigDataSize() const { return sizeof(EncoderConfig) * NUM_ENCODERS * bankCount; }
+    size_t getStateDataSize() const { return sizeof(EncoderBankState) * bankCount; }
+    size_t getImageSize() const;
+    size_t exportImage(uint8_t* buffer, size_t maxSize) const;
+    bool importImage(const uint8_t* image, size_t size);
+    
+    void recordBankSwitch(uint32_t elapsedMicros);
+    void printStatistics() const;
+    void resetStatistics();
+    uint8_t getDiagnostics(uint32_t* fields) const;
+    uint32_t getMaxStaleness(uint8_t encoderIndex) const { return maxStalenessMicros[encoderIndex]; }
     
-    void processEncoderChange(uint8_t encoderIndex, int8_t change, uint8_t bank);
+    // eventTime: micros() de la interrupción que originó el cambio (0 = ahora)
+    void processEncoderChange(uint8_t encoderIndex, int8_t change, uint8_t bank, uint32_t eventTime = 0);
+    void updateOutput();
     void processSwitchPress(uint8_t switchIndex, uint8_t bank);
     
     void syncFromDAW(uint8_t track, uint8_t bank, uint8_t value, uint16_t color);
     void setEncoderDAWValue(uint8_t track, uint8_t bank, uint8_t value);
     uint8_t getEncoderDAWValue(uint8_t track, uint8_t bank);
     void syncNameFromDAW(uint8_t track, uint8_t bank, const char* name);
+    void applyBankState(const BankStateMessage& msg);
+    void applyValueDelta(uint8_t bank, const ValueDelta& delta);
     
     void resetEncoderConfig(uint8_t index, uint8_t bank);
     void resetAllBanks();
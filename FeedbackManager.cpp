@@ -0,0 +1,259 @@
+#include "FeedbackManager.h"
+#include "MidiManager.h"
+#include "EncoderManager.h"
+
+extern MidiManager midiManager;
+extern EncoderManager encoderManager;
+
+FeedbackManager::FeedbackManager()
+  : deltasApplied(0), messagesApplied(0), duplicates(0), outOfOrder(0),
+    gapsDetected(0), rangeRequests(0), keyframeRequests(0), keyframesApplied(0),
+    windowOverflows(0), lastConvergenceMicros(0), maxConvergenceMicros(0),
+    totalConvergenceMicros(0), convergedGaps(0)
+{
+  memset(slots, 0, sizeof(slots));
+}
+
+FeedbackManager::~FeedbackManager() {}
+
+bool FeedbackManager::initialize() {
+  for (uint8_t bank = 0; bank < MAX_BANKS; bank++) {
+    banks[bank] = FeedbackBankSeq();
+  }
+  memset(slots, 0, sizeof(slots));
+  return true;
+}
+
+void FeedbackManager::onDelta(const ValueDeltaMessage& msg) {
+  if (msg.bank >= encoderManager.getBankCount()) return;
+
+  FeedbackBankSeq& seq = banks[msg.bank];
+  unsigned long now = millis();
+
+  // Sin referencia no se puede aplicar un delta: guardar y pedir fotograma clave
+  if (!seq.synced) {
+    storeMessage(msg);
+    if (!seq.keyframePending) requestKeyframe(msg.bank, now);
+    return;
+  }
+
+  uint16_t distance = StudioOneProtocol::seqDistance(seq.expected, msg.seq);
+
+  if (distance >= FEEDBACK_SEQ_HALF) {
+    duplicates++;   // Anterior a la esperada: ya aplicado
+    return;
+  }
+
+  if (distance == 0) {
+    applyMessage(msg);
+    seq.expected = (seq.expected + 1) & FEEDBACK_SEQ_MASK;
+    seq.bufferedMask >>= 1;
+    drain(msg.bank);
+    return;
+  }
+
+  if (distance >= FEEDBACK_WINDOW) {
+    // Demasiado lejos para rellenar por rangos
+    windowOverflows++;
+    releaseSlots(msg.bank);
+    seq.bufferedMask = 0;
+    if (!seq.gapStartMicros) {
+      seq.gapStartMicros = micros();
+      gapsDetected++;
+    }
+    requestKeyframe(msg.bank, now);
+    return;
+  }
+
+  if (seq.bufferedMask & (1UL << distance)) {
+    duplicates++;
+    return;
+  }
+
+  if (!storeMessage(msg)) {
+    windowOverflows++;
+    requestKeyframe(msg.bank, now);
+    return;
+  }
+  outOfOrder++;
+  seq.bufferedMask |= (1UL << distance);
+
+  // Hueco nuevo: pedir ya los rangos que faltan
+  if (!seq.gapStartMicros) {
+    seq.gapStartMicros = micros();
+    seq.resendAttempts = 0;
+    gapsDetected++;
+    requestMissingRanges(msg.bank, now);
+  }
+}
+
+void FeedbackManager::onKeyframe(uint8_t bank, uint16_t seqNumber) {
+  if (bank >= MAX_BANKS) return;
+
+  FeedbackBankSeq& seq = banks[bank];
+  seq.synced = true;
+  seq.keyframePending = false;
+  seq.resendAttempts = 0;
+  seq.expected = (seqNumber + 1) & FEEDBACK_SEQ_MASK;
+  seq.bufferedMask = 0;
+  keyframesApplied++;
+
+  // Conservar solo lo guardado posterior al fotograma clave
+  for (uint8_t i = 0; i < FEEDBACK_REORDER_SLOTS; i++) {
+    FeedbackSlot& slot = slots[i];
+    if (!slot.used || slot.msg.bank != bank) continue;
+
+    uint16_t distance = StudioOneProtocol::seqDistance(seq.expected, slot.msg.seq);
+    if (distance >= FEEDBACK_WINDOW) {
+      slot.used = false;
+    } else {
+      seq.bufferedMask |= (1UL << distance);
+    }
+  }
+
+  drain(bank);
+}
+
+void FeedbackManager::drain(uint8_t bank) {
+  FeedbackBankSeq& seq = banks[bank];
+
+  while (seq.bufferedMask & 1) {
+    FeedbackSlot* slot = findSlot(bank, seq.expected);
+    if (slot) {
+      applyMessage(slot->msg);
+      slot->used = false;
+    }
+    seq.expected = (seq.expected + 1) & FEEDBACK_SEQ_MASK;
+    seq.bufferedMask >>= 1;
+  }
+
+  checkConverged(bank);
+}
+
+void FeedbackManager::checkConverged(uint8_t bank) {
+  FeedbackBankSeq& seq = banks[bank];
+  if (!seq.gapStartMicros || seq.bufferedMask || seq.keyframePending) return;
+
+  // Hueco cerrado: todo lo recibido está aplicado y en orden
+  lastConvergenceMicros = micros() - seq.gapStartMicros;
+  if (lastConvergenceMicros > maxConvergenceMicros) {
+    maxConvergenceMicros = lastConvergenceMicros;
+  }
+  totalConvergenceMicros += lastConvergenceMicros;
+  convergedGaps++;
+  seq.gapStartMicros = 0;
+  seq.resendAttempts = 0;
+}
+
+void FeedbackManager::applyMessage(const ValueDeltaMessage& msg) {
+  for (uint8_t i = 0; i < msg.count; i++) {
+    encoderManager.applyValueDelta(msg.bank, msg.deltas[i]);
+  }
+  deltasApplied += msg.count;
+  messagesApplied++;
+}
+
+bool FeedbackManager::storeMessage(const ValueDeltaMessage& msg) {
+  if (findSlot(msg.bank, msg.seq)) return true;
+
+  for (uint8_t i = 0; i < FEEDBACK_REORDER_SLOTS; i++) {
+    if (!slots[i].used) {
+      slots[i].used = true;
+      slots[i].msg = msg;
+      return true;
+    }
+  }
+  return false;
+}
+
+FeedbackSlot* FeedbackManager::findSlot(uint8_t bank, uint16_t seq) {
+  for (uint8_t i = 0; i < FEEDBACK_REORDER_SLOTS; i++) {
+    if (slots[i].used && slots[i].msg.bank == bank && slots[i].msg.seq == seq) {
+      return &slots[i];
+    }
+  }
+  return nullptr;
+}
+
+void FeedbackManager::releaseSlots(uint8_t bank) {
+  for (uint8_t i = 0; i < FEEDBACK_REORDER_SLOTS; i++) {
+    if (slots[i].used && slots[i].msg.bank == bank) slots[i].used = false;
+  }
+}
+
+void FeedbackManager::requestKeyframe(uint8_t bank, unsigned long now) {
+  banks[bank].keyframePending = true;
+  if (midiManager.getSysExSlotsFree() == 0) return;   // Se reintenta en update()
+
+  midiManager.sendStudioOneBankStateRequest(bank, BANK_STATE_VALUES | BANK_STATE_SEQ);
+  banks[bank].lastRequest = now;
+  keyframeRequests++;
+}
+
+// Una petición por cada hueco entre la secuencia esperada y la última guardada
+void FeedbackManager::requestMissingRanges(uint8_t bank, unsigned long now) {
+  FeedbackBankSeq& seq = banks[bank];
+  uint32_t mask = seq.bufferedMask;
+  uint8_t offset = 0;
+
+  while (mask && offset < FEEDBACK_WINDOW) {
+    if (mask & (1UL << offset)) {
+      offset++;
+      continue;
+    }
+
+    uint8_t holeEnd = offset;
+    while (holeEnd + 1 < FEEDBACK_WINDOW && !(mask & (1UL << (holeEnd + 1)))) holeEnd++;
+
+    // Un hueco sin nada guardado detrás no es hueco: es el final de la ventana
+    if (holeEnd + 1 >= FEEDBACK_WINDOW || !(mask >> (holeEnd + 1))) break;
+    if (midiManager.getSysExSlotsFree() == 0) break;
+
+    midiManager.sendStudioOneResendRequest(bank,
+                                           (seq.expected + offset) & FEEDBACK_SEQ_MASK,
+                                           (seq.expected + holeEnd) & FEEDBACK_SEQ_MASK);
+    rangeRequests++;
+    offset = holeEnd + 1;
+  }
+
+  seq.lastRequest = now;
+  seq.resendAttempts++;
+}
+
+void FeedbackManager::update() {
+  unsigned long now = millis();
+  uint8_t bankCount = encoderManager.getBankCount();
+
+  for (uint8_t bank = 0; bank < bankCount; bank++) {
+    FeedbackBankSeq& seq = banks[bank];
+    if (now - seq.lastRequest < FEEDBACK_RESEND_RETRY_MS) continue;
+
+    if (seq.keyframePending) {
+      requestKeyframe(bank, now);
+    } else if (seq.gapStartMicros && seq.bufferedMask) {
+      if (seq.resendAttempts >= FEEDBACK_MAX_RESENDS) {
+        requestKeyframe(bank, now);
+      } else {
+        requestMissingRanges(bank, now);
+      }
+    }
+  }
+}
+
+void FeedbackManager::printStatistics() const {
+  Serial.println(F("\n=== REALIMENTACIÓN DAW ==="));
+  Serial.print(F("Mensajes aplicados: ")); Serial.print(messagesApplied);
+  Serial.print(F(" | deltas ")); Serial.println(deltasApplied);
+  Serial.print(F("Fuera de orden: ")); Serial.print(outOfOrder);
+  Serial.print(F(" | duplicados ")); Serial.println(duplicates);
+  Serial.print(F("Huecos: ")); Serial.print(gapsDetected);
+  Serial.print(F(" | peticiones de rango ")); Serial.println(rangeRequests);
+  Serial.print(F("Fotogramas clave: ")); Serial.print(keyframesApplied);
+  Serial.print(F("/")); Serial.print(keyframeRequests);
+  Serial.print(F(" | desbordes de ventana ")); Serial.println(windowOverflows);
+  Serial.print(F("Convergencia (us): ")); Serial.print(lastConvergenceMicros);
+  Serial.print(F(" | media "));
+  Serial.print(convergedGaps ? (uint32_t)(totalConvergenceMicros / convergedGaps) : 0);
+  Serial.print(F(" | máx ")); Serial.println(maxConvergenceMicros);
+  Serial.println(F("==========================\n"));
+}
@@ -0,0 +1,78 @@
+#ifndef FEEDBACK_MANAGER_H
+#define FEEDBACK_MANAGER_H
+
+#include "Config.h"
+#include "StudioOneProtocol.h"
+#include <Arduino.h>
+
+// Realimentación secuenciada del DAW: ventana de reordenación y reenvíos
+#define FEEDBACK_WINDOW             32    // Secuencias por delante de la esperada que se guardan
+#define FEEDBACK_REORDER_SLOTS      32    // Mensajes fuera de orden guardados (todos los bancos)
+#define FEEDBACK_RESEND_RETRY_MS    100   // Reintento de una petición de rango o fotograma clave
+#define FEEDBACK_MAX_RESENDS        3     // Reenvíos por hueco antes de pedir fotograma clave
+
+struct FeedbackBankSeq {
+  uint16_t expected;        // Próxima secuencia a aplicar
+  uint32_t bufferedMask;    // Bit i: secuencia expected + i guardada en la ventana
+  bool synced;              // Hay una secuencia de referencia (fotograma clave recibido)
+  bool keyframePending;
+  uint8_t resendAttempts;
+  unsigned long lastRequest;
+  uint32_t gapStartMicros;  // 0 = sin hueco abierto
+
+  FeedbackBankSeq() : expected(0), bufferedMask(0), synced(false), keyframePending(false),
+                      resendAttempts(0), lastRequest(0), gapStartMicros(0) {}
+};
+
+struct FeedbackSlot {
+  bool used;
+  ValueDeltaMessage msg;
+};
+
+class FeedbackManager {
+private:
+  FeedbackBankSeq banks[MAX_BANKS];
+  FeedbackSlot slots[FEEDBACK_REORDER_SLOTS];
+
+  // Estadísticas
+  uint32_t deltasApplied;
+  uint32_t messagesApplied;
+  uint32_t duplicates;
+  uint32_t outOfOrder;
+  uint32_t gapsDetected;
+  uint32_t rangeRequests;
+  uint32_t keyframeRequests;
+  uint32_t keyframesApplied;
+  uint32_t windowOverflows;
+  uint32_t lastConvergenceMicros;
+  uint32_t maxConvergenceMicros;
+  uint64_t totalConvergenceMicros;
+  uint32_t convergedGaps;
+
+  void applyMessage(const ValueDeltaMessage& msg);
+  bool storeMessage(const ValueDeltaMessage& msg);
+  FeedbackSlot* findSlot(uint8_t bank, uint16_t seq);
+  void releaseSlots(uint8_t bank);
+  void drain(uint8_t bank);
+  void checkConverged(uint8_t bank);
+  void requestKeyframe(uint8_t bank, unsigned long now);
+  void requestMissingRanges(uint8_t bank, unsigned long now);
+
+public:
+  FeedbackManager();
+  ~FeedbackManager();
+
+  bool initialize();
+  void update();
+
+  void onDelta(const ValueDeltaMessage& msg);
+  void onKeyframe(uint8_t bank, uint16_t seq);
+
+  bool isBankSynced(uint8_t bank) const { return bank < MAX_BANKS && banks[bank].synced; }
+  uint32_t getLastConvergenceMicros() const { return lastConvergenceMicros; }
+  void printStatistics() const;
+};
+
+extern FeedbackManager feedbackManager;
+
+#endif // FEEDBACK_MANAGER_H
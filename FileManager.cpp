@@ -1,11 +1,13 @@
 #include "FileManager.h"
 #include "Config.h"
+#include "LogManager.h"
+#include "SpiBusManager.h"
+#include "EncoderManager.h"
 
 FileManager::FileManager() 
   : sdInitialized(false), sdCardPresent(false), totalSpace(0), freeSpace(0),
     loggingEnabled(false)
 {
-  strcpy(logFilename, "sys.log");
 }
 
 FileManager::~FileManager() {}
@@ -13,10 +15,11 @@ FileManager::~FileManager() {}
 bool FileManager::initialize() {
   Serial.println(F("Inicializando sistema de archivos SD..."));
   
-  SPI.begin(SD_SCLK, SD_MISO, SD_MOSI, SD_CS);
+  // El bus ya lo ha inicializado SpiBusManager (compartido con la pantalla)
+  SpiBusLock busLock(SPI_DEVICE_SD);
   
   for (int retry = 0; retry < SD_RETRY_COUNT; retry++) {
-    if (SD.begin(SD_CS, SPI, 4000000)) {
+    if (SD.begin(SD_CS, spiBusManager.getBus(), spiBusManager.getClock(SPI_DEVICE_SD))) {
       sdInitialized = true;
       sdCardPresent = true;
       break;
@@ -83,7 +86,8 @@ bool FileManager::initializeDirectories() {
   return true;
 }
 
-bool FileManager::saveConfiguration(const AppConfig& config, const EncoderConfig encoders[NUM_ENCODERS][NUM_BANKS]) {
+bool FileManager::saveConfiguration(const AppConfig& config, const EncoderManager& encoders) {
+  SpiBusLock busLock(SPI_DEVICE_SD);
   Serial.println(F("Guardando configuración..."));
   
   if (fileExists(CONFIG_FILENAME)) {
@@ -91,7 +95,7 @@ bool FileManager::saveConfiguration(const AppConfig& config, const EncoderConfig
   }
   
   ConfigFileHeader header;
-  header.dataSize = sizeof(AppConfig) + sizeof(EncoderConfig) * NUM_ENCODERS * NUM_BANKS;
+  header.dataSize = sizeof(AppConfig) + encoders.getImageSize();
   header.timestamp = millis() / 1000;
   
   File configFile = SD.open(CONFIG_FILENAME, FILE_WRITE);
@@ -112,8 +116,7 @@ bool FileManager::saveConfiguration(const AppConfig& config, const EncoderConfig
     return false;
   }
   
-  size_t encoderDataSize = sizeof(EncoderConfig) * NUM_ENCODERS * NUM_BANKS;
-  if (configFile.write((const uint8_t*)encoders, encoderDataSize) != encoderDataSize) {
+  if (!writeEncoderImage(configFile, encoders)) {
     configFile.close();
     logError("write encoder config");
     return false;
@@ -131,7 +134,8 @@ bool FileManager::saveConfiguration(const AppConfig& config, const EncoderConfig
   return true;
 }
 
-bool FileManager::loadConfiguration(AppConfig& config, EncoderConfig encoders[NUM_ENCODERS][NUM_BANKS]) {
+bool FileManager::loadConfiguration(AppConfig& config, EncoderManager& encoders) {
+  SpiBusLock busLock(SPI_DEVICE_SD);
   Serial.println(F("Cargando configuración..."));
   
   if (!fileExists(CONFIG_FILENAME)) {
@@ -171,18 +175,44 @@ bool FileManager::loadConfiguration(AppConfig& config, EncoderConfig encoders[NU
     return false;
   }
   
-  size_t encoderDataSize = sizeof(EncoderConfig) * NUM_ENCODERS * NUM_BANKS;
-  if (configFile.read((uint8_t*)encoders, encoderDataSize) != encoderDataSize) {
+  if (!readEncoderImage(configFile, encoders)) {
     configFile.close();
     logError("read encoder config");
     return false;
   }
   
   configFile.close();
+  config.bankCount = encoders.getBankCount();
   logSuccess("load configuration");
   return true;
 }
 
+// Cabecera de la tabla + configuraciones + estados, escritos directamente
+// desde las tablas contiguas de EncoderManager
+bool FileManager::writeEncoderImage(File& file, const EncoderManager& encoders) {
+  EncoderImageHeader header = encoders.getImageHeader();
+  size_t configSize = encoders.getConfigDataSize();
+  size_t stateSize = encoders.getStateDataSize();
+  
+  return file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+         file.write((const uint8_t*)encoders.getBankConfigs(), configSize) == configSize &&
+         file.write((const uint8_t*)encoders.getBankStates(), stateSize) == stateSize;
+}
+
+bool FileManager::readEncoderImage(File& file, EncoderManager& encoders) {
+  EncoderImageHeader header;
+  if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+      !encoders.applyImageHeader(header)) {
+    return false;
+  }
+  
+  size_t configSize = encoders.getConfigDataSize();
+  size_t stateSize = encoders.getStateDataSize();
+  
+  return file.read((uint8_t*)encoders.getBankConfigs(), configSize) == configSize &&
+         file.read((uint8_t*)encoders.getBankStates(), stateSize) == stateSize;
+}
+
 // ... (resto de métodos de FileManager)
 
 void FileManager::logError(const char* operation, const char* filename) {
@@ -221,10 +251,12 @@ void FileManager::logSuccess(const char* operation, const char* filename) {
 
 
 bool FileManager::createDirectory(const char* path) {
+    SpiBusLock busLock(SPI_DEVICE_SD);
     return SD.mkdir(path);
 }
 
 bool FileManager::writeFile(const char* filename, const void* data, size_t size) {
+    SpiBusLock busLock(SPI_DEVICE_SD);
     File file = SD.open(filename, FILE_WRITE);
     if (!file) return false;
     
@@ -235,6 +267,7 @@ bool FileManager::writeFile(const char* filename, const void* data, size_t size)
 }
 
 bool FileManager::readFile(const char* filename, void* data, size_t maxSize, size_t* actualSize) {
+    SpiBusLock busLock(SPI_DEVICE_SD);
     File file = SD.open(filename, FILE_READ);
     if (!file) return false;
     
@@ -246,14 +279,17 @@ bool FileManager::readFile(const char* filename, void* data, size_t maxSize, siz
 }
 
 bool FileManager::deleteFile(const char* filename) {
+    SpiBusLock busLock(SPI_DEVICE_SD);
     return SD.remove(filename);
 }
 
 bool FileManager::fileExists(const char* filename) {
+    SpiBusLock busLock(SPI_DEVICE_SD);
     return SD.exists(filename);
 }
 
 void FileManager::updateSpaceInfo() {
+    SpiBusLock busLock(SPI_DEVICE_SD);
     totalSpace = SD.totalBytes();
     freeSpace = SD.usedBytes();
 }
@@ -267,6 +303,7 @@ bool FileManager::readFileHeader(File& file, ConfigFileHeader& header) {
 }
 
 bool FileManager::verifyFileIntegrity(const char* filename) {
+    SpiBusLock busLock(SPI_DEVICE_SD);
     File file = SD.open(filename, FILE_READ);
     if (!file) return false;
     
@@ -281,6 +318,7 @@ bool FileManager::verifyFileIntegrity(const char* filename) {
 }
 
 void FileManager::createBackup(const char* filename) {
+    SpiBusLock busLock(SPI_DEVICE_SD);
     String backupName = String(filename) + BACKUP_EXTENSION;
     if (fileExists(backupName.c_str())) {
         deleteFile(backupName.c_str());
@@ -304,6 +342,7 @@ void FileManager::createBackup(const char* filename) {
 }
 
 bool FileManager::restoreFromBackup(const char* filename) {
+    SpiBusLock busLock(SPI_DEVICE_SD);
     String backupName = String(filename) + BACKUP_EXTENSION;
     if (!fileExists(backupName.c_str())) return false;
     
@@ -330,23 +369,29 @@ bool FileManager::restoreFromBackup(const char* filename) {
 bool FileManager::writeLogEntry(const char* message) {
     if (!loggingEnabled) return true;
     
-    char logPath[64];
-    snprintf(logPath, sizeof(logPath), "%s/%s", LOG_DIRECTORY, logFilename);
-    
-    File file = SD.open(logPath, FILE_APPEND);
+    // El texto pasa al log binario; LogManager lo vuelca a /logs por bloques
+    logManager.logText(LOG_LEVEL_INFO, message);
+    return true;
+}
+
+bool FileManager::enableLogging(bool enable) {
+    loggingEnabled = enable;
+    return true;
+}
+
+bool FileManager::appendToFile(const char* filename, const void* data, size_t size) {
+    SpiBusLock busLock(SPI_DEVICE_SD);
+    File file = SD.open(filename, FILE_APPEND);
     if (!file) return false;
     
-    unsigned long timestamp = millis() / 1000;
-    char logEntry[128];
-    snprintf(logEntry, sizeof(logEntry), "[%lu] %s\n", timestamp, message);
-    
-    bool success = file.write((const uint8_t*)logEntry, strlen(logEntry)) == strlen(logEntry);
+    size_t bytesWritten = file.write((const uint8_t*)data, size);
     file.close();
     
-    return success;
+    return bytesWritten == size;
 }
 
-bool FileManager::loadPreset(const char* presetName, EncoderConfig encoders[NUM_ENCODERS][NUM_BANKS]) {
+bool FileManager::loadPreset(const char* presetName, EncoderManager& encoders) {
+    SpiBusLock busLock(SPI_DEVICE_SD);
     char presetPath[64];
     snprintf(presetPath, sizeof(presetPath), "%s/%s.prs", PRESET_DIRECTORY, presetName);
     
@@ -355,26 +400,28 @@ bool FileManager::loadPreset(const char* presetName, EncoderConfig encoders[NUM_
     File file = SD.open(presetPath, FILE_READ);
     if (!file) return false;
     
-    size_t bytesRead = file.read((uint8_t*)encoders, sizeof(EncoderConfig) * NUM_ENCODERS * NUM_BANKS);
+    bool loaded = readEncoderImage(file, encoders);
     file.close();
     
-    return bytesRead == sizeof(EncoderConfig) * NUM_ENCODERS * NUM_BANKS;
+    return loaded;
 }
 
-bool FileManager::savePreset(const char* presetName, const EncoderConfig encoders[NUM_ENCODERS][NUM_BANKS]) {
+bool FileManager::savePreset(const char* presetName, const EncoderManager& encoders) {
+    SpiBusLock busLock(SPI_DEVICE_SD);
     char presetPath[64];
     snprintf(presetPath, sizeof(presetPath), "%s/%s.prs", PRESET_DIRECTORY, presetName);
     
     File file = SD.open(presetPath, FILE_WRITE);
     if (!file) return false;
     
-    size_t bytesWritten = file.write((const uint8_t*)encoders, sizeof(EncoderConfig) * NUM_ENCODERS * NUM_BANKS);
+    bool saved = writeEncoderImage(file, encoders);
     file.close();
     
-    return bytesWritten == sizeof(EncoderConfig) * NUM_ENCODERS * NUM_BANKS;
+    return saved;
 }
 
 bool FileManager::resetConfiguration() {
+    SpiBusLock busLock(SPI_DEVICE_SD);
     // Reset configuration to defaults
     if (fileExists(CONFIG_FILENAME)) {
         deleteFile(CONFIG_FILENAME);
@@ -391,4 +438,40 @@ bool FileManager::resetConfiguration() {
 
 bool FileManager::checkSDHealth() {
     return sdInitialized && sdCardPresent;
-}
\ No newline at end of file
+}
+uint32_t FileManager::getFileSize(const char* filename) {
+    SpiBusLock busLock(SPI_DEVICE_SD);
+    File file = SD.open(filename, FILE_READ);
+    if (!file) return 0;
+    
+    uint32_t size = file.size();
+    file.close();
+    return size;
+}
+
+uint8_t FileManager::listPresets(char presetNames[][MAX_PRESET_NAME], uint8_t maxPresets) {
+    SpiBusLock busLock(SPI_DEVICE_SD);
+    File dir = SD.open(PRESET_DIRECTORY);
+    if (!dir || !dir.isDirectory()) return 0;
+    
+    uint8_t count = 0;
+    File entry = dir.openNextFile();
+    while (entry && count < maxPresets) {
+        if (!entry.isDirectory()) {
+            const char* name = entry.name();
+            const char* ext = strrchr(name, '.');
+            
+            if (ext && strcmp(ext, ".prs") == 0) {
+                size_t nameLength = min((size_t)(ext - name), (size_t)(MAX_PRESET_NAME - 1));
+                memcpy(presetNames[count], name, nameLength);
+                presetNames[count][nameLength] = '\0';
+                count++;
+            }
+        }
+        entry.close();
+        entry = dir.openNextFile();
+    }
+    
+    dir.close();
+    return count;
+}
@@ -5,6 +5,8 @@
 #include <SD.h>
 #include <SPI.h>
 
+class EncoderManager;
+
 #define CONFIG_FILENAME        "config.cfg"
 #define BACKUP_EXTENSION       ".bak"
 #define PRESET_DIRECTORY       "/presets"
@@ -13,7 +15,7 @@
 
 #define MAX_FILENAME_LENGTH    12
 #define MAX_PRESET_NAME        12
-#define CONFIG_VERSION         1
+#define CONFIG_VERSION         9
 #define SD_RETRY_COUNT         3
 
 struct ConfigFileHeader {
@@ -57,6 +59,8 @@ private:
   bool writeFileHeader(File& file, const ConfigFileHeader& header);
   bool readFileHeader(File& file, ConfigFileHeader& header);
   bool verifyFileIntegrity(const char* filename);
+  bool writeEncoderImage(File& file, const EncoderManager& encoders);
+  bool readEncoderImage(File& file, EncoderManager& encoders);
   
   void createBackup(const char* filename);
   bool restoreFromBackup(const char* filename);
@@ -72,16 +76,12 @@ public:
   bool checkSDHealth();
   void reinitializeSD();
   
-  bool saveConfiguration(const AppConfig& config, 
-                        const EncoderConfig encoders[NUM_ENCODERS][NUM_BANKS]);
-  bool loadConfiguration(AppConfig& config, 
-                        EncoderConfig encoders[NUM_ENCODERS][NUM_BANKS]);
+  bool saveConfiguration(const AppConfig& config, const EncoderManager& encoders);
+  bool loadConfiguration(AppConfig& config, EncoderManager& encoders);
   bool resetConfiguration();
   
-  bool savePreset(const char* presetName, 
-                 const EncoderConfig encoders[NUM_ENCODERS][NUM_BANKS]);
-  bool loadPreset(const char* presetName, 
-                 EncoderConfig encoders[NUM_ENCODERS][NUM_BANKS]);
+  bool savePreset(const char* presetName, const EncoderManager& encoders);
+  bool loadPreset(const char* presetName, EncoderManager& encoders);
   bool deletePreset(const char* presetName);
   bool renamePreset(const char* oldName, const char* newName);
   
@@ -110,8 +110,6 @@ public:
   //  void createBackup(const char* filename);
   //  bool restoreFromBackup(const char* filename);
    // bool writeLogEntry(const char* message);
-  //  bool loadPreset(const char* presetName, EncoderConfig encoders[NUM_ENCODERS][NUM_BANKS]);
-  //  bool savePreset(const char* presetName, const EncoderConfig encoders[NUM_ENCODERS][NUM_BANKS]);
  //   bool resetConfiguration();
  //   bool checkSDHealth();
 
@@ -147,7 +145,6 @@ public:
   
 private:
   bool loggingEnabled;
-  char logFilename[MAX_FILENAME_LENGTH];
 };
 
 #endif // FILE_MANAGER_H
\ No newline at end of file
@@ -0,0 +1,51 @@
+#include "GlyphAtlas.h"
+#include <Adafruit_GFX.h>
+
+GlyphAtlas::GlyphAtlas() : built(false) {
+  memset(columns, 0, sizeof(columns));
+}
+
+// La fuente de Adafruit_GFX no es accesible desde fuera: se dibuja cada
+// carácter en un canvas de 1 bit y se leen sus píxeles
+bool GlyphAtlas::build() {
+  if (built) return true;
+
+  GFXcanvas1 canvas(GLYPH_WIDTH, GLYPH_HEIGHT);
+  if (!canvas.getBuffer()) {
+    Serial.println(F("ERROR: Sin memoria para rasterizar la fuente"));
+    return false;
+  }
+
+  for (uint16_t c = 0; c < GLYPH_COUNT; c++) {
+    canvas.fillScreen(0);
+    canvas.drawChar(0, 0, (unsigned char)c, 1, 0, 1);
+    for (uint8_t x = 0; x < GLYPH_WIDTH; x++) {
+      uint8_t bits = 0;
+      for (uint8_t y = 0; y < GLYPH_HEIGHT; y++) {
+        if (canvas.getPixel(x, y)) bits |= 1 << y;
+      }
+      columns[c][x] = bits;
+    }
+  }
+
+  built = true;
+  return true;
+}
+
+uint16_t GlyphAtlas::renderRow(const char* text, uint8_t length, uint8_t size, uint8_t row,
+                               uint16_t color, uint16_t bg, uint16_t* out, uint16_t maxPixels) const {
+  uint16_t count = 0;
+  uint8_t mask = 1 << row;
+
+  for (uint8_t i = 0; i < length; i++) {
+    const uint8_t* glyph = columns[(uint8_t)text[i]];
+    for (uint8_t x = 0; x < GLYPH_WIDTH; x++) {
+      uint16_t pixel = (glyph[x] & mask) ? color : bg;
+      for (uint8_t s = 0; s < size; s++) {
+        if (count >= maxPixels) return count;
+        out[count++] = pixel;
+      }
+    }
+  }
+  return count;
+}
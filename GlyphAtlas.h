@@ -0,0 +1,34 @@
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include <Arduino.h>
+
+// Fuente clásica 5x7 de Adafruit_GFX rasterizada una sola vez a columnas de
+// bits (1,5 KB). Con ella se compone el texto fila a fila directamente en
+// RGB565, sin pasar por drawChar (un rectángulo por píxel encendido), para
+// volcar cada campo de texto en una sola ventana de direcciones.
+#define GLYPH_WIDTH     6    // 5 columnas + separación
+#define GLYPH_HEIGHT    8
+#define GLYPH_COUNT     256
+
+class GlyphAtlas {
+private:
+  uint8_t columns[GLYPH_COUNT][GLYPH_WIDTH];   // bit n = fila n
+  bool built;
+
+public:
+  GlyphAtlas();
+
+  bool build();
+  bool isBuilt() const { return built; }
+
+  static uint16_t textWidth(uint8_t length, uint8_t size) { return length * GLYPH_WIDTH * size; }
+  static uint16_t textHeight(uint8_t size) { return GLYPH_HEIGHT * size; }
+
+  // Compone la fila 'row' (0-7) de la fuente, escalada en horizontal, en out.
+  // Devuelve los píxeles escritos (como mucho maxPixels)
+  uint16_t renderRow(const char* text, uint8_t length, uint8_t size, uint8_t row,
+                     uint16_t color, uint16_t bg, uint16_t* out, uint16_t maxPixels) const;
+};
+
+#endif // GLYPH_ATLAS_H
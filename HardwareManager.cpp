@@ -2,7 +2,7 @@
 #include "Config.h"
 
 // Declaración de funciones de callback externas
-extern void onEncoderChange(uint8_t encoderIndex, int8_t change);
+extern void onEncoderChange(uint8_t encoderIndex, int8_t change, uint32_t eventTime);
 extern void onSwitchPress(uint8_t switchIndex);
 extern void onButtonPress(uint8_t buttonIndex);
 extern void onNavigationEncoderChange(int8_t change);
@@ -97,7 +97,7 @@ void HardwareManager::setupInterrupts() {
   Serial.println(F("Interrupciones configuradas"));
 }
 
-void HardwareManager::processMCP1AEncoders() {
+void HardwareManager::processMCP1AEncoders(uint32_t eventTime) {
   uint16_t interruptPins = mcpEncodersVol.getCapturedInterrupt();
   
   for (int i = 0; i < 8; i++) {
@@ -105,12 +105,12 @@ void HardwareManager::processMCP1AEncoders() {
     int pinB = i * 2 + 1;
     
     if ((interruptPins & (1 << pinA)) || (interruptPins & (1 << pinB))) {
-      processEncoder(0, i, mcpEncodersVol);
+      processEncoder(0, i, mcpEncodersVol, eventTime);
     }
   }
 }
 
-void HardwareManager::processMCP1BEncoders() {
+void HardwareManager::processMCP1BEncoders(uint32_t eventTime) {
   uint16_t interruptPins = mcpEncodersVol.getCapturedInterrupt();
   
   for (int i = 8; i < 16; i++) {
@@ -118,12 +118,12 @@ void HardwareManager::processMCP1BEncoders() {
     int pinB = (i - 8) * 2 + 9;
     
     if ((interruptPins & (1 << pinA)) || (interruptPins & (1 << pinB))) {
-      processEncoder(0, i, mcpEncodersVol);
+      processEncoder(0, i, mcpEncodersVol, eventTime);
     }
   }
 }
 
-void HardwareManager::processMCP2AEncoders() {
+void HardwareManager::processMCP2AEncoders(uint32_t eventTime) {
   uint16_t interruptPins = mcpEncodersPan.getCapturedInterrupt();
   
   for (int i = 0; i < 8; i++) {
@@ -131,12 +131,12 @@ void HardwareManager::processMCP2AEncoders() {
     int pinB = i * 2 + 1;
     
     if ((interruptPins & (1 << pinA)) || (interruptPins & (1 << pinB))) {
-      processEncoder(1, i, mcpEncodersPan);
+      processEncoder(1, i, mcpEncodersPan, eventTime);
     }
   }
 }
 
-void HardwareManager::processMCP2BEncoders() {
+void HardwareManager::processMCP2BEncoders(uint32_t eventTime) {
   uint16_t interruptPins = mcpEncodersPan.getCapturedInterrupt();
   
   for (int i = 8; i < 16; i++) {
@@ -144,12 +144,12 @@ void HardwareManager::processMCP2BEncoders() {
     int pinB = (i - 8) * 2 + 9;
     
     if ((interruptPins & (1 << pinA)) || (interruptPins & (1 << pinB))) {
-      processEncoder(1, i, mcpEncodersPan);
+      processEncoder(1, i, mcpEncodersPan, eventTime);
     }
   }
 }
 
-void HardwareManager::processEncoder(int mcpIndex, int encoderIndex, Adafruit_MCP23X17& mcp) {
+void HardwareManager::processEncoder(int mcpIndex, int encoderIndex, Adafruit_MCP23X17& mcp, uint32_t eventTime) {
   int pinA, pinB;
   if (encoderIndex < 8) {
     pinA = encoderIndex * 2;
@@ -177,7 +177,7 @@ void HardwareManager::processEncoder(int mcpIndex, int encoderIndex, Adafruit_MC
     int threshold = 4 / acceleration;
     if (abs(encoderValue[encoderIndex]) >= threshold) {
       int8_t finalChange = (encoderValue[encoderIndex] > 0) ? acceleration : -acceleration;
-      onEncoderChange(encoderIndex, finalChange);
+      onEncoderChange(encoderIndex, finalChange, eventTime);
       encoderValue[encoderIndex] = 0;
     }
   }
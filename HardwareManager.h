@@ -30,7 +30,7 @@ private:
   void configureEncoderMCP(Adafruit_MCP23X17& mcp, uint8_t intPinA, uint8_t intPinB);
   void configureSwitchMCP(Adafruit_MCP23X17& mcp);
   
-  void processEncoder(int mcpIndex, int encoderIndex, Adafruit_MCP23X17& mcp);
+  void processEncoder(int mcpIndex, int encoderIndex, Adafruit_MCP23X17& mcp, uint32_t eventTime);
   int8_t calculateEncoderChange(int8_t encoded, int8_t lastEncoded);
   uint8_t calculateAcceleration(unsigned long timeDiff);
   
@@ -45,10 +45,11 @@ public:
   bool initialize();
   void setupInterrupts();
   
-  void processMCP1AEncoders();
-  void processMCP1BEncoders();  
-  void processMCP2AEncoders();
-  void processMCP2BEncoders();
+  // eventTime: micros() de la interrupción, se propaga con cada cambio
+  void processMCP1AEncoders(uint32_t eventTime);
+  void processMCP1BEncoders(uint32_t eventTime);
+  void processMCP2AEncoders(uint32_t eventTime);
+  void processMCP2BEncoders(uint32_t eventTime);
   
   void pollSwitchesAndButtons();
   void readNavigationEncoder();
@@ -0,0 +1,61 @@
+#include "LatencyHistogram.h"
+
+LatencyHistogram::LatencyHistogram() {
+  reset();
+}
+
+// 0-3 us: un cubo por valor; después, octava del bit alto y los dos bits siguientes
+uint8_t LatencyHistogram::bucketFor(uint32_t micros) {
+  if (micros < LATENCY_SUB_BUCKETS) return micros;
+  if (micros > LATENCY_MAX_MICROS) return LATENCY_BUCKETS - 1;
+
+  uint8_t msb = 31 - __builtin_clz(micros);
+  uint8_t sub = (micros >> (msb - 2)) & (LATENCY_SUB_BUCKETS - 1);
+  return (msb - 1) * LATENCY_SUB_BUCKETS + sub;
+}
+
+uint32_t LatencyHistogram::bucketUpperBound(uint8_t bucket) {
+  if (bucket < LATENCY_SUB_BUCKETS) return bucket;
+
+  uint8_t msb = bucket / LATENCY_SUB_BUCKETS + 1;
+  uint8_t sub = bucket % LATENCY_SUB_BUCKETS;
+  uint32_t width = 1UL << (msb - 2);
+  return (LATENCY_SUB_BUCKETS + sub) * width + width - 1;
+}
+
+void LatencyHistogram::record(uint32_t micros) {
+  buckets[bucketFor(micros)]++;
+  count++;
+  if (micros > maxMicros) maxMicros = micros;
+}
+
+uint32_t LatencyHistogram::percentile(uint8_t pct) const {
+  if (count == 0) return 0;
+
+  // Posición del percentil, redondeando hacia arriba (p100 = último)
+  uint32_t target = ((uint64_t)count * pct + 99) / 100;
+  if (target == 0) target = 1;
+
+  uint32_t seen = 0;
+  for (uint8_t i = 0; i < LATENCY_BUCKETS; i++) {
+    seen += buckets[i];
+    if (seen >= target) return min(bucketUpperBound(i), maxMicros);
+  }
+  return maxMicros;
+}
+
+void LatencyHistogram::print(const char* label) const {
+  Serial.print(label);
+  Serial.print(F(": ")); Serial.print(count);
+  Serial.print(F(" | p50 ")); Serial.print(percentile(50));
+  Serial.print(F(" | p95 ")); Serial.print(percentile(95));
+  Serial.print(F(" | p99 ")); Serial.print(percentile(99));
+  Serial.print(F(" | max ")); Serial.print(maxMicros);
+  Serial.println(F(" us"));
+}
+
+void LatencyHistogram::reset() {
+  memset(buckets, 0, sizeof(buckets));
+  count = 0;
+  maxMicros = 0;
+}
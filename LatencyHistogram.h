@@ -0,0 +1,35 @@
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <Arduino.h>
+
+// Histograma de latencias en microsegundos con cubos logarítmicos: 4 por
+// octava (error máximo ~12%), de 0 us a ~2 s, en 320 bytes. Registrar cuesta
+// un clz y una suma; los percentiles recorren los cubos.
+#define LATENCY_SUB_BUCKETS    4
+#define LATENCY_BUCKETS        80     // (21 - 1) octavas x 4
+#define LATENCY_MAX_MICROS     ((1UL << 21) - 1)
+
+class LatencyHistogram {
+private:
+  uint32_t buckets[LATENCY_BUCKETS];
+  uint32_t count;
+  uint32_t maxMicros;
+
+  static uint8_t bucketFor(uint32_t micros);
+  static uint32_t bucketUpperBound(uint8_t bucket);
+
+public:
+  LatencyHistogram();
+
+  void record(uint32_t micros);
+  // Límite superior del cubo que contiene el percentil (acotado al máximo visto)
+  uint32_t percentile(uint8_t pct) const;
+
+  uint32_t getCount() const { return count; }
+  uint32_t getMax() const { return maxMicros; }
+  void print(const char* label) const;
+  void reset();
+};
+
+#endif // LATENCY_HISTOGRAM_H
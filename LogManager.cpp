@@ -0,0 +1,168 @@
+#include "LogManager.h"
+#include "FileManager.h"
+
+extern FileManager fileManager;
+
+LogManager::LogManager()
+  : ringHead(0), ringTail(0), runtimeLevel(LOG_LEVEL_INFO),
+    lastFlushTime(0), droppedRecords(0), reportedDrops(0), totalRecords(0), bytesFlushed(0),
+    flushTask(nullptr)
+{
+  ringLock = portMUX_INITIALIZER_UNLOCKED;
+  logPath[0] = '\0';
+}
+
+LogManager::~LogManager() {}
+
+bool LogManager::initialize() {
+  snprintf(logPath, sizeof(logPath), "%s/%s", LOG_DIRECTORY, LOG_FILE_NAME);
+  lastFlushTime = millis();
+
+  log(LOG_LEVEL_INFO, LOG_EVT_BOOT, FIRMWARE_VERSION_MAJOR, FIRMWARE_VERSION_MINOR,
+      FIRMWARE_VERSION_PATCH, 0);
+  return true;
+}
+
+void LogManager::push(const LogRecord& record) {
+  portENTER_CRITICAL(&ringLock);
+
+  uint16_t nextHead = (ringHead + 1) & (LOG_RING_SIZE - 1);
+  if (nextHead == ringTail) {
+    droppedRecords++;
+  } else {
+    ring[ringHead] = record;
+    ringHead = nextHead;
+    totalRecords++;
+  }
+
+  portEXIT_CRITICAL(&ringLock);
+}
+
+void LogManager::log(uint8_t level, uint8_t event, uint8_t a, uint8_t b, uint16_t c, uint32_t d) {
+  if (level < runtimeLevel) return;
+
+  LogRecord record;
+  record.timestamp = micros();
+  record.level = level;
+  record.event = event;
+  record.payload[0] = a;
+  record.payload[1] = b;
+  record.payload[2] = c & 0xFF;
+  record.payload[3] = c >> 8;
+  record.payload[4] = d & 0xFF;
+  record.payload[5] = (d >> 8) & 0xFF;
+  record.payload[6] = (d >> 16) & 0xFF;
+  record.payload[7] = d >> 24;
+  record.payload[8] = 0;
+  record.payload[9] = 0;
+
+  push(record);
+}
+
+void LogManager::logText(uint8_t level, const char* text) {
+  if (level < runtimeLevel || !text) return;
+
+  LogRecord record;
+  record.timestamp = micros();
+  record.level = level;
+  record.event = LOG_EVT_TEXT;
+
+  size_t length = strlen(text);
+  size_t offset = 0;
+  do {
+    size_t chunk = min(length - offset, (size_t)LOG_TEXT_CHARS);
+    memset(record.payload, 0, sizeof(record.payload));
+    memcpy(record.payload, text + offset, chunk);
+    push(record);
+
+    record.event = LOG_EVT_TEXT_CONT;
+    offset += chunk;
+  } while (offset < length);
+}
+
+uint16_t LogManager::getPendingRecords() const {
+  return (ringHead - ringTail) & (LOG_RING_SIZE - 1);
+}
+
+bool LogManager::writeFileHeader() {
+  if (fileManager.fileExists(logPath)) return true;
+
+  LogFileHeader header;
+  header.magic = LOG_FILE_MAGIC;
+  header.version = LOG_FILE_VERSION;
+  header.recordSize = sizeof(LogRecord);
+  return fileManager.writeFile(logPath, &header, sizeof(header));
+}
+
+void LogManager::flush(bool force) {
+  uint16_t pending = getPendingRecords();
+  if (pending == 0) return;
+
+  unsigned long currentTime = millis();
+  if (!force && pending < LOG_FLUSH_BLOCK &&
+      currentTime - lastFlushTime < LOG_FLUSH_INTERVAL_MS) {
+    return;
+  }
+
+  if (!fileManager.isInitialized() || !writeFileHeader()) return;
+
+  do {
+    uint16_t count = min(pending, (uint16_t)LOG_FLUSH_BLOCK);
+
+    // Copiar bajo el cerrojo; la escritura a SD se hace fuera de él
+    portENTER_CRITICAL(&ringLock);
+    for (uint16_t i = 0; i < count; i++) {
+      flushBuffer[i] = ring[ringTail];
+      ringTail = (ringTail + 1) & (LOG_RING_SIZE - 1);
+    }
+    portEXIT_CRITICAL(&ringLock);
+
+    size_t size = count * sizeof(LogRecord);
+    if (fileManager.appendToFile(logPath, flushBuffer, size)) {
+      bytesFlushed += size;
+    }
+
+    pending = getPendingRecords();
+  } while (force && pending > 0);
+
+  // Dejar constancia en el propio log de los registros perdidos
+  if (droppedRecords != reportedDrops) {
+    uint32_t lost = droppedRecords - reportedDrops;
+    reportedDrops = droppedRecords;
+    log(LOG_LEVEL_WARN, LOG_EVT_OVERFLOW, 0, 0, 0, lost);
+  }
+
+  lastFlushTime = currentTime;
+}
+
+bool LogManager::startFlushTask() {
+  if (flushTask) return true;
+
+  BaseType_t created = xTaskCreatePinnedToCore(flushTaskEntry, "logFlush", LOG_TASK_STACK_SIZE,
+                                               this, LOG_TASK_PRIORITY, &flushTask, LOG_TASK_CORE);
+  if (created != pdPASS) {
+    flushTask = nullptr;
+    Serial.println(F("ERROR: No se pudo crear la tarea de log"));
+    return false;
+  }
+  return true;
+}
+
+void LogManager::flushTaskEntry(void* param) {
+  LogManager* self = (LogManager*)param;
+  TickType_t lastWake = xTaskGetTickCount();
+
+  while (true) {
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(LOG_TASK_PERIOD_MS));
+    self->flush();
+  }
+}
+
+void LogManager::printStatistics() const {
+  Serial.println(F("\n=== LOG ==="));
+  Serial.print(F("Registros: ")); Serial.println(totalRecords);
+  Serial.print(F("Pendientes: ")); Serial.println(getPendingRecords());
+  Serial.print(F("Perdidos: ")); Serial.println(droppedRecords);
+  Serial.print(F("Bytes a SD: ")); Serial.println(bytesFlushed);
+  Serial.println(F("===========\n"));
+}
@@ -0,0 +1,129 @@
+#ifndef LOG_MANAGER_H
+#define LOG_MANAGER_H
+
+#include "Config.h"
+
+// ==================== NIVELES DE LOG ====================
+#define LOG_LEVEL_DEBUG   0
+#define LOG_LEVEL_INFO    1
+#define LOG_LEVEL_WARN    2
+#define LOG_LEVEL_ERROR   3
+#define LOG_LEVEL_NONE    4
+
+// Los niveles por debajo de este se eliminan en compilación
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL LOG_LEVEL_INFO
+#endif
+
+#define LOG_RING_SIZE          256   // Registros (potencia de 2)
+#define LOG_FLUSH_BLOCK        64    // Registros por escritura a SD (1 KB)
+#define LOG_FLUSH_INTERVAL_MS  2000
+#define LOG_FILE_NAME          "sys.bin"
+#define LOG_FILE_MAGIC         0x474F4C4D  // "MLOG"
+#define LOG_FILE_VERSION       1
+#define LOG_TEXT_CHARS         10
+#define LOG_TASK_STACK_SIZE    4096
+#define LOG_TASK_PRIORITY      1     // Por debajo de loop(); solo usa tiempo libre
+#define LOG_TASK_CORE          0     // loop() corre en el núcleo 1
+#define LOG_TASK_PERIOD_MS     200
+
+enum LogEvent {
+  LOG_EVT_TEXT = 0,         // payload: hasta 10 caracteres
+  LOG_EVT_TEXT_CONT = 1,    // continuación del texto anterior
+  LOG_EVT_BOOT = 2,         // a.b.c = versión de firmware
+  LOG_EVT_OVERFLOW = 3,     // d = registros perdidos
+  LOG_EVT_MIDI_IN = 4,      // a = status, b = data1, c = data2
+  LOG_EVT_DAW_VALUE = 5,    // a = track, b = banco, c = valor
+  LOG_EVT_DAW_COLOR = 6,    // a = track, b = banco, c = color RGB565
+  LOG_EVT_DAW_VALUE_COLOR = 7, // a = track, b = banco, c = color, d = valor
+  LOG_EVT_DAW_NAME = 8,     // a = track, b = banco, d = 4 primeros caracteres
+  LOG_EVT_DAW_BANK_STATE = 9 // a = banco, b = secciones, c = pistas, d = pistas cambiadas
+};
+
+// Registro binario de tamaño fijo: 16 bytes
+struct LogRecord {
+  uint32_t timestamp;   // micros()
+  uint8_t level;
+  uint8_t event;
+  uint8_t payload[LOG_TEXT_CHARS];
+};
+
+struct LogFileHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t recordSize;
+};
+
+class LogManager {
+private:
+  LogRecord ring[LOG_RING_SIZE];
+  volatile uint16_t ringHead;
+  volatile uint16_t ringTail;
+  portMUX_TYPE ringLock;
+
+  LogRecord flushBuffer[LOG_FLUSH_BLOCK];
+  char logPath[32];
+
+  uint8_t runtimeLevel;
+  unsigned long lastFlushTime;
+  uint32_t droppedRecords;
+  uint32_t reportedDrops;
+  uint32_t totalRecords;
+  uint32_t bytesFlushed;
+  TaskHandle_t flushTask;
+
+  static void flushTaskEntry(void* param);
+  void push(const LogRecord& record);
+  bool writeFileHeader();
+
+public:
+  LogManager();
+  ~LogManager();
+
+  bool initialize();
+
+  void log(uint8_t level, uint8_t event, uint8_t a, uint8_t b, uint16_t c, uint32_t d);
+  void logText(uint8_t level, const char* text);
+
+  void flush(bool force = false);
+
+  // Vuelca el log desde una tarea propia en el núcleo 0; el bus SPI
+  // compartido lo arbitra SpiBusManager
+  bool startFlushTask();
+
+  void setLevel(uint8_t level) { runtimeLevel = level; }
+  uint8_t getLevel() const { return runtimeLevel; }
+
+  uint16_t getPendingRecords() const;
+  uint32_t getDroppedRecords() const { return droppedRecords; }
+  void printStatistics() const;
+};
+
+extern LogManager logManager;
+
+// ==================== MACROS DE LOG ====================
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(event, a, b, c, d) logManager.log(LOG_LEVEL_DEBUG, (event), (a), (b), (c), (d))
+#else
+#define LOG_DEBUG(event, a, b, c, d) do {} while (0)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_INFO
+#define LOG_INFO(event, a, b, c, d) logManager.log(LOG_LEVEL_INFO, (event), (a), (b), (c), (d))
+#else
+#define LOG_INFO(event, a, b, c, d) do {} while (0)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_WARN
+#define LOG_WARN(event, a, b, c, d) logManager.log(LOG_LEVEL_WARN, (event), (a), (b), (c), (d))
+#else
+#define LOG_WARN(event, a, b, c, d) do {} while (0)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_ERROR
+#define LOG_ERROR(event, a, b, c, d) logManager.log(LOG_LEVEL_ERROR, (event), (a), (b), (c), (d))
+#else
+#define LOG_ERROR(event, a, b, c, d) do {} while (0)
+#endif
+
+#endif // LOG_MANAGER_H
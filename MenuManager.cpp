@@ -6,6 +6,8 @@
 #include "HardwareManager.h"
 #include "DisplayManager.h"
 #include "SystemManager.h"
+#include "PresetCacheManager.h"
+#include "SpiBusManager.h"
 
 #define MENU_START_Y 50
 #define MENU_ITEM_HEIGHT 30
@@ -17,12 +19,19 @@ extern MidiManager midiManager;
 extern HardwareManager hardwareManager;
 extern DisplayManager displayManager;
 extern SystemManager systemManager;
+extern PresetCacheManager presetCacheManager;
 
 MenuManager* MenuManager::instance = nullptr;
 
 const char* const MenuManager::orientationOptions[4] = {"0°", "90°", "180°", "270°"};
+const char* const MenuManager::viewOptions[VIEW_COUNT] = {"8 canales", "16 canales", "1 canal"};
 const char* const MenuManager::timeoutOptions[6] = {"Off", "1min", "5min", "10min", "30min", "60min"};
-const char* const MenuManager::controlTypeOptions[3] = {"CC", "Note", "Pitch"};
+const uint16_t MenuManager::screensaverSeconds[6] = {0, 60, 300, 600, 1800, SCREENSAVER_MAX_SECONDS};
+const char* const MenuManager::controlTypeOptions[6] = {"CC", "Note", "Pitch", "Rel 2C", "Rel S/M", "Rel Off"};
+const char* const MenuManager::takeoverOptions[4] = {"Seguir", "Salto", "Recoger", "Escalar"};
+const char* const MenuManager::resolutionOptions[3] = {"7 bits", "14 CC", "NRPN"};
+const char* const MenuManager::cableOptions[MIDI_OUTPUT_PORTS] = {"Principal", "Extensor", "Generico", "DIN"};
+const char* const MenuManager::bankCountOptions[4] = {"4", "8", "16", "32"};
 const char* const MenuManager::encoderSelectOptions[16] = {
   "Enc 1", "Enc 2", "Enc 3", "Enc 4", "Enc 5", "Enc 6", "Enc 7", "Enc 8",
   "Enc 9", "Enc 10", "Enc 11", "Enc 12", "Enc 13", "Enc 14", "Enc 15", "Enc 16"
@@ -44,10 +53,13 @@ MenuManager::MenuManager()
     encoderMenu{
         MenuItem{"Seleccionar Encoder", actionSelectEncoder, MENU_OPTION, &tempEncoderIndex, 0, 15, (const char**)encoderSelectOptions, 16, true, true},
         MenuItem{"Modo Vol/Pan", actionToggleEncoderMode, MENU_ACTION, nullptr, 0, 0, nullptr, 0, true, true},
-        MenuItem{"Tipo Control", actionSetControlType, MENU_OPTION, nullptr, 0, 2, (const char**)controlTypeOptions, 3, true, true},
+        MenuItem{"Tipo Control", actionSetControlType, MENU_OPTION, nullptr, 0, 5, (const char**)controlTypeOptions, 6, true, true},
         MenuItem{"Canal MIDI", actionSetMidiChannel, MENU_INTEGER, nullptr, 1, 16, nullptr, 0, true, true},
         MenuItem{"Numero Control", actionSetControlNumber, MENU_INTEGER, nullptr, 0, 127, nullptr, 0, true, true},
         MenuItem{"Ajustar Rango", actionSetEncoderRange, MENU_ACTION, nullptr, 0, 0, nullptr, 0, true, true},
+        MenuItem{"Recogida", actionSetTakeover, MENU_OPTION, nullptr, 0, 3, (const char**)takeoverOptions, 4, true, true},
+        MenuItem{"Resolucion", actionSetResolution, MENU_OPTION, nullptr, 0, 2, (const char**)resolutionOptions, 3, true, true},
+        MenuItem{"Puerto MIDI", actionSetCable, MENU_OPTION, nullptr, 0, MIDI_OUTPUT_PORTS - 1, (const char**)cableOptions, MIDI_OUTPUT_PORTS, true, true},
         MenuItem{"Reset Encoder", actionResetEncoder, MENU_ACTION, nullptr, 0, 0, nullptr, 0, true, true},
         MenuItem{"Volver", actionBackMenu, MENU_ACTION, nullptr, 0, 0, nullptr, 0, true, true}
     },
@@ -55,6 +67,7 @@ MenuManager::MenuManager()
         MenuItem{"Brillo", actionSetBrightness, MENU_INTEGER, &tempBrightness, 0, 100, nullptr, 0, true, true},
         MenuItem{"Timeout Pantalla", actionSetScreensaver, MENU_OPTION, &tempScreensaverTimeout, 0, 5, (const char**)timeoutOptions, 6, true, true},
         MenuItem{"Orientacion", actionSetOrientation, MENU_OPTION, &tempOrientation, 0, 3, (const char**)orientationOptions, 4, true, true},
+        MenuItem{"Vista", actionSetMixerView, MENU_OPTION, &tempMixerView, 0, VIEW_COUNT - 1, (const char**)viewOptions, VIEW_COUNT, true, true},
         MenuItem{"Test Pantalla", actionDisplayTest, MENU_ACTION, nullptr, 0, 0, nullptr, 0, true, true},
         MenuItem{"Volver", actionBackMenu, MENU_ACTION, nullptr, 0, 0, nullptr, 0, true, true}
     },
@@ -62,6 +75,7 @@ MenuManager::MenuManager()
         MenuItem{"Canal MIDI", actionSetGlobalMidiChannel, MENU_INTEGER, &tempMidiChannel, 1, 16, nullptr, 0, true, true},
         MenuItem{"Aceleracion Enc", actionToggleEncoderAccel, MENU_BOOLEAN, nullptr, 0, 1, nullptr, 0, true, true},
         MenuItem{"Offset MTC", actionSetMtcOffset, MENU_INTEGER, &tempMtcOffset, -30, 30, nullptr, 0, true, true},
+        MenuItem{"Limite MIDI", actionSetMidiRate, MENU_INTEGER, &tempMidiRate, 0, 16, nullptr, 0, true, true},
         MenuItem{"Test MIDI", actionTestMidi, MENU_ACTION, nullptr, 0, 0, nullptr, 0, true, true},
         MenuItem{"Reset MIDI", actionResetMidi, MENU_ACTION, nullptr, 0, 0, nullptr, 0, true, true},
         MenuItem{"Volver", actionBackMenu, MENU_ACTION, nullptr, 0, 0, nullptr, 0, true, true}
@@ -73,6 +87,7 @@ MenuManager::MenuManager()
         MenuItem{"Guardar Preset", actionSaveBank, MENU_ACTION, nullptr, 0, 0, nullptr, 0, true, true},
         MenuItem{"Cargar Preset", actionLoadBank, MENU_ACTION, nullptr, 0, 0, nullptr, 0, true, true},
         MenuItem{"Calibrar MCPs", actionCalibrateMcp, MENU_ACTION, nullptr, 0, 0, nullptr, 0, true, true},
+        MenuItem{"Num. Bancos", actionSetBankCount, MENU_OPTION, &tempBankCount, 0, 3, (const char**)bankCountOptions, 4, true, true},
         MenuItem{"Volver", actionBackMenu, MENU_ACTION, nullptr, 0, 0, nullptr, 0, true, true}
     }
 {
@@ -83,8 +98,11 @@ MenuManager::MenuManager()
   tempBrightness = 100;
   tempMidiChannel = 1;
   tempMtcOffset = 0;
+  tempMidiRate = MIDI_OUTPUT_RATE_DEFAULT;
   tempScreensaverTimeout = 2;
   tempOrientation = 3;
+  tempMixerView = VIEW_STRIPS_8;
+  tempBankCount = 0;
 }
 
 MenuManager::~MenuManager() {
@@ -223,6 +241,7 @@ void MenuManager::back() {
 }
 
 void MenuManager::draw(DisplayManager& display) {
+  SpiBusLock busLock(SPI_DEVICE_TFT);
   unsigned long currentTime = millis();
   
   // Verificar si el mensaje ha expirado
@@ -267,7 +286,7 @@ void MenuManager::drawMenuTitle(const char* title) {
   displayManager.fillRect(0, 0, TFT_WIDTH, 40, COLOR_DARK_GRAY);
   displayManager.drawLine(0, 40, TFT_WIDTH, 40, COLOR_WHITE);
   
-  displayManager.drawCenteredText(title, 0, 5, TFT_WIDTH, 30, COLOR_WHITE, FONT_SIZE_LARGE);
+  displayManager.drawTextBox(title, 0, 5, TFT_WIDTH, 30, COLOR_WHITE, COLOR_DARK_GRAY, FONT_SMOOTH_LARGE);
   
   if (currentMenuLevel > 0) {
     displayManager.drawRightAlignedText("<<", TFT_WIDTH - 20, 12, COLOR_CYAN, FONT_SIZE_MEDIUM);
@@ -325,10 +344,10 @@ void MenuManager::drawValueEditor() {
   displayManager.fillRect(10, editorY, TFT_WIDTH - 20, 50, COLOR_DARK_GRAY);
   displayManager.drawRect(10, editorY, TFT_WIDTH - 20, 50, COLOR_WHITE);
   
-  displayManager.drawCenteredText("Usar encoder nav para cambiar", 15, editorY + 5, 
-                          TFT_WIDTH - 30, 20, COLOR_YELLOW, FONT_SIZE_SMALL);
-  displayManager.drawCenteredText("Presionar para confirmar", 15, editorY + 25, 
-                          TFT_WIDTH - 30, 20, COLOR_WHITE, FONT_SIZE_SMALL);
+  displayManager.drawTextBox("Usar encoder nav para cambiar", 15, editorY + 5, 
+                             TFT_WIDTH - 30, 20, COLOR_YELLOW, COLOR_DARK_GRAY, FONT_SMOOTH_SMALL);
+  displayManager.drawTextBox("Presionar para confirmar", 15, editorY + 25, 
+                             TFT_WIDTH - 30, 20, COLOR_WHITE, COLOR_DARK_GRAY, FONT_SMOOTH_SMALL);
 }
 
 void MenuManager::drawScrollIndicator() {
@@ -390,6 +409,8 @@ void MenuManager::changeValue(int8_t change) {
     displayManager.setBrightness(tempBrightness);
   } else if (item.valuePtr == &tempOrientation) {
     displayManager.setOrientation((DisplayOrientation)tempOrientation);
+  } else if (item.valuePtr == &tempMixerView) {
+    displayManager.setMixerView((MixerView)tempMixerView);
   }
 }
 
@@ -399,10 +420,11 @@ void MenuManager::applyTempValues() {
   appConfig->brightness = tempBrightness;
   appConfig->midiChannel = tempMidiChannel;
   appConfig->mtcOffset = tempMtcOffset;
+  appConfig->midiOutputRate = tempMidiRate;
   appConfig->orientation = (DisplayOrientation)tempOrientation;
+  appConfig->mixerView = tempMixerView;
   
-  uint32_t timeouts[] = {0, 60000, 300000, 600000, 1800000, 3600000};
-  appConfig->screensaverTimeout = timeouts[constrainValue(tempScreensaverTimeout, 0, 5)];
+  appConfig->screensaverTimeout = screensaverSeconds[constrainValue(tempScreensaverTimeout, 0, 5)];
   
   Serial.println(F("Configuración aplicada"));
 }
@@ -413,15 +435,19 @@ void MenuManager::refreshFromConfig() {
   tempBrightness = appConfig->brightness;
   tempMidiChannel = appConfig->midiChannel;
   tempMtcOffset = appConfig->mtcOffset;
+  tempMidiRate = appConfig->midiOutputRate;
   tempOrientation = (int16_t)appConfig->orientation;
+  tempMixerView = appConfig->mixerView;
   
-  uint32_t timeout = appConfig->screensaverTimeout;
-  if (timeout == 0) tempScreensaverTimeout = 0;
-  else if (timeout <= 60000) tempScreensaverTimeout = 1;
-  else if (timeout <= 300000) tempScreensaverTimeout = 2;
-  else if (timeout <= 600000) tempScreensaverTimeout = 3;
-  else if (timeout <= 1800000) tempScreensaverTimeout = 4;
-  else tempScreensaverTimeout = 5;
+  // 4 -> 0, 8 -> 1, 16 -> 2, 32 -> 3
+  tempBankCount = 0;
+  while (tempBankCount < 3 && (4 << tempBankCount) < appConfig->bankCount) tempBankCount++;
+  
+  // La opción más corta que cubra el valor guardado
+  tempScreensaverTimeout = 0;
+  while (tempScreensaverTimeout < 5 && screensaverSeconds[tempScreensaverTimeout] < appConfig->screensaverTimeout) {
+    tempScreensaverTimeout++;
+  }
 }
 
 MenuItem* MenuManager::getCurrentMenu() {
@@ -438,10 +464,10 @@ MenuItem* MenuManager::getCurrentMenu() {
 uint8_t MenuManager::getCurrentMenuSize() {
   switch (currentMenuType[currentMenuLevel]) {
     case MenuType::MAIN_MENU: return 6;
-    case MenuType::ENCODER_SETTINGS: return 8;
-    case MenuType::DISPLAY_SETTINGS: return 5;
-    case MenuType::MIDI_SETTINGS: return 6;
-    case MenuType::SYSTEM_SETTINGS: return 7;
+    case MenuType::ENCODER_SETTINGS: return 11;
+    case MenuType::DISPLAY_SETTINGS: return 6;
+    case MenuType::MIDI_SETTINGS: return 7;
+    case MenuType::SYSTEM_SETTINGS: return 8;
     default: return 0;
   }
 }
@@ -631,12 +657,109 @@ void MenuManager::actionSetControlType() {
       instance->showMessage("Tipo: Pitch Bend", 1500);
       break;
     case CT_PITCH:
+      config.controlType = CT_REL_TWOS;
+      instance->showMessage("Tipo: Relativo 2C", 1500);
+      break;
+    case CT_REL_TWOS:
+      config.controlType = CT_REL_SIGNED;
+      instance->showMessage("Tipo: Relativo V-Pot", 1500);
+      break;
+    case CT_REL_SIGNED:
+      config.controlType = CT_REL_OFFSET;
+      instance->showMessage("Tipo: Relativo 64", 1500);
+      break;
+    default:
       config.controlType = CT_CC;
       instance->showMessage("Tipo: Control Change", 1500);
       break;
   }
 }
 
+void MenuManager::actionSetTakeover() {
+  if (!instance) return;
+  
+  uint8_t encIndex = instance->tempEncoderIndex;
+  uint8_t bank = instance->systemState ? instance->systemState->currentBank : 0;
+  
+  EncoderConfig& config = encoderManager.getEncoderConfigMutable(encIndex, bank);
+  
+  switch (config.takeover) {
+    case TAKEOVER_FOLLOW:
+      config.takeover = TAKEOVER_JUMP;
+      instance->showMessage("Recogida: Salto", 1500);
+      break;
+    case TAKEOVER_JUMP:
+      config.takeover = TAKEOVER_PICKUP;
+      instance->showMessage("Recogida: Recoger", 1500);
+      break;
+    case TAKEOVER_PICKUP:
+      config.takeover = TAKEOVER_SCALED;
+      instance->showMessage("Recogida: Escalar", 1500);
+      break;
+    default:
+      config.takeover = TAKEOVER_FOLLOW;
+      instance->showMessage("Recogida: Seguir DAW", 1500);
+      break;
+  }
+}
+
+void MenuManager::actionSetResolution() {
+  if (!instance) return;
+  
+  uint8_t encIndex = instance->tempEncoderIndex;
+  uint8_t bank = instance->systemState ? instance->systemState->currentBank : 0;
+  
+  EncoderConfig& config = encoderManager.getEncoderConfigMutable(encIndex, bank);
+  
+  switch (config.resolution) {
+    case RES_7BIT:
+      config.resolution = RES_14BIT_CC;
+      // El par MSB/LSB solo existe para los controles 0-31
+      if (config.controlType == CT_CC && config.control >= 32) {
+        instance->showMessage("14 bits: usar CC 0-31", 2000);
+      } else {
+        instance->showMessage("Resolucion: 14 bits CC", 1500);
+      }
+      break;
+    case RES_14BIT_CC:
+      config.resolution = RES_NRPN;
+      instance->showMessage("Resolucion: NRPN", 1500);
+      break;
+    default:
+      config.resolution = RES_7BIT;
+      instance->showMessage("Resolucion: 7 bits", 1500);
+      break;
+  }
+}
+
+void MenuManager::actionSetCable() {
+  if (!instance) return;
+  
+  uint8_t encIndex = instance->tempEncoderIndex;
+  uint8_t bank = instance->systemState ? instance->systemState->currentBank : 0;
+  
+  EncoderConfig& config = encoderManager.getEncoderConfigMutable(encIndex, bank);
+  
+  switch (config.cable) {
+    case CABLE_MAIN:
+      config.cable = CABLE_EXTENDER;
+      instance->showMessage("Puerto: Extensor", 1500);
+      break;
+    case CABLE_EXTENDER:
+      config.cable = CABLE_GENERIC;
+      instance->showMessage("Puerto: Generico", 1500);
+      break;
+    case CABLE_GENERIC:
+      config.cable = CABLE_DIN;
+      instance->showMessage("Puerto: DIN", 1500);
+      break;
+    default:
+      config.cable = CABLE_MAIN;
+      instance->showMessage("Puerto: Principal", 1500);
+      break;
+  }
+}
+
 void MenuManager::actionSetMidiChannel() {
   if (!instance) return;
   
@@ -721,8 +844,7 @@ void MenuManager::actionSetBrightness() {
 void MenuManager::actionSetScreensaver() {
   if (!instance) return;
   
-  uint32_t timeouts[] = {0, 60000, 300000, 600000, 1800000, 3600000};
-  instance->appConfig->screensaverTimeout = timeouts[instance->tempScreensaverTimeout];
+  instance->appConfig->screensaverTimeout = screensaverSeconds[instance->tempScreensaverTimeout];
   
   const char* labels[] = {"Desactivado", "1 minuto", "5 minutos", "10 minutos", "30 minutos", "60 minutos"};
   
@@ -744,6 +866,17 @@ void MenuManager::actionSetOrientation() {
   instance->showMessage(msg, 1500);
 }
 
+void MenuManager::actionSetMixerView() {
+  if (!instance) return;
+  
+  instance->appConfig->mixerView = instance->tempMixerView;
+  displayManager.setMixerView((MixerView)instance->tempMixerView);
+  
+  char msg[32];
+  snprintf(msg, sizeof(msg), "Vista: %s", viewOptions[instance->tempMixerView]);
+  instance->showMessage(msg, 1500);
+}
+
 void MenuManager::actionDisplayTest() {
   if (!instance) return;
   
@@ -791,7 +924,7 @@ void MenuManager::actionSaveConfig() {
   
   instance->showMessage("Guardando...", 1000);
   
-  if (fileManager.saveConfiguration(*instance->appConfig, encoderManager.getEncoderBanks())) {
+  if (fileManager.saveConfiguration(*instance->appConfig, encoderManager)) {
     instance->showMessage("Configuración guardada", 2000);
     Serial.println(F("Configuración guardada exitosamente"));
   } else {
@@ -807,7 +940,7 @@ void MenuManager::actionLoadConfig() {
     
     instance->showMessage("Cargando...", 1000);
     
-    if (fileManager.loadConfiguration(*instance->appConfig, encoderManager.getEncoderBanks())) {
+    if (fileManager.loadConfiguration(*instance->appConfig, encoderManager)) {
       instance->refreshFromConfig();
       instance->showMessage("Configuración cargada", 2000);
       Serial.println(F("Configuración cargada exitosamente"));
@@ -833,7 +966,9 @@ void MenuManager::actionSaveBank() {
   
   instance->showMessage("Guardando banco...", 1000);
   
-  if (fileManager.savePreset(presetName, encoderManager.getEncoderBanks())) {
+  if (fileManager.savePreset(presetName, encoderManager)) {
+    presetCacheManager.storePreset(presetName, encoderManager);
+    
     char msg[32];
     snprintf(msg, sizeof(msg), "Banco %d guardado", currentBank + 1);
     instance->showMessage(msg, 2000);
@@ -864,6 +999,32 @@ void MenuManager::actionCalibrateMcp() {
   instance->showConfirmDialog("¿Calibrar expansores I/O?", confirmCalibrateMcpCallback);
 }
 
+void MenuManager::actionSetBankCount() {
+  if (!instance) return;
+  
+  instance->applyBankCount(4 << constrain(instance->tempBankCount, 0, 3));
+  
+  char msg[32];
+  snprintf(msg, sizeof(msg), "Bancos: %d", instance->appConfig->bankCount);
+  instance->showMessage(msg, 1500);
+}
+
+void MenuManager::applyBankCount(uint8_t count) {
+  if (!encoderManager.setBankCount(count)) {
+    showMessage("Sin memoria para bancos", 3000);
+    return;
+  }
+  
+  uint8_t bankCount = encoderManager.getBankCount();
+  appConfig->bankCount = bankCount;
+  
+  if (systemState && systemState->currentBank >= bankCount) {
+    systemState->currentBank = bankCount - 1;
+    appConfig->currentBank = systemState->currentBank;
+    encoderManager.setCurrentBank(systemState->currentBank);
+  }
+}
+
 // ==================== CALLBACKS DE CONFIRMACIÓN ====================
 void MenuManager::confirmResetMidiCallback() {
   if (!instance) return;
@@ -871,9 +1032,11 @@ void MenuManager::confirmResetMidiCallback() {
   instance->appConfig->midiChannel = 1;
   instance->appConfig->encoderAcceleration = true;
   instance->appConfig->mtcOffset = 0;
+  instance->appConfig->midiOutputRate = MIDI_OUTPUT_RATE_DEFAULT;
   
   instance->tempMidiChannel = 1;
   instance->tempMtcOffset = 0;
+  instance->tempMidiRate = MIDI_OUTPUT_RATE_DEFAULT;
   
   instance->showMessage("MIDI reseteado", 2000);
   Serial.println(F("Configuración MIDI reseteada"));
@@ -888,7 +1051,9 @@ void MenuManager::confirmResetConfigCallback() {
   encoderManager.resetAllBanks();
   
   *instance->appConfig = AppConfig();
+  instance->applyBankCount(instance->appConfig->bankCount);
   instance->refreshFromConfig();
+  displayManager.setMixerView((MixerView)instance->appConfig->mixerView);
   
   instance->showMessage("Sistema reseteado", 3000);
   Serial.println(F("Sistema completamente reseteado"));
@@ -918,7 +1083,18 @@ void MenuManager::confirmLoadBankCallback() {
   
   instance->showMessage("Cargando banco...", 1000);
   
-  if (fileManager.loadPreset(presetName, encoderManager.getEncoderBanks())) {
+  // Primero la caché en flash; la SD solo si el preset aún no está sincronizado
+  bool loaded = presetCacheManager.loadPreset(presetName, encoderManager);
+  if (!loaded && fileManager.loadPreset(presetName, encoderManager)) {
+    presetCacheManager.storePreset(presetName, encoderManager);
+    loaded = true;
+  }
+  
+  if (loaded) {
+    // El preset puede traer otro número de bancos
+    instance->applyBankCount(encoderManager.getBankCount());
+    instance->refreshFromConfig();
+    
     char msg[32];
     snprintf(msg, sizeof(msg), "Banco %d cargado", currentBank + 1);
     instance->showMessage(msg, 2000);
@@ -950,8 +1126,11 @@ void MenuManager::executeEncoderMenuAction(uint8_t actionIndex) {
     case 3: actionSetMidiChannel(); break;
     case 4: actionSetControlNumber(); break;
     case 5: actionSetEncoderRange(); break;
-    case 6: actionResetEncoder(); break;
-    case 7: actionBackMenu(); break;
+    case 6: actionSetTakeover(); break;
+    case 7: actionSetResolution(); break;
+    case 8: actionSetCable(); break;
+    case 9: actionResetEncoder(); break;
+    case 10: actionBackMenu(); break;
     default: break;
   }
 }
@@ -961,8 +1140,9 @@ void MenuManager::executeDisplayMenuAction(uint8_t actionIndex) {
     case 0: actionSetBrightness(); break;
     case 1: actionSetScreensaver(); break;
     case 2: actionSetOrientation(); break;
-    case 3: actionDisplayTest(); break;
-    case 4: actionBackMenu(); break;
+    case 3: actionSetMixerView(); break;
+    case 4: actionDisplayTest(); break;
+    case 5: actionBackMenu(); break;
     default: break;
   }
 }
@@ -972,9 +1152,10 @@ void MenuManager::executeMidiMenuAction(uint8_t actionIndex) {
     case 0: actionSetGlobalMidiChannel(); break;
     case 1: actionToggleEncoderAccel(); break;
     case 2: actionSetMtcOffset(); break;
-    case 3: actionTestMidi(); break;
-    case 4: actionResetMidi(); break;
-    case 5: actionBackMenu(); break;
+    case 3: actionSetMidiRate(); break;
+    case 4: actionTestMidi(); break;
+    case 5: actionResetMidi(); break;
+    case 6: actionBackMenu(); break;
     default: break;
   }
 }
@@ -987,6 +1168,20 @@ void MenuManager::actionSetMtcOffset() {
   snprintf(msg, sizeof(msg), "Offset MTC: %d", instance->tempMtcOffset);
   instance->showMessage(msg, 1500);
 }
+
+void MenuManager::actionSetMidiRate() {
+  if (!instance) return;
+  
+  instance->appConfig->midiOutputRate = instance->tempMidiRate;
+  
+  char msg[32];
+  if (instance->tempMidiRate == 0) {
+    snprintf(msg, sizeof(msg), "Limite MIDI: OFF");
+  } else {
+    snprintf(msg, sizeof(msg), "Limite MIDI: %d msg/ms", instance->tempMidiRate);
+  }
+  instance->showMessage(msg, 1500);
+}
 void MenuManager::executeSystemMenuAction(uint8_t actionIndex) {
   switch (actionIndex) {
     case 0: actionSaveConfig(); break;
@@ -995,7 +1190,8 @@ void MenuManager::executeSystemMenuAction(uint8_t actionIndex) {
     case 3: actionSaveBank(); break;
     case 4: actionLoadBank(); break;
     case 5: actionCalibrateMcp(); break;
-    case 6: actionBackMenu(); break;
+    case 6: actionSetBankCount(); break;
+    case 7: actionBackMenu(); break;
     default: break;
   }
 }
\ No newline at end of file
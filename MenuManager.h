@@ -34,9 +34,15 @@ public:
   static MenuManager* instance;
   
   static const char* const orientationOptions[4];
+  static const char* const viewOptions[VIEW_COUNT];
   static const char* const timeoutOptions[6];
-  static const char* const controlTypeOptions[3];
+  static const uint16_t screensaverSeconds[6];   // AppConfig::screensaverTimeout de cada opción
+  static const char* const controlTypeOptions[6];
+  static const char* const takeoverOptions[4];
+  static const char* const resolutionOptions[3];
+  static const char* const cableOptions[MIDI_OUTPUT_PORTS];
   static const char* const encoderSelectOptions[16];
+  static const char* const bankCountOptions[4];
   
   MenuManager();
   ~MenuManager();
@@ -62,6 +68,9 @@ public:
   static void actionSelectEncoder();
   static void actionToggleEncoderMode();
   static void actionSetControlType();
+  static void actionSetTakeover();
+  static void actionSetResolution();
+  static void actionSetCable();
   static void actionSetMidiChannel();
   static void actionSetControlNumber();
   static void actionSetEncoderRange();
@@ -69,10 +78,12 @@ public:
   static void actionSetBrightness();
   static void actionSetScreensaver();
   static void actionSetOrientation();
+  static void actionSetMixerView();
   static void actionDisplayTest();
   static void actionSetGlobalMidiChannel();
   static void actionToggleEncoderAccel();
   static void actionSetMtcOffset();
+  static void actionSetMidiRate();
   static void actionTestMidi();
   static void actionResetMidi();
   static void actionSaveConfig();
@@ -81,15 +92,16 @@ public:
   static void actionSaveBank();
   static void actionLoadBank();
   static void actionCalibrateMcp();
+  static void actionSetBankCount();
   static void actionSystemTest();
   static void actionBackMenu();
 
 private:
   MenuItem mainMenu[6];
-  MenuItem encoderMenu[8];
-  MenuItem displayMenu[5];
-  MenuItem midiMenu[6];
-  MenuItem globalMenu[7];
+  MenuItem encoderMenu[11];
+  MenuItem displayMenu[6];
+  MenuItem midiMenu[7];
+  MenuItem globalMenu[8];
   
   bool menuActive;
   uint8_t currentMenuLevel;
@@ -104,8 +116,11 @@ private:
   int16_t tempBrightness;
   int16_t tempMidiChannel;
   int16_t tempMtcOffset;
+  int16_t tempMidiRate;
   int16_t tempScreensaverTimeout;
   int16_t tempOrientation;
+  int16_t tempMixerView;
+  int16_t tempBankCount;
   
   int16_t scrollOffset;
   uint8_t visibleItems;
@@ -124,6 +139,7 @@ private:
   void changeValue(int8_t change);
   void applyTempValues();
   void refreshFromConfig();
+  void applyBankCount(uint8_t count);
   void executeAction();
   
   void drawMenuTitle(const char* title);
@@ -0,0 +1,138 @@
+#include "MidiClock.h"
+
+MidiClock::MidiClock()
+  : clocksReceived(0), tempoRelocks(0), songPositions(0),
+    maxClockCostMicros(0), totalClockCostMicros(0)
+{
+  reset();
+}
+
+void MidiClock::reset() {
+  resetTempo();
+  clockPosition = 0;
+  running = false;
+  skipNextClock = false;
+  data = ClockData();
+}
+
+void MidiClock::resetTempo() {
+  memset(stamps, 0, sizeof(stamps));
+  stampIndex = 0;
+  stampCount = 0;
+  lastClockMicros = 0;
+}
+
+// Marca del reloj recibido 'back' relojes antes del último
+uint32_t MidiClock::stampBack(uint8_t back) const {
+  const uint8_t size = CLOCK_AVERAGE_INTERVALS + 1;
+  return stamps[(stampIndex + size - 1 - back) % size];
+}
+
+uint32_t MidiClock::spanMicros(uint8_t intervals) const {
+  return stampBack(0) - stampBack(intervals);
+}
+
+// El tempo es el tiempo entre el primer y el último reloj de la ventana entre
+// los intervalos que los separan: el jitter de USB solo pesa en los extremos y
+// un paquete agrupado o retrasado no se descarta, se compensa con el siguiente.
+// Si el tramo reciente se aparta de la ventana es el tempo el que ha cambiado:
+// la ventana se reduce a los últimos relojes, ya al tempo nuevo.
+void MidiClock::onClock(uint32_t timestampMicros) {
+  uint32_t start = micros();
+  clocksReceived++;
+
+  if (running) {
+    if (skipNextClock) {
+      skipNextClock = false;
+    } else {
+      clockPosition++;
+    }
+  }
+
+  if (stampCount > 0 && timestampMicros - lastClockMicros >= CLOCK_TIMEOUT_US) {
+    resetTempo();
+  }
+  
+  stamps[stampIndex] = timestampMicros;
+  stampIndex = (stampIndex + 1) % (CLOCK_AVERAGE_INTERVALS + 1);
+  if (stampCount <= CLOCK_AVERAGE_INTERVALS) stampCount++;
+  lastClockMicros = timestampMicros;
+  
+  // Medias comparadas en productos cruzados para no dividir
+  uint8_t intervals = stampCount - 1;
+  if (intervals >= 2 * CLOCK_RELOCK_INTERVALS) {
+    uint64_t recent = (uint64_t)spanMicros(CLOCK_RELOCK_INTERVALS) * intervals;
+    uint64_t window = (uint64_t)spanMicros(intervals) * CLOCK_RELOCK_INTERVALS;
+    uint64_t tolerance = window * CLOCK_RELOCK_PERCENT / 100;
+    
+    if (recent + tolerance < window || recent > window + tolerance) {
+      tempoRelocks++;
+      stampCount = CLOCK_RELOCK_KEEP + 1;
+    }
+  }
+
+  uint32_t cost = micros() - start;
+  if (cost > maxClockCostMicros) maxClockCostMicros = cost;
+  totalClockCostMicros += cost;
+}
+
+void MidiClock::onStart() {
+  clockPosition = 0;
+  running = true;
+  skipNextClock = true;
+}
+
+void MidiClock::onContinue() {
+  running = true;
+  skipNextClock = true;
+}
+
+void MidiClock::onStop() {
+  running = false;
+}
+
+// Solo tiene sentido con el transporte parado; en marcha se aplica igualmente
+// porque algunos DAW lo envían justo antes del Continue
+void MidiClock::onSongPosition(uint16_t sixteenths) {
+  clockPosition = (uint32_t)sixteenths * CLOCKS_PER_SIXTEENTH;
+  songPositions++;
+}
+
+const ClockData& MidiClock::getData() {
+  uint8_t intervals = stampCount > 0 ? stampCount - 1 : 0;
+  bool locked = intervals >= CLOCK_MIN_INTERVALS &&
+                (micros() - lastClockMicros) < CLOCK_TIMEOUT_US;
+  
+  // Décimas de BPM: 60e6 us/min * 10 / (intervalo medio * 24), con el
+  // intervalo medio como span / intervalos
+  data.bpmX10 = 0;
+  if (locked) {
+    uint32_t span = spanMicros(intervals);
+    if (span > 0) data.bpmX10 = (25000000ULL * intervals + span / 2) / span;
+  }
+
+  uint32_t sixteenths = clockPosition / CLOCKS_PER_SIXTEENTH;
+  uint32_t beats = sixteenths / 4;
+  data.bar = beats / CLOCK_BEATS_PER_BAR + 1;
+  data.beat = beats % CLOCK_BEATS_PER_BAR + 1;
+  data.sixteenth = sixteenths % 4 + 1;
+  data.running = running;
+  return data;
+}
+
+void MidiClock::printStatistics() const {
+  Serial.print(F("Relojes: ")); Serial.print(clocksReceived);
+  Serial.print(F(" | reenganches ")); Serial.print(tempoRelocks);
+  Serial.print(F(" | SPP ")); Serial.println(songPositions);
+  Serial.print(F("Coste por reloj (us): media "));
+  Serial.print(clocksReceived ? (uint32_t)(totalClockCostMicros / clocksReceived) : 0);
+  Serial.print(F(" | máx ")); Serial.println(maxClockCostMicros);
+}
+
+void MidiClock::resetStatistics() {
+  clocksReceived = 0;
+  tempoRelocks = 0;
+  songPositions = 0;
+  maxClockCostMicros = 0;
+  totalClockCostMicros = 0;
+}
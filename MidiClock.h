@@ -0,0 +1,59 @@
+#ifndef MIDI_CLOCK_H
+#define MIDI_CLOCK_H
+
+#include "Config.h"
+#include <Arduino.h>
+
+// Reloj MIDI (0xF8, 24 por negra) y Song Position Pointer
+#define CLOCK_PPQN                24
+#define CLOCKS_PER_SIXTEENTH      6      // Unidad de SPP: una semicorchea
+#define CLOCK_BEATS_PER_BAR       4      // Se asume 4/4
+#define CLOCK_AVERAGE_INTERVALS   96     // Cuatro negras de intervalos en la media
+#define CLOCK_RELOCK_INTERVALS    12     // Tramo reciente (media negra) comparado con la ventana
+#define CLOCK_RELOCK_PERCENT      10     // Tramo reciente a más de ±10%: tempo nuevo
+#define CLOCK_RELOCK_KEEP         4      // Intervalos que se conservan al reengancharse
+#define CLOCK_MIN_INTERVALS       4      // Intervalos necesarios para dar un tempo
+#define CLOCK_TIMEOUT_US          500000 // Sin reloj en 0,5 s: tempo desconocido
+
+class MidiClock {
+private:
+  // Marcas de los últimos relojes; el tempo sale de los extremos de la ventana
+  uint32_t stamps[CLOCK_AVERAGE_INTERVALS + 1];
+  uint8_t stampIndex;    // Siguiente hueco
+  uint8_t stampCount;
+  uint32_t lastClockMicros;
+
+  // Posición en relojes desde el inicio de la canción
+  uint32_t clockPosition;
+  bool running;
+  bool skipNextClock;   // Tras Start/Continue el primer reloj marca la posición actual
+
+  ClockData data;
+
+  // Estadísticas
+  uint32_t clocksReceived;
+  uint32_t tempoRelocks;
+  uint32_t songPositions;
+  uint32_t maxClockCostMicros;
+  uint64_t totalClockCostMicros;
+
+  void resetTempo();
+  uint32_t stampBack(uint8_t back) const;
+  uint32_t spanMicros(uint8_t intervals) const;
+
+public:
+  MidiClock();
+
+  void reset();
+  void onClock(uint32_t timestampMicros);
+  void onStart();
+  void onContinue();
+  void onStop();
+  void onSongPosition(uint16_t sixteenths);
+
+  const ClockData& getData();
+  void printStatistics() const;
+  void resetStatistics();
+};
+
+#endif // MIDI_CLOCK_H
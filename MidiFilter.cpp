@@ -0,0 +1,318 @@
+#include "MidiFilter.h"
+#include "FileManager.h"
+
+extern FileManager fileManager;
+
+#define FILTER_TYPE_COUNT  7   // 0x8n a 0xEn
+#define FILTER_TYPE_BEND   6
+
+static bool parseNumber(const char* token, long low, long high, uint8_t& out) {
+  char* end;
+  long value = strtol(token, &end, 10);
+  if (end == token || *end != '\0' || value < low || value > high) return false;
+  out = (uint8_t)value;
+  return true;
+}
+
+// "*", "n" o "a-b"
+static bool parseRange(char* token, uint8_t low, uint8_t high, uint8_t& outLow, uint8_t& outHigh) {
+  if (strcmp(token, "*") == 0) {
+    outLow = low;
+    outHigh = high;
+    return true;
+  }
+
+  char* dash = strchr(token, '-');
+  if (!dash) {
+    if (!parseNumber(token, low, high, outLow)) return false;
+    outHigh = outLow;
+    return true;
+  }
+
+  *dash = '\0';
+  return parseNumber(token, low, high, outLow) && parseNumber(dash + 1, low, high, outHigh) &&
+         outLow <= outHigh;
+}
+
+static uint8_t parseTypeMask(const char* token) {
+  if (strcmp(token, "noteoff") == 0) return 0x01;
+  if (strcmp(token, "noteon") == 0)  return 0x02;
+  if (strcmp(token, "note") == 0)    return 0x03;
+  if (strcmp(token, "poly") == 0)    return 0x04;
+  if (strcmp(token, "cc") == 0)      return 0x08;
+  if (strcmp(token, "pc") == 0)      return 0x10;
+  if (strcmp(token, "press") == 0)   return 0x20;
+  if (strcmp(token, "bend") == 0)    return 0x40;
+  if (strcmp(token, "any") == 0)     return 0x7F;
+  return 0;
+}
+
+MidiFilter::MidiFilter()
+  : messagesPassed(0), messagesDropped(0), messagesTransformed(0), messagesThru(0),
+    compileMicros(0)
+{
+  clear();
+}
+
+void MidiFilter::clear() {
+  memset(statusAction, FILTER_ACTION_NONE, sizeof(statusAction));
+  memset(statusTable, FILTER_TABLE_NONE, sizeof(statusTable));
+  memset(actions, 0, sizeof(actions));
+  ruleCount = 0;
+  tableCount = 0;
+}
+
+bool MidiFilter::parseRule(char* line, MidiFilterRule& rule) {
+  char* savePtr;
+  char* action = strtok_r(line, " \t\r", &savePtr);
+  char* type = strtok_r(nullptr, " \t\r", &savePtr);
+  char* channel = strtok_r(nullptr, " \t\r", &savePtr);
+  char* data1 = strtok_r(nullptr, " \t\r", &savePtr);
+  if (!action || !type || !channel || !data1) return false;
+
+  memset(&rule, 0, sizeof(rule));
+  rule.action.scaleMax = 127;
+
+  if (strcmp(action, "drop") == 0) {
+    rule.action.flags = FILTER_DROP;
+  } else if (strcmp(action, "scale") == 0) {
+    rule.action.flags = FILTER_SCALE;
+  } else if (strcmp(action, "thru") == 0) {
+    rule.action.flags = FILTER_THRU;
+  } else if (strcmp(action, "pass") != 0 && strcmp(action, "remap") != 0) {
+    return false;
+  }
+
+  rule.typeMask = parseTypeMask(type);
+  if (!rule.typeMask) return false;
+
+  if (!parseRange(channel, 1, 16, rule.channelLow, rule.channelHigh)) return false;
+  rule.channelLow--;
+  rule.channelHigh--;
+  if (!parseRange(data1, 0, 127, rule.data1Low, rule.data1High)) return false;
+
+  for (char* option = strtok_r(nullptr, " \t\r", &savePtr); option;
+       option = strtok_r(nullptr, " \t\r", &savePtr)) {
+    MidiFilterAction& act = rule.action;
+
+    if (strcmp(option, "thru") == 0) {
+      act.flags |= FILTER_THRU;
+    } else if (strncmp(option, "ch=", 3) == 0) {
+      if (!parseNumber(option + 3, 1, 16, act.channel)) return false;
+      act.channel--;
+      act.flags |= FILTER_CHANNEL;
+    } else if (strncmp(option, "d1=", 3) == 0) {
+      if (!parseNumber(option + 3, 0, 127, act.data1)) return false;
+      act.flags |= FILTER_DATA1;
+    } else if (strncmp(option, "min=", 4) == 0) {
+      if (!parseNumber(option + 4, 0, 127, act.scaleMin)) return false;
+      act.flags |= FILTER_SCALE;
+    } else if (strncmp(option, "max=", 4) == 0) {
+      if (!parseNumber(option + 4, 0, 127, act.scaleMax)) return false;
+      act.flags |= FILTER_SCALE;
+    } else {
+      return false;
+    }
+  }
+
+  // remap sin destino no hace nada: seguramente es un error en el fichero
+  if (strcmp(action, "remap") == 0 && !(rule.action.flags & (FILTER_CHANNEL | FILTER_DATA1))) {
+    return false;
+  }
+  return true;
+}
+
+bool MidiFilter::compile(char* text) {
+  unsigned long startTime = micros();
+  clear();
+
+  // Mapa completo estado x primer byte durante la compilación; después se
+  // reduce a una acción por estado o a tablas compartidas
+  uint8_t* map = (uint8_t*)calloc(MIDI_FILTER_STATUS_COUNT * 128, 1);
+  if (!map) {
+    Serial.println(F("ERROR: Sin memoria para compilar reglas MIDI"));
+    return false;
+  }
+
+  uint16_t lineNumber = 0;
+  uint8_t errors = 0;
+  char* line = text;
+
+  while (line) {
+    char* next = strchr(line, '\n');
+    if (next) *next++ = '\0';
+    lineNumber++;
+
+    char* comment = strchr(line, '#');
+    if (comment) *comment = '\0';
+    if (line[strspn(line, " \t\r")] == '\0') {
+      line = next;
+      continue;
+    }
+
+    MidiFilterRule rule;
+    if (ruleCount >= MIDI_FILTER_MAX_RULES) {
+      Serial.println(F("ERROR: Demasiadas reglas MIDI, se ignoran las restantes"));
+      errors++;
+      break;
+    }
+    if (!parseRule(line, rule)) {
+      Serial.print(F("ERROR: Regla MIDI no válida en línea "));
+      Serial.println(lineNumber);
+      errors++;
+      line = next;
+      continue;
+    }
+
+    uint8_t actionIndex = ++ruleCount;
+    actions[actionIndex] = rule.action;
+
+    for (uint8_t type = 0; type < FILTER_TYPE_COUNT; type++) {
+      if (!(rule.typeMask & (1 << type))) continue;
+
+      // En pitch bend el primer byte es el LSB: el rango no aplica
+      uint8_t low = type == FILTER_TYPE_BEND ? 0 : rule.data1Low;
+      uint8_t high = type == FILTER_TYPE_BEND ? 127 : rule.data1High;
+
+      for (uint8_t ch = rule.channelLow; ch <= rule.channelHigh; ch++) {
+        uint8_t* row = &map[((type << 4) | ch) * 128];
+        for (uint8_t d1 = low; d1 <= high; d1++) {
+          if (row[d1] == FILTER_ACTION_NONE) row[d1] = actionIndex;   // Gana la primera
+        }
+      }
+    }
+    line = next;
+  }
+
+  bool ok = buildTables(map);
+  free(map);
+
+  if (!ok) {
+    Serial.println(F("ERROR: Reglas MIDI demasiado fragmentadas (sin tablas libres)"));
+    clear();
+    return false;
+  }
+
+  compileMicros = micros() - startTime;
+  return errors == 0;
+}
+
+bool MidiFilter::buildTables(const uint8_t* map) {
+  for (uint8_t status = 0; status < MIDI_FILTER_STATUS_COUNT; status++) {
+    const uint8_t* row = &map[status * 128];
+
+    bool uniform = true;
+    for (uint8_t i = 1; i < 128 && uniform; i++) {
+      uniform = row[i] == row[0];
+    }
+    if (uniform) {
+      statusAction[status] = row[0];
+      continue;
+    }
+
+    // Los estados con la misma distribución (p. ej. un rango en todos los canales) comparten tabla
+    uint8_t table = 0;
+    while (table < tableCount && memcmp(data1Tables[table], row, 128) != 0) table++;
+    if (table == tableCount) {
+      if (tableCount >= MIDI_FILTER_MAX_TABLES) return false;
+      memcpy(data1Tables[tableCount++], row, 128);
+    }
+    statusTable[status] = table;
+  }
+  return true;
+}
+
+bool MidiFilter::loadRules(const char* filename) {
+  if (!fileManager.fileExists(filename)) return false;
+
+  char* text = (char*)malloc(MIDI_FILTER_MAX_FILE + 1);
+  if (!text) return false;
+
+  size_t length = 0;
+  bool ok = fileManager.readFile(filename, text, MIDI_FILTER_MAX_FILE, &length);
+  if (ok) {
+    text[length] = '\0';
+    ok = compile(text);
+    Serial.print(F("Reglas MIDI: ")); Serial.print(ruleCount);
+    Serial.print(F(", tablas ")); Serial.print(tableCount);
+    Serial.print(F(", ")); Serial.print(compileMicros); Serial.println(F(" us"));
+  } else {
+    Serial.println(F("ERROR: No se pudo leer el fichero de reglas MIDI"));
+  }
+
+  free(text);
+  return ok;
+}
+
+uint8_t MidiFilter::apply(uint8_t& status, uint8_t& data1, uint8_t& data2) {
+  if (status < 0x80 || status >= 0xF0) return 0;
+
+  uint8_t index = status - 0x80;
+  uint8_t table = statusTable[index];
+  uint8_t actionIndex = table == FILTER_TABLE_NONE ? statusAction[index] : data1Tables[table][data1 & 0x7F];
+
+  if (actionIndex == FILTER_ACTION_NONE) {
+    messagesPassed++;
+    return 0;
+  }
+
+  const MidiFilterAction& action = actions[actionIndex];
+  if (action.flags & FILTER_DROP) {
+    messagesDropped++;
+    return FILTER_DROP;
+  }
+
+  if (action.flags & FILTER_SCALE) scaleValue(status, data1, data2, action);
+  if (action.flags & FILTER_CHANNEL) status = (status & 0xF0) | action.channel;
+  if (action.flags & FILTER_DATA1) data1 = action.data1;
+
+  if (action.flags & (FILTER_SCALE | FILTER_CHANNEL | FILTER_DATA1)) messagesTransformed++;
+  if (action.flags & FILTER_THRU) messagesThru++;
+  messagesPassed++;
+  return action.flags;
+}
+
+// Lleva el valor (0-127) al rango min-max de la regla
+void MidiFilter::scaleValue(uint8_t status, uint8_t& data1, uint8_t& data2, const MidiFilterAction& action) {
+  int16_t span = (int16_t)action.scaleMax - action.scaleMin;
+
+  switch (status & 0xF0) {
+    case 0xC0:   // Program Change y Channel Pressure: valor en el primer byte
+    case 0xD0:
+      data1 = action.scaleMin + (data1 * span + (span >= 0 ? 63 : -63)) / 127;
+      break;
+
+    case 0xE0: {
+      // Pitch bend a 14 bits para no perder resolución
+      uint16_t value = data1 | (data2 << 7);
+      int32_t scaled = (action.scaleMin << 7) + ((int32_t)value * span) / 127;
+      scaled = constrain(scaled, 0, 16383);
+      data1 = scaled & 0x7F;
+      data2 = (scaled >> 7) & 0x7F;
+      break;
+    }
+
+    case 0x90:
+      if (data2 == 0) break;   // Velocidad 0 es Note Off: no convertirla en nota
+      // fall through
+    default:
+      data2 = action.scaleMin + (data2 * span + (span >= 0 ? 63 : -63)) / 127;
+      break;
+  }
+}
+
+void MidiFilter::printStatistics() const {
+  Serial.print(F("Filtro: ")); Serial.print(ruleCount);
+  Serial.print(F(" reglas, ")); Serial.print(tableCount);
+  Serial.print(F(" tablas | pasan ")); Serial.print(messagesPassed);
+  Serial.print(F(" | descartados ")); Serial.print(messagesDropped);
+  Serial.print(F(" | transformados ")); Serial.print(messagesTransformed);
+  Serial.print(F(" | thru ")); Serial.println(messagesThru);
+}
+
+void MidiFilter::resetStatistics() {
+  messagesPassed = 0;
+  messagesDropped = 0;
+  messagesTransformed = 0;
+  messagesThru = 0;
+}
@@ -0,0 +1,90 @@
+#ifndef MIDI_FILTER_H
+#define MIDI_FILTER_H
+
+#include "Config.h"
+#include <Arduino.h>
+
+// Filtro/transformación de mensajes de canal entrantes. Las reglas se leen de
+// un fichero de texto en la SD, una por línea ('#' comenta):
+//
+//   <acción> <tipo> <canal> <datos> [opciones]
+//
+//   acción:   pass | drop | remap | scale | thru
+//   tipo:     noteoff noteon note poly cc pc press bend any
+//   canal:    1-16, rango a-b o *
+//   datos:    primer byte de datos (nota, CC, programa) 0-127, rango a-b o *
+//   opciones: ch=N (canal de salida), d1=N (nota/CC de salida),
+//             min=N max=N (rango de salida del valor), thru (reenviar)
+//
+// Gana la primera regla que coincide. Las reglas se compilan a una tabla por
+// byte de estado y, si dependen del primer byte de datos, a una tabla de 128
+// entradas compartida entre estados iguales: cada mensaje cuesta dos lecturas.
+#define MIDI_FILTER_FILENAME      "/midifilter.txt"
+#define MIDI_FILTER_MAX_FILE      4096
+#define MIDI_FILTER_MAX_RULES     64
+#define MIDI_FILTER_MAX_TABLES    16     // 128 bytes cada una
+#define MIDI_FILTER_STATUS_COUNT  112    // Mensajes de canal: 0x80-0xEF
+
+#define FILTER_ACTION_NONE        0      // Sin regla: el mensaje pasa igual
+#define FILTER_TABLE_NONE         0xFF
+
+// Flags de acción (también es lo que devuelve apply())
+#define FILTER_DROP               0x01
+#define FILTER_THRU               0x02
+#define FILTER_CHANNEL            0x04
+#define FILTER_DATA1              0x08
+#define FILTER_SCALE              0x10
+
+struct MidiFilterAction {
+  uint8_t flags;
+  uint8_t channel;    // 0-15
+  uint8_t data1;
+  uint8_t scaleMin;
+  uint8_t scaleMax;
+};
+
+struct MidiFilterRule {
+  uint8_t typeMask;   // bit n = estado 0x80 + (n << 4)
+  uint8_t channelLow, channelHigh;
+  uint8_t data1Low, data1High;
+  MidiFilterAction action;
+};
+
+class MidiFilter {
+private:
+  uint8_t statusAction[MIDI_FILTER_STATUS_COUNT];
+  uint8_t statusTable[MIDI_FILTER_STATUS_COUNT];
+  uint8_t data1Tables[MIDI_FILTER_MAX_TABLES][128];
+  MidiFilterAction actions[MIDI_FILTER_MAX_RULES + 1];   // 0 = FILTER_ACTION_NONE
+  uint8_t ruleCount;
+  uint8_t tableCount;
+
+  // Estadísticas
+  uint32_t messagesPassed;
+  uint32_t messagesDropped;
+  uint32_t messagesTransformed;
+  uint32_t messagesThru;
+  uint32_t compileMicros;
+
+  bool parseRule(char* line, MidiFilterRule& rule);
+  bool buildTables(const uint8_t* map);
+  void scaleValue(uint8_t status, uint8_t& data1, uint8_t& data2, const MidiFilterAction& action);
+
+public:
+  MidiFilter();
+
+  void clear();
+  // Compila el texto de reglas (se modifica al separar tokens)
+  bool compile(char* text);
+  bool loadRules(const char* filename = MIDI_FILTER_FILENAME);
+
+  // Aplica la regla del mensaje; devuelve sus flags (FILTER_DROP, FILTER_THRU...)
+  uint8_t apply(uint8_t& status, uint8_t& data1, uint8_t& data2);
+
+  bool isActive() const { return ruleCount > 0; }
+  uint8_t getRuleCount() const { return ruleCount; }
+  void printStatistics() const;
+  void resetStatistics();
+};
+
+#endif // MIDI_FILTER_H
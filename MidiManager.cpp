@@ -2,38 +2,118 @@
 #include "Config.h"
 #include <USB.h>
 #include "EncoderManager.h"  // Add this include
+#include "LogManager.h"
+#include "SystemManager.h"
+#include "DisplayManager.h"
 
 // Inicializar la instancia estática
 MidiManager* MidiManager::instance = nullptr;
 extern EncoderManager encoderManager;  // Add this declaration
+extern SystemManager systemManager;
+extern DisplayManager displayManager;
 extern void syncEncoderFromDAW(uint8_t track, uint8_t bank, uint8_t value, uint16_t color);
 
+// Descriptor MIDI con un jack embebido de entrada y otro de salida por cable
+#define USB_MIDI_DESC_LEN  (TUD_MIDI_DESC_HEAD_LEN + USB_MIDI_CABLES * TUD_MIDI_DESC_JACK_LEN + \
+                            2 * TUD_MIDI_DESC_EP_LEN(USB_MIDI_CABLES))
+static_assert(USB_MIDI_CABLES == 3, "Actualizar los jacks del descriptor MIDI");
+static_assert(DIAG_REPORT_MAX_SIZE <= SYSEX_BUFFER_SIZE, "La respuesta de diagnóstico no cabe en un hueco SysEx");
+
+static const char* usbMidiName = "JMY Mackie";
+static bool usbMidiDescriptorLoaded = false;
+static bool usbMidiRegistered = false;
+
+// Llegada del último paquete USB-MIDI, anotada en tud_midi_rx_cb()
+static volatile uint32_t usbMidiRxMicros = 0;
+
+static uint16_t loadUsbMidiDescriptor(uint8_t* dst, uint8_t* itf) {
+  if (usbMidiDescriptorLoaded) return 0;
+  usbMidiDescriptorLoaded = true;
+  
+  uint8_t strIndex = tinyusb_add_string_descriptor(usbMidiName);
+  uint8_t epIn = tinyusb_get_free_in_endpoint();
+  uint8_t epOut = tinyusb_get_free_out_endpoint();
+  if (!epIn || !epOut) return 0;
+  epIn |= 0x80;
+  
+  uint8_t descriptor[USB_MIDI_DESC_LEN] = {
+    TUD_MIDI_DESC_HEAD(*itf, strIndex, USB_MIDI_CABLES),
+    TUD_MIDI_DESC_JACK_DESC(1, 0),
+    TUD_MIDI_DESC_JACK_DESC(2, 0),
+    TUD_MIDI_DESC_JACK_DESC(3, 0),
+    TUD_MIDI_DESC_EP(epOut, 64, USB_MIDI_CABLES),
+    TUD_MIDI_JACKID_IN_EMB(1), TUD_MIDI_JACKID_IN_EMB(2), TUD_MIDI_JACKID_IN_EMB(3),
+    TUD_MIDI_DESC_EP(epIn, 64, USB_MIDI_CABLES),
+    TUD_MIDI_JACKID_OUT_EMB(1), TUD_MIDI_JACKID_OUT_EMB(2), TUD_MIDI_JACKID_OUT_EMB(3)
+  };
+  *itf += 2;   // Audio Control + MIDI Streaming
+  memcpy(dst, descriptor, sizeof(descriptor));
+  return sizeof(descriptor);
+}
+
 
 MidiManager::MidiManager()
-  : currentMidiChannel(MIDI_CHANNEL_DEFAULT), mtcSync(true),
-    mtcQuarterFrame(0), lastMtcTime(0), mtcTimebaseValid(false),
+  : sysExSlotMask(0), nextCable(0), outputTokens(MIDI_OUTPUT_BURST), lastTokenRefill(0), budgetWaits(0),
+    inputBurst(0), rxMicros(0), eventTime(0),
+    sysExInLength(0), sysExInCable(0), sysExInOverflow(false),
+    dinParser(dinSysExBuffer, sizeof(dinSysExBuffer)), dinEnabled(false),
+    currentMidiChannel(MIDI_CHANNEL_DEFAULT), mtcSync(true),
     midiMessagesReceived(0), midiMessagesSent(0),
     sysExMessagesProcessed(0), mtcFramesReceived(0), errorCount(0),
-    midiThruEnabled(false), sysExAutoResponse(true), lastActivityTime(0)
+    trackMessages(0), trackBytes(0), trackParseMicros(0),
+    bankStateMessages(0), bankStateBytes(0), bankStateParseMicros(0),
+    nrpnSelectsSaved(0), midiThruEnabled(false), sysExAutoResponse(true), lastActivityTime(0)
 {
   instance = this;
-  memset(&currentMtc, 0, sizeof(currentMtc));
-  memset(&currentTransport, 0, sizeof(currentTransport));
+  currentTransport = TransportState();
+  memset(cableQueues, 0, sizeof(cableQueues));
+  memset(cableStats, 0, sizeof(cableStats));
+  memset(nrpnParam, 0xFF, sizeof(nrpnParam));   // NRPN_PARAM_NONE
+  
+  routeTable[ROUTE_CHANNEL] = CABLE_MAIN;
+  routeTable[ROUTE_TRANSPORT] = CABLE_MAIN;
+  routeTable[ROUTE_STUDIO_ONE] = CABLE_MAIN;
+  routeTable[ROUTE_SYSTEM] = CABLE_GENERIC;
+  routeTable[ROUTE_THRU] = CABLE_DIN;
 }
 
 MidiManager::~MidiManager() {
   instance = nullptr;
 }
 
+// TinyUSB sólo acepta interfaces nuevos antes de arrancar la pila: se llama
+// al principio de setup(), justo antes del único USB.begin()
+bool MidiManager::registerUsbInterface() {
+  usbMidiRegistered = tinyusb_enable_interface(USB_INTERFACE_MIDI, USB_MIDI_DESC_LEN,
+                                               loadUsbMidiDescriptor) == ESP_OK;
+  return usbMidiRegistered;
+}
+
 bool MidiManager::initialize(uint8_t midiChannel) {
   Serial.println(F("Inicializando controlador MIDI USB..."));
   
   currentMidiChannel = midiChannel;
-  USB.begin();
   
-  midiOutHead = 0;
-  midiOutTail = 0;
+  memset(cableQueues, 0, sizeof(cableQueues));
+  sysExSlotMask = 0;
+  nextCable = 0;
+  outputTokens = MIDI_OUTPUT_BURST;
+  lastTokenRefill = micros();
+  sysExInLength = 0;
+  memset(nrpnParam, 0xFF, sizeof(nrpnParam));
+  
+  // Segundo transporte: MIDI DIN por UART1
+  Serial1.begin(DIN_MIDI_BAUD, SERIAL_8N1, DIN_MIDI_RX_PIN, DIN_MIDI_TX_PIN);
+  dinParser.reset();
+  dinWriter.resetRunningStatus();
+  dinEnabled = true;
   
+  // El DIN queda operativo aunque fallara registerUsbInterface()
+  if (!usbMidiRegistered) {
+    Serial.println(F("ERROR: No se pudo registrar el interfaz USB-MIDI"));
+    return false;
+  }
+    
   Serial.println(F("Controlador MIDI USB inicializado"));
   return true;
 }
@@ -45,145 +125,421 @@ void MidiManager::setMidiChannel(uint8_t channel) {
 }
 
 void MidiManager::processMidiInput() {
+  uint32_t receivedBefore = midiMessagesReceived;
+  
   // Process USB MIDI input
   if (tud_midi_available()) {
     uint8_t packet[4];
     while (tud_midi_available()) {
       if (tud_midi_packet_read(packet)) {
+        rxMicros = usbMidiRxMicros;
         incrementMessageCount();
         updateLastActivityTime();
         processUsbMidiPacket(packet);
       }
     }
   }
+  
+  if (dinEnabled) processDinInput();
+  inputBurst = min(midiMessagesReceived - receivedBefore, (uint32_t)0xFFFF);
+}
+
+bool MidiManager::isBusy() const {
+  if (inputBurst >= MIDI_BUSY_BURST) return true;
+  for (uint8_t cable = 0; cable < MIDI_OUTPUT_PORTS; cable++) {
+    if (getQueueDepth(cable) >= MIDI_BUFFER_SIZE / 2) return true;
+  }
+  return false;
 }
 
+// Como mucho DIN_MIDI_MAX_BYTES por llamada: el UART tiene su propio buffer
+void MidiManager::processDinInput() {
+  MidiStreamMessage msg;
+  uint8_t budget = DIN_MIDI_MAX_BYTES;
+  
+  while (budget-- && Serial1.available()) {
+    if (!dinParser.parse(Serial1.read(), msg)) continue;
+    rxMicros = micros();
+        
+    incrementMessageCount();
+    updateLastActivityTime();
+    cableStats[CABLE_DIN].received++;
+    
+    if (msg.status == 0xF0) {
+      processSysExMessage(msg.sysEx, msg.sysExLength, CABLE_DIN);
+    } else if (msg.status >= 0xF0) {
+      processSystemMessage(msg.status, msg.data1, msg.data2);
+    } else {
+      processChannelMessage(msg.status, msg.data1, msg.data2);
+    }
+  }
+}
+
+// Por rondas de un mensaje por cable, empezando cada vez por el siguiente
+// cable: una ráfaga de SysEx en un puerto no retrasa los encoders de otro.
+// Primero el carril prioritario; la cola normal USB gasta presupuesto.
 void MidiManager::processMidiOutput() {
-  if (midiOutHead == midiOutTail) return;
+  refillOutputTokens();
   
-  MidiMessage msg = midiOutBuffer[midiOutTail];
-  uint8_t midiData[3];
+  bool limited = appConfig.midiOutputRate > 0;
+  uint8_t blocked = 0;        // bit n = puerto n sin sitio hasta la siguiente llamada
+  bool budgetWait = false;
+  bool progress = true;
   
-  switch (msg.type) {
-    case MIDI_TYPE_CC:
-      midiData[0] = 0xB0 | (msg.channel - 1);
-      midiData[1] = msg.data1;
-      midiData[2] = msg.data2;
-      tud_midi_stream_write(0, midiData, 3);
-      break;
+  while (progress) {
+    progress = false;
+    
+    for (uint8_t i = 0; i < MIDI_OUTPUT_PORTS; i++) {
+      uint8_t cable = (nextCable + i) % MIDI_OUTPUT_PORTS;
+      if (blocked & (1 << cable)) continue;
       
-    case MIDI_TYPE_NOTE_ON:
-      midiData[0] = 0x90 | (msg.channel - 1);
-      midiData[1] = msg.data1;
-      midiData[2] = msg.data2;
-      tud_midi_stream_write(0, midiData, 3);
-      break;
+      MidiCableQueue& queue = cableQueues[cable];
+      bool usb = cable != CABLE_DIN;
       
-    case MIDI_TYPE_NOTE_OFF:
-      midiData[0] = 0x80 | (msg.channel - 1);
-      midiData[1] = msg.data1;
-      midiData[2] = msg.data2;
-      tud_midi_stream_write(0, midiData, 3);
-      break;
+      // El estado de tud_midi_stream_write es del interfaz, no del cable: con
+      // un SysEx USB a medias sólo avanza ese cable hasta cerrarlo
+      if (usb) {
+        uint8_t owner = usbSysExInProgress();
+        if (owner < USB_MIDI_CABLES && owner != cable) continue;
+      }
       
-    case MIDI_TYPE_PITCH_BEND:
-      {
-        uint8_t lsb = msg.data1;
-        uint8_t msb = msg.data2;
-        midiData[0] = 0xE0 | (msg.channel - 1);
-        midiData[1] = lsb;
-        midiData[2] = msb;
-        tud_midi_stream_write(0, midiData, 3);
+      // Nunca en mitad de un SysEx: lo cortaría
+      bool priority = queue.priorityHead != queue.priorityTail && queue.sysExOffset == 0;
+      if (!priority) {
+        if (queue.head == queue.tail) continue;
+        if (usb && limited && outputTokens <= 0) {
+          budgetWait = true;
+          continue;
+        }
       }
-      break;
       
-    case MIDI_TYPE_SYSEX:
-      tud_midi_stream_write(0, sysExOutBuffer, msg.data1);
-      break;
+      const MidiMessage& msg = priority ? queue.priority[queue.priorityTail] : queue.buffer[queue.tail];
+      if (!writeMessage(cable, msg)) {
+        cableStats[cable].stalls++;
+        // El endpoint IN es compartido por los cables USB: si está lleno,
+        // ninguno puede avanzar; el DIN sigue a su ritmo
+        blocked |= usb ? ((1 << USB_MIDI_CABLES) - 1) : (1 << cable);
+        continue;
+      }
+      if (msg.eventTime) outputLatency.record(micros() - msg.eventTime);
+      
+      if (priority) {
+        queue.priorityTail = (queue.priorityTail + 1) % MIDI_PRIORITY_SLOTS;
+        cableStats[cable].prioritySent++;
+      } else {
+        queue.tail = (queue.tail + 1) % MIDI_BUFFER_SIZE;
+        if (usb && limited) outputTokens--;
+      }
+      midiMessagesSent++;
+      cableStats[cable].sent++;
+      lastActivityTime = millis();
+      progress = true;
+    }
+  }
+  
+  if (budgetWait) budgetWaits++;
+  nextCable = (nextCable + 1) % MIDI_OUTPUT_PORTS;
+}
+
+// Cable USB con un SysEx empezado, o USB_MIDI_CABLES si no hay ninguno
+uint8_t MidiManager::usbSysExInProgress() const {
+  for (uint8_t c = 0; c < USB_MIDI_CABLES; c++) {
+    if (cableQueues[c].sysExOffset != 0) return c;
+  }
+  return USB_MIDI_CABLES;
+}
+
+// Cubo de fichas: midiOutputRate por ms hasta MIDI_OUTPUT_BURST; el resto de
+// microsegundos se conserva para la siguiente llamada
+void MidiManager::refillOutputTokens() {
+  uint32_t now = micros();
+  uint8_t rate = appConfig.midiOutputRate;
+  uint32_t elapsed = now - lastTokenRefill;
+  
+  if (rate == 0 || elapsed >= 1000UL * MIDI_OUTPUT_BURST) {
+    outputTokens = MIDI_OUTPUT_BURST;
+    lastTokenRefill = now;
+    return;
+  }
+  
+  uint32_t earned = elapsed * rate / 1000;
+  if (earned == 0) return;
+  lastTokenRefill += earned * 1000 / rate;
+  outputTokens = min((int32_t)(outputTokens + earned), (int32_t)MIDI_OUTPUT_BURST);
+}
+
+uint8_t MidiManager::getQueueDepth(uint8_t cable) const {
+  const MidiCableQueue& queue = cableQueues[cable];
+  return (queue.head + MIDI_BUFFER_SIZE - queue.tail) % MIDI_BUFFER_SIZE;
+}
+
+uint8_t MidiManager::getOutputCredit(uint8_t cable) const {
+  cable = resolveCable(cable, ROUTE_CHANNEL);
+  
+  uint8_t depth = getQueueDepth(cable);
+  int16_t credit = depth < MIDI_CREDIT_DEPTH ? MIDI_CREDIT_DEPTH - depth : 0;
+  
+  // El presupuesto es común a los cables USB: descontar lo que ya espera en ellos
+  if (cable != CABLE_DIN && appConfig.midiOutputRate > 0) {
+    int16_t queued = 0;
+    for (uint8_t c = 0; c < USB_MIDI_CABLES; c++) queued += getQueueDepth(c);
+    credit = min(credit, (int16_t)(outputTokens - queued));
+  }
+  return credit > 0 ? credit : 0;
+}
+
+bool MidiManager::writeMessage(uint8_t cable, const MidiMessage& msg) {
+  if (cable == CABLE_DIN) return writeDinMessage(msg);
+  
+  uint8_t midiData[3];
+  uint8_t length = 3;
+    
+  switch (msg.type) {
+    case MIDI_TYPE_CC:        midiData[0] = 0xB0 | (msg.channel - 1); break;
+    case MIDI_TYPE_NOTE_ON:   midiData[0] = 0x90 | (msg.channel - 1); break;
+    case MIDI_TYPE_NOTE_OFF:  midiData[0] = 0x80 | (msg.channel - 1); break;
+    case MIDI_TYPE_PITCH_BEND: midiData[0] = 0xE0 | (msg.channel - 1); break;
+      
+    case MIDI_TYPE_SYSEX: {
+      // channel guarda el hueco; si el endpoint se llena a mitad, se sigue
+      // desde el mismo byte en la siguiente llamada
+      MidiCableQueue& queue = cableQueues[cable];
+      uint16_t remaining = msg.data1 - queue.sysExOffset;
+      uint32_t written = tud_midi_stream_write(cable, &sysExOutSlots[msg.channel][queue.sysExOffset], remaining);
+      cableStats[cable].bytesSent += written;
+      if (written < remaining) {
+        queue.sysExOffset += written;
+        return false;
+      }
+      queue.sysExOffset = 0;
+      sysExSlotMask &= ~(1 << msg.channel);
+      return true;
+    }
       
     case MIDI_TYPE_REALTIME:
-      tud_midi_stream_write(0, &msg.data1, 1);
+      midiData[0] = msg.data1;
+      length = 1;
+      break;
+      
+    case MIDI_TYPE_CHANNEL:
+      midiData[0] = msg.channel;
+      // Program Change y Channel Pressure solo llevan un byte de datos
+      if ((msg.channel & 0xE0) == 0xC0) length = 2;
       break;
+      
+    default:
+      return true;
   }
   
-  midiOutTail = (midiOutTail + 1) % MIDI_BUFFER_SIZE;
-  midiMessagesSent++;
-  lastActivityTime = millis();
+  if (msg.type != MIDI_TYPE_REALTIME) {
+    midiData[1] = msg.data1;
+    midiData[2] = msg.data2;
+  }
+    
+  if (tud_midi_stream_write(cable, midiData, length) == 0) return false;
+  cableStats[cable].bytesSent += length;
+  return true;
 }
 
-bool MidiManager::enqueueMidiMessage(uint8_t type, uint8_t channel, uint8_t data1, uint8_t data2) {
-  uint8_t nextHead = (midiOutHead + 1) % MIDI_BUFFER_SIZE;
+bool MidiManager::writeDinMessage(const MidiMessage& msg) {
+  MidiCableStats& stats = cableStats[CABLE_DIN];
+  uint8_t status;
   
-  if (nextHead == midiOutTail) {
-    errorCount++;
-    return false;
+  switch (msg.type) {
+    case MIDI_TYPE_CC:         status = 0xB0 | (msg.channel - 1); break;
+    case MIDI_TYPE_NOTE_ON:    status = 0x90 | (msg.channel - 1); break;
+    case MIDI_TYPE_NOTE_OFF:   status = 0x80 | (msg.channel - 1); break;
+    case MIDI_TYPE_PITCH_BEND: status = 0xE0 | (msg.channel - 1); break;
+    case MIDI_TYPE_CHANNEL:    status = msg.channel; break;
+    case MIDI_TYPE_REALTIME:   status = msg.data1; break;
+      
+    case MIDI_TYPE_SYSEX: {
+      // Lo que quepa en el FIFO del UART; el resto en la siguiente llamada
+      MidiCableQueue& queue = cableQueues[CABLE_DIN];
+      uint16_t remaining = msg.data1 - queue.sysExOffset;
+      uint16_t count = min((size_t)remaining, (size_t)Serial1.availableForWrite());
+      if (count > 0) {
+        Serial1.write(&sysExOutSlots[msg.channel][queue.sysExOffset], count);
+        dinWriter.resetRunningStatus();
+        dinWriter.countBytes(count);
+        stats.bytesSent += count;
+      }
+      if (count < remaining) {
+        queue.sysExOffset += count;
+        return false;
+      }
+      queue.sysExOffset = 0;
+      sysExSlotMask &= ~(1 << msg.channel);
+      return true;
+    }
+      
+    default:
+      return true;
   }
   
-  midiOutBuffer[midiOutHead].type = type;
-  midiOutBuffer[midiOutHead].channel = channel;
-  midiOutBuffer[midiOutHead].data1 = data1;
-  midiOutBuffer[midiOutHead].data2 = data2;
+  // El mensaje entero o nada: con running status no se puede partir
+  if (Serial1.availableForWrite() < 3) return false;
   
-  midiOutHead = nextHead;
+  uint8_t data[3];
+  uint8_t length = dinWriter.encode(status, msg.data1, msg.data2, data);
+  Serial1.write(data, length);
+  stats.bytesSent += length;
   return true;
 }
 
-bool MidiManager::enqueueSysExMessage(const uint8_t* data, uint16_t length) {
-  if (length > SYSEX_BUFFER_SIZE) {
+uint8_t MidiManager::resolveCable(uint8_t cable, uint8_t route) const {
+  if (cable < MIDI_OUTPUT_PORTS) return cable;
+  return routeTable[route];
+}
+
+bool MidiManager::enqueueMidiMessage(uint8_t cable, uint8_t type, uint8_t channel, uint8_t data1, uint8_t data2,
+                                     bool priority) {
+  MidiCableQueue& queue = cableQueues[cable];
+  
+  if (priority) {
+    uint8_t nextHead = (queue.priorityHead + 1) % MIDI_PRIORITY_SLOTS;
+    if (nextHead == queue.priorityTail) {
+      cableStats[cable].drops++;
+      errorCount++;
+      return false;
+    }
+    queue.priority[queue.priorityHead] = {type, channel, data1, data2, eventTime};
+    queue.priorityHead = nextHead;
+    return true;
+  }
+  
+  uint8_t nextHead = (queue.head + 1) % MIDI_BUFFER_SIZE;
+  
+  if (nextHead == queue.tail) {
+    cableStats[cable].drops++;
     errorCount++;
     return false;
   }
   
-  uint8_t nextHead = (midiOutHead + 1) % MIDI_BUFFER_SIZE;
+  queue.buffer[queue.head] = {type, channel, data1, data2, eventTime};
+  queue.head = nextHead;
   
-  if (nextHead == midiOutTail) {
+  uint8_t depth = getQueueDepth(cable);
+  if (depth > cableStats[cable].highWater) cableStats[cable].highWater = depth;
+  return true;
+}
+
+bool MidiManager::enqueueSysExMessage(uint8_t cable, const uint8_t* data, uint16_t length) {
+  if (length > SYSEX_BUFFER_SIZE || getSysExSlotsFree() == 0) {
     errorCount++;
     return false;
   }
   
-  memcpy(sysExOutBuffer, data, length);
-  midiOutBuffer[midiOutHead] = {MIDI_TYPE_SYSEX, 0, length, 0};
-  midiOutHead = nextHead;
+  // Los cables se vacían a distinto ritmo: los huecos se liberan en cualquier orden
+  uint8_t slot = __builtin_ctz(~sysExSlotMask);
+  memcpy(sysExOutSlots[slot], data, length);
+  if (!enqueueMidiMessage(cable, MIDI_TYPE_SYSEX, slot, (uint8_t)length, 0)) {
+    return false;
+  }
+  
+  sysExSlotMask |= (1 << slot);
   return true;
 }
 
-void MidiManager::sendControlChange(uint8_t channel, uint8_t cc, uint8_t value) {
+void MidiManager::sendControlChange(uint8_t channel, uint8_t cc, uint8_t value, uint8_t cable, bool priority) {
   if (!isValidMidiChannel(channel) || !isValidControlNumber(cc)) return;
+  cable = resolveCable(cable, ROUTE_CHANNEL);
+  
+  // Una selección NRPN/RPN ajena invalida el parámetro recordado
+  if (cc >= 98 && cc <= 101) nrpnParam[cable][channel - 1] = NRPN_PARAM_NONE;
   
-  if (!enqueueMidiMessage(MIDI_TYPE_CC, channel, cc, value)) {
+  if (!enqueueMidiMessage(cable, MIDI_TYPE_CC, channel, cc, value, priority)) {
     logMidiError("Buffer MIDI lleno");
   }
 }
 
-void MidiManager::sendNoteOn(uint8_t channel, uint8_t note, uint8_t velocity) {
+// Par MSB/LSB: el receptor pone el LSB a 0 al recibir un MSB, así que el MSB
+// va primero y se omite cuando no ha cambiado
+uint8_t MidiManager::sendControlChange14(uint8_t channel, uint8_t cc, uint16_t value, bool sendMsb, uint8_t cable) {
+  if (!isValidMidiChannel(channel) || cc >= CC_LSB_OFFSET) return 0;
+  cable = resolveCable(cable, ROUTE_CHANNEL);
+  
+  uint8_t queued = 0;
+  if (sendMsb) {
+    if (!enqueueMidiMessage(cable, MIDI_TYPE_CC, channel, cc, (value >> 7) & 0x7F)) {
+      logMidiError("Buffer MIDI lleno");
+      return queued;
+    }
+    queued++;
+  }
+  if (!enqueueMidiMessage(cable, MIDI_TYPE_CC, channel, cc + CC_LSB_OFFSET, value & 0x7F)) {
+    logMidiError("Buffer MIDI lleno");
+    return queued;
+  }
+  return queued + 1;
+}
+
+uint8_t MidiManager::sendNrpn(uint8_t channel, uint16_t param, uint16_t value, bool sendMsb, uint8_t cable) {
+  if (!isValidMidiChannel(channel)) return 0;
+  cable = resolveCable(cable, ROUTE_CHANNEL);
+  
+  uint8_t queued = 0;
+  uint16_t& selected = nrpnParam[cable][channel - 1];
+  
+  if (selected != param) {
+    if (!enqueueMidiMessage(cable, MIDI_TYPE_CC, channel, CC_NRPN_MSB, (param >> 7) & 0x7F) ||
+        !enqueueMidiMessage(cable, MIDI_TYPE_CC, channel, CC_NRPN_LSB, param & 0x7F)) {
+      selected = NRPN_PARAM_NONE;
+      logMidiError("Buffer MIDI lleno");
+      return 0;
+    }
+    selected = param;
+    sendMsb = true;   // Con otro parámetro el MSB anterior no vale
+    queued += 2;
+  } else {
+    nrpnSelectsSaved++;
+  }
+  
+  if (sendMsb) {
+    if (!enqueueMidiMessage(cable, MIDI_TYPE_CC, channel, CC_DATA_ENTRY_MSB, (value >> 7) & 0x7F)) {
+      logMidiError("Buffer MIDI lleno");
+      return queued;
+    }
+    queued++;
+  }
+  if (!enqueueMidiMessage(cable, MIDI_TYPE_CC, channel, CC_DATA_ENTRY_LSB, value & 0x7F)) {
+    logMidiError("Buffer MIDI lleno");
+    return queued;
+  }
+  return queued + 1;
+}
+
+void MidiManager::sendNoteOn(uint8_t channel, uint8_t note, uint8_t velocity, uint8_t cable) {
   if (!isValidMidiChannel(channel) || !isValidNoteNumber(note)) return;
   
-  if (!enqueueMidiMessage(MIDI_TYPE_NOTE_ON, channel, note, velocity)) {
+  if (!enqueueMidiMessage(resolveCable(cable, ROUTE_CHANNEL), MIDI_TYPE_NOTE_ON, channel, note, velocity)) {
     logMidiError("Buffer MIDI lleno");
   }
 }
 
-void MidiManager::sendNoteOff(uint8_t channel, uint8_t note, uint8_t velocity) {
+void MidiManager::sendNoteOff(uint8_t channel, uint8_t note, uint8_t velocity, uint8_t cable) {
   if (!isValidMidiChannel(channel) || !isValidNoteNumber(note)) return;
   
-  if (!enqueueMidiMessage(MIDI_TYPE_NOTE_OFF, channel, note, velocity)) {
+  if (!enqueueMidiMessage(resolveCable(cable, ROUTE_CHANNEL), MIDI_TYPE_NOTE_OFF, channel, note, velocity)) {
     logMidiError("Buffer MIDI lleno");
   }
 }
 
-void MidiManager::sendPitchBend(uint8_t channel, int16_t value) {
+void MidiManager::sendPitchBend(uint8_t channel, int16_t value, uint8_t cable) {
   if (!isValidMidiChannel(channel)) return;
   
-  uint8_t lsb = value & 0x7F;
-  uint8_t msb = (value >> 7) & 0x7F;
+  // -8192..8191 -> 0..16383 con el centro en 8192
+  uint16_t raw = constrain(value, -8192, 8191) + 8192;
+  uint8_t lsb = raw & 0x7F;
+  uint8_t msb = (raw >> 7) & 0x7F;
   
-  if (!enqueueMidiMessage(MIDI_TYPE_PITCH_BEND, channel, lsb, msb)) {
+  if (!enqueueMidiMessage(resolveCable(cable, ROUTE_CHANNEL), MIDI_TYPE_PITCH_BEND, channel, lsb, msb)) {
     logMidiError("Buffer MIDI lleno");
   }
 }
 
 void MidiManager::sendTransportCommand(uint8_t command) {
-  if (!enqueueMidiMessage(MIDI_TYPE_REALTIME, 0, command, 0)) {
+  if (!enqueueMidiMessage(routeTable[ROUTE_TRANSPORT], MIDI_TYPE_REALTIME, 0, command, 0, true)) {
     logMidiError("Buffer MIDI lleno");
   }
 }
@@ -203,7 +559,7 @@ void MidiManager::sendStudioOneColorRequest(uint8_t track, uint8_t bank) {
     0xF0, 0x00, 0x21, 0x7B, 0x01, track, bank, 0xF7
   };
   
-  if (!enqueueSysExMessage(sysexData, sizeof(sysexData))) {
+  if (!enqueueSysExMessage(routeTable[ROUTE_STUDIO_ONE], sysexData, sizeof(sysexData))) {
     logMidiError("No se pudo enviar solicitud de color");
   }
 }
@@ -213,28 +569,45 @@ void MidiManager::sendStudioOneValueRequest(uint8_t track, uint8_t bank) {
     0xF0, 0x00, 0x21, 0x7B, 0x02, track, bank, 0xF7
   };
   
-  if (!enqueueSysExMessage(sysexData, sizeof(sysexData))) {
+  if (!enqueueSysExMessage(routeTable[ROUTE_STUDIO_ONE], sysexData, sizeof(sysexData))) {
     logMidiError("No se pudo enviar solicitud de valor");
   }
 }
 
+// Pide al DAW las secciones indicadas de las 16 pistas en un solo mensaje
+void MidiManager::sendStudioOneBankStateRequest(uint8_t bank, uint8_t sections) {
+  uint8_t sysexData[8];
+  uint16_t length = StudioOneProtocol::buildBankStateRequest(bank, sections, sysexData);
+  
+  if (!enqueueSysExMessage(routeTable[ROUTE_STUDIO_ONE], sysexData, length)) {
+    logMidiError("No se pudo enviar solicitud de estado de banco");
+  }
+}
+
+void MidiManager::sendStudioOneResendRequest(uint8_t bank, uint16_t fromSeq, uint16_t toSeq) {
+  uint8_t sysexData[11];
+  uint16_t length = StudioOneProtocol::buildResendRequest(bank, fromSeq, toSeq, sysexData);
+  
+  if (!enqueueSysExMessage(routeTable[ROUTE_STUDIO_ONE], sysexData, length)) {
+    logMidiError("No se pudo enviar solicitud de reenvío");
+  }
+}
+
 void MidiManager::sendCustomSysEx(const uint8_t* data, uint16_t length) {
-  if (!enqueueSysExMessage(data, length)) {
+  if (!enqueueSysExMessage(routeTable[ROUTE_SYSTEM], data, length)) {
     logMidiError("No se pudo enviar SysEx personalizado");
   }
 }
 
+// Los paquetes se leen solo desde processMidiInput() en el loop: un SysEx
+// llega en varios paquetes y no puede ensamblarse desde dos contextos. Aquí
+// solo se anota la hora: el loop puede tardar milisegundos en leerlos y el
+// reloj MIDI se mediría con ese retraso
 extern "C" void tud_midi_rx_cb(uint8_t itf) {
+  usbMidiRxMicros = micros();
   MidiManager* manager = MidiManager::getInstance();
   if (manager) {
-    uint8_t packet[4];
-    while (tud_midi_available()) {
-      if (tud_midi_packet_read(packet)) {
-        manager->incrementMessageCount();
-        manager->updateLastActivityTime();
-        manager->processUsbMidiPacket(packet);
-      }
-    }
+    manager->updateLastActivityTime();
   }
 }
 
@@ -243,8 +616,18 @@ void MidiManager::processUsbMidiPacket(const uint8_t* packet) {
   
   uint8_t cableNumber = (packet[0] >> 4) & 0x0F;
   uint8_t codeIndexNumber = packet[0] & 0x0F;
-  (void)cableNumber;
+  if (cableNumber < USB_MIDI_CABLES) cableStats[cableNumber].received++;
   
+  // Un SysEx entrante se ensambla entero desde un mismo cable
+  if (codeIndexNumber >= 0x4 && codeIndexNumber <= 0x7) {
+    if (sysExInLength > 0 && cableNumber != sysExInCable) {
+      logMidiError("SysEx entrelazado entre cables");
+      sysExInLength = 0;
+      sysExInOverflow = false;
+    }
+    if (sysExInLength == 0) sysExInCable = cableNumber;
+  }
+    
   switch (codeIndexNumber) {
     case 0x8: // Note Off
     case 0x9: // Note On
@@ -253,7 +636,36 @@ void MidiManager::processUsbMidiPacket(const uint8_t* packet) {
     case 0xC: // Program Change
     case 0xD: // Channel Pressure
     case 0xE: // Pitch Bend
-      processMidiMessage(packet[1], packet[2], packet[3]);
+      processChannelMessage(packet[1], packet[2], packet[3]);
+      break;
+      
+    case 0x2: // System Common de 2 bytes (cuarto de frame MTC, Song Select)
+      processSystemMessage(packet[1], packet[2], 0);
+      break;
+      
+    case 0x3: // System Common de 3 bytes (Song Position Pointer)
+      processSystemMessage(packet[1], packet[2], packet[3]);
+      break;
+      
+    case 0x4: // SysEx inicio o continuación (3 bytes)
+      appendSysExBytes(&packet[1], 3);
+      break;
+      
+    case 0x5: // SysEx termina con 1 byte (o System Common de 1 byte)
+    case 0x6: // SysEx termina con 2 bytes
+    case 0x7: // SysEx termina con 3 bytes
+      if (codeIndexNumber == 0x5 && packet[1] != 0xF7 && sysExInLength == 0) {
+        processSystemMessage(packet[1], 0, 0);
+        break;
+      }
+      appendSysExBytes(&packet[1], codeIndexNumber - 0x4);
+      if (sysExInOverflow) {
+        logMidiError("SysEx entrante demasiado largo");
+      } else if (sysExInLength > 0) {
+        processSysExMessage(sysExInBuffer, sysExInLength, sysExInCable);
+      }
+      sysExInLength = 0;
+      sysExInOverflow = false;
       break;
       
     case 0xF: // Single Byte (Real-time)
@@ -268,79 +680,219 @@ void MidiManager::processUsbMidiPacket(const uint8_t* packet) {
   }
 }
 
-void MidiManager::processMidiMessage(uint8_t status, uint8_t data1, uint8_t data2) {
-  uint8_t messageType = (status >> 4) & 0x0F;
-  uint8_t channel = (status & 0x0F) + 1;
+// Mensajes de canal de cualquier transporte: filtro, thru y proceso
+void MidiManager::processChannelMessage(uint8_t status, uint8_t data1, uint8_t data2) {
+  uint8_t flags = midiFilter.apply(status, data1, data2);
+  if (flags & FILTER_DROP) return;
   
-  // Add your MIDI message processing logic here
-  // This is a basic implementation
-  Serial.print(F("MIDI Message - Type: "));
-  Serial.print(messageType, HEX);
-  Serial.print(F(", Ch: "));
-  Serial.println(channel);
+  if ((flags & FILTER_THRU) || midiThruEnabled) {
+    enqueueMidiMessage(routeTable[ROUTE_THRU], MIDI_TYPE_CHANNEL, status, data1, data2);
+  }
+  processMidiMessage(status, data1, data2);
+}
+
+void MidiManager::appendSysExBytes(const uint8_t* data, uint8_t count) {
+  for (uint8_t i = 0; i < count; i++) {
+    if (data[i] == 0xF0) {
+      // Un F0 siempre abre mensaje nuevo, aunque el anterior quedara a medias
+      sysExInLength = 0;
+      sysExInOverflow = false;
+    } else if (sysExInLength == 0) {
+      continue; // Bytes sin F0 previo
+    }
+    
+    if (sysExInLength < SYSEX_IN_BUFFER_SIZE) {
+      sysExInBuffer[sysExInLength++] = data[i];
+    } else {
+      sysExInOverflow = true;
+    }
+  }
+}
+
+void MidiManager::processSysExMessage(const uint8_t* data, uint16_t length, uint8_t cable) {
+  if (length < 5 || data[0] != 0xF0 || data[length - 1] != 0xF7) {
+    errorCount++;
+    return;
+  }
+  
+  // Fabricante 00 21 7B: script de Studio One
+  if (StudioOneProtocol::isStudioOneMessage(data, length)) {
+    unsigned long startTime = micros();
+    uint8_t type = data[4];
+    
+    processStudioOneMessage(data, length, cable);
+    
+    // Solo se comparan los mensajes que el estado en bloque sustituye; las
+    // consultas, deltas y reenvíos no entran en ninguna de las dos cuentas
+    uint32_t elapsed = micros() - startTime;
+    if (type == SYSEX_BANK_STATE) {
+      bankStateMessages++;
+      bankStateBytes += length;
+      bankStateParseMicros += elapsed;
+    } else if (isPerTrackMessage(type)) {
+      trackMessages++;
+      trackBytes += length;
+      trackParseMicros += elapsed;
+    }
+  } else if (MidiTimecode::isFullFrame(data, length)) {
+    // Universal real-time: frame completo MTC (localización)
+    if (mtcSync) midiTimecode.onFullFrame(data, length);
+  } else if (isIdentityRequest(data, length)) {
+    if (sysExAutoResponse) sendIdentityReply(cable);
+  }
+}
+
+// Valor, color y nombre de una pista: lo que un estado de banco lleva de
+// las 16 pistas de una vez
+bool MidiManager::isPerTrackMessage(uint8_t type) {
+  return type == SYSEX_COLOR_UPDATE || type == SYSEX_VALUE_UPDATE ||
+         type == SYSEX_NAME_UPDATE || type == SYSEX_VALUE_COLOR;
+}
+
+// Universal non-real-time: F0 7E <dispositivo> 06 01 F7
+bool MidiManager::isIdentityRequest(const uint8_t* data, uint16_t length) const {
+  return length == 6 && data[1] == 0x7E && data[3] == 0x06 && data[4] == 0x01;
+}
+
+// Fabricante 00 21 7B (el mismo que el script), familia 1, modelo 1 y versión del firmware
+void MidiManager::sendIdentityReply(uint8_t cable) {
+  const uint8_t reply[] = {
+    0xF0, 0x7E, 0x7F, 0x06, 0x02,
+    0x00, 0x21, 0x7B,
+    0x01, 0x00,
+    0x01, 0x00,
+    FIRMWARE_VERSION_MAJOR, FIRMWARE_VERSION_MINOR, FIRMWARE_VERSION_PATCH, 0x00,
+    0xF7
+  };
+  
+  if (!enqueueSysExMessage(resolveCable(cable, ROUTE_SYSTEM), reply, sizeof(reply))) {
+    logMidiError("No se pudo enviar respuesta de identidad");
+  }
+}
+
+// Respuesta a SYSEX_DIAGNOSTICS por el cable de la consulta; el orden de
+// los campos es el protocolo (tools/diag_cli.py los nombra)
+void MidiManager::sendDiagnostics(uint8_t section, uint8_t index, uint8_t cable) {
+  uint32_t fields[DIAG_MAX_FIELDS];
+  uint8_t count = 0;
+  
+  switch (section) {
+    case DIAG_SECTION_MIDI:
+      fields[count++] = midiMessagesReceived;
+      fields[count++] = midiMessagesSent;
+      fields[count++] = sysExMessagesProcessed;
+      fields[count++] = mtcFramesReceived;
+      fields[count++] = errorCount;
+      fields[count++] = budgetWaits;
+      fields[count++] = nrpnSelectsSaved;
+      fields[count++] = trackMessages;
+      fields[count++] = bankStateMessages;
+      fields[count++] = dinParser.getBytesParsed();
+      fields[count++] = dinWriter.getBytesSaved();
+      break;
+      
+    case DIAG_SECTION_PORT:
+      if (index < MIDI_OUTPUT_PORTS) {
+        const MidiCableStats& stats = cableStats[index];
+        fields[count++] = stats.sent;
+        fields[count++] = stats.received;
+        fields[count++] = stats.bytesSent;
+        fields[count++] = stats.drops;
+        fields[count++] = stats.stalls;
+        fields[count++] = stats.prioritySent;
+        fields[count++] = stats.highWater;
+        fields[count++] = getQueueDepth(index);
+      }
+      break;
+      
+    case DIAG_SECTION_HISTOGRAM:
+      if (index == DIAG_HISTOGRAM_LOOP) {
+        count = StudioOneProtocol::histogramFields(systemManager.getLoopTime(), fields);
+      } else if (index == DIAG_HISTOGRAM_LATENCY) {
+        count = StudioOneProtocol::histogramFields(outputLatency, fields);
+      }
+      break;
+      
+    case DIAG_SECTION_HEAP:
+      fields[count++] = ESP.getFreeHeap();
+      fields[count++] = ESP.getMinFreeHeap();
+      fields[count++] = ESP.getMaxAllocHeap();
+      fields[count++] = ESP.getHeapSize();
+      fields[count++] = ESP.getFreePsram();
+      fields[count++] = millis();
+      fields[count++] = getSysExSlotsFree();
+      break;
+      
+    case DIAG_SECTION_ENCODERS:
+      count = encoderManager.getDiagnostics(fields);
+      break;
+      
+    case DIAG_SECTION_DISPLAY:
+      if (index == DIAG_DISPLAY_FRAMES) {
+        count = displayManager.getFrameDiagnostics(fields);
+      } else if (index == DIAG_DISPLAY_POWER) {
+        count = displayManager.getPowerDiagnostics(fields);
+      }
+      break;
+      
+    case DIAG_SECTION_RESET:
+      resetStatistics();
+      encoderManager.resetStatistics();
+      systemManager.resetStatistics();
+      displayManager.resetFrameStatistics();
+      break;
+  }
+  
+  uint8_t report[DIAG_REPORT_MAX_SIZE];
+  uint16_t length = StudioOneProtocol::buildDiagnosticsReport(section, index, fields, count, report);
+  if (!enqueueSysExMessage(resolveCable(cable, ROUTE_SYSTEM), report, length)) {
+    logMidiError("No se pudo enviar informe de diagnóstico");
+  }
+}
+
+void MidiManager::sendLatencyReport(uint8_t cable) {
+  uint8_t report[LATENCY_REPORT_SIZE];
+  uint16_t length = StudioOneProtocol::buildLatencyReport(outputLatency, report);
+  
+  if (!enqueueSysExMessage(resolveCable(cable, ROUTE_SYSTEM), report, length)) {
+    logMidiError("No se pudo enviar informe de latencia");
+  }
+}
+
+// Bit 0: reproducción, bit 1: grabación, bit 2: pausa
+void MidiManager::processTransportState(uint8_t state) {
+  currentTransport.isPlaying = state & 0x01;
+  currentTransport.isRecording = state & 0x02;
+  currentTransport.isPaused = state & 0x04;
+}
+
+void MidiManager::processMidiMessage(uint8_t status, uint8_t data1, uint8_t data2) {
+  LOG_DEBUG(LOG_EVT_MIDI_IN, status, data1, data2, 0);
 }
 
 void MidiManager::processRealTimeMessage(uint8_t status) {
   switch (status) {
     case 0xF8: // Timing Clock
+      midiClock.onClock(rxMicros);
       break;
     case 0xFA: // Start
       currentTransport.isPlaying = true;
       currentTransport.isPaused = false;
+      midiClock.onStart();
       break;
     case 0xFB: // Continue
       currentTransport.isPlaying = true;
       currentTransport.isPaused = false;
+      midiClock.onContinue();
       break;
     case 0xFC: // Stop
       currentTransport.isPlaying = false;
       currentTransport.isPaused = false;
+      midiClock.onStop();
       break;
   }
 }
 
-void MidiManager::updateMtcFromQuarterFrame(uint8_t data) {
-  uint8_t pieceType = (data >> 4) & 0x07;
-  uint8_t pieceValue = data & 0x0F;
-  
-  switch (pieceType) {
-    case 0: currentMtc.frames = (currentMtc.frames & 0xF0) | pieceValue; break;
-    case 1: currentMtc.frames = (currentMtc.frames & 0x0F) | (pieceValue << 4); break;
-    case 2: currentMtc.seconds = (currentMtc.seconds & 0xF0) | pieceValue; break;
-    case 3: currentMtc.seconds = (currentMtc.seconds & 0x0F) | (pieceValue << 4); break;
-    case 4: currentMtc.minutes = (currentMtc.minutes & 0xF0) | pieceValue; break;
-    case 5: currentMtc.minutes = (currentMtc.minutes & 0x0F) | (pieceValue << 4); break;
-    case 6: currentMtc.hours = (currentMtc.hours & 0xF0) | pieceValue; break;
-    case 7: 
-      currentMtc.hours = (currentMtc.hours & 0x0F) | (pieceValue << 4);
-      currentMtc.isRunning = (pieceValue & 0x06) != 0;
-      break;
-  }
-  
-  mtcQuarterFrame = pieceType;
-  lastMtcTime = millis();
-  
-  if (pieceType == 7) {
-    reconstructMtcTime();
-  }
-}
-
-void MidiManager::reconstructMtcTime() {
-  if (validateMtcData()) {
-    mtcTimebaseValid = true;
-  } else {
-    mtcTimebaseValid = false;
-    errorCount++;
-  }
-}
-
-bool MidiManager::validateMtcData() {
-  return (currentMtc.frames < 30 && 
-          currentMtc.seconds < 60 && 
-          currentMtc.minutes < 60 && 
-          currentMtc.hours < 24);
-}
-
 uint16_t MidiManager::rgb24ToRgb565(uint32_t rgb24) {
   uint8_t r = (rgb24 >> 16) & 0xFF;
   uint8_t g = (rgb24 >> 8) & 0xFF;
@@ -356,9 +908,7 @@ uint32_t MidiManager::rgb565ToRgb24(uint16_t rgb565) {
 }
 
 void MidiManager::resetMtcTimebase() {
-  memset(&currentMtc, 0, sizeof(currentMtc));
-  mtcQuarterFrame = 0;
-  mtcTimebaseValid = false;
+  midiTimecode.reset();
 }
 
 void MidiManager::printMidiStatistics() const {
@@ -368,6 +918,43 @@ void MidiManager::printMidiStatistics() const {
   Serial.print(F("Mensajes SysEx: ")); Serial.println(sysExMessagesProcessed);
   Serial.print(F("Frames MTC: ")); Serial.println(mtcFramesReceived);
   Serial.print(F("Errores: ")); Serial.println(errorCount);
+  
+  // Un banco completo por pista son 16 x (valor + color + nombre) mensajes
+  if (trackMessages > 0) {
+    Serial.print(F("Por pista: ")); Serial.print(trackBytes / trackMessages);
+    Serial.print(F(" B/msg, ")); Serial.print(trackParseMicros / trackMessages);
+    Serial.print(F(" us/msg -> banco ~")); Serial.print(trackBytes / trackMessages * NUM_ENCODERS * 3);
+    Serial.print(F(" B, ")); Serial.print(trackParseMicros / trackMessages * NUM_ENCODERS * 3);
+    Serial.println(F(" us"));
+  }
+  if (bankStateMessages > 0) {
+    Serial.print(F("Estado de banco: ")); Serial.print(bankStateBytes / bankStateMessages);
+    Serial.print(F(" B/banco, ")); Serial.print(bankStateParseMicros / bankStateMessages);
+    Serial.println(F(" us/banco"));
+  }
+  Serial.print(F("Selecciones NRPN ahorradas: ")); Serial.println(nrpnSelectsSaved);
+  Serial.print(F("Limite de salida: ")); Serial.print(appConfig.midiOutputRate);
+  Serial.print(F(" msg/ms | esperas de presupuesto ")); Serial.println(budgetWaits);
+  outputLatency.print("Latencia encoder->USB");
+  Serial.print(F("DIN rx: ")); dinParser.printStatistics();
+  Serial.print(F("DIN tx: ")); Serial.print(dinWriter.getBytesWritten());
+  Serial.print(F(" B | estados omitidos ")); Serial.println(dinWriter.getBytesSaved());
+  midiFilter.printStatistics();
+  
+  static const char* const cableNames[MIDI_OUTPUT_PORTS] = {"Principal", "Extensor", "Generico", "DIN"};
+  for (uint8_t cable = 0; cable < MIDI_OUTPUT_PORTS; cable++) {
+    const MidiCableStats& stats = cableStats[cable];
+    Serial.print(F("Cable ")); Serial.print(cable); Serial.print(F(" (")); Serial.print(cableNames[cable]);
+    Serial.print(F("): tx ")); Serial.print(stats.sent);
+    Serial.print(F(" (prioritarios ")); Serial.print(stats.prioritySent); Serial.print(')');
+    Serial.print(F(" (")); Serial.print(stats.bytesSent);
+    Serial.print(F(" B) | rx ")); Serial.print(stats.received);
+    Serial.print(F(" | descartes ")); Serial.print(stats.drops);
+    Serial.print(F(" | esperas ")); Serial.print(stats.stalls);
+    Serial.print(F(" | cola max ")); Serial.println(stats.highWater);
+  }
+  midiClock.printStatistics();
+  midiTimecode.printStatistics();
   Serial.println(F("========================\n"));
 }
 
@@ -377,6 +964,21 @@ void MidiManager::resetStatistics() {
   sysExMessagesProcessed = 0;
   mtcFramesReceived = 0;
   errorCount = 0;
+  trackMessages = 0;
+  trackBytes = 0;
+  trackParseMicros = 0;
+  bankStateMessages = 0;
+  bankStateBytes = 0;
+  bankStateParseMicros = 0;
+  nrpnSelectsSaved = 0;
+  budgetWaits = 0;
+  outputLatency.reset();
+  memset(cableStats, 0, sizeof(cableStats));
+  midiFilter.resetStatistics();
+  dinParser.resetStatistics();
+  dinWriter.resetStatistics();
+  midiClock.resetStatistics();
+  midiTimecode.resetStatistics();
 }
 
 bool MidiManager::testMidiConnection() {
@@ -420,7 +1022,7 @@ void MidiManager::logMidiError(const char* error) {
 
 // Añade estas funciones a MidiManager.cpp
 
-void MidiManager::processStudioOneMessage(const uint8_t* data, uint16_t length) {
+void MidiManager::processStudioOneMessage(const uint8_t* data, uint16_t length, uint8_t cable) {
     if (length < 8 || data[0] != 0xF0 || data[1] != 0x00 || data[2] != 0x21 || data[3] != 0x7B) {
         return;
     }
@@ -468,7 +1070,38 @@ void MidiManager::processStudioOneMessage(const uint8_t* data, uint16_t length)
             }
             break;
             
-        case 0x06: // Mensaje combinado valor + color
+        case SYSEX_BANK_STATE:
+            {
+                BankStateMessage state;
+                if (StudioOneProtocol::parseBankState(data, length, state)) {
+                    syncBankStateFromDAW(state);
+                } else {
+                    logMidiError("Estado de banco mal formado");
+                }
+            }
+            break;
+            
+        case SYSEX_VALUE_DELTA:
+            {
+                ValueDeltaMessage delta;
+                if (StudioOneProtocol::parseValueDelta(data, length, delta)) {
+                    syncValueDeltaFromDAW(delta);
+                } else {
+                    logMidiError("Delta de valores mal formado");
+                }
+            }
+            break;
+            
+        case SYSEX_LATENCY_QUERY:
+            sendLatencyReport(cable);
+            if (data[5] & LATENCY_QUERY_RESET) outputLatency.reset();
+            break;
+            
+        case SYSEX_DIAGNOSTICS:
+            sendDiagnostics(data[5], data[6], cable);
+            break;
+            
+        case SYSEX_VALUE_COLOR: // Mensaje combinado valor + color
             if (length >= 12) {
                 uint8_t value = data[7];
                 uint32_t rgb24 = (data[8] << 16) | (data[9] << 8) | data[10];
@@ -486,35 +1119,24 @@ void MidiManager::processStudioOneMessage(const uint8_t* data, uint16_t length)
 void MidiManager::processSystemMessage(uint8_t status, uint8_t data1, uint8_t data2) {
     switch (status) {
         case 0xF1: // MTC Quarter Frame
-            updateMtcFromQuarterFrame(data1);
-            mtcFramesReceived++;
+            if (mtcSync && midiTimecode.onQuarterFrame(data1, rxMicros)) {
+                mtcFramesReceived++;
+            }
             break;
             
-        case 0xF2: // Song Position Pointer
-            // No implementado para Studio One
+        case 0xF2: // Song Position Pointer (semicorcheas, LSB primero)
+            midiClock.onSongPosition(data1 | (data2 << 7));
             break;
             
         case 0xF3: // Song Select
             // No implementado para Studio One
             break;
             
-        case 0xF8: // Timing Clock
-            currentTransport.isPlaying = true;
-            break;
-            
+        case 0xF8: // Timing Clock: no implica reproducción
         case 0xFA: // Start
-            currentTransport.isPlaying = true;
-            currentTransport.isPaused = false;
-            break;
-            
         case 0xFB: // Continue
-            currentTransport.isPlaying = true;
-            currentTransport.isPaused = false;
-            break;
-            
         case 0xFC: // Stop
-            currentTransport.isPlaying = false;
-            currentTransport.isPaused = false;
+            processRealTimeMessage(status);
             break;
             
         case 0xFE: // Active Sensing
@@ -524,7 +1146,8 @@ void MidiManager::processSystemMessage(uint8_t status, uint8_t data1, uint8_t da
             
         case 0xFF: // System Reset
             resetMtcTimebase();
-            memset(&currentTransport, 0, sizeof(currentTransport));
+            currentTransport = TransportState();
+            midiClock.reset();
             break;
     }
 }
\ No newline at end of file
@@ -4,6 +4,11 @@
 #include "Config.h"
 #include <Arduino.h>
 #include "esp32-hal-tinyusb.h"
+#include "StudioOneProtocol.h"
+#include "MidiClock.h"
+#include "MidiTimecode.h"
+#include "MidiFilter.h"
+#include "MidiStream.h"
 
 // Definiciones de tipos de mensajes MIDI
 #define MIDI_TYPE_CC          0
@@ -12,66 +17,171 @@
 #define MIDI_TYPE_PITCH_BEND  3
 #define MIDI_TYPE_SYSEX       4
 #define MIDI_TYPE_REALTIME    5
+#define MIDI_TYPE_CHANNEL     6   // Mensaje de canal tal cual (channel = byte de estado), para thru
 
 #define SYSEX_COLOR_UPDATE    0x01
 #define SYSEX_VALUE_UPDATE    0x02
 #define SYSEX_NAME_UPDATE     0x03
 #define SYSEX_VU_UPDATE       0x04
 #define SYSEX_TRANSPORT       0x05
+#define SYSEX_VALUE_COLOR     0x06
+#define SYSEX_BANK_STATE      0x07   // Estado de banco en bloque (ver StudioOneProtocol.h)
+#define SYSEX_VALUE_DELTA     0x08   // Realimentación secuenciada con deltas
+#define SYSEX_FEEDBACK_RESEND 0x09   // Petición de reenvío de un rango de secuencias
+#define SYSEX_LATENCY_QUERY   0x0A   // Consulta del histograma de latencia encoder -> USB
+#define SYSEX_DIAGNOSTICS     0x0B   // Consulta de estadísticas por secciones (ver StudioOneProtocol.h)
+
+// Cola de SysEx salientes: un hueco por mensaje en vuelo
+#define SYSEX_OUT_SLOTS       8
+#define SYSEX_IN_BUFFER_SIZE  BANK_STATE_MAX_SIZE
+
+// Controladores de 14 bits: par MSB/LSB (CC n / n+32) y NRPN
+#define CC_LSB_OFFSET         32
+#define CC_DATA_ENTRY_MSB     6
+#define CC_DATA_ENTRY_LSB     38
+#define CC_NRPN_LSB           98
+#define CC_NRPN_MSB           99
+#define NRPN_PARAM_NONE       0xFFFF
+
+// Bytes del UART DIN procesados por llamada (31250 baudios = ~3 bytes/ms)
+#define DIN_MIDI_MAX_BYTES    32
+
+// Cable sin fijar: se elige por la tabla de rutas según el tipo de mensaje
+#define MIDI_CABLE_ROUTED     0xFF
+
+enum MidiRoute {
+  ROUTE_CHANNEL = 0,     // CC, notas y pitch bend sin cable propio
+  ROUTE_TRANSPORT,       // Transporte y tiempo real
+  ROUTE_STUDIO_ONE,      // Peticiones SysEx del script de Studio One
+  ROUTE_SYSTEM,          // SysEx personalizados
+  ROUTE_THRU,            // Reenvío de mensajes entrantes (por defecto al DIN)
+  MIDI_ROUTE_COUNT
+};
 
 struct MidiMessage {
     uint8_t type;
     uint8_t channel;
     uint8_t data1;
     uint8_t data2;
+    uint32_t eventTime;     // micros() de la entrada que lo generó (0 = sin medir)
+};
+
+// Cola de salida propia por cable: un cable lento no bloquea a los demás
+struct MidiCableQueue {
+    MidiMessage buffer[MIDI_BUFFER_SIZE];
+    uint8_t head;
+    uint8_t tail;
+    uint16_t sysExOffset;   // Bytes ya escritos del SysEx en cabeza
+    // Carril prioritario: sale antes que la cola normal y sin gastar presupuesto
+    MidiMessage priority[MIDI_PRIORITY_SLOTS];
+    uint8_t priorityHead;
+    uint8_t priorityTail;
+};
+
+struct MidiCableStats {
+    uint32_t sent;
+    uint32_t received;
+    uint32_t bytesSent;
+    uint32_t drops;         // Cola llena al encolar
+    uint32_t stalls;        // Endpoint lleno al escribir
+    uint32_t prioritySent;
+    uint8_t highWater;      // Máxima ocupación de la cola
 };
 
 class MidiManager {
 private:
-    int midiOutHead = 0;
-    int midiOutTail = 0;
-    MidiMessage midiOutBuffer[MIDI_BUFFER_SIZE];
-    uint8_t sysExOutBuffer[SYSEX_BUFFER_SIZE];
+    MidiCableQueue cableQueues[MIDI_OUTPUT_PORTS];
+    MidiCableStats cableStats[MIDI_OUTPUT_PORTS];
+    uint8_t routeTable[MIDI_ROUTE_COUNT];
+    uint8_t sysExOutSlots[SYSEX_OUT_SLOTS][SYSEX_BUFFER_SIZE];
+    uint8_t sysExSlotMask;   // bit n = hueco n en uso
+    uint8_t nextCable;       // Primer cable a atender en el siguiente turno
     
-    MtcData currentMtc;
+    // Presupuesto de salida USB (appConfig.midiOutputRate mensajes/ms)
+    int16_t outputTokens;
+    uint32_t lastTokenRefill;
+    uint32_t budgetWaits;    // Llamadas en que la cola normal esperó al presupuesto
+    uint16_t inputBurst;     // Mensajes leídos en la última pasada de entrada
+    uint32_t rxMicros;       // Llegada del mensaje en proceso (reloj y MTC)
+    
+    // Latencia desde la interrupción del encoder hasta entregar el mensaje a
+    // TinyUSB (o al UART); eventTime marca los mensajes que se encolan
+    uint32_t eventTime;
+    LatencyHistogram outputLatency;
+    
+    // Ensamblado de SysEx entrantes (CIN 0x4-0x7)
+    uint8_t sysExInBuffer[SYSEX_IN_BUFFER_SIZE];
+    uint16_t sysExInLength;
+    uint8_t sysExInCable;
+    bool sysExInOverflow;
+    
+    // Puerto DIN: flujo de bytes con running status en ambos sentidos
+    uint8_t dinSysExBuffer[SYSEX_IN_BUFFER_SIZE];
+    MidiStreamParser dinParser;
+    MidiStreamWriter dinWriter;
+    bool dinEnabled;
+    
+    MidiTimecode midiTimecode;
     TransportState currentTransport;
+    MidiClock midiClock;
+    MidiFilter midiFilter;
     uint8_t currentMidiChannel;
     bool mtcSync;
     
-    uint8_t mtcQuarterFrame;
-    uint32_t lastMtcTime;
-    bool mtcTimebaseValid;
-    
     uint32_t midiMessagesReceived;
     uint32_t midiMessagesSent;
     uint32_t sysExMessagesProcessed;
     uint32_t mtcFramesReceived;
     uint32_t errorCount;
     
+    // Coste de sincronización: mensajes por pista frente a estado en bloque
+    uint32_t trackMessages;
+    uint32_t trackBytes;
+    uint32_t trackParseMicros;
+    uint32_t bankStateMessages;
+    uint32_t bankStateBytes;
+    uint32_t bankStateParseMicros;
+    
+    // Último parámetro NRPN seleccionado por cable y canal: evita repetir CC 99/98
+    uint16_t nrpnParam[MIDI_OUTPUT_PORTS][16];
+    uint32_t nrpnSelectsSaved;
+    
     bool midiThruEnabled;
     bool sysExAutoResponse;
     unsigned long lastActivityTime;
     
-    void processSysExMessage(const uint8_t* data, uint16_t length);
-    void processStudioOneMessage(const uint8_t* data, uint16_t length);
+    void appendSysExBytes(const uint8_t* data, uint8_t count);
+    void processChannelMessage(uint8_t status, uint8_t data1, uint8_t data2);
+    void processDinInput();
+    bool writeDinMessage(const MidiMessage& msg);
+    // 'cable': por donde llegó el mensaje; las respuestas vuelven por él
+    void processSysExMessage(const uint8_t* data, uint16_t length, uint8_t cable);
+    void processStudioOneMessage(const uint8_t* data, uint16_t length, uint8_t cable);
     void processColorUpdate(uint8_t track, uint8_t bank, const uint8_t* colorData);
     void processValueUpdate(uint8_t track, uint8_t bank, uint8_t value);
     void processVUUpdate(uint8_t track, uint8_t level);
     void processNameUpdate(uint8_t track, uint8_t bank, const char* name);
     void processTransportState(uint8_t state);
     
-    void updateMtcFromQuarterFrame(uint8_t data);
-    void reconstructMtcTime();
-    bool validateMtcData();
-    
     uint16_t rgb24ToRgb565(uint32_t rgb24);
     uint32_t rgb565ToRgb24(uint16_t rgb565);
     void logMidiError(const char* error);
-    bool enqueueMidiMessage(uint8_t type, uint8_t channel, uint8_t data1, uint8_t data2);
-    bool enqueueSysExMessage(const uint8_t* data, uint16_t length);
+    uint8_t resolveCable(uint8_t cable, uint8_t route) const;
+    bool writeMessage(uint8_t cable, const MidiMessage& msg);
+    void refillOutputTokens();
+    uint8_t usbSysExInProgress() const;
+    uint8_t getQueueDepth(uint8_t cable) const;
+    bool enqueueMidiMessage(uint8_t cable, uint8_t type, uint8_t channel, uint8_t data1, uint8_t data2,
+                            bool priority = false);
+    bool enqueueSysExMessage(uint8_t cable, const uint8_t* data, uint16_t length);
     void processMidiMessage(uint8_t status, uint8_t data1, uint8_t data2);
     void processSystemMessage(uint8_t status, uint8_t data1, uint8_t data2);
     void processRealTimeMessage(uint8_t status);
+    bool isIdentityRequest(const uint8_t* data, uint16_t length) const;
+    static bool isPerTrackMessage(uint8_t type);
+    void sendIdentityReply(uint8_t cable);
+    void sendLatencyReport(uint8_t cable);
+    void sendDiagnostics(uint8_t section, uint8_t index, uint8_t cable);
 
 public:
     MidiManager();
@@ -79,6 +189,7 @@ public:
     
     static MidiManager* getInstance() { return instance; }
 
+    static bool registerUsbInterface();
     bool initialize(uint8_t midiChannel = MIDI_CHANNEL_DEFAULT);
     void setMidiChannel(uint8_t channel);
     uint8_t getMidiChannel() const { return currentMidiChannel; }
@@ -86,22 +197,44 @@ public:
     void processMidiInput();
     void processMidiOutput();
     void processUsbMidiPacket(const uint8_t* packet);
+    // Ráfaga de entrada o colas de salida a media capacidad: la pantalla cede
+    bool isBusy() const;
 
-    void sendControlChange(uint8_t channel, uint8_t cc, uint8_t value);
-    void sendNoteOn(uint8_t channel, uint8_t note, uint8_t velocity);
-    void sendNoteOff(uint8_t channel, uint8_t note, uint8_t velocity);
-    void sendPitchBend(uint8_t channel, int16_t value);
+    void sendControlChange(uint8_t channel, uint8_t cc, uint8_t value, uint8_t cable = MIDI_CABLE_ROUTED,
+                           bool priority = false);
+    void sendNoteOn(uint8_t channel, uint8_t note, uint8_t velocity, uint8_t cable = MIDI_CABLE_ROUTED);
+    void sendNoteOff(uint8_t channel, uint8_t note, uint8_t velocity, uint8_t cable = MIDI_CABLE_ROUTED);
+    void sendPitchBend(uint8_t channel, int16_t value, uint8_t cable = MIDI_CABLE_ROUTED);
+    // Devuelven cuántos mensajes se han encolado (para contar ancho de banda)
+    uint8_t sendControlChange14(uint8_t channel, uint8_t cc, uint16_t value, bool sendMsb,
+                                uint8_t cable = MIDI_CABLE_ROUTED);
+    uint8_t sendNrpn(uint8_t channel, uint16_t param, uint16_t value, bool sendMsb,
+                     uint8_t cable = MIDI_CABLE_ROUTED);
     void sendTransportCommand(uint8_t command);
+    // Mensajes que se pueden encolar ya en el cable sin pasarse del presupuesto
+    // ni llenar la cola; los encoders esperan su turno si no llega
+    uint8_t getOutputCredit(uint8_t cable) const;
+    // Marca de tiempo para los mensajes que se encolen hasta volver a 0
+    void setEventTime(uint32_t time) { eventTime = time; }
+    const LatencyHistogram& getOutputLatency() const { return outputLatency; }
+    const MidiCableStats& getCableStats(uint8_t cable) const { return cableStats[cable]; }
     void sendJogWheel(int8_t direction);
     void sendAllNotesOff(uint8_t channel);
     
     void sendStudioOneColorRequest(uint8_t track, uint8_t bank);
     void sendStudioOneValueRequest(uint8_t track, uint8_t bank);
+    void sendStudioOneBankStateRequest(uint8_t bank, uint8_t sections = BANK_STATE_ALL);
+    void sendStudioOneResendRequest(uint8_t bank, uint16_t fromSeq, uint16_t toSeq);
+    uint8_t getSysExSlotsFree() const { return SYSEX_OUT_SLOTS - __builtin_popcount(sysExSlotMask); }
     void sendCustomSysEx(const uint8_t* data, uint16_t length);
     
-    const MtcData& getMtcData() const { return currentMtc; }
+    const MtcData& getMtcData() { return midiTimecode.getDisplayTime(appConfig.mtcOffset); }
     const TransportState& getTransportState() const { return currentTransport; }
-    bool isMtcSynced() const { return mtcSync && mtcTimebaseValid; }
+    const ClockData& getClockData() { return midiClock.getData(); }
+    bool isMtcSynced() const { return mtcSync && midiTimecode.isLocked(); }
+    
+    void setRoute(MidiRoute route, MidiCable cable) { routeTable[route] = cable; }
+    uint8_t getRoute(MidiRoute route) const { return routeTable[route]; }
     
     void enableMtcSync(bool enable) { mtcSync = enable; }
     bool isMtcSyncEnabled() const { return mtcSync; }
@@ -118,6 +251,7 @@ public:
     
     void setMidiThru(bool enable);
     void setSysExAutoResponse(bool enable);
+    bool loadFilterRules() { return midiFilter.loadRules(); }
     void incrementMessageCount() { midiMessagesReceived++; }
     void updateLastActivityTime() { lastActivityTime = millis(); }
     
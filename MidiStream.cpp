@@ -0,0 +1,188 @@
+#include "MidiStream.h"
+
+MidiStreamParser::MidiStreamParser(uint8_t* sysExBuffer, uint16_t sysExCapacity)
+  : sysExBuffer(sysExBuffer), sysExCapacity(sysExCapacity),
+    bytesParsed(0), messagesParsed(0), runningStatusHits(0), strayBytes(0), sysExAborted(0)
+{
+  reset();
+}
+
+void MidiStreamParser::reset() {
+  sysExLength = 0;
+  inSysEx = false;
+  sysExOverflow = false;
+  status = 0;
+  statusFresh = false;
+  dataCount = 0;
+  dataExpected = 0;
+}
+
+// Bytes de datos tras cada estado; 0xF4/0xF5 no están definidos
+uint8_t MidiStreamParser::dataLength(uint8_t status) {
+  switch (status & 0xF0) {
+    case 0xC0:
+    case 0xD0:
+      return 1;
+    case 0xF0:
+      if (status == 0xF1 || status == 0xF3) return 1;
+      if (status == 0xF2) return 2;
+      return 0;
+    default:
+      return 2;
+  }
+}
+
+bool MidiStreamParser::parse(uint8_t byte, MidiStreamMessage& msg) {
+  bytesParsed++;
+
+  // Tiempo real: puede llegar entre cualquier par de bytes sin alterar nada
+  if (byte >= 0xF8) {
+    msg.status = byte;
+    msg.data1 = 0;
+    msg.data2 = 0;
+    messagesParsed++;
+    return true;
+  }
+
+  if (byte < 0x80) {
+    if (inSysEx) {
+      if (sysExLength < sysExCapacity) {
+        sysExBuffer[sysExLength++] = byte;
+      } else {
+        sysExOverflow = true;
+      }
+      return false;
+    }
+
+    if (!status) {
+      strayBytes++;
+      return false;
+    }
+
+    data[dataCount++] = byte;
+    if (dataCount < dataExpected) return false;
+
+    msg.status = status;
+    msg.data1 = data[0];
+    msg.data2 = dataExpected == 2 ? data[1] : 0;
+    if (!statusFresh) runningStatusHits++;
+    statusFresh = false;
+    dataCount = 0;
+    if (status >= 0xF0) status = 0;   // System Common no deja running status
+    messagesParsed++;
+    return true;
+  }
+
+  if (byte == 0xF7) {
+    if (!inSysEx) {
+      strayBytes++;
+      return false;
+    }
+    inSysEx = false;
+    if (sysExOverflow || sysExLength >= sysExCapacity) {
+      sysExAborted++;
+      return false;
+    }
+    sysExBuffer[sysExLength++] = 0xF7;
+    msg.status = 0xF0;
+    msg.sysEx = sysExBuffer;
+    msg.sysExLength = sysExLength;
+    messagesParsed++;
+    return true;
+  }
+
+  // Cualquier otro estado cierra un SysEx sin F7
+  if (inSysEx) {
+    inSysEx = false;
+    sysExAborted++;
+  }
+  dataCount = 0;
+
+  if (byte == 0xF0) {
+    status = 0;
+    inSysEx = true;
+    sysExOverflow = false;
+    sysExBuffer[0] = 0xF0;
+    sysExLength = 1;
+    return false;
+  }
+
+  if (byte == 0xF4 || byte == 0xF5) {
+    status = 0;
+    return false;
+  }
+
+  status = byte;
+  statusFresh = true;
+  dataExpected = dataLength(byte);
+  if (dataExpected == 0) {
+    // Tune Request: completo con el estado
+    msg.status = byte;
+    msg.data1 = 0;
+    msg.data2 = 0;
+    status = 0;
+    messagesParsed++;
+    return true;
+  }
+  return false;
+}
+
+void MidiStreamParser::printStatistics() const {
+  Serial.print(F("Bytes: ")); Serial.print(bytesParsed);
+  Serial.print(F(" | mensajes ")); Serial.print(messagesParsed);
+  Serial.print(F(" | running status ")); Serial.print(runningStatusHits);
+  Serial.print(F(" | sueltos ")); Serial.print(strayBytes);
+  Serial.print(F(" | SysEx cortados ")); Serial.println(sysExAborted);
+}
+
+void MidiStreamParser::resetStatistics() {
+  bytesParsed = 0;
+  messagesParsed = 0;
+  runningStatusHits = 0;
+  strayBytes = 0;
+  sysExAborted = 0;
+}
+
+MidiStreamWriter::MidiStreamWriter()
+  : runningStatus(0), bytesWritten(0), bytesSaved(0)
+{
+}
+
+uint8_t MidiStreamWriter::encode(uint8_t status, uint8_t data1, uint8_t data2, uint8_t* out) {
+  if (status >= 0xF8) {
+    out[0] = status;
+    bytesWritten++;
+    return 1;
+  }
+
+  uint8_t dataBytes = MidiStreamParser::dataLength(status);
+  uint8_t length = 0;
+
+  if (status >= 0xF0) {
+    runningStatus = 0;
+    out[length++] = status;
+  } else {
+    // Note Off con velocidad por defecto = Note On a 0: mantiene el running status
+    if ((status & 0xF0) == 0x80 && runningStatus == (status | 0x10) && data2 == 0x40) {
+      status |= 0x10;
+      data2 = 0;
+    }
+
+    if (status == runningStatus) {
+      bytesSaved++;
+    } else {
+      runningStatus = status;
+      out[length++] = status;
+    }
+  }
+
+  if (dataBytes > 0) out[length++] = data1 & 0x7F;
+  if (dataBytes > 1) out[length++] = data2 & 0x7F;
+  bytesWritten += length;
+  return length;
+}
+
+void MidiStreamWriter::resetStatistics() {
+  bytesWritten = 0;
+  bytesSaved = 0;
+}
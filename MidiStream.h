@@ -0,0 +1,76 @@
+#ifndef MIDI_STREAM_H
+#define MIDI_STREAM_H
+
+#include <Arduino.h>
+
+// MIDI como flujo de bytes (DIN de 5 pines, UART, enlaces serie), sin las
+// cabeceras de 4 bytes de USB. Sin memoria dinámica: el buffer de SysEx lo
+// aporta quien crea el parser.
+
+struct MidiStreamMessage {
+  uint8_t status;          // 0xF0 = SysEx completo en sysEx/sysExLength
+  uint8_t data1;
+  uint8_t data2;
+  const uint8_t* sysEx;    // Incluye F0 y F7
+  uint16_t sysExLength;
+};
+
+class MidiStreamParser {
+private:
+  uint8_t* sysExBuffer;
+  uint16_t sysExCapacity;
+  uint16_t sysExLength;
+  bool inSysEx;
+  bool sysExOverflow;
+
+  uint8_t status;          // Estado en curso; se conserva (running status) en mensajes de canal
+  bool statusFresh;        // El mensaje en curso trae su propio byte de estado
+  uint8_t data[2];
+  uint8_t dataCount;
+  uint8_t dataExpected;
+
+  // Estadísticas
+  uint32_t bytesParsed;
+  uint32_t messagesParsed;
+  uint32_t runningStatusHits;
+  uint32_t strayBytes;      // Datos sin estado o F7 sin F0
+  uint32_t sysExAborted;    // SysEx cortado por otro estado o demasiado largo
+
+public:
+  MidiStreamParser(uint8_t* sysExBuffer, uint16_t sysExCapacity);
+
+  void reset();
+  // Devuelve true cuando el byte completa un mensaje (que queda en msg)
+  bool parse(uint8_t byte, MidiStreamMessage& msg);
+
+  static uint8_t dataLength(uint8_t status);
+
+  uint32_t getBytesParsed() const { return bytesParsed; }
+  uint32_t getMessagesParsed() const { return messagesParsed; }
+  void printStatistics() const;
+  void resetStatistics();
+};
+
+class MidiStreamWriter {
+private:
+  uint8_t runningStatus;
+
+  uint32_t bytesWritten;
+  uint32_t bytesSaved;      // Bytes de estado omitidos por running status
+
+public:
+  MidiStreamWriter();
+
+  // Codifica un mensaje de canal, System Common o tiempo real (hasta 3 bytes);
+  // omite el byte de estado si coincide con el anterior
+  uint8_t encode(uint8_t status, uint8_t data1, uint8_t data2, uint8_t* out);
+  // Los SysEx (y cualquier escritura ajena al writer) anulan el running status
+  void resetRunningStatus() { runningStatus = 0; }
+  void countBytes(uint16_t count) { bytesWritten += count; }
+
+  uint32_t getBytesWritten() const { return bytesWritten; }
+  uint32_t getBytesSaved() const { return bytesSaved; }
+  void resetStatistics();
+};
+
+#endif // MIDI_STREAM_H
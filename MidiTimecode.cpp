@@ -0,0 +1,227 @@
+#include "MidiTimecode.h"
+
+MidiTimecode::MidiTimecode()
+  : quarterFrames(0), framesDecoded(0), fullFrames(0), sequenceBreaks(0), invalidFrames(0),
+    directionChanges(0), maxFrameCostMicros(0), totalFrameCostMicros(0)
+{
+  reset();
+}
+
+void MidiTimecode::reset() {
+  memset(pieces, 0, sizeof(pieces));
+  pieceMask = 0;
+  lastPiece = -1;
+  direction = 1;
+  positionQuarters = 0;
+  lastQuarterMicros = 0;
+  quarterIntervalMicros = 0;
+  rate = MTC_DEFAULT_RATE;
+  locked = false;
+  running = false;
+  display = MtcData();
+  display.frameRate = rate;
+}
+
+uint8_t MidiTimecode::nominalFps(uint8_t rate) {
+  switch (rate) {
+    case MTC_RATE_24: return 24;
+    case MTC_RATE_25: return 25;
+    default: return 30;   // 29,97 DF cuenta 30 etiquetas por segundo
+  }
+}
+
+// La dirección sale del orden de las piezas: 0,1,2.. adelante y 7,6,5.. atrás.
+// Un salto rompe la secuencia y obliga a reunir ocho piezas de nuevo.
+bool MidiTimecode::onQuarterFrame(uint8_t data, uint32_t timestampMicros) {
+  uint32_t start = micros();
+  int8_t piece = (data >> 4) & 0x07;
+  bool completed = false;
+  quarterFrames++;
+
+  if (lastPiece >= 0) {
+    int8_t step = 0;
+    if (piece == ((lastPiece + 1) & 0x07)) step = 1;
+    else if (piece == ((lastPiece - 1) & 0x07)) step = -1;
+
+    if (step == 0) {
+      sequenceBreaks++;
+      pieceMask = 0;
+    } else {
+      if (step != direction) {
+        directionChanges++;
+        direction = step;
+        pieceMask = 0;
+      }
+      if (locked) positionQuarters += direction;
+
+      uint32_t interval = timestampMicros - lastQuarterMicros;
+      if (interval < MTC_STOP_TIMEOUT_US) {
+        // Media exponencial 1/4: sigue cambios de tasa sin saltar con el jitter
+        quarterIntervalMicros = quarterIntervalMicros
+          ? (quarterIntervalMicros * 3 + interval) / 4
+          : interval;
+      }
+    }
+  }
+
+  pieces[piece] = data & 0x0F;
+  pieceMask |= (1 << piece);
+  lastPiece = piece;
+  lastQuarterMicros = timestampMicros;
+  running = true;
+
+  // Tiempo completo al cerrar la secuencia: pieza 7 hacia delante, 0 hacia atrás
+  uint8_t lastOfSequence = direction > 0 ? 7 : 0;
+  if (pieceMask == 0xFF && piece == lastOfSequence) {
+    MtcData time;
+    decodePieces(time);
+    if (isValid(time)) {
+      rate = time.frameRate;
+      // El tiempo codificado es el del frame en que empezó la secuencia;
+      // desde entonces han pasado siete cuartos de frame
+      positionQuarters = toFrames(time) * MTC_QUARTERS_PER_FRAME + 7 * direction;
+      locked = true;
+      framesDecoded++;
+      completed = true;
+    } else {
+      invalidFrames++;
+    }
+    pieceMask = 0;
+  }
+
+  uint32_t cost = micros() - start;
+  if (cost > maxFrameCostMicros) maxFrameCostMicros = cost;
+  totalFrameCostMicros += cost;
+  return completed;
+}
+
+bool MidiTimecode::isFullFrame(const uint8_t* data, uint16_t length) {
+  return length == MTC_FULL_FRAME_SIZE && data[0] == 0xF0 && data[1] == 0x7F &&
+         data[3] == 0x01 && data[4] == 0x01 && data[9] == 0xF7;
+}
+
+// Localización: el DAW salta a un tiempo sin estar reproduciendo
+bool MidiTimecode::onFullFrame(const uint8_t* data, uint16_t length) {
+  if (!isFullFrame(data, length)) return false;
+
+  MtcData time;
+  time.frameRate = (data[5] >> 5) & 0x03;
+  time.hours = data[5] & 0x1F;
+  time.minutes = data[6] & 0x3F;
+  time.seconds = data[7] & 0x3F;
+  time.frames = data[8] & 0x1F;
+  if (!isValid(time)) {
+    invalidFrames++;
+    return false;
+  }
+
+  rate = time.frameRate;
+  positionQuarters = toFrames(time) * MTC_QUARTERS_PER_FRAME;
+  pieceMask = 0;
+  lastPiece = -1;
+  locked = true;
+  running = false;
+  fullFrames++;
+  return true;
+}
+
+void MidiTimecode::decodePieces(MtcData& time) const {
+  time.frames = pieces[0] | ((pieces[1] & 0x01) << 4);
+  time.seconds = pieces[2] | ((pieces[3] & 0x03) << 4);
+  time.minutes = pieces[4] | ((pieces[5] & 0x03) << 4);
+  time.hours = pieces[6] | ((pieces[7] & 0x01) << 4);
+  time.frameRate = (pieces[7] >> 1) & 0x03;
+}
+
+bool MidiTimecode::isValid(const MtcData& time) const {
+  if (time.frames >= nominalFps(time.frameRate) || time.seconds >= 60 ||
+      time.minutes >= 60 || time.hours >= 24) {
+    return false;
+  }
+  // En drop-frame no existen los frames 0 y 1 al inicio de cada minuto salvo los décimos
+  if (time.frameRate == MTC_RATE_2997_DF && time.seconds == 0 &&
+      time.frames < 2 && time.minutes % 10 != 0) {
+    return false;
+  }
+  return true;
+}
+
+int32_t MidiTimecode::toFrames(const MtcData& time) const {
+  uint8_t fps = nominalFps(time.frameRate);
+  int32_t frames = ((int32_t)time.hours * 3600 + time.minutes * 60 + time.seconds) * fps + time.frames;
+
+  if (time.frameRate == MTC_RATE_2997_DF) {
+    int32_t totalMinutes = time.hours * 60 + time.minutes;
+    frames -= 2 * (totalMinutes - totalMinutes / 10);
+  }
+  return frames;
+}
+
+void MidiTimecode::fromFrames(int32_t frames, MtcData& time) const {
+  uint8_t fps = nominalFps(rate);
+  int32_t framesPerDay = (int32_t)24 * 3600 * fps;
+
+  if (rate == MTC_RATE_2997_DF) {
+    framesPerDay -= 2 * (24 * 60 - 24 * 6);
+    frames = ((frames % framesPerDay) + framesPerDay) % framesPerDay;
+    // Reponer las etiquetas descartadas para volver a contar a 30
+    int32_t tens = frames / MTC_DF_FRAMES_10MIN;
+    int32_t rest = frames % MTC_DF_FRAMES_10MIN;
+    frames += 18 * tens;
+    if (rest >= 2) frames += 2 * ((rest - 2) / MTC_DF_FRAMES_MIN);
+  } else {
+    frames = ((frames % framesPerDay) + framesPerDay) % framesPerDay;
+  }
+
+  time.frames = frames % fps;
+  frames /= fps;
+  time.seconds = frames % 60;
+  frames /= 60;
+  time.minutes = frames % 60;
+  time.hours = frames / 60;
+  time.frameRate = rate;
+}
+
+const MtcData& MidiTimecode::getDisplayTime(int8_t offsetFrames) {
+  if (!locked) {
+    display.isRunning = false;
+    return display;
+  }
+
+  uint32_t elapsed = micros() - lastQuarterMicros;
+  if (running && elapsed >= MTC_STOP_TIMEOUT_US) running = false;
+
+  // Interpolar dentro del cuarto de frame en curso (como mucho uno entero)
+  int32_t quarters = positionQuarters * 16;
+  if (running && quarterIntervalMicros) {
+    uint32_t fraction = min(elapsed, quarterIntervalMicros) * 16 / quarterIntervalMicros;
+    quarters += direction * (int32_t)fraction;
+  }
+
+  int32_t frames = quarters / (16 * MTC_QUARTERS_PER_FRAME) + offsetFrames;
+  fromFrames(frames, display);
+  display.isRunning = running;
+  return display;
+}
+
+void MidiTimecode::printStatistics() const {
+  Serial.print(F("MTC: ")); Serial.print(framesDecoded);
+  Serial.print(F(" tiempos | localizaciones ")); Serial.print(fullFrames);
+  Serial.print(F(" | secuencias rotas ")); Serial.print(sequenceBreaks);
+  Serial.print(F(" | inválidos ")); Serial.print(invalidFrames);
+  Serial.print(F(" | cambios de sentido ")); Serial.println(directionChanges);
+  Serial.print(F("Coste por cuarto de frame (us): media "));
+  Serial.print(quarterFrames ? (uint32_t)(totalFrameCostMicros / quarterFrames) : 0);
+  Serial.print(F(" | máx ")); Serial.println(maxFrameCostMicros);
+}
+
+void MidiTimecode::resetStatistics() {
+  quarterFrames = 0;
+  framesDecoded = 0;
+  fullFrames = 0;
+  sequenceBreaks = 0;
+  invalidFrames = 0;
+  directionChanges = 0;
+  maxFrameCostMicros = 0;
+  totalFrameCostMicros = 0;
+}
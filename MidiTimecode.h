@@ -0,0 +1,66 @@
+#ifndef MIDI_TIMECODE_H
+#define MIDI_TIMECODE_H
+
+#include "Config.h"
+#include <Arduino.h>
+
+// MIDI Time Code: cuartos de frame (F1) y mensaje de frame completo
+//   F0 7F <dispositivo> 01 01 <0rrhhhhh> <mm> <ss> <ff> F7
+#define MTC_FULL_FRAME_SIZE       10
+#define MTC_QUARTERS_PER_FRAME    4
+#define MTC_PIECES                8      // Un tiempo completo ocupa dos frames
+#define MTC_STOP_TIMEOUT_US       150000 // Sin cuartos de frame: transporte parado
+#define MTC_DF_FRAMES_10MIN       17982  // Frames de 10 minutos en 29,97 drop-frame
+#define MTC_DF_FRAMES_MIN         1798   // Frames de un minuto que descarta 2
+
+class MidiTimecode {
+private:
+  uint8_t pieces[MTC_PIECES];   // Nibbles recibidos, indexados por tipo de pieza
+  uint8_t pieceMask;            // Piezas recibidas desde la última secuencia rota
+  int8_t lastPiece;             // -1 = ninguna
+  int8_t direction;             // +1 adelante, -1 atrás
+
+  // Posición en cuartos de frame desde 00:00:00:00 y su marca de tiempo
+  int32_t positionQuarters;
+  uint32_t lastQuarterMicros;
+  uint32_t quarterIntervalMicros;
+  uint8_t rate;                 // MtcRate
+  bool locked;                  // Hay un tiempo completo decodificado
+  bool running;
+
+  MtcData display;
+
+  // Estadísticas
+  uint32_t quarterFrames;
+  uint32_t framesDecoded;
+  uint32_t fullFrames;
+  uint32_t sequenceBreaks;
+  uint32_t invalidFrames;
+  uint32_t directionChanges;
+  uint32_t maxFrameCostMicros;
+  uint64_t totalFrameCostMicros;
+
+  void decodePieces(MtcData& time) const;
+  bool isValid(const MtcData& time) const;
+  int32_t toFrames(const MtcData& time) const;
+  void fromFrames(int32_t frames, MtcData& time) const;
+
+public:
+  MidiTimecode();
+
+  void reset();
+  bool onQuarterFrame(uint8_t data, uint32_t timestampMicros);
+  bool onFullFrame(const uint8_t* data, uint16_t length);
+
+  static bool isFullFrame(const uint8_t* data, uint16_t length);
+  static uint8_t nominalFps(uint8_t rate);
+
+  // Tiempo para mostrar: interpolado entre cuartos de frame y con el offset aplicado
+  const MtcData& getDisplayTime(int8_t offsetFrames);
+  bool isLocked() const { return locked; }
+
+  void printStatistics() const;
+  void resetStatistics();
+};
+
+#endif // MIDI_TIMECODE_H
@@ -0,0 +1,228 @@
+#include "MixerScene.h"
+#include "SmoothFont.h"
+
+static const char* const widgetNames[WIDGET_TYPE_COUNT] = {
+  "fader", "pan", "vu", "etiqueta", "banco", "MTC", "reloj", "transporte"
+};
+
+MixerScene::MixerScene()
+  : widgetCount(0), channelCount(0), view(VIEW_STRIPS_8), screenWidth(0), screenHeight(0),
+    headerHeight(HEADER_HEIGHT)
+{
+  memset(widgets, 0, sizeof(widgets));
+}
+
+bool MixerScene::build(uint16_t width, uint16_t height, MixerView newView) {
+  static const uint8_t viewChannels[VIEW_COUNT] = { NUM_ENCODERS / 2, NUM_ENCODERS, 1 };
+  
+  screenWidth = width;
+  screenHeight = height;
+  view = newView < VIEW_COUNT ? newView : VIEW_STRIPS_8;
+  channelCount = min(viewChannels[view], (uint8_t)SCENE_MAX_CHANNELS);
+  widgetCount = channelCount * CHANNEL_WIDGETS + GLOBAL_WIDGETS;
+  memset(widgets, 0, sizeof(widgets));
+  
+  // En vertical las tiras no caben en una fila: van en dos
+  bool portrait = height > width;
+  buildHeader(portrait);
+  switch (view) {
+    case VIEW_STRIPS_16:
+      buildNarrowStrips(portrait ? 2 : 1);
+      break;
+    case VIEW_SINGLE:
+      buildDetail();
+      break;
+    default:
+      buildStrips(portrait && channelCount > 4 ? 2 : 1);
+      break;
+  }
+
+  invalidateAll();
+  return validate();
+}
+
+void MixerScene::place(uint8_t index, uint8_t type, uint8_t channel, int16_t x, int16_t y, uint16_t w, uint16_t h) {
+  Widget& widget = widgets[index];
+  widget.x = x;
+  widget.y = y;
+  widget.w = w;
+  widget.h = h;
+  widget.type = type;
+  widget.channel = channel;
+}
+
+// Banco a la izquierda, MTC, reloj y transporte a la derecha. En vertical el
+// reloj baja a una segunda línea bajo el MTC
+void MixerScene::buildHeader(bool portrait) {
+  uint8_t base = channelCount * CHANNEL_WIDGETS - CHANNEL_WIDGETS;
+  uint16_t timecodeWidth = SmoothText::textWidth("00:00:00:00", SMOOTH_FONT_LARGE) + 10;
+
+  if (portrait) {
+    headerHeight = 66;
+    place(base + WIDGET_BANK, WIDGET_BANK, SCENE_NO_CHANNEL, 8, 8, 40, 25);
+    place(base + WIDGET_TIMECODE, WIDGET_TIMECODE, SCENE_NO_CHANNEL, 52, 8, timecodeWidth, 26);
+    place(base + WIDGET_CLOCK, WIDGET_CLOCK, SCENE_NO_CHANNEL, 52, 38, 72, 24);
+    place(base + WIDGET_TRANSPORT, WIDGET_TRANSPORT, SCENE_NO_CHANNEL, screenWidth - 36, 14, 33, 13);
+  } else {
+    headerHeight = HEADER_HEIGHT;
+    int16_t timecodeX = screenWidth / 2 - 85;
+    place(base + WIDGET_BANK, WIDGET_BANK, SCENE_NO_CHANNEL, 18, 13, 40, 25);
+    place(base + WIDGET_TIMECODE, WIDGET_TIMECODE, SCENE_NO_CHANNEL, timecodeX, 13, timecodeWidth, 26);
+    place(base + WIDGET_CLOCK, WIDGET_CLOCK, SCENE_NO_CHANNEL, timecodeX + timecodeWidth + 4, 11, 72, 24);
+    place(base + WIDGET_TRANSPORT, WIDGET_TRANSPORT, SCENE_NO_CHANNEL, screenWidth - 36, 19, 33, 13);
+  }
+}
+
+// Los rectángulos de fader y pan incluyen las marcas de 0 dB y centro, que
+// sobresalen 2 píxeles por cada lado de la barra
+void MixerScene::buildStrips(uint8_t rows) {
+  uint8_t perRow = (channelCount + rows - 1) / rows;
+  uint16_t spacing = (screenWidth - 20) / perRow;
+  uint16_t rowHeight = (screenHeight - headerHeight) / rows;
+  bool stacked = rowHeight >= 10 + VOLUME_BAR_HEIGHT + 10 + PAN_BAR_HEIGHT + 15 + LABEL_HEIGHT;
+
+  for (uint8_t channel = 0; channel < channelCount; channel++) {
+    uint8_t row = channel / perRow;
+    int16_t x = 10 + (channel % perRow) * spacing + ((int16_t)spacing - CHANNEL_WIDTH) / 2;
+    int16_t top = headerHeight + 10 + row * rowHeight;
+    int16_t panY, labelY;
+    uint16_t faderHeight;
+
+    if (stacked) {
+      faderHeight = VOLUME_BAR_HEIGHT;
+      panY = top + faderHeight + 10;
+      labelY = panY + PAN_BAR_HEIGHT + 15;
+    } else {
+      labelY = headerHeight + (row + 1) * rowHeight - LABEL_HEIGHT - 6;
+      faderHeight = labelY - 10 - top;
+      panY = top;
+    }
+
+    uint8_t base = channel * CHANNEL_WIDGETS;
+    place(base + WIDGET_FADER, WIDGET_FADER, channel, x - 2, top, VOLUME_BAR_WIDTH + 4, faderHeight);
+    place(base + WIDGET_PAN, WIDGET_PAN, channel, x + 23, panY, PAN_BAR_WIDTH + 4, PAN_BAR_HEIGHT);
+    place(base + WIDGET_METER, WIDGET_METER, channel, x + 42, top, METER_WIDTH, faderHeight);
+    place(base + WIDGET_LABEL, WIDGET_LABEL, channel, x, labelY, CHANNEL_WIDTH, LABEL_HEIGHT);
+  }
+}
+
+// Una tira por encoder: las 0-7 con fader y medidor, las 8-15 solo con pan,
+// todas con la barra estirada hasta la etiqueta compacta
+void MixerScene::buildNarrowStrips(uint8_t rows) {
+  uint8_t perRow = (channelCount + rows - 1) / rows;
+  uint16_t spacing = (screenWidth - 20) / perRow;
+  uint16_t rowHeight = (screenHeight - headerHeight) / rows;
+  
+  for (uint8_t channel = 0; channel < channelCount; channel++) {
+    uint8_t row = channel / perRow;
+    int16_t x = 10 + (channel % perRow) * spacing + ((int16_t)spacing - NARROW_STRIP_WIDTH) / 2;
+    int16_t top = headerHeight + 10 + row * rowHeight;
+    int16_t labelY = headerHeight + (row + 1) * rowHeight - LABEL_COMPACT_HEIGHT - 6;
+    uint16_t barHeight = labelY - 10 - top;
+    
+    uint8_t base = channel * CHANNEL_WIDGETS;
+    if (channel < NUM_ENCODERS / 2) {
+      place(base + WIDGET_FADER, WIDGET_FADER, channel, x - 2, top, NARROW_BAR_WIDTH + 4, barHeight);
+      place(base + WIDGET_METER, WIDGET_METER, channel, x + NARROW_BAR_WIDTH + 6, top, METER_WIDTH, barHeight);
+    } else {
+      place(base + WIDGET_PAN, WIDGET_PAN, channel, x - 2, top, NARROW_BAR_WIDTH + 4, barHeight);
+    }
+    place(base + WIDGET_LABEL, WIDGET_LABEL, channel, x, labelY, NARROW_STRIP_WIDTH, LABEL_COMPACT_HEIGHT);
+  }
+}
+
+// Fader, medidor y pan anchos en columna a la izquierda y el texto a su
+// derecha
+void MixerScene::buildDetail() {
+  int16_t top = headerHeight + 10;
+  uint16_t barHeight = screenHeight - top - 10;
+  int16_t meterX = 20 + DETAIL_BAR_WIDTH + 10;
+  int16_t panX = meterX + DETAIL_METER_WIDTH + 10;
+  int16_t labelX = panX + DETAIL_PAN_WIDTH + 4 + 16;
+  
+  place(WIDGET_FADER, WIDGET_FADER, 0, 18, top, DETAIL_BAR_WIDTH + 4, barHeight);
+  place(WIDGET_METER, WIDGET_METER, 0, meterX, top, DETAIL_METER_WIDTH, barHeight);
+  place(WIDGET_PAN, WIDGET_PAN, 0, panX, top, DETAIL_PAN_WIDTH + 4, DETAIL_PAN_HEIGHT);
+  place(WIDGET_LABEL, WIDGET_LABEL, 0, labelX, top, min(screenWidth - labelX - 10, DETAIL_LABEL_WIDTH),
+        DETAIL_LABEL_HEIGHT);
+}
+
+// Dentro de la pantalla, a su lado de la línea de cabecera y sin solaparse:
+// cada widget limpia su propio fondo y uno encima de otro dejaría restos
+bool MixerScene::validate() const {
+  bool ok = true;
+
+  for (uint8_t i = 0; i < widgetCount; i++) {
+    const Widget& a = widgets[i];
+    if (!a.w) continue;
+    bool global = a.channel == SCENE_NO_CHANNEL;
+    bool inside = a.x >= 0 && a.y >= 0 && a.x + a.w <= screenWidth && a.y + a.h <= screenHeight &&
+                  (global ? a.y + a.h <= headerHeight : a.y > headerHeight);
+    if (!inside) {
+      Serial.print(F("ERROR: Widget fuera de su zona: "));
+      Serial.print(widgetNames[a.type]);
+      if (!global) {
+        Serial.print(' '); Serial.print(a.channel + 1);
+      }
+      Serial.println();
+      ok = false;
+    }
+
+    for (uint8_t j = i + 1; j < widgetCount; j++) {
+      const Widget& b = widgets[j];
+      if (b.w && a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h) {
+        Serial.print(F("ERROR: Widgets solapados: "));
+        Serial.print(widgetNames[a.type]); Serial.print(F(" y "));
+        Serial.println(widgetNames[b.type]);
+        ok = false;
+      }
+    }
+  }
+  return ok;
+}
+
+void MixerScene::invalidate(uint8_t channel, uint8_t typeMask) {
+  if (channel >= channelCount) return;
+  for (uint8_t type = 0; type < CHANNEL_WIDGETS; type++) {
+    Widget& widget = channelWidget(channel, type);
+    if ((typeMask & WIDGET_BIT(type)) && widget.w) widget.dirty = true;
+  }
+}
+
+void MixerScene::invalidateGlobal(uint8_t type) {
+  if (type >= CHANNEL_WIDGETS && type < WIDGET_TYPE_COUNT) globalWidget(type).dirty = true;
+}
+
+void MixerScene::invalidateAll() {
+  for (uint8_t i = 0; i < widgetCount; i++) widgets[i].dirty = widgets[i].w > 0;
+}
+
+bool MixerScene::isDirty(uint16_t typeMask) const {
+  for (uint8_t i = 0; i < widgetCount; i++) {
+    if (widgets[i].dirty && (typeMask & WIDGET_BIT(widgets[i].type))) return true;
+  }
+  return false;
+}
+
+void MixerScene::printLayout() const {
+  static const char* const viewNames[VIEW_COUNT] = { "8 canales", "16 canales", "un canal" };
+  
+  Serial.print(F("Escena ")); Serial.print(viewNames[view]);
+  Serial.print(' '); Serial.print(screenWidth);
+  Serial.print('x'); Serial.print(screenHeight);
+  Serial.print(F(", cabecera ")); Serial.print(headerHeight);
+  Serial.print(F(", widgets ")); Serial.println(widgetCount);
+
+  for (uint8_t i = 0; i < widgetCount; i++) {
+    const Widget& widget = widgets[i];
+    if (!widget.w) continue;
+    Serial.print(F("  ")); Serial.print(widgetNames[widget.type]);
+    if (widget.channel != SCENE_NO_CHANNEL) {
+      Serial.print(' '); Serial.print(widget.channel + 1);
+    }
+    Serial.print(F(": ")); Serial.print(widget.x);
+    Serial.print(','); Serial.print(widget.y);
+    Serial.print(' '); Serial.print(widget.w);
+    Serial.print('x'); Serial.println(widget.h);
+  }
+}
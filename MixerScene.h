@@ -0,0 +1,113 @@
+#ifndef MIXER_SCENE_H
+#define MIXER_SCENE_H
+
+#include <Arduino.h>
+#include "Config.h"
+
+// Escena de la pantalla principal: lista plana de widgets con su rectángulo,
+// calculada al cambiar de orientación o de vista. Cada widget se marca sucio por
+// separado y solo se redibujan los marcados, así que el coste de un frame depende
+// de lo que ha cambiado y no de lo que hay en pantalla.
+//
+// Los widgets de una tira van seguidos en el orden de WidgetType (índice
+// tira * CHANNEL_WIDGETS + tipo) y los globales detrás de todas las tiras. Qué
+// encoder muestra cada tira depende de la vista (MixerView); un widget que la
+// vista no usa queda con tamaño 0 y no se marca ni se dibuja.
+enum WidgetType : uint8_t {
+  WIDGET_FADER = 0,     // Volumen (encoders 0-7)
+  WIDGET_PAN,           // Pan (encoders 8-15)
+  WIDGET_METER,         // VU
+  WIDGET_LABEL,         // Número, valor, mute/solo y nombre
+  CHANNEL_WIDGETS,
+  WIDGET_BANK = CHANNEL_WIDGETS,
+  WIDGET_TIMECODE,
+  WIDGET_CLOCK,         // Tempo y posición
+  WIDGET_TRANSPORT,
+  WIDGET_TYPE_COUNT
+};
+
+#define GLOBAL_WIDGETS      (WIDGET_TYPE_COUNT - CHANNEL_WIDGETS)
+#define WIDGET_BIT(type)    (1 << (type))
+#define SCENE_MAX_CHANNELS  16
+#define SCENE_MAX_WIDGETS   (SCENE_MAX_CHANNELS * CHANNEL_WIDGETS + GLOBAL_WIDGETS)
+#define SCENE_NO_CHANNEL    0xFF
+
+// Tiras de canal: el pan va bajo el fader si cabe y, si no, a su lado con el
+// fader estirado hasta las etiquetas
+#define CHANNEL_WIDTH       55
+#define VOLUME_BAR_WIDTH    20
+#define VOLUME_BAR_HEIGHT   120
+#define PAN_BAR_WIDTH       15
+#define PAN_BAR_HEIGHT      50
+#define METER_WIDTH         3
+#define LABEL_HEIGHT        54   // Número 16, valor 10, mute/solo 10 y nombre 14
+#define HEADER_HEIGHT       40   // En vertical la cabecera ocupa dos líneas
+
+// Vista de 16: tiras estrechas, fader o pan según el encoder
+#define NARROW_STRIP_WIDTH  26
+#define NARROW_BAR_WIDTH    12
+#define LABEL_COMPACT_HEIGHT 50  // Número 12, valor 10, mute/solo 10 y nombre 12
+
+// Vista de un canal: barras anchas a la izquierda y texto a la derecha
+#define DETAIL_BAR_WIDTH    40
+#define DETAIL_METER_WIDTH  24
+#define DETAIL_PAN_WIDTH    20
+#define DETAIL_PAN_HEIGHT   120
+#define DETAIL_LABEL_WIDTH  160  // Cada campo se vuelca a todo su ancho: no más del necesario
+#define DETAIL_LABEL_HEIGHT 154  // Número 30, nombre, volumen, pan y mute/solo de 24
+
+struct Widget {
+  int16_t x, y;
+  uint16_t w, h;
+  uint8_t type;
+  uint8_t channel;      // SCENE_NO_CHANNEL en los globales
+  bool dirty;
+};
+
+class MixerScene {
+private:
+  Widget widgets[SCENE_MAX_WIDGETS];
+  uint8_t widgetCount;
+  uint8_t channelCount;
+  MixerView view;
+  uint16_t screenWidth;
+  uint16_t screenHeight;
+  uint16_t headerHeight;
+
+  void buildHeader(bool portrait);
+  void buildStrips(uint8_t rows);
+  void buildNarrowStrips(uint8_t rows);
+  void buildDetail();
+  void place(uint8_t index, uint8_t type, uint8_t channel, int16_t x, int16_t y, uint16_t w, uint16_t h);
+
+public:
+  MixerScene();
+
+  // Recalcula la disposición para la pantalla ya girada; todo queda sucio.
+  // Devuelve false si algún widget se sale o se solapa con otro
+  bool build(uint16_t width, uint16_t height, MixerView view);
+  bool validate() const;
+  
+  MixerView getView() const { return view; }
+  uint8_t getChannelCount() const { return channelCount; }
+  uint8_t getWidgetCount() const { return widgetCount; }
+  uint16_t getWidth() const { return screenWidth; }
+  uint16_t getHeight() const { return screenHeight; }
+  uint16_t getHeaderHeight() const { return headerHeight; }
+
+  Widget& channelWidget(uint8_t channel, uint8_t type) { return widgets[channel * CHANNEL_WIDGETS + type]; }
+  const Widget& channelWidget(uint8_t channel, uint8_t type) const { return widgets[channel * CHANNEL_WIDGETS + type]; }
+  Widget& globalWidget(uint8_t type) { return widgets[channelCount * CHANNEL_WIDGETS + type - CHANNEL_WIDGETS]; }
+  const Widget& widget(uint8_t index) const { return widgets[index]; }
+
+  // typeMask: WIDGET_BIT() de los tipos de canal afectados
+  void invalidate(uint8_t channel, uint8_t typeMask);
+  void invalidateGlobal(uint8_t type);
+  void invalidateAll();
+  // Algún widget de los tipos de typeMask pendiente de dibujar
+  bool isDirty(uint16_t typeMask) const;
+
+  void printLayout() const;
+};
+
+#endif // MIXER_SCENE_H
@@ -0,0 +1,319 @@
+#include "PresetCacheManager.h"
+#include <esp_heap_caps.h>
+
+extern FileManager fileManager;
+
+PresetCacheManager::PresetCacheManager()
+  : partition(nullptr), mappedBase(nullptr), mmapHandle(0),
+    slotSize(0), slotCount(0), available(false),
+    syncCount(0), syncIndex(0), evictIndex(0), syncActive(false), syncBuffer(nullptr),
+    cacheHits(0), cacheMisses(0), slotsWritten(0), slotsEvicted(0), lastLoadMicros(0)
+{
+  memset(syncNames, 0, sizeof(syncNames));
+}
+
+PresetCacheManager::~PresetCacheManager() {
+  if (mappedBase) {
+    esp_partition_munmap(mmapHandle);
+  }
+  heap_caps_free(syncBuffer);
+}
+
+bool PresetCacheManager::initialize() {
+  Serial.println(F("Inicializando caché de presets en flash..."));
+
+  partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                       ESP_PARTITION_SUBTYPE_ANY,
+                                       PRESET_CACHE_PARTITION_LABEL);
+  if (!partition) {
+    Serial.println(F("ADVERTENCIA: Partición de presets no encontrada"));
+    return false;
+  }
+
+  const void* ptr = nullptr;
+  if (esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA,
+                         &ptr, &mmapHandle) != ESP_OK) {
+    Serial.println(F("ERROR: No se pudo mapear la partición de presets"));
+    return false;
+  }
+  mappedBase = (const uint8_t*)ptr;
+  
+  syncBuffer = (uint8_t*)heap_caps_malloc(PRESET_IMAGE_MAX_SIZE, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!syncBuffer) {
+    syncBuffer = (uint8_t*)heap_caps_malloc(PRESET_IMAGE_MAX_SIZE, MALLOC_CAP_8BIT);
+  }
+  if (!syncBuffer) {
+    Serial.println(F("ERROR: Sin memoria para el búfer de la caché de presets"));
+    return false;
+  }
+
+  // Cada slot ocupa sectores completos para poder borrarlo de forma independiente.
+  // Se dimensiona para el máximo de bancos, así cualquier preset cabe.
+  uint32_t needed = sizeof(PresetCacheSlotHeader) + PRESET_IMAGE_MAX_SIZE;
+  slotSize = ((needed + PRESET_CACHE_SECTOR_SIZE - 1) / PRESET_CACHE_SECTOR_SIZE) * PRESET_CACHE_SECTOR_SIZE;
+  slotCount = min((uint32_t)PRESET_CACHE_MAX_SLOTS, partition->size / slotSize);
+  available = slotCount > 0;
+
+  Serial.print(F("Caché de presets: "));
+  Serial.print(getUsedSlots());
+  Serial.print(F("/"));
+  Serial.print(slotCount);
+  Serial.println(F(" slots en uso"));
+
+  return available;
+}
+
+const PresetCacheSlotHeader* PresetCacheManager::getSlotHeader(uint8_t slot) const {
+  return (const PresetCacheSlotHeader*)(mappedBase + (uint32_t)slot * slotSize);
+}
+
+const uint8_t* PresetCacheManager::getSlotImage(uint8_t slot) const {
+  return mappedBase + (uint32_t)slot * slotSize + sizeof(PresetCacheSlotHeader);
+}
+
+bool PresetCacheManager::isSlotValid(uint8_t slot) const {
+  const PresetCacheSlotHeader* header = getSlotHeader(slot);
+  return header->magic == PRESET_CACHE_MAGIC &&
+         header->version == PRESET_CACHE_VERSION &&
+         header->imageSize >= sizeof(EncoderImageHeader) &&
+         header->imageSize <= PRESET_IMAGE_MAX_SIZE;
+}
+
+int16_t PresetCacheManager::findSlot(const char* name) const {
+  if (!available || !name) return -1;
+
+  for (uint8_t slot = 0; slot < slotCount; slot++) {
+    if (isSlotValid(slot) &&
+        strncmp(getSlotHeader(slot)->name, name, PRESET_CACHE_NAME_LENGTH) == 0) {
+      return slot;
+    }
+  }
+  return -1;
+}
+
+int16_t PresetCacheManager::findFreeSlot() const {
+  for (uint8_t slot = 0; slot < slotCount; slot++) {
+    if (!isSlotValid(slot)) return slot;
+  }
+  return -1;
+}
+
+uint8_t PresetCacheManager::getUsedSlots() const {
+  uint8_t used = 0;
+  for (uint8_t slot = 0; slot < slotCount; slot++) {
+    if (isSlotValid(slot)) used++;
+  }
+  return used;
+}
+
+const EncoderConfig (*PresetCacheManager::findPreset(const char* name, uint8_t* bankCount))[NUM_ENCODERS] {
+  int16_t slot = findSlot(name);
+  if (slot < 0) return nullptr;
+  
+  const uint8_t* image = getSlotImage(slot);
+  if (bankCount) {
+    *bankCount = ((const EncoderImageHeader*)image)->bankCount;
+  }
+  return (const EncoderConfig (*)[NUM_ENCODERS])(image + sizeof(EncoderImageHeader));
+}
+
+bool PresetCacheManager::loadPreset(const char* name, EncoderManager& encoders) {
+  unsigned long startTime = micros();
+
+  int16_t slot = findSlot(name);
+  if (slot < 0) {
+    cacheMisses++;
+    return false;
+  }
+
+  const uint8_t* image = getSlotImage(slot);
+  uint32_t imageSize = getSlotHeader(slot)->imageSize;
+  if (calculateChecksum(image, imageSize) != getSlotHeader(slot)->checksum) {
+    Serial.print(F("ERROR: Checksum inválido en caché para "));
+    Serial.println(name);
+    cacheMisses++;
+    return false;
+  }
+
+  if (!encoders.importImage(image, imageSize)) {
+    cacheMisses++;
+    return false;
+  }
+
+  lastLoadMicros = micros() - startTime;
+  cacheHits++;
+  return true;
+}
+
+bool PresetCacheManager::storePreset(const char* name, const EncoderManager& encoders) {
+  if (!available || !name) return false;
+  
+  // Componer la imagen en el búfer de sincronización (mismo formato que el .prs)
+  size_t imageSize = encoders.exportImage(syncBuffer, PRESET_IMAGE_MAX_SIZE);
+  if (imageSize == 0) return false;
+  
+  int16_t slot = findSlot(name);
+  if (slot >= 0 &&
+      getSlotHeader(slot)->imageSize == imageSize &&
+      getSlotHeader(slot)->checksum == calculateChecksum(syncBuffer, imageSize) &&
+      memcmp(getSlotImage(slot), syncBuffer, imageSize) == 0) {
+    return true; // Ya está al día, evitar desgaste de la flash
+  }
+
+  if (slot < 0) slot = findFreeSlot();
+  if (slot < 0) {
+    Serial.println(F("ADVERTENCIA: Caché de presets llena"));
+    return false;
+  }
+
+  return writeSlot(slot, name, syncBuffer, imageSize);
+}
+
+bool PresetCacheManager::writeSlot(uint8_t slot, const char* name, const void* image, size_t size) {
+  uint32_t offset = (uint32_t)slot * slotSize;
+
+  if (esp_partition_erase_range(partition, offset, slotSize) != ESP_OK) {
+    Serial.println(F("ERROR: Borrado de slot de caché falló"));
+    return false;
+  }
+
+  if (esp_partition_write(partition, offset + sizeof(PresetCacheSlotHeader), image, size) != ESP_OK) {
+    Serial.println(F("ERROR: Escritura de imagen de preset falló"));
+    return false;
+  }
+
+  PresetCacheSlotHeader header;
+  memset(&header, 0, sizeof(header));
+  header.magic = PRESET_CACHE_MAGIC;
+  header.version = PRESET_CACHE_VERSION;
+  header.checksum = calculateChecksum(image, size);
+  header.imageSize = size;
+  strncpy(header.name, name, PRESET_CACHE_NAME_LENGTH - 1);
+
+  if (esp_partition_write(partition, offset, &header, sizeof(header)) != ESP_OK) {
+    Serial.println(F("ERROR: Escritura de cabecera de caché falló"));
+    return false;
+  }
+
+  slotsWritten++;
+  return true;
+}
+
+// Basta con poner el magic a cero: la flash pasa bits de 1 a 0 sin borrar
+// el sector, y writeSlot() ya borra el slot cuando se reutiliza
+bool PresetCacheManager::evictSlot(uint8_t slot) {
+  uint32_t magic = 0;
+  if (esp_partition_write(partition, (uint32_t)slot * slotSize, &magic, sizeof(magic)) != ESP_OK) {
+    Serial.println(F("ERROR: Desalojo de slot de caché falló"));
+    return false;
+  }
+  
+  slotsEvicted++;
+  return true;
+}
+
+bool PresetCacheManager::isListed(const char* name) const {
+  for (uint8_t i = 0; i < syncCount; i++) {
+    if (strncmp(syncNames[i], name, PRESET_CACHE_NAME_LENGTH) == 0) return true;
+  }
+  return false;
+}
+
+// Un slot por paso. Devuelve false cuando ya no quedan slots por revisar
+bool PresetCacheManager::stepEviction() {
+  while (evictIndex < slotCount) {
+    uint8_t slot = evictIndex++;
+    if (!isSlotValid(slot)) continue;
+    
+    const char* name = getSlotHeader(slot)->name;
+    if (isListed(name)) continue;
+    
+    // Fuera del listado: se confirma en la SD, que puede tener más presets de
+    // los que caben en él o uno guardado después. Sin carpeta (SD retirada)
+    // no se desaloja nada.
+    char presetPath[64];
+    snprintf(presetPath, sizeof(presetPath), "%s/%s.prs", PRESET_DIRECTORY, name);
+    if (!fileManager.fileExists(PRESET_DIRECTORY)) {
+      evictIndex = slotCount;
+      return false;
+    }
+    if (fileManager.fileExists(presetPath)) continue;
+    
+    evictSlot(slot);
+    return true;
+  }
+  return false;
+}
+
+void PresetCacheManager::startSync() {
+  if (!available || !fileManager.isInitialized()) return;
+
+  syncCount = fileManager.listPresets(syncNames, PRESET_CACHE_MAX_SLOTS);
+  syncIndex = 0;
+  evictIndex = 0;
+  syncActive = true;   // Aun sin presets en la SD puede haber slots que desalojar
+
+  Serial.print(F("Sincronizando caché de presets: "));
+  Serial.print(syncCount);
+  Serial.println(F(" presets en SD"));
+}
+
+void PresetCacheManager::update() {
+  if (!syncActive) return;
+  
+  if (syncIndex >= syncCount) {
+    if (stepEviction()) return;
+    syncActive = false;
+    Serial.println(F("Caché de presets sincronizada"));
+    return;
+  }
+
+  const char* name = syncNames[syncIndex++];
+
+  char presetPath[64];
+  snprintf(presetPath, sizeof(presetPath), "%s/%s.prs", PRESET_DIRECTORY, name);
+
+  size_t bytesRead = 0;
+  if (!fileManager.readFile(presetPath, syncBuffer, PRESET_IMAGE_MAX_SIZE, &bytesRead) ||
+      bytesRead < sizeof(EncoderImageHeader) ||
+      ((const EncoderImageHeader*)syncBuffer)->magic != ENCODER_IMAGE_MAGIC) {
+    return;
+  }
+
+  int16_t slot = findSlot(name);
+  if (slot >= 0 && getSlotHeader(slot)->imageSize == bytesRead &&
+      getSlotHeader(slot)->checksum == calculateChecksum(syncBuffer, bytesRead)) {
+    return;
+  }
+
+  if (slot < 0) slot = findFreeSlot();
+  if (slot >= 0) {
+    writeSlot(slot, name, syncBuffer, bytesRead);
+  }
+}
+
+uint16_t PresetCacheManager::calculateChecksum(const void* data, size_t size) const {
+  // Fletcher-16: barato y detecta intercambios de bytes
+  const uint8_t* bytes = (const uint8_t*)data;
+  uint16_t sum1 = 0;
+  uint16_t sum2 = 0;
+
+  for (size_t i = 0; i < size; i++) {
+    sum1 = (sum1 + bytes[i]) % 255;
+    sum2 = (sum2 + sum1) % 255;
+  }
+
+  return (sum2 << 8) | sum1;
+}
+
+void PresetCacheManager::printStatistics() const {
+  Serial.println(F("\n=== CACHÉ DE PRESETS ==="));
+  Serial.print(F("Slots: ")); Serial.print(getUsedSlots());
+  Serial.print(F("/")); Serial.println(slotCount);
+  Serial.print(F("Aciertos: ")); Serial.println(cacheHits);
+  Serial.print(F("Fallos: ")); Serial.println(cacheMisses);
+  Serial.print(F("Slots escritos: ")); Serial.println(slotsWritten);
+  Serial.print(F("Slots desalojados: ")); Serial.println(slotsEvicted);
+  Serial.print(F("Última carga (us): ")); Serial.println(lastLoadMicros);
+  Serial.println(F("========================\n"));
+}
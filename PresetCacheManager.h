@@ -0,0 +1,92 @@
+#ifndef PRESET_CACHE_MANAGER_H
+#define PRESET_CACHE_MANAGER_H
+
+#include "Config.h"
+#include "FileManager.h"
+#include "EncoderManager.h"
+#include <esp_partition.h>
+
+// Partición de datos definida en partitions.csv
+#define PRESET_CACHE_PARTITION_LABEL  "presets"
+#define PRESET_CACHE_SECTOR_SIZE      4096
+#define PRESET_CACHE_MAX_SLOTS        32
+#define PRESET_CACHE_MAGIC            0x50434348  // "PCCH"
+#define PRESET_CACHE_VERSION          8
+#define PRESET_CACHE_NAME_LENGTH      16
+
+// Los nombres que lista FileManager caben en la cabecera del slot
+static_assert(MAX_PRESET_NAME <= PRESET_CACHE_NAME_LENGTH, "Nombre de preset mayor que la cabecera del slot");
+
+// Misma imagen que el fichero .prs; su tamaño depende del número de bancos
+#define PRESET_IMAGE_MAX_SIZE  ENCODER_IMAGE_MAX_SIZE
+
+// Cabecera al inicio de cada slot. El magic se escribe en último lugar,
+// así un slot a medio escribir nunca se considera válido.
+struct PresetCacheSlotHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t checksum;
+  uint32_t imageSize;
+  uint32_t reserved;
+  char name[PRESET_CACHE_NAME_LENGTH];
+};
+
+class PresetCacheManager {
+private:
+  const esp_partition_t* partition;
+  const uint8_t* mappedBase;
+  esp_partition_mmap_handle_t mmapHandle;
+  uint32_t slotSize;
+  uint8_t slotCount;
+  bool available;
+
+  // Sincronización SD -> flash en segundo plano (un preset por paso); tras
+  // copiar, se desalojan los slots de presets que ya no están en la SD
+  char syncNames[PRESET_CACHE_MAX_SLOTS][MAX_PRESET_NAME];
+  uint8_t syncCount;
+  uint8_t syncIndex;
+  uint8_t evictIndex;
+  bool syncActive;
+  uint8_t* syncBuffer;   // PRESET_IMAGE_MAX_SIZE bytes en PSRAM
+
+  uint32_t cacheHits;
+  uint32_t cacheMisses;
+  uint32_t slotsWritten;
+  uint32_t slotsEvicted;
+  uint32_t lastLoadMicros;
+
+  const PresetCacheSlotHeader* getSlotHeader(uint8_t slot) const;
+  const uint8_t* getSlotImage(uint8_t slot) const;
+  bool isSlotValid(uint8_t slot) const;
+  int16_t findSlot(const char* name) const;
+  int16_t findFreeSlot() const;
+  bool writeSlot(uint8_t slot, const char* name, const void* image, size_t size);
+  bool evictSlot(uint8_t slot);
+  bool isListed(const char* name) const;
+  bool stepEviction();
+  uint16_t calculateChecksum(const void* data, size_t size) const;
+
+public:
+  PresetCacheManager();
+  ~PresetCacheManager();
+
+  bool initialize();
+  bool isAvailable() const { return available; }
+
+  // Acceso sin copia: devuelve la imagen directamente desde la flash mapeada
+  const EncoderConfig (*findPreset(const char* name, uint8_t* bankCount = nullptr))[NUM_ENCODERS];
+  
+  bool loadPreset(const char* name, EncoderManager& encoders);
+  bool storePreset(const char* name, const EncoderManager& encoders);
+
+  void startSync();
+  void update();
+  bool isSyncing() const { return syncActive; }
+
+  uint8_t getSlotCount() const { return slotCount; }
+  uint8_t getUsedSlots() const;
+  uint32_t getLastLoadMicros() const { return lastLoadMicros; }
+  void printStatistics() const;
+};
+
+#endif // PRESET_CACHE_MANAGER_H
@@ -0,0 +1,145 @@
+#include "SmoothFont.h"
+#include "SmoothFonts.h"
+
+static const SmoothFont* const smoothFonts[SMOOTH_FONT_COUNT] = {
+  &smoothFontSmall, &smoothFontMedium, &smoothFontLarge
+};
+
+SmoothText::SmoothText()
+  : glyphCount(0), font(&smoothFontSmall), baseline(0), glyphsDecoded(0)
+{
+  memset(palette, 0, sizeof(palette));
+}
+
+const SmoothFont& SmoothText::getFont(uint8_t id) {
+  return *smoothFonts[id < SMOOTH_FONT_COUNT ? id : SMOOTH_FONT_SMALL];
+}
+
+uint16_t SmoothText::nextCodePoint(const char*& text) {
+  uint8_t c = *text++;
+  if (c < 0x80) return c;
+
+  // Dos bytes: cubre todo Latin-1
+  if ((c & 0xE0) == 0xC0 && ((uint8_t)*text & 0xC0) == 0x80) {
+    return ((c & 0x1F) << 6) | ((uint8_t)*text++ & 0x3F);
+  }
+
+  // Tres o cuatro bytes: fuera de la fuente. Sin continuación detrás es un
+  // Latin-1 suelto (à-ï, ð-÷)
+  if (((c & 0xF0) == 0xE0 || (c & 0xF8) == 0xF0) && ((uint8_t)*text & 0xC0) == 0x80) {
+    while (((uint8_t)*text & 0xC0) == 0x80) text++;
+    return '?';
+  }
+
+  return c;
+}
+
+static const SmoothGlyph& glyphFor(const SmoothFont& font, uint16_t codePoint) {
+  int16_t index = smoothGlyphIndex(codePoint);
+  return font.glyphs[index >= 0 ? index : smoothGlyphIndex('?')];
+}
+
+uint16_t SmoothText::textWidth(const char* text, uint8_t fontId) {
+  const SmoothFont& font = getFont(fontId);
+  uint16_t width = 0;
+  while (*text) width += glyphFor(font, nextCodePoint(text)).xAdvance;
+  return width;
+}
+
+uint16_t SmoothText::lineHeight(uint8_t fontId) {
+  const SmoothFont& font = getFont(fontId);
+  return font.ascent + font.descent;
+}
+
+inline uint8_t SmoothText::nextAlpha(GlyphCursor& cursor) {
+  if (!(font->flags & SMOOTH_RLE)) {
+    uint8_t packed = cursor.data[cursor.nibble >> 1];
+    return (cursor.nibble++ & 1) ? (packed & 0x0F) : (packed >> 4);
+  }
+
+  if (cursor.run == 0) {
+    uint8_t code = *cursor.data++;
+    cursor.alpha = code >> 4;
+    cursor.run = (code & 0x0F) + 1;
+  }
+  cursor.run--;
+  return cursor.alpha;
+}
+
+void SmoothText::begin(const char* text, uint8_t fontId, uint16_t w, uint16_t h, bool centered,
+                       uint16_t color, uint16_t bg) {
+  begin(text, getFont(fontId), w, h, centered, color, bg);
+}
+
+void SmoothText::begin(const char* text, const SmoothFont& textFont, uint16_t w, uint16_t h, bool centered,
+                       uint16_t color, uint16_t bg) {
+  font = &textFont;
+
+  // Mayúsculas centradas en la caja; lo que sobresalga se recorta
+  baseline = ((int16_t)h + font->capHeight) / 2;
+
+  glyphCount = 0;
+  int16_t x = 0;
+  while (*text && glyphCount < SMOOTH_MAX_GLYPHS) {
+    const SmoothGlyph& glyph = glyphFor(*font, nextCodePoint(text));
+    GlyphCursor& cursor = cursors[glyphCount++];
+    cursor.glyph = &glyph;
+    cursor.data = font->data + glyph.offset;
+    cursor.x = x + glyph.xOffset;
+    cursor.top = baseline + glyph.yOffset;
+    cursor.nibble = 0;
+    cursor.run = 0;
+    cursor.alpha = 0;
+    x += glyph.xAdvance;
+  }
+
+  int16_t left = (centered && x < (int16_t)w) ? (w - x) / 2 : 0;
+  for (uint8_t i = 0; i < glyphCount; i++) {
+    GlyphCursor& cursor = cursors[i];
+    cursor.x += left;
+
+    // Filas por encima de la caja: se descartan
+    if (cursor.top < 0) {
+      uint16_t skipped = min((uint16_t)-cursor.top, (uint16_t)cursor.glyph->height) * cursor.glyph->width;
+      while (skipped--) nextAlpha(cursor);
+    }
+  }
+
+  // Un color por nivel de alfa: mezclar una vez por texto, no por píxel
+  uint8_t fr = color >> 11, fg = (color >> 5) & 0x3F, fb = color & 0x1F;
+  uint8_t br = bg >> 11, bgG = (bg >> 5) & 0x3F, bb = bg & 0x1F;
+  for (uint8_t a = 0; a < 16; a++) {
+    uint8_t r = (fr * a + br * (15 - a) + 7) / 15;
+    uint8_t g = (fg * a + bgG * (15 - a) + 7) / 15;
+    uint8_t b = (fb * a + bb * (15 - a) + 7) / 15;
+    palette[a] = (r << 11) | (g << 5) | b;
+  }
+
+  glyphsDecoded += glyphCount;
+}
+
+void SmoothText::renderRow(int16_t row, uint16_t* out, uint16_t w) {
+  for (uint16_t i = 0; i < w; i++) out[i] = palette[0];
+
+  for (uint8_t i = 0; i < glyphCount; i++) {
+    GlyphCursor& cursor = cursors[i];
+    const SmoothGlyph* glyph = cursor.glyph;
+    if (row < cursor.top || row >= cursor.top + glyph->height) continue;
+
+    // El glifo se decodifica entero aunque se salga por los lados: el cursor
+    // tiene que quedar al principio de la fila siguiente
+    int16_t x = cursor.x;
+    for (uint8_t col = 0; col < glyph->width; col++, x++) {
+      uint8_t alpha = nextAlpha(cursor);
+      if (alpha && x >= 0 && x < (int16_t)w) out[x] = palette[alpha];
+    }
+  }
+}
+
+void SmoothText::end() {
+  glyphCount = 0;
+}
+
+void SmoothText::resetStatistics() {
+  glyphsDecoded = 0;
+}
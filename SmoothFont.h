@@ -0,0 +1,92 @@
+#ifndef SMOOTH_FONT_H
+#define SMOOTH_FONT_H
+
+#include <Arduino.h>
+
+// Fuentes proporcionales suavizadas (alfa de 4 bits) para Latin-1. Las tablas
+// las genera tools/gen_fonts.py en SmoothFonts.h. Cada glifo es su caja
+// recorrida por filas, en nibbles empaquetados o, si ocupa menos, con RLE:
+// byte = (alfa << 4) | (racha - 1). El texto se compone fila a fila mezclando
+// contra un fondo conocido, para volcarlo en una sola ventana de la ST7796S.
+#define SMOOTH_GLYPH_COUNT   191    // 0x20-0x7E y 0xA0-0xFF
+#define SMOOTH_MAX_GLYPHS    48     // Glifos por línea de texto
+#define SMOOTH_FONT_COUNT    3
+
+#define SMOOTH_FONT_SMALL    0
+#define SMOOTH_FONT_MEDIUM   1
+#define SMOOTH_FONT_LARGE    2
+
+#define SMOOTH_RLE           0x01   // Glifos comprimidos con RLE
+
+struct SmoothGlyph {
+  uint16_t offset;    // En los datos RLE de la fuente
+  uint8_t width;
+  uint8_t height;
+  uint8_t xAdvance;
+  int8_t xOffset;
+  int8_t yOffset;     // Desde la línea base (negativo = por encima)
+};
+
+struct SmoothFont {
+  const uint8_t* data;
+  const SmoothGlyph* glyphs;
+  uint8_t capHeight;  // Altura de las mayúsculas: centra el texto en su caja
+  uint8_t ascent;
+  uint8_t descent;
+  uint8_t flags;
+};
+
+constexpr int16_t smoothGlyphIndex(uint16_t codePoint) {
+  return (codePoint >= 0x20 && codePoint <= 0x7E) ? codePoint - 0x20 :
+         (codePoint >= 0xA0 && codePoint <= 0xFF) ? 95 + codePoint - 0xA0 : -1;
+}
+static_assert(smoothGlyphIndex(0xFF) == SMOOTH_GLYPH_COUNT - 1, "Rango Latin-1 incompleto");
+
+class SmoothText {
+private:
+  // Decodificador RLE de un glifo, avanzado fila a fila
+  struct GlyphCursor {
+    const SmoothGlyph* glyph;
+    const uint8_t* data;
+    int16_t x;          // Columna del glifo dentro de la caja
+    int16_t top;        // Fila de la caja donde empieza
+    uint16_t nibble;    // Sin RLE: siguiente píxel
+    uint8_t run;        // Con RLE: píxeles que quedan de la racha actual
+    uint8_t alpha;
+  };
+
+  GlyphCursor cursors[SMOOTH_MAX_GLYPHS];
+  uint8_t glyphCount;
+  const SmoothFont* font;
+  int16_t baseline;
+  uint16_t palette[16];   // Color por nivel de alfa, mezclado con el fondo
+
+  // Estadísticas
+  uint32_t glyphsDecoded;
+
+  uint8_t nextAlpha(GlyphCursor& cursor);
+
+public:
+  SmoothText();
+
+  static const SmoothFont& getFont(uint8_t id);
+  // Siguiente carácter de un texto UTF-8 (bytes sueltos >= 0x80 se toman como Latin-1)
+  static uint16_t nextCodePoint(const char*& text);
+  static uint16_t textWidth(const char* text, uint8_t fontId);
+  static uint16_t lineHeight(uint8_t fontId);
+
+  // Prepara el texto para una caja de ancho w y alto h
+  void begin(const char* text, uint8_t fontId, uint16_t w, uint16_t h, bool centered,
+             uint16_t color, uint16_t bg);
+  // Igual, con una fuente que no está en las tablas (las pruebas la recodifican)
+  void begin(const char* text, const SmoothFont& textFont, uint16_t w, uint16_t h, bool centered,
+             uint16_t color, uint16_t bg);
+  // Compone la siguiente fila de la caja (w píxeles) en out
+  void renderRow(int16_t row, uint16_t* out, uint16_t w);
+  void end();
+
+  uint32_t getGlyphsDecoded() const { return glyphsDecoded; }
+  void resetStatistics();
+};
+
+#endif // SMOOTH_FONT_H
@@ -0,0 +1,3244 @@
+// Generado por tools/gen_fonts.py a partir de DejaVuSans.ttf: no editar a mano
+// Alfa de 4 bits, en nibbles o con RLE según el tamaño (ver SmoothFont.h)
+//
+//   tamaño   glifos   4 bits     RLE        usado   tabla
+//   Small      191    5387 B    6776 B   4bit   1528 B
+//   Medium     191   13881 B   14178 B   4bit   1528 B
+//   Large      191   29120 B   22712 B   RLE    1528 B
+#ifndef SMOOTH_FONTS_H
+#define SMOOTH_FONTS_H
+
+#include "SmoothFont.h"
+
+// Small: 11 px, textos pequeños (equivale a FONT_SIZE_SMALL)
+static const uint8_t smoothSmallData[5387] = {
+  0x05, 0xB0, 0x05, 0xB0, 0x05, 0xB0, 0x05, 0xB0, 0x05, 0xB0, 0x04, 0xA0, 0x00, 0x00, 0x05, 0xB0,
+  0x0E, 0x0E, 0x00, 0xE0, 0xE0, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xA0, 0xB2, 0x00, 0x00, 0x76, 0x1C, 0x00, 0x08, 0xFF, 0xFF,
+  0xFF, 0x60, 0x00, 0xD0, 0x76, 0x00, 0x00, 0x2B, 0x0B, 0x20, 0x02, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+  0x94, 0x3B, 0x00, 0x00, 0x0D, 0x07, 0x60, 0x00, 0x00, 0x08, 0x00, 0x00, 0x5D, 0xFF, 0x90, 0x0E,
+  0x38, 0x00, 0x00, 0xE4, 0x80, 0x00, 0x05, 0xCF, 0xB4, 0x00, 0x00, 0x95, 0xE0, 0x00, 0x08, 0x3E,
+  0x01, 0xFE, 0xFD, 0x50, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x0A, 0xE9, 0x00, 0x1B, 0x00,
+  0x5A, 0x1B, 0x30, 0x93, 0x00, 0x5A, 0x1B, 0x34, 0x90, 0x00, 0x0B, 0xEA, 0x1B, 0x10, 0x00, 0x00,
+  0x00, 0x85, 0x4D, 0xD4, 0x00, 0x03, 0xA0, 0xC3, 0x3B, 0x00, 0x0B, 0x20, 0xC3, 0x3B, 0x00, 0x67,
+  0x00, 0x4E, 0xD4, 0x00, 0x9E, 0xC2, 0x00, 0x00, 0x4D, 0x13, 0x70, 0x00, 0x05, 0xB0, 0x00, 0x00,
+  0x00, 0x2F, 0x70, 0x00, 0x00, 0x0C, 0x4A, 0x90, 0x4B, 0x04, 0xC0, 0x08, 0xBA, 0x40, 0x2E, 0x51,
+  0x2C, 0xE1, 0x00, 0x4C, 0xFD, 0x67, 0xB0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xB2, 0x04, 0xB0, 0x09, 0x50, 0x0D, 0x20, 0x0F, 0x00, 0x0F, 0x00, 0x0D,
+  0x20, 0x09, 0x50, 0x04, 0xB0, 0x00, 0xB2, 0x0C, 0x10, 0x06, 0x80, 0x01, 0xD0, 0x00, 0xD3, 0x00,
+  0xB5, 0x00, 0xB4, 0x00, 0xD3, 0x01, 0xD0, 0x06, 0x80, 0x0C, 0x10, 0x00, 0x81, 0x00, 0x75, 0x82,
+  0xA1, 0x07, 0xDB, 0x30, 0x07, 0xDB, 0x20, 0x75, 0x82, 0xA1, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00, 0x0D, 0x10, 0x00, 0x00, 0x00, 0xD1, 0x00,
+  0x00, 0xCF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00, 0x0D, 0x10, 0x00, 0x00, 0x00,
+  0xD1, 0x00, 0x00, 0x0B, 0x60, 0x0C, 0x10, 0x7F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+  0x50, 0x00, 0x58, 0x00, 0xA4, 0x00, 0xD0, 0x04, 0x90, 0x09, 0x50, 0x0D, 0x10, 0x3A, 0x00, 0x86,
+  0x00, 0xC1, 0x00, 0x02, 0xCF, 0xC2, 0x00, 0xC8, 0x18, 0xB0, 0x2E, 0x00, 0x0E, 0x13, 0xD0, 0x00,
+  0xD3, 0x3D, 0x00, 0x0D, 0x32, 0xE0, 0x00, 0xE1, 0x0C, 0x81, 0x8B, 0x00, 0x3C, 0xFC, 0x20, 0x0C,
+  0xFF, 0x30, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x0D, 0x30, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x0D, 0x30,
+  0x00, 0x00, 0xD3, 0x00, 0x00, 0x0D, 0x30, 0x00, 0xAF, 0xFF, 0xF0, 0x06, 0xDE, 0xB2, 0x02, 0x92,
+  0x1A, 0xA0, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x0B, 0x70, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00,
+  0x0A, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x04, 0xCE, 0xC3, 0x00, 0x93, 0x17, 0xD0, 0x00, 0x00,
+  0x7B, 0x00, 0x0C, 0xFD, 0x20, 0x00, 0x01, 0x7D, 0x00, 0x00, 0x00, 0xF1, 0x28, 0x11, 0x7D, 0x00,
+  0x7D, 0xEB, 0x30, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xBD, 0x40, 0x00, 0xB2, 0xD4, 0x00, 0x76, 0x0D,
+  0x40, 0x3B, 0x00, 0xD4, 0x07, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x0D, 0x40, 0x0C,
+  0xFF, 0xF7, 0x00, 0xC3, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00, 0xCE, 0xEB, 0x20, 0x00, 0x01, 0x9C,
+  0x00, 0x00, 0x02, 0xF0, 0x00, 0x01, 0x9C, 0x02, 0xFF, 0xEA, 0x20, 0x00, 0x9E, 0xFC, 0x00, 0x8B,
+  0x20, 0x00, 0x1F, 0x20, 0x00, 0x03, 0xE8, 0xED, 0x50, 0x3F, 0x71, 0x4E, 0x21, 0xF1, 0x00, 0xC4,
+  0x0B, 0x71, 0x4E, 0x20, 0x2B, 0xFD, 0x50, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xA0, 0x00, 0x00,
+  0xD4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x09, 0x70, 0x00, 0x01, 0xE2, 0x00, 0x00, 0x6B, 0x00, 0x00,
+  0x0C, 0x50, 0x00, 0x05, 0xDF, 0xD5, 0x00, 0xE5, 0x05, 0xE0, 0x0D, 0x50, 0x5D, 0x00, 0x3E, 0xFE,
+  0x30, 0x1E, 0x51, 0x5E, 0x13, 0xD0, 0x00, 0xD3, 0x1E, 0x51, 0x5E, 0x10, 0x5D, 0xFD, 0x50, 0x05,
+  0xDF, 0xB2, 0x02, 0xE4, 0x17, 0xA0, 0x4C, 0x00, 0x1F, 0x12, 0xE4, 0x17, 0xF2, 0x05, 0xDE, 0x8E,
+  0x20, 0x00, 0x03, 0xE0, 0x00, 0x02, 0xC8, 0x00, 0xCF, 0xE9, 0x00, 0x0B, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x60, 0x0B, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0B, 0x60, 0x0C, 0x10, 0x00, 0x00, 0x01, 0x6C, 0x10, 0x00, 0x5A, 0xD8, 0x30, 0x08, 0xDA,
+  0x40, 0x00, 0x00, 0x8D, 0xA4, 0x00, 0x00, 0x00, 0x05, 0xAD, 0x83, 0x00, 0x00, 0x00, 0x16, 0xC1,
+  0x0C, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x82, 0x00, 0x00, 0x00, 0x27, 0xDB, 0x61, 0x00,
+  0x00, 0x00, 0x39, 0xDA, 0x00, 0x00, 0x03, 0x8D, 0xA0, 0x02, 0x7D, 0xC6, 0x10, 0x00, 0xB8, 0x20,
+  0x00, 0x00, 0x3F, 0xFE, 0x60, 0x00, 0x04, 0xF0, 0x00, 0x08, 0xB0, 0x00, 0x5C, 0x10, 0x00, 0xC4,
+  0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x17, 0xDF, 0xE9, 0x20, 0x00,
+  0x1C, 0x93, 0x11, 0x6D, 0x30, 0x09, 0x60, 0x00, 0x00, 0x2C, 0x01, 0xC0, 0x2C, 0xE8, 0xC0, 0xA2,
+  0x48, 0x0A, 0x60, 0x5C, 0x09, 0x24, 0x80, 0xA5, 0x05, 0xC4, 0xC0, 0x1C, 0x02, 0xCE, 0x8E, 0xA2,
+  0x00, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC9, 0x20, 0x39, 0x60, 0x00, 0x01, 0x8D, 0xFD, 0x92,
+  0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7A, 0xE0, 0x00, 0x00, 0xC3, 0xB5, 0x00, 0x03, 0xD0, 0x5B,
+  0x00, 0x09, 0x70, 0x0E, 0x20, 0x0E, 0xFF, 0xFF, 0x70, 0x5C, 0x00, 0x04, 0xD0, 0xB6, 0x00, 0x00,
+  0xD4, 0x0E, 0xFF, 0xE9, 0x00, 0x0E, 0x30, 0x2D, 0x50, 0x0E, 0x30, 0x2D, 0x40, 0x0E, 0xFF, 0xFA,
+  0x00, 0x0E, 0x30, 0x1B, 0x70, 0x0E, 0x30, 0x06, 0xB0, 0x0E, 0x30, 0x1B, 0x90, 0x0E, 0xFF, 0xEA,
+  0x10, 0x00, 0x8D, 0xFC, 0x50, 0x0A, 0xC3, 0x13, 0xA1, 0x2F, 0x20, 0x00, 0x00, 0x5D, 0x00, 0x00,
+  0x00, 0x5D, 0x00, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x00, 0x0A, 0xC3, 0x13, 0x91, 0x00, 0x8D, 0xFC,
+  0x50, 0x0E, 0xFF, 0xEA, 0x30, 0x0E, 0x30, 0x28, 0xE3, 0x0E, 0x30, 0x00, 0xA9, 0x0E, 0x30, 0x00,
+  0x6C, 0x0E, 0x30, 0x00, 0x6C, 0x0E, 0x30, 0x00, 0xA9, 0x0E, 0x30, 0x28, 0xE3, 0x0E, 0xFF, 0xEA,
+  0x30, 0x0E, 0xFF, 0xFF, 0x20, 0xE3, 0x00, 0x00, 0x0E, 0x30, 0x00, 0x00, 0xEF, 0xFF, 0xF0, 0x0E,
+  0x30, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x0E, 0x30, 0x00, 0x00, 0xEF, 0xFF, 0xF4, 0x0E, 0xFF, 0xFA,
+  0x0E, 0x30, 0x00, 0x0E, 0x30, 0x00, 0x0E, 0xFF, 0xF5, 0x0E, 0x30, 0x00, 0x0E, 0x30, 0x00, 0x0E,
+  0x30, 0x00, 0x0E, 0x30, 0x00, 0x00, 0x8D, 0xFD, 0x81, 0x00, 0xAC, 0x31, 0x27, 0x50, 0x2F, 0x20,
+  0x00, 0x00, 0x05, 0xD0, 0x00, 0x00, 0x00, 0x5D, 0x00, 0x3F, 0xF9, 0x02, 0xF2, 0x00, 0x07, 0x90,
+  0x0A, 0xC3, 0x11, 0x99, 0x00, 0x08, 0xDF, 0xD9, 0x10, 0x0E, 0x30, 0x00, 0xD3, 0x0E, 0x30, 0x00,
+  0xD3, 0x0E, 0x30, 0x00, 0xD3, 0x0E, 0xFF, 0xFF, 0xF3, 0x0E, 0x30, 0x00, 0xD3, 0x0E, 0x30, 0x00,
+  0xD3, 0x0E, 0x30, 0x00, 0xD3, 0x0E, 0x30, 0x00, 0xD3, 0x0E, 0x30, 0xE3, 0x0E, 0x30, 0xE3, 0x0E,
+  0x30, 0xE3, 0x0E, 0x30, 0xE3, 0x00, 0xE3, 0x00, 0xE3, 0x00, 0xE3, 0x00, 0xE3, 0x00, 0xE3, 0x00,
+  0xE3, 0x00, 0xE3, 0x00, 0xE2, 0x04, 0xE0, 0x8D, 0x50, 0x0E, 0x30, 0x1B, 0x90, 0x0E, 0x31, 0xC8,
+  0x00, 0x0E, 0x4C, 0x80, 0x00, 0x0E, 0xE8, 0x00, 0x00, 0x0E, 0xAD, 0x10, 0x00, 0x0E, 0x37, 0xD1,
+  0x00, 0x0E, 0x30, 0x7D, 0x10, 0x0E, 0x30, 0x07, 0xD1, 0x0E, 0x30, 0x00, 0x00, 0xE3, 0x00, 0x00,
+  0x0E, 0x30, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x0E, 0x30, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x0E, 0x30,
+  0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x0E, 0xD0, 0x00, 0x6F, 0x60, 0xEB, 0x50, 0x0C, 0xC6, 0x0E, 0x5B,
+  0x03, 0xBA, 0x60, 0xE2, 0xC2, 0x95, 0xA6, 0x0E, 0x26, 0x9D, 0x0A, 0x60, 0xE2, 0x1E, 0x70, 0xA6,
+  0x0E, 0x20, 0x00, 0x0A, 0x60, 0xE2, 0x00, 0x00, 0xA6, 0x0E, 0xC0, 0x00, 0xE2, 0x0E, 0xD5, 0x00,
+  0xE2, 0x0E, 0x6D, 0x00, 0xE2, 0x0E, 0x2B, 0x60, 0xE2, 0x0E, 0x23, 0xD1, 0xE2, 0x0E, 0x20, 0xA7,
+  0xE2, 0x0E, 0x20, 0x2E, 0xE2, 0x0E, 0x20, 0x09, 0xF2, 0x00, 0x8D, 0xFC, 0x50, 0x00, 0xAC, 0x31,
+  0x5E, 0x50, 0x2F, 0x20, 0x00, 0x7C, 0x05, 0xD0, 0x00, 0x03, 0xF0, 0x5D, 0x00, 0x00, 0x3F, 0x02,
+  0xF2, 0x00, 0x06, 0xC0, 0x0A, 0xC3, 0x15, 0xE5, 0x00, 0x08, 0xEF, 0xC5, 0x00, 0x0E, 0xFF, 0xD5,
+  0x00, 0xE3, 0x05, 0xF1, 0x0E, 0x30, 0x0E, 0x30, 0xE3, 0x05, 0xF1, 0x0E, 0xFF, 0xD5, 0x00, 0xE3,
+  0x00, 0x00, 0x0E, 0x30, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x00, 0x8D, 0xFC, 0x50, 0x00, 0xAC, 0x31,
+  0x5E, 0x50, 0x2F, 0x20, 0x00, 0x7C, 0x05, 0xD0, 0x00, 0x03, 0xF0, 0x5D, 0x00, 0x00, 0x3F, 0x02,
+  0xF2, 0x00, 0x06, 0xC0, 0x09, 0xC3, 0x15, 0xE4, 0x00, 0x08, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x09,
+  0xB1, 0x00, 0x0E, 0xFF, 0xD5, 0x00, 0x0E, 0x30, 0x5F, 0x10, 0x0E, 0x30, 0x0E, 0x30, 0x0E, 0x30,
+  0x5E, 0x10, 0x0E, 0xFF, 0xF5, 0x00, 0x0E, 0x30, 0x6D, 0x00, 0x0E, 0x30, 0x0A, 0x70, 0x0E, 0x30,
+  0x02, 0xE1, 0x05, 0xDE, 0xC4, 0x02, 0xE4, 0x13, 0xA0, 0x3D, 0x00, 0x00, 0x00, 0xBB, 0x74, 0x00,
+  0x00, 0x26, 0xAC, 0x10, 0x00, 0x00, 0xD5, 0x38, 0x20, 0x4E, 0x30, 0x6D, 0xFD, 0x60, 0x0F, 0xFF,
+  0xFF, 0xFB, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03,
+  0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x10,
+  0x00, 0xF1, 0x1F, 0x10, 0x00, 0xF1, 0x1F, 0x10, 0x00, 0xF1, 0x1F, 0x10, 0x00, 0xF1, 0x1F, 0x10,
+  0x00, 0xF1, 0x0E, 0x20, 0x02, 0xF0, 0x0A, 0xA1, 0x19, 0xB0, 0x01, 0xAE, 0xEA, 0x10, 0xB6, 0x00,
+  0x00, 0xD4, 0x5C, 0x00, 0x04, 0xD0, 0x0E, 0x20, 0x0A, 0x70, 0x09, 0x80, 0x1E, 0x20, 0x03, 0xE0,
+  0x6B, 0x00, 0x00, 0xC4, 0xC5, 0x00, 0x00, 0x7C, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x89, 0x00,
+  0x4F, 0x30, 0x0B, 0x64, 0xD0, 0x08, 0xC6, 0x00, 0xE2, 0x1F, 0x10, 0xC4, 0xA0, 0x3D, 0x00, 0xB5,
+  0x1D, 0x0D, 0x07, 0x90, 0x08, 0x94, 0x90, 0xB3, 0xB6, 0x00, 0x4C, 0x85, 0x07, 0x6E, 0x20, 0x00,
+  0xFD, 0x20, 0x3D, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0xE9, 0x00, 0x1D, 0x30, 0x08, 0xA0, 0x05, 0xC0,
+  0x3D, 0x10, 0x00, 0xA8, 0xD4, 0x00, 0x00, 0x1E, 0x90, 0x00, 0x00, 0x4E, 0xC0, 0x00, 0x01, 0xD4,
+  0xA8, 0x00, 0x0A, 0x80, 0x1D, 0x30, 0x5C, 0x00, 0x05, 0xC0, 0x0A, 0x70, 0x00, 0xB6, 0x01, 0xD3,
+  0x06, 0xB0, 0x00, 0x5C, 0x2D, 0x20, 0x00, 0x0A, 0xE6, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03,
+  0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x6F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+  0x1C, 0x50, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x07, 0xB0, 0x00, 0x00, 0x5C, 0x10, 0x00, 0x03, 0xD2,
+  0x00, 0x00, 0x1D, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF1, 0x1F, 0xF3, 0x1E, 0x00, 0x1E, 0x00,
+  0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1F, 0xF3, 0xC1, 0x00,
+  0x86, 0x00, 0x3A, 0x00, 0x0D, 0x10, 0x09, 0x50, 0x04, 0x90, 0x00, 0xD0, 0x00, 0xA4, 0x00, 0x58,
+  0x0E, 0xF5, 0x00, 0xA5, 0x00, 0xA5, 0x00, 0xA5, 0x00, 0xA5, 0x00, 0xA5, 0x00, 0xA5, 0x00, 0xA5,
+  0x00, 0xA5, 0x0E, 0xF5, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x06, 0xC2, 0xA9, 0x00, 0x05, 0xB1, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
+  0xFF, 0xFF, 0x90, 0x0A, 0x50, 0x00, 0x00, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFE,
+  0xB1, 0x00, 0x00, 0x18, 0x80, 0x08, 0xDF, 0xFB, 0x03, 0xD2, 0x05, 0xB0, 0x4C, 0x12, 0xBB, 0x00,
+  0xAE, 0xD8, 0xB0, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF7, 0xED,
+  0x50, 0x0F, 0x81, 0x4E, 0x10, 0xF1, 0x00, 0xB5, 0x0F, 0x10, 0x0B, 0x50, 0xF8, 0x14, 0xE1, 0x0F,
+  0x7E, 0xD5, 0x00, 0x03, 0xCF, 0xF5, 0x1E, 0x51, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x1E,
+  0x50, 0x00, 0x04, 0xCF, 0xF5, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00,
+  0x5D, 0xE7, 0xF0, 0x1E, 0x41, 0x9F, 0x05, 0xA0, 0x01, 0xF0, 0x5A, 0x00, 0x1F, 0x01, 0xE4, 0x19,
+  0xF0, 0x05, 0xDE, 0x7F, 0x00, 0x03, 0xCE, 0xD4, 0x01, 0xC3, 0x03, 0xD1, 0x5F, 0xFF, 0xFF, 0x35,
+  0xB0, 0x00, 0x00, 0x1E, 0x61, 0x00, 0x00, 0x3B, 0xEF, 0xE0, 0x03, 0xDF, 0x10, 0xA6, 0x00, 0x0C,
+  0x30, 0x0B, 0xFF, 0xC0, 0x0C, 0x30, 0x00, 0xC3, 0x00, 0x0C, 0x30, 0x00, 0xC3, 0x00, 0x0C, 0x30,
+  0x00, 0x05, 0xDE, 0x7F, 0x01, 0xE4, 0x19, 0xF0, 0x5A, 0x00, 0x1F, 0x05, 0xA0, 0x01, 0xF0, 0x1E,
+  0x41, 0x8F, 0x00, 0x5D, 0xE7, 0xE0, 0x00, 0x01, 0x8B, 0x00, 0xAF, 0xEB, 0x20, 0x0F, 0x00, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF7, 0xED, 0x50, 0x0F, 0x81, 0x4D, 0x00, 0xF0,
+  0x00, 0xE0, 0x0F, 0x00, 0x0E, 0x00, 0xF0, 0x00, 0xE0, 0x0F, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x00,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00,
+  0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x02, 0xE0, 0x3E, 0x70, 0x0F, 0x00, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x09, 0x90, 0x0F, 0x1B, 0x80, 0x00, 0xFC,
+  0x60, 0x00, 0x0F, 0x8B, 0x00, 0x00, 0xF0, 0x8B, 0x10, 0x0F, 0x00, 0x7B, 0x10, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x7E, 0xD4, 0x9E, 0xC2,
+  0x00, 0xF7, 0x16, 0xF6, 0x18, 0xA0, 0x0F, 0x00, 0x2E, 0x00, 0x3C, 0x00, 0xF0, 0x02, 0xD0, 0x03,
+  0xC0, 0x0F, 0x00, 0x2D, 0x00, 0x3C, 0x00, 0xF0, 0x02, 0xD0, 0x03, 0xC0, 0x0F, 0x7E, 0xD5, 0x00,
+  0xF8, 0x14, 0xD0, 0x0F, 0x00, 0x0E, 0x00, 0xF0, 0x00, 0xE0, 0x0F, 0x00, 0x0E, 0x00, 0xF0, 0x00,
+  0xE0, 0x04, 0xDE, 0xB2, 0x01, 0xE4, 0x18, 0xC0, 0x5B, 0x00, 0x0F, 0x15, 0xB0, 0x00, 0xF1, 0x1E,
+  0x41, 0x8C, 0x00, 0x4D, 0xEB, 0x20, 0x0F, 0x7E, 0xD5, 0x00, 0xF8, 0x14, 0xE1, 0x0F, 0x10, 0x0B,
+  0x50, 0xF1, 0x00, 0xB5, 0x0F, 0x81, 0x4E, 0x10, 0xF7, 0xED, 0x50, 0x0F, 0x00, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0x05, 0xDE, 0x7F, 0x01, 0xE4, 0x19, 0xF0, 0x5A, 0x00, 0x1F, 0x05, 0xA0, 0x01, 0xF0,
+  0x1E, 0x41, 0x9F, 0x00, 0x5D, 0xE7, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x7D,
+  0x80, 0xF8, 0x10, 0x0F, 0x10, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0A, 0xEF, 0xD0,
+  0x4B, 0x10, 0x00, 0x2E, 0x95, 0x10, 0x02, 0x7A, 0xD1, 0x00, 0x02, 0xE2, 0x6F, 0xFE, 0x70, 0x0F,
+  0x00, 0x00, 0xF0, 0x00, 0xBF, 0xFF, 0x10, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0E, 0x20,
+  0x00, 0x7E, 0xF1, 0x1E, 0x00, 0x0F, 0x01, 0xE0, 0x00, 0xF0, 0x1E, 0x00, 0x0F, 0x01, 0xE0, 0x01,
+  0xF0, 0x0E, 0x41, 0x8F, 0x00, 0x5E, 0xD7, 0xF0, 0x78, 0x00, 0x1E, 0x12, 0xE0, 0x06, 0x90, 0x0B,
+  0x50, 0xC4, 0x00, 0x5A, 0x3D, 0x00, 0x01, 0xE9, 0x70, 0x00, 0x09, 0xF2, 0x00, 0x69, 0x03, 0xF3,
+  0x09, 0x62, 0xD0, 0x7C, 0x70, 0xD2, 0x0D, 0x2B, 0x4B, 0x2D, 0x00, 0x96, 0xC0, 0xC6, 0x90, 0x05,
+  0xD9, 0x09, 0xD5, 0x00, 0x2F, 0x50, 0x5F, 0x10, 0x2D, 0x20, 0x8A, 0x00, 0x5C, 0x4D, 0x10, 0x00,
+  0x9E, 0x30, 0x00, 0x0C, 0xE4, 0x00, 0x09, 0x93, 0xD2, 0x05, 0xC0, 0x06, 0xB0, 0x79, 0x00, 0x1E,
+  0x11, 0xE1, 0x07, 0x80, 0x09, 0x60, 0xD2, 0x00, 0x3C, 0x4A, 0x00, 0x00, 0xCC, 0x40, 0x00, 0x06,
+  0xC0, 0x00, 0x00, 0x96, 0x00, 0x02, 0xFB, 0x00, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x04, 0xA0, 0x00,
+  0x3B, 0x10, 0x02, 0xB1, 0x00, 0x1B, 0x20, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x07, 0xE9, 0x00, 0x00,
+  0xE3, 0x00, 0x00, 0x0E, 0x10, 0x00, 0x03, 0xE0, 0x00, 0x09, 0xF7, 0x00, 0x00, 0x04, 0xE0, 0x00,
+  0x00, 0x0F, 0x10, 0x00, 0x00, 0xE1, 0x00, 0x00, 0x0D, 0x40, 0x00, 0x00, 0x6E, 0x90, 0x09, 0x50,
+  0x09, 0x50, 0x09, 0x50, 0x09, 0x50, 0x09, 0x50, 0x09, 0x50, 0x09, 0x50, 0x09, 0x50, 0x09, 0x50,
+  0x09, 0x50, 0x09, 0x50, 0x09, 0xE7, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
+  0xE3, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0xE0, 0x00,
+  0x00, 0x4D, 0x00, 0x00, 0x9E, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xE9, 0x21, 0x91,
+  0x07, 0x21, 0x7D, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xB0,
+  0x00, 0x00, 0x04, 0xA0, 0x05, 0xB0, 0x05, 0xB0, 0x05, 0xB0, 0x05, 0xB0, 0x05, 0xB0, 0x00, 0x05,
+  0x30, 0x00, 0x00, 0x53, 0x00, 0x01, 0xAE, 0xFA, 0x00, 0xB9, 0x63, 0x00, 0x0F, 0x15, 0x30, 0x00,
+  0xF1, 0x53, 0x00, 0x0B, 0x96, 0x30, 0x00, 0x1A, 0xEF, 0xA0, 0x00, 0x05, 0x30, 0x00, 0x00, 0x53,
+  0x00, 0x00, 0x3C, 0xE6, 0x00, 0x0C, 0x61, 0x80, 0x00, 0xF1, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F,
+  0xFF, 0xF2, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x05, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x03, 0x70, 0x00, 0x74, 0x1D, 0xBE, 0xBD, 0x10, 0x88, 0x17, 0x90, 0x0B, 0x20, 0x1B, 0x00, 0x88,
+  0x18, 0x80, 0x1D, 0xBE, 0xBD, 0x14, 0x70, 0x00, 0x73, 0x4B, 0x00, 0x0B, 0x40, 0xB4, 0x04, 0xA0,
+  0x02, 0xB0, 0xB2, 0x04, 0xFF, 0x8F, 0xF4, 0x00, 0x3F, 0x30, 0x04, 0xFF, 0xFF, 0xF4, 0x00, 0x1F,
+  0x10, 0x00, 0x01, 0xF1, 0x00, 0x09, 0x50, 0x09, 0x50, 0x09, 0x50, 0x09, 0x50, 0x00, 0x00, 0x09,
+  0x50, 0x09, 0x50, 0x09, 0x50, 0x09, 0x50, 0x09, 0xEF, 0x70, 0x1E, 0x10, 0x00, 0x0C, 0xA2, 0x00,
+  0x49, 0x4D, 0x60, 0x69, 0x01, 0xD0, 0x1A, 0xA5, 0xB0, 0x00, 0x5D, 0x40, 0x00, 0x08, 0x90, 0x1F,
+  0xFD, 0x30, 0x0D, 0x4B, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xDF, 0xD6, 0x00, 0x00,
+  0x09, 0x93, 0x13, 0x99, 0x00, 0x03, 0x93, 0xCF, 0xF2, 0x93, 0x00, 0x73, 0xB5, 0x00, 0x03, 0x60,
+  0x07, 0x3C, 0x50, 0x00, 0x37, 0x00, 0x39, 0x3C, 0xFF, 0x29, 0x30, 0x00, 0x9A, 0x31, 0x39, 0x80,
+  0x00, 0x00, 0x6D, 0xFD, 0x60, 0x00, 0x1F, 0xFC, 0x21, 0xBF, 0xF6, 0x59, 0x19, 0x71, 0xDE, 0x97,
+  0x00, 0x00, 0x04, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x17, 0x00, 0x5B, 0x3C,
+  0x40, 0x1E, 0x1B, 0x50, 0x00, 0x5B, 0x3C, 0x40, 0x00, 0x45, 0x17, 0x00, 0x00, 0x00, 0x00, 0x0C,
+  0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00, 0x0D, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xDF, 0xD6, 0x00, 0x00, 0x09, 0x93, 0x13, 0x99, 0x00, 0x03, 0x92, 0xFF, 0xB1, 0x93, 0x00, 0x73,
+  0x2A, 0x0C, 0x33, 0x60, 0x07, 0x32, 0xFF, 0xA0, 0x37, 0x00, 0x39, 0x2A, 0x2A, 0x39, 0x30, 0x00,
+  0x9A, 0x31, 0x39, 0x80, 0x00, 0x00, 0x6D, 0xFD, 0x60, 0x00, 0x0D, 0xFF, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xEC, 0x10, 0x0C, 0x27, 0x60, 0x07, 0xEC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00,
+  0x0D, 0x10, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x0D, 0x10, 0x00, 0x00, 0x00, 0xD1, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0x10, 0x7F, 0xE6, 0x00, 0x56, 0x16, 0x40,
+  0x7F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE7, 0x09, 0xF5, 0x00, 0x3C,
+  0x7F, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x30, 0x00, 0x94, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0x01, 0xE0, 0x00, 0xF0, 0x1E, 0x00, 0x0F, 0x01,
+  0xE0, 0x01, 0xF0, 0x1F, 0x40, 0x7F, 0x01, 0xE9, 0xE8, 0xBA, 0x1E, 0x00, 0x00, 0x01, 0xE0, 0x00,
+  0x00, 0x04, 0xCF, 0xFC, 0x00, 0xEF, 0xF0, 0xC0, 0x2F, 0xFF, 0x0C, 0x00, 0xCF, 0xF0, 0xC0, 0x01,
+  0x8E, 0x0C, 0x00, 0x00, 0xB0, 0xC0, 0x00, 0x0B, 0x0C, 0x00, 0x00, 0xB0, 0xC0, 0x00, 0x0B, 0x0C,
+  0x00, 0x0C, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x06, 0xF9,
+  0x00, 0x4F, 0xB0, 0x01, 0xB0, 0x01, 0xB0, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1B, 0xEC, 0x26, 0x91, 0x68, 0x69, 0x16, 0x81, 0xBE, 0xC2, 0x00, 0x00, 0x04, 0xFF, 0xF7,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x07, 0x20, 0x00, 0x7A, 0x3C, 0x20, 0x00, 0x97, 0x4C, 0x00,
+  0x7A, 0x3C, 0x20, 0x08, 0x07, 0x20, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x1B, 0x10, 0x00,
+  0x1B, 0x00, 0x08, 0x50, 0x00, 0x01, 0xB0, 0x03, 0xA0, 0x00, 0x02, 0xFF, 0xC0, 0xB2, 0x00, 0x00,
+  0x00, 0x00, 0x67, 0x00, 0x89, 0x00, 0x00, 0x2B, 0x00, 0x43, 0x90, 0x00, 0x0A, 0x30, 0x5F, 0xFF,
+  0x50, 0x04, 0x80, 0x00, 0x03, 0x90, 0x4F, 0xB0, 0x00, 0x1B, 0x10, 0x00, 0x1B, 0x00, 0x08, 0x50,
+  0x00, 0x01, 0xB0, 0x03, 0xA0, 0x00, 0x02, 0xFF, 0xC0, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x67, 0x3F,
+  0xF9, 0x00, 0x00, 0x2B, 0x00, 0x02, 0x90, 0x00, 0x0A, 0x30, 0x05, 0x50, 0x00, 0x04, 0x80, 0x04,
+  0xFF, 0xF0, 0x5F, 0xE7, 0x00, 0x1B, 0x10, 0x00, 0x9F, 0x50, 0x08, 0x50, 0x00, 0x00, 0x3C, 0x03,
+  0xA0, 0x00, 0x07, 0xFE, 0x60, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x67, 0x00, 0x89, 0x00, 0x00, 0x2B,
+  0x00, 0x43, 0x90, 0x00, 0x0A, 0x30, 0x5F, 0xFF, 0x50, 0x04, 0x80, 0x00, 0x03, 0x90, 0x00, 0x5B,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x69, 0x00, 0x02, 0xD3, 0x00, 0x1D, 0x50, 0x00,
+  0x3E, 0x20, 0x00, 0x08, 0xEF, 0xF1, 0x00, 0x2A, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0x80, 0x00, 0x00, 0x7A, 0xE0, 0x00, 0x00, 0xC3, 0xB5, 0x00, 0x03, 0xD0, 0x5B, 0x00, 0x09, 0x70,
+  0x0E, 0x20, 0x0E, 0xFF, 0xFF, 0x70, 0x5C, 0x00, 0x04, 0xD0, 0xB6, 0x00, 0x00, 0xD4, 0x00, 0x07,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7A, 0xE0, 0x00, 0x00, 0xC3,
+  0xB5, 0x00, 0x03, 0xD0, 0x5B, 0x00, 0x09, 0x70, 0x0E, 0x20, 0x0E, 0xFF, 0xFF, 0x70, 0x5C, 0x00,
+  0x04, 0xD0, 0xB6, 0x00, 0x00, 0xD4, 0x00, 0x58, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0x80, 0x00, 0x00, 0x7A, 0xE0, 0x00, 0x00, 0xC3, 0xB5, 0x00, 0x03, 0xD0, 0x5B, 0x00, 0x09, 0x70,
+  0x0E, 0x20, 0x0E, 0xFF, 0xFF, 0x70, 0x5C, 0x00, 0x04, 0xD0, 0xB6, 0x00, 0x00, 0xD4, 0x00, 0x9B,
+  0x57, 0x00, 0x00, 0xB5, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7A,
+  0xE0, 0x00, 0x00, 0xC3, 0xB5, 0x00, 0x03, 0xD0, 0x5B, 0x00, 0x09, 0x70, 0x0E, 0x20, 0x0E, 0xFF,
+  0xFF, 0x70, 0x5C, 0x00, 0x04, 0xD0, 0xB6, 0x00, 0x00, 0xD4, 0x00, 0xC4, 0xB5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7A, 0xE0, 0x00, 0x00, 0xC3, 0xB5, 0x00, 0x03, 0xD0,
+  0x5B, 0x00, 0x09, 0x70, 0x0E, 0x20, 0x0E, 0xFF, 0xFF, 0x70, 0x5C, 0x00, 0x04, 0xD0, 0xB6, 0x00,
+  0x00, 0xD4, 0x00, 0x5E, 0xB1, 0x00, 0x00, 0xA3, 0xA2, 0x00, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0x7A,
+  0xE1, 0x00, 0x00, 0xC3, 0xA5, 0x00, 0x03, 0xD0, 0x5B, 0x00, 0x09, 0x70, 0x0E, 0x20, 0x0E, 0xFF,
+  0xFF, 0x70, 0x5C, 0x00, 0x04, 0xD0, 0xB6, 0x00, 0x00, 0xD4, 0x00, 0x0C, 0xFF, 0xFF, 0xFE, 0x00,
+  0x03, 0xD3, 0xE0, 0x00, 0x00, 0x00, 0xA7, 0x2E, 0x00, 0x00, 0x00, 0x1E, 0x12, 0xFF, 0xFF, 0xB0,
+  0x07, 0x90, 0x2E, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xE0, 0x00, 0x00, 0x5C, 0x00, 0x2E, 0x00, 0x00,
+  0x0B, 0x50, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x8D, 0xFC, 0x50, 0x0A, 0xC3, 0x13, 0xA1, 0x2F, 0x20,
+  0x00, 0x00, 0x5D, 0x00, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x00, 0x0A, 0xC3,
+  0x13, 0x91, 0x00, 0x8D, 0xFC, 0x50, 0x00, 0x00, 0x83, 0x00, 0x00, 0x0B, 0xE3, 0x00, 0x00, 0x3A,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0x20, 0xE3, 0x00, 0x00, 0x0E, 0x30, 0x00, 0x00,
+  0xEF, 0xFF, 0xF0, 0x0E, 0x30, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x0E, 0x30, 0x00, 0x00, 0xEF, 0xFF,
+  0xF4, 0x00, 0x09, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0x20, 0xE3, 0x00, 0x00, 0x0E,
+  0x30, 0x00, 0x00, 0xEF, 0xFF, 0xF0, 0x0E, 0x30, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x0E, 0x30, 0x00,
+  0x00, 0xEF, 0xFF, 0xF4, 0x00, 0x78, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0x20, 0xE3,
+  0x00, 0x00, 0x0E, 0x30, 0x00, 0x00, 0xEF, 0xFF, 0xF0, 0x0E, 0x30, 0x00, 0x00, 0xE3, 0x00, 0x00,
+  0x0E, 0x30, 0x00, 0x00, 0xEF, 0xFF, 0xF4, 0x00, 0xF1, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF,
+  0xFF, 0x20, 0xE3, 0x00, 0x00, 0x0E, 0x30, 0x00, 0x00, 0xEF, 0xFF, 0xF0, 0x0E, 0x30, 0x00, 0x00,
+  0xE3, 0x00, 0x00, 0x0E, 0x30, 0x00, 0x00, 0xEF, 0xFF, 0xF4, 0x3A, 0x10, 0x00, 0x0E, 0x30, 0xE3,
+  0x0E, 0x30, 0xE3, 0x0E, 0x30, 0xE3, 0x0E, 0x30, 0xE3, 0x08, 0x50, 0x00, 0x0E, 0x30, 0xE3, 0x0E,
+  0x30, 0xE3, 0x0E, 0x30, 0xE3, 0x0E, 0x30, 0xE3, 0x06, 0x88, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x00,
+  0x0E, 0x30, 0x00, 0xE3, 0x00, 0x0E, 0x30, 0x00, 0xE3, 0x00, 0x0E, 0x30, 0x00, 0xE3, 0x00, 0x0E,
+  0x30, 0xF2, 0xD3, 0x00, 0x00, 0x0E, 0x30, 0x0E, 0x30, 0x0E, 0x30, 0x0E, 0x30, 0x0E, 0x30, 0x0E,
+  0x30, 0x0E, 0x30, 0x0E, 0x30, 0x0D, 0xFF, 0xEA, 0x30, 0x00, 0xD3, 0x02, 0x7E, 0x30, 0x0D, 0x30,
+  0x00, 0x9A, 0x0E, 0xFF, 0xF0, 0x05, 0xD0, 0x0D, 0x30, 0x00, 0x5D, 0x00, 0xD3, 0x00, 0x09, 0xA0,
+  0x0D, 0x30, 0x27, 0xF3, 0x00, 0xDF, 0xFE, 0xB3, 0x00, 0x00, 0x5E, 0x4B, 0x00, 0x00, 0x94, 0xC7,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0xE2, 0x0E, 0xD5, 0x00, 0xE2, 0x0E, 0x6D, 0x00,
+  0xE2, 0x0E, 0x2B, 0x60, 0xE2, 0x0E, 0x23, 0xD1, 0xE2, 0x0E, 0x20, 0xA7, 0xE2, 0x0E, 0x20, 0x2E,
+  0xE2, 0x0E, 0x20, 0x09, 0xF2, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D,
+  0xFC, 0x50, 0x00, 0xAC, 0x31, 0x5E, 0x50, 0x2F, 0x20, 0x00, 0x7C, 0x05, 0xD0, 0x00, 0x03, 0xF0,
+  0x5D, 0x00, 0x00, 0x3F, 0x02, 0xF2, 0x00, 0x06, 0xC0, 0x0A, 0xC3, 0x15, 0xE5, 0x00, 0x08, 0xEF,
+  0xC5, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xFC, 0x50, 0x00,
+  0xAC, 0x31, 0x5E, 0x50, 0x2F, 0x20, 0x00, 0x7C, 0x05, 0xD0, 0x00, 0x03, 0xF0, 0x5D, 0x00, 0x00,
+  0x3F, 0x02, 0xF2, 0x00, 0x06, 0xC0, 0x0A, 0xC3, 0x15, 0xE5, 0x00, 0x08, 0xEF, 0xC5, 0x00, 0x00,
+  0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xFC, 0x50, 0x00, 0xAC, 0x31, 0x5E,
+  0x50, 0x2F, 0x20, 0x00, 0x7C, 0x05, 0xD0, 0x00, 0x03, 0xF0, 0x5D, 0x00, 0x00, 0x3F, 0x02, 0xF2,
+  0x00, 0x06, 0xC0, 0x0A, 0xC3, 0x15, 0xE5, 0x00, 0x08, 0xEF, 0xC5, 0x00, 0x00, 0x2E, 0x6A, 0x10,
+  0x00, 0x06, 0x6A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xDF, 0xC5, 0x00, 0x0A, 0xC3,
+  0x15, 0xE5, 0x02, 0xF2, 0x00, 0x07, 0xC0, 0x5D, 0x00, 0x00, 0x3F, 0x05, 0xD0, 0x00, 0x03, 0xF0,
+  0x2F, 0x20, 0x00, 0x6C, 0x00, 0xAC, 0x31, 0x5E, 0x50, 0x00, 0x8E, 0xFC, 0x50, 0x00, 0x00, 0x4C,
+  0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xFC, 0x50, 0x00, 0xAC, 0x31, 0x5E, 0x50,
+  0x2F, 0x20, 0x00, 0x7C, 0x05, 0xD0, 0x00, 0x03, 0xF0, 0x5D, 0x00, 0x00, 0x3F, 0x02, 0xF2, 0x00,
+  0x06, 0xC0, 0x0A, 0xC3, 0x15, 0xE5, 0x00, 0x08, 0xEF, 0xC5, 0x00, 0x03, 0x90, 0x00, 0x77, 0x00,
+  0x09, 0xA0, 0x7B, 0x10, 0x00, 0x08, 0xDB, 0x10, 0x00, 0x00, 0x8D, 0xB1, 0x00, 0x00, 0x9A, 0x07,
+  0xB1, 0x00, 0x3A, 0x00, 0x07, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x08, 0xEE, 0xB4, 0xB0, 0x09, 0xC3, 0x16, 0xF5, 0x02, 0xF2, 0x00, 0xA9, 0xB0, 0x5D, 0x00, 0xA4,
+  0x2E, 0x04, 0xC0, 0x95, 0x03, 0xF0, 0x2E, 0x96, 0x00, 0x6C, 0x00, 0xAD, 0x31, 0x5E, 0x50, 0x39,
+  0x6D, 0xFC, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0x10, 0x00, 0xF1, 0x1F, 0x10, 0x00, 0xF1, 0x1F, 0x10, 0x00, 0xF1, 0x1F, 0x10, 0x00, 0xF1,
+  0x1F, 0x10, 0x00, 0xF1, 0x0E, 0x20, 0x02, 0xF0, 0x0A, 0xA1, 0x19, 0xB0, 0x01, 0xAE, 0xEA, 0x10,
+  0x00, 0x04, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x10, 0x00, 0xF1, 0x1F, 0x10, 0x00, 0xF1,
+  0x1F, 0x10, 0x00, 0xF1, 0x1F, 0x10, 0x00, 0xF1, 0x1F, 0x10, 0x00, 0xF1, 0x0E, 0x20, 0x02, 0xF0,
+  0x0A, 0xA1, 0x19, 0xB0, 0x01, 0xAE, 0xEA, 0x10, 0x00, 0x29, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0x10, 0x00, 0xF1, 0x1F, 0x10, 0x00, 0xF1, 0x1F, 0x10, 0x00, 0xF1, 0x1F, 0x10, 0x00, 0xF1,
+  0x1F, 0x10, 0x00, 0xF1, 0x0E, 0x20, 0x02, 0xF0, 0x0A, 0xA1, 0x19, 0xB0, 0x01, 0xAE, 0xEA, 0x10,
+  0x00, 0x88, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x10, 0x00, 0xF1, 0x1F, 0x10, 0x00, 0xF1,
+  0x1F, 0x10, 0x00, 0xF1, 0x1F, 0x10, 0x00, 0xF1, 0x1F, 0x10, 0x00, 0xF1, 0x0E, 0x20, 0x02, 0xF0,
+  0x0A, 0xA1, 0x19, 0xB0, 0x01, 0xAE, 0xEA, 0x10, 0x00, 0x01, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0x70, 0x00, 0xB6, 0x01, 0xD3, 0x06, 0xB0, 0x00, 0x5C, 0x2D, 0x20, 0x00, 0x0A, 0xE6, 0x00,
+  0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00,
+  0x0E, 0x30, 0x00, 0x00, 0xEF, 0xFD, 0x50, 0x0E, 0x30, 0x5F, 0x10, 0xE3, 0x00, 0xE3, 0x0E, 0x30,
+  0x5F, 0x10, 0xEF, 0xFD, 0x50, 0x0E, 0x30, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x03, 0xCE, 0xB1, 0x00,
+  0xC6, 0x18, 0x80, 0x0F, 0x02, 0xA9, 0x00, 0xF0, 0xC4, 0x00, 0x0F, 0x0C, 0x40, 0x00, 0xF0, 0x4E,
+  0x70, 0x0F, 0x00, 0x1C, 0x40, 0xF0, 0x01, 0xB5, 0x0F, 0x6F, 0xEA, 0x00, 0x04, 0xB0, 0x00, 0x00,
+  0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEB, 0x10, 0x00, 0x01, 0x88, 0x00, 0x8D, 0xFF,
+  0xB0, 0x3D, 0x20, 0x5B, 0x04, 0xC1, 0x2B, 0xB0, 0x0A, 0xED, 0x8B, 0x00, 0x00, 0x07, 0x80, 0x00,
+  0x03, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEB, 0x10, 0x00, 0x01, 0x88, 0x00, 0x8D, 0xFF,
+  0xB0, 0x3D, 0x20, 0x5B, 0x04, 0xC1, 0x2B, 0xB0, 0x0A, 0xED, 0x8B, 0x00, 0x00, 0x8C, 0x10, 0x00,
+  0x39, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEB, 0x10, 0x00, 0x01, 0x88, 0x00, 0x8D, 0xFF,
+  0xB0, 0x3D, 0x20, 0x5B, 0x04, 0xC1, 0x2B, 0xB0, 0x0A, 0xED, 0x8B, 0x00, 0x04, 0xE4, 0xB0, 0x00,
+  0x83, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEB, 0x10, 0x00, 0x01, 0x88, 0x00, 0x8D, 0xFF,
+  0xB0, 0x3D, 0x20, 0x5B, 0x04, 0xC1, 0x2B, 0xB0, 0x0A, 0xED, 0x8B, 0x00, 0x06, 0xA5, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x0E, 0xFE, 0xB1, 0x00, 0x00, 0x18, 0x80, 0x08, 0xDF, 0xFB, 0x03, 0xD2, 0x05,
+  0xB0, 0x4C, 0x12, 0xBB, 0x00, 0xAE, 0xD8, 0xB0, 0x01, 0xBE, 0x40, 0x00, 0x49, 0x49, 0x00, 0x01,
+  0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFE, 0xB1, 0x00, 0x00, 0x18, 0x80, 0x08, 0xDF, 0xFB,
+  0x03, 0xD2, 0x05, 0xB0, 0x4C, 0x12, 0xBB, 0x00, 0xAE, 0xD8, 0xB0, 0x0E, 0xFE, 0xA3, 0xCF, 0xC4,
+  0x00, 0x00, 0x18, 0xE3, 0x03, 0xD1, 0x08, 0xDF, 0xFF, 0xFF, 0xFF, 0x33, 0xD2, 0x05, 0xC0, 0x00,
+  0x00, 0x4C, 0x12, 0xCF, 0x61, 0x00, 0x00, 0x9E, 0xD7, 0x5C, 0xEF, 0xF0, 0x03, 0xCF, 0xF5, 0x1E,
+  0x51, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x1E, 0x50, 0x00, 0x04, 0xCF, 0xF5, 0x00, 0x06,
+  0x50, 0x00, 0x9F, 0x50, 0x01, 0xC2, 0x00, 0x00, 0x02, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
+  0xED, 0x40, 0x1C, 0x30, 0x3D, 0x15, 0xFF, 0xFF, 0xF3, 0x5B, 0x00, 0x00, 0x01, 0xE6, 0x10, 0x00,
+  0x03, 0xBE, 0xFE, 0x00, 0x00, 0x02, 0xC1, 0x00, 0x01, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
+  0xED, 0x40, 0x1C, 0x30, 0x3D, 0x15, 0xFF, 0xFF, 0xF3, 0x5B, 0x00, 0x00, 0x01, 0xE6, 0x10, 0x00,
+  0x03, 0xBE, 0xFE, 0x00, 0x00, 0x4E, 0x40, 0x00, 0x1B, 0x2B, 0x10, 0x00, 0x00, 0x00, 0x00, 0x3C,
+  0xED, 0x40, 0x1C, 0x30, 0x3D, 0x15, 0xFF, 0xFF, 0xF3, 0x5B, 0x00, 0x00, 0x01, 0xE6, 0x10, 0x00,
+  0x03, 0xBE, 0xFE, 0x00, 0x01, 0xF0, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCE, 0xD4, 0x01, 0xC3,
+  0x03, 0xD1, 0x5F, 0xFF, 0xFF, 0x35, 0xB0, 0x00, 0x00, 0x1E, 0x61, 0x00, 0x00, 0x3B, 0xEF, 0xE0,
+  0x1C, 0x30, 0x02, 0xB1, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+  0x00, 0xF0, 0x02, 0xC1, 0x0B, 0x20, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00,
+  0x0F, 0x00, 0x0F, 0x00, 0x03, 0xE4, 0x00, 0xB2, 0xB1, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0x0F, 0x20, 0x00, 0x00,
+  0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01,
+  0xB8, 0x73, 0x00, 0x56, 0xA7, 0x00, 0x04, 0xDF, 0xF5, 0x01, 0xE5, 0x15, 0xD0, 0x5B, 0x00, 0x0F,
+  0x15, 0xB0, 0x00, 0xF1, 0x1E, 0x41, 0x8B, 0x00, 0x4C, 0xEB, 0x20, 0x00, 0xC8, 0x74, 0x00, 0x28,
+  0x7D, 0x10, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xED, 0x50, 0x0F, 0x81, 0x4D, 0x00, 0xF0, 0x00, 0xE0,
+  0x0F, 0x00, 0x0E, 0x00, 0xF0, 0x00, 0xE0, 0x0F, 0x00, 0x0E, 0x00, 0x02, 0xC1, 0x00, 0x00, 0x03,
+  0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xEB, 0x20, 0x1E, 0x41, 0x8C, 0x05, 0xB0, 0x00, 0xF1,
+  0x5B, 0x00, 0x0F, 0x11, 0xE4, 0x18, 0xC0, 0x04, 0xDE, 0xB2, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x01,
+  0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xEB, 0x20, 0x1E, 0x41, 0x8C, 0x05, 0xB0, 0x00, 0xF1,
+  0x5B, 0x00, 0x0F, 0x11, 0xE4, 0x18, 0xC0, 0x04, 0xDE, 0xB2, 0x00, 0x00, 0x5D, 0x20, 0x00, 0x1A,
+  0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xEB, 0x20, 0x1E, 0x41, 0x8C, 0x05, 0xB0, 0x00, 0xF1,
+  0x5B, 0x00, 0x0F, 0x11, 0xE4, 0x18, 0xC0, 0x04, 0xDE, 0xB2, 0x00, 0x02, 0xD6, 0x91, 0x00, 0x56,
+  0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xEB, 0x20, 0x1E, 0x41, 0x8C, 0x05, 0xB0, 0x00, 0xF1,
+  0x5B, 0x00, 0x0F, 0x11, 0xE4, 0x18, 0xC0, 0x04, 0xDE, 0xB2, 0x00, 0x03, 0xD2, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xDE, 0xB2, 0x01, 0xE4, 0x18, 0xC0, 0x5B, 0x00, 0x0F, 0x15, 0xB0, 0x00, 0xF1,
+  0x1E, 0x41, 0x8C, 0x00, 0x4D, 0xEB, 0x20, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0C, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5D, 0xEA, 0xB2, 0x2E, 0x41, 0xCB, 0x05, 0xB0, 0x85, 0xF1,
+  0x5B, 0x85, 0x0F, 0x11, 0xE9, 0x18, 0xC0, 0x4A, 0xCE, 0xB2, 0x02, 0x00, 0x00, 0x00, 0x02, 0xC1,
+  0x00, 0x00, 0x03, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0xF0, 0x1E, 0x00, 0x0F, 0x01,
+  0xE0, 0x00, 0xF0, 0x1E, 0x00, 0x1F, 0x00, 0xE4, 0x18, 0xF0, 0x05, 0xED, 0x7F, 0x00, 0x00, 0x04,
+  0xB0, 0x00, 0x01, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0xF0, 0x1E, 0x00, 0x0F, 0x01,
+  0xE0, 0x00, 0xF0, 0x1E, 0x00, 0x1F, 0x00, 0xE4, 0x18, 0xF0, 0x05, 0xED, 0x7F, 0x00, 0x00, 0x5E,
+  0x20, 0x00, 0x1B, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0xF0, 0x1E, 0x00, 0x0F, 0x01,
+  0xE0, 0x00, 0xF0, 0x1E, 0x00, 0x1F, 0x00, 0xE4, 0x18, 0xF0, 0x05, 0xED, 0x7F, 0x00, 0x03, 0xE1,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0x01, 0xE0, 0x00, 0xF0, 0x1E, 0x00, 0x0F, 0x01,
+  0xE0, 0x01, 0xF0, 0x0E, 0x41, 0x8F, 0x00, 0x5E, 0xD7, 0xF0, 0x00, 0x06, 0x90, 0x00, 0x02, 0xA0,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x90, 0x01, 0xE1, 0x1E, 0x10, 0x78, 0x00, 0x96, 0x0D, 0x20, 0x03,
+  0xC4, 0xA0, 0x00, 0x0C, 0xC4, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x09, 0x60, 0x00, 0x2F, 0xB0, 0x00,
+  0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF7, 0xED, 0x50, 0x0F,
+  0x81, 0x4E, 0x10, 0xF1, 0x00, 0xB5, 0x0F, 0x10, 0x0B, 0x50, 0xF8, 0x14, 0xE1, 0x0F, 0x7E, 0xD5,
+  0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x05, 0xB4, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x79,
+  0x00, 0x1E, 0x11, 0xE1, 0x07, 0x80, 0x09, 0x60, 0xD2, 0x00, 0x3C, 0x4A, 0x00, 0x00, 0xCC, 0x40,
+  0x00, 0x06, 0xC0, 0x00, 0x00, 0x96, 0x00, 0x02, 0xFB, 0x00, 0x00,
+};
+
+static const SmoothGlyph smoothSmallGlyphs[SMOOTH_GLYPH_COUNT] = {
+  {    0,  0,  0,  4,   0,   0},   // U+0020
+  {    0,  4,  8,  4,   0,  -8},   // U+0021
+  {   16,  5,  8,  5,   0,  -8},   // U+0022
+  {   36,  9,  8,  9,   0,  -8},   // U+0023
+  {   72,  7, 10,  7,   0,  -8},   // U+0024
+  {  107, 10,  8, 10,   0,  -8},   // U+0025
+  {  147,  9,  8,  9,   0,  -8},   // U+0026
+  {  183,  3,  8,  3,   0,  -8},   // U+0027
+  {  195,  4, 10,  4,   0,  -9},   // U+0028
+  {  215,  4, 10,  4,   0,  -9},   // U+0029
+  {  235,  6,  8,  6,   0,  -8},   // U+002A
+  {  259,  9,  7,  9,   0,  -7},   // U+002B
+  {  291,  4,  2,  4,   0,  -1},   // U+002C
+  {  295,  4,  4,  4,   0,  -4},   // U+002D
+  {  303,  4,  1,  4,   0,  -1},   // U+002E
+  {  305,  4,  9,  4,   0,  -8},   // U+002F
+  {  323,  7,  8,  7,   0,  -8},   // U+0030
+  {  351,  7,  8,  7,   0,  -8},   // U+0031
+  {  379,  7,  8,  7,   0,  -8},   // U+0032
+  {  407,  7,  8,  7,   0,  -8},   // U+0033
+  {  435,  7,  8,  7,   0,  -8},   // U+0034
+  {  463,  7,  8,  7,   0,  -8},   // U+0035
+  {  491,  7,  8,  7,   0,  -8},   // U+0036
+  {  519,  7,  8,  7,   0,  -8},   // U+0037
+  {  547,  7,  8,  7,   0,  -8},   // U+0038
+  {  575,  7,  8,  7,   0,  -8},   // U+0039
+  {  603,  4,  6,  4,   0,  -6},   // U+003A
+  {  615,  4,  7,  4,   0,  -6},   // U+003B
+  {  629,  9,  6,  9,   0,  -6},   // U+003C
+  {  656,  9,  5,  9,   0,  -5},   // U+003D
+  {  679,  9,  6,  9,   0,  -6},   // U+003E
+  {  706,  6,  8,  6,   0,  -8},   // U+003F
+  {  730, 11, 10, 11,   0,  -8},   // U+0040
+  {  785,  8,  8,  8,   0,  -8},   // U+0041
+  {  817,  8,  8,  8,   0,  -8},   // U+0042
+  {  849,  8,  8,  8,   0,  -8},   // U+0043
+  {  881,  8,  8,  8,   0,  -8},   // U+0044
+  {  913,  7,  8,  7,   0,  -8},   // U+0045
+  {  941,  6,  8,  6,   0,  -8},   // U+0046
+  {  965,  9,  8,  9,   0,  -8},   // U+0047
+  { 1001,  8,  8,  8,   0,  -8},   // U+0048
+  { 1033,  3,  8,  3,   0,  -8},   // U+0049
+  { 1045,  4, 10,  3,  -1,  -8},   // U+004A
+  { 1065,  8,  8,  7,   0,  -8},   // U+004B
+  { 1097,  7,  8,  6,   0,  -8},   // U+004C
+  { 1125,  9,  8,  9,   0,  -8},   // U+004D
+  { 1161,  8,  8,  8,   0,  -8},   // U+004E
+  { 1193,  9,  8,  9,   0,  -8},   // U+004F
+  { 1229,  7,  8,  7,   0,  -8},   // U+0050
+  { 1257,  9,  9,  9,   0,  -8},   // U+0051
+  { 1298,  8,  8,  8,   0,  -8},   // U+0052
+  { 1330,  7,  8,  7,   0,  -8},   // U+0053
+  { 1358,  8,  8,  7,  -1,  -8},   // U+0054
+  { 1390,  8,  8,  8,   0,  -8},   // U+0055
+  { 1422,  8,  8,  8,   0,  -8},   // U+0056
+  { 1454, 11,  8, 11,   0,  -8},   // U+0057
+  { 1498,  8,  8,  8,   0,  -8},   // U+0058
+  { 1530,  8,  8,  7,  -1,  -8},   // U+0059
+  { 1562,  8,  8,  8,   0,  -8},   // U+005A
+  { 1594,  4, 10,  4,   0,  -8},   // U+005B
+  { 1614,  4,  9,  4,   0,  -8},   // U+005C
+  { 1632,  4, 10,  4,   0,  -8},   // U+005D
+  { 1652,  9,  8,  9,   0,  -8},   // U+005E
+  { 1688,  7,  3,  6,  -1,   0},   // U+005F
+  { 1699,  6,  9,  6,   0,  -9},   // U+0060
+  { 1726,  7,  6,  7,   0,  -6},   // U+0061
+  { 1747,  7,  9,  7,   0,  -9},   // U+0062
+  { 1779,  6,  6,  6,   0,  -6},   // U+0063
+  { 1797,  7,  9,  7,   0,  -9},   // U+0064
+  { 1829,  7,  6,  7,   0,  -6},   // U+0065
+  { 1850,  5,  9,  4,   0,  -9},   // U+0066
+  { 1873,  7,  8,  7,   0,  -6},   // U+0067
+  { 1901,  7,  9,  7,   0,  -9},   // U+0068
+  { 1933,  3,  8,  3,   0,  -8},   // U+0069
+  { 1945,  4, 10,  3,  -1,  -8},   // U+006A
+  { 1965,  7,  9,  6,   0,  -9},   // U+006B
+  { 1997,  3,  9,  3,   0,  -9},   // U+006C
+  { 2011, 11,  6, 11,   0,  -6},   // U+006D
+  { 2044,  7,  6,  7,   0,  -6},   // U+006E
+  { 2065,  7,  6,  7,   0,  -6},   // U+006F
+  { 2086,  7,  8,  7,   0,  -6},   // U+0070
+  { 2114,  7,  8,  7,   0,  -6},   // U+0071
+  { 2142,  5,  6,  5,   0,  -6},   // U+0072
+  { 2157,  6,  6,  6,   0,  -6},   // U+0073
+  { 2175,  5,  8,  4,   0,  -8},   // U+0074
+  { 2195,  7,  6,  7,   0,  -6},   // U+0075
+  { 2216,  7,  6,  7,   0,  -6},   // U+0076
+  { 2237,  9,  6,  9,   0,  -6},   // U+0077
+  { 2264,  7,  6,  7,   0,  -6},   // U+0078
+  { 2285,  7,  8,  7,   0,  -6},   // U+0079
+  { 2313,  6,  6,  6,   0,  -6},   // U+007A
+  { 2331,  7, 10,  7,   0,  -8},   // U+007B
+  { 2366,  4, 11,  4,   0,  -8},   // U+007C
+  { 2388,  7, 10,  7,   0,  -8},   // U+007D
+  { 2423,  9,  5,  9,   0,  -5},   // U+007E
+  { 2446,  0,  0,  4,   0,   0},   // U+00A0
+  { 2446,  4,  8,  4,   0,  -6},   // U+00A1
+  { 2462,  7, 10,  7,   0,  -8},   // U+00A2
+  { 2497,  7,  8,  7,   0,  -8},   // U+00A3
+  { 2525,  7,  8,  7,   0,  -8},   // U+00A4
+  { 2553,  7,  8,  7,   0,  -8},   // U+00A5
+  { 2581,  4,  9,  4,   0,  -8},   // U+00A6
+  { 2599,  6,  9,  6,   0,  -8},   // U+00A7
+  { 2626,  6,  8,  6,   0,  -8},   // U+00A8
+  { 2650, 11,  8, 11,   0,  -8},   // U+00A9
+  { 2694,  5,  8,  5,   0,  -8},   // U+00AA
+  { 2714,  7,  6,  7,   0,  -6},   // U+00AB
+  { 2735,  9,  5,  9,   0,  -5},   // U+00AC
+  { 2758,  4,  4,  4,   0,  -4},   // U+00AD
+  { 2766, 11,  8, 11,   0,  -8},   // U+00AE
+  { 2810,  6,  8,  6,   0,  -8},   // U+00AF
+  { 2834,  6,  8,  6,   0,  -8},   // U+00B0
+  { 2858,  9,  7,  9,   0,  -7},   // U+00B1
+  { 2890,  4,  8,  4,   0,  -8},   // U+00B2
+  { 2906,  4,  8,  4,   0,  -8},   // U+00B3
+  { 2922,  6,  9,  6,   0,  -9},   // U+00B4
+  { 2949,  7,  8,  7,   0,  -6},   // U+00B5
+  { 2977,  7,  9,  7,   0,  -8},   // U+00B6
+  { 3009,  4,  5,  4,   0,  -5},   // U+00B7
+  { 3019,  6,  2,  6,   0,   0},   // U+00B8
+  { 3025,  4,  8,  4,   0,  -8},   // U+00B9
+  { 3041,  5,  8,  5,   0,  -8},   // U+00BA
+  { 3061,  7,  6,  7,   0,  -6},   // U+00BB
+  { 3082, 11,  8, 11,   0,  -8},   // U+00BC
+  { 3126, 11,  8, 11,   0,  -8},   // U+00BD
+  { 3170, 11,  8, 11,   0,  -8},   // U+00BE
+  { 3214,  6,  8,  6,   0,  -6},   // U+00BF
+  { 3238,  8, 10,  8,   0, -10},   // U+00C0
+  { 3278,  8, 10,  8,   0, -10},   // U+00C1
+  { 3318,  8, 10,  8,   0, -10},   // U+00C2
+  { 3358,  8, 11,  8,   0, -11},   // U+00C3
+  { 3402,  8, 10,  8,   0, -10},   // U+00C4
+  { 3442,  8, 10,  8,   0, -10},   // U+00C5
+  { 3482, 11,  8, 11,   0,  -8},   // U+00C6
+  { 3526,  8, 10,  8,   0,  -8},   // U+00C7
+  { 3566,  7, 10,  7,   0, -10},   // U+00C8
+  { 3601,  7, 10,  7,   0, -10},   // U+00C9
+  { 3636,  7, 10,  7,   0, -10},   // U+00CA
+  { 3671,  7, 10,  7,   0, -10},   // U+00CB
+  { 3706,  3, 10,  3,   0, -10},   // U+00CC
+  { 3721,  3, 10,  3,   0, -10},   // U+00CD
+  { 3736,  5, 10,  3,  -1, -10},   // U+00CE
+  { 3761,  4, 10,  3,   0, -10},   // U+00CF
+  { 3781,  9,  8,  9,   0,  -8},   // U+00D0
+  { 3817,  8, 11,  8,   0, -11},   // U+00D1
+  { 3861,  9, 10,  9,   0, -10},   // U+00D2
+  { 3906,  9, 10,  9,   0, -10},   // U+00D3
+  { 3951,  9, 10,  9,   0, -10},   // U+00D4
+  { 3996,  9, 11,  9,   0, -11},   // U+00D5
+  { 4046,  9, 10,  9,   0, -10},   // U+00D6
+  { 4091,  9,  7,  9,   0,  -7},   // U+00D7
+  { 4123,  9, 10,  9,   0,  -9},   // U+00D8
+  { 4168,  8, 10,  8,   0, -10},   // U+00D9
+  { 4208,  8, 10,  8,   0, -10},   // U+00DA
+  { 4248,  8, 10,  8,   0, -10},   // U+00DB
+  { 4288,  8, 10,  8,   0, -10},   // U+00DC
+  { 4328,  8, 10,  7,  -1, -10},   // U+00DD
+  { 4368,  7,  8,  7,   0,  -8},   // U+00DE
+  { 4396,  7,  9,  7,   0,  -9},   // U+00DF
+  { 4428,  7,  9,  7,   0,  -9},   // U+00E0
+  { 4460,  7,  9,  7,   0,  -9},   // U+00E1
+  { 4492,  7,  9,  7,   0,  -9},   // U+00E2
+  { 4524,  7,  9,  7,   0,  -9},   // U+00E3
+  { 4556,  7,  8,  7,   0,  -8},   // U+00E4
+  { 4584,  7, 10,  7,   0, -10},   // U+00E5
+  { 4619, 11,  6, 11,   0,  -6},   // U+00E6
+  { 4652,  6,  8,  6,   0,  -6},   // U+00E7
+  { 4676,  7,  9,  7,   0,  -9},   // U+00E8
+  { 4708,  7,  9,  7,   0,  -9},   // U+00E9
+  { 4740,  7,  9,  7,   0,  -9},   // U+00EA
+  { 4772,  7,  8,  7,   0,  -8},   // U+00EB
+  { 4800,  4,  9,  3,  -1,  -9},   // U+00EC
+  { 4818,  4,  9,  3,   0,  -9},   // U+00ED
+  { 4836,  5,  9,  3,  -1,  -9},   // U+00EE
+  { 4859,  5,  8,  3,  -1,  -8},   // U+00EF
+  { 4879,  7,  8,  7,   0,  -8},   // U+00F0
+  { 4907,  7,  9,  7,   0,  -9},   // U+00F1
+  { 4939,  7,  9,  7,   0,  -9},   // U+00F2
+  { 4971,  7,  9,  7,   0,  -9},   // U+00F3
+  { 5003,  7,  9,  7,   0,  -9},   // U+00F4
+  { 5035,  7,  9,  7,   0,  -9},   // U+00F5
+  { 5067,  7,  8,  7,   0,  -8},   // U+00F6
+  { 5095,  9,  6,  9,   0,  -6},   // U+00F7
+  { 5122,  7,  8,  7,   0,  -7},   // U+00F8
+  { 5150,  7,  9,  7,   0,  -9},   // U+00F9
+  { 5182,  7,  9,  7,   0,  -9},   // U+00FA
+  { 5214,  7,  9,  7,   0,  -9},   // U+00FB
+  { 5246,  7,  8,  7,   0,  -8},   // U+00FC
+  { 5274,  7, 11,  7,   0,  -9},   // U+00FD
+  { 5313,  7, 11,  7,   0,  -9},   // U+00FE
+  { 5352,  7, 10,  7,   0,  -8},   // U+00FF
+};
+
+static const SmoothFont smoothFontSmall = {
+  smoothSmallData, smoothSmallGlyphs, 8, 11, 3, 0
+};
+
+// Medium: 18 px, menús y diálogos (FONT_SIZE_MEDIUM)
+static const uint8_t smoothMediumData[13881] = {
+  0x00, 0x4F, 0x80, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x4F,
+  0x80, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x2F, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x04, 0xF3,
+  0x0E, 0x80, 0x04, 0xF3, 0x0E, 0x80, 0x04, 0xF3, 0x0E, 0x80, 0x04, 0xF3, 0x0E, 0x80, 0x04, 0xF3,
+  0x0E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x80, 0x0D, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0xF5, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x10, 0x5F, 0x10, 0x00,
+  0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+  0x00, 0x0E, 0x70, 0x0E, 0x70, 0x00, 0x00, 0x00, 0x05, 0xF1, 0x05, 0xF1, 0x00, 0x00, 0x09, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0xE7,
+  0x00, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x30, 0x3F, 0x30, 0x00, 0x00, 0x00, 0x06, 0xF0, 0x06,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0x19, 0xDF, 0xEB, 0x50, 0x00, 0x1D, 0xFF, 0xFF, 0xFF,
+  0x20, 0x05, 0xFB, 0x2C, 0x24, 0xA2, 0x00, 0x7F, 0x20, 0xC1, 0x00, 0x00, 0x04, 0xF7, 0x0C, 0x10,
+  0x00, 0x00, 0x08, 0xFD, 0xE7, 0x30, 0x00, 0x00, 0x02, 0x7E, 0xDF, 0xB1, 0x00, 0x00, 0x00, 0xC1,
+  0x3E, 0xA0, 0x00, 0x00, 0x0C, 0x10, 0xBD, 0x00, 0x78, 0x30, 0xC2, 0x6F, 0xC0, 0x08, 0xFF, 0xFF,
+  0xFF, 0xF5, 0x00, 0x16, 0xBE, 0xFE, 0xB4, 0x00, 0x00, 0x00, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0xC1, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x8E, 0xE9, 0x00, 0x00, 0x05, 0xE1,
+  0x00, 0x00, 0x7E, 0x32, 0xD8, 0x00, 0x01, 0xE6, 0x00, 0x00, 0x0D, 0x80, 0x07, 0xE0, 0x00, 0x9C,
+  0x00, 0x00, 0x00, 0xF6, 0x00, 0x6F, 0x00, 0x4F, 0x30, 0x00, 0x00, 0x0D, 0x80, 0x07, 0xE0, 0x0D,
+  0x80, 0x00, 0x00, 0x00, 0x7D, 0x22, 0xD8, 0x08, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xE9, 0x13,
+  0xF4, 0x08, 0xDE, 0x91, 0x00, 0x00, 0x00, 0x00, 0xC9, 0x07, 0xE3, 0x2D, 0x90, 0x00, 0x00, 0x00,
+  0x6E, 0x10, 0xC9, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1E, 0x50, 0x0E, 0x70, 0x05, 0xF1, 0x00, 0x00,
+  0x0A, 0xB0, 0x00, 0xC9, 0x00, 0x7E, 0x00, 0x00, 0x05, 0xE2, 0x00, 0x07, 0xE3, 0x2D, 0x90, 0x00,
+  0x01, 0xD7, 0x00, 0x00, 0x08, 0xDE, 0x91, 0x00, 0x00, 0x02, 0xAD, 0xEB, 0x50, 0x00, 0x00, 0x00,
+  0x0D, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x4F, 0xB2, 0x03, 0xA2, 0x00, 0x00, 0x00, 0x4F, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFC, 0x10, 0x00,
+  0x00, 0x00, 0x01, 0xCB, 0x3D, 0xD3, 0x00, 0x0D, 0xC0, 0x08, 0xF2, 0x01, 0xCE, 0x50, 0x2F, 0x70,
+  0x0C, 0xD0, 0x00, 0x1B, 0xF7, 0x9E, 0x10, 0x0C, 0xF2, 0x00, 0x00, 0x9F, 0xF5, 0x00, 0x08, 0xFD,
+  0x51, 0x13, 0xAF, 0xF8, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xF6, 0x9F, 0x50, 0x00, 0x17, 0xCF, 0xEB,
+  0x30, 0x1E, 0xE2, 0x04, 0xF3, 0x00, 0x4F, 0x30, 0x04, 0xF3, 0x00, 0x4F, 0x30, 0x04, 0xF3, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF5, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x3F, 0x60, 0x00, 0x09,
+  0xE1, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x6F, 0x40, 0x00,
+  0x06, 0xF5, 0x00, 0x00, 0x5F, 0x60, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0E, 0xB0, 0x00, 0x00, 0x9E,
+  0x10, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x2F, 0x50, 0x05, 0xF2, 0x00, 0x00,
+  0x0C, 0xA0, 0x00, 0x00, 0x5F, 0x30, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F,
+  0x30, 0x00, 0x05, 0xF5, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x04, 0xF6, 0x00, 0x00, 0x5F, 0x50, 0x00,
+  0x07, 0xF3, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x1E, 0x90, 0x00, 0x05, 0xF3, 0x00, 0x00, 0xCA, 0x00,
+  0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xA1, 0x0F, 0x01, 0xA3, 0x19, 0xD4, 0xF4,
+  0xD9, 0x10, 0x04, 0xDF, 0xD4, 0x00, 0x00, 0x4D, 0xFD, 0x40, 0x01, 0x9D, 0x4F, 0x4D, 0x91, 0x3A,
+  0x10, 0xF0, 0x1A, 0x30, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x01, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0xED, 0x00, 0x03,
+  0xF5, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0xFF, 0xF9, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x00,
+  0x00, 0x00, 0x9E, 0x00, 0x00, 0x0D, 0x90, 0x00, 0x03, 0xF5, 0x00, 0x00, 0x7E, 0x10, 0x00, 0x0C,
+  0xA0, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x6F, 0x10, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF7, 0x00, 0x00,
+  0x5F, 0x30, 0x00, 0x09, 0xD0, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x08, 0xE0, 0x00,
+  0x00, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x06, 0xCF, 0xE9, 0x10, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x10,
+  0x02, 0xFE, 0x50, 0x2B, 0xF8, 0x00, 0x7F, 0x70, 0x00, 0x1E, 0xD0, 0x0A, 0xF2, 0x00, 0x00, 0xBF,
+  0x10, 0xBF, 0x00, 0x00, 0x09, 0xF3, 0x0C, 0xF0, 0x00, 0x00, 0x8F, 0x40, 0xBF, 0x00, 0x00, 0x09,
+  0xF3, 0x0A, 0xF2, 0x00, 0x00, 0xBF, 0x10, 0x7F, 0x70, 0x00, 0x1E, 0xD0, 0x02, 0xFE, 0x50, 0x2B,
+  0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x10, 0x00, 0x06, 0xCF, 0xE9, 0x10, 0x00, 0x00, 0x27, 0xCF,
+  0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xD8, 0x3D, 0xD0, 0x00, 0x00, 0x00, 0x00,
+  0xDD, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x00,
+  0x0D, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00,
+  0x00, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0xCF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0x6B, 0xEE, 0xC7, 0x10, 0x00, 0x9F, 0xFF, 0xFF, 0xFC, 0x10,
+  0x08, 0x94, 0x11, 0x4D, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x04, 0xF6,
+  0x00, 0x00, 0x00, 0x00, 0xBD, 0x10, 0x00, 0x00, 0x00, 0xAE, 0x30, 0x00, 0x00, 0x01, 0xAE, 0x30,
+  0x00, 0x00, 0x01, 0xCE, 0x30, 0x00, 0x00, 0x02, 0xDD, 0x20, 0x00, 0x00, 0x03, 0xED, 0x20, 0x00,
+  0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xA0, 0x0A, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x4A, 0xDE,
+  0xD9, 0x20, 0x00, 0x4F, 0xFF, 0xFF, 0xFE, 0x30, 0x03, 0xA4, 0x20, 0x2A, 0xF9, 0x00, 0x00, 0x00,
+  0x00, 0x2F, 0xA0, 0x00, 0x00, 0x00, 0x2A, 0xF5, 0x00, 0x00, 0x5F, 0xFF, 0xD6, 0x00, 0x00, 0x05,
+  0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x13, 0xAF, 0x90, 0x00, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x00,
+  0x00, 0x00, 0x0D, 0xF0, 0x08, 0x73, 0x11, 0x3A, 0xFB, 0x00, 0x9F, 0xFF, 0xFF, 0xFE, 0x30, 0x01,
+  0x7C, 0xEF, 0xD9, 0x20, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x80, 0x00, 0x00, 0x00, 0xAD, 0xF8, 0x00,
+  0x00, 0x00, 0x5E, 0x5F, 0x80, 0x00, 0x00, 0x1E, 0x63, 0xF8, 0x00, 0x00, 0x0A, 0xB0, 0x3F, 0x80,
+  0x00, 0x04, 0xE2, 0x03, 0xF8, 0x00, 0x01, 0xD5, 0x00, 0x3F, 0x80, 0x00, 0x9A, 0x00, 0x03, 0xF8,
+  0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x3F,
+  0x80, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
+  0x00, 0x00, 0x00, 0x01, 0xFD, 0xEF, 0xD7, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x10, 0x01, 0xA4,
+  0x11, 0x5D, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xED, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xC0, 0x08, 0x73, 0x11, 0x5D, 0xF7, 0x00, 0x9F, 0xFF, 0xFF, 0xFC, 0x10, 0x01,
+  0x7C, 0xEE, 0xC7, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xFD, 0x81, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0x70,
+  0x00, 0xBF, 0xC4, 0x02, 0x76, 0x00, 0x4F, 0xE1, 0x00, 0x00, 0x00, 0x08, 0xF7, 0x00, 0x00, 0x00,
+  0x00, 0xAF, 0x48, 0xEF, 0xC6, 0x00, 0x0B, 0xFA, 0xFF, 0xFF, 0xF7, 0x00, 0xBF, 0xE5, 0x11, 0x6F,
+  0xF1, 0x09, 0xF7, 0x00, 0x00, 0x9F, 0x40, 0x6F, 0x70, 0x00, 0x09, 0xF4, 0x01, 0xEE, 0x51, 0x16,
+  0xFF, 0x10, 0x06, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x05, 0xCE, 0xEC, 0x50, 0x00, 0x08, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0xCD, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00,
+  0x01, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00,
+  0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00, 0x2F, 0xB0, 0x00, 0x00, 0x00,
+  0x08, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDE, 0xEB, 0x40, 0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0x60,
+  0x06, 0xFC, 0x30, 0x17, 0xFC, 0x00, 0x6F, 0x50, 0x00, 0x0E, 0xD0, 0x02, 0xEC, 0x30, 0x17, 0xF8,
+  0x00, 0x03, 0xBF, 0xFF, 0xE8, 0x00, 0x00, 0x6D, 0xFF, 0xFF, 0xA1, 0x00, 0x5F, 0xB3, 0x11, 0x7F,
+  0xB0, 0x0A, 0xF2, 0x00, 0x00, 0xAF, 0x20, 0xBF, 0x20, 0x00, 0x0A, 0xF3, 0x09, 0xFB, 0x30, 0x17,
+  0xFE, 0x10, 0x2E, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x29, 0xDF, 0xEC, 0x50, 0x00, 0x00, 0x29, 0xDF,
+  0xD8, 0x10, 0x00, 0x2E, 0xFF, 0xFF, 0xFC, 0x00, 0x09, 0xFB, 0x20, 0x2A, 0xF7, 0x00, 0xCF, 0x10,
+  0x00, 0x0F, 0xC0, 0x0C, 0xF1, 0x00, 0x00, 0xFF, 0x00, 0x9F, 0xA2, 0x02, 0xAF, 0xF2, 0x02, 0xEF,
+  0xFF, 0xFE, 0xBF, 0x30, 0x02, 0xAE, 0xFB, 0x3C, 0xF2, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xA0, 0x00, 0xB4, 0x12, 0x8F, 0xF3, 0x00, 0x0F, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+  0x4B, 0xEE, 0xB4, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0xDF, 0x00,
+  0x00, 0xDF, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0xED, 0x00, 0x03, 0xF5, 0x00, 0x07, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9E, 0xFD, 0x20,
+  0x00, 0x00, 0x02, 0x7D, 0xFE, 0xA4, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xB6, 0x10, 0x00, 0x00, 0x01,
+  0xEF, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFD, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0xBF, 0xFB, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xDF, 0xEA, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x49, 0xEF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6B, 0x20, 0x01, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF3, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF3, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xC6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFE, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x9E, 0xFD, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xBF, 0xFB, 0x61, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x27, 0xDF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7C, 0xFE, 0x20, 0x00, 0x00, 0x01,
+  0x5B, 0xFF, 0xB6, 0x10, 0x00, 0x00, 0x49, 0xEF, 0xD8, 0x20, 0x00, 0x00, 0x01, 0xDF, 0xEA, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8C, 0xED, 0x91, 0x00,
+  0x0B, 0xFF, 0xFF, 0xFB, 0x00, 0x09, 0x72, 0x04, 0xEF, 0x20, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x00,
+  0x00, 0x00, 0xCE, 0x10, 0x00, 0x00, 0x0B, 0xF5, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x05,
+  0xF7, 0x00, 0x00, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0x08, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xF3, 0x00, 0x00, 0x00, 0x08, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8C,
+  0xEF, 0xDA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x09,
+  0xFE, 0x83, 0x10, 0x14, 0x9F, 0xE3, 0x00, 0x00, 0x7F, 0xA1, 0x00, 0x00, 0x00, 0x02, 0xDD, 0x10,
+  0x01, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x60, 0x06, 0xF1, 0x00, 0x4C, 0xED, 0x48, 0xB0,
+  0x09, 0xA0, 0x0A, 0xA0, 0x04, 0xFF, 0xFF, 0xFA, 0xB0, 0x09, 0xB0, 0x0C, 0x70, 0x09, 0xE4, 0x11,
+  0x3D, 0xB0, 0x0D, 0x90, 0x0C, 0x70, 0x09, 0xE4, 0x10, 0x3D, 0xB3, 0xBF, 0x40, 0x0A, 0xA0, 0x04,
+  0xFF, 0xFF, 0xFA, 0xFF, 0xF8, 0x00, 0x06, 0xE1, 0x00, 0x5C, 0xED, 0x48, 0xEA, 0x40, 0x00, 0x01,
+  0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xFD, 0x73, 0x11, 0x25, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xF7, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8C, 0xEE, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x8F, 0x20, 0x00, 0x00,
+  0x00, 0x3F, 0x72, 0xF8, 0x00, 0x00, 0x00, 0x09, 0xF1, 0x0C, 0xD0, 0x00, 0x00, 0x00, 0xEB, 0x00,
+  0x6F, 0x40, 0x00, 0x00, 0x5F, 0x50, 0x01, 0xEA, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x09, 0xF1, 0x00,
+  0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0D, 0xE1, 0x00,
+  0x00, 0x0A, 0xF3, 0x04, 0xF9, 0x00, 0x00, 0x00, 0x4F, 0x90, 0xAF, 0x30, 0x00, 0x00, 0x00, 0xDE,
+  0x10, 0x04, 0xFF, 0xFF, 0xFD, 0x92, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFE, 0x20, 0x04, 0xF8, 0x00,
+  0x03, 0xBF, 0x70, 0x04, 0xF8, 0x00, 0x00, 0x5F, 0x70, 0x04, 0xF8, 0x00, 0x02, 0xBF, 0x30, 0x04,
+  0xFF, 0xFF, 0xFF, 0xD6, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x04, 0xF8, 0x00, 0x02, 0x9F,
+  0x90, 0x04, 0xF8, 0x00, 0x00, 0x0D, 0xE0, 0x04, 0xF8, 0x00, 0x00, 0x0D, 0xF1, 0x04, 0xF8, 0x00,
+  0x02, 0x9F, 0xD0, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x04, 0xFF, 0xFF, 0xFE, 0xB4, 0x00, 0x00,
+  0x00, 0x6B, 0xEF, 0xDB, 0x61, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0xCF, 0xC5, 0x10,
+  0x24, 0x98, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xDF, 0xC5, 0x10, 0x24, 0x98, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x01, 0x7B,
+  0xEF, 0xDB, 0x61, 0x00, 0x04, 0xFF, 0xFF, 0xED, 0xA5, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xB1, 0x00, 0x04, 0xF8, 0x00, 0x13, 0x7E, 0xFB, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x01, 0xDF, 0x40,
+  0x04, 0xF8, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xB0, 0x04, 0xF8,
+  0x00, 0x00, 0x00, 0x1F, 0xC0, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xB0, 0x04, 0xF8, 0x00, 0x00,
+  0x00, 0x6F, 0x90, 0x04, 0xF8, 0x00, 0x00, 0x01, 0xDF, 0x40, 0x04, 0xF8, 0x00, 0x13, 0x7E, 0xFB,
+  0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x04, 0xFF, 0xFF, 0xED, 0xA5, 0x00, 0x00, 0x04,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x4F, 0xFF, 0xFF, 0xFF, 0xF1, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0x80, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x04, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF,
+  0xF3, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x04, 0xFF, 0xFF, 0xFF, 0xF5, 0x04, 0xFF, 0xFF, 0xFF,
+  0xF5, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00,
+  0x04, 0xFF, 0xFF, 0xFF, 0xB0, 0x04, 0xFF, 0xFF, 0xFF, 0xB0, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x04,
+  0xF8, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xF8,
+  0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xEF, 0xEC, 0x93, 0x00, 0x00,
+  0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0xCF, 0xC5, 0x20, 0x13, 0x6C, 0x20, 0x06, 0xFC, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0x03, 0xFF,
+  0xFF, 0x70, 0x0F, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x70, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x4F, 0x70,
+  0x0B, 0xF3, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0xDF,
+  0xC5, 0x20, 0x13, 0xAF, 0x70, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFB, 0x10, 0x00, 0x00, 0x6B, 0xEF,
+  0xEB, 0x50, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0xFC,
+  0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x04,
+  0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x04, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00,
+  0xFC, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00,
+  0x04, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x04, 0xF8,
+  0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00,
+  0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x00,
+  0x4F, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x4F,
+  0x80, 0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80,
+  0x00, 0x4F, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x6F, 0x70, 0x03, 0xDF, 0x40, 0xEF, 0xFC, 0x00, 0xEE,
+  0xA2, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x3E, 0xE4, 0x00, 0x4F, 0x80, 0x00, 0x3E, 0xE3, 0x00, 0x04,
+  0xF8, 0x00, 0x4E, 0xD2, 0x00, 0x00, 0x4F, 0x80, 0x5F, 0xD2, 0x00, 0x00, 0x04, 0xF8, 0x6F, 0xC1,
+  0x00, 0x00, 0x00, 0x4F, 0xDF, 0xB1, 0x00, 0x00, 0x00, 0x04, 0xFE, 0xFA, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0x8A, 0xFA, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x0A, 0xFA, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x0A,
+  0xFA, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x0A, 0xFA, 0x00,
+  0x04, 0xF8, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00,
+  0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00,
+  0x04, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x04,
+  0xF8, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x04, 0xFF, 0xFF, 0xFF, 0xFE, 0x04, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+  0x04, 0xFE, 0xE1, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x04, 0xF9, 0xF6, 0x00, 0x00, 0xDA, 0xEC, 0x00,
+  0x04, 0xF7, 0xBC, 0x00, 0x04, 0xF4, 0xEC, 0x00, 0x04, 0xF7, 0x5F, 0x30, 0x0A, 0xD0, 0xEC, 0x00,
+  0x04, 0xF7, 0x0E, 0x90, 0x1F, 0x70, 0xEC, 0x00, 0x04, 0xF7, 0x08, 0xE1, 0x7F, 0x10, 0xEC, 0x00,
+  0x04, 0xF7, 0x02, 0xF6, 0xDA, 0x00, 0xEC, 0x00, 0x04, 0xF7, 0x00, 0xBE, 0xF4, 0x00, 0xEC, 0x00,
+  0x04, 0xF7, 0x00, 0x5F, 0xD0, 0x00, 0xEC, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x00,
+  0x04, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x00,
+  0x04, 0xFF, 0x60, 0x00, 0x00, 0xFB, 0x00, 0x4F, 0xFE, 0x10, 0x00, 0x0F, 0xB0, 0x04, 0xFC, 0xF7,
+  0x00, 0x00, 0xFB, 0x00, 0x4F, 0x7C, 0xE1, 0x00, 0x0F, 0xB0, 0x04, 0xF7, 0x4F, 0x80, 0x00, 0xFB,
+  0x00, 0x4F, 0x70, 0xBF, 0x20, 0x0F, 0xB0, 0x04, 0xF7, 0x03, 0xF9, 0x00, 0xFB, 0x00, 0x4F, 0x70,
+  0x0A, 0xF3, 0x0F, 0xB0, 0x04, 0xF7, 0x00, 0x2F, 0xA0, 0xFB, 0x00, 0x4F, 0x70, 0x00, 0x8F, 0x4F,
+  0xB0, 0x04, 0xF7, 0x00, 0x01, 0xEC, 0xFB, 0x00, 0x4F, 0x70, 0x00, 0x07, 0xFF, 0xB0, 0x04, 0xF7,
+  0x00, 0x00, 0x1E, 0xFB, 0x00, 0x00, 0x01, 0x7C, 0xEE, 0xD8, 0x10, 0x00, 0x00, 0x2D, 0xFF, 0xFF,
+  0xFF, 0xE4, 0x00, 0x00, 0xDF, 0xC4, 0x11, 0x3A, 0xFE, 0x20, 0x06, 0xFC, 0x00, 0x00, 0x00, 0xAF,
+  0x90, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0x0F,
+  0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0x0B, 0xF4, 0x00,
+  0x00, 0x00, 0x1F, 0xE0, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x01, 0xDF, 0xC4, 0x10, 0x3A,
+  0xFE, 0x20, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x7C, 0xEF, 0xD8, 0x20, 0x00,
+  0x04, 0xFF, 0xFF, 0xEC, 0x60, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x70, 0x04, 0xF8, 0x00, 0x17, 0xFE,
+  0x10, 0x4F, 0x80, 0x00, 0x0B, 0xF3, 0x04, 0xF8, 0x00, 0x00, 0xBF, 0x30, 0x4F, 0x80, 0x01, 0x7F,
+  0xE1, 0x04, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x4F, 0xFF, 0xFE, 0xC6, 0x00, 0x04, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00,
+  0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7C, 0xEE, 0xD8, 0x20, 0x00, 0x00,
+  0x2D, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0xDF, 0xC4, 0x11, 0x3A, 0xFE, 0x20, 0x06, 0xFC, 0x00,
+  0x00, 0x00, 0xAF, 0x90, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x0E, 0xF0, 0x00, 0x00, 0x00,
+  0x0C, 0xF1, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xF0,
+  0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x9F, 0x70, 0x01, 0xDF,
+  0xC4, 0x10, 0x3A, 0xFC, 0x10, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x01, 0x7C, 0xEF,
+  0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF7,
+  0x00, 0x04, 0xFF, 0xFF, 0xEC, 0x60, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x04, 0xF8,
+  0x00, 0x16, 0xFF, 0x10, 0x00, 0x4F, 0x80, 0x00, 0x0B, 0xF3, 0x00, 0x04, 0xF8, 0x00, 0x00, 0xBF,
+  0x20, 0x00, 0x4F, 0x80, 0x01, 0x6F, 0xD0, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x4F,
+  0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x2B, 0xF7, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x1D,
+  0xE1, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x5F, 0x90, 0x00, 0x4F, 0x80, 0x00, 0x00, 0xBF, 0x20, 0x04,
+  0xF8, 0x00, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x29, 0xDE, 0xEB, 0x61, 0x00, 0x2E, 0xFF, 0xFF, 0xFF,
+  0xA0, 0x09, 0xFB, 0x31, 0x13, 0x88, 0x00, 0xCF, 0x10, 0x00, 0x00, 0x00, 0x0A, 0xF2, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xE9, 0x53, 0x00, 0x00, 0x00, 0x29, 0xEF, 0xFE, 0x81, 0x00, 0x00, 0x00, 0x25,
+  0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x40, 0x00, 0x00, 0x00, 0x08, 0xF6, 0x0A, 0x84, 0x20,
+  0x26, 0xFF, 0x40, 0xCF, 0xFF, 0xFF, 0xFF, 0xB0, 0x02, 0x7B, 0xDF, 0xEC, 0x60, 0x00, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x06, 0xF6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF6,
+  0x00, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x3F, 0x90,
+  0x07, 0xF5, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x3F, 0x90, 0x07, 0xF5, 0x00,
+  0x00, 0x03, 0xF9, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x3F, 0x90, 0x07, 0xF5, 0x00, 0x00, 0x03, 0xF9,
+  0x00, 0x6F, 0x50, 0x00, 0x00, 0x3F, 0x90, 0x06, 0xF7, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x3F, 0xB0,
+  0x00, 0x00, 0x8F, 0x60, 0x00, 0xDF, 0x92, 0x12, 0x7F, 0xE1, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xF6,
+  0x00, 0x00, 0x03, 0xAE, 0xFE, 0xB4, 0x00, 0x00, 0xAF, 0x30, 0x00, 0x00, 0x00, 0xDE, 0x14, 0xF9,
+  0x00, 0x00, 0x00, 0x4F, 0x90, 0x0D, 0xE0, 0x00, 0x00, 0x0A, 0xF3, 0x00, 0x8F, 0x50, 0x00, 0x01,
+  0xEC, 0x00, 0x02, 0xFB, 0x00, 0x00, 0x6F, 0x70, 0x00, 0x0B, 0xF2, 0x00, 0x0C, 0xF1, 0x00, 0x00,
+  0x5F, 0x70, 0x02, 0xFA, 0x00, 0x00, 0x00, 0xED, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x09, 0xF3, 0x0E,
+  0xD0, 0x00, 0x00, 0x00, 0x3F, 0x94, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xBF, 0x20, 0x00, 0x00,
+  0x00, 0x06, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF5, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00,
+  0x03, 0xFF, 0x10, 0x00, 0x0B, 0xF1, 0x1F, 0xC0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0E, 0xC0, 0x0C,
+  0xF1, 0x00, 0x0B, 0xBE, 0x80, 0x00, 0x3F, 0x90, 0x08, 0xF4, 0x00, 0x0E, 0x7A, 0xC0, 0x00, 0x7F,
+  0x50, 0x04, 0xF8, 0x00, 0x3F, 0x36, 0xF1, 0x00, 0xBF, 0x10, 0x01, 0xFC, 0x00, 0x7E, 0x02, 0xF4,
+  0x00, 0xEC, 0x00, 0x00, 0xBF, 0x10, 0xBB, 0x00, 0xE8, 0x03, 0xF8, 0x00, 0x00, 0x8F, 0x40, 0xE7,
+  0x00, 0xAC, 0x07, 0xF4, 0x00, 0x00, 0x4F, 0x83, 0xF3, 0x00, 0x6F, 0x1B, 0xF1, 0x00, 0x00, 0x0F,
+  0xC7, 0xE0, 0x00, 0x3F, 0x4E, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0xB0, 0x00, 0x0E, 0xBF, 0x80, 0x00,
+  0x00, 0x07, 0xFF, 0x70, 0x00, 0x0A, 0xFF, 0x40, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x07, 0xFF,
+  0x10, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x0B, 0xF3, 0x00, 0xCE, 0x20, 0x00, 0x7F, 0x70, 0x00, 0x3F,
+  0xB0, 0x03, 0xFB, 0x00, 0x00, 0x08, 0xF6, 0x0C, 0xE2, 0x00, 0x00, 0x00, 0xCE, 0xAF, 0x50, 0x00,
+  0x00, 0x00, 0x3F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xDE,
+  0x20, 0x00, 0x00, 0x05, 0xF9, 0x3F, 0xB0, 0x00, 0x00, 0x2E, 0xD1, 0x07, 0xF6, 0x00, 0x00, 0xBF,
+  0x30, 0x00, 0xCE, 0x20, 0x06, 0xF7, 0x00, 0x00, 0x3F, 0xB0, 0x2E, 0xC0, 0x00, 0x00, 0x07, 0xF6,
+  0x0A, 0xF3, 0x00, 0x00, 0x03, 0xFA, 0x00, 0x1E, 0xD1, 0x00, 0x01, 0xDE, 0x10, 0x00, 0x5F, 0x90,
+  0x00, 0x8F, 0x50, 0x00, 0x00, 0xAF, 0x40, 0x4F, 0xA0, 0x00, 0x00, 0x01, 0xED, 0x2D, 0xD1, 0x00,
+  0x00, 0x00, 0x04, 0xFE, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xF6, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE2, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xE6, 0x00, 0x00, 0x00, 0x00,
+  0x2E, 0x90, 0x00, 0x00, 0x00, 0x01, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC1, 0x00, 0x00, 0x00,
+  0x00, 0x9E, 0x20, 0x00, 0x00, 0x00, 0x07, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00,
+  0x00, 0x03, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0x40, 0x07, 0xF3, 0x00, 0x00, 0x7F, 0x30,
+  0x00, 0x07, 0xF3, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x07,
+  0xF3, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x07, 0xF3, 0x00,
+  0x00, 0x7F, 0x30, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0x40, 0xDA, 0x00, 0x00, 0x08, 0xE0,
+  0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x09, 0xD0, 0x00, 0x00, 0x5F, 0x30, 0x00,
+  0x01, 0xF7, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x6F, 0x10, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x0C,
+  0xA0, 0x00, 0x00, 0x7E, 0x10, 0x00, 0x03, 0xF5, 0x00, 0x00, 0x0D, 0x90, 0x00, 0x00, 0x9E, 0x00,
+  0x04, 0xFF, 0xF7, 0x00, 0x4F, 0xFF, 0x70, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x2F, 0x70, 0x00, 0x02,
+  0xF7, 0x00, 0x00, 0x2F, 0x70, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x2F, 0x70, 0x00, 0x02, 0xF7, 0x00,
+  0x00, 0x2F, 0x70, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x2F, 0x70, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x2F,
+  0x70, 0x04, 0xFF, 0xF7, 0x00, 0x4F, 0xFF, 0x70, 0x00, 0x00, 0x01, 0xBF, 0xC1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0xAF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x60, 0x5F, 0xB1, 0x00, 0x00, 0x00,
+  0xAF, 0x50, 0x00, 0x4E, 0xB0, 0x00, 0x00, 0x9E, 0x40, 0x00, 0x00, 0x3E, 0xA0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+  0x02, 0xDA, 0x00, 0x00, 0x00, 0x02, 0xE7, 0x00, 0x00, 0x00, 0x03, 0xE4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5B, 0xEF, 0xC6, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF7, 0x00, 0x03, 0xA4, 0x11, 0x4D, 0xE1, 0x00,
+  0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x6B, 0xEF, 0xFF, 0xF5, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x60,
+  0x0D, 0xE4, 0x10, 0x05, 0xF6, 0x00, 0xDD, 0x30, 0x15, 0xDF, 0x60, 0x08, 0xFF, 0xFF, 0xFA, 0xF6,
+  0x00, 0x08, 0xDF, 0xD6, 0x3F, 0x60, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00,
+  0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x6D, 0xFC,
+  0x50, 0x00, 0x5F, 0xAF, 0xFF, 0xFF, 0x60, 0x05, 0xFF, 0x71, 0x17, 0xFE, 0x00, 0x5F, 0x90, 0x00,
+  0x09, 0xF4, 0x05, 0xF5, 0x00, 0x00, 0x5F, 0x60, 0x5F, 0x50, 0x00, 0x05, 0xF6, 0x05, 0xF9, 0x00,
+  0x00, 0x9F, 0x40, 0x5F, 0xF7, 0x11, 0x7F, 0xE0, 0x05, 0xFA, 0xFF, 0xFF, 0xF6, 0x00, 0x5F, 0x46,
+  0xDF, 0xC5, 0x00, 0x00, 0x07, 0xCF, 0xEA, 0x20, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x07, 0xFD, 0x41,
+  0x15, 0x90, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
+  0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x41, 0x15, 0x90, 0x00, 0xCF, 0xFF, 0xFF, 0xC0,
+  0x00, 0x07, 0xDF, 0xDA, 0x20, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x2A, 0xEE, 0xA1, 0xCC,
+  0x00, 0x1D, 0xFF, 0xFF, 0xCD, 0xC0, 0x08, 0xFB, 0x31, 0x4D, 0xFC, 0x00, 0xDE, 0x10, 0x00, 0x3F,
+  0xC0, 0x0F, 0xB0, 0x00, 0x00, 0xEC, 0x00, 0xFB, 0x00, 0x00, 0x0E, 0xC0, 0x0D, 0xE1, 0x00, 0x03,
+  0xFC, 0x00, 0x8F, 0xB3, 0x14, 0xDF, 0xC0, 0x01, 0xDF, 0xFF, 0xFC, 0xDC, 0x00, 0x02, 0xAE, 0xEA,
+  0x1C, 0xC0, 0x00, 0x07, 0xDF, 0xEA, 0x20, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x20, 0x07, 0xFB, 0x31,
+  0x17, 0xFA, 0x00, 0xCE, 0x00, 0x00, 0x09, 0xE0, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF2, 0x0C, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xA3, 0x11, 0x37, 0x90, 0x00, 0xBF,
+  0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x6C, 0xEE, 0xC8, 0x20, 0x00, 0x1A, 0xEF, 0xA0, 0x0A, 0xFF, 0xFA,
+  0x00, 0xEC, 0x10, 0x00, 0x0F, 0x90, 0x00, 0x9F, 0xFF, 0xFF, 0x49, 0xFF, 0xFF, 0xF4, 0x01, 0xF9,
+  0x00, 0x00, 0x1F, 0x90, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x01, 0xF9, 0x00, 0x00,
+  0x1F, 0x90, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x2A, 0xEE, 0xA1, 0xCC, 0x00,
+  0x1D, 0xFF, 0xFF, 0xCD, 0xC0, 0x08, 0xFB, 0x31, 0x4D, 0xFC, 0x00, 0xDE, 0x10, 0x00, 0x3F, 0xC0,
+  0x0F, 0xB0, 0x00, 0x00, 0xEC, 0x00, 0xFB, 0x00, 0x00, 0x0E, 0xC0, 0x0D, 0xE1, 0x00, 0x02, 0xFC,
+  0x00, 0x8F, 0xB2, 0x13, 0xCF, 0xC0, 0x01, 0xDF, 0xFF, 0xFC, 0xDC, 0x00, 0x02, 0xAE, 0xEA, 0x1E,
+  0xB0, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x09, 0x41, 0x15, 0xDF, 0x40, 0x00, 0xCF, 0xFF, 0xFF,
+  0xA0, 0x00, 0x03, 0xAD, 0xFD, 0x70, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00,
+  0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x5D,
+  0xFD, 0x50, 0x00, 0x5F, 0xAF, 0xFF, 0xFF, 0x40, 0x05, 0xFF, 0x61, 0x17, 0xFA, 0x00, 0x5F, 0x80,
+  0x00, 0x0D, 0xC0, 0x05, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x5F, 0x40, 0x00, 0x0B, 0xD0, 0x05, 0xF4,
+  0x00, 0x00, 0xBD, 0x00, 0x5F, 0x40, 0x00, 0x0B, 0xD0, 0x05, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x5F,
+  0x40, 0x00, 0x0B, 0xD0, 0x04, 0xF5, 0x00, 0x4F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF5,
+  0x00, 0x4F, 0x50, 0x04, 0xF5, 0x00, 0x4F, 0x50, 0x04, 0xF5, 0x00, 0x4F, 0x50, 0x04, 0xF5, 0x00,
+  0x4F, 0x50, 0x04, 0xF5, 0x00, 0x4F, 0x50, 0x00, 0x4F, 0x50, 0x00, 0x4F, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0x50, 0x00, 0x4F, 0x50, 0x00, 0x4F, 0x50, 0x00, 0x4F, 0x50, 0x00,
+  0x4F, 0x50, 0x00, 0x4F, 0x50, 0x00, 0x4F, 0x50, 0x00, 0x4F, 0x50, 0x00, 0x4F, 0x50, 0x00, 0x4F,
+  0x50, 0x00, 0x5F, 0x40, 0x01, 0xAF, 0x20, 0x5F, 0xFD, 0x00, 0x5E, 0xB2, 0x00, 0x05, 0xF4, 0x00,
+  0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x40,
+  0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x07, 0xF9, 0x00, 0x5F, 0x40, 0x09, 0xF7, 0x00, 0x05, 0xF4,
+  0x0A, 0xF6, 0x00, 0x00, 0x5F, 0x5B, 0xE4, 0x00, 0x00, 0x05, 0xFE, 0xF4, 0x00, 0x00, 0x00, 0x5F,
+  0x9F, 0xB1, 0x00, 0x00, 0x05, 0xF4, 0x5F, 0xB1, 0x00, 0x00, 0x5F, 0x40, 0x5F, 0xC1, 0x00, 0x05,
+  0xF4, 0x00, 0x4F, 0xC1, 0x00, 0x5F, 0x40, 0x00, 0x4F, 0xC1, 0x04, 0xF5, 0x00, 0x4F, 0x50, 0x04,
+  0xF5, 0x00, 0x4F, 0x50, 0x04, 0xF5, 0x00, 0x4F, 0x50, 0x04, 0xF5, 0x00, 0x4F, 0x50, 0x04, 0xF5,
+  0x00, 0x4F, 0x50, 0x04, 0xF5, 0x00, 0x4F, 0x50, 0x04, 0xF5, 0x00, 0x4F, 0x50, 0x05, 0xF4, 0x6D,
+  0xEC, 0x30, 0x3B, 0xEE, 0x70, 0x00, 0x05, 0xFA, 0xFF, 0xFF, 0xE3, 0xEF, 0xFF, 0xF5, 0x00, 0x05,
+  0xFF, 0x61, 0x1A, 0xFE, 0xA2, 0x15, 0xFB, 0x00, 0x05, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xBE,
+  0x00, 0x05, 0xF4, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x9F, 0x00, 0x05, 0xF4, 0x00, 0x00, 0xFA, 0x00,
+  0x00, 0x9F, 0x00, 0x05, 0xF4, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x9F, 0x00, 0x05, 0xF4, 0x00, 0x00,
+  0xFA, 0x00, 0x00, 0x9F, 0x00, 0x05, 0xF4, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x9F, 0x00, 0x05, 0xF4,
+  0x00, 0x00, 0xFA, 0x00, 0x00, 0x9F, 0x00, 0x05, 0xF4, 0x5D, 0xFD, 0x50, 0x00, 0x5F, 0xAF, 0xFF,
+  0xFF, 0x40, 0x05, 0xFF, 0x61, 0x17, 0xFA, 0x00, 0x5F, 0x80, 0x00, 0x0D, 0xC0, 0x05, 0xF4, 0x00,
+  0x00, 0xBD, 0x00, 0x5F, 0x40, 0x00, 0x0B, 0xD0, 0x05, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x5F, 0x40,
+  0x00, 0x0B, 0xD0, 0x05, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x5F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x19,
+  0xDF, 0xD9, 0x10, 0x00, 0x1D, 0xFF, 0xFF, 0xFD, 0x10, 0x08, 0xFC, 0x31, 0x3C, 0xF8, 0x00, 0xDE,
+  0x10, 0x00, 0x1E, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0xCF, 0x00, 0xFC, 0x00, 0x00, 0x0C, 0xF0, 0x0D,
+  0xE1, 0x00, 0x01, 0xED, 0x00, 0x8F, 0xC3, 0x13, 0xCF, 0x80, 0x01, 0xDF, 0xFF, 0xFF, 0xD1, 0x00,
+  0x01, 0x9D, 0xFD, 0x91, 0x00, 0x05, 0xF4, 0x6D, 0xFC, 0x50, 0x00, 0x5F, 0xAF, 0xFF, 0xFF, 0x60,
+  0x05, 0xFF, 0x71, 0x17, 0xFE, 0x00, 0x5F, 0x90, 0x00, 0x09, 0xF4, 0x05, 0xF5, 0x00, 0x00, 0x5F,
+  0x60, 0x5F, 0x50, 0x00, 0x05, 0xF6, 0x05, 0xF9, 0x00, 0x00, 0x9F, 0x40, 0x5F, 0xF7, 0x11, 0x7F,
+  0xE0, 0x05, 0xFA, 0xFF, 0xFF, 0xF6, 0x00, 0x5F, 0x46, 0xDF, 0xC5, 0x00, 0x05, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x2A, 0xEE, 0xA1, 0xCC, 0x00, 0x1D, 0xFF, 0xFF, 0xCD, 0xC0, 0x08, 0xFB, 0x31,
+  0x4D, 0xFC, 0x00, 0xDE, 0x10, 0x00, 0x3F, 0xC0, 0x0F, 0xB0, 0x00, 0x00, 0xEC, 0x00, 0xFB, 0x00,
+  0x00, 0x0E, 0xC0, 0x0D, 0xE1, 0x00, 0x03, 0xFC, 0x00, 0x8F, 0xB3, 0x14, 0xDF, 0xC0, 0x01, 0xDF,
+  0xFF, 0xFC, 0xDC, 0x00, 0x02, 0xAE, 0xEA, 0x1C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00,
+  0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x05,
+  0xF4, 0x6D, 0xF6, 0x05, 0xFA, 0xFF, 0xF6, 0x05, 0xFF, 0x71, 0x00, 0x05, 0xF9, 0x00, 0x00, 0x05,
+  0xF5, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x05,
+  0xF4, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x7D, 0xEE, 0xB4, 0x00, 0x9F, 0xFF, 0xFF, 0xF0,
+  0x0D, 0xD3, 0x11, 0x4B, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x04, 0xEC, 0x85, 0x10, 0x00, 0x01, 0x48,
+  0xBE, 0x90, 0x00, 0x00, 0x00, 0x4F, 0x50, 0xC5, 0x20, 0x29, 0xF7, 0x0F, 0xFF, 0xFF, 0xFE, 0x20,
+  0x39, 0xDF, 0xDA, 0x30, 0x05, 0xF4, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x05, 0xF4, 0x00, 0x08, 0xFF,
+  0xFF, 0xF9, 0x8F, 0xFF, 0xFF, 0x90, 0x5F, 0x40, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x5F, 0x40, 0x00,
+  0x05, 0xF4, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x04, 0xF9, 0x10, 0x00, 0x1E, 0xFF, 0xF9, 0x00, 0x5C,
+  0xFF, 0x90, 0x07, 0xF2, 0x00, 0x00, 0xDC, 0x00, 0x7F, 0x20, 0x00, 0x0D, 0xC0, 0x07, 0xF2, 0x00,
+  0x00, 0xDC, 0x00, 0x7F, 0x20, 0x00, 0x0D, 0xC0, 0x07, 0xF2, 0x00, 0x00, 0xDC, 0x00, 0x7F, 0x20,
+  0x00, 0x0D, 0xC0, 0x06, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC2, 0x13, 0xCF, 0xC0, 0x00, 0xCF,
+  0xFF, 0xFC, 0xDC, 0x00, 0x02, 0xAE, 0xE9, 0x1D, 0xC0, 0x4F, 0x60, 0x00, 0x00, 0xCE, 0x00, 0xEC,
+  0x00, 0x00, 0x2F, 0x80, 0x08, 0xF2, 0x00, 0x08, 0xF3, 0x00, 0x3F, 0x80, 0x00, 0xDC, 0x00, 0x00,
+  0xCD, 0x00, 0x4F, 0x70, 0x00, 0x07, 0xF4, 0x09, 0xF1, 0x00, 0x00, 0x1F, 0xA1, 0xEB, 0x00, 0x00,
+  0x00, 0xAE, 0x6F, 0x50, 0x00, 0x00, 0x05, 0xFE, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0xF9, 0x00, 0x00,
+  0x2F, 0x80, 0x00, 0xBF, 0x70, 0x00, 0xCD, 0x00, 0xDB, 0x00, 0x0E, 0xFB, 0x00, 0x1F, 0x90, 0x09,
+  0xF1, 0x04, 0xFA, 0xE0, 0x05, 0xF5, 0x00, 0x5F, 0x40, 0x8E, 0x3F, 0x30, 0x8F, 0x10, 0x01, 0xF8,
+  0x0B, 0xA0, 0xE7, 0x0C, 0xC0, 0x00, 0x0D, 0xC1, 0xF6, 0x0A, 0xB1, 0xF8, 0x00, 0x00, 0x9F, 0x5F,
+  0x20, 0x6F, 0x5F, 0x40, 0x00, 0x05, 0xFD, 0xD0, 0x02, 0xFD, 0xF1, 0x00, 0x00, 0x1F, 0xF9, 0x00,
+  0x0E, 0xFC, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0xAF, 0x80, 0x00, 0x0C, 0xE2, 0x00, 0x06, 0xF8,
+  0x00, 0x2E, 0xC0, 0x03, 0xEB, 0x00, 0x00, 0x5F, 0x91, 0xCE, 0x20, 0x00, 0x00, 0x9F, 0xCF, 0x50,
+  0x00, 0x00, 0x00, 0xDF, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0x00, 0x00, 0x00, 0x1D, 0xE7, 0xF8,
+  0x00, 0x00, 0x0A, 0xF4, 0x0A, 0xF4, 0x00, 0x06, 0xF8, 0x00, 0x1D, 0xD1, 0x02, 0xEC, 0x00, 0x00,
+  0x3F, 0xA0, 0x4F, 0x70, 0x00, 0x00, 0xCD, 0x00, 0xDD, 0x00, 0x00, 0x3F, 0x70, 0x07, 0xF3, 0x00,
+  0x09, 0xF2, 0x00, 0x1F, 0x90, 0x01, 0xEA, 0x00, 0x00, 0x9E, 0x10, 0x5F, 0x40, 0x00, 0x03, 0xF6,
+  0x0B, 0xD0, 0x00, 0x00, 0x0C, 0xC2, 0xF7, 0x00, 0x00, 0x00, 0x6F, 0xBF, 0x10, 0x00, 0x00, 0x01,
+  0xEF, 0x90, 0x00, 0x00, 0x00, 0x09, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0x70, 0x00, 0x00, 0x09, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x9F, 0xD4, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xA0, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x8B,
+  0x00, 0x00, 0x00, 0x7C, 0x10, 0x00, 0x00, 0x5C, 0x10, 0x00, 0x00, 0x4D, 0x10, 0x00, 0x00, 0x3D,
+  0x20, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xA3, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x02, 0xAE,
+  0xF3, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x30, 0x00, 0x00, 0x0E, 0xD2, 0x00, 0x00, 0x00, 0x00, 0xF9,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, 0x01, 0x8F,
+  0x70, 0x00, 0x00, 0x0B, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0xBF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x1A,
+  0xF6, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xD2, 0x00, 0x00, 0x00,
+  0x00, 0xAF, 0xFF, 0x30, 0x00, 0x00, 0x02, 0xAE, 0xF3, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00,
+  0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00,
+  0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC,
+  0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00,
+  0x00, 0xBE, 0xC6, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x01, 0x7F, 0x60, 0x00,
+  0x00, 0x00, 0x03, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x70, 0x00, 0x00, 0x00, 0x02, 0xF7, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0x30, 0x00, 0x00, 0x05, 0xEF,
+  0xF3, 0x00, 0x00, 0x00, 0xEE, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF7,
+  0x00, 0x00, 0x00, 0x00, 0x2F, 0x70, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x00, 0x00, 0x00, 0x01, 0x8F,
+  0x50, 0x00, 0x00, 0x0B, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0xBF, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9E, 0xFC, 0x84, 0x11, 0x4C, 0x30, 0x01, 0xEF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0x1D, 0x61, 0x14, 0x8C, 0xEE, 0x92, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2F, 0x50, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x4F,
+  0x80, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x4F, 0x80, 0x00,
+  0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00,
+  0x00, 0x00, 0x3A, 0xEF, 0xD7, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xF5, 0x00, 0x1E, 0xF8, 0x3D, 0x28,
+  0x40, 0x05, 0xF9, 0x01, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x1D, 0x00, 0x00, 0x07, 0xF4, 0x01, 0xD0,
+  0x00, 0x00, 0x5F, 0x90, 0x1D, 0x00, 0x00, 0x01, 0xEF, 0x83, 0xD2, 0x84, 0x00, 0x05, 0xFF, 0xFF,
+  0xFF, 0x50, 0x00, 0x03, 0xAE, 0xFD, 0x70, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xD0, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xEE, 0x92, 0x00, 0x00, 0x2E,
+  0xFF, 0xFF, 0xA0, 0x00, 0x08, 0xFA, 0x21, 0x58, 0x00, 0x00, 0xBF, 0x20, 0x00, 0x00, 0x00, 0x0C,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x8F,
+  0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x0C, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x00, 0x00,
+  0x0C, 0xF0, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0D, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0x00, 0x00, 0x01, 0xB4, 0x0A, 0xF5, 0xAE, 0xC5, 0xBE,
+  0x30, 0x1C, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x9D, 0x41, 0x28, 0xF2, 0x00, 0x0E, 0x60, 0x00, 0x0E,
+  0x60, 0x00, 0x9D, 0x41, 0x28, 0xE2, 0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0x50, 0x0A, 0xF5, 0x9E, 0xC4,
+  0xBE, 0x30, 0xA5, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xA0, 0x00,
+  0x00, 0x4F, 0x70, 0x7F, 0x30, 0x00, 0x0C, 0xD0, 0x00, 0xDC, 0x00, 0x06, 0xF5, 0x00, 0x05, 0xF5,
+  0x01, 0xDB, 0x00, 0x00, 0x0C, 0xD1, 0x7F, 0x30, 0x00, 0xCF, 0xFF, 0x9E, 0xFF, 0xF4, 0x00, 0x00,
+  0xAF, 0xF2, 0x00, 0x00, 0x00, 0x03, 0xFA, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+  0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00,
+  0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC,
+  0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00,
+  0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x6D, 0xFF, 0xF4, 0x00, 0x5F, 0xFF, 0xFF, 0x40, 0x08, 0xF5,
+  0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0xDF, 0xB3, 0x00, 0x00, 0xAC, 0x5C, 0xF9, 0x00,
+  0x2F, 0x50, 0x06, 0xFA, 0x01, 0xF8, 0x00, 0x07, 0xF2, 0x09, 0xF8, 0x10, 0x5F, 0x10, 0x06, 0xEE,
+  0x7E, 0x80, 0x00, 0x01, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x00, 0x16, 0xF8, 0x00,
+  0x7F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFC, 0x50, 0x00, 0x02, 0xFA, 0x0A, 0xF2, 0x00, 0x2F, 0xA0,
+  0xAF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7C, 0xEE, 0xC7, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x3D, 0x93, 0x11, 0x39, 0xD3, 0x00, 0x00, 0x00, 0x02, 0xD4, 0x00, 0x00, 0x00,
+  0x4D, 0x20, 0x00, 0x00, 0x0B, 0x50, 0x3B, 0xEF, 0xF9, 0x05, 0xB0, 0x00, 0x00, 0x3C, 0x04, 0xF9,
+  0x20, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x67, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x76,
+  0x0D, 0x90, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x67, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x76, 0x00,
+  0x00, 0x3C, 0x04, 0xF9, 0x21, 0x47, 0x00, 0xC3, 0x00, 0x00, 0x0B, 0x50, 0x3B, 0xEE, 0xA2, 0x05,
+  0xB0, 0x00, 0x00, 0x02, 0xD4, 0x00, 0x00, 0x00, 0x4D, 0x20, 0x00, 0x00, 0x00, 0x3D, 0x93, 0x11,
+  0x39, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7C, 0xEE, 0xC7, 0x10, 0x00, 0x00, 0x07, 0xFF, 0xEC,
+  0x40, 0x00, 0x00, 0x16, 0xE1, 0x01, 0xAE, 0xFF, 0xF3, 0x0B, 0xB2, 0x01, 0xF4, 0x0E, 0x50, 0x04,
+  0xF4, 0x0C, 0xA1, 0x2C, 0xF4, 0x03, 0xCF, 0xD5, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x36, 0x00, 0x44, 0x00, 0x00, 0x4E, 0x70, 0x6F, 0x40, 0x00, 0x5F, 0x80, 0x8F,
+  0x60, 0x00, 0x6F, 0x70, 0x8E, 0x40, 0x00, 0x06, 0xF7, 0x08, 0xE4, 0x00, 0x00, 0x05, 0xF8, 0x08,
+  0xF6, 0x00, 0x00, 0x04, 0xE7, 0x06, 0xF4, 0x00, 0x00, 0x03, 0x60, 0x04, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
+  0xFF, 0xF9, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7C, 0xEE, 0xC7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x3D,
+  0x93, 0x11, 0x39, 0xD3, 0x00, 0x00, 0x00, 0x02, 0xD4, 0x00, 0x00, 0x00, 0x4D, 0x20, 0x00, 0x00,
+  0x0B, 0x50, 0xAF, 0xFE, 0xB3, 0x05, 0xB0, 0x00, 0x00, 0x3C, 0x00, 0xAA, 0x01, 0xBC, 0x00, 0xC3,
+  0x00, 0x00, 0x67, 0x00, 0xAA, 0x01, 0xBC, 0x00, 0x86, 0x00, 0x00, 0x76, 0x00, 0xAF, 0xFF, 0xB2,
+  0x00, 0x67, 0x00, 0x00, 0x67, 0x00, 0xAA, 0x1A, 0xD1, 0x00, 0x76, 0x00, 0x00, 0x3C, 0x00, 0xAA,
+  0x01, 0xD9, 0x00, 0xC3, 0x00, 0x00, 0x0B, 0x50, 0xAA, 0x00, 0x4F, 0x35, 0xB0, 0x00, 0x00, 0x02,
+  0xD4, 0x00, 0x00, 0x00, 0x4D, 0x20, 0x00, 0x00, 0x00, 0x3D, 0x93, 0x11, 0x39, 0xD3, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x7C, 0xEE, 0xC7, 0x10, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF2, 0x00, 0x2F, 0xFF,
+  0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xEB, 0x20, 0x00, 0x0D, 0x71, 0x7C, 0x00, 0x03, 0xE0, 0x00,
+  0xE3, 0x00, 0x3E, 0x00, 0x0E, 0x30, 0x00, 0xD7, 0x17, 0xD0, 0x00, 0x03, 0xCE, 0xB2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x01, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF3, 0x00, 0x06, 0xDE, 0xC3, 0x02, 0x92, 0x1A, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x4E, 0x30,
+  0x00, 0x5D, 0x40, 0x00, 0x8D, 0x20, 0x00, 0x3F, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0D, 0xFF, 0xD8, 0x00, 0x00, 0x17, 0xF1, 0x00, 0xBF, 0xE5, 0x00, 0x00, 0x18, 0xE1, 0x00, 0x00,
+  0x1F, 0x40, 0x00, 0x18, 0xE1, 0x2F, 0xFE, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xD2, 0x00, 0x00, 0x08, 0xE2, 0x00, 0x00, 0x05, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00,
+  0x00, 0xDC, 0x00, 0x07, 0xF2, 0x00, 0x00, 0xDC, 0x00, 0x07, 0xF2, 0x00, 0x00, 0xDC, 0x00, 0x07,
+  0xF2, 0x00, 0x00, 0xDC, 0x00, 0x07, 0xF2, 0x00, 0x00, 0xDC, 0x00, 0x07, 0xF2, 0x00, 0x00, 0xDC,
+  0x00, 0x07, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xFC, 0x30, 0x2A, 0xFD, 0x00, 0x07, 0xFB, 0xFF,
+  0xFE, 0xBF, 0xF0, 0x07, 0xF3, 0xAE, 0xC3, 0x3E, 0xB0, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xF2, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0xDF, 0xFF, 0xF8, 0x00, 0x1C, 0xFF, 0xF9, 0x0B, 0x80, 0x06, 0xFF, 0xFF, 0x90,
+  0xB8, 0x00, 0x9F, 0xFF, 0xF9, 0x0B, 0x80, 0x08, 0xFF, 0xFF, 0x90, 0xB8, 0x00, 0x3F, 0xFF, 0xF9,
+  0x0B, 0x80, 0x00, 0x5E, 0xFF, 0x90, 0xB8, 0x00, 0x00, 0x14, 0xC9, 0x0B, 0x80, 0x00, 0x00, 0x0A,
+  0x90, 0xB8, 0x00, 0x00, 0x00, 0xA9, 0x0B, 0x80, 0x00, 0x00, 0x0A, 0x90, 0xB8, 0x00, 0x00, 0x00,
+  0xA9, 0x0B, 0x80, 0x00, 0x00, 0x0A, 0x90, 0xB8, 0x00, 0x00, 0x00, 0xA9, 0x0B, 0x80, 0x00, 0x00,
+  0x0A, 0x90, 0xB8, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x03,
+  0xF2, 0x00, 0x00, 0x6E, 0xEA, 0x00, 0x00, 0x0C, 0xFF, 0x70, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x0C,
+  0x70, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x0C, 0x70, 0x00, 0x00, 0xC7, 0x00, 0x09, 0xFF, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xEB, 0x30, 0x09, 0xD3, 0x18, 0xE2, 0x0F, 0x60, 0x00,
+  0xE7, 0x2F, 0x40, 0x00, 0xC9, 0x0F, 0x60, 0x00, 0xD7, 0x09, 0xD3, 0x18, 0xE2, 0x01, 0x8D, 0xEB,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x50, 0x06, 0x30, 0x00, 0x00, 0x4F,
+  0x60, 0x6E, 0x40, 0x00, 0x00, 0x6F, 0x80, 0x8F, 0x60, 0x00, 0x00, 0x4E, 0x90, 0x6F, 0x60, 0x00,
+  0x04, 0xE9, 0x06, 0xF6, 0x00, 0x06, 0xF8, 0x08, 0xF6, 0x00, 0x04, 0xF6, 0x06, 0xE4, 0x00, 0x00,
+  0x45, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x70, 0x00, 0x00,
+  0x03, 0xF3, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0x0C, 0x70, 0x00,
+  0x00, 0x7D, 0x10, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x2E, 0x50, 0x00, 0x00, 0x00, 0x0C, 0x70,
+  0x00, 0x0B, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x05, 0xE2, 0x00, 0x00, 0x00, 0x09, 0xFF,
+  0xFF, 0x41, 0xE6, 0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x9C, 0x00, 0x02, 0xBA, 0xA0, 0x00,
+  0x00, 0x00, 0x4F, 0x30, 0x01, 0xB2, 0x9A, 0x00, 0x00, 0x00, 0x0D, 0x80, 0x00, 0xA3, 0x09, 0xA0,
+  0x00, 0x00, 0x08, 0xD1, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x09,
+  0xA0, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x0C, 0xFF, 0x70, 0x00, 0x00, 0x03,
+  0xF3, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0x0C, 0x70, 0x00, 0x00,
+  0x7D, 0x10, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x2E, 0x50, 0x00, 0x00, 0x00, 0x0C, 0x70, 0x00,
+  0x0B, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x05, 0xE2, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF,
+  0x41, 0xE6, 0x04, 0xBE, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x9C, 0x00, 0xA3, 0x17, 0xF2, 0x00, 0x00,
+  0x00, 0x4F, 0x30, 0x00, 0x00, 0x4F, 0x10, 0x00, 0x00, 0x0D, 0x80, 0x00, 0x00, 0x2D, 0x60, 0x00,
+  0x00, 0x08, 0xD1, 0x00, 0x00, 0x3D, 0x60, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x5D, 0x40, 0x00,
+  0x00, 0x00, 0xBA, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0x40, 0x0D, 0xFF, 0xD8, 0x00, 0x00, 0x03, 0xF3,
+  0x00, 0x00, 0x00, 0x17, 0xF1, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0xBF, 0xE5, 0x00, 0x00, 0x7D,
+  0x10, 0x00, 0x00, 0x00, 0x18, 0xE1, 0x00, 0x2E, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x0B,
+  0xA0, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE1, 0x05, 0xE2, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0xC4, 0x01,
+  0xE6, 0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x9C, 0x00, 0x02, 0xBA, 0xA0, 0x00, 0x00, 0x00,
+  0x4F, 0x30, 0x01, 0xB2, 0x9A, 0x00, 0x00, 0x00, 0x0D, 0x80, 0x00, 0xA3, 0x09, 0xA0, 0x00, 0x00,
+  0x08, 0xD1, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x09, 0xA0, 0x00,
+  0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00, 0xAF,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x10, 0x00, 0x00, 0x00, 0x9F, 0x10,
+  0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x05, 0xF9, 0x00, 0x00, 0x00, 0x4F, 0xD1, 0x00, 0x00,
+  0x02, 0xED, 0x20, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0x00, 0x00, 0x00, 0x09,
+  0xFA, 0x21, 0x4A, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3B, 0xEE, 0xB5, 0x00, 0x00, 0x00,
+  0x7E, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xEB, 0x00, 0x00, 0x00, 0x00,
+  0x0C, 0xD8, 0xF2, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x9F, 0x10, 0xCD,
+  0x00, 0x00, 0x00, 0x0E, 0xB0, 0x06, 0xF4, 0x00, 0x00, 0x05, 0xF5, 0x00, 0x1E, 0xA0, 0x00, 0x00,
+  0xBE, 0x00, 0x00, 0x9F, 0x10, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x08, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x00, 0xDE, 0x10, 0x00, 0x00, 0xAF, 0x30, 0x4F, 0x90, 0x00, 0x00, 0x04, 0xF9, 0x0A,
+  0xF3, 0x00, 0x00, 0x00, 0x0D, 0xE1, 0x00, 0x00, 0x00, 0xBB, 0x10, 0x00, 0x00, 0x00, 0x00, 0xAB,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x6F, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xD8, 0xF2, 0x00, 0x00, 0x00, 0x03, 0xF7,
+  0x2F, 0x80, 0x00, 0x00, 0x00, 0x9F, 0x10, 0xCD, 0x00, 0x00, 0x00, 0x0E, 0xB0, 0x06, 0xF4, 0x00,
+  0x00, 0x05, 0xF5, 0x00, 0x1E, 0xA0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x9F, 0x10, 0x00, 0x2F, 0xFF,
+  0xFF, 0xFF, 0xF7, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xDE, 0x10, 0x00, 0x00, 0xAF,
+  0x30, 0x4F, 0x90, 0x00, 0x00, 0x04, 0xF9, 0x0A, 0xF3, 0x00, 0x00, 0x00, 0x0D, 0xE1, 0x00, 0x00,
+  0x3E, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x41, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xEB, 0x00, 0x00, 0x00, 0x00,
+  0x0C, 0xD8, 0xF2, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x9F, 0x10, 0xCD,
+  0x00, 0x00, 0x00, 0x0E, 0xB0, 0x06, 0xF4, 0x00, 0x00, 0x05, 0xF5, 0x00, 0x1E, 0xA0, 0x00, 0x00,
+  0xBE, 0x00, 0x00, 0x9F, 0x10, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x08, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x00, 0xDE, 0x10, 0x00, 0x00, 0xAF, 0x30, 0x4F, 0x90, 0x00, 0x00, 0x04, 0xF9, 0x0A,
+  0xF3, 0x00, 0x00, 0x00, 0x0D, 0xE1, 0x00, 0x03, 0xED, 0x63, 0xF0, 0x00, 0x00, 0x00, 0xA8, 0x3B,
+  0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x6F, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xD8, 0xF2, 0x00, 0x00, 0x00, 0x03, 0xF7,
+  0x2F, 0x80, 0x00, 0x00, 0x00, 0x9F, 0x10, 0xCD, 0x00, 0x00, 0x00, 0x0E, 0xB0, 0x06, 0xF4, 0x00,
+  0x00, 0x05, 0xF5, 0x00, 0x1E, 0xA0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x9F, 0x10, 0x00, 0x2F, 0xFF,
+  0xFF, 0xFF, 0xF7, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xDE, 0x10, 0x00, 0x00, 0xAF,
+  0x30, 0x4F, 0x90, 0x00, 0x00, 0x04, 0xF9, 0x0A, 0xF3, 0x00, 0x00, 0x00, 0x0D, 0xE1, 0x00, 0x07,
+  0xF5, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x50, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xEB, 0x00, 0x00, 0x00, 0x00,
+  0x0C, 0xD8, 0xF2, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x9F, 0x10, 0xCD,
+  0x00, 0x00, 0x00, 0x0E, 0xB0, 0x06, 0xF4, 0x00, 0x00, 0x05, 0xF5, 0x00, 0x1E, 0xA0, 0x00, 0x00,
+  0xBE, 0x00, 0x00, 0x9F, 0x10, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x08, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x00, 0xDE, 0x10, 0x00, 0x00, 0xAF, 0x30, 0x4F, 0x90, 0x00, 0x00, 0x04, 0xF9, 0x0A,
+  0xF3, 0x00, 0x00, 0x00, 0x0D, 0xE1, 0x00, 0x00, 0x4D, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x42,
+  0xD4, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x08, 0x80, 0x00, 0x00, 0x00, 0x1E, 0x42, 0xD5, 0x00, 0x00,
+  0x00, 0x00, 0x6F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xDC,
+  0x7F, 0x30, 0x00, 0x00, 0x00, 0x4F, 0x72, 0xF8, 0x00, 0x00, 0x00, 0x09, 0xF1, 0x0B, 0xE0, 0x00,
+  0x00, 0x01, 0xEA, 0x00, 0x6F, 0x50, 0x00, 0x00, 0x6F, 0x50, 0x01, 0xEA, 0x00, 0x00, 0x0C, 0xE0,
+  0x00, 0x0A, 0xF1, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFD,
+  0x00, 0x0D, 0xE1, 0x00, 0x00, 0x0A, 0xF3, 0x04, 0xF9, 0x00, 0x00, 0x00, 0x4F, 0x90, 0xAF, 0x30,
+  0x00, 0x00, 0x00, 0xDE, 0x10, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+  0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x7F, 0x81, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xDF, 0x11, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF9, 0x01, 0xFB, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xF2, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0x90, 0x01, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x9F, 0x20, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF,
+  0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0D,
+  0xE1, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x60, 0xBF, 0x20, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x6B, 0xEF, 0xDB, 0x61,
+  0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0xCF, 0xC5, 0x10, 0x24, 0x98, 0x00, 0x6F, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xC5, 0x10, 0x24,
+  0x98, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x01, 0x7B, 0xEF, 0xDB, 0x61, 0x00, 0x00,
+  0x00, 0x00, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE6,
+  0x00, 0x00, 0x00, 0x00, 0xBC, 0x10, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF1, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x4F, 0x80,
+  0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xC0, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0x80, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x04,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x4F, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x02, 0xE7, 0x00, 0x00,
+  0x00, 0x01, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF1,
+  0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x4F, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x4F, 0xFF, 0xFF,
+  0xFF, 0xF3, 0x00, 0x00, 0x6E, 0xE3, 0x00, 0x00, 0x00, 0x5D, 0x24, 0xD3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF1, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x4F, 0x80,
+  0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xC0, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0x80, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x04,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x4F, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x0B, 0xF1, 0x4F, 0x80, 0x00,
+  0x00, 0xBF, 0x14, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF1,
+  0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x4F, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x4F, 0xFF, 0xFF,
+  0xFF, 0xF3, 0x2D, 0x90, 0x00, 0x2D, 0x70, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F,
+  0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80,
+  0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x00, 0x5E, 0x40, 0x3E, 0x40, 0x00,
+  0x00, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8,
+  0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00,
+  0x4F, 0x80, 0x00, 0x9D, 0xD1, 0x00, 0x9A, 0x16, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00,
+  0x00, 0x4F, 0x80, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x4F,
+  0x80, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x4F, 0x80, 0x00,
+  0x04, 0xF8, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x04, 0xF8, 0x00, 0xEC, 0x08, 0xF4, 0xEC, 0x08, 0xF4,
+  0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x04, 0xF8, 0x00, 0x04, 0xF8, 0x00, 0x04, 0xF8, 0x00, 0x04,
+  0xF8, 0x00, 0x04, 0xF8, 0x00, 0x04, 0xF8, 0x00, 0x04, 0xF8, 0x00, 0x04, 0xF8, 0x00, 0x04, 0xF8,
+  0x00, 0x04, 0xF8, 0x00, 0x04, 0xF8, 0x00, 0x04, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xED, 0xA5, 0x00,
+  0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x02, 0xFA, 0x00, 0x12, 0x6D, 0xFD, 0x00, 0x02,
+  0xFA, 0x00, 0x00, 0x01, 0xDF, 0x60, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x5F, 0xA0, 0x02, 0xFA, 0x00,
+  0x00, 0x00, 0x1F, 0xC0, 0xEF, 0xFF, 0xFF, 0x90, 0x00, 0x0F, 0xD0, 0xEF, 0xFF, 0xFF, 0x90, 0x00,
+  0x1F, 0xC0, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x5F, 0xA0, 0x02, 0xFA, 0x00, 0x00, 0x01, 0xDF, 0x60,
+  0x02, 0xFA, 0x00, 0x12, 0x6D, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x02, 0xFF,
+  0xFF, 0xED, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xA2, 0x98, 0x00, 0x00, 0x00, 0x1F, 0x27, 0xED,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF6, 0x00, 0x00, 0x0F, 0xB0, 0x04,
+  0xFF, 0xE1, 0x00, 0x00, 0xFB, 0x00, 0x4F, 0xCF, 0x70, 0x00, 0x0F, 0xB0, 0x04, 0xF7, 0xCE, 0x10,
+  0x00, 0xFB, 0x00, 0x4F, 0x74, 0xF8, 0x00, 0x0F, 0xB0, 0x04, 0xF7, 0x0B, 0xF2, 0x00, 0xFB, 0x00,
+  0x4F, 0x70, 0x3F, 0x90, 0x0F, 0xB0, 0x04, 0xF7, 0x00, 0xAF, 0x30, 0xFB, 0x00, 0x4F, 0x70, 0x02,
+  0xFA, 0x0F, 0xB0, 0x04, 0xF7, 0x00, 0x08, 0xF4, 0xFB, 0x00, 0x4F, 0x70, 0x00, 0x1E, 0xCF, 0xB0,
+  0x04, 0xF7, 0x00, 0x00, 0x7F, 0xFB, 0x00, 0x4F, 0x70, 0x00, 0x01, 0xEF, 0xB0, 0x00, 0x00, 0x08,
+  0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x7C, 0xEE, 0xD8, 0x10, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xE4, 0x00,
+  0x00, 0xDF, 0xC4, 0x11, 0x3A, 0xFE, 0x20, 0x06, 0xFC, 0x00, 0x00, 0x00, 0xAF, 0x90, 0x0B, 0xF4,
+  0x00, 0x00, 0x00, 0x1F, 0xE0, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0x0F, 0xE0, 0x00, 0x00,
+  0x00, 0x0B, 0xF2, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F,
+  0xE0, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x01, 0xDF, 0xC4, 0x10, 0x3A, 0xFE, 0x20, 0x00,
+  0x2D, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x7C, 0xEF, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x1C, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x7C, 0xEE, 0xD8, 0x10, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xE4, 0x00,
+  0x00, 0xDF, 0xC4, 0x11, 0x3A, 0xFE, 0x20, 0x06, 0xFC, 0x00, 0x00, 0x00, 0xAF, 0x90, 0x0B, 0xF4,
+  0x00, 0x00, 0x00, 0x1F, 0xE0, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0x0F, 0xE0, 0x00, 0x00,
+  0x00, 0x0B, 0xF2, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F,
+  0xE0, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x01, 0xDF, 0xC4, 0x10, 0x3A, 0xFE, 0x20, 0x00,
+  0x2D, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x7C, 0xEF, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x04,
+  0xEE, 0x60, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x42, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x7C, 0xEE, 0xD8, 0x10, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xE4, 0x00,
+  0x00, 0xDF, 0xC4, 0x11, 0x3A, 0xFE, 0x20, 0x06, 0xFC, 0x00, 0x00, 0x00, 0xAF, 0x90, 0x0B, 0xF4,
+  0x00, 0x00, 0x00, 0x1F, 0xE0, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0x0F, 0xE0, 0x00, 0x00,
+  0x00, 0x0B, 0xF2, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F,
+  0xE0, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x01, 0xDF, 0xC4, 0x10, 0x3A, 0xFE, 0x20, 0x00,
+  0x2D, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x7C, 0xEF, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x4E,
+  0xD5, 0x4E, 0x00, 0x00, 0x00, 0x00, 0xB7, 0x4C, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x7C, 0xEE, 0xD8, 0x10, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xE4, 0x00,
+  0x00, 0xDF, 0xC4, 0x11, 0x3A, 0xFE, 0x20, 0x06, 0xFC, 0x00, 0x00, 0x00, 0xAF, 0x90, 0x0B, 0xF4,
+  0x00, 0x00, 0x00, 0x1F, 0xE0, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0x0F, 0xE0, 0x00, 0x00,
+  0x00, 0x0B, 0xF2, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F,
+  0xE0, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x01, 0xDF, 0xC4, 0x10, 0x3A, 0xFE, 0x20, 0x00,
+  0x2D, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x7C, 0xEF, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x8F,
+  0x41, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x41, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x7C, 0xEE, 0xD8, 0x10, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xE4, 0x00,
+  0x00, 0xDF, 0xC4, 0x11, 0x3A, 0xFE, 0x20, 0x06, 0xFC, 0x00, 0x00, 0x00, 0xAF, 0x90, 0x0B, 0xF4,
+  0x00, 0x00, 0x00, 0x1F, 0xE0, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0x0F, 0xE0, 0x00, 0x00,
+  0x00, 0x0B, 0xF2, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F,
+  0xE0, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x01, 0xDF, 0xC4, 0x10, 0x3A, 0xFE, 0x20, 0x00,
+  0x2D, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x7C, 0xEF, 0xD8, 0x20, 0x00, 0x00, 0x2B, 0x20,
+  0x00, 0x00, 0x1B, 0x20, 0x00, 0x02, 0xED, 0x20, 0x00, 0x2D, 0xE3, 0x00, 0x00, 0x02, 0xED, 0x20,
+  0x2D, 0xE3, 0x00, 0x00, 0x00, 0x02, 0xDE, 0x4D, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xE3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xE4, 0xDE, 0x30,
+  0x00, 0x00, 0x00, 0x2D, 0xD2, 0x02, 0xDE, 0x30, 0x00, 0x00, 0x2E, 0xD2, 0x00, 0x02, 0xDE, 0x30,
+  0x00, 0x02, 0xB2, 0x00, 0x00, 0x01, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x8C, 0xEE, 0xC5, 0x03, 0xE1, 0x00, 0x3D,
+  0xFF, 0xFF, 0xFF, 0x9C, 0x90, 0x01, 0xDF, 0xC4, 0x11, 0x4B, 0xFE, 0x10, 0x07, 0xFC, 0x00, 0x00,
+  0x0A, 0xFF, 0x50, 0x0C, 0xF4, 0x00, 0x00, 0xAC, 0x3F, 0xC0, 0x0E, 0xF0, 0x00, 0x0A, 0xC1, 0x0D,
+  0xF1, 0x0E, 0xE0, 0x00, 0xAC, 0x10, 0x0B, 0xF2, 0x0D, 0xF0, 0x0A, 0xC1, 0x00, 0x0C, 0xF2, 0x09,
+  0xF4, 0xAC, 0x10, 0x00, 0x1F, 0xE0, 0x03, 0xFF, 0xC1, 0x00, 0x00, 0x9F, 0xA0, 0x00, 0xCF, 0xD5,
+  0x10, 0x3A, 0xFE, 0x20, 0x05, 0xE8, 0xFF, 0xFF, 0xFF, 0xE5, 0x00, 0x0D, 0x50, 0x4B, 0xEF, 0xD9,
+  0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2D, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00,
+  0x00, 0x3F, 0x90, 0x07, 0xF5, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x3F, 0x90,
+  0x07, 0xF5, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x3F, 0x90, 0x07, 0xF5, 0x00,
+  0x00, 0x03, 0xF9, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x3F, 0x90, 0x06, 0xF5, 0x00, 0x00, 0x03, 0xF9,
+  0x00, 0x6F, 0x70, 0x00, 0x00, 0x4F, 0x80, 0x03, 0xFB, 0x00, 0x00, 0x08, 0xF6, 0x00, 0x0D, 0xF9,
+  0x21, 0x27, 0xFE, 0x10, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x3A, 0xEF, 0xEB, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x5E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x3F, 0x90, 0x07, 0xF5, 0x00, 0x00, 0x03,
+  0xF9, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x3F, 0x90, 0x07, 0xF5, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x7F,
+  0x50, 0x00, 0x00, 0x3F, 0x90, 0x07, 0xF5, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x7F, 0x50, 0x00, 0x00,
+  0x3F, 0x90, 0x06, 0xF5, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x6F, 0x70, 0x00, 0x00, 0x4F, 0x80, 0x03,
+  0xFB, 0x00, 0x00, 0x08, 0xF6, 0x00, 0x0D, 0xF9, 0x21, 0x27, 0xFE, 0x10, 0x00, 0x4F, 0xFF, 0xFF,
+  0xFF, 0x60, 0x00, 0x00, 0x3A, 0xEF, 0xEB, 0x40, 0x00, 0x00, 0x00, 0x0A, 0xDC, 0x10, 0x00, 0x00,
+  0x00, 0x09, 0xA0, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00,
+  0x00, 0x3F, 0x90, 0x07, 0xF5, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x3F, 0x90,
+  0x07, 0xF5, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x3F, 0x90, 0x07, 0xF5, 0x00,
+  0x00, 0x03, 0xF9, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x3F, 0x90, 0x06, 0xF5, 0x00, 0x00, 0x03, 0xF9,
+  0x00, 0x6F, 0x70, 0x00, 0x00, 0x4F, 0x80, 0x03, 0xFB, 0x00, 0x00, 0x08, 0xF6, 0x00, 0x0D, 0xF9,
+  0x21, 0x27, 0xFE, 0x10, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x3A, 0xEF, 0xEB, 0x40,
+  0x00, 0x00, 0x00, 0xFC, 0x09, 0xF3, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x9F, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x3F, 0x90, 0x07, 0xF5, 0x00, 0x00, 0x03,
+  0xF9, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x3F, 0x90, 0x07, 0xF5, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x7F,
+  0x50, 0x00, 0x00, 0x3F, 0x90, 0x07, 0xF5, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x7F, 0x50, 0x00, 0x00,
+  0x3F, 0x90, 0x06, 0xF5, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x6F, 0x70, 0x00, 0x00, 0x4F, 0x80, 0x03,
+  0xFB, 0x00, 0x00, 0x08, 0xF6, 0x00, 0x0D, 0xF9, 0x21, 0x27, 0xFE, 0x10, 0x00, 0x4F, 0xFF, 0xFF,
+  0xFF, 0x60, 0x00, 0x00, 0x3A, 0xEF, 0xEB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x4E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x30, 0x00,
+  0x00, 0x3F, 0xA0, 0x01, 0xED, 0x10, 0x00, 0x1D, 0xE1, 0x00, 0x05, 0xF9, 0x00, 0x08, 0xF5, 0x00,
+  0x00, 0x0A, 0xF4, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x1E, 0xD2, 0xDD, 0x10, 0x00, 0x00, 0x00, 0x4F,
+  0xEF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00,
+  0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xEC,
+  0x60, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0xF8, 0x00, 0x17, 0xFF, 0x10, 0x4F, 0x80, 0x00,
+  0x0B, 0xF3, 0x04, 0xF8, 0x00, 0x00, 0xBF, 0x30, 0x4F, 0x80, 0x01, 0x7F, 0xE1, 0x04, 0xFF, 0xFF,
+  0xFF, 0xF7, 0x00, 0x4F, 0xFF, 0xFE, 0xC6, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x80,
+  0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xDF, 0xE9, 0x10, 0x00, 0x0A,
+  0xFF, 0xFF, 0xFA, 0x00, 0x02, 0xFD, 0x30, 0x2B, 0xF2, 0x00, 0x5F, 0x60, 0x01, 0x7F, 0x50, 0x05,
+  0xF4, 0x04, 0xEB, 0x52, 0x00, 0x5F, 0x40, 0xDB, 0x00, 0x00, 0x05, 0xF4, 0x0D, 0xD1, 0x00, 0x00,
+  0x5F, 0x40, 0x4E, 0xE6, 0x00, 0x05, 0xF4, 0x00, 0x19, 0xF9, 0x00, 0x5F, 0x40, 0x00, 0x06, 0xF4,
+  0x05, 0xF4, 0x00, 0x00, 0x3F, 0x70, 0x5F, 0x48, 0x51, 0x1A, 0xF6, 0x05, 0xF4, 0xBF, 0xFF, 0xFD,
+  0x10, 0x5F, 0x42, 0xAE, 0xDA, 0x20, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x6E, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xEF, 0xC6,
+  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF7, 0x00, 0x03, 0xA4, 0x11, 0x4D, 0xE1, 0x00, 0x00, 0x00, 0x00,
+  0x5F, 0x40, 0x00, 0x6B, 0xEF, 0xFF, 0xF5, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x60, 0x0D, 0xE4, 0x10,
+  0x05, 0xF6, 0x00, 0xDD, 0x30, 0x15, 0xDF, 0x60, 0x08, 0xFF, 0xFF, 0xFA, 0xF6, 0x00, 0x08, 0xDF,
+  0xD6, 0x3F, 0x60, 0x00, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00,
+  0x9B, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xEF, 0xC6, 0x00, 0x00, 0x3F,
+  0xFF, 0xFF, 0xF7, 0x00, 0x03, 0xA4, 0x11, 0x4D, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00,
+  0x6B, 0xEF, 0xFF, 0xF5, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x60, 0x0D, 0xE4, 0x10, 0x05, 0xF6, 0x00,
+  0xDD, 0x30, 0x15, 0xDF, 0x60, 0x08, 0xFF, 0xFF, 0xFA, 0xF6, 0x00, 0x08, 0xDF, 0xD6, 0x3F, 0x60,
+  0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x8C, 0x7D, 0x10, 0x00, 0x00, 0x3E, 0x20, 0x9A, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xEF, 0xC6, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF7,
+  0x00, 0x03, 0xA4, 0x11, 0x4D, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x6B, 0xEF, 0xFF,
+  0xF5, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x60, 0x0D, 0xE4, 0x10, 0x05, 0xF6, 0x00, 0xDD, 0x30, 0x15,
+  0xDF, 0x60, 0x08, 0xFF, 0xFF, 0xFA, 0xF6, 0x00, 0x08, 0xDF, 0xD6, 0x3F, 0x60, 0x00, 0x3D, 0xD5,
+  0x2F, 0x10, 0x00, 0x09, 0x81, 0xAE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5B, 0xEF, 0xC6, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF7, 0x00, 0x03, 0xA4,
+  0x11, 0x4D, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x6B, 0xEF, 0xFF, 0xF5, 0x00, 0x7F,
+  0xFF, 0xFF, 0xFF, 0x60, 0x0D, 0xE4, 0x10, 0x05, 0xF6, 0x00, 0xDD, 0x30, 0x15, 0xDF, 0x60, 0x08,
+  0xFF, 0xFF, 0xFA, 0xF6, 0x00, 0x08, 0xDF, 0xD6, 0x3F, 0x60, 0x00, 0x6F, 0x60, 0xEC, 0x00, 0x00,
+  0x06, 0xF6, 0x0E, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5B, 0xEF, 0xC6, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF7, 0x00, 0x03, 0xA4, 0x11, 0x4D, 0xE1,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x6B, 0xEF, 0xFF, 0xF5, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+  0x60, 0x0D, 0xE4, 0x10, 0x05, 0xF6, 0x00, 0xDD, 0x30, 0x15, 0xDF, 0x60, 0x08, 0xFF, 0xFF, 0xFA,
+  0xF6, 0x00, 0x08, 0xDF, 0xD6, 0x3F, 0x60, 0x00, 0x04, 0xDE, 0x80, 0x00, 0x00, 0x00, 0xE5, 0x1C,
+  0x60, 0x00, 0x00, 0x2E, 0x00, 0x79, 0x00, 0x00, 0x00, 0xE5, 0x1C, 0x60, 0x00, 0x00, 0x04, 0xDE,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xEF, 0xC6, 0x00, 0x00, 0x3F, 0xFF,
+  0xFF, 0xF7, 0x00, 0x03, 0xA4, 0x11, 0x4D, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x6B,
+  0xEF, 0xFF, 0xF5, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x60, 0x0D, 0xE4, 0x10, 0x05, 0xF6, 0x00, 0xDD,
+  0x30, 0x15, 0xDF, 0x60, 0x08, 0xFF, 0xFF, 0xFA, 0xF6, 0x00, 0x08, 0xDF, 0xD6, 0x3F, 0x60, 0x00,
+  0x5B, 0xDE, 0xC5, 0x01, 0x8D, 0xFD, 0x70, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x6C, 0xFF, 0xFF, 0xF9,
+  0x00, 0x03, 0xA4, 0x11, 0x4D, 0xFF, 0x72, 0x03, 0xBF, 0x30, 0x00, 0x00, 0x00, 0x05, 0xF8, 0x00,
+  0x00, 0x1F, 0x80, 0x00, 0x6B, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x0D, 0xE4, 0x10, 0x05, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD3,
+  0x01, 0x5E, 0xFF, 0x72, 0x01, 0x4A, 0x50, 0x08, 0xFF, 0xFF, 0xFD, 0x5E, 0xFF, 0xFF, 0xFF, 0x50,
+  0x00, 0x7D, 0xFD, 0x91, 0x02, 0x9D, 0xFD, 0xB5, 0x00, 0x00, 0x07, 0xCF, 0xEA, 0x20, 0x00, 0xBF,
+  0xFF, 0xFF, 0xC0, 0x07, 0xFD, 0x41, 0x15, 0x90, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00,
+  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x41, 0x15,
+  0x90, 0x00, 0xCF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xDF, 0xDA, 0x20, 0x00, 0x00, 0x03, 0xC1, 0x00,
+  0x00, 0x00, 0x01, 0xD6, 0x00, 0x00, 0x02, 0xEF, 0xC2, 0x00, 0x00, 0x1B, 0xC1, 0x00, 0x00, 0x00,
+  0x00, 0x1C, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xDF, 0xEA, 0x20, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x20, 0x07, 0xFB, 0x31, 0x17, 0xFA,
+  0x00, 0xCE, 0x00, 0x00, 0x09, 0xE0, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF2, 0x0C, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xA3, 0x11, 0x37, 0x90, 0x00, 0xBF, 0xFF, 0xFF,
+  0xFB, 0x00, 0x00, 0x6C, 0xEE, 0xC8, 0x20, 0x00, 0x00, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x00, 0x4F,
+  0x40, 0x00, 0x00, 0x00, 0x2E, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xDF,
+  0xEA, 0x20, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x20, 0x07, 0xFB, 0x31, 0x17, 0xFA, 0x00, 0xCE, 0x00,
+  0x00, 0x09, 0xE0, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x0C, 0xD0,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0xA3, 0x11, 0x37, 0x90, 0x00, 0xBF, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
+  0x6C, 0xEE, 0xC8, 0x20, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x1E, 0x6D, 0x70, 0x00, 0x00,
+  0x0B, 0x80, 0x2E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xDF, 0xEA, 0x20, 0x00,
+  0x0B, 0xFF, 0xFF, 0xFE, 0x20, 0x07, 0xFB, 0x31, 0x17, 0xFA, 0x00, 0xCE, 0x00, 0x00, 0x09, 0xE0,
+  0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x0C, 0xD0, 0x00, 0x00, 0x00,
+  0x00, 0x7F, 0xA3, 0x11, 0x37, 0x90, 0x00, 0xBF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x6C, 0xEE, 0xC8,
+  0x20, 0x00, 0x0D, 0xD0, 0x7F, 0x50, 0x00, 0x00, 0xDD, 0x07, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xDF, 0xEA, 0x20, 0x00, 0x0B, 0xFF, 0xFF,
+  0xFE, 0x20, 0x07, 0xFB, 0x31, 0x17, 0xFA, 0x00, 0xCE, 0x00, 0x00, 0x09, 0xE0, 0x0E, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x0C, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xA3,
+  0x11, 0x37, 0x90, 0x00, 0xBF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x6C, 0xEE, 0xC8, 0x20, 0x2D, 0xA0,
+  0x00, 0x02, 0xE7, 0x00, 0x00, 0x3E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x50, 0x00, 0x4F, 0x50,
+  0x00, 0x4F, 0x50, 0x00, 0x4F, 0x50, 0x00, 0x4F, 0x50, 0x00, 0x4F, 0x50, 0x00, 0x4F, 0x50, 0x00,
+  0x4F, 0x50, 0x00, 0x4F, 0x50, 0x00, 0x4F, 0x50, 0x00, 0x0A, 0xD2, 0x00, 0x8E, 0x20, 0x05, 0xE2,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF5, 0x00, 0x04, 0xF5, 0x00, 0x04, 0xF5, 0x00, 0x04, 0xF5, 0x00,
+  0x04, 0xF5, 0x00, 0x04, 0xF5, 0x00, 0x04, 0xF5, 0x00, 0x04, 0xF5, 0x00, 0x04, 0xF5, 0x00, 0x04,
+  0xF5, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x4E, 0x5E, 0x40, 0x1D, 0x50, 0x5D, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x50, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x4F, 0x50, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x4F,
+  0x50, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x4F, 0x50, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x4F, 0x50, 0x00,
+  0x04, 0xF5, 0x00, 0x2F, 0xA0, 0xAF, 0x22, 0xFA, 0x0A, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0x50, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x4F, 0x50, 0x00, 0x04, 0xF5, 0x00, 0x00,
+  0x4F, 0x50, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x4F, 0x50, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x4F, 0x50,
+  0x00, 0x04, 0xF5, 0x00, 0x00, 0x1C, 0xE3, 0x04, 0x80, 0x00, 0x00, 0x1E, 0xED, 0xA5, 0x00, 0x00,
+  0x9D, 0xAE, 0xD1, 0x00, 0x00, 0x04, 0x10, 0x4F, 0xC0, 0x00, 0x00, 0x19, 0xDF, 0xFF, 0x90, 0x00,
+  0x1C, 0xFF, 0xFF, 0xFF, 0x30, 0x07, 0xFC, 0x41, 0x18, 0xF9, 0x00, 0xCE, 0x20, 0x00, 0x0E, 0xD0,
+  0x0F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x00, 0x0C, 0xF0, 0x0C, 0xE2, 0x00, 0x01, 0xED,
+  0x00, 0x7F, 0xC3, 0x13, 0xCF, 0x80, 0x00, 0xCF, 0xFF, 0xFF, 0xC1, 0x00, 0x01, 0x8D, 0xFD, 0x81,
+  0x00, 0x00, 0x07, 0xEB, 0x28, 0xA0, 0x00, 0x00, 0xF3, 0x4D, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x5D, 0xFD, 0x50, 0x00, 0x5F, 0xAF, 0xFF,
+  0xFF, 0x40, 0x05, 0xFF, 0x61, 0x17, 0xFA, 0x00, 0x5F, 0x80, 0x00, 0x0D, 0xC0, 0x05, 0xF4, 0x00,
+  0x00, 0xBD, 0x00, 0x5F, 0x40, 0x00, 0x0B, 0xD0, 0x05, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x5F, 0x40,
+  0x00, 0x0B, 0xD0, 0x05, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x5F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x2D,
+  0xA0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x70, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xDF, 0xD9, 0x10, 0x00, 0x1D, 0xFF, 0xFF, 0xFD, 0x10, 0x08,
+  0xFC, 0x31, 0x3C, 0xF8, 0x00, 0xDE, 0x10, 0x00, 0x1E, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0xCF, 0x00,
+  0xFC, 0x00, 0x00, 0x0C, 0xF0, 0x0D, 0xE1, 0x00, 0x01, 0xED, 0x00, 0x8F, 0xC3, 0x13, 0xCF, 0x80,
+  0x01, 0xDF, 0xFF, 0xFF, 0xD1, 0x00, 0x01, 0x9D, 0xFD, 0x91, 0x00, 0x00, 0x00, 0x00, 0xAD, 0x20,
+  0x00, 0x00, 0x00, 0x7E, 0x20, 0x00, 0x00, 0x00, 0x5E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0xDF, 0xD9, 0x10, 0x00, 0x1D, 0xFF, 0xFF, 0xFD, 0x10, 0x08, 0xFC, 0x31, 0x3C,
+  0xF8, 0x00, 0xDE, 0x10, 0x00, 0x1E, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0xCF, 0x00, 0xFC, 0x00, 0x00,
+  0x0C, 0xF0, 0x0D, 0xE1, 0x00, 0x01, 0xED, 0x00, 0x8F, 0xC3, 0x13, 0xCF, 0x80, 0x01, 0xDF, 0xFF,
+  0xFF, 0xD1, 0x00, 0x01, 0x9D, 0xFD, 0x91, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x3E,
+  0x5E, 0x40, 0x00, 0x00, 0x1D, 0x50, 0x5D, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+  0xDF, 0xD9, 0x10, 0x00, 0x1D, 0xFF, 0xFF, 0xFD, 0x10, 0x08, 0xFC, 0x31, 0x3C, 0xF8, 0x00, 0xDE,
+  0x10, 0x00, 0x1E, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0xCF, 0x00, 0xFC, 0x00, 0x00, 0x0C, 0xF0, 0x0D,
+  0xE1, 0x00, 0x01, 0xED, 0x00, 0x8F, 0xC3, 0x13, 0xCF, 0x80, 0x01, 0xDF, 0xFF, 0xFF, 0xD1, 0x00,
+  0x01, 0x9D, 0xFD, 0x91, 0x00, 0x00, 0x0B, 0xE8, 0x1C, 0x50, 0x00, 0x05, 0xC1, 0x7E, 0xB1, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xDF, 0xD9, 0x10,
+  0x00, 0x1D, 0xFF, 0xFF, 0xFD, 0x10, 0x08, 0xFC, 0x31, 0x3C, 0xF8, 0x00, 0xDE, 0x10, 0x00, 0x1E,
+  0xD0, 0x0F, 0xC0, 0x00, 0x00, 0xCF, 0x00, 0xFC, 0x00, 0x00, 0x0C, 0xF0, 0x0D, 0xE1, 0x00, 0x01,
+  0xED, 0x00, 0x8F, 0xC3, 0x13, 0xCF, 0x80, 0x01, 0xDF, 0xFF, 0xFF, 0xD1, 0x00, 0x01, 0x9D, 0xFD,
+  0x91, 0x00, 0x00, 0x1F, 0xA0, 0xAF, 0x20, 0x00, 0x01, 0xFA, 0x0A, 0xF2, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xDF, 0xD9, 0x10, 0x00, 0x1D, 0xFF,
+  0xFF, 0xFD, 0x10, 0x08, 0xFC, 0x31, 0x3C, 0xF8, 0x00, 0xDE, 0x10, 0x00, 0x1E, 0xD0, 0x0F, 0xC0,
+  0x00, 0x00, 0xCF, 0x00, 0xFC, 0x00, 0x00, 0x0C, 0xF0, 0x0D, 0xE1, 0x00, 0x01, 0xED, 0x00, 0x8F,
+  0xC3, 0x13, 0xCF, 0x80, 0x01, 0xDF, 0xFF, 0xFF, 0xD1, 0x00, 0x01, 0x9D, 0xFD, 0x91, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x01, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x02, 0x9D, 0xFD, 0x53, 0xE2, 0x02, 0xEF, 0xFF, 0xFF, 0xE8, 0x00, 0x9F, 0xC3, 0x13, 0xEF, 0x40,
+  0x0D, 0xE2, 0x00, 0x9B, 0xEB, 0x00, 0xFC, 0x00, 0xAA, 0x0B, 0xE0, 0x0D, 0xB0, 0xAA, 0x00, 0xCF,
+  0x00, 0xAE, 0xB9, 0x00, 0x1E, 0xE0, 0x03, 0xFE, 0x31, 0x3C, 0xF9, 0x00, 0x8E, 0xFF, 0xFF, 0xFE,
+  0x20, 0x2E, 0x36, 0xDF, 0xE9, 0x20, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x2D, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0xDC, 0x00, 0x7F, 0x20, 0x00, 0x0D, 0xC0, 0x07, 0xF2, 0x00,
+  0x00, 0xDC, 0x00, 0x7F, 0x20, 0x00, 0x0D, 0xC0, 0x07, 0xF2, 0x00, 0x00, 0xDC, 0x00, 0x7F, 0x20,
+  0x00, 0x0D, 0xC0, 0x06, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC2, 0x13, 0xCF, 0xC0, 0x00, 0xCF,
+  0xFF, 0xFC, 0xDC, 0x00, 0x02, 0xAE, 0xE9, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x9E, 0x20, 0x00, 0x00,
+  0x00, 0x6E, 0x30, 0x00, 0x00, 0x00, 0x4E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xF2, 0x00, 0x00, 0xDC, 0x00, 0x7F, 0x20, 0x00, 0x0D, 0xC0, 0x07, 0xF2, 0x00, 0x00, 0xDC, 0x00,
+  0x7F, 0x20, 0x00, 0x0D, 0xC0, 0x07, 0xF2, 0x00, 0x00, 0xDC, 0x00, 0x7F, 0x20, 0x00, 0x0D, 0xC0,
+  0x06, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC2, 0x13, 0xCF, 0xC0, 0x00, 0xCF, 0xFF, 0xFC, 0xDC,
+  0x00, 0x02, 0xAE, 0xE9, 0x1D, 0xC0, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x00, 0x3E, 0x5E, 0x50,
+  0x00, 0x00, 0x0C, 0x60, 0x4E, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00,
+  0xDC, 0x00, 0x7F, 0x20, 0x00, 0x0D, 0xC0, 0x07, 0xF2, 0x00, 0x00, 0xDC, 0x00, 0x7F, 0x20, 0x00,
+  0x0D, 0xC0, 0x07, 0xF2, 0x00, 0x00, 0xDC, 0x00, 0x7F, 0x20, 0x00, 0x0D, 0xC0, 0x06, 0xF4, 0x00,
+  0x02, 0xFC, 0x00, 0x3F, 0xC2, 0x13, 0xCF, 0xC0, 0x00, 0xCF, 0xFF, 0xFC, 0xDC, 0x00, 0x02, 0xAE,
+  0xE9, 0x1D, 0xC0, 0x00, 0x0F, 0xB0, 0x9F, 0x30, 0x00, 0x00, 0xFB, 0x09, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0xDC, 0x00, 0x7F,
+  0x20, 0x00, 0x0D, 0xC0, 0x07, 0xF2, 0x00, 0x00, 0xDC, 0x00, 0x7F, 0x20, 0x00, 0x0D, 0xC0, 0x07,
+  0xF2, 0x00, 0x00, 0xDC, 0x00, 0x7F, 0x20, 0x00, 0x0D, 0xC0, 0x06, 0xF4, 0x00, 0x02, 0xFC, 0x00,
+  0x3F, 0xC2, 0x13, 0xCF, 0xC0, 0x00, 0xCF, 0xFF, 0xFC, 0xDC, 0x00, 0x02, 0xAE, 0xE9, 0x1D, 0xC0,
+  0x00, 0x00, 0x01, 0xCC, 0x10, 0x00, 0x00, 0x00, 0xAC, 0x10, 0x00, 0x00, 0x00, 0x7D, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0xCD, 0x00, 0xDD, 0x00, 0x00, 0x3F,
+  0x70, 0x07, 0xF3, 0x00, 0x09, 0xF2, 0x00, 0x1F, 0x90, 0x01, 0xEA, 0x00, 0x00, 0x9E, 0x10, 0x5F,
+  0x40, 0x00, 0x03, 0xF6, 0x0B, 0xD0, 0x00, 0x00, 0x0C, 0xC2, 0xF7, 0x00, 0x00, 0x00, 0x6F, 0xBF,
+  0x10, 0x00, 0x00, 0x01, 0xEF, 0x90, 0x00, 0x00, 0x00, 0x09, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xCC,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0x70, 0x00, 0x00, 0x09, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x9F, 0xD4,
+  0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x05, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x6D, 0xFC, 0x50, 0x00, 0x5F,
+  0xAF, 0xFF, 0xFF, 0x60, 0x05, 0xFF, 0x71, 0x17, 0xFE, 0x00, 0x5F, 0x90, 0x00, 0x09, 0xF4, 0x05,
+  0xF5, 0x00, 0x00, 0x5F, 0x60, 0x5F, 0x50, 0x00, 0x05, 0xF6, 0x05, 0xF9, 0x00, 0x00, 0x9F, 0x40,
+  0x5F, 0xF7, 0x11, 0x7F, 0xE0, 0x05, 0xFA, 0xFF, 0xFF, 0xF6, 0x00, 0x5F, 0x46, 0xDF, 0xC5, 0x00,
+  0x05, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x80, 0xDE, 0x00, 0x00, 0x04, 0xF8, 0x0D, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00,
+  0xCD, 0x00, 0xDD, 0x00, 0x00, 0x3F, 0x70, 0x07, 0xF3, 0x00, 0x09, 0xF2, 0x00, 0x1F, 0x90, 0x01,
+  0xEA, 0x00, 0x00, 0x9E, 0x10, 0x5F, 0x40, 0x00, 0x03, 0xF6, 0x0B, 0xD0, 0x00, 0x00, 0x0C, 0xC2,
+  0xF7, 0x00, 0x00, 0x00, 0x6F, 0xBF, 0x10, 0x00, 0x00, 0x01, 0xEF, 0x90, 0x00, 0x00, 0x00, 0x09,
+  0xF3, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x70, 0x00, 0x00, 0x09, 0xFF,
+  0xE1, 0x00, 0x00, 0x00, 0x9F, 0xD4, 0x00, 0x00, 0x00,
+};
+
+static const SmoothGlyph smoothMediumGlyphs[SMOOTH_GLYPH_COUNT] = {
+  {    0,  0,  0,  6,   0,   0},   // U+0020
+  {    0,  7, 13,  7,   0, -13},   // U+0021
+  {   46,  8, 13,  8,   0, -13},   // U+0022
+  {   98, 15, 14, 15,   0, -14},   // U+0023
+  {  203, 11, 17, 11,   0, -14},   // U+0024
+  {  297, 17, 13, 17,   0, -13},   // U+0025
+  {  408, 14, 13, 14,   0, -13},   // U+0026
+  {  499,  5, 13,  5,   0, -13},   // U+0027
+  {  532,  7, 16,  7,   0, -14},   // U+0028
+  {  588,  7, 16,  7,   0, -14},   // U+0029
+  {  644,  9, 13,  9,   0, -13},   // U+002A
+  {  703, 15, 12, 15,   0, -12},   // U+002B
+  {  793,  6,  4,  6,   0,  -2},   // U+002C
+  {  805,  7,  6,  7,   0,  -6},   // U+002D
+  {  826,  6,  2,  6,   0,  -2},   // U+002E
+  {  832,  7, 15,  6,   0, -13},   // U+002F
+  {  885, 11, 13, 11,   0, -13},   // U+0030
+  {  957, 11, 13, 11,   0, -13},   // U+0031
+  { 1029, 11, 13, 11,   0, -13},   // U+0032
+  { 1101, 11, 13, 11,   0, -13},   // U+0033
+  { 1173, 11, 13, 11,   0, -13},   // U+0034
+  { 1245, 11, 13, 11,   0, -13},   // U+0035
+  { 1317, 11, 13, 11,   0, -13},   // U+0036
+  { 1389, 11, 13, 11,   0, -13},   // U+0037
+  { 1461, 11, 13, 11,   0, -13},   // U+0038
+  { 1533, 11, 13, 11,   0, -13},   // U+0039
+  { 1605,  6,  9,  6,   0,  -9},   // U+003A
+  { 1632,  6, 11,  6,   0,  -9},   // U+003B
+  { 1665, 15, 10, 15,   0, -10},   // U+003C
+  { 1740, 15,  9, 15,   0,  -9},   // U+003D
+  { 1808, 15, 10, 15,   0, -10},   // U+003E
+  { 1883, 10, 13, 10,   0, -13},   // U+003F
+  { 1948, 18, 16, 18,   0, -13},   // U+0040
+  { 2092, 13, 13, 12,   0, -13},   // U+0041
+  { 2177, 12, 13, 12,   0, -13},   // U+0042
+  { 2255, 13, 13, 13,   0, -13},   // U+0043
+  { 2340, 14, 13, 14,   0, -13},   // U+0044
+  { 2431, 11, 13, 11,   0, -13},   // U+0045
+  { 2503, 10, 13, 10,   0, -13},   // U+0046
+  { 2568, 14, 13, 14,   0, -13},   // U+0047
+  { 2659, 14, 13, 14,   0, -13},   // U+0048
+  { 2750,  5, 13,  5,   0, -13},   // U+0049
+  { 2783,  6, 17,  5,  -1, -13},   // U+004A
+  { 2834, 13, 13, 12,   0, -13},   // U+004B
+  { 2919, 10, 13, 10,   0, -13},   // U+004C
+  { 2984, 16, 13, 16,   0, -13},   // U+004D
+  { 3088, 13, 13, 13,   0, -13},   // U+004E
+  { 3173, 14, 13, 14,   0, -13},   // U+004F
+  { 3264, 11, 13, 11,   0, -13},   // U+0050
+  { 3336, 14, 15, 14,   0, -13},   // U+0051
+  { 3441, 13, 13, 13,   0, -13},   // U+0052
+  { 3526, 11, 13, 11,   0, -13},   // U+0053
+  { 3598, 13, 13, 11,  -1, -13},   // U+0054
+  { 3683, 13, 13, 13,   0, -13},   // U+0055
+  { 3768, 13, 13, 12,   0, -13},   // U+0056
+  { 3853, 18, 13, 18,   0, -13},   // U+0057
+  { 3970, 12, 13, 12,   0, -13},   // U+0058
+  { 4048, 13, 13, 11,  -1, -13},   // U+0059
+  { 4133, 12, 13, 12,   0, -13},   // U+005A
+  { 4211,  7, 16,  7,   0, -14},   // U+005B
+  { 4267,  7, 15,  6,   0, -13},   // U+005C
+  { 4320,  7, 16,  7,   0, -14},   // U+005D
+  { 4376, 15, 13, 15,   0, -13},   // U+005E
+  { 4474, 11,  4,  9,  -1,   0},   // U+005F
+  { 4496,  9, 14,  9,   0, -14},   // U+0060
+  { 4559, 11, 10, 11,   0, -10},   // U+0061
+  { 4614, 11, 14, 11,   0, -14},   // U+0062
+  { 4691, 10, 10, 10,   0, -10},   // U+0063
+  { 4741, 11, 14, 11,   0, -14},   // U+0064
+  { 4818, 11, 10, 11,   0, -10},   // U+0065
+  { 4873,  7, 14,  6,   0, -14},   // U+0066
+  { 4922, 11, 14, 11,   0, -10},   // U+0067
+  { 4999, 11, 14, 11,   0, -14},   // U+0068
+  { 5076,  5, 14,  5,   0, -14},   // U+0069
+  { 5111,  6, 18,  5,  -1, -14},   // U+006A
+  { 5165, 11, 14, 10,   0, -14},   // U+006B
+  { 5242,  5, 14,  5,   0, -14},   // U+006C
+  { 5277, 18, 10, 18,   0, -10},   // U+006D
+  { 5367, 11, 10, 11,   0, -10},   // U+006E
+  { 5422, 11, 10, 11,   0, -10},   // U+006F
+  { 5477, 11, 14, 11,   0, -10},   // U+0070
+  { 5554, 11, 14, 11,   0, -10},   // U+0071
+  { 5631,  8, 10,  7,   0, -10},   // U+0072
+  { 5671,  9, 10,  9,   0, -10},   // U+0073
+  { 5716,  7, 13,  7,   0, -13},   // U+0074
+  { 5762, 11, 10, 11,   0, -10},   // U+0075
+  { 5817, 11, 10, 11,   0, -10},   // U+0076
+  { 5872, 15, 10, 15,   0, -10},   // U+0077
+  { 5947, 11, 10, 11,   0, -10},   // U+0078
+  { 6002, 11, 14, 11,   0, -10},   // U+0079
+  { 6079,  9, 10,  9,   0, -10},   // U+007A
+  { 6124, 11, 17, 11,   0, -14},   // U+007B
+  { 6218,  6, 18,  6,   0, -14},   // U+007C
+  { 6272, 11, 17, 11,   0, -14},   // U+007D
+  { 6366, 15,  9, 15,   0,  -9},   // U+007E
+  { 6434,  0,  0,  6,   0,   0},   // U+00A0
+  { 6434,  7, 13,  7,   0, -10},   // U+00A1
+  { 6480, 11, 16, 11,   0, -13},   // U+00A2
+  { 6568, 11, 13, 11,   0, -13},   // U+00A3
+  { 6640, 11, 11, 11,   0, -11},   // U+00A4
+  { 6701, 11, 13, 11,   0, -13},   // U+00A5
+  { 6773,  6, 16,  6,   0, -13},   // U+00A6
+  { 6821,  9, 15,  9,   0, -13},   // U+00A7
+  { 6889,  9, 14,  9,   0, -14},   // U+00A8
+  { 6952, 18, 13, 18,   0, -13},   // U+00A9
+  { 7069,  8, 13,  8,   0, -13},   // U+00AA
+  { 7121, 11,  9, 11,   0,  -9},   // U+00AB
+  { 7171, 15,  8, 15,   0,  -8},   // U+00AC
+  { 7231,  7,  6,  7,   0,  -6},   // U+00AD
+  { 7252, 18, 13, 18,   0, -13},   // U+00AE
+  { 7369,  9, 13,  9,   0, -13},   // U+00AF
+  { 7428,  9, 13,  9,   0, -13},   // U+00B0
+  { 7487, 15, 11, 15,   0, -11},   // U+00B1
+  { 7570,  7, 13,  7,   0, -13},   // U+00B2
+  { 7616,  7, 13,  7,   0, -13},   // U+00B3
+  { 7662,  9, 14,  9,   0, -14},   // U+00B4
+  { 7725, 12, 14, 11,   0, -10},   // U+00B5
+  { 7809, 11, 15, 11,   0, -13},   // U+00B6
+  { 7892,  6,  7,  6,   0,  -7},   // U+00B7
+  { 7913,  9,  3,  9,   0,   0},   // U+00B8
+  { 7927,  7, 13,  7,   0, -13},   // U+00B9
+  { 7973,  8, 13,  8,   0, -13},   // U+00BA
+  { 8025, 11,  9, 11,   0,  -9},   // U+00BB
+  { 8075, 17, 13, 17,   0, -13},   // U+00BC
+  { 8186, 17, 13, 17,   0, -13},   // U+00BD
+  { 8297, 17, 13, 17,   0, -13},   // U+00BE
+  { 8408, 10, 14, 10,   0, -10},   // U+00BF
+  { 8478, 13, 16, 12,   0, -16},   // U+00C0
+  { 8582, 13, 16, 12,   0, -16},   // U+00C1
+  { 8686, 13, 16, 12,   0, -16},   // U+00C2
+  { 8790, 13, 16, 12,   0, -16},   // U+00C3
+  { 8894, 13, 16, 12,   0, -16},   // U+00C4
+  { 8998, 13, 17, 12,   0, -17},   // U+00C5
+  { 9109, 18, 13, 18,   0, -13},   // U+00C6
+  { 9226, 13, 16, 13,   0, -13},   // U+00C7
+  { 9330, 11, 16, 11,   0, -16},   // U+00C8
+  { 9418, 11, 16, 11,   0, -16},   // U+00C9
+  { 9506, 11, 16, 11,   0, -16},   // U+00CA
+  { 9594, 11, 16, 11,   0, -16},   // U+00CB
+  { 9682,  5, 16,  5,   0, -16},   // U+00CC
+  { 9722,  5, 16,  5,   0, -16},   // U+00CD
+  { 9762,  7, 16,  5,  -1, -16},   // U+00CE
+  { 9818,  6, 16,  5,   0, -16},   // U+00CF
+  { 9866, 14, 13, 14,   0, -13},   // U+00D0
+  { 9957, 13, 16, 13,   0, -16},   // U+00D1
+  {10061, 14, 16, 14,   0, -16},   // U+00D2
+  {10173, 14, 16, 14,   0, -16},   // U+00D3
+  {10285, 14, 16, 14,   0, -16},   // U+00D4
+  {10397, 14, 16, 14,   0, -16},   // U+00D5
+  {10509, 14, 16, 14,   0, -16},   // U+00D6
+  {10621, 15, 11, 15,   0, -11},   // U+00D7
+  {10704, 14, 15, 14,   0, -14},   // U+00D8
+  {10809, 13, 16, 13,   0, -16},   // U+00D9
+  {10913, 13, 16, 13,   0, -16},   // U+00DA
+  {11017, 13, 16, 13,   0, -16},   // U+00DB
+  {11121, 13, 16, 13,   0, -16},   // U+00DC
+  {11225, 13, 16, 11,  -1, -16},   // U+00DD
+  {11329, 11, 13, 11,   0, -13},   // U+00DE
+  {11401, 11, 14, 11,   0, -14},   // U+00DF
+  {11478, 11, 14, 11,   0, -14},   // U+00E0
+  {11555, 11, 14, 11,   0, -14},   // U+00E1
+  {11632, 11, 14, 11,   0, -14},   // U+00E2
+  {11709, 11, 14, 11,   0, -14},   // U+00E3
+  {11786, 11, 14, 11,   0, -14},   // U+00E4
+  {11863, 11, 16, 11,   0, -16},   // U+00E5
+  {11951, 18, 10, 18,   0, -10},   // U+00E6
+  {12041, 10, 13, 10,   0, -10},   // U+00E7
+  {12106, 11, 14, 11,   0, -14},   // U+00E8
+  {12183, 11, 14, 11,   0, -14},   // U+00E9
+  {12260, 11, 14, 11,   0, -14},   // U+00EA
+  {12337, 11, 14, 11,   0, -14},   // U+00EB
+  {12414,  6, 14,  5,  -1, -14},   // U+00EC
+  {12456,  6, 14,  5,   0, -14},   // U+00ED
+  {12498,  7, 14,  5,  -1, -14},   // U+00EE
+  {12547,  7, 14,  5,  -1, -14},   // U+00EF
+  {12596, 11, 14, 11,   0, -14},   // U+00F0
+  {12673, 11, 14, 11,   0, -14},   // U+00F1
+  {12750, 11, 14, 11,   0, -14},   // U+00F2
+  {12827, 11, 14, 11,   0, -14},   // U+00F3
+  {12904, 11, 14, 11,   0, -14},   // U+00F4
+  {12981, 11, 14, 11,   0, -14},   // U+00F5
+  {13058, 11, 14, 11,   0, -14},   // U+00F6
+  {13135, 15, 10, 15,   0, -10},   // U+00F7
+  {13210, 11, 12, 11,   0, -11},   // U+00F8
+  {13276, 11, 14, 11,   0, -14},   // U+00F9
+  {13353, 11, 14, 11,   0, -14},   // U+00FA
+  {13430, 11, 14, 11,   0, -14},   // U+00FB
+  {13507, 11, 14, 11,   0, -14},   // U+00FC
+  {13584, 11, 18, 11,   0, -14},   // U+00FD
+  {13683, 11, 18, 11,   0, -14},   // U+00FE
+  {13782, 11, 18, 11,   0, -14},   // U+00FF
+};
+
+static const SmoothFont smoothFontMedium = {
+  smoothMediumData, smoothMediumGlyphs, 13, 17, 5, 0
+};
+
+// Large: 26 px, MTC y títulos (FONT_SIZE_LARGE)
+static const uint8_t smoothLargeData[22712] = {
+  0x02, 0x10, 0xF1, 0x80, 0x05, 0x10, 0xF1, 0x80, 0x05, 0x10, 0xF1, 0x80, 0x05, 0x10, 0xF1, 0x80,
+  0x05, 0x10, 0xF1, 0x80, 0x05, 0x10, 0xF1, 0x80, 0x05, 0x10, 0xF1, 0x80, 0x05, 0x10, 0xF1, 0x80,
+  0x05, 0x10, 0xF1, 0x70, 0x06, 0xF1, 0x70, 0x06, 0xE0, 0xF0, 0x60, 0x06, 0xE0, 0xF0, 0x50, 0x06,
+  0xD0, 0xF0, 0x40, 0x0F, 0x0F, 0x03, 0x10, 0xF1, 0x80, 0x05, 0x10, 0xF1, 0x80, 0x05, 0x10, 0xF1,
+  0x80, 0x02, 0x01, 0x80, 0xF0, 0xA0, 0x01, 0xB0, 0xF0, 0x70, 0x03, 0x80, 0xF0, 0xA0, 0x01, 0xB0,
+  0xF0, 0x70, 0x03, 0x80, 0xF0, 0xA0, 0x01, 0xB0, 0xF0, 0x70, 0x03, 0x80, 0xF0, 0xA0, 0x01, 0xB0,
+  0xF0, 0x70, 0x03, 0x80, 0xF0, 0xA0, 0x01, 0xB0, 0xF0, 0x70, 0x03, 0x80, 0xF0, 0xA0, 0x01, 0xB0,
+  0xF0, 0x70, 0x03, 0x80, 0xF0, 0xA0, 0x01, 0xB0, 0xF0, 0x70, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x01, 0x08, 0xC0, 0xF0, 0x40, 0x01, 0x10, 0xF1, 0x10, 0x0B, 0x10, 0xF0, 0xE0,
+  0x02, 0x40, 0xF0, 0xB0, 0x0C, 0x50, 0xF0, 0xB0, 0x02, 0x80, 0xF0, 0x70, 0x0C, 0x90, 0xF0, 0x70,
+  0x02, 0xC0, 0xF0, 0x30, 0x0C, 0xD0, 0xF0, 0x30, 0x01, 0x10, 0xF0, 0xE0, 0x08, 0x80, 0xFE, 0xC0,
+  0x04, 0x80, 0xFE, 0xC0, 0x08, 0x90, 0xF0, 0x70, 0x02, 0xD0, 0xF0, 0x30, 0x0C, 0xD0, 0xF0, 0x30,
+  0x01, 0x10, 0xF0, 0xE0, 0x0C, 0x20, 0xF0, 0xE0, 0x02, 0x50, 0xF0, 0xA0, 0x0C, 0x60, 0xF0, 0xA0,
+  0x02, 0x90, 0xF0, 0x60, 0x08, 0xFF, 0x50, 0x04, 0xFF, 0x50, 0x07, 0x20, 0xF0, 0xE0, 0x02, 0x60,
+  0xF0, 0xA0, 0x0C, 0x60, 0xF0, 0xA0, 0x02, 0xA0, 0xF0, 0x60, 0x0C, 0xA0, 0xF0, 0x60, 0x02, 0xD0,
+  0xF0, 0x20, 0x0C, 0xE0, 0xF0, 0x20, 0x01, 0x20, 0xF0, 0xD0, 0x0C, 0x30, 0xF0, 0xD0, 0x02, 0x60,
+  0xF0, 0x90, 0x08, 0x06, 0x70, 0xC0, 0x0E, 0x70, 0xC0, 0x0E, 0x70, 0xC0, 0x0B, 0x30, 0x90, 0xD0,
+  0xF1, 0xE0, 0xC0, 0x80, 0x40, 0x06, 0x70, 0xF8, 0x40, 0x04, 0x40, 0xF1, 0xB0, 0x30, 0x80, 0xC0,
+  0x10, 0x30, 0x70, 0xB0, 0x30, 0x04, 0xA0, 0xF0, 0xC0, 0x01, 0x70, 0xC0, 0x09, 0xC0, 0xF0, 0x80,
+  0x01, 0x70, 0xC0, 0x09, 0xC0, 0xF0, 0xA0, 0x01, 0x70, 0xC0, 0x09, 0x80, 0xF1, 0x70, 0x00, 0x70,
+  0xC0, 0x09, 0x10, 0xD0, 0xF1, 0xE0, 0xD1, 0x50, 0x20, 0x08, 0x20, 0xA0, 0xF5, 0xC0, 0x40, 0x08,
+  0x10, 0x60, 0xB0, 0xF4, 0x60, 0x09, 0x70, 0xC0, 0x10, 0x60, 0xE0, 0xF0, 0xE0, 0x10, 0x08, 0x70,
+  0xC0, 0x01, 0x40, 0xF1, 0x50, 0x08, 0x70, 0xC0, 0x02, 0xF1, 0x50, 0x08, 0x70, 0xC0, 0x01, 0x50,
+  0xF1, 0x30, 0x03, 0xB0, 0x90, 0x50, 0x20, 0x10, 0x70, 0xC0, 0x20, 0x70, 0xE0, 0xF0, 0xC0, 0x04,
+  0xD0, 0xF8, 0xD0, 0x20, 0x04, 0x10, 0x60, 0xA0, 0xC0, 0xE0, 0xF1, 0xE0, 0xB0, 0x60, 0x0B, 0x80,
+  0xC0, 0x0E, 0x70, 0xC0, 0x0E, 0x70, 0xC0, 0x0E, 0x70, 0xC0, 0x07, 0x02, 0x50, 0xC0, 0xF0, 0xE0,
+  0xA0, 0x20, 0x06, 0x20, 0xE1, 0x10, 0x06, 0x70, 0xF4, 0xE0, 0x20, 0x05, 0xA0, 0xF0, 0x50, 0x06,
+  0x10, 0xF1, 0x70, 0x10, 0x20, 0xC0, 0xF0, 0xA0, 0x04, 0x40, 0xF0, 0xB0, 0x07, 0x60, 0xF0, 0xB0,
+  0x02, 0x20, 0xF1, 0x10, 0x02, 0x10, 0xD0, 0xF0, 0x20, 0x07, 0x80, 0xF0, 0x80, 0x03, 0xE0, 0xF0,
+  0x20, 0x02, 0x80, 0xF0, 0x70, 0x08, 0x80, 0xF0, 0x80, 0x03, 0xE0, 0xF0, 0x20, 0x01, 0x30, 0xF0,
+  0xD0, 0x09, 0x60, 0xF0, 0xB0, 0x02, 0x20, 0xF1, 0x10, 0x01, 0xC0, 0xF0, 0x40, 0x09, 0x20, 0xF1,
+  0x70, 0x10, 0x20, 0xC0, 0xF0, 0xB0, 0x01, 0x60, 0xF0, 0x90, 0x0B, 0x70, 0xF4, 0xE0, 0x20, 0x00,
+  0x10, 0xE1, 0x10, 0x0C, 0x60, 0xC0, 0xF0, 0xE0, 0xA0, 0x20, 0x01, 0xA0, 0xF0, 0x50, 0x01, 0x50,
+  0xC0, 0xE1, 0xB0, 0x30, 0x0C, 0x40, 0xF0, 0xB0, 0x01, 0x60, 0xF4, 0xE0, 0x30, 0x0A, 0x10, 0xD0,
+  0xF0, 0x20, 0x00, 0x10, 0xE0, 0xF0, 0x80, 0x10, 0x20, 0xB0, 0xF0, 0xC0, 0x0A, 0x80, 0xF0, 0x70,
+  0x01, 0x50, 0xF0, 0xC0, 0x02, 0x10, 0xF1, 0x10, 0x08, 0x30, 0xF0, 0xD0, 0x02, 0x70, 0xF0, 0x90,
+  0x03, 0xC0, 0xF0, 0x30, 0x08, 0xC0, 0xF0, 0x40, 0x02, 0x70, 0xF0, 0x90, 0x03, 0xC0, 0xF0, 0x30,
+  0x07, 0x60, 0xF0, 0x90, 0x03, 0x50, 0xF0, 0xC0, 0x02, 0x10, 0xF1, 0x10, 0x06, 0x10, 0xE1, 0x10,
+  0x03, 0x10, 0xE0, 0xF0, 0x80, 0x10, 0x20, 0xB0, 0xF0, 0xC0, 0x07, 0xA0, 0xF0, 0x60, 0x05, 0x60,
+  0xF4, 0xE0, 0x30, 0x06, 0x40, 0xF0, 0xB0, 0x07, 0x50, 0xC0, 0xF0, 0xE0, 0xB0, 0x30, 0x02, 0x04,
+  0x10, 0x80, 0xD0, 0xF0, 0xE0, 0xC0, 0x90, 0x40, 0x0A, 0x20, 0xD0, 0xF6, 0x30, 0x09, 0xB0, 0xF1,
+  0x70, 0x20, 0x00, 0x20, 0x60, 0xC0, 0x20, 0x08, 0x10, 0xF1, 0x70, 0x0F, 0x30, 0xF1, 0x40, 0x0F,
+  0x10, 0xF1, 0x70, 0x0F, 0x00, 0xA0, 0xF1, 0x30, 0x0F, 0x30, 0xF1, 0xE0, 0x30, 0x0D, 0x30, 0xD0,
+  0xF2, 0xE0, 0x30, 0x0B, 0x20, 0xE0, 0xF0, 0xB0, 0x40, 0xE0, 0xF0, 0xE0, 0x30, 0x04, 0xD0, 0xF0,
+  0x80, 0x02, 0xA0, 0xF0, 0xD0, 0x10, 0x00, 0x30, 0xE0, 0xF0, 0xE0, 0x30, 0x03, 0xF1, 0x50, 0x01,
+  0x20, 0xF1, 0x60, 0x02, 0x20, 0xE0, 0xF0, 0xE0, 0x30, 0x01, 0x40, 0xF0, 0xE0, 0x10, 0x01, 0x40,
+  0xF1, 0x20, 0x03, 0x20, 0xD0, 0xF0, 0xE0, 0x30, 0x00, 0xA0, 0xF0, 0x90, 0x02, 0x50, 0xF1, 0x20,
+  0x04, 0x20, 0xD0, 0xF0, 0xE0, 0x70, 0xF0, 0xE0, 0x20, 0x02, 0x20, 0xF1, 0x70, 0x05, 0x20, 0xD0,
+  0xF2, 0x60, 0x04, 0xC0, 0xF0, 0xE0, 0x30, 0x05, 0x40, 0xF2, 0x40, 0x04, 0x30, 0xE0, 0xF0, 0xE0,
+  0x70, 0x20, 0x00, 0x10, 0x30, 0x90, 0xF3, 0xE0, 0x30, 0x04, 0x40, 0xE0, 0xF7, 0x80, 0x20, 0xD0,
+  0xF0, 0xE0, 0x20, 0x04, 0x10, 0x70, 0xB0, 0xE0, 0xF0, 0xE0, 0xC0, 0x80, 0x20, 0x01, 0x30, 0xE0,
+  0xF0, 0xD0, 0x20, 0x01, 0x80, 0xF0, 0xA0, 0x03, 0x80, 0xF0, 0xA0, 0x03, 0x80, 0xF0, 0xA0, 0x03,
+  0x80, 0xF0, 0xA0, 0x03, 0x80, 0xF0, 0xA0, 0x03, 0x80, 0xF0, 0xA0, 0x03, 0x80, 0xF0, 0xA0, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x05, 0x04, 0x40, 0xF0, 0xC0, 0x06, 0xC0, 0xF0, 0x40, 0x05, 0x60, 0xF0,
+  0xC0, 0x06, 0xD0, 0xF0, 0x50, 0x05, 0x40, 0xF0, 0xE0, 0x10, 0x05, 0xA0, 0xF0, 0x90, 0x06, 0xF1,
+  0x60, 0x05, 0x40, 0xF1, 0x20, 0x05, 0x70, 0xF0, 0xE0, 0x06, 0x90, 0xF0, 0xD0, 0x06, 0xA0, 0xF0,
+  0xC0, 0x06, 0xB0, 0xF0, 0xB0, 0x06, 0xA0, 0xF0, 0xC0, 0x06, 0x90, 0xF0, 0xD0, 0x06, 0x70, 0xF0,
+  0xE0, 0x06, 0x40, 0xF1, 0x20, 0x06, 0xF1, 0x50, 0x06, 0xA0, 0xF0, 0x90, 0x06, 0x40, 0xF0, 0xE0,
+  0x10, 0x06, 0xD0, 0xF0, 0x50, 0x06, 0x60, 0xF0, 0xC0, 0x07, 0xC0, 0xF0, 0x40, 0x06, 0x40, 0xF0,
+  0xC0, 0x01, 0x01, 0xA0, 0xF0, 0x60, 0x06, 0x30, 0xF0, 0xE0, 0x10, 0x06, 0xA0, 0xF0, 0x80, 0x06,
+  0x30, 0xF0, 0xE0, 0x10, 0x06, 0xD0, 0xF0, 0x60, 0x06, 0x80, 0xF0, 0xC0, 0x06, 0x40, 0xF1, 0x20,
+  0x05, 0x10, 0xF1, 0x60, 0x06, 0xC0, 0xF0, 0x90, 0x06, 0xB0, 0xF0, 0xB0, 0x06, 0xA0, 0xF0, 0xC0,
+  0x06, 0x90, 0xF0, 0xD0, 0x06, 0xA0, 0xF0, 0xC0, 0x06, 0xB0, 0xF0, 0xB0, 0x06, 0xC0, 0xF0, 0x90,
+  0x05, 0x10, 0xF1, 0x60, 0x05, 0x40, 0xF1, 0x20, 0x05, 0x70, 0xF0, 0xC0, 0x06, 0xD0, 0xF0, 0x60,
+  0x05, 0x30, 0xF0, 0xE0, 0x10, 0x05, 0xA0, 0xF0, 0x80, 0x05, 0x20, 0xF0, 0xE0, 0x10, 0x05, 0xA0,
+  0xF0, 0x60, 0x04, 0x04, 0x30, 0xF0, 0x30, 0x09, 0x30, 0xF0, 0x30, 0x05, 0xA0, 0x50, 0x01, 0x30,
+  0xF0, 0x30, 0x01, 0x50, 0xA0, 0x00, 0x10, 0xB0, 0xF0, 0xB0, 0x20, 0x30, 0xF0, 0x30, 0x20, 0xB0,
+  0xF0, 0xB0, 0x10, 0x01, 0x50, 0xD0, 0xE0, 0x90, 0xF0, 0x90, 0xE0, 0xD0, 0x50, 0x04, 0x10, 0x80,
+  0xF2, 0x80, 0x10, 0x05, 0x10, 0x80, 0xF2, 0x80, 0x10, 0x04, 0x50, 0xD0, 0xE0, 0x90, 0xF0, 0x90,
+  0xE0, 0xD0, 0x50, 0x01, 0x10, 0xB0, 0xF0, 0xB0, 0x20, 0x30, 0xF0, 0x30, 0x20, 0xB0, 0xF0, 0xB0,
+  0x10, 0x00, 0xA0, 0x50, 0x01, 0x30, 0xF0, 0x30, 0x01, 0x50, 0xA0, 0x05, 0x30, 0xF0, 0x30, 0x09,
+  0x30, 0xF0, 0x30, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x08, 0x30, 0xF0, 0xE0, 0x0F, 0x02, 0x30,
+  0xF0, 0xE0, 0x0F, 0x02, 0x30, 0xF0, 0xE0, 0x0F, 0x02, 0x30, 0xF0, 0xE0, 0x0F, 0x02, 0x30, 0xF0,
+  0xE0, 0x0F, 0x02, 0x30, 0xF0, 0xE0, 0x0F, 0x02, 0x30, 0xF0, 0xE0, 0x0B, 0x40, 0xFF, 0x04, 0x40,
+  0xFF, 0x0B, 0x30, 0xF0, 0xE0, 0x0F, 0x02, 0x30, 0xF0, 0xE0, 0x0F, 0x02, 0x30, 0xF0, 0xE0, 0x0F,
+  0x02, 0x30, 0xF0, 0xE0, 0x0F, 0x02, 0x30, 0xF0, 0xE0, 0x0F, 0x02, 0x30, 0xF0, 0xE0, 0x0F, 0x02,
+  0x30, 0xF0, 0xE0, 0x09, 0x02, 0xE0, 0xF0, 0xB0, 0x04, 0xE0, 0xF0, 0xB0, 0x03, 0x10, 0xF1, 0x70,
+  0x03, 0x50, 0xF0, 0xE0, 0x10, 0x03, 0x90, 0xF0, 0x70, 0x04, 0xD1, 0x03, 0x00, 0xB0, 0xF5, 0x20,
+  0x00, 0xB0, 0xF5, 0x20, 0x0F, 0x0F, 0x0F, 0x05, 0x01, 0x30, 0xF1, 0x70, 0x03, 0x30, 0xF1, 0x70,
+  0x03, 0x30, 0xF1, 0x70, 0x01, 0x05, 0x80, 0xF0, 0x90, 0x05, 0xD0, 0xF0, 0x40, 0x04, 0x30, 0xF0,
+  0xE0, 0x05, 0x70, 0xF0, 0xA0, 0x05, 0xC0, 0xF0, 0x50, 0x04, 0x20, 0xF1, 0x10, 0x04, 0x70, 0xF0,
+  0xB0, 0x05, 0xB0, 0xF0, 0x60, 0x04, 0x10, 0xF1, 0x10, 0x04, 0x60, 0xF0, 0xC0, 0x05, 0xA0, 0xF0,
+  0x70, 0x04, 0x10, 0xF1, 0x20, 0x04, 0x50, 0xF0, 0xC0, 0x05, 0xA0, 0xF0, 0x80, 0x05, 0xE0, 0xF0,
+  0x30, 0x04, 0x40, 0xF0, 0xD0, 0x05, 0x90, 0xF0, 0x90, 0x05, 0xD0, 0xF0, 0x40, 0x04, 0x30, 0xF0,
+  0xE0, 0x05, 0x80, 0xF0, 0x90, 0x05, 0xD0, 0xF0, 0x50, 0x05, 0x04, 0x60, 0xB0, 0xE0, 0xF0, 0xD0,
+  0x90, 0x20, 0x08, 0xB0, 0xF5, 0xE0, 0x50, 0x06, 0x90, 0xF1, 0x80, 0x20, 0x10, 0x40, 0xC0, 0xF0,
+  0xE0, 0x20, 0x04, 0x30, 0xF1, 0x80, 0x03, 0x10, 0xE0, 0xF0, 0xA0, 0x04, 0x90, 0xF0, 0xE0, 0x10,
+  0x04, 0x70, 0xF1, 0x10, 0x03, 0xD0, 0xF0, 0xB0, 0x05, 0x30, 0xF1, 0x60, 0x02, 0x10, 0xF1, 0x80,
+  0x06, 0xE0, 0xF0, 0x90, 0x02, 0x30, 0xF1, 0x60, 0x06, 0xD0, 0xF0, 0xB0, 0x02, 0x40, 0xF1, 0x50,
+  0x06, 0xC0, 0xF0, 0xB0, 0x02, 0x40, 0xF1, 0x50, 0x06, 0xB0, 0xF0, 0xC0, 0x02, 0x40, 0xF1, 0x50,
+  0x06, 0xC0, 0xF0, 0xB0, 0x02, 0x30, 0xF1, 0x60, 0x06, 0xD0, 0xF0, 0xB0, 0x02, 0x10, 0xF1, 0x80,
+  0x06, 0xE0, 0xF0, 0x90, 0x03, 0xD0, 0xF0, 0xB0, 0x05, 0x30, 0xF1, 0x60, 0x03, 0x90, 0xF0, 0xE0,
+  0x10, 0x04, 0x70, 0xF1, 0x10, 0x03, 0x30, 0xF1, 0x80, 0x03, 0x10, 0xE0, 0xF0, 0xA0, 0x05, 0x90,
+  0xF1, 0x80, 0x20, 0x10, 0x40, 0xC0, 0xF0, 0xE0, 0x20, 0x06, 0xB0, 0xF5, 0xE0, 0x50, 0x08, 0x60,
+  0xB0, 0xE0, 0xF0, 0xD0, 0x90, 0x20, 0x04, 0x02, 0x20, 0x50, 0x90, 0xC0, 0xF1, 0xE0, 0x08, 0x20,
+  0xF5, 0xE0, 0x08, 0x20, 0xD0, 0xA0, 0x60, 0x30, 0x90, 0xF0, 0xE0, 0x0D, 0x90, 0xF0, 0xE0, 0x0D,
+  0x90, 0xF0, 0xE0, 0x0D, 0x90, 0xF0, 0xE0, 0x0D, 0x90, 0xF0, 0xE0, 0x0D, 0x90, 0xF0, 0xE0, 0x0D,
+  0x90, 0xF0, 0xE0, 0x0D, 0x90, 0xF0, 0xE0, 0x0D, 0x90, 0xF0, 0xE0, 0x0D, 0x90, 0xF0, 0xE0, 0x0D,
+  0x90, 0xF0, 0xE0, 0x0D, 0x90, 0xF0, 0xE0, 0x0D, 0x90, 0xF0, 0xE0, 0x0D, 0x90, 0xF0, 0xE0, 0x0D,
+  0x90, 0xF0, 0xE0, 0x09, 0xC0, 0xF9, 0x20, 0x04, 0xC0, 0xF9, 0x20, 0x01, 0x01, 0x20, 0x60, 0xA0,
+  0xC0, 0xE0, 0xF0, 0xE0, 0xB0, 0x70, 0x10, 0x06, 0xF8, 0xD0, 0x30, 0x05, 0xF1, 0xA0, 0x50, 0x11,
+  0x20, 0x80, 0xF1, 0xE0, 0x10, 0x04, 0xA0, 0x20, 0x05, 0x50, 0xF1, 0x80, 0x0D, 0xD0, 0xF0, 0xB0,
+  0x0D, 0xB0, 0xF0, 0xC0, 0x0D, 0xE0, 0xF0, 0xB0, 0x0C, 0x50, 0xF1, 0x60, 0x0B, 0x20, 0xE0, 0xF0,
+  0xD0, 0x0B, 0x10, 0xC0, 0xF1, 0x30, 0x0B, 0xB0, 0xF1, 0x50, 0x0B, 0xA0, 0xF1, 0x60, 0x0B, 0xA0,
+  0xF1, 0x60, 0x0B, 0xA0, 0xF1, 0x60, 0x0B, 0xA0, 0xF1, 0x70, 0x0B, 0x90, 0xF1, 0x70, 0x0B, 0x90,
+  0xF1, 0x70, 0x0B, 0x10, 0xFA, 0xE0, 0x03, 0x10, 0xFA, 0xE0, 0x02, 0x02, 0x40, 0x80, 0xC0, 0xD0,
+  0xF0, 0xE0, 0xC0, 0x90, 0x30, 0x06, 0x70, 0xF8, 0x70, 0x05, 0x60, 0xA0, 0x60, 0x30, 0x20, 0x00,
+  0x20, 0x50, 0xD0, 0xF1, 0x50, 0x0C, 0x10, 0xE0, 0xF0, 0xC0, 0x0D, 0x90, 0xF1, 0x0D, 0x90, 0xF0,
+  0xE0, 0x0C, 0x10, 0xD0, 0xF0, 0xA0, 0x0A, 0x20, 0x50, 0xC0, 0xF0, 0xD0, 0x20, 0x07, 0xB0, 0xF3,
+  0xE0, 0x80, 0x10, 0x08, 0xB0, 0xF4, 0xB0, 0x40, 0x0B, 0x20, 0x50, 0xC0, 0xF1, 0x60, 0x0D, 0xB0,
+  0xF0, 0xE0, 0x10, 0x0C, 0x40, 0xF1, 0x50, 0x0C, 0x20, 0xF1, 0x60, 0x0C, 0x40, 0xF1, 0x50, 0x0C,
+  0xB0, 0xF1, 0x10, 0x03, 0xD0, 0x80, 0x40, 0x20, 0x10, 0x00, 0x20, 0x50, 0xC0, 0xF1, 0x70, 0x04,
+  0xF9, 0x80, 0x05, 0x20, 0x70, 0xB0, 0xD0, 0xE0, 0xF0, 0xE0, 0xC0, 0x80, 0x20, 0x04, 0x07, 0x30,
+  0xF2, 0x60, 0x0B, 0xD0, 0xF2, 0x60, 0x0A, 0x80, 0xF0, 0xC0, 0xF1, 0x60, 0x09, 0x30, 0xF0, 0xD0,
+  0x30, 0xF1, 0x60, 0x08, 0x10, 0xD0, 0xF0, 0x40, 0x30, 0xF1, 0x60, 0x08, 0x90, 0xF0, 0xA0, 0x00,
+  0x30, 0xF1, 0x60, 0x07, 0x40, 0xF0, 0xE0, 0x10, 0x00, 0x30, 0xF1, 0x60, 0x06, 0x10, 0xD0, 0xF0,
+  0x50, 0x01, 0x30, 0xF1, 0x60, 0x06, 0x90, 0xF0, 0xA0, 0x02, 0x30, 0xF1, 0x60, 0x05, 0x50, 0xF0,
+  0xE0, 0x10, 0x02, 0x30, 0xF1, 0x60, 0x04, 0x10, 0xE0, 0xF0, 0x50, 0x03, 0x30, 0xF1, 0x60, 0x04,
+  0x90, 0xF0, 0xA0, 0x04, 0x30, 0xF1, 0x60, 0x04, 0xB0, 0xFC, 0x10, 0x01, 0xB0, 0xFC, 0x10, 0x09,
+  0x30, 0xF1, 0x60, 0x0C, 0x30, 0xF1, 0x60, 0x0C, 0x30, 0xF1, 0x60, 0x0C, 0x30, 0xF1, 0x60, 0x0C,
+  0x30, 0xF1, 0x60, 0x03, 0x01, 0x30, 0xF8, 0xD0, 0x05, 0x30, 0xF8, 0xD0, 0x05, 0x30, 0xF1, 0x20,
+  0x0C, 0x30, 0xF1, 0x20, 0x0C, 0x30, 0xF1, 0x20, 0x0C, 0x30, 0xF1, 0x20, 0x0C, 0x30, 0xF1, 0xC0,
+  0xE0, 0xF0, 0xE0, 0xB0, 0x60, 0x10, 0x06, 0x30, 0xF7, 0xD0, 0x30, 0x05, 0x30, 0xB0, 0x60, 0x30,
+  0x11, 0x30, 0x90, 0xF1, 0xE0, 0x20, 0x0C, 0x50, 0xF1, 0x90, 0x0D, 0xB0, 0xF0, 0xE0, 0x0D, 0x60,
+  0xF1, 0x30, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x60, 0xF1, 0x30, 0x0C, 0xB0, 0xF0, 0xE0, 0x0C, 0x50,
+  0xF1, 0xA0, 0x04, 0xD0, 0x80, 0x40, 0x20, 0x11, 0x30, 0x90, 0xF1, 0xE0, 0x20, 0x04, 0xF8, 0xD0,
+  0x30, 0x05, 0x20, 0x70, 0xB0, 0xD0, 0xE0, 0xF0, 0xD0, 0xB0, 0x60, 0x05, 0x05, 0x50, 0xA0, 0xD0,
+  0xF0, 0xD0, 0xB0, 0x60, 0x10, 0x06, 0x20, 0xC0, 0xF6, 0xA0, 0x05, 0x10, 0xD0, 0xF0, 0xE0, 0x80,
+  0x20, 0x00, 0x10, 0x30, 0x80, 0x90, 0x05, 0xA0, 0xF0, 0xE0, 0x30, 0x0B, 0x30, 0xF1, 0x70, 0x0C,
+  0x90, 0xF1, 0x10, 0x0C, 0xD0, 0xF0, 0xB0, 0x0C, 0x10, 0xF1, 0x80, 0x10, 0x80, 0xD0, 0xF0, 0xE0,
+  0xC0, 0x70, 0x10, 0x04, 0x20, 0xF1, 0x80, 0xD0, 0xF5, 0xD0, 0x30, 0x03, 0x30, 0xF3, 0x90, 0x20,
+  0x00, 0x20, 0x70, 0xF1, 0xD0, 0x10, 0x02, 0x20, 0xF2, 0x90, 0x04, 0x60, 0xF1, 0x70, 0x02, 0x10,
+  0xF2, 0x10, 0x05, 0xD0, 0xF0, 0xB0, 0x03, 0xE0, 0xF0, 0xE0, 0x06, 0xB0, 0xF0, 0xD0, 0x03, 0xB0,
+  0xF0, 0xE0, 0x06, 0xB0, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x05, 0xD0, 0xF0, 0xB0, 0x03, 0x10,
+  0xE0, 0xF0, 0x90, 0x04, 0x60, 0xF1, 0x60, 0x04, 0x70, 0xF1, 0x90, 0x20, 0x00, 0x20, 0x70, 0xF1,
+  0xD0, 0x06, 0x80, 0xF6, 0xC0, 0x20, 0x07, 0x40, 0xA0, 0xD0, 0xF0, 0xE0, 0xB0, 0x60, 0x10, 0x03,
+  0x01, 0xD0, 0xFA, 0x50, 0x03, 0xD0, 0xFA, 0x30, 0x0C, 0xE0, 0xF0, 0xC0, 0x0C, 0x50, 0xF1, 0x60,
+  0x0C, 0xB0, 0xF0, 0xE0, 0x10, 0x0B, 0x20, 0xF1, 0x90, 0x0C, 0x70, 0xF1, 0x40, 0x0C, 0xD0, 0xF0,
+  0xD0, 0x0C, 0x40, 0xF1, 0x70, 0x0C, 0x90, 0xF1, 0x20, 0x0B, 0x10, 0xE0, 0xF0, 0xB0, 0x0C, 0x60,
+  0xF1, 0x50, 0x0C, 0xB0, 0xF0, 0xE0, 0x0C, 0x20, 0xF1, 0x80, 0x0C, 0x80, 0xF1, 0x30, 0x0C, 0xD0,
+  0xF0, 0xC0, 0x0C, 0x40, 0xF1, 0x60, 0x0C, 0xA0, 0xF0, 0xE0, 0x10, 0x0B, 0x10, 0xF1, 0x90, 0x08,
+  0x03, 0x20, 0x90, 0xC0, 0xE0, 0xF0, 0xE0, 0xB0, 0x60, 0x07, 0x60, 0xF7, 0xC0, 0x10, 0x04, 0x30,
+  0xF1, 0xD0, 0x50, 0x20, 0x10, 0x30, 0x90, 0xF1, 0xB0, 0x04, 0x90, 0xF1, 0x30, 0x04, 0xA0, 0xF1,
+  0x20, 0x03, 0xC0, 0xF0, 0xD0, 0x05, 0x50, 0xF1, 0x40, 0x03, 0xA0, 0xF0, 0xD0, 0x05, 0x50, 0xF1,
+  0x30, 0x03, 0x60, 0xF1, 0x30, 0x04, 0xA0, 0xF0, 0xD0, 0x05, 0xB0, 0xF0, 0xD0, 0x50, 0x11, 0x30,
+  0x90, 0xF1, 0x40, 0x06, 0x70, 0xD0, 0xF4, 0xA0, 0x30, 0x06, 0x20, 0x90, 0xE0, 0xF4, 0xC0, 0x60,
+  0x05, 0x30, 0xE0, 0xF0, 0xD0, 0x50, 0x20, 0x10, 0x30, 0x90, 0xF1, 0x90, 0x04, 0xC0, 0xF0, 0xD0,
+  0x10, 0x04, 0x60, 0xF1, 0x50, 0x02, 0x20, 0xF1, 0x70, 0x06, 0xE0, 0xF0, 0xA0, 0x02, 0x30, 0xF1,
+  0x50, 0x06, 0xC0, 0xF0, 0xB0, 0x02, 0x20, 0xF1, 0x70, 0x06, 0xE0, 0xF0, 0xA0, 0x03, 0xE0, 0xF0,
+  0xD0, 0x10, 0x04, 0x60, 0xF1, 0x70, 0x03, 0x70, 0xF1, 0xD0, 0x50, 0x20, 0x10, 0x30, 0x90, 0xF1,
+  0xE0, 0x10, 0x04, 0x90, 0xF7, 0xE0, 0x30, 0x06, 0x40, 0x90, 0xD0, 0xE0, 0xF0, 0xE0, 0xB0, 0x70,
+  0x10, 0x03, 0x03, 0x20, 0x90, 0xD0, 0xE1, 0xC0, 0x80, 0x10, 0x07, 0x60, 0xF6, 0xE0, 0x30, 0x05,
+  0x50, 0xF1, 0xC0, 0x40, 0x11, 0x50, 0xD0, 0xF0, 0xE0, 0x10, 0x04, 0xD0, 0xF0, 0xE0, 0x10, 0x03,
+  0x10, 0xE0, 0xF0, 0x90, 0x03, 0x30, 0xF1, 0x70, 0x05, 0x80, 0xF0, 0xE0, 0x03, 0x50, 0xF1, 0x40,
+  0x05, 0x50, 0xF1, 0x40, 0x02, 0x50, 0xF1, 0x40, 0x05, 0x50, 0xF1, 0x70, 0x02, 0x30, 0xF1, 0x70,
+  0x05, 0x80, 0xF1, 0x90, 0x03, 0xE0, 0xF0, 0xE0, 0x10, 0x03, 0x10, 0xE0, 0xF1, 0xA0, 0x03, 0x60,
+  0xF1, 0xC0, 0x40, 0x11, 0x40, 0xD0, 0xF2, 0xB0, 0x04, 0x80, 0xF6, 0x70, 0xE0, 0xF0, 0xA0, 0x05,
+  0x40, 0xA0, 0xD0, 0xF0, 0xE0, 0xB0, 0x40, 0x10, 0xF1, 0x90, 0x0C, 0x30, 0xF1, 0x60, 0x0C, 0x80,
+  0xF1, 0x20, 0x0B, 0x10, 0xE0, 0xF0, 0xB0, 0x0C, 0xA0, 0xF1, 0x30, 0x04, 0x20, 0xB0, 0x60, 0x20,
+  0x11, 0x40, 0xB0, 0xF1, 0x70, 0x05, 0x20, 0xF7, 0x70, 0x07, 0x40, 0x90, 0xC0, 0xE1, 0xC0, 0x80,
+  0x20, 0x05, 0x02, 0xE0, 0xF0, 0xB0, 0x05, 0xE0, 0xF0, 0xB0, 0x05, 0xE0, 0xF0, 0xB0, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x04, 0xE0, 0xF0, 0xB0, 0x05, 0xE0, 0xF0, 0xB0, 0x05, 0xE0, 0xF0, 0xB0, 0x02, 0x02,
+  0xE0, 0xF0, 0xB0, 0x05, 0xE0, 0xF0, 0xB0, 0x05, 0xE0, 0xF0, 0xB0, 0x0F, 0x0F, 0x0F, 0x0F, 0x04,
+  0xE0, 0xF0, 0xB0, 0x05, 0xE0, 0xF0, 0xB0, 0x04, 0x10, 0xF1, 0x70, 0x04, 0x50, 0xF0, 0xE0, 0x10,
+  0x04, 0x90, 0xF0, 0x70, 0x05, 0xD1, 0x04, 0x0F, 0x10, 0x70, 0xC0, 0x0F, 0x10, 0x50, 0xB0, 0xF2,
+  0x0D, 0x40, 0x90, 0xE0, 0xF2, 0xD0, 0x80, 0x0A, 0x20, 0x80, 0xD0, 0xF2, 0xE0, 0x90, 0x40, 0x09,
+  0x10, 0x60, 0xC0, 0xF3, 0xA0, 0x50, 0x0A, 0x50, 0xB0, 0xF3, 0xB0, 0x60, 0x10, 0x0B, 0x40, 0xF2,
+  0xC0, 0x70, 0x20, 0x0E, 0x40, 0xF2, 0xC0, 0x60, 0x10, 0x0F, 0x50, 0xB0, 0xF3, 0xB0, 0x50, 0x10,
+  0x0E, 0x10, 0x60, 0xC0, 0xF2, 0xE0, 0xA0, 0x40, 0x0F, 0x20, 0x80, 0xD0, 0xF2, 0xE0, 0x90, 0x30,
+  0x0F, 0x40, 0x90, 0xE0, 0xF2, 0xD0, 0x80, 0x0F, 0x10, 0x50, 0xB0, 0xF2, 0x0F, 0x02, 0x10, 0x70,
+  0xC0, 0x0F, 0x08, 0x01, 0x40, 0xFF, 0x04, 0x40, 0xFF, 0x0F, 0x0F, 0x0F, 0x0F, 0x06, 0x40, 0xFF,
+  0x04, 0x40, 0xFF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x01, 0x40, 0xB0, 0x50, 0x10,
+  0x0F, 0x01, 0x40, 0xF1, 0xE0, 0x90, 0x40, 0x0F, 0x10, 0x90, 0xE0, 0xF2, 0xD0, 0x80, 0x30, 0x0F,
+  0x50, 0xA0, 0xF3, 0xC0, 0x70, 0x10, 0x0E, 0x10, 0x60, 0xB0, 0xF3, 0xB0, 0x50, 0x10, 0x0E, 0x20,
+  0x70, 0xC0, 0xF2, 0xE0, 0x90, 0x40, 0x0F, 0x30, 0x80, 0xD0, 0xF2, 0x0F, 0x20, 0x80, 0xD0, 0xF2,
+  0x0C, 0x10, 0x70, 0xC0, 0xF2, 0xE0, 0x90, 0x40, 0x09, 0x10, 0x60, 0xB0, 0xF3, 0xB0, 0x50, 0x10,
+  0x09, 0x50, 0xA0, 0xE0, 0xF2, 0xC0, 0x70, 0x10, 0x09, 0x10, 0x90, 0xE0, 0xF2, 0xD0, 0x80, 0x30,
+  0x0C, 0x40, 0xF1, 0xE0, 0xA0, 0x40, 0x0F, 0x40, 0xB0, 0x50, 0x10, 0x0F, 0x0F, 0x05, 0x02, 0x20,
+  0x80, 0xD0, 0xF0, 0xE0, 0xC0, 0x60, 0x05, 0x70, 0xF6, 0xB0, 0x10, 0x02, 0x20, 0xF0, 0xD0, 0x60,
+  0x20, 0x10, 0x30, 0xB0, 0xF1, 0x80, 0x02, 0x20, 0x80, 0x05, 0xD0, 0xF0, 0xD0, 0x0A, 0xA0, 0xF0,
+  0xE0, 0x0A, 0xC0, 0xF0, 0xC0, 0x09, 0x60, 0xF1, 0x60, 0x08, 0x50, 0xF1, 0xA0, 0x08, 0x60, 0xF1,
+  0xA0, 0x08, 0x40, 0xF1, 0xA0, 0x09, 0xB0, 0xF0, 0xC0, 0x0A, 0xE0, 0xF0, 0x80, 0x0A, 0xE0, 0xF0,
+  0x70, 0x0A, 0xE0, 0xF0, 0x70, 0x0F, 0x0F, 0x06, 0xF1, 0x80, 0x0A, 0xF1, 0x80, 0x0A, 0xF1, 0x80,
+  0x05, 0x07, 0x10, 0x50, 0x90, 0xC0, 0xE0, 0xF0, 0xE0, 0xC0, 0x90, 0x40, 0x0E, 0x60, 0xE0, 0xF8,
+  0xC0, 0x30, 0x0A, 0x20, 0xC0, 0xF1, 0xB0, 0x60, 0x30, 0x10, 0x00, 0x20, 0x30, 0x80, 0xD0, 0xF1,
+  0x80, 0x08, 0x20, 0xE0, 0xF0, 0xC0, 0x30, 0x08, 0x60, 0xE0, 0xF0, 0x80, 0x06, 0x10, 0xD0, 0xF0,
+  0xA0, 0x0B, 0x30, 0xE0, 0xF0, 0x70, 0x05, 0x90, 0xF0, 0xA0, 0x0D, 0x20, 0xE1, 0x20, 0x03, 0x20,
+  0xF0, 0xD0, 0x10, 0x02, 0x10, 0x80, 0xD0, 0xF0, 0xD0, 0x90, 0x20, 0x60, 0xF0, 0x60, 0x01, 0x70,
+  0xF0, 0x80, 0x03, 0x80, 0xF0, 0x60, 0x02, 0x10, 0xD0, 0xF4, 0xE0, 0x80, 0xF0, 0x60, 0x01, 0x10,
+  0xF0, 0xD0, 0x03, 0xD0, 0xE0, 0x03, 0xA0, 0xF0, 0xE0, 0x50, 0x11, 0x50, 0xD0, 0xF1, 0x60, 0x02,
+  0xC0, 0xF0, 0x10, 0x01, 0x10, 0xF0, 0xB0, 0x02, 0x10, 0xF1, 0x40, 0x03, 0x30, 0xF1, 0x60, 0x02,
+  0xA0, 0xF0, 0x20, 0x01, 0x30, 0xF0, 0x80, 0x02, 0x40, 0xF0, 0xC0, 0x05, 0xB0, 0xF0, 0x60, 0x02,
+  0xA0, 0xF0, 0x20, 0x01, 0x40, 0xF0, 0x80, 0x02, 0x50, 0xF0, 0xB0, 0x05, 0xA0, 0xF0, 0x60, 0x02,
+  0xD0, 0xF0, 0x10, 0x01, 0x30, 0xF0, 0x90, 0x02, 0x40, 0xF0, 0xC0, 0x05, 0xB0, 0xF0, 0x60, 0x01,
+  0x30, 0xF0, 0xB0, 0x02, 0x10, 0xF0, 0xB0, 0x02, 0x10, 0xF1, 0x30, 0x03, 0x30, 0xF1, 0x60, 0x00,
+  0x10, 0xC0, 0xF0, 0x50, 0x03, 0xD0, 0xE0, 0x03, 0xA0, 0xF0, 0xE0, 0x50, 0x11, 0x50, 0xD0, 0xF1,
+  0x70, 0x50, 0xC0, 0xF0, 0x90, 0x04, 0x90, 0xF0, 0x50, 0x02, 0x10, 0xD0, 0xF4, 0xE0, 0x80, 0xF3,
+  0x80, 0x05, 0x30, 0xF0, 0xD0, 0x03, 0x10, 0x80, 0xD0, 0xF0, 0xE0, 0x90, 0x20, 0x60, 0xE0, 0xC0,
+  0x80, 0x20, 0x07, 0xA0, 0xF0, 0xA0, 0x0F, 0x06, 0x10, 0xD0, 0xF0, 0x80, 0x0F, 0x06, 0x30, 0xE0,
+  0xF0, 0xB0, 0x20, 0x07, 0x10, 0x80, 0xB0, 0x10, 0x09, 0x20, 0xD0, 0xF1, 0xA0, 0x60, 0x20, 0x10,
+  0x00, 0x20, 0x40, 0x90, 0xE0, 0xF0, 0xB0, 0x10, 0x0A, 0x10, 0x80, 0xE0, 0xF7, 0xE0, 0x60, 0x0E,
+  0x10, 0x60, 0xA0, 0xD0, 0xE0, 0xF0, 0xD0, 0xA0, 0x60, 0x10, 0x07, 0x06, 0xB0, 0xF1, 0x80, 0x0C,
+  0x20, 0xF2, 0xE0, 0x0C, 0x80, 0xF0, 0xE0, 0xF1, 0x40, 0x0B, 0xD0, 0xF0, 0x80, 0xB0, 0xF0, 0xA0,
+  0x0A, 0x40, 0xF1, 0x20, 0x60, 0xF1, 0x10, 0x09, 0xA0, 0xF0, 0xC0, 0x00, 0x10, 0xE0, 0xF0, 0x70,
+  0x08, 0x10, 0xF1, 0x60, 0x01, 0xA0, 0xF0, 0xC0, 0x08, 0x60, 0xF1, 0x10, 0x01, 0x40, 0xF1, 0x30,
+  0x07, 0xC0, 0xF0, 0xA0, 0x03, 0xE0, 0xF0, 0x90, 0x06, 0x30, 0xF1, 0x50, 0x03, 0x80, 0xF0, 0xE0,
+  0x06, 0x80, 0xF0, 0xE0, 0x04, 0x30, 0xF1, 0x50, 0x05, 0xE0, 0xF0, 0x90, 0x05, 0xC0, 0xF0, 0xB0,
+  0x04, 0x50, 0xFB, 0x20, 0x03, 0xB0, 0xFB, 0x70, 0x02, 0x10, 0xF1, 0x70, 0x07, 0xA0, 0xF0, 0xD0,
+  0x02, 0x70, 0xF1, 0x20, 0x07, 0x50, 0xF1, 0x40, 0x01, 0xD0, 0xF0, 0xC0, 0x09, 0xE0, 0xF0, 0x90,
+  0x00, 0x30, 0xF1, 0x60, 0x09, 0x90, 0xF0, 0xE0, 0x10, 0x90, 0xF1, 0x10, 0x09, 0x40, 0xF1, 0x60,
+  0x01, 0x70, 0xF6, 0xE0, 0xB0, 0x60, 0x06, 0x70, 0xF9, 0xC0, 0x10, 0x04, 0x70, 0xF1, 0x20, 0x02,
+  0x10, 0x30, 0xA0, 0xF1, 0xA0, 0x04, 0x70, 0xF1, 0x20, 0x05, 0xB0, 0xF1, 0x10, 0x03, 0x70, 0xF1,
+  0x20, 0x05, 0x70, 0xF1, 0x30, 0x03, 0x70, 0xF1, 0x20, 0x05, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1,
+  0x20, 0x05, 0xB0, 0xF0, 0xD0, 0x04, 0x70, 0xF1, 0x20, 0x02, 0x10, 0x30, 0xA0, 0xF1, 0x60, 0x04,
+  0x70, 0xF8, 0xB0, 0x40, 0x05, 0x70, 0xF8, 0xE0, 0x80, 0x05, 0x70, 0xF1, 0x20, 0x03, 0x20, 0x60,
+  0xE0, 0xF0, 0xC0, 0x10, 0x03, 0x70, 0xF1, 0x20, 0x05, 0x40, 0xF1, 0x80, 0x03, 0x70, 0xF1, 0x20,
+  0x06, 0xD0, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x20, 0x06, 0xB0, 0xF1, 0x03, 0x70, 0xF1, 0x20, 0x06,
+  0xD0, 0xF0, 0xE0, 0x03, 0x70, 0xF1, 0x20, 0x05, 0x40, 0xF1, 0xB0, 0x03, 0x70, 0xF1, 0x20, 0x03,
+  0x20, 0x60, 0xE0, 0xF1, 0x40, 0x03, 0x70, 0xFA, 0x60, 0x04, 0x70, 0xF6, 0xE0, 0xC0, 0x80, 0x20,
+  0x03, 0x05, 0x30, 0x80, 0xC0, 0xE0, 0xF0, 0xE0, 0xD0, 0x90, 0x40, 0x06, 0x10, 0xA0, 0xF8, 0xC0,
+  0x30, 0x03, 0x20, 0xD0, 0xF1, 0xB0, 0x50, 0x20, 0x00, 0x10, 0x30, 0x90, 0xE0, 0xF0, 0xB0, 0x03,
+  0xC0, 0xF1, 0x60, 0x06, 0x20, 0xB1, 0x02, 0x60, 0xF1, 0x70, 0x09, 0x70, 0x02, 0xD0, 0xF0, 0xE0,
+  0x0D, 0x30, 0xF1, 0x80, 0x0D, 0x60, 0xF1, 0x50, 0x0D, 0x70, 0xF1, 0x30, 0x0D, 0x80, 0xF1, 0x30,
+  0x0D, 0x70, 0xF1, 0x30, 0x0D, 0x60, 0xF1, 0x50, 0x0D, 0x30, 0xF1, 0x80, 0x0E, 0xD0, 0xF0, 0xE0,
+  0x0E, 0x60, 0xF1, 0x70, 0x09, 0x70, 0x03, 0xC0, 0xF1, 0x60, 0x06, 0x20, 0xB1, 0x03, 0x20, 0xD0,
+  0xF1, 0xB0, 0x50, 0x20, 0x00, 0x10, 0x30, 0x80, 0xE0, 0xF0, 0xB0, 0x04, 0x10, 0xA0, 0xF8, 0xC0,
+  0x30, 0x06, 0x30, 0x80, 0xC0, 0xE0, 0xF0, 0xE0, 0xC0, 0x90, 0x40, 0x02, 0x01, 0x70, 0xF4, 0xE1,
+  0xC0, 0xA0, 0x60, 0x10, 0x07, 0x70, 0xFA, 0xA0, 0x10, 0x05, 0x70, 0xF1, 0x20, 0x02, 0x10, 0x30,
+  0x70, 0xD0, 0xF1, 0xE0, 0x20, 0x04, 0x70, 0xF1, 0x20, 0x06, 0x70, 0xF1, 0xD0, 0x10, 0x03, 0x70,
+  0xF1, 0x20, 0x07, 0x80, 0xF1, 0x70, 0x03, 0x70, 0xF1, 0x20, 0x07, 0x10, 0xE0, 0xF0, 0xD0, 0x03,
+  0x70, 0xF1, 0x20, 0x08, 0x90, 0xF1, 0x20, 0x02, 0x70, 0xF1, 0x20, 0x08, 0x60, 0xF1, 0x50, 0x02,
+  0x70, 0xF1, 0x20, 0x08, 0x40, 0xF1, 0x60, 0x02, 0x70, 0xF1, 0x20, 0x08, 0x40, 0xF1, 0x70, 0x02,
+  0x70, 0xF1, 0x20, 0x08, 0x40, 0xF1, 0x60, 0x02, 0x70, 0xF1, 0x20, 0x08, 0x60, 0xF1, 0x50, 0x02,
+  0x70, 0xF1, 0x20, 0x08, 0x90, 0xF1, 0x20, 0x02, 0x70, 0xF1, 0x20, 0x07, 0x10, 0xE0, 0xF0, 0xD0,
+  0x03, 0x70, 0xF1, 0x20, 0x07, 0x80, 0xF1, 0x70, 0x03, 0x70, 0xF1, 0x20, 0x06, 0x70, 0xF1, 0xD0,
+  0x10, 0x03, 0x70, 0xF1, 0x20, 0x02, 0x10, 0x30, 0x70, 0xD0, 0xF1, 0xD0, 0x20, 0x04, 0x70, 0xFA,
+  0x90, 0x10, 0x05, 0x70, 0xF5, 0xE0, 0xC0, 0xA0, 0x60, 0x10, 0x05, 0x01, 0x70, 0xFA, 0x80, 0x02,
+  0x70, 0xFA, 0x80, 0x02, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B,
+  0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xFA, 0x20, 0x02,
+  0x70, 0xFA, 0x20, 0x02, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B,
+  0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B,
+  0x70, 0xFA, 0xC0, 0x02, 0x70, 0xFA, 0xC0, 0x00, 0x01, 0x70, 0xF9, 0x70, 0x02, 0x70, 0xF9, 0x70,
+  0x02, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20,
+  0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xF8, 0x90, 0x03, 0x70, 0xF8, 0x90,
+  0x03, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20,
+  0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20,
+  0x0A, 0x70, 0xF1, 0x20, 0x08, 0x05, 0x20, 0x80, 0xB0, 0xD0, 0xF0, 0xE0, 0xD0, 0xA0, 0x70, 0x10,
+  0x07, 0x10, 0xA0, 0xF9, 0x90, 0x10, 0x04, 0x20, 0xD0, 0xF1, 0xB0, 0x60, 0x20, 0x11, 0x20, 0x60,
+  0xC0, 0xF1, 0x80, 0x04, 0xC0, 0xF1, 0x60, 0x07, 0x60, 0xE0, 0x80, 0x03, 0x70, 0xF1, 0x70, 0x09,
+  0x20, 0x60, 0x03, 0xD0, 0xF0, 0xD0, 0x0F, 0x30, 0xF1, 0x80, 0x0F, 0x60, 0xF1, 0x50, 0x0F, 0x70,
+  0xF1, 0x30, 0x0F, 0x80, 0xF1, 0x30, 0x05, 0xB0, 0xF5, 0x02, 0x70, 0xF1, 0x30, 0x05, 0xB0, 0xF5,
+  0x02, 0x60, 0xF1, 0x50, 0x09, 0x80, 0xF1, 0x02, 0x30, 0xF1, 0x80, 0x09, 0x80, 0xF1, 0x03, 0xD0,
+  0xF0, 0xD0, 0x09, 0x80, 0xF1, 0x03, 0x70, 0xF1, 0x70, 0x08, 0x80, 0xF1, 0x04, 0xC0, 0xF1, 0x60,
+  0x07, 0x80, 0xF1, 0x04, 0x20, 0xD0, 0xF1, 0xB0, 0x50, 0x20, 0x10, 0x00, 0x10, 0x40, 0x90, 0xE0,
+  0xF1, 0x05, 0x10, 0xA0, 0xF9, 0xC0, 0x40, 0x07, 0x20, 0x80, 0xB0, 0xD0, 0xF0, 0xE0, 0xD0, 0xB0,
+  0x80, 0x30, 0x03, 0x01, 0x70, 0xF1, 0x20, 0x07, 0x80, 0xF1, 0x04, 0x70, 0xF1, 0x20, 0x07, 0x80,
+  0xF1, 0x04, 0x70, 0xF1, 0x20, 0x07, 0x80, 0xF1, 0x04, 0x70, 0xF1, 0x20, 0x07, 0x80, 0xF1, 0x04,
+  0x70, 0xF1, 0x20, 0x07, 0x80, 0xF1, 0x04, 0x70, 0xF1, 0x20, 0x07, 0x80, 0xF1, 0x04, 0x70, 0xF1,
+  0x20, 0x07, 0x80, 0xF1, 0x04, 0x70, 0xF1, 0x20, 0x07, 0x80, 0xF1, 0x04, 0x70, 0xFD, 0x04, 0x70,
+  0xFD, 0x04, 0x70, 0xF1, 0x20, 0x07, 0x80, 0xF1, 0x04, 0x70, 0xF1, 0x20, 0x07, 0x80, 0xF1, 0x04,
+  0x70, 0xF1, 0x20, 0x07, 0x80, 0xF1, 0x04, 0x70, 0xF1, 0x20, 0x07, 0x80, 0xF1, 0x04, 0x70, 0xF1,
+  0x20, 0x07, 0x80, 0xF1, 0x04, 0x70, 0xF1, 0x20, 0x07, 0x80, 0xF1, 0x04, 0x70, 0xF1, 0x20, 0x07,
+  0x80, 0xF1, 0x04, 0x70, 0xF1, 0x20, 0x07, 0x80, 0xF1, 0x04, 0x70, 0xF1, 0x20, 0x07, 0x80, 0xF1,
+  0x02, 0x01, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1,
+  0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1,
+  0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1,
+  0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1,
+  0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x01, 0x03, 0x70,
+  0xF1, 0x20, 0x05, 0x70, 0xF1, 0x20, 0x05, 0x70, 0xF1, 0x20, 0x05, 0x70, 0xF1, 0x20, 0x05, 0x70,
+  0xF1, 0x20, 0x05, 0x70, 0xF1, 0x20, 0x05, 0x70, 0xF1, 0x20, 0x05, 0x70, 0xF1, 0x20, 0x05, 0x70,
+  0xF1, 0x20, 0x05, 0x70, 0xF1, 0x20, 0x05, 0x70, 0xF1, 0x20, 0x05, 0x70, 0xF1, 0x20, 0x05, 0x70,
+  0xF1, 0x20, 0x05, 0x70, 0xF1, 0x20, 0x05, 0x70, 0xF1, 0x20, 0x05, 0x70, 0xF1, 0x20, 0x05, 0x70,
+  0xF1, 0x20, 0x05, 0x70, 0xF1, 0x20, 0x05, 0x70, 0xF1, 0x10, 0x05, 0x90, 0xF0, 0xE0, 0x06, 0xD0,
+  0xF0, 0xB0, 0x04, 0x20, 0xA0, 0xF1, 0x60, 0x02, 0x50, 0xF3, 0xB0, 0x03, 0x50, 0xF0, 0xE0, 0xC0,
+  0x60, 0x04, 0x01, 0x70, 0xF1, 0x20, 0x05, 0x10, 0xC0, 0xF1, 0x60, 0x02, 0x70, 0xF1, 0x20, 0x04,
+  0x20, 0xD0, 0xF1, 0x50, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x20, 0xD0, 0xF1, 0x40, 0x04, 0x70, 0xF1,
+  0x20, 0x02, 0x30, 0xE0, 0xF0, 0xE0, 0x40, 0x05, 0x70, 0xF1, 0x20, 0x01, 0x30, 0xE0, 0xF0, 0xE0,
+  0x30, 0x06, 0x70, 0xF1, 0x20, 0x00, 0x40, 0xE0, 0xF0, 0xE0, 0x30, 0x07, 0x70, 0xF1, 0x20, 0x40,
+  0xF1, 0xD0, 0x20, 0x08, 0x70, 0xF1, 0x70, 0xF1, 0xD0, 0x20, 0x09, 0x70, 0xF3, 0xC0, 0x10, 0x0A,
+  0x70, 0xF3, 0xE0, 0x30, 0x0A, 0x70, 0xF1, 0x60, 0xF1, 0xE0, 0x30, 0x09, 0x70, 0xF1, 0x20, 0x40,
+  0xF1, 0xE0, 0x30, 0x08, 0x70, 0xF1, 0x20, 0x00, 0x40, 0xF1, 0xE0, 0x30, 0x07, 0x70, 0xF1, 0x20,
+  0x01, 0x40, 0xF1, 0xE0, 0x30, 0x06, 0x70, 0xF1, 0x20, 0x02, 0x40, 0xF1, 0xE0, 0x30, 0x05, 0x70,
+  0xF1, 0x20, 0x03, 0x40, 0xF1, 0xE0, 0x30, 0x04, 0x70, 0xF1, 0x20, 0x04, 0x40, 0xF1, 0xE0, 0x30,
+  0x03, 0x70, 0xF1, 0x20, 0x05, 0x40, 0xF1, 0xE0, 0x30, 0x02, 0x70, 0xF1, 0x20, 0x06, 0x50, 0xF1,
+  0xE0, 0x30, 0x01, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70,
+  0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70,
+  0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70,
+  0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70,
+  0xF1, 0x20, 0x0A, 0x70, 0xF1, 0x20, 0x0A, 0x70, 0xFA, 0x50, 0x01, 0x70, 0xFA, 0x50, 0x01, 0x70,
+  0xF2, 0x80, 0x07, 0x20, 0xF2, 0xD0, 0x03, 0x70, 0xF2, 0xE0, 0x07, 0x80, 0xF2, 0xD0, 0x03, 0x70,
+  0xF1, 0xD0, 0xF0, 0x50, 0x06, 0xD0, 0xF0, 0xD0, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x80, 0xF0, 0xB0,
+  0x05, 0x40, 0xF0, 0xE0, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x20, 0xF1, 0x20, 0x04, 0xA0, 0xF0,
+  0x80, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0xB0, 0xF0, 0x70, 0x03, 0x10, 0xF1, 0x20, 0x90,
+  0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x50, 0xF0, 0xD0, 0x03, 0x60, 0xF0, 0xB0, 0x00, 0x90, 0xF0,
+  0xD0, 0x03, 0x70, 0xF1, 0x10, 0x00, 0xE0, 0xF0, 0x40, 0x02, 0xC0, 0xF0, 0x60, 0x00, 0x90, 0xF0,
+  0xD0, 0x03, 0x70, 0xF1, 0x10, 0x00, 0x90, 0xF0, 0x90, 0x01, 0x30, 0xF0, 0xE0, 0x10, 0x00, 0x90,
+  0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x00, 0x30, 0xF0, 0xE0, 0x10, 0x00, 0x90, 0xF0, 0x90, 0x01,
+  0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x01, 0xC0, 0xF0, 0x60, 0x10, 0xE0, 0xF0, 0x30, 0x01,
+  0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x01, 0x60, 0xF0, 0xC0, 0x50, 0xF0, 0xD0, 0x02, 0x90,
+  0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x01, 0x10, 0xF1, 0xD0, 0xF0, 0x70, 0x02, 0x90, 0xF0, 0xD0,
+  0x03, 0x70, 0xF1, 0x10, 0x02, 0xA0, 0xF2, 0x10, 0x02, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10,
+  0x02, 0x40, 0xF1, 0xA0, 0x03, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x0A, 0x90, 0xF0, 0xD0,
+  0x03, 0x70, 0xF1, 0x10, 0x0A, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x0A, 0x90, 0xF0, 0xD0,
+  0x03, 0x70, 0xF1, 0x10, 0x0A, 0x90, 0xF0, 0xD0, 0x01, 0x01, 0x70, 0xF2, 0x40, 0x06, 0x90, 0xF0,
+  0xD0, 0x03, 0x70, 0xF2, 0xC0, 0x06, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF3, 0x50, 0x05, 0x90, 0xF0,
+  0xD0, 0x03, 0x70, 0xF1, 0xC0, 0xF0, 0xD0, 0x05, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x40, 0xF1,
+  0x60, 0x04, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0xA0, 0xF0, 0xD0, 0x04, 0x90, 0xF0, 0xD0,
+  0x03, 0x70, 0xF1, 0x10, 0x30, 0xF1, 0x70, 0x03, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x00,
+  0xA0, 0xF0, 0xE0, 0x10, 0x02, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x00, 0x20, 0xF1, 0x70,
+  0x02, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x01, 0x90, 0xF0, 0xE0, 0x10, 0x01, 0x90, 0xF0,
+  0xD0, 0x03, 0x70, 0xF1, 0x10, 0x01, 0x10, 0xE0, 0xF0, 0x80, 0x01, 0x90, 0xF0, 0xD0, 0x03, 0x70,
+  0xF1, 0x10, 0x02, 0x80, 0xF1, 0x20, 0x00, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x02, 0x10,
+  0xE0, 0xF0, 0x90, 0x00, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x03, 0x70, 0xF1, 0x20, 0x90,
+  0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x03, 0x10, 0xE0, 0xF0, 0xA0, 0x90, 0xF0, 0xD0, 0x03, 0x70,
+  0xF1, 0x10, 0x04, 0x60, 0xF1, 0xC0, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x05, 0xD0, 0xF2, 0xD0,
+  0x03, 0x70, 0xF1, 0x10, 0x05, 0x50, 0xF2, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x06, 0xC0, 0xF1, 0xD0,
+  0x01, 0x05, 0x40, 0x90, 0xD0, 0xE0, 0xF0, 0xD0, 0xB0, 0x70, 0x10, 0x08, 0x20, 0xB0, 0xF7, 0xE0,
+  0x60, 0x06, 0x20, 0xD0, 0xF1, 0xA0, 0x40, 0x10, 0x00, 0x20, 0x70, 0xE0, 0xF1, 0x70, 0x05, 0xC0,
+  0xF1, 0x50, 0x05, 0x10, 0xC0, 0xF1, 0x40, 0x03, 0x70, 0xF1, 0x70, 0x07, 0x10, 0xE0, 0xF0, 0xD0,
+  0x03, 0xD0, 0xF0, 0xE0, 0x09, 0x70, 0xF1, 0x50, 0x01, 0x30, 0xF1, 0x90, 0x09, 0x20, 0xF1, 0x90,
+  0x01, 0x60, 0xF1, 0x50, 0x0A, 0xD0, 0xF0, 0xD0, 0x01, 0x70, 0xF1, 0x30, 0x0A, 0xC0, 0xF0, 0xE0,
+  0x01, 0x80, 0xF1, 0x30, 0x0A, 0xB0, 0xF1, 0x01, 0x70, 0xF1, 0x30, 0x0A, 0xC0, 0xF0, 0xE0, 0x01,
+  0x60, 0xF1, 0x50, 0x0A, 0xD0, 0xF0, 0xD0, 0x01, 0x30, 0xF1, 0x90, 0x09, 0x20, 0xF1, 0x90, 0x02,
+  0xD0, 0xF0, 0xE0, 0x09, 0x70, 0xF1, 0x50, 0x02, 0x70, 0xF1, 0x70, 0x07, 0x10, 0xE0, 0xF0, 0xD0,
+  0x04, 0xC0, 0xF1, 0x50, 0x05, 0x10, 0xC0, 0xF1, 0x50, 0x04, 0x20, 0xD0, 0xF1, 0xA0, 0x40, 0x10,
+  0x00, 0x20, 0x70, 0xE0, 0xF1, 0x70, 0x06, 0x20, 0xB0, 0xF7, 0xE0, 0x60, 0x09, 0x40, 0x90, 0xD0,
+  0xE0, 0xF0, 0xD0, 0xB0, 0x70, 0x10, 0x04, 0x01, 0x70, 0xF5, 0xE0, 0xC0, 0x80, 0x10, 0x04, 0x70,
+  0xF8, 0xE0, 0x40, 0x03, 0x70, 0xF1, 0x20, 0x02, 0x30, 0x80, 0xF1, 0xE0, 0x10, 0x02, 0x70, 0xF1,
+  0x20, 0x04, 0x80, 0xF1, 0x70, 0x02, 0x70, 0xF1, 0x20, 0x04, 0x10, 0xF1, 0xB0, 0x02, 0x70, 0xF1,
+  0x20, 0x05, 0xE0, 0xF0, 0xC0, 0x02, 0x70, 0xF1, 0x20, 0x04, 0x10, 0xF1, 0xB0, 0x02, 0x70, 0xF1,
+  0x20, 0x04, 0x70, 0xF1, 0x70, 0x02, 0x70, 0xF1, 0x20, 0x02, 0x20, 0x80, 0xF1, 0xE0, 0x10, 0x02,
+  0x70, 0xF8, 0xE0, 0x40, 0x03, 0x70, 0xF5, 0xE0, 0xC0, 0x80, 0x10, 0x04, 0x70, 0xF1, 0x20, 0x0B,
+  0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B,
+  0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x09, 0x05, 0x40, 0x90, 0xD0,
+  0xE0, 0xF0, 0xD0, 0xB0, 0x70, 0x10, 0x08, 0x20, 0xB0, 0xF7, 0xE0, 0x60, 0x06, 0x20, 0xD0, 0xF1,
+  0xA0, 0x40, 0x10, 0x00, 0x20, 0x70, 0xE0, 0xF1, 0x70, 0x05, 0xC0, 0xF1, 0x50, 0x05, 0x10, 0xC0,
+  0xF1, 0x40, 0x03, 0x70, 0xF1, 0x70, 0x07, 0x10, 0xE0, 0xF0, 0xD0, 0x03, 0xD0, 0xF0, 0xE0, 0x09,
+  0x70, 0xF1, 0x50, 0x01, 0x30, 0xF1, 0x90, 0x09, 0x20, 0xF1, 0x90, 0x01, 0x60, 0xF1, 0x50, 0x0A,
+  0xD0, 0xF0, 0xD0, 0x01, 0x70, 0xF1, 0x30, 0x0A, 0xC0, 0xF0, 0xE0, 0x01, 0x80, 0xF1, 0x30, 0x0A,
+  0xB0, 0xF1, 0x01, 0x70, 0xF1, 0x30, 0x0A, 0xC0, 0xF0, 0xE0, 0x01, 0x60, 0xF1, 0x50, 0x0A, 0xD0,
+  0xF0, 0xD0, 0x01, 0x30, 0xF1, 0x90, 0x09, 0x20, 0xF1, 0xA0, 0x02, 0xD0, 0xF0, 0xE0, 0x09, 0x70,
+  0xF1, 0x50, 0x02, 0x70, 0xF1, 0x70, 0x07, 0x10, 0xE0, 0xF0, 0xD0, 0x04, 0xC0, 0xF1, 0x50, 0x05,
+  0x10, 0xC0, 0xF1, 0x50, 0x04, 0x20, 0xD0, 0xF1, 0xA0, 0x40, 0x10, 0x00, 0x20, 0x70, 0xE0, 0xF1,
+  0x70, 0x06, 0x20, 0xB0, 0xF7, 0xE0, 0x50, 0x09, 0x40, 0x90, 0xD0, 0xE0, 0xF3, 0x30, 0x0F, 0x40,
+  0xF1, 0xD0, 0x10, 0x0F, 0x50, 0xF1, 0xC0, 0x10, 0x0F, 0x50, 0xF1, 0xB0, 0x02, 0x01, 0x70, 0xF5,
+  0xE0, 0xC0, 0x80, 0x20, 0x06, 0x70, 0xF8, 0xE0, 0x50, 0x05, 0x70, 0xF1, 0x20, 0x02, 0x20, 0x80,
+  0xF1, 0xE0, 0x20, 0x04, 0x70, 0xF1, 0x20, 0x04, 0x70, 0xF1, 0x70, 0x04, 0x70, 0xF1, 0x20, 0x04,
+  0x10, 0xF1, 0xB0, 0x04, 0x70, 0xF1, 0x20, 0x05, 0xE0, 0xF0, 0xC0, 0x04, 0x70, 0xF1, 0x20, 0x04,
+  0x10, 0xF1, 0xA0, 0x04, 0x70, 0xF1, 0x20, 0x04, 0x70, 0xF1, 0x60, 0x04, 0x70, 0xF1, 0x20, 0x02,
+  0x20, 0x80, 0xF1, 0xD0, 0x10, 0x04, 0x70, 0xF8, 0xB0, 0x20, 0x05, 0x70, 0xF7, 0xD0, 0x40, 0x06,
+  0x70, 0xF1, 0x20, 0x01, 0x10, 0x40, 0xC0, 0xF1, 0x40, 0x05, 0x70, 0xF1, 0x20, 0x03, 0x10, 0xC0,
+  0xF0, 0xE0, 0x10, 0x04, 0x70, 0xF1, 0x20, 0x04, 0x30, 0xF1, 0x80, 0x04, 0x70, 0xF1, 0x20, 0x05,
+  0xA0, 0xF0, 0xE0, 0x10, 0x03, 0x70, 0xF1, 0x20, 0x05, 0x30, 0xF1, 0x80, 0x03, 0x70, 0xF1, 0x20,
+  0x06, 0xA0, 0xF0, 0xE0, 0x10, 0x02, 0x70, 0xF1, 0x20, 0x06, 0x30, 0xF1, 0x80, 0x02, 0x70, 0xF1,
+  0x20, 0x07, 0xA0, 0xF0, 0xE0, 0x10, 0x03, 0x30, 0x90, 0xC0, 0xE0, 0xF0, 0xD0, 0xC0, 0xA0, 0x60,
+  0x20, 0x05, 0x80, 0xF8, 0xE0, 0x04, 0x70, 0xF1, 0xC0, 0x50, 0x20, 0x00, 0x10, 0x50, 0xA0, 0xF0,
+  0xE0, 0x04, 0xE0, 0xF0, 0xC0, 0x06, 0x20, 0xA0, 0x03, 0x30, 0xF1, 0x60, 0x0C, 0x40, 0xF1, 0x50,
+  0x0C, 0x20, 0xF1, 0xA0, 0x0D, 0xC0, 0xF1, 0x90, 0x30, 0x0B, 0x20, 0xD0, 0xF2, 0xE0, 0xB0, 0x80,
+  0x50, 0x10, 0x07, 0x10, 0x80, 0xE0, 0xF4, 0xE0, 0x80, 0x10, 0x08, 0x30, 0x60, 0x90, 0xC0, 0xF2,
+  0xC0, 0x10, 0x0B, 0x20, 0xB0, 0xF1, 0x90, 0x0C, 0x10, 0xE0, 0xF0, 0xE0, 0x0D, 0xA0, 0xF1, 0x10,
+  0x0C, 0xB0, 0xF1, 0x02, 0x30, 0x90, 0x10, 0x06, 0x30, 0xF1, 0xB0, 0x02, 0x30, 0xF1, 0xA0, 0x50,
+  0x20, 0x00, 0x10, 0x30, 0x80, 0xE0, 0xF1, 0x40, 0x02, 0x30, 0xF9, 0xE0, 0x60, 0x04, 0x30, 0x60,
+  0xA0, 0xC0, 0xD0, 0xF1, 0xE0, 0xB0, 0x70, 0x20, 0x03, 0x10, 0xFE, 0xE0, 0x10, 0xFE, 0xE0, 0x06,
+  0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C,
+  0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C,
+  0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C,
+  0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C,
+  0x50, 0xF1, 0x40, 0x05, 0x01, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0,
+  0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0,
+  0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0,
+  0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0,
+  0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0,
+  0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0,
+  0x08, 0xC0, 0xF0, 0xB0, 0x03, 0xA0, 0xF0, 0xE0, 0x08, 0xD0, 0xF0, 0xB0, 0x03, 0x90, 0xF1, 0x10,
+  0x07, 0xF1, 0x90, 0x03, 0x50, 0xF1, 0x50, 0x06, 0x40, 0xF1, 0x60, 0x03, 0x10, 0xE0, 0xF0, 0xC0,
+  0x10, 0x05, 0xC0, 0xF0, 0xE0, 0x10, 0x04, 0x60, 0xF1, 0xC0, 0x50, 0x10, 0x00, 0x10, 0x50, 0xC0,
+  0xF1, 0x60, 0x06, 0x70, 0xF8, 0x70, 0x08, 0x20, 0x80, 0xC0, 0xE0, 0xF0, 0xE0, 0xC0, 0x80, 0x20,
+  0x04, 0x90, 0xF1, 0x10, 0x09, 0x40, 0xF1, 0x60, 0x30, 0xF1, 0x70, 0x09, 0xA0, 0xF0, 0xE0, 0x10,
+  0x00, 0xD0, 0xF0, 0xC0, 0x08, 0x10, 0xF1, 0x90, 0x01, 0x70, 0xF1, 0x30, 0x07, 0x60, 0xF1, 0x40,
+  0x01, 0x10, 0xF1, 0x80, 0x07, 0xC0, 0xF0, 0xD0, 0x03, 0xB0, 0xF0, 0xE0, 0x06, 0x20, 0xF1, 0x70,
+  0x03, 0x50, 0xF1, 0x50, 0x05, 0x80, 0xF1, 0x20, 0x04, 0xE0, 0xF0, 0xA0, 0x05, 0xE0, 0xF0, 0xB0,
+  0x05, 0x80, 0xF1, 0x10, 0x03, 0x40, 0xF1, 0x50, 0x05, 0x30, 0xF1, 0x70, 0x03, 0xA0, 0xF0, 0xE0,
+  0x07, 0xC0, 0xF0, 0xC0, 0x02, 0x10, 0xF1, 0x90, 0x07, 0x60, 0xF1, 0x30, 0x01, 0x60, 0xF1, 0x30,
+  0x07, 0x10, 0xF1, 0x90, 0x01, 0xC0, 0xF0, 0xC0, 0x09, 0xA0, 0xF0, 0xE0, 0x00, 0x30, 0xF1, 0x70,
+  0x09, 0x40, 0xF1, 0x50, 0x80, 0xF1, 0x10, 0x0A, 0xD0, 0xF0, 0xB0, 0xE0, 0xF0, 0xA0, 0x0B, 0x80,
+  0xF3, 0x40, 0x0B, 0x20, 0xF2, 0xE0, 0x0D, 0xB0, 0xF1, 0x80, 0x06, 0x10, 0xF1, 0x90, 0x06, 0xB0,
+  0xF1, 0x60, 0x06, 0xD0, 0xF0, 0xB0, 0x01, 0xC0, 0xF0, 0xC0, 0x06, 0xE0, 0xF1, 0xA0, 0x05, 0x20,
+  0xF1, 0x70, 0x01, 0x80, 0xF1, 0x10, 0x04, 0x30, 0xF0, 0xE0, 0xF0, 0xE0, 0x05, 0x60, 0xF1, 0x30,
+  0x01, 0x40, 0xF1, 0x50, 0x04, 0x70, 0xF0, 0x90, 0xD0, 0xF0, 0x20, 0x04, 0x90, 0xF0, 0xE0, 0x02,
+  0x10, 0xF1, 0x90, 0x04, 0xB0, 0xF0, 0x60, 0xA0, 0xF0, 0x60, 0x04, 0xD0, 0xF0, 0xB0, 0x03, 0xC0,
+  0xF0, 0xC0, 0x04, 0xE0, 0xF0, 0x20, 0x60, 0xF0, 0xA0, 0x03, 0x20, 0xF1, 0x70, 0x03, 0x80, 0xF1,
+  0x10, 0x02, 0x30, 0xF0, 0xD0, 0x00, 0x20, 0xF0, 0xE0, 0x03, 0x50, 0xF1, 0x30, 0x03, 0x40, 0xF1,
+  0x50, 0x02, 0x70, 0xF0, 0xA0, 0x01, 0xE0, 0xF0, 0x20, 0x02, 0x90, 0xF0, 0xE0, 0x04, 0x10, 0xF1,
+  0x80, 0x02, 0xA0, 0xF0, 0x60, 0x01, 0xA0, 0xF0, 0x60, 0x02, 0xD0, 0xF0, 0xB0, 0x05, 0xC0, 0xF0,
+  0xC0, 0x02, 0xE0, 0xF0, 0x20, 0x01, 0x60, 0xF0, 0xA0, 0x01, 0x10, 0xF1, 0x70, 0x05, 0x80, 0xF1,
+  0x10, 0x00, 0x30, 0xF0, 0xE0, 0x02, 0x30, 0xF0, 0xE0, 0x01, 0x50, 0xF1, 0x30, 0x05, 0x40, 0xF1,
+  0x50, 0x00, 0x70, 0xF0, 0xA0, 0x03, 0xE0, 0xF0, 0x20, 0x00, 0x90, 0xF0, 0xE0, 0x06, 0x10, 0xF1,
+  0x80, 0x00, 0xA0, 0xF0, 0x60, 0x03, 0xB0, 0xF0, 0x60, 0x00, 0xD0, 0xF0, 0xB0, 0x07, 0xC0, 0xF0,
+  0xC0, 0x00, 0xE0, 0xF0, 0x30, 0x03, 0x70, 0xF0, 0xA0, 0x10, 0xF1, 0x70, 0x07, 0x80, 0xF1, 0x40,
+  0xF0, 0xE0, 0x04, 0x30, 0xF0, 0xD0, 0x50, 0xF1, 0x30, 0x07, 0x40, 0xF1, 0xB0, 0xF0, 0xA0, 0x05,
+  0xE0, 0xF0, 0xB0, 0xF0, 0xE0, 0x08, 0x10, 0xF3, 0x70, 0x05, 0xB0, 0xF2, 0xB0, 0x09, 0xC0, 0xF2,
+  0x30, 0x05, 0x70, 0xF2, 0x70, 0x09, 0x80, 0xF1, 0xE0, 0x06, 0x40, 0xF2, 0x30, 0x04, 0x00, 0x10,
+  0xE0, 0xF0, 0xB0, 0x07, 0x80, 0xF1, 0x40, 0x02, 0x50, 0xF1, 0x60, 0x05, 0x30, 0xF1, 0x80, 0x04,
+  0xA0, 0xF0, 0xE0, 0x20, 0x03, 0x10, 0xD0, 0xF0, 0xD0, 0x10, 0x04, 0x20, 0xE0, 0xF0, 0xB0, 0x03,
+  0x90, 0xF1, 0x30, 0x06, 0x60, 0xF1, 0x60, 0x01, 0x40, 0xF1, 0x80, 0x08, 0xB0, 0xF0, 0xE0, 0x20,
+  0x10, 0xD0, 0xF0, 0xC0, 0x09, 0x20, 0xE0, 0xF0, 0xA0, 0x90, 0xF1, 0x20, 0x0A, 0x60, 0xF3, 0x70,
+  0x0C, 0xB0, 0xF1, 0xB0, 0x0D, 0xA0, 0xF1, 0xB0, 0x0C, 0x60, 0xF3, 0x50, 0x0A, 0x20, 0xE0, 0xF0,
+  0xA0, 0xB0, 0xF0, 0xE0, 0x10, 0x09, 0xB0, 0xF0, 0xE0, 0x10, 0x20, 0xE0, 0xF0, 0xA0, 0x08, 0x70,
+  0xF1, 0x50, 0x01, 0x60, 0xF1, 0x50, 0x06, 0x20, 0xE0, 0xF0, 0xA0, 0x03, 0xB0, 0xF0, 0xE0, 0x10,
+  0x05, 0xC0, 0xF0, 0xD0, 0x10, 0x03, 0x20, 0xE0, 0xF0, 0xA0, 0x04, 0x80, 0xF1, 0x40, 0x05, 0x60,
+  0xF1, 0x50, 0x02, 0x30, 0xF1, 0x90, 0x07, 0xB0, 0xF0, 0xE0, 0x10, 0x01, 0xD0, 0xF0, 0xD0, 0x10,
+  0x07, 0x20, 0xE0, 0xF0, 0xA0, 0x00, 0x00, 0xB0, 0xF0, 0xE0, 0x20, 0x07, 0x30, 0xF1, 0x90, 0x00,
+  0x20, 0xE0, 0xF0, 0xB0, 0x07, 0xC0, 0xF0, 0xD0, 0x10, 0x01, 0x50, 0xF1, 0x60, 0x05, 0x80, 0xF1,
+  0x40, 0x03, 0xA0, 0xF0, 0xE0, 0x20, 0x03, 0x30, 0xF1, 0x90, 0x04, 0x10, 0xE0, 0xF0, 0xB0, 0x03,
+  0xC0, 0xF0, 0xD0, 0x10, 0x05, 0x50, 0xF1, 0x60, 0x01, 0x80, 0xF1, 0x40, 0x07, 0xA0, 0xF0, 0xE0,
+  0x20, 0x30, 0xF1, 0x80, 0x08, 0x10, 0xE0, 0xF0, 0xB0, 0xC0, 0xF0, 0xD0, 0x10, 0x09, 0x50, 0xF3,
+  0x30, 0x0B, 0xA0, 0xF1, 0x80, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1,
+  0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1,
+  0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x05, 0x00, 0x80, 0xFD, 0x50, 0x01, 0x80,
+  0xFD, 0x50, 0x0C, 0x40, 0xF1, 0xD0, 0x10, 0x0B, 0x20, 0xE0, 0xF0, 0xE0, 0x30, 0x0B, 0x10, 0xC0,
+  0xF1, 0x50, 0x0C, 0xA0, 0xF1, 0x80, 0x0C, 0x70, 0xF1, 0xB0, 0x0C, 0x40, 0xF1, 0xD0, 0x10, 0x0B,
+  0x20, 0xE0, 0xF0, 0xE0, 0x30, 0x0C, 0xC0, 0xF1, 0x50, 0x0C, 0x90, 0xF1, 0x80, 0x0C, 0x60, 0xF1,
+  0xB0, 0x0C, 0x40, 0xF1, 0xD0, 0x10, 0x0B, 0x20, 0xE0, 0xF1, 0x30, 0x0C, 0xC0, 0xF1, 0x60, 0x0C,
+  0x90, 0xF1, 0x90, 0x0C, 0x60, 0xF1, 0xB0, 0x0D, 0xC0, 0xFD, 0xA0, 0x01, 0xC0, 0xFD, 0xA0, 0x00,
+  0x01, 0xC0, 0xF3, 0x90, 0x03, 0xC0, 0xF3, 0x90, 0x03, 0xC0, 0xF0, 0x90, 0x06, 0xC0, 0xF0, 0x90,
+  0x06, 0xC0, 0xF0, 0x90, 0x06, 0xC0, 0xF0, 0x90, 0x06, 0xC0, 0xF0, 0x90, 0x06, 0xC0, 0xF0, 0x90,
+  0x06, 0xC0, 0xF0, 0x90, 0x06, 0xC0, 0xF0, 0x90, 0x06, 0xC0, 0xF0, 0x90, 0x06, 0xC0, 0xF0, 0x90,
+  0x06, 0xC0, 0xF0, 0x90, 0x06, 0xC0, 0xF0, 0x90, 0x06, 0xC0, 0xF0, 0x90, 0x06, 0xC0, 0xF0, 0x90,
+  0x06, 0xC0, 0xF0, 0x90, 0x06, 0xC0, 0xF0, 0x90, 0x06, 0xC0, 0xF0, 0x90, 0x06, 0xC0, 0xF0, 0x90,
+  0x06, 0xC0, 0xF0, 0x90, 0x06, 0xC0, 0xF3, 0x90, 0x03, 0xC0, 0xF3, 0x90, 0x01, 0xD0, 0xF0, 0x50,
+  0x05, 0x80, 0xF0, 0x90, 0x05, 0x30, 0xF0, 0xE0, 0x06, 0xD0, 0xF0, 0x40, 0x05, 0x90, 0xF0, 0x90,
+  0x05, 0x40, 0xF0, 0xD0, 0x06, 0xE0, 0xF0, 0x30, 0x05, 0xA0, 0xF0, 0x80, 0x05, 0x50, 0xF0, 0xC0,
+  0x05, 0x10, 0xF1, 0x20, 0x05, 0xA0, 0xF0, 0x70, 0x05, 0x60, 0xF0, 0xC0, 0x05, 0x10, 0xF1, 0x10,
+  0x05, 0xB0, 0xF0, 0x60, 0x05, 0x70, 0xF0, 0xB0, 0x05, 0x20, 0xF1, 0x10, 0x05, 0xC0, 0xF0, 0x50,
+  0x05, 0x70, 0xF0, 0xA0, 0x05, 0x30, 0xF0, 0xE0, 0x06, 0xD0, 0xF0, 0x40, 0x05, 0x80, 0xF0, 0x90,
+  0x01, 0x70, 0xF3, 0xE0, 0x03, 0x70, 0xF3, 0xE0, 0x06, 0x70, 0xF0, 0xE0, 0x06, 0x70, 0xF0, 0xE0,
+  0x06, 0x70, 0xF0, 0xE0, 0x06, 0x70, 0xF0, 0xE0, 0x06, 0x70, 0xF0, 0xE0, 0x06, 0x70, 0xF0, 0xE0,
+  0x06, 0x70, 0xF0, 0xE0, 0x06, 0x70, 0xF0, 0xE0, 0x06, 0x70, 0xF0, 0xE0, 0x06, 0x70, 0xF0, 0xE0,
+  0x06, 0x70, 0xF0, 0xE0, 0x06, 0x70, 0xF0, 0xE0, 0x06, 0x70, 0xF0, 0xE0, 0x06, 0x70, 0xF0, 0xE0,
+  0x06, 0x70, 0xF0, 0xE0, 0x06, 0x70, 0xF0, 0xE0, 0x06, 0x70, 0xF0, 0xE0, 0x06, 0x70, 0xF0, 0xE0,
+  0x06, 0x70, 0xF0, 0xE0, 0x03, 0x70, 0xF3, 0xE0, 0x03, 0x70, 0xF3, 0xE0, 0x01, 0x07, 0x10, 0xC0,
+  0xF1, 0x90, 0x0F, 0x10, 0xC0, 0xF3, 0x90, 0x0D, 0x10, 0xC0, 0xF1, 0x60, 0x90, 0xF1, 0x90, 0x0B,
+  0x10, 0xB0, 0xF0, 0xE0, 0x40, 0x01, 0x70, 0xF1, 0x90, 0x09, 0x10, 0xB0, 0xF0, 0xE0, 0x30, 0x03,
+  0x50, 0xF1, 0x80, 0x07, 0x10, 0xB0, 0xF0, 0xD0, 0x20, 0x05, 0x40, 0xE0, 0xF0, 0x80, 0x06, 0xB0,
+  0xF0, 0xC0, 0x10, 0x07, 0x30, 0xD0, 0xF0, 0x80, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x0F, 0x0F, 0x0F, 0x0B, 0x40, 0xFC, 0x41,
+  0xFC, 0x40, 0x01, 0x70, 0xF0, 0xE0, 0x10, 0x09, 0x90, 0xF0, 0xB0, 0x0A, 0xB0, 0xF0, 0x70, 0x09,
+  0x10, 0xD0, 0xF0, 0x30, 0x09, 0x30, 0xE0, 0xD0, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0x02, 0x40, 0x90, 0xC0, 0xD0, 0xF0, 0xE0, 0xC0, 0x70,
+  0x10, 0x05, 0x60, 0xF7, 0xD0, 0x20, 0x04, 0x50, 0xB0, 0x50, 0x30, 0x11, 0x20, 0x70, 0xE0, 0xF0,
+  0xC0, 0x0C, 0x20, 0xF1, 0x30, 0x0C, 0xC0, 0xF0, 0x70, 0x04, 0x10, 0x70, 0xB0, 0xE0, 0xF5, 0x80,
+  0x03, 0x40, 0xE0, 0xF8, 0x90, 0x02, 0x10, 0xE0, 0xF0, 0xD0, 0x60, 0x20, 0x10, 0x02, 0xC0, 0xF0,
+  0x90, 0x02, 0x40, 0xF1, 0x20, 0x05, 0xD0, 0xF0, 0x90, 0x02, 0x60, 0xF0, 0xE0, 0x05, 0x20, 0xF1,
+  0x90, 0x02, 0x50, 0xF1, 0x20, 0x04, 0xB0, 0xF1, 0x90, 0x02, 0x10, 0xF1, 0xC0, 0x40, 0x11, 0x40,
+  0xC0, 0xD0, 0xC0, 0xF0, 0x90, 0x03, 0x70, 0xF5, 0xE0, 0x30, 0xC0, 0xF0, 0x90, 0x04, 0x40, 0xB0,
+  0xE0, 0xF0, 0xD0, 0x90, 0x20, 0x00, 0xC0, 0xF0, 0x90, 0x01, 0x01, 0xA0, 0xF0, 0xB0, 0x0D, 0xA0,
+  0xF0, 0xB0, 0x0D, 0xA0, 0xF0, 0xB0, 0x0D, 0xA0, 0xF0, 0xB0, 0x0D, 0xA0, 0xF0, 0xB0, 0x0D, 0xA0,
+  0xF0, 0xB0, 0x0D, 0xA0, 0xF0, 0xB0, 0x00, 0x30, 0xA0, 0xE0, 0xF0, 0xD0, 0x80, 0x10, 0x05, 0xA0,
+  0xF0, 0xB0, 0x40, 0xE0, 0xF4, 0xD0, 0x20, 0x04, 0xA0, 0xF0, 0xC0, 0xE0, 0xA0, 0x30, 0x00, 0x20,
+  0x70, 0xF1, 0xC0, 0x04, 0xA0, 0xF1, 0xA0, 0x04, 0x50, 0xF1, 0x60, 0x03, 0xA0, 0xF1, 0x20, 0x05,
+  0xC0, 0xF0, 0xB0, 0x03, 0xA0, 0xF0, 0xD0, 0x06, 0x70, 0xF0, 0xE0, 0x03, 0xA0, 0xF0, 0xB0, 0x06,
+  0x60, 0xF1, 0x10, 0x02, 0xA0, 0xF0, 0xB0, 0x06, 0x60, 0xF1, 0x10, 0x02, 0xA0, 0xF0, 0xD0, 0x06,
+  0x70, 0xF0, 0xE0, 0x03, 0xA0, 0xF1, 0x20, 0x05, 0xC0, 0xF0, 0xB0, 0x03, 0xA0, 0xF1, 0xA0, 0x04,
+  0x50, 0xF1, 0x60, 0x03, 0xA0, 0xF0, 0xC0, 0xE0, 0xA0, 0x30, 0x00, 0x10, 0x70, 0xF1, 0xC0, 0x04,
+  0xA0, 0xF0, 0xB0, 0x40, 0xF5, 0xD0, 0x20, 0x04, 0xA0, 0xF0, 0xB0, 0x00, 0x30, 0xA0, 0xE0, 0xF0,
+  0xD0, 0x80, 0x10, 0x03, 0x03, 0x10, 0x70, 0xB0, 0xE0, 0xF0, 0xD0, 0xB0, 0x70, 0x10, 0x03, 0x40,
+  0xE0, 0xF6, 0xA0, 0x02, 0x30, 0xE0, 0xF0, 0xE0, 0x60, 0x20, 0x00, 0x20, 0x40, 0x80, 0x90, 0x02,
+  0xC0, 0xF0, 0xE0, 0x20, 0x08, 0x30, 0xF1, 0x60, 0x09, 0x60, 0xF1, 0x10, 0x09, 0x80, 0xF0, 0xE0,
+  0x0A, 0x80, 0xF0, 0xE0, 0x0A, 0x60, 0xF1, 0x10, 0x09, 0x30, 0xF1, 0x60, 0x0A, 0xC0, 0xF0, 0xE0,
+  0x20, 0x09, 0x30, 0xE0, 0xF0, 0xE0, 0x60, 0x20, 0x00, 0x10, 0x40, 0x80, 0x90, 0x03, 0x40, 0xE0,
+  0xF6, 0xA0, 0x04, 0x10, 0x70, 0xC0, 0xE0, 0xF0, 0xD0, 0xB0, 0x70, 0x10, 0x00, 0x0A, 0x30, 0xF1,
+  0x20, 0x0C, 0x30, 0xF1, 0x20, 0x0C, 0x30, 0xF1, 0x20, 0x0C, 0x30, 0xF1, 0x20, 0x0C, 0x30, 0xF1,
+  0x20, 0x0C, 0x30, 0xF1, 0x20, 0x05, 0x40, 0xB0, 0xE1, 0xC0, 0x70, 0x00, 0x30, 0xF1, 0x20, 0x04,
+  0x80, 0xF5, 0xB0, 0x30, 0xF1, 0x20, 0x03, 0x50, 0xF1, 0xB0, 0x30, 0x11, 0x60, 0xE0, 0xA0, 0xF1,
+  0x20, 0x03, 0xD0, 0xF0, 0xC0, 0x04, 0x30, 0xF2, 0x20, 0x02, 0x40, 0xF1, 0x40, 0x05, 0x90, 0xF1,
+  0x20, 0x02, 0x70, 0xF1, 0x06, 0x50, 0xF1, 0x20, 0x02, 0x80, 0xF0, 0xD0, 0x06, 0x30, 0xF1, 0x20,
+  0x02, 0x80, 0xF0, 0xD0, 0x06, 0x30, 0xF1, 0x20, 0x02, 0x70, 0xF1, 0x06, 0x50, 0xF1, 0x20, 0x02,
+  0x40, 0xF1, 0x40, 0x05, 0x90, 0xF1, 0x20, 0x03, 0xD0, 0xF0, 0xC0, 0x04, 0x30, 0xF2, 0x20, 0x03,
+  0x50, 0xF1, 0xB0, 0x30, 0x00, 0x10, 0x60, 0xE0, 0xA0, 0xF1, 0x20, 0x04, 0x80, 0xF5, 0xB0, 0x30,
+  0xF1, 0x20, 0x05, 0x40, 0xB0, 0xE1, 0xC0, 0x70, 0x00, 0x30, 0xF1, 0x20, 0x01, 0x03, 0x10, 0x70,
+  0xC0, 0xE0, 0xF0, 0xE0, 0xA0, 0x40, 0x06, 0x40, 0xE0, 0xF6, 0x90, 0x04, 0x30, 0xE0, 0xF0, 0xD0,
+  0x50, 0x10, 0x00, 0x20, 0x80, 0xF1, 0x70, 0x03, 0xB0, 0xF0, 0xD0, 0x10, 0x04, 0x70, 0xF0, 0xE0,
+  0x10, 0x01, 0x30, 0xF1, 0x50, 0x06, 0xE0, 0xF0, 0x50, 0x01, 0x60, 0xF1, 0x10, 0x06, 0xC0, 0xF0,
+  0x80, 0x01, 0x80, 0xFB, 0x90, 0x01, 0x80, 0xFB, 0x90, 0x01, 0x70, 0xF0, 0xE0, 0x0C, 0x30, 0xF1,
+  0x40, 0x0C, 0xC0, 0xF0, 0xC0, 0x10, 0x0B, 0x30, 0xE0, 0xF0, 0xD0, 0x60, 0x20, 0x00, 0x10, 0x20,
+  0x40, 0x80, 0xC0, 0x10, 0x03, 0x30, 0xD0, 0xF8, 0x10, 0x04, 0x10, 0x60, 0xB0, 0xE0, 0xF0, 0xE0,
+  0xD0, 0xB0, 0x70, 0x20, 0x01, 0x03, 0x40, 0xB0, 0xE0, 0xF1, 0xA0, 0x02, 0x50, 0xF4, 0xA0, 0x02,
+  0xC0, 0xF0, 0xC0, 0x20, 0x04, 0x10, 0xF1, 0x50, 0x05, 0x20, 0xF1, 0x30, 0x05, 0x30, 0xF1, 0x30,
+  0x03, 0x60, 0xF7, 0x00, 0x60, 0xF7, 0x02, 0x30, 0xF1, 0x30, 0x05, 0x30, 0xF1, 0x30, 0x05, 0x30,
+  0xF1, 0x30, 0x05, 0x30, 0xF1, 0x30, 0x05, 0x30, 0xF1, 0x30, 0x05, 0x30, 0xF1, 0x30, 0x05, 0x30,
+  0xF1, 0x30, 0x05, 0x30, 0xF1, 0x30, 0x05, 0x30, 0xF1, 0x30, 0x05, 0x30, 0xF1, 0x30, 0x05, 0x30,
+  0xF1, 0x30, 0x05, 0x30, 0xF1, 0x30, 0x03, 0x03, 0x40, 0xB0, 0xE1, 0xC0, 0x70, 0x00, 0x30, 0xF1,
+  0x20, 0x04, 0x80, 0xF5, 0xB0, 0x30, 0xF1, 0x20, 0x03, 0x50, 0xF1, 0xB0, 0x30, 0x00, 0x10, 0x50,
+  0xE0, 0xA0, 0xF1, 0x20, 0x03, 0xD0, 0xF0, 0xC0, 0x04, 0x20, 0xF2, 0x20, 0x02, 0x40, 0xF1, 0x40,
+  0x05, 0x90, 0xF1, 0x20, 0x02, 0x70, 0xF1, 0x06, 0x50, 0xF1, 0x20, 0x02, 0x80, 0xF0, 0xD0, 0x06,
+  0x30, 0xF1, 0x20, 0x02, 0x80, 0xF0, 0xD0, 0x06, 0x30, 0xF1, 0x20, 0x02, 0x70, 0xF1, 0x06, 0x50,
+  0xF1, 0x20, 0x02, 0x40, 0xF1, 0x40, 0x05, 0x90, 0xF1, 0x20, 0x03, 0xD0, 0xF0, 0xC0, 0x04, 0x20,
+  0xF2, 0x20, 0x03, 0x60, 0xF1, 0xB0, 0x30, 0x00, 0x10, 0x50, 0xE0, 0xA0, 0xF1, 0x20, 0x04, 0x80,
+  0xF5, 0xB0, 0x30, 0xF1, 0x20, 0x05, 0x40, 0xB0, 0xE1, 0xC0, 0x70, 0x00, 0x40, 0xF1, 0x10, 0x0C,
+  0x70, 0xF0, 0xD0, 0x0C, 0x10, 0xE0, 0xF0, 0x90, 0x05, 0xA0, 0x70, 0x30, 0x10, 0x00, 0x20, 0x60,
+  0xD0, 0xF1, 0x20, 0x05, 0xD0, 0xF6, 0xE0, 0x50, 0x06, 0x20, 0x80, 0xC0, 0xD0, 0xF0, 0xE0, 0xC0,
+  0x80, 0x20, 0x04, 0x01, 0xA0, 0xF0, 0xB0, 0x0C, 0xA0, 0xF0, 0xB0, 0x0C, 0xA0, 0xF0, 0xB0, 0x0C,
+  0xA0, 0xF0, 0xB0, 0x0C, 0xA0, 0xF0, 0xB0, 0x0C, 0xA0, 0xF0, 0xB0, 0x0C, 0xA0, 0xF0, 0xB0, 0x00,
+  0x20, 0x90, 0xD0, 0xF0, 0xD0, 0x80, 0x10, 0x04, 0xA0, 0xF0, 0xB0, 0x30, 0xE0, 0xF4, 0xD0, 0x10,
+  0x03, 0xA0, 0xF0, 0xC0, 0xD0, 0xA0, 0x30, 0x00, 0x10, 0x70, 0xF1, 0x80, 0x03, 0xA0, 0xF1, 0x90,
+  0x04, 0x90, 0xF0, 0xE0, 0x03, 0xA0, 0xF1, 0x10, 0x04, 0x40, 0xF1, 0x20, 0x02, 0xA0, 0xF0, 0xC0,
+  0x05, 0x20, 0xF1, 0x30, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x02, 0xA0, 0xF0, 0xB0,
+  0x05, 0x10, 0xF1, 0x40, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x02, 0xA0, 0xF0, 0xB0,
+  0x05, 0x10, 0xF1, 0x40, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x02, 0xA0, 0xF0, 0xB0,
+  0x05, 0x10, 0xF1, 0x40, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x02, 0xA0, 0xF0, 0xB0,
+  0x05, 0x10, 0xF1, 0x40, 0x00, 0x01, 0x80, 0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80, 0xF0,
+  0xC0, 0x0F, 0x08, 0x80, 0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80,
+  0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80,
+  0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80,
+  0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x01, 0x02, 0x80, 0xF0, 0xC0, 0x04,
+  0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0, 0x0F, 0x0C, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0,
+  0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0,
+  0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0,
+  0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0,
+  0x04, 0x90, 0xF0, 0xB0, 0x04, 0xA0, 0xF0, 0xA0, 0x02, 0x10, 0x50, 0xF1, 0x60, 0x01, 0x70, 0xF2,
+  0xD0, 0x10, 0x01, 0x70, 0xF0, 0xE0, 0xA0, 0x20, 0x02, 0x01, 0xA0, 0xF0, 0xB0, 0x0B, 0xA0, 0xF0,
+  0xB0, 0x0B, 0xA0, 0xF0, 0xB0, 0x0B, 0xA0, 0xF0, 0xB0, 0x0B, 0xA0, 0xF0, 0xB0, 0x0B, 0xA0, 0xF0,
+  0xB0, 0x0B, 0xA0, 0xF0, 0xB0, 0x04, 0x10, 0xC0, 0xF0, 0xD0, 0x30, 0x01, 0xA0, 0xF0, 0xB0, 0x03,
+  0x30, 0xD0, 0xF0, 0xC0, 0x20, 0x02, 0xA0, 0xF0, 0xB0, 0x02, 0x40, 0xE0, 0xF0, 0xB0, 0x10, 0x03,
+  0xA0, 0xF0, 0xB0, 0x01, 0x60, 0xF1, 0x90, 0x05, 0xA0, 0xF0, 0xB0, 0x00, 0x80, 0xF1, 0x70, 0x06,
+  0xA0, 0xF0, 0xB0, 0xA0, 0xF1, 0x50, 0x07, 0xA0, 0xF3, 0x60, 0x08, 0xA0, 0xF0, 0xC0, 0xD0, 0xF0,
+  0xE0, 0x30, 0x07, 0xA0, 0xF0, 0xB0, 0x10, 0xC0, 0xF0, 0xE0, 0x40, 0x06, 0xA0, 0xF0, 0xB0, 0x00,
+  0x10, 0xB0, 0xF0, 0xE0, 0x40, 0x05, 0xA0, 0xF0, 0xB0, 0x01, 0x10, 0xB0, 0xF1, 0x50, 0x04, 0xA0,
+  0xF0, 0xB0, 0x03, 0xA0, 0xF1, 0x50, 0x03, 0xA0, 0xF0, 0xB0, 0x04, 0xA0, 0xF1, 0x60, 0x02, 0xA0,
+  0xF0, 0xB0, 0x05, 0x90, 0xF1, 0x70, 0x01, 0x80, 0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80,
+  0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80,
+  0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80,
+  0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80,
+  0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x03, 0x80,
+  0xF0, 0xC0, 0x03, 0x80, 0xF0, 0xC0, 0x01, 0x01, 0xA0, 0xF0, 0xB0, 0x00, 0x30, 0xA0, 0xE1, 0xC0,
+  0x50, 0x02, 0x20, 0x90, 0xD0, 0xF0, 0xD0, 0x80, 0x10, 0x04, 0xA0, 0xF0, 0xB0, 0x40, 0xE0, 0xF4,
+  0x70, 0x00, 0x20, 0xD0, 0xF4, 0xC0, 0x04, 0xA0, 0xF0, 0xC0, 0xE0, 0x90, 0x20, 0x00, 0x20, 0xA0,
+  0xF1, 0x20, 0xD0, 0xB0, 0x30, 0x00, 0x10, 0x80, 0xF1, 0x60, 0x03, 0xA0, 0xF1, 0x90, 0x04, 0xE0,
+  0xF0, 0xD0, 0xC0, 0x04, 0xB0, 0xF0, 0xC0, 0x03, 0xA0, 0xF1, 0x10, 0x04, 0x90, 0xF1, 0x40, 0x04,
+  0x60, 0xF1, 0x03, 0xA0, 0xF0, 0xC0, 0x05, 0x70, 0xF1, 0x05, 0x40, 0xF1, 0x10, 0x02, 0xA0, 0xF0,
+  0xB0, 0x05, 0x70, 0xF0, 0xE0, 0x05, 0x40, 0xF1, 0x20, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x70, 0xF0,
+  0xE0, 0x05, 0x40, 0xF1, 0x20, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x70, 0xF0, 0xE0, 0x05, 0x40, 0xF1,
+  0x20, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x70, 0xF0, 0xE0, 0x05, 0x40, 0xF1, 0x20, 0x02, 0xA0, 0xF0,
+  0xB0, 0x05, 0x70, 0xF0, 0xE0, 0x05, 0x40, 0xF1, 0x20, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x70, 0xF0,
+  0xE0, 0x05, 0x40, 0xF1, 0x20, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x70, 0xF0, 0xE0, 0x05, 0x40, 0xF1,
+  0x20, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x70, 0xF0, 0xE0, 0x05, 0x40, 0xF1, 0x20, 0x00, 0x01, 0xA0,
+  0xF0, 0xB0, 0x00, 0x20, 0x90, 0xD0, 0xF0, 0xD0, 0x80, 0x10, 0x04, 0xA0, 0xF0, 0xB0, 0x30, 0xE0,
+  0xF4, 0xD0, 0x10, 0x03, 0xA0, 0xF0, 0xC0, 0xD0, 0xA0, 0x30, 0x00, 0x10, 0x70, 0xF1, 0x80, 0x03,
+  0xA0, 0xF1, 0x90, 0x04, 0x90, 0xF0, 0xE0, 0x03, 0xA0, 0xF1, 0x10, 0x04, 0x40, 0xF1, 0x20, 0x02,
+  0xA0, 0xF0, 0xC0, 0x05, 0x20, 0xF1, 0x30, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x02,
+  0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x02,
+  0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x02,
+  0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x02,
+  0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x00, 0x03, 0x20, 0x90, 0xD0, 0xE1, 0xD0, 0x90, 0x20,
+  0x06, 0x60, 0xF7, 0x50, 0x04, 0x50, 0xF1, 0xC0, 0x40, 0x11, 0x50, 0xD0, 0xF1, 0x30, 0x03, 0xD0,
+  0xF0, 0xD0, 0x10, 0x03, 0x10, 0xE0, 0xF0, 0xC0, 0x02, 0x30, 0xF1, 0x50, 0x05, 0x70, 0xF1, 0x20,
+  0x01, 0x70, 0xF1, 0x10, 0x05, 0x20, 0xF1, 0x50, 0x01, 0x80, 0xF0, 0xE0, 0x07, 0xF1, 0x70, 0x01,
+  0x80, 0xF0, 0xE0, 0x07, 0xF1, 0x70, 0x01, 0x70, 0xF1, 0x10, 0x05, 0x20, 0xF1, 0x50, 0x01, 0x30,
+  0xF1, 0x50, 0x05, 0x60, 0xF1, 0x20, 0x02, 0xD0, 0xF0, 0xC0, 0x10, 0x03, 0x10, 0xE0, 0xF0, 0xC0,
+  0x03, 0x50, 0xF1, 0xC0, 0x40, 0x11, 0x50, 0xD0, 0xF1, 0x30, 0x04, 0x60, 0xF7, 0x50, 0x06, 0x20,
+  0x90, 0xD0, 0xE1, 0xD0, 0x90, 0x20, 0x03, 0x01, 0xA0, 0xF0, 0xB0, 0x00, 0x30, 0xA0, 0xE0, 0xF0,
+  0xD0, 0x80, 0x10, 0x05, 0xA0, 0xF0, 0xB0, 0x40, 0xE0, 0xF4, 0xD0, 0x20, 0x04, 0xA0, 0xF0, 0xC0,
+  0xE0, 0xA0, 0x30, 0x00, 0x20, 0x70, 0xF1, 0xC0, 0x04, 0xA0, 0xF1, 0xA0, 0x04, 0x50, 0xF1, 0x60,
+  0x03, 0xA0, 0xF1, 0x20, 0x05, 0xC0, 0xF0, 0xB0, 0x03, 0xA0, 0xF0, 0xD0, 0x06, 0x70, 0xF0, 0xE0,
+  0x03, 0xA0, 0xF0, 0xB0, 0x06, 0x60, 0xF1, 0x10, 0x02, 0xA0, 0xF0, 0xB0, 0x06, 0x60, 0xF1, 0x10,
+  0x02, 0xA0, 0xF0, 0xD0, 0x06, 0x70, 0xF0, 0xE0, 0x03, 0xA0, 0xF1, 0x20, 0x05, 0xC0, 0xF0, 0xB0,
+  0x03, 0xA0, 0xF1, 0xA0, 0x04, 0x50, 0xF1, 0x60, 0x03, 0xA0, 0xF0, 0xC0, 0xE0, 0xA0, 0x30, 0x00,
+  0x10, 0x70, 0xF1, 0xC0, 0x04, 0xA0, 0xF0, 0xB0, 0x40, 0xF5, 0xD0, 0x20, 0x04, 0xA0, 0xF0, 0xB0,
+  0x00, 0x30, 0xA0, 0xE0, 0xF0, 0xD0, 0x80, 0x10, 0x05, 0xA0, 0xF0, 0xB0, 0x0D, 0xA0, 0xF0, 0xB0,
+  0x0D, 0xA0, 0xF0, 0xB0, 0x0D, 0xA0, 0xF0, 0xB0, 0x0D, 0xA0, 0xF0, 0xB0, 0x0B, 0x03, 0x40, 0xB0,
+  0xE1, 0xC0, 0x70, 0x00, 0x30, 0xF1, 0x20, 0x04, 0x80, 0xF5, 0xB0, 0x30, 0xF1, 0x20, 0x03, 0x50,
+  0xF1, 0xB0, 0x30, 0x11, 0x60, 0xE0, 0xA0, 0xF1, 0x20, 0x03, 0xD0, 0xF0, 0xC0, 0x04, 0x30, 0xF2,
+  0x20, 0x02, 0x40, 0xF1, 0x40, 0x05, 0x90, 0xF1, 0x20, 0x02, 0x70, 0xF1, 0x06, 0x50, 0xF1, 0x20,
+  0x02, 0x80, 0xF0, 0xD0, 0x06, 0x30, 0xF1, 0x20, 0x02, 0x80, 0xF0, 0xD0, 0x06, 0x30, 0xF1, 0x20,
+  0x02, 0x70, 0xF1, 0x06, 0x50, 0xF1, 0x20, 0x02, 0x40, 0xF1, 0x40, 0x05, 0x90, 0xF1, 0x20, 0x03,
+  0xD0, 0xF0, 0xC0, 0x04, 0x30, 0xF2, 0x20, 0x03, 0x50, 0xF1, 0xB0, 0x30, 0x00, 0x10, 0x60, 0xE0,
+  0xA0, 0xF1, 0x20, 0x04, 0x80, 0xF5, 0xB0, 0x30, 0xF1, 0x20, 0x05, 0x40, 0xB0, 0xE1, 0xC0, 0x70,
+  0x00, 0x30, 0xF1, 0x20, 0x0C, 0x30, 0xF1, 0x20, 0x0C, 0x30, 0xF1, 0x20, 0x0C, 0x30, 0xF1, 0x20,
+  0x0C, 0x30, 0xF1, 0x20, 0x0C, 0x30, 0xF1, 0x20, 0x01, 0x01, 0xA0, 0xF0, 0xB0, 0x00, 0x20, 0x90,
+  0xD0, 0xF0, 0xA0, 0x01, 0xA0, 0xF0, 0xB0, 0x40, 0xE0, 0xF2, 0xA0, 0x01, 0xA0, 0xF0, 0xC0, 0xE0,
+  0xA0, 0x30, 0x04, 0xA0, 0xF1, 0xA0, 0x06, 0xA0, 0xF1, 0x20, 0x06, 0xA0, 0xF0, 0xD0, 0x07, 0xA0,
+  0xF0, 0xB0, 0x07, 0xA0, 0xF0, 0xB0, 0x07, 0xA0, 0xF0, 0xB0, 0x07, 0xA0, 0xF0, 0xB0, 0x07, 0xA0,
+  0xF0, 0xB0, 0x07, 0xA0, 0xF0, 0xB0, 0x07, 0xA0, 0xF0, 0xB0, 0x07, 0xA0, 0xF0, 0xB0, 0x05, 0x02,
+  0x40, 0xA0, 0xD0, 0xF0, 0xE0, 0xD0, 0xA0, 0x50, 0x10, 0x03, 0x80, 0xF7, 0x80, 0x02, 0x30, 0xF1,
+  0xA0, 0x30, 0x11, 0x20, 0x40, 0xA0, 0x70, 0x02, 0x70, 0xF0, 0xD0, 0x0A, 0x60, 0xF0, 0xD0, 0x0A,
+  0x20, 0xF1, 0xB0, 0x50, 0x10, 0x08, 0x70, 0xF3, 0xD0, 0x90, 0x50, 0x06, 0x20, 0x80, 0xC0, 0xF3,
+  0xD0, 0x30, 0x07, 0x10, 0x40, 0x80, 0xE0, 0xF0, 0xD0, 0x0A, 0x50, 0xF1, 0x30, 0x09, 0x40, 0xF1,
+  0x30, 0x01, 0x80, 0xA0, 0x60, 0x30, 0x10, 0x00, 0x10, 0x50, 0xD0, 0xF0, 0xE0, 0x02, 0x90, 0xF7,
+  0xE0, 0x40, 0x02, 0x10, 0x50, 0x90, 0xC0, 0xE0, 0xF0, 0xE0, 0xC0, 0x80, 0x10, 0x02, 0x01, 0x90,
+  0xF0, 0xC0, 0x06, 0x90, 0xF0, 0xC0, 0x06, 0x90, 0xF0, 0xC0, 0x06, 0x90, 0xF0, 0xC0, 0x04, 0x40,
+  0xF7, 0x90, 0x40, 0xF7, 0x90, 0x01, 0x90, 0xF0, 0xC0, 0x06, 0x90, 0xF0, 0xC0, 0x06, 0x90, 0xF0,
+  0xC0, 0x06, 0x90, 0xF0, 0xC0, 0x06, 0x90, 0xF0, 0xC0, 0x06, 0x90, 0xF0, 0xC0, 0x06, 0x90, 0xF0,
+  0xC0, 0x06, 0x90, 0xF0, 0xC0, 0x06, 0x80, 0xF0, 0xD0, 0x06, 0x50, 0xF1, 0x60, 0x10, 0x04, 0x10,
+  0xD0, 0xF4, 0x90, 0x02, 0x20, 0x90, 0xD0, 0xF2, 0x90, 0x01, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1,
+  0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1,
+  0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1,
+  0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1,
+  0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xB0, 0xF0, 0x90, 0x05, 0x50, 0xF1,
+  0x20, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x90, 0xF1, 0x20, 0x02, 0x70, 0xF1, 0x20, 0x03, 0x30, 0xF2,
+  0x20, 0x02, 0x20, 0xF1, 0xC0, 0x30, 0x00, 0x10, 0x60, 0xE0, 0xA0, 0xF1, 0x20, 0x03, 0x60, 0xF5,
+  0xA0, 0x30, 0xF1, 0x20, 0x04, 0x40, 0xB0, 0xE1, 0xC0, 0x60, 0x00, 0x30, 0xF1, 0x20, 0x00, 0x10,
+  0xF1, 0x70, 0x06, 0x10, 0xF1, 0x60, 0x00, 0xA0, 0xF0, 0xC0, 0x06, 0x60, 0xF1, 0x10, 0x00, 0x40,
+  0xF1, 0x30, 0x05, 0xC0, 0xF0, 0xA0, 0x02, 0xD0, 0xF0, 0x90, 0x04, 0x30, 0xF1, 0x40, 0x02, 0x80,
+  0xF0, 0xE0, 0x04, 0x90, 0xF0, 0xD0, 0x03, 0x20, 0xF1, 0x50, 0x03, 0xE0, 0xF0, 0x80, 0x04, 0xB0,
+  0xF0, 0xB0, 0x02, 0x50, 0xF1, 0x20, 0x04, 0x60, 0xF1, 0x10, 0x01, 0xB0, 0xF0, 0xB0, 0x05, 0x10,
+  0xE0, 0xF0, 0x70, 0x00, 0x10, 0xF1, 0x60, 0x06, 0x90, 0xF0, 0xD0, 0x00, 0x70, 0xF0, 0xE0, 0x10,
+  0x06, 0x30, 0xF1, 0x30, 0xD0, 0xF0, 0x90, 0x08, 0xD0, 0xF0, 0xC0, 0xF1, 0x30, 0x08, 0x70, 0xF2,
+  0xD0, 0x09, 0x10, 0xF2, 0x70, 0x04, 0x00, 0xC0, 0xF0, 0x80, 0x04, 0xD0, 0xF1, 0x20, 0x03, 0x40,
+  0xF1, 0x10, 0x00, 0x80, 0xF0, 0xC0, 0x03, 0x20, 0xF2, 0x60, 0x03, 0x80, 0xF0, 0xC0, 0x01, 0x40,
+  0xF1, 0x10, 0x02, 0x60, 0xF0, 0xE0, 0xF0, 0xA0, 0x03, 0xC0, 0xF0, 0x80, 0x02, 0xE0, 0xF0, 0x50,
+  0x02, 0xA0, 0xF0, 0x70, 0xF0, 0xE0, 0x02, 0x10, 0xF1, 0x40, 0x02, 0xB0, 0xF0, 0x90, 0x02, 0xE0,
+  0xF0, 0x20, 0xD0, 0xF0, 0x30, 0x01, 0x50, 0xF0, 0xE0, 0x03, 0x70, 0xF0, 0xD0, 0x01, 0x30, 0xF0,
+  0xD0, 0x00, 0x90, 0xF0, 0x70, 0x01, 0x90, 0xF0, 0xB0, 0x03, 0x30, 0xF1, 0x20, 0x00, 0x70, 0xF0,
+  0x90, 0x00, 0x50, 0xF0, 0xB0, 0x01, 0xD0, 0xF0, 0x70, 0x04, 0xE0, 0xF0, 0x60, 0x00, 0xB0, 0xF0,
+  0x50, 0x00, 0x10, 0xF1, 0x10, 0x20, 0xF1, 0x30, 0x04, 0xA0, 0xF0, 0xA0, 0x10, 0xF1, 0x10, 0x01,
+  0xC0, 0xF0, 0x40, 0x60, 0xF0, 0xE0, 0x05, 0x60, 0xF0, 0xE0, 0x40, 0xF0, 0xC0, 0x02, 0x80, 0xF0,
+  0x80, 0xA0, 0xF0, 0xA0, 0x05, 0x20, 0xF1, 0xC0, 0xF0, 0x80, 0x02, 0x40, 0xF0, 0xD0, 0xE0, 0xF0,
+  0x60, 0x06, 0xD0, 0xF2, 0x30, 0x03, 0xE0, 0xF2, 0x20, 0x06, 0x90, 0xF1, 0xE0, 0x04, 0xB0, 0xF1,
+  0xD0, 0x07, 0x50, 0xF1, 0xA0, 0x04, 0x60, 0xF1, 0x90, 0x03, 0x00, 0x60, 0xF1, 0x50, 0x04, 0x10,
+  0xC0, 0xF0, 0xD0, 0x10, 0x01, 0xA0, 0xF0, 0xE0, 0x20, 0x03, 0x90, 0xF0, 0xE0, 0x30, 0x02, 0x10,
+  0xD0, 0xF0, 0xC0, 0x10, 0x01, 0x60, 0xF1, 0x60, 0x04, 0x30, 0xE0, 0xF0, 0x90, 0x00, 0x30, 0xE0,
+  0xF0, 0x90, 0x06, 0x60, 0xF1, 0x60, 0xD0, 0xF0, 0xC0, 0x10, 0x07, 0x90, 0xF2, 0xE0, 0x20, 0x08,
+  0x10, 0xE0, 0xF1, 0x60, 0x09, 0x50, 0xF2, 0xA0, 0x08, 0x20, 0xE0, 0xF0, 0xC0, 0xF1, 0x60, 0x06,
+  0x10, 0xC0, 0xF0, 0xD0, 0x10, 0x90, 0xF0, 0xE0, 0x30, 0x05, 0x90, 0xF0, 0xE0, 0x30, 0x00, 0x10,
+  0xC0, 0xF0, 0xD0, 0x10, 0x03, 0x60, 0xF1, 0x60, 0x02, 0x20, 0xE0, 0xF0, 0xA0, 0x02, 0x20, 0xE0,
+  0xF0, 0x90, 0x04, 0x50, 0xF1, 0x60, 0x00, 0x10, 0xD0, 0xF0, 0xD0, 0x10, 0x05, 0x90, 0xF1, 0x30,
+  0x10, 0xE0, 0xF0, 0x70, 0x06, 0x10, 0xF1, 0x60, 0x00, 0x90, 0xF0, 0xD0, 0x06, 0x70, 0xF0, 0xE0,
+  0x10, 0x00, 0x30, 0xF1, 0x40, 0x05, 0xD0, 0xF0, 0x80, 0x02, 0xB0, 0xF0, 0xA0, 0x04, 0x40, 0xF1,
+  0x20, 0x02, 0x50, 0xF1, 0x10, 0x03, 0xA0, 0xF0, 0xB0, 0x04, 0xD0, 0xF0, 0x70, 0x02, 0x20, 0xF1,
+  0x50, 0x04, 0x70, 0xF0, 0xD0, 0x02, 0x80, 0xF0, 0xD0, 0x05, 0x10, 0xF1, 0x40, 0x01, 0xD0, 0xF0,
+  0x70, 0x06, 0xA0, 0xF0, 0xA0, 0x00, 0x50, 0xF1, 0x10, 0x06, 0x30, 0xF1, 0x20, 0xB0, 0xF0, 0xA0,
+  0x08, 0xC0, 0xF0, 0xA0, 0xF1, 0x30, 0x08, 0x60, 0xF2, 0xC0, 0x09, 0x10, 0xE0, 0xF1, 0x60, 0x0A,
+  0x90, 0xF0, 0xE0, 0x10, 0x0A, 0xC0, 0xF0, 0x80, 0x0A, 0x40, 0xF1, 0x20, 0x09, 0x30, 0xD0, 0xF0,
+  0xA0, 0x08, 0xE0, 0xF2, 0xE0, 0x20, 0x08, 0xE0, 0xF0, 0xE0, 0xB0, 0x30, 0x07, 0x00, 0x80, 0xF9,
+  0x80, 0x01, 0x80, 0xF9, 0x80, 0x09, 0x80, 0xF0, 0xE0, 0x30, 0x08, 0x60, 0xF1, 0x40, 0x08, 0x50,
+  0xF1, 0x60, 0x08, 0x30, 0xE0, 0xF0, 0x80, 0x08, 0x20, 0xE0, 0xF0, 0x90, 0x08, 0x10, 0xD0, 0xF0,
+  0xB0, 0x08, 0x10, 0xC0, 0xF0, 0xC0, 0x10, 0x08, 0xB0, 0xF0, 0xD0, 0x10, 0x08, 0x90, 0xF0, 0xE0,
+  0x20, 0x08, 0x80, 0xF1, 0x30, 0x09, 0xD0, 0xF9, 0x80, 0x01, 0xD0, 0xF9, 0x80, 0x00, 0x07, 0x30,
+  0xA0, 0xD0, 0xE0, 0xF0, 0x40, 0x09, 0x20, 0xF4, 0x40, 0x09, 0x80, 0xF1, 0x50, 0x10, 0x0B, 0xB0,
+  0xF0, 0xA0, 0x0D, 0xC0, 0xF0, 0x80, 0x0D, 0xC0, 0xF0, 0x80, 0x0D, 0xC0, 0xF0, 0x80, 0x0D, 0xC0,
+  0xF0, 0x80, 0x0D, 0xD0, 0xF0, 0x80, 0x0C, 0x10, 0xF1, 0x60, 0x0B, 0x30, 0xB0, 0xF1, 0x20, 0x09,
+  0xB0, 0xF2, 0xC0, 0x40, 0x0A, 0xB0, 0xF2, 0xC0, 0x40, 0x0C, 0x30, 0xB0, 0xF0, 0xE0, 0x20, 0x0C,
+  0x10, 0xF1, 0x60, 0x0D, 0xD0, 0xF0, 0x80, 0x0D, 0xC0, 0xF0, 0x80, 0x0D, 0xC0, 0xF0, 0x80, 0x0D,
+  0xC0, 0xF0, 0x80, 0x0D, 0xC0, 0xF0, 0x80, 0x0D, 0xB0, 0xF0, 0xA0, 0x0D, 0x80, 0xF0, 0xE0, 0x50,
+  0x10, 0x0B, 0x20, 0xF4, 0x40, 0x0A, 0x30, 0xA0, 0xD0, 0xE0, 0xF0, 0x40, 0x02, 0x02, 0xB0, 0xF0,
+  0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0,
+  0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0,
+  0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0,
+  0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0,
+  0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0,
+  0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0,
+  0x70, 0x05, 0xB0, 0xF0, 0x70, 0x02, 0x02, 0xB0, 0xF0, 0xE0, 0xC0, 0x70, 0x0B, 0xB0, 0xF3, 0xA0,
+  0x0C, 0x20, 0xA0, 0xF1, 0x10, 0x0C, 0x20, 0xF1, 0x40, 0x0D, 0xF1, 0x50, 0x0D, 0xF1, 0x50, 0x0D,
+  0xF1, 0x50, 0x0D, 0xF1, 0x50, 0x0D, 0xF1, 0x60, 0x0D, 0xD0, 0xF0, 0x90, 0x0D, 0x80, 0xF1, 0x60,
+  0x10, 0x0C, 0x80, 0xE0, 0xF2, 0x40, 0x0A, 0x80, 0xE0, 0xF2, 0x40, 0x09, 0x80, 0xF1, 0x60, 0x10,
+  0x0B, 0xD0, 0xF0, 0x90, 0x0D, 0xF1, 0x60, 0x0D, 0xF1, 0x50, 0x0D, 0xF1, 0x50, 0x0D, 0xF1, 0x50,
+  0x0D, 0xF1, 0x50, 0x0C, 0x20, 0xF1, 0x40, 0x0B, 0x20, 0xA0, 0xF1, 0x10, 0x09, 0xB0, 0xF3, 0xA0,
+  0x0A, 0xB0, 0xF0, 0xE0, 0xC0, 0x70, 0x10, 0x07, 0x0F, 0x01, 0x10, 0x06, 0x20, 0x90, 0xD0, 0xF0,
+  0xD0, 0x90, 0x40, 0x05, 0x20, 0xC0, 0x05, 0x80, 0xF6, 0xD0, 0x70, 0x20, 0x00, 0x20, 0x80, 0xE0,
+  0xF0, 0x04, 0x40, 0xF0, 0xC0, 0x50, 0x11, 0x30, 0x80, 0xE0, 0xF5, 0xE0, 0x60, 0x04, 0x30, 0x70,
+  0x06, 0x50, 0xB0, 0xE0, 0xF0, 0xD0, 0x80, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x07, 0x02, 0x10, 0xF1, 0x80, 0x05, 0x10, 0xF1, 0x80, 0x05, 0x10, 0xF1, 0x80, 0x0F, 0x0F, 0x04,
+  0xD0, 0xF0, 0x40, 0x06, 0xE0, 0xF0, 0x50, 0x06, 0xE0, 0xF0, 0x60, 0x06, 0xF1, 0x70, 0x05, 0x10,
+  0xF1, 0x70, 0x05, 0x10, 0xF1, 0x80, 0x05, 0x10, 0xF1, 0x80, 0x05, 0x10, 0xF1, 0x80, 0x05, 0x10,
+  0xF1, 0x80, 0x05, 0x10, 0xF1, 0x80, 0x05, 0x10, 0xF1, 0x80, 0x05, 0x10, 0xF1, 0x80, 0x05, 0x10,
+  0xF1, 0x80, 0x02, 0x07, 0x60, 0xE0, 0x0E, 0x60, 0xE0, 0x0E, 0x60, 0xE0, 0x0E, 0x60, 0xE0, 0x0B,
+  0x20, 0x80, 0xC0, 0xF1, 0xD0, 0xB0, 0x60, 0x10, 0x06, 0x70, 0xF7, 0x70, 0x05, 0x70, 0xF1, 0xC0,
+  0x50, 0x70, 0xE0, 0x10, 0x40, 0x90, 0x60, 0x04, 0x10, 0xF1, 0xB0, 0x01, 0x60, 0xE0, 0x08, 0x70,
+  0xF1, 0x20, 0x01, 0x60, 0xE0, 0x08, 0xA0, 0xF0, 0xC0, 0x02, 0x60, 0xE0, 0x08, 0xC0, 0xF0, 0xA0,
+  0x02, 0x60, 0xE0, 0x08, 0xC0, 0xF0, 0xA0, 0x02, 0x60, 0xE0, 0x08, 0xA0, 0xF0, 0xC0, 0x02, 0x60,
+  0xE0, 0x08, 0x70, 0xF1, 0x20, 0x01, 0x60, 0xE0, 0x08, 0x10, 0xF1, 0xB0, 0x01, 0x60, 0xE0, 0x09,
+  0x70, 0xF1, 0xC0, 0x50, 0x70, 0xE0, 0x10, 0x40, 0x90, 0x60, 0x06, 0x70, 0xF7, 0x70, 0x07, 0x20,
+  0x90, 0xD0, 0xF1, 0xE0, 0xB0, 0x60, 0x10, 0x0A, 0x60, 0xE0, 0x0E, 0x60, 0xE0, 0x0E, 0x60, 0xE0,
+  0x0E, 0x60, 0xE0, 0x06, 0x05, 0x10, 0x80, 0xC0, 0xE0, 0xF0, 0xD0, 0x80, 0x30, 0x07, 0x10, 0xD0,
+  0xF6, 0x07, 0xA0, 0xF1, 0x70, 0x20, 0x00, 0x20, 0x60, 0xC0, 0x06, 0x10, 0xF1, 0x90, 0x0C, 0x40,
+  0xF1, 0x50, 0x0C, 0x50, 0xF1, 0x30, 0x0C, 0x50, 0xF1, 0x30, 0x0C, 0x50, 0xF1, 0x30, 0x0C, 0x50,
+  0xF1, 0x30, 0x0A, 0xD0, 0xF8, 0x20, 0x05, 0xD0, 0xF8, 0x20, 0x07, 0x50, 0xF1, 0x30, 0x0C, 0x50,
+  0xF1, 0x30, 0x0C, 0x50, 0xF1, 0x30, 0x0C, 0x50, 0xF1, 0x30, 0x0C, 0x50, 0xF1, 0x30, 0x0C, 0x50,
+  0xF1, 0x30, 0x09, 0x50, 0xFB, 0x40, 0x02, 0x50, 0xFB, 0x40, 0x01, 0x0F, 0x02, 0xA0, 0x30, 0x08,
+  0x80, 0x60, 0x02, 0x80, 0xF0, 0xD0, 0x20, 0x06, 0x60, 0xF1, 0x20, 0x01, 0x20, 0xE0, 0xF0, 0xC0,
+  0x30, 0xA0, 0xD0, 0xE0, 0xC0, 0x70, 0x50, 0xF1, 0x90, 0x03, 0x20, 0xE0, 0xF8, 0x90, 0x05, 0x50,
+  0xF1, 0x80, 0x20, 0x00, 0x40, 0xC0, 0xF0, 0xE0, 0x06, 0xA0, 0xF0, 0x80, 0x03, 0x10, 0xD0, 0xF0,
+  0x40, 0x05, 0xF1, 0x10, 0x04, 0x70, 0xF0, 0x80, 0x04, 0x10, 0xF0, 0xE0, 0x05, 0x50, 0xF0, 0xA0,
+  0x05, 0xF1, 0x10, 0x04, 0x70, 0xF0, 0x80, 0x05, 0xA0, 0xF0, 0x80, 0x03, 0x10, 0xE0, 0xF0, 0x40,
+  0x05, 0x50, 0xF1, 0x80, 0x20, 0x00, 0x40, 0xC0, 0xF0, 0xD0, 0x05, 0x20, 0xE0, 0xF8, 0x90, 0x03,
+  0x20, 0xE0, 0xF0, 0xC0, 0x30, 0x90, 0xD0, 0xE0, 0xC0, 0x60, 0x50, 0xF1, 0x90, 0x02, 0x80, 0xF0,
+  0xD0, 0x10, 0x06, 0x60, 0xF0, 0xE0, 0x20, 0x02, 0xA0, 0x20, 0x08, 0x70, 0x50, 0x0F, 0x02, 0x00,
+  0xA0, 0xF0, 0xB0, 0x07, 0x30, 0xF1, 0x30, 0x01, 0x20, 0xF1, 0x40, 0x06, 0xB0, 0xF0, 0x90, 0x03,
+  0x80, 0xF0, 0xC0, 0x05, 0x50, 0xF0, 0xE0, 0x10, 0x03, 0x10, 0xE0, 0xF0, 0x50, 0x04, 0xC0, 0xF0,
+  0x70, 0x05, 0x60, 0xF0, 0xD0, 0x03, 0x60, 0xF0, 0xD0, 0x07, 0xC0, 0xF0, 0x70, 0x02, 0xD0, 0xF0,
+  0x40, 0x07, 0x30, 0xF0, 0xE0, 0x10, 0x00, 0x70, 0xF0, 0xB0, 0x05, 0x40, 0xF4, 0x80, 0x10, 0xE0,
+  0xF3, 0xC0, 0x02, 0x40, 0xF4, 0xE0, 0xA0, 0xF4, 0xC0, 0x07, 0xD0, 0xF2, 0x50, 0x0B, 0x50, 0xF1,
+  0xD0, 0x0D, 0xF1, 0x80, 0x07, 0x40, 0xFB, 0xC0, 0x02, 0x40, 0xFB, 0xC0, 0x08, 0xF1, 0x80, 0x0D,
+  0xF1, 0x80, 0x0D, 0xF1, 0x80, 0x0D, 0xF1, 0x80, 0x0D, 0xF1, 0x80, 0x06, 0x02, 0xB0, 0xF0, 0x70,
+  0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70,
+  0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70,
+  0x05, 0xB0, 0xF0, 0x70, 0x0F, 0x0F, 0x00, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0,
+  0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0,
+  0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x05, 0xB0, 0xF0, 0x70, 0x02, 0x02,
+  0x20, 0x90, 0xD0, 0xE0, 0xD0, 0xB0, 0x60, 0x10, 0x03, 0x40, 0xF6, 0x80, 0x03, 0xC0, 0xF0, 0xD0,
+  0x40, 0x11, 0x40, 0x90, 0x70, 0x03, 0xF1, 0x60, 0x09, 0xD0, 0xF0, 0xA0, 0x09, 0x60, 0xF1, 0xA0,
+  0x10, 0x07, 0x10, 0xC0, 0xF1, 0xE0, 0x70, 0x05, 0x10, 0xC0, 0xF0, 0x80, 0x90, 0xF1, 0xD0, 0x40,
+  0x03, 0x80, 0xF0, 0x80, 0x01, 0x30, 0xB0, 0xF1, 0x80, 0x02, 0xC0, 0xF0, 0x40, 0x03, 0x60, 0xF1,
+  0x60, 0x01, 0xB0, 0xF0, 0x90, 0x04, 0x80, 0xF0, 0xB0, 0x01, 0x40, 0xF1, 0x90, 0x10, 0x02, 0x50,
+  0xF0, 0xB0, 0x02, 0x50, 0xE0, 0xF0, 0xD0, 0x60, 0x01, 0xB0, 0xF0, 0x60, 0x03, 0x20, 0xA0, 0xF1,
+  0xD0, 0xC0, 0xF0, 0x90, 0x06, 0x30, 0xC0, 0xF1, 0xB0, 0x09, 0x70, 0xF1, 0x70, 0x09, 0x90, 0xF0,
+  0xD0, 0x09, 0x70, 0xF0, 0xE0, 0x03, 0xA0, 0x80, 0x30, 0x11, 0x50, 0xE0, 0xF0, 0xB0, 0x03, 0xC0,
+  0xF5, 0xE0, 0x20, 0x03, 0x20, 0x70, 0xC0, 0xE0, 0xF0, 0xD0, 0x90, 0x20, 0x02, 0x01, 0x40, 0xF1,
+  0x50, 0x00, 0x50, 0xF1, 0x40, 0x03, 0x40, 0xF1, 0x50, 0x00, 0x50, 0xF1, 0x40, 0x03, 0x40, 0xF1,
+  0x50, 0x00, 0x50, 0xF1, 0x40, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0E, 0x08, 0x50, 0x90, 0xD0, 0xE1, 0xD0, 0x90, 0x50, 0x0F, 0x30, 0xC0, 0xD0, 0x70,
+  0x20, 0x11, 0x20, 0x70, 0xD0, 0xC0, 0x30, 0x0C, 0x50, 0xE0, 0x70, 0x07, 0x70, 0xE0, 0x50, 0x0A,
+  0x40, 0xF0, 0x50, 0x01, 0x50, 0xB0, 0xE0, 0xF0, 0xD0, 0x80, 0x20, 0x00, 0x50, 0xF0, 0x40, 0x08,
+  0x10, 0xE0, 0x70, 0x01, 0xA0, 0xF0, 0x80, 0x20, 0x00, 0x20, 0x60, 0xA0, 0x01, 0x70, 0xE0, 0x10,
+  0x07, 0x80, 0xD0, 0x01, 0x80, 0xF0, 0x80, 0x08, 0xD0, 0x80, 0x07, 0xE0, 0x60, 0x00, 0x10, 0xF0,
+  0xE0, 0x09, 0x60, 0xD0, 0x06, 0x30, 0xF0, 0x20, 0x00, 0x60, 0xF0, 0xA0, 0x09, 0x20, 0xF0, 0x30,
+  0x05, 0x50, 0xE0, 0x01, 0x80, 0xF0, 0x80, 0x0A, 0xF0, 0x50, 0x05, 0x60, 0xD0, 0x01, 0x90, 0xF0,
+  0x70, 0x0A, 0xE0, 0x60, 0x05, 0x50, 0xE0, 0x01, 0x80, 0xF0, 0x80, 0x0A, 0xF0, 0x50, 0x05, 0x30,
+  0xF0, 0x20, 0x00, 0x60, 0xF0, 0xA0, 0x09, 0x20, 0xF0, 0x30, 0x06, 0xE0, 0x60, 0x00, 0x10, 0xF0,
+  0xE0, 0x09, 0x60, 0xE0, 0x07, 0x80, 0xD0, 0x01, 0x80, 0xF0, 0x80, 0x08, 0xD0, 0x80, 0x07, 0x10,
+  0xE0, 0x70, 0x01, 0xA0, 0xF0, 0x90, 0x20, 0x00, 0x20, 0x60, 0x90, 0x01, 0x70, 0xE0, 0x10, 0x08,
+  0x40, 0xF0, 0x50, 0x01, 0x50, 0xB0, 0xE0, 0xF0, 0xD0, 0x90, 0x20, 0x00, 0x50, 0xF0, 0x40, 0x0A,
+  0x50, 0xE0, 0x70, 0x07, 0x70, 0xE0, 0x50, 0x0C, 0x30, 0xC0, 0xD0, 0x70, 0x20, 0x11, 0x20, 0x70,
+  0xD0, 0xC0, 0x30, 0x0F, 0x50, 0xA0, 0xD0, 0xE1, 0xD0, 0xA0, 0x50, 0x08, 0x01, 0x20, 0x80, 0xC0,
+  0xE0, 0xF0, 0xD0, 0x90, 0x10, 0x03, 0xA0, 0x70, 0x30, 0x11, 0x60, 0xE0, 0xD0, 0x10, 0x08, 0x80,
+  0xF0, 0x50, 0x02, 0x10, 0x80, 0xC0, 0xE0, 0xF3, 0x70, 0x02, 0xC0, 0xF0, 0x60, 0x20, 0x01, 0x70,
+  0xF0, 0x70, 0x01, 0x60, 0xF0, 0x80, 0x03, 0x80, 0xF0, 0x70, 0x01, 0x80, 0xF0, 0x60, 0x03, 0xB0,
+  0xF0, 0x70, 0x01, 0x60, 0xF0, 0x80, 0x02, 0x20, 0xF1, 0x70, 0x01, 0x10, 0xE1, 0x50, 0x10, 0x30,
+  0xD0, 0xF1, 0x70, 0x02, 0x20, 0xA0, 0xE0, 0xF0, 0xC0, 0x80, 0x70, 0xF0, 0x70, 0x0D, 0x40, 0xF7,
+  0x80, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x04, 0x06, 0x80, 0x03, 0x30, 0x60, 0x07, 0xA0, 0xE0, 0x02,
+  0x30, 0xE0, 0x70, 0x05, 0x10, 0xB0, 0xF0, 0xC0, 0x01, 0x40, 0xE0, 0xF0, 0x50, 0x04, 0x10, 0xC0,
+  0xF0, 0xC0, 0x10, 0x00, 0x50, 0xF1, 0x60, 0x04, 0x20, 0xD0, 0xF0, 0xB0, 0x10, 0x00, 0x70, 0xF1,
+  0x50, 0x05, 0xD0, 0xF0, 0xA0, 0x01, 0x50, 0xF0, 0xE0, 0x40, 0x06, 0xD0, 0xF0, 0xA0, 0x01, 0x50,
+  0xF0, 0xE0, 0x40, 0x06, 0x20, 0xD0, 0xF0, 0xB0, 0x10, 0x00, 0x70, 0xF1, 0x50, 0x06, 0x10, 0xC0,
+  0xF0, 0xC0, 0x10, 0x00, 0x50, 0xF1, 0x60, 0x06, 0x10, 0xB0, 0xF0, 0xC0, 0x01, 0x40, 0xE0, 0xF0,
+  0x50, 0x07, 0xA0, 0xE0, 0x02, 0x30, 0xE0, 0x70, 0x08, 0x80, 0x03, 0x30, 0x60, 0x0F, 0x01, 0x01,
+  0x40, 0xFF, 0x04, 0x40, 0xFF, 0x0F, 0x02, 0x20, 0xF1, 0x0F, 0x02, 0x20, 0xF1, 0x0F, 0x02, 0x20,
+  0xF1, 0x0F, 0x02, 0x20, 0xF1, 0x0F, 0x02, 0x20, 0xF1, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x00,
+  0xB0, 0xF5, 0x20, 0x00, 0xB0, 0xF5, 0x20, 0x0F, 0x0F, 0x0F, 0x05, 0x08, 0x50, 0x90, 0xD0, 0xE1,
+  0xD0, 0x90, 0x50, 0x0F, 0x30, 0xC0, 0xD0, 0x70, 0x20, 0x11, 0x20, 0x70, 0xD0, 0xC0, 0x30, 0x0C,
+  0x50, 0xE0, 0x70, 0x07, 0x70, 0xE0, 0x50, 0x0A, 0x40, 0xF0, 0x50, 0x00, 0xD0, 0xF2, 0xE0, 0xD0,
+  0x80, 0x10, 0x00, 0x50, 0xF0, 0x40, 0x08, 0x10, 0xE0, 0x70, 0x01, 0xD0, 0xF0, 0x10, 0x00, 0x10,
+  0x70, 0xF0, 0xB0, 0x01, 0x70, 0xE0, 0x10, 0x07, 0x80, 0xD0, 0x02, 0xD0, 0xF0, 0x10, 0x02, 0xE0,
+  0xF0, 0x20, 0x01, 0xD0, 0x80, 0x07, 0xE0, 0x60, 0x02, 0xD0, 0xF0, 0x10, 0x02, 0xE0, 0xF0, 0x20,
+  0x01, 0x60, 0xD0, 0x06, 0x30, 0xF0, 0x20, 0x02, 0xD0, 0xF0, 0x10, 0x00, 0x10, 0x70, 0xF0, 0xB0,
+  0x02, 0x20, 0xF0, 0x30, 0x05, 0x50, 0xE0, 0x03, 0xD0, 0xF3, 0xE0, 0x70, 0x04, 0xF0, 0x50, 0x05,
+  0x60, 0xD0, 0x03, 0xD0, 0xF0, 0x10, 0x20, 0xD0, 0xF0, 0x40, 0x04, 0xE0, 0x60, 0x05, 0x50, 0xE0,
+  0x03, 0xD0, 0xF0, 0x10, 0x00, 0x50, 0xF0, 0xD0, 0x04, 0xF0, 0x50, 0x05, 0x30, 0xF0, 0x20, 0x02,
+  0xD0, 0xF0, 0x10, 0x01, 0xD0, 0xF0, 0x50, 0x02, 0x20, 0xF0, 0x30, 0x06, 0xE0, 0x60, 0x02, 0xD0,
+  0xF0, 0x10, 0x01, 0x70, 0xF0, 0xB0, 0x02, 0x60, 0xE0, 0x07, 0x80, 0xD0, 0x02, 0xD0, 0xF0, 0x10,
+  0x01, 0x10, 0xF1, 0x20, 0x01, 0xD0, 0x80, 0x07, 0x10, 0xE0, 0x70, 0x01, 0xD0, 0xF0, 0x10, 0x02,
+  0xA0, 0xF0, 0x80, 0x00, 0x70, 0xE0, 0x10, 0x08, 0x40, 0xF0, 0x50, 0x00, 0xD0, 0xF0, 0x10, 0x02,
+  0x40, 0xF0, 0xD0, 0x50, 0xF0, 0x40, 0x0A, 0x50, 0xE0, 0x70, 0x07, 0x70, 0xE0, 0x50, 0x0C, 0x30,
+  0xC0, 0xD0, 0x70, 0x20, 0x11, 0x20, 0x70, 0xD0, 0xC0, 0x30, 0x0F, 0x50, 0xA0, 0xD0, 0xE1, 0xD0,
+  0xA0, 0x50, 0x08, 0x01, 0x40, 0xF6, 0x40, 0x03, 0x40, 0xF6, 0x40, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x03, 0x70, 0xD0, 0xF0, 0xD0, 0x70, 0x06,
+  0x90, 0xF4, 0x90, 0x04, 0x30, 0xF0, 0xC0, 0x30, 0x10, 0x30, 0xD0, 0xF0, 0x30, 0x03, 0x70, 0xF0,
+  0x30, 0x02, 0x30, 0xF0, 0x70, 0x03, 0x70, 0xF0, 0x30, 0x02, 0x30, 0xF0, 0x70, 0x03, 0x40, 0xF0,
+  0xC0, 0x30, 0x10, 0x30, 0xC0, 0xF0, 0x30, 0x04, 0xA0, 0xF4, 0x90, 0x06, 0x80, 0xD0, 0xF0, 0xD0,
+  0x70, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x08, 0x30, 0xF0, 0xE0, 0x0F,
+  0x02, 0x30, 0xF0, 0xE0, 0x0F, 0x02, 0x30, 0xF0, 0xE0, 0x0F, 0x02, 0x30, 0xF0, 0xE0, 0x0F, 0x02,
+  0x30, 0xF0, 0xE0, 0x0B, 0x40, 0xFF, 0x04, 0x40, 0xFF, 0x0B, 0x30, 0xF0, 0xE0, 0x0F, 0x02, 0x30,
+  0xF0, 0xE0, 0x0F, 0x02, 0x30, 0xF0, 0xE0, 0x0F, 0x02, 0x30, 0xF0, 0xE0, 0x0F, 0x02, 0x30, 0xF0,
+  0xE0, 0x0F, 0x0F, 0x0F, 0x07, 0x40, 0xFF, 0x04, 0x40, 0xFF, 0x02, 0x00, 0x20, 0x80, 0xC0, 0xE0,
+  0xD0, 0xA0, 0x20, 0x02, 0x90, 0x70, 0x20, 0x10, 0x40, 0xD0, 0xE0, 0x30, 0x06, 0x50, 0xF0, 0x90,
+  0x06, 0x50, 0xF0, 0xA0, 0x06, 0xC0, 0xF0, 0x50, 0x05, 0x80, 0xF0, 0xB0, 0x05, 0x60, 0xF0, 0xD0,
+  0x10, 0x04, 0x50, 0xF0, 0xD0, 0x20, 0x04, 0x50, 0xF0, 0xD0, 0x20, 0x04, 0x50, 0xF0, 0xD0, 0x20,
+  0x05, 0xC0, 0xF5, 0xC0, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x01, 0x60, 0xB0, 0xE1, 0xC0, 0x70,
+  0x02, 0x50, 0x80, 0x30, 0x00, 0x20, 0x90, 0xF0, 0x90, 0x06, 0x20, 0xF0, 0xC0, 0x05, 0x20, 0x90,
+  0xF0, 0x60, 0x03, 0xB0, 0xF1, 0xE0, 0x60, 0x06, 0x30, 0xB0, 0xF0, 0x60, 0x06, 0x10, 0xF0, 0xE0,
+  0x07, 0xD0, 0xF0, 0x10, 0x05, 0x10, 0xF0, 0xE0, 0x01, 0x80, 0x50, 0x20, 0x10, 0x30, 0xC0, 0xF0,
+  0x60, 0x01, 0x20, 0x80, 0xD0, 0xF0, 0xE0, 0xB0, 0x50, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x06,
+  0x20, 0xE0, 0xF0, 0x60, 0x08, 0xC0, 0xF0, 0x80, 0x08, 0x80, 0xF0, 0xB0, 0x08, 0x40, 0xF0, 0xD0,
+  0x10, 0x07, 0x10, 0xD0, 0xE0, 0x20, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x04, 0x01, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x03, 0xC0, 0xF0, 0x80,
+  0x05, 0x30, 0xF1, 0x20, 0x03, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x03, 0xC0, 0xF0, 0x80,
+  0x05, 0x30, 0xF1, 0x20, 0x03, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x03, 0xC0, 0xF0, 0x80,
+  0x05, 0x30, 0xF1, 0x20, 0x03, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x03, 0xC0, 0xF0, 0x80,
+  0x05, 0x30, 0xF1, 0x20, 0x03, 0xC0, 0xF0, 0x80, 0x05, 0x40, 0xF1, 0x20, 0x03, 0xC0, 0xF0, 0xA0,
+  0x05, 0x60, 0xF1, 0x20, 0x03, 0xC0, 0xF0, 0xE0, 0x10, 0x04, 0xC0, 0xF1, 0x20, 0x03, 0xC0, 0xF1,
+  0xC0, 0x40, 0x11, 0x40, 0xB0, 0xF2, 0x50, 0x03, 0xC0, 0xF0, 0xB0, 0xE0, 0xF4, 0x80, 0xE0, 0xF1,
+  0xE0, 0x02, 0xC0, 0xF0, 0x80, 0x30, 0xB0, 0xE0, 0xF0, 0xC0, 0x60, 0x00, 0x50, 0xE1, 0x90, 0x02,
+  0xC0, 0xF0, 0x80, 0x0D, 0xC0, 0xF0, 0x80, 0x0D, 0xC0, 0xF0, 0x80, 0x0D, 0xC0, 0xF0, 0x80, 0x0D,
+  0xC0, 0xF0, 0x80, 0x0B, 0x03, 0x20, 0x80, 0xD0, 0xE0, 0xF4, 0xB0, 0x05, 0x40, 0xE0, 0xF7, 0xB0,
+  0x04, 0x20, 0xF5, 0x80, 0x00, 0x10, 0xF0, 0xB0, 0x04, 0x90, 0xF5, 0x80, 0x00, 0x10, 0xF0, 0xB0,
+  0x04, 0xD0, 0xF5, 0x80, 0x00, 0x10, 0xF0, 0xB0, 0x04, 0xF6, 0x80, 0x00, 0x10, 0xF0, 0xB0, 0x04,
+  0xE0, 0xF5, 0x80, 0x00, 0x10, 0xF0, 0xB0, 0x04, 0xB0, 0xF5, 0x80, 0x00, 0x10, 0xF0, 0xB0, 0x04,
+  0x40, 0xF5, 0x80, 0x00, 0x10, 0xF0, 0xB0, 0x05, 0x70, 0xF4, 0x80, 0x00, 0x10, 0xF0, 0xB0, 0x06,
+  0x40, 0xB0, 0xF2, 0x80, 0x00, 0x10, 0xF0, 0xB0, 0x09, 0x60, 0xF0, 0x80, 0x00, 0x10, 0xF0, 0xB0,
+  0x09, 0x40, 0xF0, 0x80, 0x00, 0x10, 0xF0, 0xB0, 0x09, 0x40, 0xF0, 0x80, 0x00, 0x10, 0xF0, 0xB0,
+  0x09, 0x40, 0xF0, 0x80, 0x00, 0x10, 0xF0, 0xB0, 0x09, 0x40, 0xF0, 0x80, 0x00, 0x10, 0xF0, 0xB0,
+  0x09, 0x40, 0xF0, 0x80, 0x00, 0x10, 0xF0, 0xB0, 0x09, 0x40, 0xF0, 0x80, 0x00, 0x10, 0xF0, 0xB0,
+  0x09, 0x40, 0xF0, 0x80, 0x00, 0x10, 0xF0, 0xB0, 0x09, 0x40, 0xF0, 0x80, 0x00, 0x10, 0xF0, 0xB0,
+  0x09, 0x40, 0xF0, 0x80, 0x00, 0x10, 0xF0, 0xB0, 0x09, 0x40, 0xF0, 0x80, 0x00, 0x10, 0xF0, 0xB0,
+  0x02, 0x01, 0x30, 0xF1, 0x70, 0x03, 0x30, 0xF1, 0x70, 0x03, 0x30, 0xF1, 0x70, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x01, 0x05, 0x80, 0xD0, 0x10, 0x09, 0x10, 0xE0, 0x90, 0x09, 0x30, 0xE1, 0x06, 0x50, 0xF3,
+  0xC0, 0x06, 0x30, 0xC0, 0xF0, 0xE0, 0xB0, 0x20, 0x03, 0x01, 0x40, 0x90, 0xE0, 0xF0, 0x60, 0x03,
+  0x40, 0xB0, 0x60, 0x70, 0xF0, 0x60, 0x06, 0x60, 0xF0, 0x60, 0x06, 0x60, 0xF0, 0x60, 0x06, 0x60,
+  0xF0, 0x60, 0x06, 0x60, 0xF0, 0x60, 0x06, 0x60, 0xF0, 0x60, 0x06, 0x60, 0xF0, 0x60, 0x06, 0x60,
+  0xF0, 0x60, 0x06, 0x60, 0xF0, 0x60, 0x04, 0xF6, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x02, 0x50,
+  0xC0, 0xE0, 0xF0, 0xC0, 0x70, 0x04, 0x80, 0xF0, 0x90, 0x11, 0x60, 0xF0, 0xC0, 0x02, 0x40, 0xF0,
+  0xC0, 0x03, 0x80, 0xF0, 0x70, 0x01, 0x90, 0xF0, 0x60, 0x03, 0x20, 0xF0, 0xC0, 0x01, 0xB0, 0xF0,
+  0x40, 0x04, 0xF1, 0x01, 0xB0, 0xF0, 0x40, 0x04, 0xF1, 0x01, 0x90, 0xF0, 0x60, 0x03, 0x20, 0xF0,
+  0xD0, 0x01, 0x40, 0xF0, 0xC0, 0x03, 0x80, 0xF0, 0x70, 0x02, 0x90, 0xF0, 0x90, 0x11, 0x60, 0xF0,
+  0xC0, 0x04, 0x50, 0xC0, 0xE0, 0xF0, 0xD0, 0x70, 0x10, 0x0E, 0x40, 0xF7, 0x80, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x04, 0x01, 0x60, 0x20, 0x02, 0x10, 0x70, 0x08, 0x80, 0xE0, 0x30, 0x01, 0x10, 0xF0,
+  0x90, 0x07, 0x60, 0xF0, 0xE0, 0x40, 0x01, 0xD0, 0xF0, 0xA0, 0x07, 0x70, 0xF0, 0xE0, 0x40, 0x00,
+  0x20, 0xD0, 0xF0, 0xB0, 0x10, 0x06, 0x60, 0xF1, 0x50, 0x00, 0x10, 0xC0, 0xF0, 0xC0, 0x10, 0x06,
+  0x50, 0xF1, 0x40, 0x00, 0x10, 0xB0, 0xF0, 0xC0, 0x06, 0x50, 0xF1, 0x40, 0x00, 0x10, 0xB0, 0xF0,
+  0xC0, 0x05, 0x60, 0xF1, 0x60, 0x00, 0x10, 0xC0, 0xF0, 0xC0, 0x10, 0x04, 0x70, 0xF0, 0xE0, 0x40,
+  0x00, 0x20, 0xD0, 0xF0, 0xB0, 0x10, 0x04, 0x60, 0xF0, 0xE0, 0x40, 0x01, 0xD0, 0xF0, 0xA0, 0x06,
+  0x80, 0xE0, 0x30, 0x01, 0x10, 0xF0, 0x90, 0x07, 0x60, 0x20, 0x02, 0x10, 0x80, 0x0F, 0x06, 0x01,
+  0x40, 0x90, 0xE0, 0xF0, 0x60, 0x09, 0xC0, 0xF0, 0x30, 0x05, 0x40, 0xB0, 0x60, 0x70, 0xF0, 0x60,
+  0x08, 0x70, 0xF0, 0x90, 0x09, 0x60, 0xF0, 0x60, 0x07, 0x20, 0xE1, 0x10, 0x09, 0x60, 0xF0, 0x60,
+  0x07, 0xA0, 0xF0, 0x50, 0x0A, 0x60, 0xF0, 0x60, 0x06, 0x50, 0xF0, 0xB0, 0x0B, 0x60, 0xF0, 0x60,
+  0x05, 0x10, 0xD0, 0xF0, 0x20, 0x0B, 0x60, 0xF0, 0x60, 0x05, 0x80, 0xF0, 0x70, 0x0C, 0x60, 0xF0,
+  0x60, 0x04, 0x30, 0xF0, 0xD0, 0x0D, 0x60, 0xF0, 0x60, 0x04, 0xC0, 0xF0, 0x40, 0x04, 0xC0, 0xF0,
+  0xA0, 0x05, 0x60, 0xF0, 0x60, 0x03, 0x60, 0xF0, 0x90, 0x04, 0x90, 0xE0, 0xF0, 0xA0, 0x03, 0xF6,
+  0x00, 0x20, 0xE1, 0x10, 0x03, 0x50, 0xF0, 0x50, 0xF0, 0xA0, 0x0B, 0xA0, 0xF0, 0x50, 0x03, 0x30,
+  0xE0, 0x60, 0x30, 0xF0, 0xA0, 0x0A, 0x40, 0xF0, 0xB0, 0x03, 0x10, 0xD0, 0xB0, 0x00, 0x30, 0xF0,
+  0xA0, 0x09, 0x10, 0xD0, 0xF0, 0x20, 0x03, 0xA0, 0xE0, 0x10, 0x00, 0x30, 0xF0, 0xA0, 0x09, 0x80,
+  0xF0, 0x70, 0x03, 0x50, 0xF0, 0x40, 0x01, 0x30, 0xF0, 0xA0, 0x08, 0x30, 0xF0, 0xD0, 0x04, 0x70,
+  0xF7, 0x50, 0x06, 0xC0, 0xF0, 0x40, 0x09, 0x30, 0xF0, 0xA0, 0x07, 0x60, 0xF0, 0x90, 0x0A, 0x30,
+  0xF0, 0xA0, 0x06, 0x10, 0xE1, 0x10, 0x0A, 0x30, 0xF0, 0xA0, 0x01, 0x01, 0x40, 0x90, 0xE0, 0xF0,
+  0x60, 0x09, 0xC0, 0xF0, 0x30, 0x05, 0x40, 0xB0, 0x60, 0x70, 0xF0, 0x60, 0x08, 0x70, 0xF0, 0x90,
+  0x09, 0x60, 0xF0, 0x60, 0x07, 0x20, 0xE1, 0x10, 0x09, 0x60, 0xF0, 0x60, 0x07, 0xA0, 0xF0, 0x50,
+  0x0A, 0x60, 0xF0, 0x60, 0x06, 0x50, 0xF0, 0xB0, 0x0B, 0x60, 0xF0, 0x60, 0x05, 0x10, 0xD0, 0xF0,
+  0x20, 0x0B, 0x60, 0xF0, 0x60, 0x05, 0x80, 0xF0, 0x70, 0x0C, 0x60, 0xF0, 0x60, 0x04, 0x30, 0xF0,
+  0xD0, 0x0D, 0x60, 0xF0, 0x60, 0x04, 0xC0, 0xF0, 0x40, 0x00, 0x30, 0x90, 0xD0, 0xE0, 0xD0, 0x80,
+  0x10, 0x05, 0x60, 0xF0, 0x60, 0x03, 0x60, 0xF0, 0x90, 0x01, 0xB0, 0x50, 0x20, 0x10, 0x50, 0xF0,
+  0xD0, 0x10, 0x02, 0xF6, 0x00, 0x20, 0xE1, 0x10, 0x06, 0x90, 0xF0, 0x50, 0x0A, 0xA0, 0xF0, 0x50,
+  0x07, 0x80, 0xF0, 0x60, 0x09, 0x40, 0xF0, 0xB0, 0x07, 0x20, 0xE0, 0xF0, 0x20, 0x08, 0x10, 0xD0,
+  0xF0, 0x20, 0x07, 0xB0, 0xF0, 0x70, 0x09, 0x80, 0xF0, 0x70, 0x07, 0x90, 0xF0, 0xB0, 0x09, 0x30,
+  0xF0, 0xD0, 0x07, 0x80, 0xF0, 0xB0, 0x10, 0x09, 0xC0, 0xF0, 0x40, 0x06, 0x80, 0xF0, 0xB0, 0x10,
+  0x09, 0x60, 0xF0, 0x90, 0x06, 0x80, 0xF0, 0xA0, 0x0A, 0x10, 0xE1, 0x10, 0x05, 0x10, 0xF6, 0x80,
+  0x00, 0x01, 0x60, 0xB0, 0xE1, 0xC0, 0x70, 0x08, 0xC0, 0xF0, 0x30, 0x05, 0x50, 0x80, 0x30, 0x00,
+  0x20, 0x90, 0xF0, 0x90, 0x06, 0x70, 0xF0, 0x90, 0x0B, 0x20, 0xF0, 0xC0, 0x05, 0x20, 0xE1, 0x10,
+  0x0A, 0x20, 0x90, 0xF0, 0x60, 0x05, 0xA0, 0xF0, 0x50, 0x09, 0xB0, 0xF1, 0xE0, 0x60, 0x05, 0x50,
+  0xF0, 0xB0, 0x0C, 0x30, 0xB0, 0xF0, 0x60, 0x03, 0x10, 0xD0, 0xF0, 0x20, 0x0D, 0x10, 0xF0, 0xE0,
+  0x03, 0x80, 0xF0, 0x70, 0x0F, 0xD0, 0xF0, 0x10, 0x01, 0x30, 0xF0, 0xD0, 0x0F, 0x10, 0xF0, 0xE0,
+  0x02, 0xC0, 0xF0, 0x40, 0x04, 0xC0, 0xF0, 0xA0, 0x02, 0x80, 0x50, 0x20, 0x10, 0x30, 0xC0, 0xF0,
+  0x60, 0x01, 0x60, 0xF0, 0x90, 0x04, 0x90, 0xE0, 0xF0, 0xA0, 0x02, 0x20, 0x80, 0xD0, 0xF0, 0xE0,
+  0xB0, 0x50, 0x01, 0x20, 0xE1, 0x10, 0x03, 0x50, 0xF0, 0x50, 0xF0, 0xA0, 0x0B, 0xA0, 0xF0, 0x50,
+  0x03, 0x30, 0xE0, 0x60, 0x30, 0xF0, 0xA0, 0x0A, 0x40, 0xF0, 0xB0, 0x03, 0x10, 0xD0, 0xB0, 0x00,
+  0x30, 0xF0, 0xA0, 0x09, 0x10, 0xD0, 0xF0, 0x20, 0x03, 0xA0, 0xE0, 0x10, 0x00, 0x30, 0xF0, 0xA0,
+  0x09, 0x80, 0xF0, 0x70, 0x03, 0x50, 0xF0, 0x40, 0x01, 0x30, 0xF0, 0xA0, 0x08, 0x30, 0xF0, 0xD0,
+  0x04, 0x70, 0xF7, 0x50, 0x06, 0xC0, 0xF0, 0x40, 0x09, 0x30, 0xF0, 0xA0, 0x07, 0x60, 0xF0, 0x90,
+  0x0A, 0x30, 0xF0, 0xA0, 0x06, 0x10, 0xE1, 0x10, 0x0A, 0x30, 0xF0, 0xA0, 0x01, 0x05, 0xB0, 0xF0,
+  0xD0, 0x0A, 0xB0, 0xF0, 0xD0, 0x0A, 0xB0, 0xF0, 0xD0, 0x0F, 0x0F, 0x06, 0xA0, 0xF0, 0xC0, 0x0A,
+  0xA0, 0xF0, 0xB0, 0x0A, 0xB0, 0xF0, 0xB0, 0x09, 0x10, 0xE0, 0xF0, 0x80, 0x08, 0x10, 0xC0, 0xF0,
+  0xE0, 0x20, 0x07, 0x10, 0xC0, 0xF0, 0xE0, 0x30, 0x07, 0x10, 0xC0, 0xF0, 0xE0, 0x30, 0x08, 0x90,
+  0xF1, 0x30, 0x08, 0x10, 0xF1, 0x90, 0x09, 0x20, 0xF1, 0x70, 0x09, 0x10, 0xF1, 0xA0, 0x04, 0x10,
+  0x90, 0x03, 0xB0, 0xF1, 0x90, 0x20, 0x00, 0x20, 0x70, 0xE1, 0x03, 0x20, 0xD0, 0xF5, 0xE0, 0x50,
+  0x04, 0x10, 0x80, 0xD0, 0xF0, 0xE0, 0xC0, 0x70, 0x10, 0x02, 0x05, 0xA0, 0xF0, 0x90, 0x0F, 0xB0,
+  0xF0, 0x60, 0x0F, 0xB0, 0xF0, 0x40, 0x0F, 0x0F, 0x0F, 0x01, 0xB0, 0xF1, 0x80, 0x0C, 0x20, 0xF2,
+  0xE0, 0x0C, 0x80, 0xF0, 0xE0, 0xF1, 0x40, 0x0B, 0xD0, 0xF0, 0x80, 0xB0, 0xF0, 0xA0, 0x0A, 0x40,
+  0xF1, 0x20, 0x60, 0xF1, 0x10, 0x09, 0xA0, 0xF0, 0xC0, 0x00, 0x10, 0xE0, 0xF0, 0x70, 0x08, 0x10,
+  0xF1, 0x60, 0x01, 0xA0, 0xF0, 0xC0, 0x08, 0x60, 0xF1, 0x10, 0x01, 0x40, 0xF1, 0x30, 0x07, 0xC0,
+  0xF0, 0xA0, 0x03, 0xE0, 0xF0, 0x90, 0x06, 0x30, 0xF1, 0x50, 0x03, 0x80, 0xF0, 0xE0, 0x06, 0x80,
+  0xF0, 0xE0, 0x04, 0x30, 0xF1, 0x50, 0x05, 0xE0, 0xF0, 0x90, 0x05, 0xC0, 0xF0, 0xB0, 0x04, 0x50,
+  0xFB, 0x20, 0x03, 0xB0, 0xFB, 0x70, 0x02, 0x10, 0xF1, 0x70, 0x07, 0xA0, 0xF0, 0xD0, 0x02, 0x70,
+  0xF1, 0x20, 0x07, 0x50, 0xF1, 0x40, 0x01, 0xD0, 0xF0, 0xC0, 0x09, 0xE0, 0xF0, 0x90, 0x00, 0x30,
+  0xF1, 0x60, 0x09, 0x90, 0xF0, 0xE0, 0x10, 0x90, 0xF1, 0x10, 0x09, 0x40, 0xF1, 0x60, 0x07, 0x10,
+  0xC0, 0xF0, 0x70, 0x0D, 0xA0, 0xF0, 0x70, 0x0D, 0x70, 0xF0, 0x80, 0x0F, 0x0F, 0x0F, 0x02, 0xB0,
+  0xF1, 0x80, 0x0C, 0x20, 0xF2, 0xE0, 0x0C, 0x80, 0xF0, 0xE0, 0xF1, 0x40, 0x0B, 0xD0, 0xF0, 0x80,
+  0xB0, 0xF0, 0xA0, 0x0A, 0x40, 0xF1, 0x20, 0x60, 0xF1, 0x10, 0x09, 0xA0, 0xF0, 0xC0, 0x00, 0x10,
+  0xE0, 0xF0, 0x70, 0x08, 0x10, 0xF1, 0x60, 0x01, 0xA0, 0xF0, 0xC0, 0x08, 0x60, 0xF1, 0x10, 0x01,
+  0x40, 0xF1, 0x30, 0x07, 0xC0, 0xF0, 0xA0, 0x03, 0xE0, 0xF0, 0x90, 0x06, 0x30, 0xF1, 0x50, 0x03,
+  0x80, 0xF0, 0xE0, 0x06, 0x80, 0xF0, 0xE0, 0x04, 0x30, 0xF1, 0x50, 0x05, 0xE0, 0xF0, 0x90, 0x05,
+  0xC0, 0xF0, 0xB0, 0x04, 0x50, 0xFB, 0x20, 0x03, 0xB0, 0xFB, 0x70, 0x02, 0x10, 0xF1, 0x70, 0x07,
+  0xA0, 0xF0, 0xD0, 0x02, 0x70, 0xF1, 0x20, 0x07, 0x50, 0xF1, 0x40, 0x01, 0xD0, 0xF0, 0xC0, 0x09,
+  0xE0, 0xF0, 0x90, 0x00, 0x30, 0xF1, 0x60, 0x09, 0x90, 0xF0, 0xE0, 0x10, 0x90, 0xF1, 0x10, 0x09,
+  0x40, 0xF1, 0x60, 0x06, 0xB0, 0xF1, 0x80, 0x0C, 0xA0, 0xF0, 0x60, 0x90, 0xF0, 0x60, 0x0A, 0x80,
+  0xF0, 0x50, 0x01, 0x80, 0xF0, 0x50, 0x0F, 0x0F, 0x0F, 0xB0, 0xF1, 0x80, 0x0C, 0x20, 0xF2, 0xE0,
+  0x0C, 0x80, 0xF0, 0xE0, 0xF1, 0x40, 0x0B, 0xD0, 0xF0, 0x80, 0xB0, 0xF0, 0xA0, 0x0A, 0x40, 0xF1,
+  0x20, 0x60, 0xF1, 0x10, 0x09, 0xA0, 0xF0, 0xC0, 0x00, 0x10, 0xE0, 0xF0, 0x70, 0x08, 0x10, 0xF1,
+  0x60, 0x01, 0xA0, 0xF0, 0xC0, 0x08, 0x60, 0xF1, 0x10, 0x01, 0x40, 0xF1, 0x30, 0x07, 0xC0, 0xF0,
+  0xA0, 0x03, 0xE0, 0xF0, 0x90, 0x06, 0x30, 0xF1, 0x50, 0x03, 0x80, 0xF0, 0xE0, 0x06, 0x80, 0xF0,
+  0xE0, 0x04, 0x30, 0xF1, 0x50, 0x05, 0xE0, 0xF0, 0x90, 0x05, 0xC0, 0xF0, 0xB0, 0x04, 0x50, 0xFB,
+  0x20, 0x03, 0xB0, 0xFB, 0x70, 0x02, 0x10, 0xF1, 0x70, 0x07, 0xA0, 0xF0, 0xD0, 0x02, 0x70, 0xF1,
+  0x20, 0x07, 0x50, 0xF1, 0x40, 0x01, 0xD0, 0xF0, 0xC0, 0x09, 0xE0, 0xF0, 0x90, 0x00, 0x30, 0xF1,
+  0x60, 0x09, 0x90, 0xF0, 0xE0, 0x10, 0x90, 0xF1, 0x10, 0x09, 0x40, 0xF1, 0x60, 0x04, 0x40, 0xD0,
+  0xE0, 0xB0, 0x50, 0x10, 0xA0, 0xF0, 0x08, 0x10, 0xE0, 0xF5, 0xB0, 0x08, 0x30, 0xF0, 0x80, 0x10,
+  0x60, 0xC0, 0xF0, 0xC0, 0x20, 0x0F, 0x0F, 0x0F, 0xB0, 0xF1, 0x80, 0x0C, 0x20, 0xF2, 0xE0, 0x0C,
+  0x80, 0xF0, 0xE0, 0xF1, 0x40, 0x0B, 0xD0, 0xF0, 0x80, 0xB0, 0xF0, 0xA0, 0x0A, 0x40, 0xF1, 0x20,
+  0x60, 0xF1, 0x10, 0x09, 0xA0, 0xF0, 0xC0, 0x00, 0x10, 0xE0, 0xF0, 0x70, 0x08, 0x10, 0xF1, 0x60,
+  0x01, 0xA0, 0xF0, 0xC0, 0x08, 0x60, 0xF1, 0x10, 0x01, 0x40, 0xF1, 0x30, 0x07, 0xC0, 0xF0, 0xA0,
+  0x03, 0xE0, 0xF0, 0x90, 0x06, 0x30, 0xF1, 0x50, 0x03, 0x80, 0xF0, 0xE0, 0x06, 0x80, 0xF0, 0xE0,
+  0x04, 0x30, 0xF1, 0x50, 0x05, 0xE0, 0xF0, 0x90, 0x05, 0xC0, 0xF0, 0xB0, 0x04, 0x50, 0xFB, 0x20,
+  0x03, 0xB0, 0xFB, 0x70, 0x02, 0x10, 0xF1, 0x70, 0x07, 0xA0, 0xF0, 0xD0, 0x02, 0x70, 0xF1, 0x20,
+  0x07, 0x50, 0xF1, 0x40, 0x01, 0xD0, 0xF0, 0xC0, 0x09, 0xE0, 0xF0, 0x90, 0x00, 0x30, 0xF1, 0x60,
+  0x09, 0x90, 0xF0, 0xE0, 0x10, 0x90, 0xF1, 0x10, 0x09, 0x40, 0xF1, 0x60, 0x04, 0xD0, 0xF0, 0xB0,
+  0x01, 0xE0, 0xF0, 0xA0, 0x09, 0xD0, 0xF0, 0xB0, 0x01, 0xE0, 0xF0, 0xA0, 0x09, 0xD0, 0xF0, 0xB0,
+  0x01, 0xE0, 0xF0, 0xA0, 0x0F, 0x0F, 0x0F, 0xB0, 0xF1, 0x80, 0x0C, 0x20, 0xF2, 0xE0, 0x0C, 0x80,
+  0xF0, 0xE0, 0xF1, 0x40, 0x0B, 0xD0, 0xF0, 0x80, 0xB0, 0xF0, 0xA0, 0x0A, 0x40, 0xF1, 0x20, 0x60,
+  0xF1, 0x10, 0x09, 0xA0, 0xF0, 0xC0, 0x00, 0x10, 0xE0, 0xF0, 0x70, 0x08, 0x10, 0xF1, 0x60, 0x01,
+  0xA0, 0xF0, 0xC0, 0x08, 0x60, 0xF1, 0x10, 0x01, 0x40, 0xF1, 0x30, 0x07, 0xC0, 0xF0, 0xA0, 0x03,
+  0xE0, 0xF0, 0x90, 0x06, 0x30, 0xF1, 0x50, 0x03, 0x80, 0xF0, 0xE0, 0x06, 0x80, 0xF0, 0xE0, 0x04,
+  0x30, 0xF1, 0x50, 0x05, 0xE0, 0xF0, 0x90, 0x05, 0xC0, 0xF0, 0xB0, 0x04, 0x50, 0xFB, 0x20, 0x03,
+  0xB0, 0xFB, 0x70, 0x02, 0x10, 0xF1, 0x70, 0x07, 0xA0, 0xF0, 0xD0, 0x02, 0x70, 0xF1, 0x20, 0x07,
+  0x50, 0xF1, 0x40, 0x01, 0xD0, 0xF0, 0xC0, 0x09, 0xE0, 0xF0, 0x90, 0x00, 0x30, 0xF1, 0x60, 0x09,
+  0x90, 0xF0, 0xE0, 0x10, 0x90, 0xF1, 0x10, 0x09, 0x40, 0xF1, 0x60, 0x05, 0x20, 0xA0, 0xE0, 0xD0,
+  0x80, 0x10, 0x0A, 0x10, 0xE0, 0xF3, 0xC0, 0x0A, 0x70, 0xF0, 0x80, 0x10, 0x20, 0xB0, 0xF0, 0x40,
+  0x09, 0x80, 0xF0, 0x02, 0x40, 0xF0, 0x50, 0x09, 0x50, 0xF0, 0x80, 0x10, 0x20, 0xB0, 0xF0, 0x20,
+  0x0A, 0x90, 0xF3, 0x60, 0x0B, 0x30, 0xF2, 0xE0, 0x10, 0x0B, 0x90, 0xF0, 0xD0, 0xF1, 0x60, 0x0B,
+  0xE0, 0xF0, 0x70, 0xA0, 0xF0, 0xB0, 0x0A, 0x50, 0xF1, 0x20, 0x50, 0xF1, 0x20, 0x09, 0xB0, 0xF0,
+  0xB0, 0x01, 0xE0, 0xF0, 0x70, 0x08, 0x20, 0xF1, 0x60, 0x01, 0x90, 0xF0, 0xD0, 0x08, 0x70, 0xF1,
+  0x10, 0x01, 0x40, 0xF1, 0x40, 0x07, 0xD0, 0xF0, 0xA0, 0x03, 0xD0, 0xF0, 0x90, 0x06, 0x30, 0xF1,
+  0x50, 0x03, 0x80, 0xF0, 0xE0, 0x10, 0x05, 0x90, 0xF0, 0xE0, 0x04, 0x30, 0xF1, 0x60, 0x04, 0x10,
+  0xE0, 0xF0, 0x90, 0x05, 0xC0, 0xF0, 0xB0, 0x04, 0x50, 0xFB, 0x20, 0x03, 0xB0, 0xFB, 0x80, 0x02,
+  0x20, 0xF1, 0x70, 0x07, 0xA0, 0xF0, 0xD0, 0x02, 0x70, 0xF1, 0x20, 0x07, 0x50, 0xF1, 0x40, 0x01,
+  0xD0, 0xF0, 0xC0, 0x09, 0xE0, 0xF0, 0xA0, 0x00, 0x40, 0xF1, 0x60, 0x09, 0x90, 0xF0, 0xE0, 0x10,
+  0x90, 0xF1, 0x10, 0x09, 0x40, 0xF1, 0x60, 0x06, 0x30, 0xFE, 0x60, 0x07, 0x90, 0xFE, 0x60, 0x06,
+  0x10, 0xE0, 0xF0, 0x90, 0x00, 0x80, 0xF1, 0x0F, 0x00, 0x60, 0xF1, 0x30, 0x00, 0x80, 0xF1, 0x0F,
+  0x00, 0xD0, 0xF0, 0xB0, 0x01, 0x80, 0xF1, 0x0F, 0x40, 0xF1, 0x50, 0x01, 0x80, 0xF1, 0x0F, 0xA0,
+  0xF0, 0xD0, 0x02, 0x80, 0xF1, 0x0E, 0x20, 0xF1, 0x70, 0x02, 0x80, 0xF1, 0x0E, 0x80, 0xF1, 0x10,
+  0x02, 0x80, 0xFA, 0x10, 0x04, 0xE0, 0xF0, 0xA0, 0x03, 0x80, 0xFA, 0x10, 0x03, 0x50, 0xF1, 0x40,
+  0x03, 0x80, 0xF1, 0x0D, 0xC0, 0xF0, 0xC0, 0x04, 0x80, 0xF1, 0x0C, 0x30, 0xFA, 0x0C, 0x90, 0xFA,
+  0x0B, 0x10, 0xE0, 0xF0, 0x80, 0x05, 0x80, 0xF1, 0x0B, 0x70, 0xF1, 0x20, 0x05, 0x80, 0xF1, 0x0B,
+  0xD0, 0xF0, 0xB0, 0x06, 0x80, 0xF1, 0x0A, 0x40, 0xF1, 0x50, 0x06, 0x80, 0xFA, 0xA0, 0x00, 0xA0,
+  0xF0, 0xD0, 0x07, 0x80, 0xFA, 0xA0, 0x00, 0x05, 0x30, 0x80, 0xC0, 0xE0, 0xF0, 0xE0, 0xD0, 0x90,
+  0x40, 0x06, 0x10, 0xA0, 0xF8, 0xC0, 0x30, 0x03, 0x20, 0xD0, 0xF1, 0xB0, 0x50, 0x20, 0x00, 0x10,
+  0x30, 0x90, 0xE0, 0xF0, 0xB0, 0x03, 0xC0, 0xF1, 0x60, 0x06, 0x20, 0xB1, 0x02, 0x60, 0xF1, 0x70,
+  0x09, 0x70, 0x02, 0xD0, 0xF0, 0xE0, 0x0D, 0x30, 0xF1, 0x80, 0x0D, 0x60, 0xF1, 0x50, 0x0D, 0x70,
+  0xF1, 0x30, 0x0D, 0x80, 0xF1, 0x30, 0x0D, 0x70, 0xF1, 0x30, 0x0D, 0x60, 0xF1, 0x50, 0x0D, 0x30,
+  0xF1, 0x80, 0x0E, 0xD0, 0xF0, 0xE0, 0x0E, 0x60, 0xF1, 0x70, 0x09, 0x70, 0x03, 0xC0, 0xF1, 0x60,
+  0x06, 0x20, 0xB1, 0x03, 0x20, 0xD0, 0xF1, 0xB0, 0x50, 0x20, 0x00, 0x10, 0x30, 0x80, 0xE0, 0xF0,
+  0xB0, 0x04, 0x10, 0xA0, 0xF8, 0xC0, 0x30, 0x06, 0x30, 0x80, 0xC0, 0xE0, 0xF0, 0xE0, 0xC0, 0x90,
+  0x40, 0x0C, 0xB0, 0xC0, 0x0F, 0x20, 0xF0, 0x60, 0x0E, 0x40, 0xF0, 0xB0, 0x0B, 0x70, 0xF3, 0x90,
+  0x0B, 0x50, 0xD0, 0xF0, 0xE0, 0xA0, 0x10, 0x04, 0x04, 0x30, 0xE0, 0xF0, 0x30, 0x0C, 0x30, 0xE1,
+  0x20, 0x0C, 0x30, 0xE0, 0xC0, 0x10, 0x0F, 0x0F, 0x06, 0x70, 0xFA, 0x80, 0x02, 0x70, 0xFA, 0x80,
+  0x02, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20,
+  0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xFA, 0x20, 0x02, 0x70, 0xFA, 0x20,
+  0x02, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20,
+  0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xFA, 0xC0,
+  0x02, 0x70, 0xFA, 0xC0, 0x00, 0x07, 0x40, 0xF0, 0xE0, 0x20, 0x0A, 0x20, 0xE1, 0x30, 0x0A, 0x10,
+  0xC0, 0xE0, 0x30, 0x0F, 0x0F, 0x07, 0x70, 0xFA, 0x80, 0x02, 0x70, 0xFA, 0x80, 0x02, 0x70, 0xF1,
+  0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1,
+  0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xFA, 0x20, 0x02, 0x70, 0xFA, 0x20, 0x02, 0x70, 0xF1,
+  0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1,
+  0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xFA, 0xC0, 0x02, 0x70, 0xFA,
+  0xC0, 0x00, 0x05, 0x30, 0xE0, 0xF0, 0xE0, 0x30, 0x09, 0x20, 0xE0, 0xD0, 0x40, 0xD0, 0xE0, 0x20,
+  0x07, 0x10, 0xD0, 0xC0, 0x10, 0x00, 0x10, 0xC0, 0xD0, 0x10, 0x0F, 0x0F, 0x04, 0x70, 0xFA, 0x80,
+  0x02, 0x70, 0xFA, 0x80, 0x02, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20,
+  0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xFA, 0x20,
+  0x02, 0x70, 0xFA, 0x20, 0x02, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20,
+  0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20,
+  0x0B, 0x70, 0xFA, 0xC0, 0x02, 0x70, 0xFA, 0xC0, 0x00, 0x03, 0x40, 0xF1, 0x50, 0x00, 0x50, 0xF1,
+  0x40, 0x06, 0x40, 0xF1, 0x50, 0x00, 0x50, 0xF1, 0x40, 0x06, 0x40, 0xF1, 0x50, 0x00, 0x50, 0xF1,
+  0x40, 0x0F, 0x0F, 0x04, 0x70, 0xFA, 0x80, 0x02, 0x70, 0xFA, 0x80, 0x02, 0x70, 0xF1, 0x20, 0x0B,
+  0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B,
+  0x70, 0xF1, 0x20, 0x0B, 0x70, 0xFA, 0x20, 0x02, 0x70, 0xFA, 0x20, 0x02, 0x70, 0xF1, 0x20, 0x0B,
+  0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B,
+  0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xFA, 0xC0, 0x02, 0x70, 0xFA, 0xC0, 0x00,
+  0x00, 0xB0, 0xF0, 0x80, 0x04, 0x10, 0xB0, 0xF0, 0x50, 0x04, 0x10, 0xC0, 0xF0, 0x30, 0x0F, 0x03,
+  0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03,
+  0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03,
+  0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03,
+  0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03,
+  0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x01, 0x02, 0x10, 0xC0, 0xF0,
+  0x60, 0x03, 0xB0, 0xF0, 0x70, 0x03, 0x80, 0xF0, 0x70, 0x0F, 0x04, 0x70, 0xF1, 0x20, 0x03, 0x70,
+  0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70,
+  0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70,
+  0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70,
+  0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70,
+  0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x01, 0x02, 0xB0, 0xF1, 0x70, 0x03, 0xA0, 0xF0, 0x50, 0x90,
+  0xF0, 0x60, 0x01, 0x90, 0xF0, 0x40, 0x01, 0x90, 0xF0, 0x40, 0x0F, 0x04, 0x70, 0xF1, 0x20, 0x04,
+  0x70, 0xF1, 0x20, 0x04, 0x70, 0xF1, 0x20, 0x04, 0x70, 0xF1, 0x20, 0x04, 0x70, 0xF1, 0x20, 0x04,
+  0x70, 0xF1, 0x20, 0x04, 0x70, 0xF1, 0x20, 0x04, 0x70, 0xF1, 0x20, 0x04, 0x70, 0xF1, 0x20, 0x04,
+  0x70, 0xF1, 0x20, 0x04, 0x70, 0xF1, 0x20, 0x04, 0x70, 0xF1, 0x20, 0x04, 0x70, 0xF1, 0x20, 0x04,
+  0x70, 0xF1, 0x20, 0x04, 0x70, 0xF1, 0x20, 0x04, 0x70, 0xF1, 0x20, 0x04, 0x70, 0xF1, 0x20, 0x04,
+  0x70, 0xF1, 0x20, 0x04, 0x70, 0xF1, 0x20, 0x01, 0xE0, 0xF0, 0xA0, 0x01, 0xF1, 0x90, 0xE0, 0xF0,
+  0xA0, 0x01, 0xF1, 0x90, 0xE0, 0xF0, 0xA0, 0x01, 0xF1, 0x90, 0x0F, 0x01, 0x70, 0xF1, 0x20, 0x03,
+  0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03,
+  0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03,
+  0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03,
+  0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x03,
+  0x70, 0xF1, 0x20, 0x03, 0x70, 0xF1, 0x20, 0x01, 0x01, 0x50, 0xF5, 0xE0, 0xD0, 0xA0, 0x70, 0x20,
+  0x07, 0x50, 0xFA, 0xB0, 0x20, 0x05, 0x50, 0xF1, 0x40, 0x02, 0x10, 0x30, 0x60, 0xC0, 0xF1, 0xE0,
+  0x30, 0x04, 0x50, 0xF1, 0x40, 0x06, 0x60, 0xF1, 0xE0, 0x20, 0x03, 0x50, 0xF1, 0x40, 0x07, 0x60,
+  0xF1, 0x90, 0x03, 0x50, 0xF1, 0x40, 0x08, 0xC0, 0xF1, 0x10, 0x02, 0x50, 0xF1, 0x40, 0x08, 0x70,
+  0xF1, 0x40, 0x02, 0x50, 0xF1, 0x40, 0x08, 0x40, 0xF1, 0x70, 0x00, 0xD0, 0xF7, 0x80, 0x04, 0x20,
+  0xF1, 0x80, 0x00, 0xD0, 0xF7, 0x80, 0x04, 0x20, 0xF1, 0x90, 0x02, 0x50, 0xF1, 0x40, 0x08, 0x20,
+  0xF1, 0x80, 0x02, 0x50, 0xF1, 0x40, 0x08, 0x40, 0xF1, 0x70, 0x02, 0x50, 0xF1, 0x40, 0x08, 0x70,
+  0xF1, 0x40, 0x02, 0x50, 0xF1, 0x40, 0x08, 0xD0, 0xF1, 0x10, 0x02, 0x50, 0xF1, 0x40, 0x07, 0x60,
+  0xF1, 0x90, 0x03, 0x50, 0xF1, 0x40, 0x06, 0x60, 0xF1, 0xE0, 0x20, 0x03, 0x50, 0xF1, 0x40, 0x02,
+  0x10, 0x30, 0x60, 0xC0, 0xF1, 0xE0, 0x30, 0x04, 0x50, 0xFA, 0xA0, 0x20, 0x05, 0x50, 0xF5, 0xE0,
+  0xD0, 0xA0, 0x70, 0x20, 0x05, 0x05, 0x60, 0xE1, 0xA0, 0x40, 0x10, 0xD0, 0xC0, 0x09, 0x20, 0xF6,
+  0x90, 0x09, 0x60, 0xF0, 0x50, 0x20, 0x70, 0xD0, 0xE0, 0xB0, 0x10, 0x0F, 0x0F, 0x0C, 0x70, 0xF2,
+  0x40, 0x06, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF2, 0xC0, 0x06, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF3,
+  0x50, 0x05, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0xC0, 0xF0, 0xD0, 0x05, 0x90, 0xF0, 0xD0, 0x03,
+  0x70, 0xF1, 0x40, 0xF1, 0x60, 0x04, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0xA0, 0xF0, 0xD0,
+  0x04, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x30, 0xF1, 0x70, 0x03, 0x90, 0xF0, 0xD0, 0x03,
+  0x70, 0xF1, 0x10, 0x00, 0xA0, 0xF0, 0xE0, 0x10, 0x02, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10,
+  0x00, 0x20, 0xF1, 0x70, 0x02, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x01, 0x90, 0xF0, 0xE0,
+  0x10, 0x01, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x01, 0x10, 0xE0, 0xF0, 0x80, 0x01, 0x90,
+  0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x02, 0x80, 0xF1, 0x20, 0x00, 0x90, 0xF0, 0xD0, 0x03, 0x70,
+  0xF1, 0x10, 0x02, 0x10, 0xE0, 0xF0, 0x90, 0x00, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x03,
+  0x70, 0xF1, 0x20, 0x90, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x03, 0x10, 0xE0, 0xF0, 0xA0, 0x90,
+  0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x04, 0x60, 0xF1, 0xC0, 0xF0, 0xD0, 0x03, 0x70, 0xF1, 0x10,
+  0x05, 0xD0, 0xF2, 0xD0, 0x03, 0x70, 0xF1, 0x10, 0x05, 0x50, 0xF2, 0xD0, 0x03, 0x70, 0xF1, 0x10,
+  0x06, 0xC0, 0xF1, 0xD0, 0x01, 0x06, 0x60, 0xF0, 0xD0, 0x10, 0x0F, 0x00, 0x60, 0xF0, 0xB0, 0x0F,
+  0x01, 0x60, 0xF0, 0x90, 0x0F, 0x0F, 0x0F, 0x05, 0x40, 0x90, 0xD0, 0xE0, 0xF0, 0xD0, 0xB0, 0x70,
+  0x10, 0x08, 0x20, 0xB0, 0xF7, 0xE0, 0x60, 0x06, 0x20, 0xD0, 0xF1, 0xA0, 0x40, 0x10, 0x00, 0x20,
+  0x70, 0xE0, 0xF1, 0x70, 0x05, 0xC0, 0xF1, 0x50, 0x05, 0x10, 0xC0, 0xF1, 0x40, 0x03, 0x70, 0xF1,
+  0x70, 0x07, 0x10, 0xE0, 0xF0, 0xD0, 0x03, 0xD0, 0xF0, 0xE0, 0x09, 0x70, 0xF1, 0x50, 0x01, 0x30,
+  0xF1, 0x90, 0x09, 0x20, 0xF1, 0x90, 0x01, 0x60, 0xF1, 0x50, 0x0A, 0xD0, 0xF0, 0xD0, 0x01, 0x70,
+  0xF1, 0x30, 0x0A, 0xC0, 0xF0, 0xE0, 0x01, 0x80, 0xF1, 0x30, 0x0A, 0xB0, 0xF1, 0x01, 0x70, 0xF1,
+  0x30, 0x0A, 0xC0, 0xF0, 0xE0, 0x01, 0x60, 0xF1, 0x50, 0x0A, 0xD0, 0xF0, 0xD0, 0x01, 0x30, 0xF1,
+  0x90, 0x09, 0x20, 0xF1, 0x90, 0x02, 0xD0, 0xF0, 0xE0, 0x09, 0x70, 0xF1, 0x50, 0x02, 0x70, 0xF1,
+  0x70, 0x07, 0x10, 0xE0, 0xF0, 0xD0, 0x04, 0xC0, 0xF1, 0x50, 0x05, 0x10, 0xC0, 0xF1, 0x50, 0x04,
+  0x20, 0xD0, 0xF1, 0xA0, 0x40, 0x10, 0x00, 0x20, 0x70, 0xE0, 0xF1, 0x70, 0x06, 0x20, 0xB0, 0xF7,
+  0xE0, 0x60, 0x09, 0x40, 0x90, 0xD0, 0xE0, 0xF0, 0xD0, 0xB0, 0x70, 0x10, 0x04, 0x09, 0x70, 0xF0,
+  0xC0, 0x10, 0x0E, 0x50, 0xF0, 0xC0, 0x10, 0x0E, 0x30, 0xE0, 0xC0, 0x10, 0x0F, 0x0F, 0x0F, 0x05,
+  0x40, 0x90, 0xD0, 0xE0, 0xF0, 0xD0, 0xB0, 0x70, 0x10, 0x08, 0x20, 0xB0, 0xF7, 0xE0, 0x60, 0x06,
+  0x20, 0xD0, 0xF1, 0xA0, 0x40, 0x10, 0x00, 0x20, 0x70, 0xE0, 0xF1, 0x70, 0x05, 0xC0, 0xF1, 0x50,
+  0x05, 0x10, 0xC0, 0xF1, 0x40, 0x03, 0x70, 0xF1, 0x70, 0x07, 0x10, 0xE0, 0xF0, 0xD0, 0x03, 0xD0,
+  0xF0, 0xE0, 0x09, 0x70, 0xF1, 0x50, 0x01, 0x30, 0xF1, 0x90, 0x09, 0x20, 0xF1, 0x90, 0x01, 0x60,
+  0xF1, 0x50, 0x0A, 0xD0, 0xF0, 0xD0, 0x01, 0x70, 0xF1, 0x30, 0x0A, 0xC0, 0xF0, 0xE0, 0x01, 0x80,
+  0xF1, 0x30, 0x0A, 0xB0, 0xF1, 0x01, 0x70, 0xF1, 0x30, 0x0A, 0xC0, 0xF0, 0xE0, 0x01, 0x60, 0xF1,
+  0x50, 0x0A, 0xD0, 0xF0, 0xD0, 0x01, 0x30, 0xF1, 0x90, 0x09, 0x20, 0xF1, 0x90, 0x02, 0xD0, 0xF0,
+  0xE0, 0x09, 0x70, 0xF1, 0x50, 0x02, 0x70, 0xF1, 0x70, 0x07, 0x10, 0xE0, 0xF0, 0xD0, 0x04, 0xC0,
+  0xF1, 0x50, 0x05, 0x10, 0xC0, 0xF1, 0x50, 0x04, 0x20, 0xD0, 0xF1, 0xA0, 0x40, 0x10, 0x00, 0x20,
+  0x70, 0xE0, 0xF1, 0x70, 0x06, 0x20, 0xB0, 0xF7, 0xE0, 0x60, 0x09, 0x40, 0x90, 0xD0, 0xE0, 0xF0,
+  0xD0, 0xB0, 0x70, 0x10, 0x04, 0x07, 0x60, 0xF1, 0xC0, 0x10, 0x0D, 0x40, 0xF0, 0xA0, 0x40, 0xE0,
+  0xB0, 0x0C, 0x30, 0xE0, 0xA0, 0x01, 0x30, 0xE0, 0xA0, 0x0F, 0x0F, 0x0F, 0x03, 0x40, 0x90, 0xD0,
+  0xE0, 0xF0, 0xD0, 0xB0, 0x70, 0x10, 0x08, 0x20, 0xB0, 0xF7, 0xE0, 0x60, 0x06, 0x20, 0xD0, 0xF1,
+  0xA0, 0x40, 0x10, 0x00, 0x20, 0x70, 0xE0, 0xF1, 0x70, 0x05, 0xC0, 0xF1, 0x50, 0x05, 0x10, 0xC0,
+  0xF1, 0x40, 0x03, 0x70, 0xF1, 0x70, 0x07, 0x10, 0xE0, 0xF0, 0xD0, 0x03, 0xD0, 0xF0, 0xE0, 0x09,
+  0x70, 0xF1, 0x50, 0x01, 0x30, 0xF1, 0x90, 0x09, 0x20, 0xF1, 0x90, 0x01, 0x60, 0xF1, 0x50, 0x0A,
+  0xD0, 0xF0, 0xD0, 0x01, 0x70, 0xF1, 0x30, 0x0A, 0xC0, 0xF0, 0xE0, 0x01, 0x80, 0xF1, 0x30, 0x0A,
+  0xB0, 0xF1, 0x01, 0x70, 0xF1, 0x30, 0x0A, 0xC0, 0xF0, 0xE0, 0x01, 0x60, 0xF1, 0x50, 0x0A, 0xD0,
+  0xF0, 0xD0, 0x01, 0x30, 0xF1, 0x90, 0x09, 0x20, 0xF1, 0x90, 0x02, 0xD0, 0xF0, 0xE0, 0x09, 0x70,
+  0xF1, 0x50, 0x02, 0x70, 0xF1, 0x70, 0x07, 0x10, 0xE0, 0xF0, 0xD0, 0x04, 0xC0, 0xF1, 0x50, 0x05,
+  0x10, 0xC0, 0xF1, 0x50, 0x04, 0x20, 0xD0, 0xF1, 0xA0, 0x40, 0x10, 0x00, 0x20, 0x70, 0xE0, 0xF1,
+  0x70, 0x06, 0x20, 0xB0, 0xF7, 0xE0, 0x60, 0x09, 0x40, 0x90, 0xD0, 0xE0, 0xF0, 0xD0, 0xB0, 0x70,
+  0x10, 0x04, 0x05, 0x10, 0xB0, 0xE0, 0xD0, 0x70, 0x10, 0x60, 0xF0, 0x50, 0x0A, 0x90, 0xF6, 0x20,
+  0x0A, 0xD0, 0xC0, 0x10, 0x40, 0xA0, 0xE1, 0x60, 0x0F, 0x0F, 0x0F, 0x03, 0x40, 0x90, 0xD0, 0xE0,
+  0xF0, 0xD0, 0xB0, 0x70, 0x10, 0x08, 0x20, 0xB0, 0xF7, 0xE0, 0x60, 0x06, 0x20, 0xD0, 0xF1, 0xA0,
+  0x40, 0x10, 0x00, 0x20, 0x70, 0xE0, 0xF1, 0x70, 0x05, 0xC0, 0xF1, 0x50, 0x05, 0x10, 0xC0, 0xF1,
+  0x40, 0x03, 0x70, 0xF1, 0x70, 0x07, 0x10, 0xE0, 0xF0, 0xD0, 0x03, 0xD0, 0xF0, 0xE0, 0x09, 0x70,
+  0xF1, 0x50, 0x01, 0x30, 0xF1, 0x90, 0x09, 0x20, 0xF1, 0x90, 0x01, 0x60, 0xF1, 0x50, 0x0A, 0xD0,
+  0xF0, 0xD0, 0x01, 0x70, 0xF1, 0x30, 0x0A, 0xC0, 0xF0, 0xE0, 0x01, 0x80, 0xF1, 0x30, 0x0A, 0xB0,
+  0xF1, 0x01, 0x70, 0xF1, 0x30, 0x0A, 0xC0, 0xF0, 0xE0, 0x01, 0x60, 0xF1, 0x50, 0x0A, 0xD0, 0xF0,
+  0xD0, 0x01, 0x30, 0xF1, 0x90, 0x09, 0x20, 0xF1, 0x90, 0x02, 0xD0, 0xF0, 0xE0, 0x09, 0x70, 0xF1,
+  0x50, 0x02, 0x70, 0xF1, 0x70, 0x07, 0x10, 0xE0, 0xF0, 0xD0, 0x04, 0xC0, 0xF1, 0x50, 0x05, 0x10,
+  0xC0, 0xF1, 0x50, 0x04, 0x20, 0xD0, 0xF1, 0xA0, 0x40, 0x10, 0x00, 0x20, 0x70, 0xE0, 0xF1, 0x70,
+  0x06, 0x20, 0xB0, 0xF7, 0xE0, 0x60, 0x09, 0x40, 0x90, 0xD0, 0xE0, 0xF0, 0xD0, 0xB0, 0x70, 0x10,
+  0x04, 0x05, 0x80, 0xF1, 0x10, 0x00, 0x80, 0xF1, 0x0B, 0x80, 0xF1, 0x10, 0x00, 0x80, 0xF1, 0x0B,
+  0x80, 0xF1, 0x10, 0x00, 0x80, 0xF1, 0x0F, 0x0F, 0x0F, 0x03, 0x40, 0x90, 0xD0, 0xE0, 0xF0, 0xD0,
+  0xB0, 0x70, 0x10, 0x08, 0x20, 0xB0, 0xF7, 0xE0, 0x60, 0x06, 0x20, 0xD0, 0xF1, 0xA0, 0x40, 0x10,
+  0x00, 0x20, 0x70, 0xE0, 0xF1, 0x70, 0x05, 0xC0, 0xF1, 0x50, 0x05, 0x10, 0xC0, 0xF1, 0x40, 0x03,
+  0x70, 0xF1, 0x70, 0x07, 0x10, 0xE0, 0xF0, 0xD0, 0x03, 0xD0, 0xF0, 0xE0, 0x09, 0x70, 0xF1, 0x50,
+  0x01, 0x30, 0xF1, 0x90, 0x09, 0x20, 0xF1, 0x90, 0x01, 0x60, 0xF1, 0x50, 0x0A, 0xD0, 0xF0, 0xD0,
+  0x01, 0x70, 0xF1, 0x30, 0x0A, 0xC0, 0xF0, 0xE0, 0x01, 0x80, 0xF1, 0x30, 0x0A, 0xB0, 0xF1, 0x01,
+  0x70, 0xF1, 0x30, 0x0A, 0xC0, 0xF0, 0xE0, 0x01, 0x60, 0xF1, 0x50, 0x0A, 0xD0, 0xF0, 0xD0, 0x01,
+  0x30, 0xF1, 0x90, 0x09, 0x20, 0xF1, 0x90, 0x02, 0xD0, 0xF0, 0xE0, 0x09, 0x70, 0xF1, 0x50, 0x02,
+  0x70, 0xF1, 0x70, 0x07, 0x10, 0xE0, 0xF0, 0xD0, 0x04, 0xC0, 0xF1, 0x50, 0x05, 0x10, 0xC0, 0xF1,
+  0x50, 0x04, 0x20, 0xD0, 0xF1, 0xA0, 0x40, 0x10, 0x00, 0x20, 0x70, 0xE0, 0xF1, 0x70, 0x06, 0x20,
+  0xB0, 0xF7, 0xE0, 0x60, 0x09, 0x40, 0x90, 0xD0, 0xE0, 0xF0, 0xD0, 0xB0, 0x70, 0x10, 0x04, 0x03,
+  0x60, 0x80, 0x09, 0xA0, 0x40, 0x06, 0x30, 0xF1, 0x80, 0x07, 0xB0, 0xF0, 0xE0, 0x10, 0x06, 0x80,
+  0xF1, 0x80, 0x05, 0xB0, 0xF1, 0x50, 0x08, 0x80, 0xF1, 0x70, 0x03, 0xA0, 0xF1, 0x50, 0x0A, 0x90,
+  0xF1, 0x70, 0x01, 0xA0, 0xF1, 0x60, 0x0C, 0x90, 0xF1, 0x70, 0xA0, 0xF1, 0x60, 0x0E, 0x90, 0xF3,
+  0x60, 0x0F, 0x00, 0xD0, 0xF1, 0xA0, 0x0F, 0x00, 0x90, 0xF3, 0x60, 0x0E, 0x90, 0xF1, 0x70, 0xA0,
+  0xF1, 0x60, 0x0C, 0x80, 0xF1, 0x70, 0x01, 0xA0, 0xF1, 0x50, 0x0A, 0x80, 0xF1, 0x70, 0x03, 0xA0,
+  0xF1, 0x50, 0x08, 0x80, 0xF1, 0x80, 0x05, 0xB0, 0xF1, 0x50, 0x06, 0x30, 0xF1, 0x80, 0x07, 0xB0,
+  0xF0, 0xE0, 0x10, 0x06, 0x60, 0x80, 0x08, 0x10, 0xA0, 0x40, 0x0F, 0x09, 0x0F, 0x00, 0x30, 0x10,
+  0x06, 0x40, 0x90, 0xD0, 0xE0, 0xF0, 0xE0, 0xB0, 0x60, 0x10, 0x00, 0x20, 0xD1, 0x04, 0x10, 0xB0,
+  0xF7, 0xE0, 0x60, 0xC0, 0xF0, 0x50, 0x03, 0x20, 0xD0, 0xF1, 0xA0, 0x40, 0x10, 0x00, 0x20, 0x70,
+  0xE0, 0xF2, 0x70, 0x04, 0xC0, 0xF1, 0x50, 0x05, 0x10, 0xE0, 0xF1, 0x40, 0x03, 0x70, 0xF1, 0x70,
+  0x06, 0x80, 0xF2, 0xD0, 0x03, 0xD0, 0xF0, 0xE0, 0x06, 0x60, 0xF0, 0xC0, 0x80, 0xF1, 0x50, 0x01,
+  0x30, 0xF1, 0x90, 0x05, 0x40, 0xF0, 0xD0, 0x20, 0x10, 0xF1, 0x90, 0x01, 0x60, 0xF1, 0x50, 0x04,
+  0x30, 0xE1, 0x30, 0x01, 0xE0, 0xF0, 0xC0, 0x01, 0x70, 0xF1, 0x30, 0x03, 0x20, 0xD0, 0xF0, 0x40,
+  0x02, 0xC0, 0xF0, 0xE0, 0x01, 0x80, 0xF1, 0x30, 0x02, 0x10, 0xC0, 0xF0, 0x60, 0x03, 0xB0, 0xF1,
+  0x01, 0x70, 0xF1, 0x40, 0x02, 0xB0, 0xF0, 0x70, 0x04, 0xC0, 0xF0, 0xE0, 0x01, 0x60, 0xF1, 0x50,
+  0x01, 0x90, 0xF0, 0x90, 0x05, 0xD0, 0xF0, 0xD0, 0x01, 0x30, 0xF1, 0x80, 0x00, 0x80, 0xF0, 0xB0,
+  0x05, 0x20, 0xF1, 0x90, 0x02, 0xD0, 0xF0, 0xD0, 0x60, 0xF0, 0xC0, 0x10, 0x05, 0x70, 0xF1, 0x50,
+  0x02, 0x70, 0xF2, 0xD0, 0x20, 0x05, 0x10, 0xE0, 0xF0, 0xD0, 0x04, 0xC0, 0xF1, 0x70, 0x05, 0x10,
+  0xC0, 0xF1, 0x40, 0x03, 0x10, 0xD0, 0xF2, 0xA0, 0x40, 0x10, 0x00, 0x20, 0x70, 0xE0, 0xF1, 0x70,
+  0x04, 0xB0, 0xF0, 0x70, 0xB0, 0xF7, 0xE0, 0x60, 0x04, 0x70, 0xF0, 0x70, 0x01, 0x40, 0x90, 0xD0,
+  0xE0, 0xF0, 0xD0, 0xB0, 0x70, 0x10, 0x06, 0x50, 0x0F, 0x00, 0x05, 0x30, 0xE0, 0xF0, 0x30, 0x0F,
+  0x30, 0xE1, 0x20, 0x0F, 0x30, 0xE0, 0xC0, 0x10, 0x0F, 0x0F, 0x0E, 0xB0, 0xF0, 0xD0, 0x08, 0xC0,
+  0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0,
+  0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0,
+  0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0,
+  0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0,
+  0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0,
+  0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xB0, 0x03, 0xA0, 0xF0, 0xE0, 0x08, 0xD0,
+  0xF0, 0xB0, 0x03, 0x90, 0xF1, 0x10, 0x07, 0xF1, 0x90, 0x03, 0x50, 0xF1, 0x50, 0x06, 0x40, 0xF1,
+  0x60, 0x03, 0x10, 0xE0, 0xF0, 0xC0, 0x10, 0x05, 0xC0, 0xF0, 0xE0, 0x10, 0x04, 0x60, 0xF1, 0xC0,
+  0x50, 0x10, 0x00, 0x10, 0x50, 0xC0, 0xF1, 0x60, 0x06, 0x70, 0xF8, 0x70, 0x08, 0x20, 0x80, 0xC0,
+  0xE0, 0xF0, 0xE0, 0xC0, 0x80, 0x20, 0x04, 0x08, 0x40, 0xF0, 0xE0, 0x20, 0x0D, 0x20, 0xE1, 0x30,
+  0x0D, 0x10, 0xC0, 0xE0, 0x30, 0x0F, 0x0F, 0x0F, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03,
+  0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03,
+  0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03,
+  0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03,
+  0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03,
+  0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03,
+  0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xB0, 0x03, 0xA0, 0xF0, 0xE0, 0x08, 0xD0, 0xF0, 0xB0, 0x03,
+  0x90, 0xF1, 0x10, 0x07, 0xF1, 0x90, 0x03, 0x50, 0xF1, 0x50, 0x06, 0x40, 0xF1, 0x60, 0x03, 0x10,
+  0xE0, 0xF0, 0xC0, 0x10, 0x05, 0xC0, 0xF0, 0xE0, 0x10, 0x04, 0x60, 0xF1, 0xC0, 0x50, 0x10, 0x00,
+  0x10, 0x50, 0xC0, 0xF1, 0x60, 0x06, 0x70, 0xF8, 0x70, 0x08, 0x20, 0x80, 0xC0, 0xE0, 0xF0, 0xE0,
+  0xC0, 0x80, 0x20, 0x04, 0x06, 0x30, 0xE0, 0xF0, 0xE0, 0x30, 0x0C, 0x20, 0xD1, 0x40, 0xD0, 0xE0,
+  0x20, 0x0A, 0x10, 0xD1, 0x10, 0x00, 0x10, 0xC0, 0xD0, 0x10, 0x0F, 0x0F, 0x0C, 0xB0, 0xF0, 0xD0,
+  0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0,
+  0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0,
+  0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0,
+  0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0,
+  0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0,
+  0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xB0, 0x03, 0xA0, 0xF0, 0xE0,
+  0x08, 0xD0, 0xF0, 0xB0, 0x03, 0x90, 0xF1, 0x10, 0x07, 0xF1, 0x90, 0x03, 0x50, 0xF1, 0x50, 0x06,
+  0x40, 0xF1, 0x60, 0x03, 0x10, 0xE0, 0xF0, 0xC0, 0x10, 0x05, 0xC0, 0xF0, 0xE0, 0x10, 0x04, 0x60,
+  0xF1, 0xC0, 0x50, 0x10, 0x00, 0x10, 0x50, 0xC0, 0xF1, 0x60, 0x06, 0x70, 0xF8, 0x70, 0x08, 0x20,
+  0x80, 0xC0, 0xE0, 0xF0, 0xE0, 0xC0, 0x80, 0x20, 0x04, 0x04, 0x40, 0xF1, 0x50, 0x00, 0x40, 0xF1,
+  0x40, 0x09, 0x40, 0xF1, 0x50, 0x00, 0x40, 0xF1, 0x40, 0x09, 0x40, 0xF1, 0x50, 0x00, 0x40, 0xF1,
+  0x40, 0x0F, 0x0F, 0x0C, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08,
+  0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08,
+  0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08,
+  0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08,
+  0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08,
+  0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08, 0xC0, 0xF0, 0xC0, 0x03, 0xB0, 0xF0, 0xD0, 0x08,
+  0xC0, 0xF0, 0xB0, 0x03, 0xA0, 0xF0, 0xE0, 0x08, 0xD0, 0xF0, 0xB0, 0x03, 0x90, 0xF1, 0x10, 0x07,
+  0xF1, 0x90, 0x03, 0x50, 0xF1, 0x50, 0x06, 0x40, 0xF1, 0x60, 0x03, 0x10, 0xE0, 0xF0, 0xC0, 0x10,
+  0x05, 0xC0, 0xF0, 0xE0, 0x10, 0x04, 0x60, 0xF1, 0xC0, 0x50, 0x10, 0x00, 0x10, 0x50, 0xC0, 0xF1,
+  0x60, 0x06, 0x70, 0xF8, 0x70, 0x08, 0x20, 0x80, 0xC0, 0xE0, 0xF0, 0xE0, 0xC0, 0x80, 0x20, 0x04,
+  0x08, 0xB0, 0xF0, 0x80, 0x0C, 0x90, 0xF0, 0x80, 0x0C, 0x60, 0xF0, 0x90, 0x0F, 0x0F, 0x09, 0xB0,
+  0xF0, 0xE0, 0x20, 0x07, 0x30, 0xF1, 0x90, 0x00, 0x20, 0xE0, 0xF0, 0xB0, 0x07, 0xC0, 0xF0, 0xD0,
+  0x10, 0x01, 0x50, 0xF1, 0x60, 0x05, 0x80, 0xF1, 0x40, 0x03, 0xA0, 0xF0, 0xE0, 0x20, 0x03, 0x30,
+  0xF1, 0x90, 0x04, 0x10, 0xE0, 0xF0, 0xB0, 0x03, 0xC0, 0xF0, 0xD0, 0x10, 0x05, 0x50, 0xF1, 0x60,
+  0x01, 0x80, 0xF1, 0x40, 0x07, 0xA0, 0xF0, 0xE0, 0x20, 0x30, 0xF1, 0x80, 0x08, 0x10, 0xE0, 0xF0,
+  0xB0, 0xC0, 0xF0, 0xD0, 0x10, 0x09, 0x50, 0xF3, 0x30, 0x0B, 0xA0, 0xF1, 0x80, 0x0C, 0x50, 0xF1,
+  0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1,
+  0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1, 0x40, 0x0C, 0x50, 0xF1,
+  0x40, 0x05, 0x01, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70,
+  0xF5, 0xE0, 0xC0, 0x80, 0x10, 0x04, 0x70, 0xF8, 0xE0, 0x40, 0x03, 0x70, 0xF1, 0x20, 0x02, 0x20,
+  0x80, 0xF1, 0xE0, 0x10, 0x02, 0x70, 0xF1, 0x20, 0x04, 0x70, 0xF1, 0x70, 0x02, 0x70, 0xF1, 0x20,
+  0x04, 0x10, 0xF1, 0xB0, 0x02, 0x70, 0xF1, 0x20, 0x05, 0xE0, 0xF0, 0xC0, 0x02, 0x70, 0xF1, 0x20,
+  0x04, 0x10, 0xF1, 0xB0, 0x02, 0x70, 0xF1, 0x20, 0x04, 0x70, 0xF1, 0x70, 0x02, 0x70, 0xF1, 0x20,
+  0x02, 0x20, 0x80, 0xF1, 0xE0, 0x10, 0x02, 0x70, 0xF8, 0xE0, 0x40, 0x03, 0x70, 0xF5, 0xE0, 0xC0,
+  0x80, 0x10, 0x04, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x0B, 0x70,
+  0xF1, 0x20, 0x0B, 0x70, 0xF1, 0x20, 0x09, 0x03, 0x20, 0x80, 0xD0, 0xE0, 0xF0, 0xD0, 0x90, 0x20,
+  0x06, 0x40, 0xE0, 0xF5, 0xE0, 0x30, 0x04, 0x10, 0xE0, 0xF0, 0xD0, 0x50, 0x11, 0x40, 0xC0, 0xF0,
+  0xD0, 0x04, 0x60, 0xF1, 0x30, 0x03, 0x10, 0xE0, 0xF0, 0x50, 0x03, 0x90, 0xF0, 0xD0, 0x04, 0x20,
+  0xD0, 0xF0, 0x80, 0x03, 0xA0, 0xF0, 0xB0, 0x02, 0x20, 0xB0, 0xF1, 0xE0, 0x70, 0x03, 0xA0, 0xF0,
+  0xB0, 0x01, 0x10, 0xE0, 0xF0, 0xA0, 0x30, 0x05, 0xA0, 0xF0, 0xB0, 0x01, 0x80, 0xF0, 0xC0, 0x07,
+  0xA0, 0xF0, 0xB0, 0x01, 0xA0, 0xF0, 0x90, 0x07, 0xA0, 0xF0, 0xB0, 0x01, 0x90, 0xF0, 0xE0, 0x10,
+  0x06, 0xA0, 0xF0, 0xB0, 0x01, 0x30, 0xF1, 0xD0, 0x40, 0x05, 0xA0, 0xF0, 0xB0, 0x02, 0x50, 0xE0,
+  0xF1, 0x90, 0x10, 0x03, 0xA0, 0xF0, 0xB0, 0x03, 0x20, 0xB0, 0xF1, 0xC0, 0x10, 0x02, 0xA0, 0xF0,
+  0xB0, 0x05, 0x60, 0xF1, 0xA0, 0x02, 0xA0, 0xF0, 0xB0, 0x06, 0x70, 0xF1, 0x10, 0x01, 0xA0, 0xF0,
+  0xB0, 0x06, 0x40, 0xF1, 0x20, 0x01, 0xA0, 0xF0, 0xB0, 0x06, 0x60, 0xF1, 0x10, 0x01, 0xA0, 0xF0,
+  0xB0, 0x00, 0xA0, 0x70, 0x30, 0x11, 0x50, 0xE0, 0xF0, 0xB0, 0x02, 0xA0, 0xF0, 0xB0, 0x00, 0xC0,
+  0xF5, 0xE0, 0x20, 0x02, 0xA0, 0xF0, 0xB0, 0x00, 0x20, 0x80, 0xD0, 0xF0, 0xE0, 0xC0, 0x80, 0x10,
+  0x01, 0x02, 0x60, 0xF0, 0xE0, 0x20, 0x0C, 0x80, 0xF0, 0xB0, 0x0D, 0xB0, 0xF0, 0x70, 0x0C, 0x10,
+  0xD0, 0xF0, 0x30, 0x0C, 0x20, 0xE0, 0xD0, 0x10, 0x0F, 0x0F, 0x08, 0x40, 0x90, 0xC0, 0xD0, 0xF0,
+  0xE0, 0xC0, 0x70, 0x10, 0x05, 0x60, 0xF7, 0xD0, 0x20, 0x04, 0x50, 0xB0, 0x50, 0x30, 0x11, 0x20,
+  0x70, 0xE0, 0xF0, 0xC0, 0x0C, 0x20, 0xF1, 0x30, 0x0C, 0xC0, 0xF0, 0x70, 0x04, 0x10, 0x70, 0xB0,
+  0xE0, 0xF5, 0x80, 0x03, 0x40, 0xE0, 0xF8, 0x90, 0x02, 0x10, 0xE0, 0xF0, 0xD0, 0x60, 0x20, 0x10,
+  0x02, 0xC0, 0xF0, 0x90, 0x02, 0x40, 0xF1, 0x20, 0x05, 0xD0, 0xF0, 0x90, 0x02, 0x60, 0xF0, 0xE0,
+  0x05, 0x20, 0xF1, 0x90, 0x02, 0x50, 0xF1, 0x20, 0x04, 0xB0, 0xF1, 0x90, 0x02, 0x10, 0xF1, 0xC0,
+  0x40, 0x11, 0x40, 0xC0, 0xD0, 0xC0, 0xF0, 0x90, 0x03, 0x70, 0xF5, 0xE0, 0x30, 0xC0, 0xF0, 0x90,
+  0x04, 0x40, 0xB0, 0xE0, 0xF0, 0xD0, 0x90, 0x20, 0x00, 0xC0, 0xF0, 0x90, 0x01, 0x07, 0x20, 0xE0,
+  0xF0, 0x60, 0x0B, 0xB0, 0xF0, 0x90, 0x0B, 0x70, 0xF0, 0xB0, 0x0B, 0x30, 0xF0, 0xD0, 0x10, 0x0A,
+  0x10, 0xD0, 0xE0, 0x30, 0x0F, 0x0F, 0x09, 0x40, 0x90, 0xC0, 0xD0, 0xF0, 0xE0, 0xC0, 0x70, 0x10,
+  0x05, 0x60, 0xF7, 0xD0, 0x20, 0x04, 0x50, 0xB0, 0x50, 0x30, 0x11, 0x20, 0x70, 0xE0, 0xF0, 0xC0,
+  0x0C, 0x20, 0xF1, 0x30, 0x0C, 0xC0, 0xF0, 0x70, 0x04, 0x10, 0x70, 0xB0, 0xE0, 0xF5, 0x80, 0x03,
+  0x40, 0xE0, 0xF8, 0x90, 0x02, 0x10, 0xE0, 0xF0, 0xD0, 0x60, 0x20, 0x10, 0x02, 0xC0, 0xF0, 0x90,
+  0x02, 0x40, 0xF1, 0x20, 0x05, 0xD0, 0xF0, 0x90, 0x02, 0x60, 0xF0, 0xE0, 0x05, 0x20, 0xF1, 0x90,
+  0x02, 0x50, 0xF1, 0x20, 0x04, 0xB0, 0xF1, 0x90, 0x02, 0x10, 0xF1, 0xC0, 0x40, 0x11, 0x40, 0xC0,
+  0xD0, 0xC0, 0xF0, 0x90, 0x03, 0x70, 0xF5, 0xE0, 0x30, 0xC0, 0xF0, 0x90, 0x04, 0x40, 0xB0, 0xE0,
+  0xF0, 0xD0, 0x90, 0x20, 0x00, 0xC0, 0xF0, 0x90, 0x01, 0x05, 0xB0, 0xF0, 0xC0, 0x0B, 0x50, 0xF0,
+  0xE0, 0xF0, 0x60, 0x09, 0x10, 0xD0, 0xE0, 0x20, 0xD0, 0xE0, 0x10, 0x08, 0x90, 0xF0, 0x50, 0x00,
+  0x30, 0xF0, 0xA0, 0x07, 0x30, 0xF0, 0x90, 0x02, 0x80, 0xF0, 0x40, 0x0F, 0x0F, 0x06, 0x40, 0x90,
+  0xC0, 0xD0, 0xF0, 0xE0, 0xC0, 0x70, 0x10, 0x05, 0x60, 0xF7, 0xD0, 0x20, 0x04, 0x50, 0xB0, 0x50,
+  0x30, 0x11, 0x20, 0x70, 0xE0, 0xF0, 0xC0, 0x0C, 0x20, 0xF1, 0x30, 0x0C, 0xC0, 0xF0, 0x70, 0x04,
+  0x10, 0x70, 0xB0, 0xE0, 0xF5, 0x80, 0x03, 0x40, 0xE0, 0xF8, 0x90, 0x02, 0x10, 0xE0, 0xF0, 0xD0,
+  0x60, 0x20, 0x10, 0x02, 0xC0, 0xF0, 0x90, 0x02, 0x40, 0xF1, 0x20, 0x05, 0xD0, 0xF0, 0x90, 0x02,
+  0x60, 0xF0, 0xE0, 0x05, 0x20, 0xF1, 0x90, 0x02, 0x50, 0xF1, 0x20, 0x04, 0xB0, 0xF1, 0x90, 0x02,
+  0x10, 0xF1, 0xC0, 0x40, 0x11, 0x40, 0xC0, 0xD0, 0xC0, 0xF0, 0x90, 0x03, 0x70, 0xF5, 0xE0, 0x30,
+  0xC0, 0xF0, 0x90, 0x04, 0x40, 0xB0, 0xE0, 0xF0, 0xD0, 0x90, 0x20, 0x00, 0xC0, 0xF0, 0x90, 0x01,
+  0x03, 0x70, 0xE0, 0xC0, 0x30, 0x01, 0xD0, 0xA0, 0x06, 0x20, 0xF2, 0xE0, 0x31, 0xF0, 0x80, 0x06,
+  0x70, 0xF0, 0x40, 0x20, 0xD0, 0xF2, 0x40, 0x06, 0x90, 0xF0, 0x01, 0x20, 0xC0, 0xE0, 0x80, 0x0F,
+  0x0F, 0x07, 0x40, 0x90, 0xC0, 0xD0, 0xF0, 0xE0, 0xC0, 0x70, 0x10, 0x05, 0x60, 0xF7, 0xD0, 0x20,
+  0x04, 0x50, 0xB0, 0x50, 0x30, 0x11, 0x20, 0x70, 0xE0, 0xF0, 0xC0, 0x0C, 0x20, 0xF1, 0x30, 0x0C,
+  0xC0, 0xF0, 0x70, 0x04, 0x10, 0x70, 0xB0, 0xE0, 0xF5, 0x80, 0x03, 0x40, 0xE0, 0xF8, 0x90, 0x02,
+  0x10, 0xE0, 0xF0, 0xD0, 0x60, 0x20, 0x10, 0x02, 0xC0, 0xF0, 0x90, 0x02, 0x40, 0xF1, 0x20, 0x05,
+  0xD0, 0xF0, 0x90, 0x02, 0x60, 0xF0, 0xE0, 0x05, 0x20, 0xF1, 0x90, 0x02, 0x50, 0xF1, 0x20, 0x04,
+  0xB0, 0xF1, 0x90, 0x02, 0x10, 0xF1, 0xC0, 0x40, 0x11, 0x40, 0xC0, 0xD0, 0xC0, 0xF0, 0x90, 0x03,
+  0x70, 0xF5, 0xE0, 0x30, 0xC0, 0xF0, 0x90, 0x04, 0x40, 0xB0, 0xE0, 0xF0, 0xD0, 0x90, 0x20, 0x00,
+  0xC0, 0xF0, 0x90, 0x01, 0x02, 0x30, 0xF1, 0x50, 0x00, 0x40, 0xF1, 0x50, 0x06, 0x30, 0xF1, 0x50,
+  0x00, 0x40, 0xF1, 0x50, 0x06, 0x30, 0xF1, 0x50, 0x00, 0x40, 0xF1, 0x50, 0x0F, 0x0F, 0x0F, 0x06,
+  0x40, 0x90, 0xC0, 0xD0, 0xF0, 0xE0, 0xC0, 0x70, 0x10, 0x05, 0x60, 0xF7, 0xD0, 0x20, 0x04, 0x50,
+  0xB0, 0x50, 0x30, 0x11, 0x20, 0x70, 0xE0, 0xF0, 0xC0, 0x0C, 0x20, 0xF1, 0x30, 0x0C, 0xC0, 0xF0,
+  0x70, 0x04, 0x10, 0x70, 0xB0, 0xE0, 0xF5, 0x80, 0x03, 0x40, 0xE0, 0xF8, 0x90, 0x02, 0x10, 0xE0,
+  0xF0, 0xD0, 0x60, 0x20, 0x10, 0x02, 0xC0, 0xF0, 0x90, 0x02, 0x40, 0xF1, 0x20, 0x05, 0xD0, 0xF0,
+  0x90, 0x02, 0x60, 0xF0, 0xE0, 0x05, 0x20, 0xF1, 0x90, 0x02, 0x50, 0xF1, 0x20, 0x04, 0xB0, 0xF1,
+  0x90, 0x02, 0x10, 0xF1, 0xC0, 0x40, 0x11, 0x40, 0xC0, 0xD0, 0xC0, 0xF0, 0x90, 0x03, 0x70, 0xF5,
+  0xE0, 0x30, 0xC0, 0xF0, 0x90, 0x04, 0x40, 0xB0, 0xE0, 0xF0, 0xD0, 0x90, 0x20, 0x00, 0xC0, 0xF0,
+  0x90, 0x01, 0x04, 0x50, 0xC0, 0xF0, 0xD0, 0x60, 0x09, 0x40, 0xF4, 0x60, 0x08, 0xB0, 0xE0, 0x40,
+  0x10, 0x30, 0xE0, 0xD0, 0x08, 0xD0, 0xA0, 0x02, 0x90, 0xF0, 0x08, 0xB0, 0xE0, 0x40, 0x00, 0x30,
+  0xE0, 0xD0, 0x08, 0x40, 0xF4, 0x60, 0x09, 0x50, 0xC0, 0xF0, 0xD0, 0x60, 0x0F, 0x0F, 0x08, 0x40,
+  0x90, 0xC0, 0xD0, 0xF0, 0xE0, 0xC0, 0x70, 0x10, 0x05, 0x60, 0xF7, 0xD0, 0x20, 0x04, 0x50, 0xB0,
+  0x50, 0x30, 0x11, 0x20, 0x70, 0xE0, 0xF0, 0xC0, 0x0C, 0x20, 0xF1, 0x30, 0x0C, 0xC0, 0xF0, 0x70,
+  0x04, 0x10, 0x70, 0xB0, 0xE0, 0xF5, 0x80, 0x03, 0x40, 0xE0, 0xF8, 0x90, 0x02, 0x10, 0xE0, 0xF0,
+  0xD0, 0x60, 0x20, 0x10, 0x02, 0xC0, 0xF0, 0x90, 0x02, 0x40, 0xF1, 0x20, 0x05, 0xD0, 0xF0, 0x90,
+  0x02, 0x60, 0xF0, 0xE0, 0x05, 0x20, 0xF1, 0x90, 0x02, 0x50, 0xF1, 0x20, 0x04, 0xB0, 0xF1, 0x90,
+  0x02, 0x10, 0xF1, 0xC0, 0x40, 0x11, 0x40, 0xC0, 0xD0, 0xC0, 0xF0, 0x90, 0x03, 0x70, 0xF5, 0xE0,
+  0x30, 0xC0, 0xF0, 0x90, 0x04, 0x40, 0xB0, 0xE0, 0xF0, 0xD0, 0x90, 0x20, 0x00, 0xC0, 0xF0, 0x90,
+  0x01, 0x02, 0x40, 0x90, 0xC0, 0xE0, 0xF0, 0xE0, 0xB0, 0x70, 0x10, 0x01, 0x40, 0xA0, 0xD0, 0xE1,
+  0xC0, 0x80, 0x10, 0x05, 0x60, 0xF7, 0xE0, 0x40, 0xB0, 0xF6, 0xE0, 0x30, 0x04, 0x50, 0xB0, 0x50,
+  0x30, 0x11, 0x20, 0x70, 0xE0, 0xF3, 0x90, 0x30, 0x00, 0x10, 0x40, 0xD0, 0xF0, 0xE0, 0x10, 0x0B,
+  0x20, 0xF2, 0x80, 0x04, 0x10, 0xD0, 0xF0, 0x90, 0x0C, 0xC0, 0xF0, 0xD0, 0x06, 0x70, 0xF0, 0xD0,
+  0x04, 0x10, 0x70, 0xB0, 0xE0, 0xF5, 0x90, 0x06, 0x30, 0xF1, 0x10, 0x02, 0x40, 0xE0, 0xFF, 0xF3,
+  0x20, 0x01, 0x10, 0xE0, 0xF0, 0xD0, 0x60, 0x20, 0x10, 0x02, 0xC0, 0xFB, 0x20, 0x01, 0x40, 0xF1,
+  0x20, 0x05, 0xC0, 0xF0, 0x80, 0x0C, 0x60, 0xF0, 0xE0, 0x05, 0x10, 0xF1, 0xC0, 0x0C, 0x50, 0xF1,
+  0x20, 0x04, 0xA0, 0xF2, 0x60, 0x0B, 0x10, 0xF1, 0xC0, 0x40, 0x11, 0x40, 0xB0, 0xF0, 0xB0, 0x70,
+  0xF1, 0xA0, 0x40, 0x10, 0x00, 0x10, 0x30, 0x60, 0xA0, 0x80, 0x03, 0x60, 0xF6, 0xB0, 0x10, 0x00,
+  0x70, 0xF8, 0x90, 0x04, 0x40, 0xA0, 0xE0, 0xF0, 0xE0, 0xB0, 0x50, 0x03, 0x20, 0x80, 0xC0, 0xE0,
+  0xF0, 0xD0, 0xC0, 0x90, 0x50, 0x10, 0x01, 0x03, 0x10, 0x70, 0xB0, 0xE0, 0xF0, 0xD0, 0xB0, 0x70,
+  0x10, 0x03, 0x40, 0xE0, 0xF6, 0xA0, 0x02, 0x30, 0xE0, 0xF0, 0xE0, 0x60, 0x20, 0x00, 0x20, 0x40,
+  0x80, 0x90, 0x02, 0xC0, 0xF0, 0xE0, 0x20, 0x08, 0x30, 0xF1, 0x60, 0x09, 0x60, 0xF1, 0x10, 0x09,
+  0x80, 0xF0, 0xE0, 0x0A, 0x80, 0xF0, 0xE0, 0x0A, 0x60, 0xF1, 0x10, 0x09, 0x30, 0xF1, 0x60, 0x0A,
+  0xC0, 0xF0, 0xE0, 0x20, 0x09, 0x30, 0xE0, 0xF0, 0xE0, 0x60, 0x20, 0x00, 0x10, 0x40, 0x80, 0x90,
+  0x03, 0x40, 0xE0, 0xF6, 0xA0, 0x04, 0x10, 0x70, 0xC0, 0xE0, 0xF0, 0xD0, 0xB0, 0x70, 0x10, 0x08,
+  0xB1, 0x0B, 0x20, 0xF0, 0x60, 0x0A, 0x50, 0xF0, 0xB0, 0x07, 0x80, 0xF3, 0x90, 0x07, 0x50, 0xD0,
+  0xF0, 0xE0, 0xA0, 0x10, 0x02, 0x03, 0xA0, 0xF0, 0xB0, 0x0C, 0x10, 0xC0, 0xF0, 0x70, 0x0C, 0x20,
+  0xE0, 0xF0, 0x30, 0x0C, 0x30, 0xF0, 0xD0, 0x10, 0x0C, 0x50, 0xF0, 0xA0, 0x0F, 0x0F, 0x09, 0x10,
+  0x70, 0xC0, 0xE0, 0xF0, 0xE0, 0xA0, 0x40, 0x06, 0x40, 0xE0, 0xF6, 0x90, 0x04, 0x30, 0xE0, 0xF0,
+  0xD0, 0x50, 0x10, 0x00, 0x20, 0x80, 0xF1, 0x70, 0x03, 0xB0, 0xF0, 0xD0, 0x10, 0x04, 0x70, 0xF0,
+  0xE0, 0x10, 0x01, 0x30, 0xF1, 0x50, 0x06, 0xE0, 0xF0, 0x50, 0x01, 0x60, 0xF1, 0x10, 0x06, 0xC0,
+  0xF0, 0x80, 0x01, 0x80, 0xFB, 0x90, 0x01, 0x80, 0xFB, 0x90, 0x01, 0x70, 0xF0, 0xE0, 0x0C, 0x30,
+  0xF1, 0x40, 0x0C, 0xC0, 0xF0, 0xC0, 0x10, 0x0B, 0x30, 0xE0, 0xF0, 0xD0, 0x60, 0x20, 0x00, 0x10,
+  0x20, 0x40, 0x80, 0xC0, 0x10, 0x03, 0x30, 0xD0, 0xF8, 0x10, 0x04, 0x10, 0x60, 0xB0, 0xE0, 0xF0,
+  0xE0, 0xD0, 0xB0, 0x70, 0x20, 0x01, 0x08, 0x50, 0xF0, 0xE0, 0x30, 0x0A, 0x20, 0xE0, 0xF0, 0x50,
+  0x0B, 0xB0, 0xF0, 0x70, 0x0B, 0x70, 0xF0, 0xA0, 0x0B, 0x30, 0xF0, 0xC0, 0x10, 0x0F, 0x0F, 0x09,
+  0x10, 0x70, 0xC0, 0xE0, 0xF0, 0xE0, 0xA0, 0x40, 0x06, 0x40, 0xE0, 0xF6, 0x90, 0x04, 0x30, 0xE0,
+  0xF0, 0xD0, 0x50, 0x10, 0x00, 0x20, 0x80, 0xF1, 0x70, 0x03, 0xB0, 0xF0, 0xD0, 0x10, 0x04, 0x70,
+  0xF0, 0xE0, 0x10, 0x01, 0x30, 0xF1, 0x50, 0x06, 0xE0, 0xF0, 0x50, 0x01, 0x60, 0xF1, 0x10, 0x06,
+  0xC0, 0xF0, 0x80, 0x01, 0x80, 0xFB, 0x90, 0x01, 0x80, 0xFB, 0x90, 0x01, 0x70, 0xF0, 0xE0, 0x0C,
+  0x30, 0xF1, 0x40, 0x0C, 0xC0, 0xF0, 0xC0, 0x10, 0x0B, 0x30, 0xE0, 0xF0, 0xD0, 0x60, 0x20, 0x00,
+  0x10, 0x20, 0x40, 0x80, 0xC0, 0x10, 0x03, 0x30, 0xD0, 0xF8, 0x10, 0x04, 0x10, 0x60, 0xB0, 0xE0,
+  0xF0, 0xE0, 0xD0, 0xB0, 0x70, 0x20, 0x01, 0x05, 0x10, 0xE0, 0xF0, 0x80, 0x0B, 0x90, 0xF0, 0xE0,
+  0xF0, 0x20, 0x09, 0x30, 0xF0, 0xB0, 0x30, 0xF0, 0xB0, 0x09, 0xC0, 0xE0, 0x20, 0x00, 0x80, 0xF0,
+  0x60, 0x07, 0x70, 0xF0, 0x50, 0x02, 0xC0, 0xE0, 0x10, 0x0F, 0x0F, 0x06, 0x10, 0x70, 0xC0, 0xE0,
+  0xF0, 0xE0, 0xA0, 0x40, 0x06, 0x40, 0xE0, 0xF6, 0x90, 0x04, 0x30, 0xE0, 0xF0, 0xD0, 0x50, 0x10,
+  0x00, 0x20, 0x80, 0xF1, 0x70, 0x03, 0xB0, 0xF0, 0xD0, 0x10, 0x04, 0x70, 0xF0, 0xE0, 0x10, 0x01,
+  0x30, 0xF1, 0x50, 0x06, 0xE0, 0xF0, 0x50, 0x01, 0x60, 0xF1, 0x10, 0x06, 0xC0, 0xF0, 0x80, 0x01,
+  0x80, 0xFB, 0x90, 0x01, 0x80, 0xFB, 0x90, 0x01, 0x70, 0xF0, 0xE0, 0x0C, 0x30, 0xF1, 0x40, 0x0C,
+  0xC0, 0xF0, 0xC0, 0x10, 0x0B, 0x30, 0xE0, 0xF0, 0xD0, 0x60, 0x20, 0x00, 0x10, 0x20, 0x40, 0x80,
+  0xC0, 0x10, 0x03, 0x30, 0xD0, 0xF8, 0x10, 0x04, 0x10, 0x60, 0xB0, 0xE0, 0xF0, 0xE0, 0xD0, 0xB0,
+  0x70, 0x20, 0x01, 0x03, 0x80, 0xF1, 0x10, 0x00, 0x80, 0xF1, 0x07, 0x80, 0xF1, 0x10, 0x00, 0x80,
+  0xF1, 0x07, 0x80, 0xF1, 0x10, 0x00, 0x80, 0xF1, 0x0F, 0x0F, 0x0F, 0x07, 0x10, 0x70, 0xC0, 0xE0,
+  0xF0, 0xE0, 0xA0, 0x40, 0x06, 0x40, 0xE0, 0xF6, 0x90, 0x04, 0x30, 0xE0, 0xF0, 0xD0, 0x50, 0x10,
+  0x00, 0x20, 0x80, 0xF1, 0x70, 0x03, 0xB0, 0xF0, 0xD0, 0x10, 0x04, 0x70, 0xF0, 0xE0, 0x10, 0x01,
+  0x30, 0xF1, 0x50, 0x06, 0xE0, 0xF0, 0x50, 0x01, 0x60, 0xF1, 0x10, 0x06, 0xC0, 0xF0, 0x80, 0x01,
+  0x80, 0xFB, 0x90, 0x01, 0x80, 0xFB, 0x90, 0x01, 0x70, 0xF0, 0xE0, 0x0C, 0x30, 0xF1, 0x40, 0x0C,
+  0xC0, 0xF0, 0xC0, 0x10, 0x0B, 0x30, 0xE0, 0xF0, 0xD0, 0x60, 0x20, 0x00, 0x10, 0x20, 0x40, 0x80,
+  0xC0, 0x10, 0x03, 0x30, 0xD0, 0xF8, 0x10, 0x04, 0x10, 0x60, 0xB0, 0xE0, 0xF0, 0xE0, 0xD0, 0xB0,
+  0x70, 0x20, 0x01, 0x50, 0xF1, 0x30, 0x04, 0x70, 0xF0, 0xC0, 0x05, 0xA0, 0xF0, 0x90, 0x05, 0xC0,
+  0xF0, 0x40, 0x04, 0x10, 0xD0, 0xE0, 0x10, 0x0F, 0x03, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0,
+  0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0,
+  0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0,
+  0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0,
+  0x01, 0x03, 0x10, 0xD0, 0xF0, 0x80, 0x03, 0xA0, 0xF0, 0xA0, 0x03, 0x60, 0xF0, 0xC0, 0x10, 0x02,
+  0x20, 0xE1, 0x20, 0x03, 0xC0, 0xF0, 0x30, 0x0F, 0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0,
+  0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0,
+  0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0,
+  0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0, 0x04, 0x80, 0xF0, 0xC0,
+  0x02, 0x02, 0x90, 0xF0, 0xD0, 0x04, 0x40, 0xF0, 0xE0, 0xF0, 0x70, 0x03, 0xD0, 0xE0, 0x20, 0xC0,
+  0xF0, 0x20, 0x01, 0x70, 0xF0, 0x60, 0x00, 0x30, 0xF0, 0xB0, 0x00, 0x20, 0xF0, 0xA0, 0x02, 0x70,
+  0xF0, 0x50, 0x0F, 0x04, 0x80, 0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x05,
+  0x80, 0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x05,
+  0x80, 0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x05,
+  0x80, 0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x02, 0x20, 0xF1, 0x70, 0x00,
+  0x30, 0xF1, 0x60, 0x20, 0xF1, 0x70, 0x00, 0x30, 0xF1, 0x60, 0x20, 0xF1, 0x70, 0x00, 0x30, 0xF1,
+  0x60, 0x0F, 0x0D, 0x80, 0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x05, 0x80,
+  0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x05, 0x80,
+  0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x05, 0x80,
+  0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x05, 0x80, 0xF0, 0xC0, 0x02, 0x03, 0x90, 0xF1, 0x40, 0x02,
+  0x20, 0x50, 0x07, 0xB0, 0xF0, 0xE0, 0x40, 0x70, 0xC0, 0xF0, 0xD0, 0x07, 0x20, 0xE0, 0xF1, 0xE0,
+  0x90, 0x40, 0x05, 0x10, 0x60, 0xB0, 0xF0, 0xE1, 0xF0, 0xB0, 0x07, 0x20, 0xF0, 0xA0, 0x50, 0x10,
+  0x40, 0xF1, 0xA0, 0x07, 0x10, 0x03, 0x60, 0xF1, 0x70, 0x07, 0x20, 0x90, 0xD0, 0xF0, 0xE0, 0xF2,
+  0x40, 0x05, 0x50, 0xF7, 0xE0, 0x10, 0x03, 0x40, 0xF1, 0xD0, 0x50, 0x10, 0x00, 0x20, 0x70, 0xF1,
+  0x70, 0x03, 0xC0, 0xF0, 0xD0, 0x10, 0x04, 0xA0, 0xF0, 0xD0, 0x02, 0x30, 0xF1, 0x50, 0x05, 0x50,
+  0xF1, 0x30, 0x01, 0x70, 0xF1, 0x10, 0x05, 0x20, 0xF1, 0x50, 0x01, 0x80, 0xF0, 0xE0, 0x07, 0xF1,
+  0x70, 0x01, 0x80, 0xF0, 0xE0, 0x07, 0xF1, 0x70, 0x01, 0x60, 0xF1, 0x10, 0x05, 0x20, 0xF1, 0x50,
+  0x01, 0x30, 0xF1, 0x50, 0x05, 0x70, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0xD0, 0x10, 0x03, 0x10, 0xE0,
+  0xF0, 0xB0, 0x03, 0x30, 0xF1, 0xC0, 0x40, 0x11, 0x50, 0xD0, 0xF0, 0xE0, 0x20, 0x04, 0x50, 0xE0,
+  0xF5, 0xE0, 0x40, 0x06, 0x20, 0x80, 0xD0, 0xE1, 0xC0, 0x80, 0x10, 0x03, 0x04, 0x80, 0xE0, 0xC0,
+  0x20, 0x01, 0xF0, 0x90, 0x06, 0x40, 0xF2, 0xD0, 0x20, 0x40, 0xF0, 0x70, 0x06, 0x90, 0xF0, 0x20,
+  0x30, 0xE0, 0xF2, 0x20, 0x06, 0xA0, 0xD0, 0x01, 0x30, 0xC0, 0xE0, 0x70, 0x0F, 0x0F, 0x05, 0xA0,
+  0xF0, 0xB0, 0x00, 0x20, 0x90, 0xD0, 0xF0, 0xD0, 0x80, 0x10, 0x04, 0xA0, 0xF0, 0xB0, 0x30, 0xE0,
+  0xF4, 0xD0, 0x10, 0x03, 0xA0, 0xF0, 0xC0, 0xD0, 0xA0, 0x30, 0x00, 0x10, 0x70, 0xF1, 0x80, 0x03,
+  0xA0, 0xF1, 0x90, 0x04, 0x90, 0xF0, 0xE0, 0x03, 0xA0, 0xF1, 0x10, 0x04, 0x40, 0xF1, 0x20, 0x02,
+  0xA0, 0xF0, 0xC0, 0x05, 0x20, 0xF1, 0x30, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x02,
+  0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x02,
+  0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x02,
+  0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x02,
+  0xA0, 0xF0, 0xB0, 0x05, 0x10, 0xF1, 0x40, 0x00, 0x02, 0x10, 0xD0, 0xF0, 0x70, 0x0C, 0x30, 0xE0,
+  0xF0, 0x30, 0x0C, 0x50, 0xF0, 0xD0, 0x10, 0x0C, 0x70, 0xF0, 0x90, 0x0D, 0xA0, 0xF0, 0x50, 0x0F,
+  0x0F, 0x09, 0x20, 0x90, 0xD0, 0xE1, 0xD0, 0x90, 0x20, 0x06, 0x60, 0xF7, 0x50, 0x04, 0x50, 0xF1,
+  0xC0, 0x40, 0x11, 0x50, 0xD0, 0xF1, 0x30, 0x03, 0xD0, 0xF0, 0xD0, 0x10, 0x03, 0x10, 0xE0, 0xF0,
+  0xC0, 0x02, 0x30, 0xF1, 0x50, 0x05, 0x70, 0xF1, 0x20, 0x01, 0x70, 0xF1, 0x10, 0x05, 0x20, 0xF1,
+  0x50, 0x01, 0x80, 0xF0, 0xE0, 0x07, 0xF1, 0x70, 0x01, 0x80, 0xF0, 0xE0, 0x07, 0xF1, 0x70, 0x01,
+  0x70, 0xF1, 0x10, 0x05, 0x20, 0xF1, 0x50, 0x01, 0x30, 0xF1, 0x50, 0x05, 0x60, 0xF1, 0x20, 0x02,
+  0xD0, 0xF0, 0xC0, 0x10, 0x03, 0x10, 0xE0, 0xF0, 0xC0, 0x03, 0x50, 0xF1, 0xC0, 0x40, 0x11, 0x50,
+  0xD0, 0xF1, 0x30, 0x04, 0x60, 0xF7, 0x50, 0x06, 0x20, 0x90, 0xD0, 0xE1, 0xD0, 0x90, 0x20, 0x03,
+  0x08, 0xA0, 0xF0, 0xC0, 0x10, 0x0A, 0x50, 0xF0, 0xE0, 0x20, 0x0A, 0x20, 0xE0, 0xF0, 0x30, 0x0B,
+  0xB0, 0xF0, 0x50, 0x0B, 0x70, 0xF0, 0x80, 0x0F, 0x0F, 0x0A, 0x20, 0x90, 0xD0, 0xE1, 0xD0, 0x90,
+  0x20, 0x06, 0x60, 0xF7, 0x50, 0x04, 0x50, 0xF1, 0xC0, 0x40, 0x11, 0x50, 0xD0, 0xF1, 0x30, 0x03,
+  0xD0, 0xF0, 0xD0, 0x10, 0x03, 0x10, 0xE0, 0xF0, 0xC0, 0x02, 0x30, 0xF1, 0x50, 0x05, 0x70, 0xF1,
+  0x20, 0x01, 0x70, 0xF1, 0x10, 0x05, 0x20, 0xF1, 0x50, 0x01, 0x80, 0xF0, 0xE0, 0x07, 0xF1, 0x70,
+  0x01, 0x80, 0xF0, 0xE0, 0x07, 0xF1, 0x70, 0x01, 0x70, 0xF1, 0x10, 0x05, 0x20, 0xF1, 0x50, 0x01,
+  0x30, 0xF1, 0x50, 0x05, 0x60, 0xF1, 0x20, 0x02, 0xD0, 0xF0, 0xC0, 0x10, 0x03, 0x10, 0xE0, 0xF0,
+  0xC0, 0x03, 0x50, 0xF1, 0xC0, 0x40, 0x11, 0x50, 0xD0, 0xF1, 0x30, 0x04, 0x60, 0xF7, 0x50, 0x06,
+  0x20, 0x90, 0xD0, 0xE1, 0xD0, 0x90, 0x20, 0x03, 0x05, 0x40, 0xF1, 0x30, 0x0A, 0x10, 0xD0, 0xE0,
+  0xF0, 0xC0, 0x0A, 0x80, 0xF0, 0x60, 0x80, 0xF0, 0x70, 0x08, 0x30, 0xF0, 0xB0, 0x01, 0xC0, 0xE0,
+  0x20, 0x07, 0xC0, 0xE0, 0x10, 0x01, 0x20, 0xE0, 0xA0, 0x0F, 0x0F, 0x07, 0x20, 0x90, 0xD0, 0xE1,
+  0xD0, 0x90, 0x20, 0x06, 0x60, 0xF7, 0x50, 0x04, 0x50, 0xF1, 0xC0, 0x40, 0x11, 0x50, 0xD0, 0xF1,
+  0x30, 0x03, 0xD0, 0xF0, 0xD0, 0x10, 0x03, 0x10, 0xE0, 0xF0, 0xC0, 0x02, 0x30, 0xF1, 0x50, 0x05,
+  0x70, 0xF1, 0x20, 0x01, 0x70, 0xF1, 0x10, 0x05, 0x20, 0xF1, 0x50, 0x01, 0x80, 0xF0, 0xE0, 0x07,
+  0xF1, 0x70, 0x01, 0x80, 0xF0, 0xE0, 0x07, 0xF1, 0x70, 0x01, 0x70, 0xF1, 0x10, 0x05, 0x20, 0xF1,
+  0x50, 0x01, 0x30, 0xF1, 0x50, 0x05, 0x60, 0xF1, 0x20, 0x02, 0xD0, 0xF0, 0xC0, 0x10, 0x03, 0x10,
+  0xE0, 0xF0, 0xC0, 0x03, 0x50, 0xF1, 0xC0, 0x40, 0x11, 0x50, 0xD0, 0xF1, 0x30, 0x04, 0x60, 0xF7,
+  0x50, 0x06, 0x20, 0x90, 0xD0, 0xE1, 0xD0, 0x90, 0x20, 0x03, 0x03, 0x30, 0xD0, 0xE0, 0x70, 0x01,
+  0x70, 0xF0, 0x10, 0x06, 0xB0, 0xF2, 0x70, 0x10, 0xB0, 0xE0, 0x06, 0x10, 0xF0, 0xA0, 0x10, 0x90,
+  0xF2, 0xA0, 0x06, 0x30, 0xF0, 0x60, 0x01, 0x80, 0xE0, 0xC0, 0x20, 0x0F, 0x0F, 0x07, 0x20, 0x90,
+  0xD0, 0xE1, 0xD0, 0x90, 0x20, 0x06, 0x60, 0xF7, 0x50, 0x04, 0x50, 0xF1, 0xC0, 0x40, 0x11, 0x50,
+  0xD0, 0xF1, 0x30, 0x03, 0xD0, 0xF0, 0xD0, 0x10, 0x03, 0x10, 0xE0, 0xF0, 0xC0, 0x02, 0x30, 0xF1,
+  0x50, 0x05, 0x70, 0xF1, 0x20, 0x01, 0x70, 0xF1, 0x10, 0x05, 0x20, 0xF1, 0x50, 0x01, 0x80, 0xF0,
+  0xE0, 0x07, 0xF1, 0x70, 0x01, 0x80, 0xF0, 0xE0, 0x07, 0xF1, 0x70, 0x01, 0x70, 0xF1, 0x10, 0x05,
+  0x20, 0xF1, 0x50, 0x01, 0x30, 0xF1, 0x50, 0x05, 0x60, 0xF1, 0x20, 0x02, 0xD0, 0xF0, 0xC0, 0x10,
+  0x03, 0x10, 0xE0, 0xF0, 0xC0, 0x03, 0x50, 0xF1, 0xC0, 0x40, 0x11, 0x50, 0xD0, 0xF1, 0x30, 0x04,
+  0x60, 0xF7, 0x50, 0x06, 0x20, 0x90, 0xD0, 0xE1, 0xD0, 0x90, 0x20, 0x03, 0x03, 0xC0, 0xF0, 0xC0,
+  0x01, 0xD0, 0xF0, 0xB0, 0x07, 0xC0, 0xF0, 0xC0, 0x01, 0xD0, 0xF0, 0xB0, 0x07, 0xC0, 0xF0, 0xC0,
+  0x01, 0xD0, 0xF0, 0xB0, 0x0F, 0x0F, 0x0F, 0x07, 0x20, 0x90, 0xD0, 0xE1, 0xD0, 0x90, 0x20, 0x06,
+  0x60, 0xF7, 0x50, 0x04, 0x50, 0xF1, 0xC0, 0x40, 0x11, 0x50, 0xD0, 0xF1, 0x30, 0x03, 0xD0, 0xF0,
+  0xD0, 0x10, 0x03, 0x10, 0xE0, 0xF0, 0xC0, 0x02, 0x30, 0xF1, 0x50, 0x05, 0x70, 0xF1, 0x20, 0x01,
+  0x70, 0xF1, 0x10, 0x05, 0x20, 0xF1, 0x50, 0x01, 0x80, 0xF0, 0xE0, 0x07, 0xF1, 0x70, 0x01, 0x80,
+  0xF0, 0xE0, 0x07, 0xF1, 0x70, 0x01, 0x70, 0xF1, 0x10, 0x05, 0x20, 0xF1, 0x50, 0x01, 0x30, 0xF1,
+  0x50, 0x05, 0x60, 0xF1, 0x20, 0x02, 0xD0, 0xF0, 0xC0, 0x10, 0x03, 0x10, 0xE0, 0xF0, 0xC0, 0x03,
+  0x50, 0xF1, 0xC0, 0x40, 0x11, 0x50, 0xD0, 0xF1, 0x30, 0x04, 0x60, 0xF7, 0x50, 0x06, 0x20, 0x90,
+  0xD0, 0xE1, 0xD0, 0x90, 0x20, 0x03, 0x08, 0xA0, 0xF1, 0x70, 0x0F, 0x01, 0xA0, 0xF1, 0x70, 0x0F,
+  0x01, 0xA0, 0xF1, 0x70, 0x0F, 0x0F, 0x0F, 0x06, 0x40, 0xFF, 0x04, 0x40, 0xFF, 0x0F, 0x0F, 0x0F,
+  0x07, 0xA0, 0xF1, 0x70, 0x0F, 0x01, 0xA0, 0xF1, 0x70, 0x0F, 0x01, 0xA0, 0xF1, 0x70, 0x0F, 0x0F,
+  0x0F, 0x04, 0x0C, 0x70, 0x40, 0x04, 0x20, 0x90, 0xD0, 0xE1, 0xC0, 0x80, 0x10, 0x50, 0xF0, 0xA0,
+  0x03, 0x60, 0xF6, 0xE1, 0xD0, 0x10, 0x02, 0x50, 0xF1, 0xC0, 0x40, 0x11, 0x50, 0xD0, 0xF1, 0x40,
+  0x03, 0xD0, 0xF0, 0xD0, 0x10, 0x02, 0x10, 0xD0, 0xF1, 0xB0, 0x02, 0x40, 0xF1, 0x50, 0x02, 0x10,
+  0xC0, 0xF0, 0xA0, 0xF1, 0x20, 0x01, 0x70, 0xF1, 0x10, 0x02, 0xA0, 0xF0, 0x50, 0x20, 0xF1, 0x50,
+  0x01, 0x80, 0xF0, 0xE0, 0x02, 0x90, 0xF0, 0x60, 0x01, 0xF1, 0x70, 0x01, 0x80, 0xF0, 0xE0, 0x01,
+  0x80, 0xF0, 0x80, 0x02, 0xF1, 0x70, 0x01, 0x60, 0xF1, 0x00, 0x70, 0xF0, 0x90, 0x02, 0x20, 0xF1,
+  0x60, 0x01, 0x30, 0xF1, 0x90, 0xF0, 0xA0, 0x03, 0x60, 0xF1, 0x20, 0x02, 0xC0, 0xF1, 0xC0, 0x10,
+  0x02, 0x10, 0xE0, 0xF0, 0xC0, 0x03, 0x50, 0xF1, 0xC0, 0x40, 0x11, 0x50, 0xD0, 0xF1, 0x40, 0x02,
+  0x10, 0xD0, 0xE1, 0xF6, 0x50, 0x03, 0xA0, 0xF0, 0x40, 0x20, 0x90, 0xD0, 0xF0, 0xE0, 0xD0, 0x90,
+  0x20, 0x04, 0x61, 0x0C, 0x02, 0x10, 0xC0, 0xF0, 0x90, 0x0C, 0x20, 0xE0, 0xF0, 0x40, 0x0C, 0x40,
+  0xF0, 0xE0, 0x10, 0x0C, 0x60, 0xF0, 0xB0, 0x0D, 0x80, 0xF0, 0x70, 0x0F, 0x0F, 0x07, 0xC0, 0xF0,
+  0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0,
+  0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0,
+  0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0,
+  0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xB0, 0xF0,
+  0x90, 0x05, 0x50, 0xF1, 0x20, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x90, 0xF1, 0x20, 0x02, 0x70, 0xF1,
+  0x20, 0x03, 0x30, 0xF2, 0x20, 0x02, 0x20, 0xF1, 0xC0, 0x30, 0x00, 0x10, 0x60, 0xE0, 0xA0, 0xF1,
+  0x20, 0x03, 0x60, 0xF5, 0xA0, 0x30, 0xF1, 0x20, 0x04, 0x40, 0xB0, 0xE1, 0xC0, 0x60, 0x00, 0x30,
+  0xF1, 0x20, 0x00, 0x08, 0x80, 0xF0, 0xD0, 0x10, 0x0A, 0x40, 0xF0, 0xE0, 0x30, 0x0A, 0x10, 0xD0,
+  0xF0, 0x40, 0x0B, 0xA0, 0xF0, 0x70, 0x0B, 0x60, 0xF0, 0x90, 0x0F, 0x0F, 0x08, 0xC0, 0xF0, 0x80,
+  0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80,
+  0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80,
+  0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80,
+  0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xB0, 0xF0, 0x90,
+  0x05, 0x50, 0xF1, 0x20, 0x02, 0xA0, 0xF0, 0xB0, 0x05, 0x90, 0xF1, 0x20, 0x02, 0x70, 0xF1, 0x20,
+  0x03, 0x30, 0xF2, 0x20, 0x02, 0x20, 0xF1, 0xC0, 0x30, 0x00, 0x10, 0x60, 0xE0, 0xA0, 0xF1, 0x20,
+  0x03, 0x60, 0xF5, 0xA0, 0x30, 0xF1, 0x20, 0x04, 0x40, 0xB0, 0xE1, 0xC0, 0x60, 0x00, 0x30, 0xF1,
+  0x20, 0x00, 0x05, 0x30, 0xF1, 0x50, 0x0B, 0xC0, 0xF0, 0xE0, 0xD0, 0x10, 0x09, 0x60, 0xF0, 0x80,
+  0x60, 0xF0, 0x80, 0x08, 0x20, 0xE0, 0xC0, 0x01, 0xB0, 0xF0, 0x30, 0x07, 0xA0, 0xF0, 0x20, 0x01,
+  0x10, 0xE0, 0xC0, 0x0F, 0x0F, 0x05, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0,
+  0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0,
+  0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0,
+  0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0,
+  0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xB0, 0xF0, 0x90, 0x05, 0x50, 0xF1, 0x20, 0x02, 0xA0, 0xF0,
+  0xB0, 0x05, 0x90, 0xF1, 0x20, 0x02, 0x70, 0xF1, 0x20, 0x03, 0x30, 0xF2, 0x20, 0x02, 0x20, 0xF1,
+  0xC0, 0x30, 0x00, 0x10, 0x60, 0xE0, 0xA0, 0xF1, 0x20, 0x03, 0x60, 0xF5, 0xA0, 0x30, 0xF1, 0x20,
+  0x04, 0x40, 0xB0, 0xE1, 0xC0, 0x60, 0x00, 0x30, 0xF1, 0x20, 0x00, 0x03, 0xB0, 0xF0, 0xD0, 0x01,
+  0xB0, 0xF0, 0xC0, 0x07, 0xB0, 0xF0, 0xD0, 0x01, 0xB0, 0xF0, 0xC0, 0x07, 0xB0, 0xF0, 0xD0, 0x01,
+  0xB0, 0xF0, 0xC0, 0x0F, 0x0F, 0x0F, 0x05, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0,
+  0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0,
+  0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0,
+  0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0, 0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xC0,
+  0xF0, 0x80, 0x05, 0x30, 0xF1, 0x20, 0x02, 0xB0, 0xF0, 0x90, 0x05, 0x50, 0xF1, 0x20, 0x02, 0xA0,
+  0xF0, 0xB0, 0x05, 0x90, 0xF1, 0x20, 0x02, 0x70, 0xF1, 0x20, 0x03, 0x30, 0xF2, 0x20, 0x02, 0x20,
+  0xF1, 0xC0, 0x30, 0x00, 0x10, 0x60, 0xE0, 0xA0, 0xF1, 0x20, 0x03, 0x60, 0xF5, 0xA0, 0x30, 0xF1,
+  0x20, 0x04, 0x40, 0xB0, 0xE1, 0xC0, 0x60, 0x00, 0x30, 0xF1, 0x20, 0x00, 0x07, 0x10, 0xD0, 0xF0,
+  0x90, 0x0A, 0x90, 0xF0, 0xB0, 0x0A, 0x50, 0xF0, 0xD0, 0x10, 0x09, 0x20, 0xE1, 0x20, 0x0A, 0xB0,
+  0xF0, 0x40, 0x0F, 0x0F, 0x03, 0x10, 0xE0, 0xF0, 0x70, 0x06, 0x10, 0xF1, 0x60, 0x00, 0x90, 0xF0,
+  0xD0, 0x06, 0x70, 0xF0, 0xE0, 0x10, 0x00, 0x30, 0xF1, 0x40, 0x05, 0xD0, 0xF0, 0x80, 0x02, 0xB0,
+  0xF0, 0xA0, 0x04, 0x40, 0xF1, 0x20, 0x02, 0x50, 0xF1, 0x10, 0x03, 0xA0, 0xF0, 0xB0, 0x04, 0xD0,
+  0xF0, 0x70, 0x02, 0x20, 0xF1, 0x50, 0x04, 0x70, 0xF0, 0xD0, 0x02, 0x80, 0xF0, 0xD0, 0x05, 0x10,
+  0xF1, 0x40, 0x01, 0xD0, 0xF0, 0x70, 0x06, 0xA0, 0xF0, 0xA0, 0x00, 0x50, 0xF1, 0x10, 0x06, 0x30,
+  0xF1, 0x20, 0xB0, 0xF0, 0xA0, 0x08, 0xC0, 0xF0, 0xA0, 0xF1, 0x30, 0x08, 0x60, 0xF2, 0xC0, 0x09,
+  0x10, 0xE0, 0xF1, 0x60, 0x0A, 0x90, 0xF0, 0xE0, 0x10, 0x0A, 0xC0, 0xF0, 0x80, 0x0A, 0x40, 0xF1,
+  0x20, 0x09, 0x30, 0xD0, 0xF0, 0xA0, 0x08, 0xE0, 0xF2, 0xE0, 0x20, 0x08, 0xE0, 0xF0, 0xE0, 0xB0,
+  0x30, 0x07, 0x01, 0xA0, 0xF0, 0xB0, 0x0D, 0xA0, 0xF0, 0xB0, 0x0D, 0xA0, 0xF0, 0xB0, 0x0D, 0xA0,
+  0xF0, 0xB0, 0x0D, 0xA0, 0xF0, 0xB0, 0x0D, 0xA0, 0xF0, 0xB0, 0x0D, 0xA0, 0xF0, 0xB0, 0x00, 0x30,
+  0xA0, 0xE0, 0xF0, 0xD0, 0x80, 0x10, 0x05, 0xA0, 0xF0, 0xB0, 0x40, 0xE0, 0xF4, 0xD0, 0x20, 0x04,
+  0xA0, 0xF0, 0xC0, 0xE0, 0xA0, 0x30, 0x00, 0x20, 0x70, 0xF1, 0xC0, 0x04, 0xA0, 0xF1, 0xA0, 0x04,
+  0x50, 0xF1, 0x60, 0x03, 0xA0, 0xF1, 0x20, 0x05, 0xC0, 0xF0, 0xB0, 0x03, 0xA0, 0xF0, 0xD0, 0x06,
+  0x70, 0xF0, 0xE0, 0x03, 0xA0, 0xF0, 0xB0, 0x06, 0x60, 0xF1, 0x10, 0x02, 0xA0, 0xF0, 0xB0, 0x06,
+  0x60, 0xF1, 0x10, 0x02, 0xA0, 0xF0, 0xD0, 0x06, 0x70, 0xF0, 0xE0, 0x03, 0xA0, 0xF1, 0x20, 0x05,
+  0xC0, 0xF0, 0xB0, 0x03, 0xA0, 0xF1, 0xA0, 0x04, 0x50, 0xF1, 0x60, 0x03, 0xA0, 0xF0, 0xC0, 0xE0,
+  0xA0, 0x30, 0x00, 0x10, 0x70, 0xF1, 0xC0, 0x04, 0xA0, 0xF0, 0xB0, 0x40, 0xF5, 0xD0, 0x20, 0x04,
+  0xA0, 0xF0, 0xB0, 0x00, 0x30, 0xA0, 0xE0, 0xF0, 0xD0, 0x80, 0x10, 0x05, 0xA0, 0xF0, 0xB0, 0x0D,
+  0xA0, 0xF0, 0xB0, 0x0D, 0xA0, 0xF0, 0xB0, 0x0D, 0xA0, 0xF0, 0xB0, 0x0D, 0xA0, 0xF0, 0xB0, 0x0B,
+  0x02, 0x10, 0xF1, 0x80, 0x00, 0x20, 0xF1, 0x70, 0x05, 0x10, 0xF1, 0x80, 0x00, 0x20, 0xF1, 0x70,
+  0x05, 0x10, 0xF1, 0x80, 0x00, 0x20, 0xF1, 0x70, 0x0F, 0x0F, 0x0F, 0x10, 0xE0, 0xF0, 0x70, 0x06,
+  0x10, 0xF1, 0x60, 0x00, 0x90, 0xF0, 0xD0, 0x06, 0x70, 0xF0, 0xE0, 0x10, 0x00, 0x30, 0xF1, 0x40,
+  0x05, 0xD0, 0xF0, 0x80, 0x02, 0xB0, 0xF0, 0xA0, 0x04, 0x40, 0xF1, 0x20, 0x02, 0x50, 0xF1, 0x10,
+  0x03, 0xA0, 0xF0, 0xB0, 0x04, 0xD0, 0xF0, 0x70, 0x02, 0x20, 0xF1, 0x50, 0x04, 0x70, 0xF0, 0xD0,
+  0x02, 0x80, 0xF0, 0xD0, 0x05, 0x10, 0xF1, 0x40, 0x01, 0xD0, 0xF0, 0x70, 0x06, 0xA0, 0xF0, 0xA0,
+  0x00, 0x50, 0xF1, 0x10, 0x06, 0x30, 0xF1, 0x20, 0xB0, 0xF0, 0xA0, 0x08, 0xC0, 0xF0, 0xA0, 0xF1,
+  0x30, 0x08, 0x60, 0xF2, 0xC0, 0x09, 0x10, 0xE0, 0xF1, 0x60, 0x0A, 0x90, 0xF0, 0xE0, 0x10, 0x0A,
+  0xC0, 0xF0, 0x80, 0x0A, 0x40, 0xF1, 0x20, 0x09, 0x30, 0xD0, 0xF0, 0xA0, 0x08, 0xE0, 0xF2, 0xE0,
+  0x20, 0x08, 0xE0, 0xF0, 0xE0, 0xB0, 0x30, 0x07,
+};
+
+static const SmoothGlyph smoothLargeGlyphs[SMOOTH_GLYPH_COUNT] = {
+  {    0,  0,  0,  8,   0,   0},   // U+0020
+  {    0, 10, 19, 10,   0, -19},   // U+0021
+  {   66, 12, 19, 12,   0, -19},   // U+0022
+  {  132, 22, 18, 22,   0, -18},   // U+0023
+  {  259, 17, 24, 17,   0, -20},   // U+0024
+  {  411, 25, 19, 25,   0, -19},   // U+0025
+  {  639, 20, 19, 20,   0, -19},   // U+0026
+  {  819,  7, 19,  7,   0, -19},   // U+0027
+  {  853, 10, 23, 10,   0, -20},   // U+0028
+  {  946, 10, 23, 10,   0, -20},   // U+0029
+  { 1043, 13, 19, 13,   0, -19},   // U+002A
+  { 1145, 22, 16, 22,   0, -16},   // U+002B
+  { 1220,  8,  6,  8,   0,  -3},   // U+002C
+  { 1244,  9,  8,  9,   0,  -8},   // U+002D
+  { 1256,  8,  3,  8,   0,  -3},   // U+002E
+  { 1269,  9, 21,  9,   0, -19},   // U+002F
+  { 1354, 17, 19, 17,   0, -19},   // U+0030
+  { 1511, 17, 19, 17,   0, -19},   // U+0031
+  { 1596, 17, 19, 17,   0, -19},   // U+0032
+  { 1691, 17, 19, 17,   0, -19},   // U+0033
+  { 1806, 17, 19, 17,   0, -19},   // U+0034
+  { 1924, 17, 19, 17,   0, -19},   // U+0035
+  { 2028, 17, 19, 17,   0, -19},   // U+0036
+  { 2176, 17, 19, 17,   0, -19},   // U+0037
+  { 2256, 17, 19, 17,   0, -19},   // U+0038
+  { 2418, 17, 19, 17,   0, -19},   // U+0039
+  { 2562,  9, 13,  9,   0, -13},   // U+003A
+  { 2591,  9, 16,  9,   0, -13},   // U+003B
+  { 2631, 22, 15, 22,   0, -15},   // U+003C
+  { 2723, 22, 12, 22,   0, -12},   // U+003D
+  { 2747, 22, 15, 22,   0, -15},   // U+003E
+  { 2846, 14, 19, 14,   0, -19},   // U+003F
+  { 2929, 26, 23, 26,   0, -18},   // U+0040
+  { 3227, 18, 19, 18,   0, -19},   // U+0041
+  { 3360, 18, 19, 18,   0, -19},   // U+0042
+  { 3505, 18, 19, 18,   0, -19},   // U+0043
+  { 3628, 20, 19, 20,   0, -19},   // U+0044
+  { 3787, 16, 19, 16,   0, -19},   // U+0045
+  { 3864, 15, 19, 15,   0, -19},   // U+0046
+  { 3941, 20, 19, 20,   0, -19},   // U+0047
+  { 4083, 20, 19, 20,   0, -19},   // U+0048
+  { 4209,  8, 19,  8,   0, -19},   // U+0049
+  { 4286, 10, 24,  8,  -2, -19},   // U+004A
+  { 4386, 18, 19, 17,   0, -19},   // U+004B
+  { 4546, 15, 19, 14,   0, -19},   // U+004C
+  { 4622, 22, 19, 22,   0, -19},   // U+004D
+  { 4857, 19, 19, 19,   0, -19},   // U+004E
+  { 5057, 20, 19, 20,   0, -19},   // U+004F
+  { 5223, 16, 19, 16,   0, -19},   // U+0050
+  { 5340, 20, 22, 20,   0, -19},   // U+0051
+  { 5517, 18, 19, 18,   0, -19},   // U+0052
+  { 5670, 17, 19, 17,   0, -19},   // U+0053
+  { 5801, 17, 19, 16,  -1, -19},   // U+0054
+  { 5876, 19, 19, 19,   0, -19},   // U+0055
+  { 6033, 18, 19, 18,   0, -19},   // U+0056
+  { 6171, 26, 19, 26,   0, -19},   // U+0057
+  { 6430, 18, 19, 18,   0, -19},   // U+0058
+  { 6582, 17, 19, 16,  -1, -19},   // U+0059
+  { 6698, 18, 19, 18,   0, -19},   // U+005A
+  { 6784, 10, 23, 10,   0, -20},   // U+005B
+  { 6877,  9, 21,  9,   0, -19},   // U+005C
+  { 6960, 10, 23, 10,   0, -20},   // U+005D
+  { 7053, 22, 19, 22,   0, -19},   // U+005E
+  { 7129, 15,  6, 13,  -1,   0},   // U+005F
+  { 7138, 13, 21, 13,   0, -21},   // U+0060
+  { 7175, 16, 14, 16,   0, -14},   // U+0061
+  { 7290, 17, 20, 17,   0, -20},   // U+0062
+  { 7444, 14, 14, 14,   0, -14},   // U+0063
+  { 7533, 17, 20, 17,   0, -20},   // U+0064
+  { 7677, 16, 14, 16,   0, -14},   // U+0065
+  { 7781, 10, 20,  9,   0, -20},   // U+0066
+  { 7863, 17, 19, 17,   0, -14},   // U+0067
+  { 8019, 16, 20, 16,   0, -20},   // U+0068
+  { 8165,  7, 20,  7,   0, -20},   // U+0069
+  { 8235,  8, 25,  7,  -1, -20},   // U+006A
+  { 8329, 15, 20, 15,   0, -20},   // U+006B
+  { 8470,  7, 20,  7,   0, -20},   // U+006C
+  { 8551, 25, 14, 25,   0, -14},   // U+006D
+  { 8734, 16, 14, 16,   0, -14},   // U+006E
+  { 8856, 16, 14, 16,   0, -14},   // U+006F
+  { 8967, 17, 19, 17,   0, -14},   // U+0070
+  { 9117, 17, 19, 17,   0, -14},   // U+0071
+  { 9257, 11, 14, 11,   0, -14},   // U+0072
+  { 9327, 14, 14, 14,   0, -14},   // U+0073
+  { 9422, 10, 18, 10,   0, -18},   // U+0074
+  { 9497, 16, 14, 16,   0, -14},   // U+0075
+  { 9615, 15, 14, 15,   0, -14},   // U+0076
+  { 9718, 21, 14, 21,   0, -14},   // U+0077
+  { 9898, 15, 14, 15,   0, -14},   // U+0078
+  {10016, 15, 19, 15,   0, -14},   // U+0079
+  {10141, 14, 14, 14,   0, -14},   // U+007A
+  {10206, 17, 24, 17,   0, -20},   // U+007B
+  {10317,  9, 26,  9,   0, -20},   // U+007C
+  {10422, 17, 24, 17,   0, -20},   // U+007D
+  {10520, 22, 11, 22,   0, -11},   // U+007E
+  {10577,  0,  0,  8,   0,   0},   // U+00A0
+  {10577, 10, 19, 10,   0, -14},   // U+00A1
+  {10643, 17, 22, 17,   0, -18},   // U+00A2
+  {10772, 17, 19, 17,   0, -19},   // U+00A3
+  {10859, 17, 17, 17,   0, -17},   // U+00A4
+  {10991, 17, 19, 17,   0, -19},   // U+00A5
+  {11100,  9, 23,  9,   0, -19},   // U+00A6
+  {11183, 13, 21, 13,   0, -19},   // U+00A7
+  {11325, 13, 20, 13,   0, -20},   // U+00A8
+  {11363, 26, 19, 26,   0, -19},   // U+00A9
+  {11580, 12, 19, 12,   0, -19},   // U+00AA
+  {11671, 16, 13, 16,   0, -13},   // U+00AB
+  {11775, 22, 11, 22,   0, -11},   // U+00AC
+  {11807,  9,  8,  9,   0,  -8},   // U+00AD
+  {11819, 26, 19, 26,   0, -19},   // U+00AE
+  {12067, 13, 19, 13,   0, -19},   // U+00AF
+  {12089, 13, 19, 13,   0, -19},   // U+00B0
+  {12155, 22, 16, 22,   0, -16},   // U+00B1
+  {12219, 10, 19, 10,   0, -19},   // U+00B2
+  {12282, 10, 19, 10,   0, -19},   // U+00B3
+  {12351, 13, 21, 13,   0, -21},   // U+00B4
+  {12388, 17, 19, 17,   0, -14},   // U+00B5
+  {12532, 17, 22, 17,   0, -19},   // U+00B6
+  {12705,  8, 11,  8,   0, -11},   // U+00B7
+  {12722, 13,  5, 13,   0,   0},   // U+00B8
+  {12745, 10, 19, 10,   0, -19},   // U+00B9
+  {12798, 12, 19, 12,   0, -19},   // U+00BA
+  {12883, 16, 13, 16,   0, -13},   // U+00BB
+  {12991, 25, 19, 25,   0, -19},   // U+00BC
+  {13179, 25, 19, 25,   0, -19},   // U+00BD
+  {13361, 25, 19, 25,   0, -19},   // U+00BE
+  {13565, 14, 19, 14,   0, -14},   // U+00BF
+  {13658, 18, 24, 18,   0, -24},   // U+00C0
+  {13806, 18, 24, 18,   0, -24},   // U+00C1
+  {13955, 18, 24, 18,   0, -24},   // U+00C2
+  {14109, 18, 24, 18,   0, -24},   // U+00C3
+  {14268, 18, 24, 18,   0, -24},   // U+00C4
+  {14427, 18, 24, 18,   0, -24},   // U+00C5
+  {14599, 25, 19, 25,   0, -19},   // U+00C6
+  {14727, 18, 24, 18,   0, -19},   // U+00C7
+  {14872, 16, 24, 16,   0, -24},   // U+00C8
+  {14965, 16, 24, 16,   0, -24},   // U+00C9
+  {15058, 16, 24, 16,   0, -24},   // U+00CA
+  {15161, 16, 24, 16,   0, -24},   // U+00CB
+  {15264,  8, 24,  8,   0, -24},   // U+00CC
+  {15356,  8, 24,  8,   0, -24},   // U+00CD
+  {15447,  9, 24,  8,  -1, -24},   // U+00CE
+  {15544,  8, 24,  8,   0, -24},   // U+00CF
+  {15640, 20, 19, 20,   0, -19},   // U+00D0
+  {15797, 19, 24, 19,   0, -24},   // U+00D1
+  {16021, 20, 24, 20,   0, -24},   // U+00D2
+  {16205, 20, 24, 20,   0, -24},   // U+00D3
+  {16389, 20, 24, 20,   0, -24},   // U+00D4
+  {16578, 20, 24, 20,   0, -24},   // U+00D5
+  {16769, 20, 24, 20,   0, -24},   // U+00D6
+  {16959, 22, 16, 22,   0, -16},   // U+00D7
+  {17068, 20, 21, 20,   0, -20},   // U+00D8
+  {17290, 19, 24, 19,   0, -24},   // U+00D9
+  {17463, 19, 24, 19,   0, -24},   // U+00DA
+  {17636, 19, 24, 19,   0, -24},   // U+00DB
+  {17817, 19, 24, 19,   0, -24},   // U+00DC
+  {18000, 17, 24, 16,  -1, -24},   // U+00DD
+  {18130, 16, 19, 16,   0, -19},   // U+00DE
+  {18247, 16, 20, 16,   0, -20},   // U+00DF
+  {18433, 16, 21, 16,   0, -21},   // U+00E0
+  {18573, 16, 21, 16,   0, -21},   // U+00E1
+  {18713, 16, 21, 16,   0, -21},   // U+00E2
+  {18864, 16, 20, 16,   0, -20},   // U+00E3
+  {19012, 16, 20, 16,   0, -20},   // U+00E4
+  {19154, 16, 23, 16,   0, -23},   // U+00E5
+  {19313, 26, 14, 26,   0, -14},   // U+00E6
+  {19479, 14, 19, 14,   0, -14},   // U+00E7
+  {19589, 16, 21, 16,   0, -21},   // U+00E8
+  {19718, 16, 21, 16,   0, -21},   // U+00E9
+  {19847, 16, 21, 16,   0, -21},   // U+00EA
+  {19987, 16, 20, 16,   0, -20},   // U+00EB
+  {20115,  8, 21,  7,  -1, -21},   // U+00EC
+  {20193,  8, 21,  7,   0, -21},   // U+00ED
+  {20273,  9, 21,  7,  -1, -21},   // U+00EE
+  {20364,  9, 20,  7,  -1, -20},   // U+00EF
+  {20443, 16, 20, 16,   0, -20},   // U+00F0
+  {20604, 16, 20, 16,   0, -20},   // U+00F1
+  {20760, 16, 21, 16,   0, -21},   // U+00F2
+  {20896, 16, 21, 16,   0, -21},   // U+00F3
+  {21032, 16, 21, 16,   0, -21},   // U+00F4
+  {21178, 16, 20, 16,   0, -20},   // U+00F5
+  {21324, 16, 20, 16,   0, -20},   // U+00F6
+  {21462, 22, 14, 22,   0, -14},   // U+00F7
+  {21506, 16, 16, 16,   0, -15},   // U+00F8
+  {21652, 16, 21, 16,   0, -21},   // U+00F9
+  {21795, 16, 21, 16,   0, -21},   // U+00FA
+  {21938, 16, 21, 16,   0, -21},   // U+00FB
+  {22091, 16, 20, 16,   0, -20},   // U+00FC
+  {22236, 15, 26, 15,   0, -21},   // U+00FD
+  {22386, 17, 25, 17,   0, -20},   // U+00FE
+  {22560, 15, 25, 15,   0, -20},   // U+00FF
+};
+
+static const SmoothFont smoothFontLarge = {
+  smoothLargeData, smoothLargeGlyphs, 19, 25, 7, SMOOTH_RLE
+};
+
+#endif // SMOOTH_FONTS_H
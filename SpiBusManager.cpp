@@ -0,0 +1,163 @@
+#include "SpiBusManager.h"
+
+SpiBusManager::SpiBusManager()
+  : busMutex(nullptr), handoffSemaphore(nullptr), handoffFrom(-1), initialized(false),
+    owner(-1), depth(0), ownerSince(0),
+    windowStart(0)
+{
+  statsLock = portMUX_INITIALIZER_UNLOCKED;
+  memset((void*)waiting, 0, sizeof(waiting));
+  clockHz[SPI_DEVICE_TFT] = SPI_TFT_CLOCK_HZ;
+  clockHz[SPI_DEVICE_SD] = SPI_SD_CLOCK_HZ;
+  csPin[SPI_DEVICE_TFT] = TFT_CS;
+  csPin[SPI_DEVICE_SD] = SD_CS;
+}
+
+SpiBusManager::~SpiBusManager() {}
+
+bool SpiBusManager::initialize() {
+  if (initialized) return true;
+
+  Serial.println(F("Inicializando bus SPI compartido..."));
+
+  busMutex = xSemaphoreCreateRecursiveMutex();
+  if (!busMutex) {
+    Serial.println(F("ERROR: No se pudo crear el mutex del bus SPI"));
+    return false;
+  }
+  
+  handoffSemaphore = xSemaphoreCreateBinary();
+  if (!handoffSemaphore) {
+    Serial.println(F("ERROR: No se pudo crear el semáforo de cesión del bus SPI"));
+    return false;
+  }
+
+  // Ambos CS en reposo antes de que ningún cliente toque el bus
+  for (uint8_t i = 0; i < SPI_DEVICE_COUNT; i++) {
+    pinMode(csPin[i], OUTPUT);
+    digitalWrite(csPin[i], HIGH);
+  }
+
+  // Único SPI.begin del sistema; cada cliente fija su reloj en sus transacciones
+  SPI.begin(TFT_SCLK, TFT_MISO, TFT_MOSI, -1);
+
+  windowStart = millis();
+  initialized = true;
+  return true;
+}
+
+bool SpiBusManager::acquire(SpiDevice device, uint32_t timeoutMs) {
+  if (!busMutex) return true;
+
+  unsigned long startTime = micros();
+  TickType_t ticks = (timeoutMs == portMAX_DELAY) ? portMAX_DELAY : pdMS_TO_TICKS(timeoutMs);
+
+  portENTER_CRITICAL(&statsLock);
+  waiting[device]++;
+  portEXIT_CRITICAL(&statsLock);
+
+  BaseType_t taken = xSemaphoreTakeRecursive(busMutex, ticks);
+
+  portENTER_CRITICAL(&statsLock);
+  waiting[device]--;
+  portEXIT_CRITICAL(&statsLock);
+
+  if (taken != pdTRUE) return false;
+
+  if (depth++ == 0) {
+    unsigned long now = micros();
+    uint32_t waited = now - startTime;
+
+    portENTER_CRITICAL(&statsLock);
+    owner = device;
+    ownerSince = now;
+    portEXIT_CRITICAL(&statsLock);
+
+    // Quien cedió el bus espera bloqueado a que otro lo tome
+    if (handoffFrom >= 0 && handoffFrom != device) {
+      handoffFrom = -1;
+      xSemaphoreGive(handoffSemaphore);
+    }
+
+    SpiDeviceStats& s = stats[device];
+    s.transactions++;
+    s.waitMicros += waited;
+    if (waited > s.maxWaitMicros) s.maxWaitMicros = waited;
+  }
+  return true;
+}
+
+void SpiBusManager::release(SpiDevice device) {
+  if (!busMutex || depth == 0) return;
+
+  if (--depth == 0) {
+    portENTER_CRITICAL(&statsLock);
+    accountBusyTime(micros());
+    owner = -1;
+    portEXIT_CRITICAL(&statsLock);
+  }
+  xSemaphoreGiveRecursive(busMutex);
+}
+
+void SpiBusManager::yieldIfContended(SpiDevice device) {
+  if (!busMutex || owner != device || depth != 1) return;
+
+  bool contended = false;
+  for (uint8_t i = 0; i < SPI_DEVICE_COUNT; i++) {
+    if (i != device && waiting[i] > 0) contended = true;
+  }
+  if (!contended) return;
+
+  stats[device].yields++;
+  
+  // Entrega bloqueante: sin ella, el que cede vuelve a tomar el mutex antes
+  // de que el otro núcleo despierte. Se espera sin ocupar la CPU a que el
+  // otro lo tome; el plazo cubre al que se rinde antes de conseguirlo.
+  xSemaphoreTake(handoffSemaphore, 0);   // Entrega tardía de una cesión anterior
+  handoffFrom = device;
+  release(device);
+  xSemaphoreTake(handoffSemaphore, pdMS_TO_TICKS(SPI_HANDOFF_TIMEOUT_MS));
+  handoffFrom = -1;
+  
+  acquire(device);
+}
+
+void SpiBusManager::accountBusyTime(unsigned long now) {
+  if (owner < 0) return;
+
+  stats[owner].busyMicros += now - ownerSince;
+  ownerSince = now;
+}
+
+void SpiBusManager::updateStatistics() {
+  unsigned long currentTime = millis();
+  unsigned long elapsed = currentTime - windowStart;
+  if (elapsed < SPI_STATS_WINDOW_MS) return;
+
+  portENTER_CRITICAL(&statsLock);
+  accountBusyTime(micros());
+  for (uint8_t i = 0; i < SPI_DEVICE_COUNT; i++) {
+    stats[i].utilization = min((uint32_t)100, (uint32_t)(stats[i].busyMicros / (elapsed * 10)));
+    stats[i].busyMicros = 0;
+  }
+  portEXIT_CRITICAL(&statsLock);
+  windowStart = currentTime;
+}
+
+void SpiBusManager::printStatistics() const {
+  const char* names[SPI_DEVICE_COUNT] = {"TFT", "SD"};
+
+  Serial.println(F("\n=== BUS SPI ==="));
+  for (uint8_t i = 0; i < SPI_DEVICE_COUNT; i++) {
+    Serial.print(names[i]);
+    Serial.print(F(": uso "));
+    Serial.print(stats[i].utilization);
+    Serial.print(F("% | transacciones "));
+    Serial.print(stats[i].transactions);
+    Serial.print(F(" | espera máx "));
+    Serial.print(stats[i].maxWaitMicros);
+    Serial.print(F(" us | cesiones "));
+    Serial.println(stats[i].yields);
+  }
+  Serial.println(F("===============\n"));
+}
@@ -0,0 +1,97 @@
+#ifndef SPI_BUS_MANAGER_H
+#define SPI_BUS_MANAGER_H
+
+#include "Config.h"
+#include <SPI.h>
+#include <freertos/semphr.h>
+
+// Relojes por dispositivo en el bus compartido (SCLK/MOSI/MISO = GPIO12/11/13)
+#define SPI_TFT_CLOCK_HZ      40000000
+#define SPI_SD_CLOCK_HZ       4000000
+#define SPI_STATS_WINDOW_MS   1000
+#define SPI_HANDOFF_TIMEOUT_MS 2      // Espera máxima a que otro tome el bus cedido
+
+enum SpiDevice {
+  SPI_DEVICE_TFT = 0,
+  SPI_DEVICE_SD = 1,
+  SPI_DEVICE_COUNT
+};
+
+struct SpiDeviceStats {
+  uint32_t transactions;
+  uint32_t busyMicros;
+  uint32_t waitMicros;
+  uint32_t maxWaitMicros;
+  uint32_t yields;
+  uint8_t utilization;   // % del bus en la última ventana
+
+  SpiDeviceStats() : transactions(0), busyMicros(0), waitMicros(0),
+                     maxWaitMicros(0), yields(0), utilization(0) {}
+};
+
+class SpiBusManager {
+private:
+  SemaphoreHandle_t busMutex;
+  SemaphoreHandle_t handoffSemaphore;   // Lo da quien toma el bus cedido
+  volatile int8_t handoffFrom;          // Dispositivo que cedió el bus; -1 = ninguno
+  bool initialized;
+
+  // Propietario actual; el mutex es recursivo y solo se mide el nivel externo
+  volatile int8_t owner;
+  uint8_t depth;
+  unsigned long ownerSince;
+
+  // waiting[], owner/ownerSince y busyMicros se tocan desde el loop y desde
+  // la tarea de volcado del registro (otro núcleo): siempre bajo statsLock
+  portMUX_TYPE statsLock;
+  volatile uint8_t waiting[SPI_DEVICE_COUNT];
+  uint32_t clockHz[SPI_DEVICE_COUNT];
+  int8_t csPin[SPI_DEVICE_COUNT];
+  SpiDeviceStats stats[SPI_DEVICE_COUNT];
+  unsigned long windowStart;
+
+  void accountBusyTime(unsigned long now);   // Con statsLock tomado
+
+public:
+  SpiBusManager();
+  ~SpiBusManager();
+
+  bool initialize();
+  bool isInitialized() const { return initialized; }
+
+  SPIClass& getBus() { return SPI; }
+  uint32_t getClock(SpiDevice device) const { return clockHz[device]; }
+  void setClock(SpiDevice device, uint32_t hz) { clockHz[device] = hz; }
+
+  bool acquire(SpiDevice device, uint32_t timeoutMs = portMAX_DELAY);
+  void release(SpiDevice device);
+
+  // Para clientes largos (volcados de pantalla): cede el bus entre trozos
+  // si otro dispositivo está esperando y no lo vuelve a pedir hasta que el
+  // otro lo haya tomado
+  void yieldIfContended(SpiDevice device);
+
+  void updateStatistics();
+  const SpiDeviceStats& getStats(SpiDevice device) const { return stats[device]; }
+  void printStatistics() const;
+};
+
+extern SpiBusManager spiBusManager;
+
+// Bloqueo con ámbito: libera el bus al salir de la función
+class SpiBusLock {
+private:
+  SpiDevice device;
+  bool locked;
+
+public:
+  explicit SpiBusLock(SpiDevice dev) : device(dev) {
+    locked = spiBusManager.acquire(device);
+  }
+  ~SpiBusLock() {
+    if (locked) spiBusManager.release(device);
+  }
+  bool isLocked() const { return locked; }
+};
+
+#endif // SPI_BUS_MANAGER_H
@@ -21,7 +21,7 @@ const char str_exit[] = "Salir";
 
 const char str_loading[] = "Cargando...";
 const char str_error[] = "Error";
-const char str_success[] = "Exito";
+const char str_success[] = "Éxito";
 const char str_warning[] = "Advertencia";
 }
 
@@ -0,0 +1,197 @@
+#include "StudioOneProtocol.h"
+#include "MidiManager.h"
+
+uint16_t StudioOneProtocol::pack7(const uint8_t* in, uint16_t length, uint8_t* out) {
+  uint16_t written = 0;
+
+  for (uint16_t group = 0; group < length; group += 7) {
+    uint8_t count = min((uint16_t)7, (uint16_t)(length - group));
+    uint8_t& msbs = out[written++];
+    msbs = 0;
+
+    for (uint8_t i = 0; i < count; i++) {
+      uint8_t byte = in[group + i];
+      if (byte & 0x80) msbs |= (1 << i);
+      out[written++] = byte & 0x7F;
+    }
+  }
+  return written;
+}
+
+uint16_t StudioOneProtocol::unpack7(const uint8_t* in, uint16_t length, uint8_t* out, uint16_t maxOut) {
+  uint16_t written = 0;
+  uint16_t pos = 0;
+
+  while (pos < length) {
+    uint8_t msbs = in[pos++];
+    for (uint8_t i = 0; i < 7 && pos < length; i++) {
+      if (written >= maxOut) return written;
+      out[written++] = in[pos++] | ((msbs & (1 << i)) ? 0x80 : 0);
+    }
+  }
+  return written;
+}
+
+bool StudioOneProtocol::isStudioOneMessage(const uint8_t* data, uint16_t length) {
+  return length >= S1_SYSEX_HEADER_SIZE + 1 &&
+         data[0] == 0xF0 && data[1] == 0x00 && data[2] == 0x21 && data[3] == 0x7B;
+}
+
+uint16_t StudioOneProtocol::buildBankStateRequest(uint8_t bank, uint8_t sections, uint8_t* out) {
+  const uint8_t request[] = {
+    0xF0, 0x00, 0x21, 0x7B, SYSEX_BANK_STATE,
+    (uint8_t)(sections & (BANK_STATE_ALL | BANK_STATE_SEQ)), bank, 0xF7
+  };
+  memcpy(out, request, sizeof(request));
+  return sizeof(request);
+}
+
+bool StudioOneProtocol::parseBankState(const uint8_t* data, uint16_t length, BankStateMessage& msg) {
+  if (!isStudioOneMessage(data, length) || data[4] != SYSEX_BANK_STATE ||
+      length < S1_SYSEX_HEADER_SIZE + 2 + BANK_STATE_MASK_BYTES + 1 ||
+      data[length - 1] != 0xF7) {
+    return false;
+  }
+
+  msg.sections = data[5] & (BANK_STATE_ALL | BANK_STATE_SEQ);
+  msg.bank = data[6];
+  msg.trackMask = data[7] | (data[8] << 7) | ((data[9] & 0x03) << 14);
+
+  uint8_t tracks = __builtin_popcount(msg.trackMask);
+  const uint8_t* p = &data[10];
+  const uint8_t* end = &data[length - 1];
+
+  // Longitud exacta según secciones y pistas: nada que adivinar al aplicar
+  uint16_t expected = 0;
+  if (msg.sections & BANK_STATE_VALUES) expected += tracks;
+  if (msg.sections & BANK_STATE_COLORS) expected += PACKED7_SIZE(tracks * 2);
+  if (msg.sections & BANK_STATE_NAMES) expected += tracks * BANK_STATE_NAME_CHARS;
+  if (msg.sections & BANK_STATE_FLAGS) expected += PACKED7_SIZE(BANK_STATE_FLAG_BYTES);
+  if (msg.sections & BANK_STATE_SEQ) expected += 2;
+  if (end - p != expected) return false;
+
+  if (msg.sections & BANK_STATE_VALUES) {
+    for (uint8_t track = 0; track < NUM_ENCODERS; track++) {
+      if (msg.trackMask & (1 << track)) msg.values[track] = *p++;
+    }
+  }
+
+  if (msg.sections & BANK_STATE_COLORS) {
+    uint8_t raw[NUM_ENCODERS * 2];
+    uint16_t packed = PACKED7_SIZE(tracks * 2);
+    unpack7(p, packed, raw, sizeof(raw));
+    p += packed;
+
+    uint8_t i = 0;
+    for (uint8_t track = 0; track < NUM_ENCODERS; track++) {
+      if (!(msg.trackMask & (1 << track))) continue;
+      msg.colors[track] = (raw[i] << 8) | raw[i + 1];
+      i += 2;
+    }
+  }
+
+  if (msg.sections & BANK_STATE_NAMES) {
+    for (uint8_t track = 0; track < NUM_ENCODERS; track++) {
+      if (!(msg.trackMask & (1 << track))) continue;
+      memcpy(msg.names[track], p, BANK_STATE_NAME_CHARS);
+      msg.names[track][BANK_STATE_NAME_CHARS] = '\0';
+      p += BANK_STATE_NAME_CHARS;
+    }
+  }
+
+  if (msg.sections & BANK_STATE_FLAGS) {
+    uint8_t raw[BANK_STATE_FLAG_BYTES];
+    unpack7(p, PACKED7_SIZE(BANK_STATE_FLAG_BYTES), raw, sizeof(raw));
+    msg.muteMask = raw[0] | (raw[1] << 8);
+    msg.soloMask = raw[2] | (raw[3] << 8);
+    p += PACKED7_SIZE(BANK_STATE_FLAG_BYTES);
+  }
+
+  msg.seq = 0;
+  if (msg.sections & BANK_STATE_SEQ) {
+    msg.seq = (p[0] << 7) | p[1];
+  }
+
+  return true;
+}
+
+bool StudioOneProtocol::parseValueDelta(const uint8_t* data, uint16_t length, ValueDeltaMessage& msg) {
+  if (!isStudioOneMessage(data, length) || data[4] != SYSEX_VALUE_DELTA ||
+      length < 9 || data[length - 1] != 0xF7 || (length - 9) % 2 != 0) {
+    return false;
+  }
+
+  msg.bank = data[5];
+  msg.seq = (data[6] << 7) | data[7];
+  msg.count = (length - 9) / 2;
+  if (msg.count > DELTA_MAX_ENTRIES) return false;
+
+  const uint8_t* p = &data[8];
+  for (uint8_t i = 0; i < msg.count; i++) {
+    msg.deltas[i].track = p[0] & DELTA_TRACK_MASK;
+    msg.deltas[i].flags = p[0] & (DELTA_ABSOLUTE | DELTA_NEGATIVE);
+    msg.deltas[i].amount = p[1];
+    p += 2;
+  }
+  return true;
+}
+
+uint16_t StudioOneProtocol::buildResendRequest(uint8_t bank, uint16_t fromSeq, uint16_t toSeq, uint8_t* out) {
+  const uint8_t request[] = {
+    0xF0, 0x00, 0x21, 0x7B, SYSEX_FEEDBACK_RESEND, bank,
+    (uint8_t)((fromSeq >> 7) & 0x7F), (uint8_t)(fromSeq & 0x7F),
+    (uint8_t)((toSeq >> 7) & 0x7F), (uint8_t)(toSeq & 0x7F), 0xF7
+  };
+  memcpy(out, request, sizeof(request));
+  return sizeof(request);
+}
+
+void StudioOneProtocol::write21(uint32_t value, uint8_t* out) {
+  if (value > LATENCY_MAX_MICROS) value = LATENCY_MAX_MICROS;
+  out[0] = (value >> 14) & 0x7F;
+  out[1] = (value >> 7) & 0x7F;
+  out[2] = value & 0x7F;
+}
+
+uint16_t StudioOneProtocol::buildLatencyReport(const LatencyHistogram& histogram, uint8_t* out) {
+  uint32_t fields[5];
+  histogramFields(histogram, fields);
+
+  out[0] = 0xF0; out[1] = 0x00; out[2] = 0x21; out[3] = 0x7B; out[4] = SYSEX_LATENCY_QUERY;
+  uint16_t length = S1_SYSEX_HEADER_SIZE;
+  for (uint8_t i = 0; i < 5; i++) {
+    write21(fields[i], &out[length]);
+    length += 3;
+  }
+  out[length++] = 0xF7;
+  return length;
+}
+
+uint16_t StudioOneProtocol::buildDiagnosticsReport(uint8_t section, uint8_t index, const uint32_t* fields,
+                                                   uint8_t count, uint8_t* out) {
+  if (count > DIAG_MAX_FIELDS) count = DIAG_MAX_FIELDS;
+
+  uint8_t raw[DIAG_MAX_FIELDS * 4];
+  for (uint8_t i = 0; i < count; i++) {
+    raw[i * 4] = fields[i] & 0xFF;
+    raw[i * 4 + 1] = (fields[i] >> 8) & 0xFF;
+    raw[i * 4 + 2] = (fields[i] >> 16) & 0xFF;
+    raw[i * 4 + 3] = (fields[i] >> 24) & 0xFF;
+  }
+
+  out[0] = 0xF0; out[1] = 0x00; out[2] = 0x21; out[3] = 0x7B; out[4] = SYSEX_DIAGNOSTICS;
+  out[5] = section & 0x7F;
+  out[6] = index & 0x7F;
+  uint16_t length = DIAG_HEADER_SIZE + pack7(raw, count * 4, &out[DIAG_HEADER_SIZE]);
+  out[length++] = 0xF7;
+  return length;
+}
+
+uint8_t StudioOneProtocol::histogramFields(const LatencyHistogram& histogram, uint32_t* fields) {
+  fields[0] = histogram.getCount();
+  fields[1] = histogram.percentile(50);
+  fields[2] = histogram.percentile(95);
+  fields[3] = histogram.percentile(99);
+  fields[4] = histogram.getMax();
+  return 5;
+}
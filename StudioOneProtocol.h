@@ -0,0 +1,129 @@
+#ifndef STUDIO_ONE_PROTOCOL_H
+#define STUDIO_ONE_PROTOCOL_H
+
+#include "Config.h"
+#include "LatencyHistogram.h"
+#include <Arduino.h>
+
+// Cabecera común de los SysEx del script de Studio One: F0 00 21 7B <tipo>
+#define S1_SYSEX_HEADER_SIZE     5
+
+// Estado de banco en bloque (tipo SYSEX_BANK_STATE):
+//   petición:  F0 00 21 7B 07 <secciones> <banco> F7
+//   respuesta: F0 00 21 7B 07 <secciones> <banco> <máscara pistas x3>
+//              [valores] [colores empaquetados] [nombres] [flags empaquetados] F7
+// Solo se incluyen las pistas marcadas en la máscara, en orden de pista.
+#define BANK_STATE_VALUES        0x01   // 1 byte por pista (0-127)
+#define BANK_STATE_COLORS        0x02   // RGB565, 2 bytes por pista, empaquetado 7 bits
+#define BANK_STATE_NAMES         0x04   // 5 caracteres ASCII por pista, rellenos con 0
+#define BANK_STATE_FLAGS         0x08   // Máscaras mute/solo del banco, empaquetadas
+#define BANK_STATE_ALL           0x0F
+#define BANK_STATE_SEQ           0x10   // Secuencia del banco (2 bytes, al final): fotograma clave
+
+#define BANK_STATE_NAME_CHARS    (TRACK_NAME_LENGTH - 1)
+#define BANK_STATE_MASK_BYTES    3
+#define BANK_STATE_FLAG_BYTES    4
+
+// Tamaño en bytes tras empaquetar n bytes de 8 bits en grupos de 7
+#define PACKED7_SIZE(n)          ((n) + ((n) + 6) / 7)
+
+#define BANK_STATE_MAX_SIZE      (S1_SYSEX_HEADER_SIZE + 2 + BANK_STATE_MASK_BYTES + \
+                                  NUM_ENCODERS + PACKED7_SIZE(NUM_ENCODERS * 2) + \
+                                  NUM_ENCODERS * BANK_STATE_NAME_CHARS + \
+                                  PACKED7_SIZE(BANK_STATE_FLAG_BYTES) + 2 + 1)
+
+// Realimentación secuenciada (tipo SYSEX_VALUE_DELTA), número de secuencia
+// de 14 bits por banco; un mensaje sin entradas sirve de latido:
+//   F0 00 21 7B 08 <banco> <seq MSB> <seq LSB> {<pista|flags> <cantidad>}* F7
+// Reenvío de un rango perdido (controlador -> DAW):
+//   F0 00 21 7B 09 <banco> <desde MSB> <desde LSB> <hasta MSB> <hasta LSB> F7
+#define FEEDBACK_SEQ_MASK        0x3FFF
+#define FEEDBACK_SEQ_HALF        0x2000
+#define DELTA_TRACK_MASK         0x0F
+#define DELTA_ABSOLUTE           0x10   // cantidad = valor absoluto
+#define DELTA_NEGATIVE           0x20   // cantidad se resta
+#define DELTA_MAX_ENTRIES        NUM_ENCODERS
+
+// Latencia encoder -> USB (tipo SYSEX_LATENCY_QUERY), en microsegundos de
+// 21 bits (3 bytes de 7, MSB primero, saturados):
+//   petición:  F0 00 21 7B 0A <flags> 00 F7
+//   respuesta: F0 00 21 7B 0A <muestras> <p50> <p95> <p99> <máx> F7
+#define LATENCY_QUERY_RESET      0x01   // Poner el histograma a cero tras responder
+#define LATENCY_REPORT_SIZE      (S1_SYSEX_HEADER_SIZE + 5 * 3 + 1)
+
+// Diagnóstico remoto (tipo SYSEX_DIAGNOSTICS), para cuando el puerto serie
+// no está a mano; una sección por petición:
+//   petición:  F0 00 21 7B 0B <sección> <índice> F7
+//   respuesta: F0 00 21 7B 0B <sección> <índice> <campos> F7
+// Los campos son uint32 little-endian empaquetados en 7 bits (pack7); su
+// número se deduce de la longitud. Una sección desconocida responde sin campos.
+#define DIAG_SECTION_MIDI        0x01   // Contadores generales de MidiManager
+#define DIAG_SECTION_PORT        0x02   // Puerto de salida <índice>
+#define DIAG_SECTION_HISTOGRAM   0x03   // <índice>: DIAG_HISTOGRAM_*; n, p50, p95, p99, máx
+#define DIAG_SECTION_HEAP        0x04   // Memoria y tiempo encendido
+#define DIAG_SECTION_ENCODERS    0x05   // Contadores de EncoderManager
+#define DIAG_SECTION_DISPLAY     0x06   // <índice>: DIAG_DISPLAY_*
+#define DIAG_SECTION_RESET       0x7F   // Pone las estadísticas a cero; responde sin campos
+
+#define DIAG_HISTOGRAM_LOOP      0      // Duración de cada pasada del loop
+#define DIAG_HISTOGRAM_LATENCY   1      // Encoder -> USB
+
+#define DIAG_DISPLAY_FRAMES      0      // Planificador de pantalla por regiones
+#define DIAG_DISPLAY_POWER       1      // Reposo del panel y latencia de despertar
+
+#define DIAG_HEADER_SIZE         (S1_SYSEX_HEADER_SIZE + 2)
+#define DIAG_MAX_FIELDS          12
+#define DIAG_REPORT_MAX_SIZE     (DIAG_HEADER_SIZE + PACKED7_SIZE(DIAG_MAX_FIELDS * 4) + 1)
+
+struct BankStateMessage {
+  uint8_t bank;
+  uint8_t sections;
+  uint16_t trackMask;
+  uint8_t values[NUM_ENCODERS];
+  uint16_t colors[NUM_ENCODERS];
+  char names[NUM_ENCODERS][TRACK_NAME_LENGTH];
+  uint16_t muteMask;
+  uint16_t soloMask;
+  uint16_t seq;
+};
+
+struct ValueDelta {
+  uint8_t track;
+  uint8_t flags;     // DELTA_ABSOLUTE / DELTA_NEGATIVE
+  uint8_t amount;
+};
+
+struct ValueDeltaMessage {
+  uint8_t bank;
+  uint16_t seq;
+  uint8_t count;
+  ValueDelta deltas[DELTA_MAX_ENTRIES];
+};
+
+class StudioOneProtocol {
+public:
+  // Empaquetado 8->7 bits: por cada grupo de hasta 7 bytes, un byte con los
+  // bits altos (bit i = byte i del grupo) seguido de los 7 bits bajos
+  static uint16_t pack7(const uint8_t* in, uint16_t length, uint8_t* out);
+  static uint16_t unpack7(const uint8_t* in, uint16_t length, uint8_t* out, uint16_t maxOut);
+
+  static bool isStudioOneMessage(const uint8_t* data, uint16_t length);
+  static bool parseBankState(const uint8_t* data, uint16_t length, BankStateMessage& msg);
+  static uint16_t buildBankStateRequest(uint8_t bank, uint8_t sections, uint8_t* out);
+
+  static bool parseValueDelta(const uint8_t* data, uint16_t length, ValueDeltaMessage& msg);
+  static uint16_t buildResendRequest(uint8_t bank, uint16_t fromSeq, uint16_t toSeq, uint8_t* out);
+  
+  static uint16_t buildLatencyReport(const LatencyHistogram& histogram, uint8_t* out);
+  static void write21(uint32_t value, uint8_t* out);
+  
+  static uint16_t buildDiagnosticsReport(uint8_t section, uint8_t index, const uint32_t* fields,
+                                         uint8_t count, uint8_t* out);
+  // n, p50, p95, p99, máx: el formato de DIAG_SECTION_HISTOGRAM
+  static uint8_t histogramFields(const LatencyHistogram& histogram, uint32_t* fields);
+
+  // Distancia de b respecto a a en el espacio circular de 14 bits
+  static uint16_t seqDistance(uint16_t a, uint16_t b) { return (b - a) & FEEDBACK_SEQ_MASK; }
+};
+
+#endif // STUDIO_ONE_PROTOCOL_H
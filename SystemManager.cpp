@@ -42,8 +42,12 @@ bool SystemManager::shouldRunTask(TaskPriority priority, unsigned long lastRun,
   return true;
 }
 
-void SystemManager::updateDiagnostics() {
+void SystemManager::recordLoopTime(uint32_t micros) {
   loopCount++;
+  loopTime.record(micros);
+}
+
+void SystemManager::updateDiagnostics() {
   freeMemory = ESP.getFreeHeap();
   
   unsigned long currentTime = millis();
@@ -52,6 +56,9 @@ void SystemManager::updateDiagnostics() {
     Serial.print(freeMemory);
     Serial.print(F(" | Loops/s: "));
     Serial.print(loopCount);
+    Serial.print(F(" | Loop p99: "));
+    Serial.print(loopTime.percentile(99));
+    Serial.print(F(" us"));
     Serial.print(F(" | MIDI Out: "));
     Serial.print(midiMessagesSent);
     Serial.print(F(" | MIDI In: "));
@@ -2,6 +2,7 @@
 #define SYSTEM_MANAGER_H
 
 #include "Config.h"
+#include "LatencyHistogram.h"
 
 class SystemManager {
 private:
@@ -11,6 +12,7 @@ private:
     uint32_t midiMessagesSent;
     uint32_t midiMessagesReceived;
     uint16_t freeMemory;
+    LatencyHistogram loopTime;
 
 public:
   SystemManager();
@@ -23,6 +25,11 @@ public:
   bool shouldRunTask(TaskPriority priority, unsigned long lastRun, unsigned long interval);
   void updateDiagnostics();
   
+  // Duración de la pasada del loop sin la espera final
+  void recordLoopTime(uint32_t micros);
+  const LatencyHistogram& getLoopTime() const { return loopTime; }
+  void resetStatistics() { loopTime.reset(); }
+  
   uint16_t getFreeMemory();
   void checkSystemHealth();
   
@@ -0,0 +1,279 @@
+// DisplayManager real sobre un panel simulado: Adafruit_GFX y Adafruit_SPITFT
+// pintan en un framebuffer del PC y cuentan los bytes que irían por el SPI
+// (ventana CASET/RASET/RAMWR de 11 bytes y 2 por píxel, como la biblioteca).
+// Cada volcado avanza hostMicros lo que tardaría al reloj de la pantalla, así
+// que el planificador de regiones ve el mismo tiempo que en el ESP32-S3.
+// Las primitivas que la biblioteca dibuja píxel a píxel (líneas oblicuas,
+// círculos, la fuente clásica) se cuentan igual, píxel a píxel.
+#ifndef DISPLAY_HOST_H
+#define DISPLAY_HOST_H
+
+#include "DisplayManager.h"
+#include "SpiBusManager.h"
+#include <map>
+#include <vector>
+
+#define HOST_WINDOW_BYTES  11   // CASET + 4, RASET + 4, RAMWR
+
+// Un volcado al panel: su rectángulo y cuándo terminó
+struct HostPaint {
+  int16_t x, y, w, h;
+  uint32_t micros;
+};
+
+struct HostPanel {
+  uint16_t width = TFT_HEIGHT;   // Nativo en vertical: 320 x 480
+  uint16_t height = TFT_WIDTH;
+  std::vector<uint16_t> pixels = std::vector<uint16_t>(TFT_WIDTH * TFT_HEIGHT, 0);
+  uint32_t clockHz = 0;
+  uint64_t spiBytes = 0;
+  uint32_t windows = 0;
+  uint64_t pendingBits = 0;     // Resto que aún no llega a 1 us
+  bool recordPaints = false;
+  std::vector<HostPaint> paints;
+
+  // Ventana abierta por setAddrWindow
+  int16_t winX = 0, winY = 0, winW = 0, winH = 0;
+  uint32_t winPos = 0;
+
+  // Estado de texto de la fuente clásica
+  int16_t cursorX = 0, cursorY = 0;
+  uint16_t textColor = 0xFFFF, textBg = 0xFFFF;
+  uint8_t textSize = 1;
+};
+
+inline HostPanel hostPanel;
+
+// Tiempo de bus: los bytes salen al reloj de la pantalla
+inline void hostSpiSend(uint32_t bytes) {
+  hostPanel.spiBytes += bytes;
+  uint32_t clock = hostPanel.clockHz ? hostPanel.clockHz : 40000000;
+  hostPanel.pendingBits += (uint64_t)bytes * 8 * 1000000;
+  hostMicros += hostPanel.pendingBits / clock;
+  hostPanel.pendingBits %= clock;
+}
+
+inline void hostPixel(int16_t x, int16_t y, uint16_t color) {
+  if (x < 0 || y < 0 || x >= hostPanel.width || y >= hostPanel.height) return;
+  hostPanel.pixels[y * hostPanel.width + x] = color;
+}
+
+inline void hostRecord(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (hostPanel.recordPaints) hostPanel.paints.push_back({x, y, w, h, hostMicros});
+}
+
+// Rectángulo recortado a la pantalla: una ventana y sus píxeles
+inline void hostFill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (w < 0) { x += w + 1; w = -w; }
+  if (h < 0) { y += h + 1; h = -h; }
+  int16_t x1 = min<int16_t>(x + w, hostPanel.width), y1 = min<int16_t>(y + h, hostPanel.height);
+  x = max<int16_t>(x, 0);
+  y = max<int16_t>(y, 0);
+  if (x >= x1 || y >= y1) return;
+  for (int16_t row = y; row < y1; row++) {
+    for (int16_t col = x; col < x1; col++) hostPanel.pixels[row * hostPanel.width + col] = color;
+  }
+  hostPanel.windows++;
+  hostSpiSend(HOST_WINDOW_BYTES + 2 * (uint32_t)(x1 - x) * (y1 - y));
+  hostRecord(x, y, x1 - x, y1 - y);
+}
+
+// Celda de 6x8 de la fuente clásica. Sin la fuente de Adafruit, cada glifo
+// es un patrón fijo por carácter: lo que cuenta aquí son los píxeles enviados
+inline bool hostGlyphBit(unsigned char c, uint8_t x, uint8_t y) {
+  return x < 5 && y < 7 && ((c * 2654435761u) >> (x * 7 + y)) & 1;
+}
+
+inline void hostDrawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+  for (uint8_t cx = 0; cx < 6; cx++) {
+    for (uint8_t cy = 0; cy < 8; cy++) {
+      bool set = hostGlyphBit(c, cx, cy);
+      if (!set && bg == color) continue;   // Fondo transparente
+      hostFill(x + cx * size, y + cy * size, size, size, set ? color : bg);
+    }
+  }
+}
+
+// ---- Canvas de 1 bit (GlyphAtlas): guarda el último carácter dibujado
+struct HostCanvas {
+  uint16_t w, h;
+  int c;
+};
+
+inline std::map<const Adafruit_GFX*, HostCanvas> hostCanvases;
+
+GFXcanvas1::GFXcanvas1(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) { hostCanvases[this] = {w, h, -1}; }
+uint8_t* GFXcanvas1::getBuffer() const {
+  static uint8_t buffer[1];
+  return buffer;
+}
+bool GFXcanvas1::getPixel(int16_t x, int16_t y) const {
+  int c = hostCanvases[this].c;
+  return c >= 0 && hostGlyphBit(c, x, y);
+}
+
+// ---- Adafruit_GFX: el panel o, si es un canvas, solo su carácter
+Adafruit_GFX::Adafruit_GFX(int16_t, int16_t) {}
+size_t Adafruit_GFX::write(uint8_t c) {
+  if (c == '\n') {
+    hostPanel.cursorX = 0;
+    hostPanel.cursorY += 8 * hostPanel.textSize;
+  } else if (c != '\r') {
+    hostDrawChar(hostPanel.cursorX, hostPanel.cursorY, c, hostPanel.textColor, hostPanel.textBg,
+                 hostPanel.textSize);
+    hostPanel.cursorX += 6 * hostPanel.textSize;
+  }
+  return 1;
+}
+void Adafruit_GFX::drawPixel(int16_t x, int16_t y, uint16_t color) { hostFill(x, y, 1, 1, color); }
+void Adafruit_GFX::fillScreen(uint16_t color) {
+  auto canvas = hostCanvases.find(this);
+  if (canvas != hostCanvases.end()) {
+    canvas->second.c = -1;
+    return;
+  }
+  hostFill(0, 0, hostPanel.width, hostPanel.height, color);
+}
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  hostFill(x, y, w, 1, color);
+  hostFill(x, y + h - 1, w, 1, color);
+  hostFill(x, y + 1, 1, h - 2, color);
+  hostFill(x + w - 1, y + 1, 1, h - 2, color);
+}
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  hostFill(x, y, w, h, color);
+}
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { hostFill(x, y, w, 1, color); }
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { hostFill(x, y, 1, h, color); }
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  if (y0 == y1) { hostFill(min(x0, x1), y0, abs(x1 - x0) + 1, 1, color); return; }
+  if (x0 == x1) { hostFill(x0, min(y0, y1), 1, abs(y1 - y0) + 1, color); return; }
+  int16_t dx = abs(x1 - x0), dy = -abs(y1 - y0), sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1;
+  int16_t err = dx + dy;
+  for (;;) {
+    hostFill(x0, y0, 1, 1, color);
+    if (x0 == x1 && y0 == y1) break;
+    int16_t e2 = 2 * err;
+    if (e2 >= dy) { err += dy; x0 += sx; }
+    if (e2 <= dx) { err += dx; y0 += sy; }
+  }
+}
+void Adafruit_GFX::drawCircle(int16_t x, int16_t y, int16_t r, uint16_t color) {
+  for (int16_t dx = -r; dx <= r; dx++) {
+    int16_t dy = (int16_t)sqrt((double)(r * r - dx * dx));
+    hostFill(x + dx, y - dy, 1, 1, color);
+    hostFill(x + dx, y + dy, 1, 1, color);
+  }
+}
+void Adafruit_GFX::fillCircle(int16_t x, int16_t y, int16_t r, uint16_t color) {
+  for (int16_t dx = -r; dx <= r; dx++) {
+    int16_t dy = (int16_t)sqrt((double)(r * r - dx * dx));
+    hostFill(x + dx, y - dy, 1, 2 * dy + 1, color);
+  }
+}
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+  auto canvas = hostCanvases.find(this);
+  if (canvas != hostCanvases.end()) {
+    canvas->second.c = c;
+    return;
+  }
+  hostDrawChar(x, y, c, color, bg, size);
+}
+void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h) {
+  for (int16_t row = 0; row < h; row++) {
+    for (int16_t col = 0; col < w; col++) hostFill(x + col, y + row, 1, 1, bitmap[row * w + col]);
+  }
+}
+void Adafruit_GFX::setTextSize(uint8_t size) { hostPanel.textSize = size ? size : 1; }
+void Adafruit_GFX::setTextColor(uint16_t color) { hostPanel.textColor = hostPanel.textBg = color; }
+void Adafruit_GFX::setTextColor(uint16_t color, uint16_t bg) {
+  hostPanel.textColor = color;
+  hostPanel.textBg = bg;
+}
+void Adafruit_GFX::setCursor(int16_t x, int16_t y) {
+  hostPanel.cursorX = x;
+  hostPanel.cursorY = y;
+}
+void Adafruit_GFX::setTextWrap(bool) {}
+void Adafruit_GFX::setRotation(uint8_t rotation) {
+  bool portrait = (rotation & 1) == 0;
+  hostPanel.width = portrait ? TFT_HEIGHT : TFT_WIDTH;
+  hostPanel.height = portrait ? TFT_WIDTH : TFT_HEIGHT;
+}
+int16_t Adafruit_GFX::width() const { return hostPanel.width; }
+int16_t Adafruit_GFX::height() const { return hostPanel.height; }
+
+// ---- Adafruit_SPITFT: ventana y píxeles en orden de filas
+Adafruit_SPITFT::Adafruit_SPITFT() : Adafruit_GFX(TFT_HEIGHT, TFT_WIDTH) {}
+void Adafruit_SPITFT::startWrite() {}
+void Adafruit_SPITFT::endWrite() {
+  if (hostPanel.winW && hostPanel.winPos) hostRecord(hostPanel.winX, hostPanel.winY, hostPanel.winW, hostPanel.winH);
+  hostPanel.winW = 0;
+}
+void Adafruit_SPITFT::setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  hostPanel.winX = x;
+  hostPanel.winY = y;
+  hostPanel.winW = w;
+  hostPanel.winH = h;
+  hostPanel.winPos = 0;
+  hostPanel.windows++;
+  hostSpiSend(HOST_WINDOW_BYTES);
+}
+void Adafruit_SPITFT::writePixels(uint16_t* colors, uint32_t length, bool, bool) {
+  for (uint32_t i = 0; i < length && hostPanel.winW; i++, hostPanel.winPos++) {
+    hostPixel(hostPanel.winX + hostPanel.winPos % hostPanel.winW, hostPanel.winY + hostPanel.winPos / hostPanel.winW,
+              colors[i]);
+  }
+  hostSpiSend(2 * length);
+}
+void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t length) {
+  for (uint32_t i = 0; i < length && hostPanel.winW; i++, hostPanel.winPos++) {
+    hostPixel(hostPanel.winX + hostPanel.winPos % hostPanel.winW, hostPanel.winY + hostPanel.winPos / hostPanel.winW,
+              color);
+  }
+  hostSpiSend(2 * length);
+}
+void Adafruit_SPITFT::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  hostFill(x, y, w, h, color);
+}
+void Adafruit_SPITFT::writeCommand(uint8_t) { hostSpiSend(1); }
+void Adafruit_SPITFT::sendCommand(uint8_t, const uint8_t*, uint8_t length) { hostSpiSend(1 + length); }
+void Adafruit_SPITFT::spiWrite(uint8_t) { hostSpiSend(1); }
+void Adafruit_SPITFT::setSPISpeed(uint32_t freq) { hostPanel.clockHz = freq; }
+void Adafruit_SPITFT::dmaWait() {}
+void Adafruit_SPITFT::enableDisplay(bool) {}
+void Adafruit_SPITFT::enableSleep(bool) {}
+Adafruit_ST7796S::Adafruit_ST7796S(int8_t, int8_t, int8_t) {}
+void Adafruit_ST7796S::init(uint16_t, uint16_t, uint8_t) {}
+void Adafruit_ST7796S::begin(uint32_t) {}
+
+// ---- FreeRTOS: un solo hilo, el bus siempre está libre
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() { return (SemaphoreHandle_t)&hostPanel; }
+SemaphoreHandle_t xSemaphoreCreateBinary() { return (SemaphoreHandle_t)&hostPanel; }
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t) { return pdTRUE; }
+BaseType_t xSemaphoreTake(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+BaseType_t xSemaphoreGive(SemaphoreHandle_t) { return pdTRUE; }
+
+SpiBusManager spiBusManager;
+DisplayManager displayManager;
+
+// Panel listo en la orientación y vista pedidas, con la pantalla principal
+// dibujada entera una vez. Las esperas activas de initialize() avanzan solas
+inline void hostSetupDisplay(DisplayOrientation orientation, MixerView view) {
+  static bool ready = false;
+  Serial.quiet = true;
+  if (!ready) {
+    spiBusManager.initialize();
+    hostClockStep = 100;
+    displayManager.initialize(orientation);
+    hostClockStep = 0;
+    ready = true;
+  }
+  displayManager.setOrientation(orientation);
+  displayManager.setMixerView(view);
+  displayManager.setMidiBusy(false);
+  displayManager.forceFullRedraw();
+}
+
+#endif // DISPLAY_HOST_H
@@ -0,0 +1,99 @@
+// Dobles de MidiManager y DisplayManager para probar EncoderManager y
+// FeedbackManager en el PC. Lo que el controlador envía al DAW queda en
+// hostSentCCs y hostRequests; la pantalla solo cuenta canales marcados.
+#ifndef ENCODER_HOST_H
+#define ENCODER_HOST_H
+
+#include "EncoderManager.h"
+#include "FeedbackManager.h"
+#include "MidiManager.h"
+#include "DisplayManager.h"
+#include <vector>
+
+struct HostCC {
+  uint8_t channel;
+  uint8_t control;
+  uint8_t value;
+};
+
+struct HostRequest {
+  bool keyframe;   // Estado de banco con secuencia; si no, reenvío de rango
+  uint8_t bank;
+  uint16_t fromSeq;
+  uint16_t toSeq;
+};
+
+inline std::vector<HostCC> hostSentCCs;
+inline std::vector<HostRequest> hostRequests;
+inline uint32_t hostDirtyMarks = 0;
+
+MidiManager midiManager;
+DisplayManager displayManager;
+EncoderManager encoderManager;
+FeedbackManager feedbackManager;
+AppConfig appConfig;
+
+// Miembros de MidiManager y DisplayManager que estas pruebas no usan
+LatencyHistogram::LatencyHistogram() {}
+MidiStreamParser::MidiStreamParser(uint8_t*, uint16_t) {}
+MidiStreamWriter::MidiStreamWriter() {}
+MidiTimecode::MidiTimecode() {}
+MidiClock::MidiClock() {}
+MidiFilter::MidiFilter() {}
+MixerScene::MixerScene() {}
+GlyphAtlas::GlyphAtlas() {}
+SmoothText::SmoothText() {}
+
+// ---- MidiManager: solo lo que usan los encoders y la realimentación
+MidiManager::MidiManager() : dinParser(dinSysExBuffer, sizeof(dinSysExBuffer)) { sysExSlotMask = 0; }
+MidiManager::~MidiManager() {}
+void MidiManager::sendControlChange(uint8_t channel, uint8_t cc, uint8_t value, uint8_t, bool) {
+  hostSentCCs.push_back({channel, cc, value});
+}
+uint8_t MidiManager::sendControlChange14(uint8_t channel, uint8_t cc, uint16_t value, bool, uint8_t) {
+  hostSentCCs.push_back({channel, cc, (uint8_t)(value >> 7)});
+  return 2;
+}
+uint8_t MidiManager::sendNrpn(uint8_t, uint16_t, uint16_t, bool, uint8_t) { return 4; }
+void MidiManager::sendNoteOn(uint8_t, uint8_t, uint8_t, uint8_t) {}
+void MidiManager::sendNoteOff(uint8_t, uint8_t, uint8_t, uint8_t) {}
+void MidiManager::sendPitchBend(uint8_t, int16_t, uint8_t) {}
+uint8_t MidiManager::getOutputCredit(uint8_t) const { return MIDI_BUFFER_SIZE; }
+void MidiManager::sendStudioOneBankStateRequest(uint8_t bank, uint8_t) {
+  hostRequests.push_back({true, bank, 0, 0});
+}
+void MidiManager::sendStudioOneResendRequest(uint8_t bank, uint16_t fromSeq, uint16_t toSeq) {
+  hostRequests.push_back({false, bank, fromSeq, toSeq});
+}
+
+// ---- DisplayManager: sin panel
+Adafruit_GFX::Adafruit_GFX(int16_t, int16_t) {}
+size_t Adafruit_GFX::write(uint8_t) { return 1; }
+Adafruit_SPITFT::Adafruit_SPITFT() : Adafruit_GFX(0, 0) {}
+Adafruit_ST7796S::Adafruit_ST7796S(int8_t, int8_t, int8_t) {}
+DisplayManager::DisplayManager() : tft(TFT_CS, TFT_DC, TFT_RST) {}
+DisplayManager::~DisplayManager() {}
+void DisplayManager::markChannelDirty(uint8_t) { hostDirtyMarks++; }
+void DisplayManager::invalidateWidgets(uint8_t, uint8_t) {}
+void DisplayManager::setFocusChannel(uint8_t) {}
+void DisplayManager::setVULevel(uint8_t, uint8_t) {}
+
+// Un banco por prueba; el encoder i manda el CC 20 + i del canal 1
+inline void hostSetupEncoders(uint8_t takeover) {
+  Serial.quiet = true;
+  appConfig.bankCount = 1;
+  appConfig.currentBank = 0;
+  encoderManager.initialize(&appConfig);
+  encoderManager.setCurrentBank(0);   // Sin toques ni envíos de la prueba anterior
+  encoderManager.resetAllBanks();
+  for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+    EncoderConfig& config = encoderManager.getEncoderConfigMutable(i, 0);
+    config.control = 20 + i;
+    config.takeover = takeover;
+  }
+  feedbackManager.initialize();
+  hostSentCCs.clear();
+  hostRequests.clear();
+}
+
+#endif // ENCODER_HOST_H
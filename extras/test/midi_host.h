@@ -0,0 +1,102 @@
+// MidiManager real con EncoderManager para medir el camino encoder -> USB en
+// el PC: TinyUSB anota lo escrito en hostUsbWrites (con el micros() de la
+// escritura) y la pantalla, el sistema y las llamadas del sketch no hacen
+// nada. A diferencia de encoder_host.h, las colas, el presupuesto de salida
+// y el histograma de latencia son los del firmware.
+#ifndef MIDI_HOST_H
+#define MIDI_HOST_H
+
+#include "EncoderManager.h"
+#include "MidiManager.h"
+#include "DisplayManager.h"
+#include "SystemManager.h"
+#include "FileManager.h"
+#include <vector>
+
+struct HostUsbWrite {
+  uint8_t cable;
+  uint8_t status;
+  uint8_t data1;
+  uint8_t data2;
+  uint32_t micros;
+};
+
+inline std::vector<HostUsbWrite> hostUsbWrites;
+
+MidiManager midiManager;
+DisplayManager displayManager;
+EncoderManager encoderManager;
+SystemManager systemManager;
+FileManager fileManager;
+AppConfig appConfig;
+
+// ---- TinyUSB: siempre montado, el endpoint acepta todo
+esp_err_t tinyusb_enable_interface(tinyusb_interface_t, uint16_t, tinyusb_descriptor_cb_t) { return ESP_OK; }
+uint8_t tinyusb_add_string_descriptor(const char*) { return 0; }
+uint8_t tinyusb_get_free_in_endpoint() { return 1; }
+uint8_t tinyusb_get_free_out_endpoint() { return 1; }
+bool tud_midi_mounted() { return true; }
+bool tud_midi_available() { return false; }
+bool tud_midi_packet_read(uint8_t*) { return false; }
+bool tud_midi_packet_write(const uint8_t*) { return true; }
+uint32_t tud_midi_stream_write(uint8_t cable, const uint8_t* data, uint32_t length) {
+  hostUsbWrites.push_back({cable, data[0], length > 1 ? data[1] : (uint8_t)0, length > 2 ? data[2] : (uint8_t)0,
+                           hostMicros});
+  return length;
+}
+
+// ---- Sin SD: el filtro MIDI no encuentra reglas
+FileManager::FileManager() : sdInitialized(false), sdCardPresent(false), totalSpace(0), freeSpace(0) {}
+FileManager::~FileManager() {}
+bool FileManager::fileExists(const char*) { return false; }
+bool FileManager::readFile(const char*, void*, size_t, size_t*) { return false; }
+
+// ---- Sistema y pantalla: sin efecto
+SystemManager::SystemManager() {}
+SystemManager::~SystemManager() {}
+Adafruit_GFX::Adafruit_GFX(int16_t, int16_t) {}
+size_t Adafruit_GFX::write(uint8_t) { return 1; }
+Adafruit_SPITFT::Adafruit_SPITFT() : Adafruit_GFX(0, 0) {}
+Adafruit_ST7796S::Adafruit_ST7796S(int8_t, int8_t, int8_t) {}
+MixerScene::MixerScene() {}
+GlyphAtlas::GlyphAtlas() {}
+SmoothText::SmoothText() {}
+DisplayManager::DisplayManager() : tft(TFT_CS, TFT_DC, TFT_RST) {}
+DisplayManager::~DisplayManager() {}
+void DisplayManager::markChannelDirty(uint8_t) {}
+void DisplayManager::invalidateWidgets(uint8_t, uint8_t) {}
+void DisplayManager::setFocusChannel(uint8_t) {}
+void DisplayManager::setVULevel(uint8_t, uint8_t) {}
+uint8_t DisplayManager::getFrameDiagnostics(uint32_t*) const { return 0; }
+uint8_t DisplayManager::getPowerDiagnostics(uint32_t*) const { return 0; }
+void DisplayManager::resetFrameStatistics() {}
+
+// ---- Realimentación del DAW (el sketch): estas pruebas no la usan
+void syncEncoderColorFromDAW(uint8_t, uint8_t, uint16_t) {}
+void updateVUMeterLevel(uint8_t, uint8_t) {}
+void syncEncoderValueFromDAW(uint8_t, uint8_t, uint8_t) {}
+void syncEncoderNameFromDAW(uint8_t, uint8_t, const char*) {}
+void syncBankStateFromDAW(const BankStateMessage&) {}
+void syncValueDeltaFromDAW(const ValueDeltaMessage&) {}
+
+// Un banco; el encoder i manda el CC 20 + i del canal 1 por el cable principal
+inline void hostSetupMidi(uint8_t outputRate) {
+  Serial.quiet = true;
+  appConfig.bankCount = 1;
+  appConfig.currentBank = 0;
+  appConfig.midiOutputRate = outputRate;
+  midiManager.initialize();
+  encoderManager.initialize(&appConfig);
+  encoderManager.setCurrentBank(0);
+  encoderManager.resetAllBanks();
+  for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+    EncoderConfig& config = encoderManager.getEncoderConfigMutable(i, 0);
+    config.control = 20 + i;
+    config.cable = CABLE_MAIN;
+  }
+  midiManager.resetStatistics();
+  encoderManager.resetStatistics();
+  hostUsbWrites.clear();
+}
+
+#endif // MIDI_HOST_H
@@ -0,0 +1,53 @@
+#!/bin/sh
+# Pruebas en el PC de los módulos que no dependen del hardware. El IDE de
+# Arduino no compila extras/: cada prueba enlaza solo los .cpp que necesita,
+# con stubs/ en lugar del núcleo del ESP32 y sin el registro (LogManager).
+#
+#   sh extras/test/run_tests.sh            todas
+#   sh extras/test/run_tests.sh midi_clock una (test_<nombre>.cpp)
+
+set -e
+TEST_DIR=$(cd "$(dirname "$0")" && pwd)
+ROOT=$(cd "$TEST_DIR/../.." && pwd)
+OUT=${TMPDIR:-/tmp}/mackie_tests
+CXX=${CXX:-g++}
+mkdir -p "$OUT"
+
+# prueba: fuentes del sketch que enlaza
+sources() {
+  case "$1" in
+    midi_clock) echo "MidiClock.cpp" ;;
+    midi_timecode) echo "MidiTimecode.cpp" ;;
+    midi_stream) echo "MidiStream.cpp" ;;
+    mixer_layout) echo "MixerScene.cpp SmoothFont.cpp" ;;
+    spi_bus) echo "SpiBusManager.cpp" ;;
+    feedback_lossy) echo "EncoderManager.cpp FeedbackManager.cpp" ;;
+    encoder_timeline) echo "EncoderManager.cpp FeedbackManager.cpp" ;;
+    preset_cache) echo "PresetCacheManager.cpp EncoderManager.cpp FeedbackManager.cpp" ;;
+    midi_filter) echo "MidiFilter.cpp" ;;
+    latency) echo "LatencyHistogram.cpp EncoderManager.cpp MidiManager.cpp MidiStream.cpp MidiFilter.cpp MidiClock.cpp MidiTimecode.cpp StudioOneProtocol.cpp" ;;
+    scheduler) echo "LatencyHistogram.cpp EncoderManager.cpp MidiManager.cpp MidiStream.cpp MidiFilter.cpp MidiClock.cpp MidiTimecode.cpp StudioOneProtocol.cpp" ;;
+    encoder_layout) echo "EncoderManager.cpp FeedbackManager.cpp" ;;
+    hires_output) echo "LatencyHistogram.cpp EncoderManager.cpp MidiManager.cpp MidiStream.cpp MidiFilter.cpp MidiClock.cpp MidiTimecode.cpp StudioOneProtocol.cpp" ;;
+    display_scheduler) echo "DisplayManager.cpp SpiBusManager.cpp GlyphAtlas.cpp SmoothFont.cpp MixerScene.cpp" ;;
+    partial_repaint) echo "DisplayManager.cpp SpiBusManager.cpp GlyphAtlas.cpp SmoothFont.cpp MixerScene.cpp" ;;
+    smooth_font) echo "SmoothFont.cpp" ;;
+    bank_memory) echo "EncoderManager.cpp FeedbackManager.cpp" ;;
+    *) echo "Prueba desconocida: $1" >&2; exit 1 ;;
+  esac
+}
+
+TESTS=${*:-"midi_clock midi_timecode midi_stream mixer_layout spi_bus feedback_lossy encoder_timeline preset_cache midi_filter latency scheduler encoder_layout hires_output display_scheduler partial_repaint smooth_font bank_memory"}
+FAILED=0
+
+for name in $TESTS; do
+  files=""
+  for f in $(sources "$name"); do files="$files $ROOT/$f"; done
+  echo "== $name"
+  $CXX -std=gnu++17 -O1 -Wall -DLOG_COMPILE_LEVEL=LOG_LEVEL_NONE \
+    -I"$TEST_DIR/stubs" -I"$ROOT" \
+    "$TEST_DIR/test_$name.cpp" $files -o "$OUT/test_$name"
+  "$OUT/test_$name" || FAILED=$((FAILED + 1))
+done
+
+[ "$FAILED" -eq 0 ] || { echo "$FAILED pruebas con fallos"; exit 1; }
@@ -0,0 +1,46 @@
+// Adafruit_GFX: solo declaraciones, para compilar las cabeceras de pantalla
+#ifndef HOST_ADAFRUIT_GFX_H
+#define HOST_ADAFRUIT_GFX_H
+
+#include <Arduino.h>
+
+class Adafruit_GFX : public Print {
+public:
+  Adafruit_GFX(int16_t w, int16_t h);
+  size_t write(uint8_t c) override;
+  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  void fillScreen(uint16_t color);
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+  void drawCircle(int16_t x, int16_t y, int16_t r, uint16_t color);
+  void fillCircle(int16_t x, int16_t y, int16_t r, uint16_t color);
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size);
+  void drawRGBBitmap(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h);
+  void setTextSize(uint8_t size);
+  void setTextColor(uint16_t color);
+  void setTextColor(uint16_t color, uint16_t bg);
+  void setCursor(int16_t x, int16_t y);
+  void setTextWrap(bool wrap);
+  void setRotation(uint8_t rotation);
+  uint8_t getRotation() const;
+  int16_t width() const;
+  int16_t height() const;
+};
+
+class GFXcanvas1 : public Adafruit_GFX {
+public:
+  GFXcanvas1(uint16_t w, uint16_t h);
+  uint8_t* getBuffer() const;
+  bool getPixel(int16_t x, int16_t y) const;
+};
+
+class GFXcanvas16 : public Adafruit_GFX {
+public:
+  GFXcanvas16(uint16_t w, uint16_t h);
+  uint16_t* getBuffer() const;
+};
+
+#endif // HOST_ADAFRUIT_GFX_H
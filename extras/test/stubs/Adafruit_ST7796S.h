@@ -0,0 +1,31 @@
+#ifndef HOST_ADAFRUIT_ST7796S_H
+#define HOST_ADAFRUIT_ST7796S_H
+
+#include <Adafruit_GFX.h>
+
+class Adafruit_SPITFT : public Adafruit_GFX {
+public:
+  Adafruit_SPITFT();
+  void startWrite();
+  void endWrite();
+  void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+  void writePixels(uint16_t* colors, uint32_t length, bool block = true, bool bigEndian = false);
+  void writeColor(uint16_t color, uint32_t length);
+  void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void writeCommand(uint8_t cmd);
+  void sendCommand(uint8_t cmd, const uint8_t* data = nullptr, uint8_t length = 0);
+  void spiWrite(uint8_t b);
+  void setSPISpeed(uint32_t freq);
+  void dmaWait();
+  void enableDisplay(bool enable);
+  void enableSleep(bool enable);
+};
+
+class Adafruit_ST7796S : public Adafruit_SPITFT {
+public:
+  Adafruit_ST7796S(int8_t cs, int8_t dc, int8_t rst);
+  void init(uint16_t width = 320, uint16_t height = 480, uint8_t mode = 0);
+  void begin(uint32_t freq = 0);
+};
+
+#endif // HOST_ADAFRUIT_ST7796S_H
@@ -0,0 +1,114 @@
+// Arduino mínimo para las pruebas en el PC: solo lo que usan los módulos que
+// se prueban. micros() y millis() leen hostMicros, que avanza cada prueba.
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+using std::min;
+using std::max;
+
+#define F(x) x
+#define PROGMEM
+#define DEC 10
+#define HEX 16
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+typedef uint8_t byte;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+inline uint32_t hostMicros = 0;
+// us que avanza cada lectura del reloj: para las esperas activas (0 = parado)
+inline uint32_t hostClockStep = 0;
+
+inline unsigned long micros() { return hostMicros += hostClockStep; }
+inline unsigned long millis() { return (hostMicros += hostClockStep) / 1000; }
+inline void delay(unsigned long ms) { hostMicros += ms * 1000; }
+inline void delayMicroseconds(unsigned int us) { hostMicros += us; }
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return HIGH; }
+inline void analogWrite(uint8_t, int) {}
+inline void attachInterrupt(uint8_t, void (*)(), int) {}
+inline void detachInterrupt(uint8_t) {}
+inline uint8_t digitalPinToInterrupt(uint8_t pin) { return pin; }
+#define RISING 1
+#define FALLING 2
+#define IRAM_ATTR
+
+inline long random(long range) { return range > 0 ? rand() % range : 0; }
+inline long random(long low, long high) { return low + random(high - low); }
+
+// Print escribe en stdout salvo con quiet (las pruebas solo muestran su resumen)
+class Print {
+public:
+  bool quiet = false;
+
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) { return quiet ? 0 : (size_t)putchar(c); }
+  size_t write(const uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length; i++) write(data[i]);
+    return length;
+  }
+
+  size_t print(const char* s) { return quiet ? 0 : printf("%s", s); }
+  size_t print(char c) { return quiet ? 0 : printf("%c", c); }
+  size_t print(int v, int base = DEC) { return print((long)v, base); }
+  size_t print(unsigned int v, int base = DEC) { return print((unsigned long)v, base); }
+  size_t print(long v, int base = DEC) { return quiet ? 0 : printf(base == HEX ? "%lX" : "%ld", v); }
+  size_t print(unsigned long v, int base = DEC) { return quiet ? 0 : printf(base == HEX ? "%lX" : "%lu", v); }
+  size_t print(double v, int digits = 2) { return quiet ? 0 : printf("%.*f", digits, v); }
+
+  template <typename T> size_t println(T v) { size_t n = print(v); return n + println(); }
+  template <typename T> size_t println(T v, int format) { size_t n = print(v, format); return n + println(); }
+  size_t println() { return quiet ? 0 : printf("\n"); }
+};
+
+class Stream : public Print {
+public:
+  virtual int available() { return 0; }
+  virtual int read() { return -1; }
+};
+
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long, uint32_t = 0, int8_t = -1, int8_t = -1) {}
+  virtual int availableForWrite() { return 128; }
+  operator bool() const { return true; }
+};
+
+#define SERIAL_8N1 0
+
+// Memoria del chip: sin significado en el PC
+class EspClass {
+public:
+  uint32_t getFreeHeap() { return 0; }
+  uint32_t getMinFreeHeap() { return 0; }
+  uint32_t getMaxAllocHeap() { return 0; }
+  uint32_t getHeapSize() { return 0; }
+  uint32_t getFreePsram() { return 0; }
+};
+
+inline EspClass ESP;
+
+inline HardwareSerial Serial;
+inline HardwareSerial Serial1;
+
+#endif // HOST_ARDUINO_H
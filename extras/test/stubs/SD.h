@@ -0,0 +1,49 @@
+// SD: solo declaraciones; la prueba que use ficheros los simula
+#ifndef HOST_SD_H
+#define HOST_SD_H
+
+#include <SPI.h>
+#include <time.h>
+
+#define FILE_READ    "r"
+#define FILE_WRITE   "w"
+#define FILE_APPEND  "a"
+
+class File : public Stream {
+public:
+  void* handle = nullptr;
+
+  operator bool() const { return handle != nullptr; }
+  void close();
+  size_t write(const uint8_t* data, size_t length);
+  size_t write(uint8_t b) override;
+  int read(uint8_t* buffer, size_t length);
+  int read() override;
+  int available() override;
+  size_t size();
+  size_t position();
+  bool seek(uint32_t pos);
+  void flush();
+  bool isDirectory();
+  File openNextFile();
+  const char* name();
+  time_t getLastWrite();
+};
+
+class SDFS {
+public:
+  bool begin(uint8_t cs, SPIClass& spi, uint32_t freq);
+  void end();
+  File open(const char* path, const char* mode = FILE_READ);
+  bool exists(const char* path);
+  bool remove(const char* path);
+  bool mkdir(const char* path);
+  bool rmdir(const char* path);
+  bool rename(const char* from, const char* to);
+  uint64_t totalBytes();
+  uint64_t usedBytes();
+};
+
+inline SDFS SD;
+
+#endif // HOST_SD_H
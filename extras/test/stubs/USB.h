@@ -0,0 +1,11 @@
+#ifndef HOST_USB_H
+#define HOST_USB_H
+
+class ESPUSB {
+public:
+  bool begin() { return true; }
+};
+
+inline ESPUSB USB;
+
+#endif // HOST_USB_H
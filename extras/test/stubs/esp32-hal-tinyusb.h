@@ -0,0 +1,35 @@
+// TinyUSB: solo declaraciones; la prueba que enlace MidiManager las define
+#ifndef HOST_ESP32_HAL_TINYUSB_H
+#define HOST_ESP32_HAL_TINYUSB_H
+
+#include <stdint.h>
+
+typedef int esp_err_t;
+#ifndef ESP_OK
+#define ESP_OK 0
+#endif
+
+typedef enum { USB_INTERFACE_MIDI = 3 } tinyusb_interface_t;
+typedef uint16_t (*tinyusb_descriptor_cb_t)(uint8_t* dst, uint8_t* itf);
+
+esp_err_t tinyusb_enable_interface(tinyusb_interface_t, uint16_t, tinyusb_descriptor_cb_t);
+uint8_t tinyusb_add_string_descriptor(const char*);
+uint8_t tinyusb_get_free_in_endpoint();
+uint8_t tinyusb_get_free_out_endpoint();
+
+bool tud_midi_mounted();
+bool tud_midi_available();
+bool tud_midi_packet_read(uint8_t* packet);
+bool tud_midi_packet_write(const uint8_t* packet);
+uint32_t tud_midi_stream_write(uint8_t cable, const uint8_t* data, uint32_t length);
+
+#define TUD_MIDI_DESC_HEAD_LEN     (9 + 9 + 7 + 9)
+#define TUD_MIDI_DESC_JACK_LEN     (6 + 6 + 9 + 9)
+#define TUD_MIDI_DESC_EP_LEN(n)    (9 + 4 + (n))
+#define TUD_MIDI_DESC_HEAD(itf, str, n)  (uint8_t)((void)(str), 0)
+#define TUD_MIDI_DESC_JACK_DESC(id, str) 0
+#define TUD_MIDI_DESC_EP(ep, size, n)    0
+#define TUD_MIDI_JACKID_IN_EMB(id)       (id)
+#define TUD_MIDI_JACKID_OUT_EMB(id)      (id)
+
+#endif // HOST_ESP32_HAL_TINYUSB_H
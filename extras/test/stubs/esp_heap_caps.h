@@ -0,0 +1,20 @@
+// En el PC no hay PSRAM: todo sale del heap normal
+#ifndef HOST_ESP_HEAP_CAPS_H
+#define HOST_ESP_HEAP_CAPS_H
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_SPIRAM    (1 << 0)
+#define MALLOC_CAP_8BIT      (1 << 1)
+#define MALLOC_CAP_INTERNAL  (1 << 2)
+#define MALLOC_CAP_DEFAULT   (1 << 3)
+
+inline void* heap_caps_malloc(size_t size, uint32_t) { return malloc(size); }
+inline void* heap_caps_calloc(size_t n, size_t size, uint32_t) { return calloc(n, size); }
+inline void* heap_caps_realloc(void* ptr, size_t size, uint32_t) { return realloc(ptr, size); }
+inline void heap_caps_free(void* ptr) { free(ptr); }
+inline size_t heap_caps_get_free_size(uint32_t) { return 1 << 20; }
+inline size_t heap_caps_get_largest_free_block(uint32_t) { return 1 << 20; }
+
+#endif // HOST_ESP_HEAP_CAPS_H
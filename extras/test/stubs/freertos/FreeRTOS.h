@@ -0,0 +1,27 @@
+// FreeRTOS: tipos y declaraciones; cada prueba define lo que use
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+#include <stdint.h>
+
+typedef void* SemaphoreHandle_t;
+typedef void* TaskHandle_t;
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef void (*TaskFunction_t)(void*);
+
+// Sección crítica como spinlock: las pruebas con hilos la necesitan de verdad
+typedef struct { volatile bool locked; } portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED  {false}
+#define portENTER_CRITICAL(mux)       while (__atomic_test_and_set(&(mux)->locked, __ATOMIC_ACQUIRE)) {}
+#define portEXIT_CRITICAL(mux)        __atomic_clear(&(mux)->locked, __ATOMIC_RELEASE)
+#define portENTER_CRITICAL_ISR(mux)   portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux)    portEXIT_CRITICAL(mux)
+#define portMAX_DELAY                 0xFFFFFFFF
+#define pdTRUE                        1
+#define pdFALSE                       0
+#define pdPASS                        1
+#define pdMS_TO_TICKS(ms)             (ms)
+#define IRAM_ATTR
+
+#endif // HOST_FREERTOS_H
@@ -0,0 +1,165 @@
+// Memoria y coste de los bancos de encoders con 4, 8, 16 y 32 bancos: tablas
+// de configuración y estado, imagen de fichero/preset y lo fijo (caché de
+// presets). Mide en el PC el cambio de banco (lo que lee de las tablas el
+// primer frame), el redimensionado desde el menú y la exportación e
+// importación de la imagen, y comprueba que los bancos existentes se
+// conservan al crecer y que los nuevos llegan vacíos y sin poblar.
+// Compilar y ejecutar con extras/test/run_tests.sh
+
+#include "test_util.h"
+#include "encoder_host.h"
+#include "PresetCacheManager.h"
+#include <chrono>
+
+typedef std::chrono::steady_clock Clock;
+
+#define PRESET_PARTITION_SIZE  0x100000   // "presets" en partitions.csv
+#define SWITCHES               100000
+#define COLD_SWITCHES          200
+#define COLD_BYTES             (8 << 20)  // Más que toda la caché del PC
+#define RESIZES                2000
+#define IMAGE_ROUNDS           2000
+
+static const uint8_t bankCounts[] = {4, 8, 16, 32};   // Las opciones del menú
+
+static std::vector<uint8_t> scrub(COLD_BYTES);
+static uint32_t sink = 0;
+
+template <typename F>
+static double nanosPer(uint32_t count, F body) {
+  Clock::time_point start = Clock::now();
+  body();
+  return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / count;
+}
+
+// Cada banco con valores propios, como si el DAW ya lo hubiera visitado
+static void populate(uint8_t fromBank, uint8_t toBank) {
+  for (uint8_t bank = fromBank; bank < toBank; bank++) {
+    for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+      encoderManager.updateFromDAW(i, bank, (uint8_t)((bank * 7 + i) % 128), (uint16_t)(bank * 1000 + i));
+    }
+  }
+}
+
+static bool bankIntact(uint8_t bank) {
+  const EncoderBankState& state = encoderManager.getBankState(bank);
+  for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+    if (state.dawValue[i] != (bank * 7 + i) % 128 || state.trackColor[i] != (uint16_t)(bank * 1000 + i)) {
+      return false;
+    }
+  }
+  return encoderManager.isBankPopulated(bank);
+}
+
+static bool bankEmpty(uint8_t bank) {
+  const EncoderBankState& state = encoderManager.getBankState(bank);
+  const EncoderBankState empty;
+  return !encoderManager.isBankPopulated(bank) && memcmp(&state, &empty, sizeof(empty)) == 0;
+}
+
+// changeBankSafely() y lo que el primer frame de la vista de 16 tiras lee del banco
+static uint32_t switchTo(uint8_t bank) {
+  encoderManager.setCurrentBank(bank);
+  uint32_t sum = encoderManager.isBankPopulated(bank);
+  const EncoderBankState& state = encoderManager.getBankState(bank);
+  const EncoderConfig* configs = encoderManager.getBankConfigs()[bank];
+  for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+    sum += state.dawValue[i] + state.trackColor[i] + configs[i].trackName[0] + configs[i].control;
+  }
+  return sum;
+}
+
+int main() {
+  rndSeed(0xBA7C0030);
+  hostSetupEncoders(TAKEOVER_FOLLOW);
+
+  uint32_t slotSize = sizeof(PresetCacheSlotHeader) + PRESET_IMAGE_MAX_SIZE;
+  slotSize = (slotSize + PRESET_CACHE_SECTOR_SIZE - 1) / PRESET_CACHE_SECTOR_SIZE * PRESET_CACHE_SECTOR_SIZE;
+  printf("Memoria por banco\n");
+  printf("  %u encoders x %zu B de configuración + %zu B de estado = %zu B por banco\n", NUM_ENCODERS,
+         sizeof(EncoderConfig), sizeof(EncoderBankState), ENCODER_BANK_BYTES);
+  printf("  fijo: EncoderManager %zu B en RAM interna, búfer de presets %zu B en PSRAM, slot de caché %u B "
+         "(%u slots en la partición)\n", sizeof(EncoderManager), (size_t)PRESET_IMAGE_MAX_SIZE, slotSize,
+         min((uint32_t)PRESET_CACHE_MAX_SLOTS, (uint32_t)(PRESET_PARTITION_SIZE / slotSize)));
+
+  printf("Tablas e imagen según el número de bancos\n");
+  std::vector<uint8_t> image(ENCODER_IMAGE_MAX_SIZE);
+  for (uint8_t count : bankCounts) {
+    CHECK(encoderManager.setBankCount(count) && encoderManager.getBankCount() == count,
+          "no se pudieron reservar %u bancos", count);
+    size_t tables = encoderManager.getConfigDataSize() + encoderManager.getStateDataSize();
+    size_t imageSize = encoderManager.exportImage(image.data(), image.size());
+    printf("  %2u bancos: configuración %6zu B + estado %5zu B = %6zu B, imagen %6zu B (%3zu%% del slot)\n", count,
+           encoderManager.getConfigDataSize(), encoderManager.getStateDataSize(), tables, imageSize,
+           imageSize * 100 / slotSize);
+    CHECK(tables == count * ENCODER_BANK_BYTES, "%u bancos: %zu B de tablas", count, tables);
+    CHECK(imageSize == sizeof(EncoderImageHeader) + tables && imageSize == encoderManager.getImageSize(),
+          "%u bancos: imagen de %zu B", count, imageSize);
+  }
+  CHECK(encoderManager.getImageSize() == ENCODER_IMAGE_MAX_SIZE, "32 bancos no llenan ENCODER_IMAGE_MAX_SIZE");
+
+  // Al crecer se conservan los bancos que había; los nuevos llegan vacíos y
+  // se pueblan con la primera realimentación del DAW
+  encoderManager.setBankCount(bankCounts[0]);
+  encoderManager.resetAllBanks();
+  populate(0, bankCounts[0]);
+  for (uint8_t n = 1; n < sizeof(bankCounts); n++) {
+    uint8_t previous = bankCounts[n - 1], count = bankCounts[n];
+    encoderManager.setBankCount(count);
+    uint8_t intact = 0, empty = 0;
+    for (uint8_t bank = 0; bank < count; bank++) {
+      if (bank < previous) intact += bankIntact(bank);
+      else empty += bankEmpty(bank);
+    }
+    CHECK(intact == previous && empty == count - previous, "de %u a %u bancos: %u conservados, %u vacíos",
+          previous, count, intact, empty);
+    populate(previous, count);
+  }
+
+  // Cambio de banco: recorrer todos con bancos arriba, con las tablas en
+  // caché y frías (en el ESP32-S3 están en PSRAM, detrás de la caché)
+  printf("Cambio de banco y tablas (ns en el PC)\n");
+  for (uint8_t count : bankCounts) {
+    encoderManager.setBankCount(count);
+    double warmNs = nanosPer(SWITCHES, [&] {
+      for (uint32_t n = 0; n < SWITCHES; n++) sink += switchTo(n % count);
+    });
+
+    double coldNs = 0;
+    for (uint32_t n = 0; n < COLD_SWITCHES; n++) {
+      for (size_t i = 0; i < scrub.size(); i += 64) scrub[i]++;
+      coldNs += nanosPer(1, [&] { sink += switchTo(n % count); });
+    }
+    coldNs /= COLD_SWITCHES;
+
+    double resizeNs = nanosPer(RESIZES, [&] {
+      for (uint32_t n = 0; n < RESIZES; n++) {
+        encoderManager.setBankCount(n & 1 ? count : 1);
+      }
+    });
+    encoderManager.setBankCount(count);
+
+    uint8_t* buffer = image.data();
+    size_t imageSize = encoderManager.getImageSize();
+    double exportNs = nanosPer(IMAGE_ROUNDS, [&] {
+      for (uint32_t n = 0; n < IMAGE_ROUNDS; n++) sink += encoderManager.exportImage(buffer, image.size());
+    });
+    std::vector<uint8_t> exported(image.begin(), image.begin() + imageSize);
+    double importNs = nanosPer(IMAGE_ROUNDS, [&] {
+      for (uint32_t n = 0; n < IMAGE_ROUNDS; n++) sink += encoderManager.importImage(exported.data(), imageSize);
+    });
+
+    printf("  %2u bancos: cambio %5.1f ns (frío %6.1f ns, %zu B leídos) | redimensionar %7.1f ns | "
+           "exportar %7.1f ns, importar %7.1f ns\n", count, warmNs, coldNs, ENCODER_BANK_BYTES, resizeNs,
+           exportNs, importNs);
+
+    // La imagen importada debe volver a exportarse igual
+    encoderManager.exportImage(image.data(), image.size());
+    CHECK(memcmp(image.data(), exported.data(), imageSize) == 0, "%u bancos: la imagen no sobrevive a importarla",
+          count);
+  }
+  CHECK(sink != 0, "la medida no leyó nada");
+
+  printf(failures ? "test_bank_memory: %d fallos\n" : "test_bank_memory: OK\n", failures);
+  return failures ? 1 : 0;
+}
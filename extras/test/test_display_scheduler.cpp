@@ -0,0 +1,178 @@
+// Planificador de regiones de la pantalla principal en tiempo simulado: el
+// DisplayManager real sobre el panel de display_host.h, con medidores cada
+// 5 ms, un fader que se mueve cada 20 ms y MIDI ocupado a ratos. Comprueba
+// que los medidores no ceden nunca, que un fader aplazado sale antes de
+// DISPLAY_MAX_DEFER_MS y que los contadores de frames perdidos (missed) y
+// cedidos (dropped) cuentan lo que ocurrió.
+// Compilar y ejecutar con extras/test/run_tests.sh
+
+#include "test_util.h"
+#include "display_host.h"
+
+#define LOOP_US          1000
+#define VU_PERIOD_US     5000
+#define FADER_PERIOD_US  20000
+#define RUN_US           10000000
+#define SLACK_MS         12      // Una pasada del loop más un volcado cortado por presupuesto
+
+struct Scenario {
+  const char* name;
+  uint8_t busyPercent;    // Ventanas de 10 ms con MIDI ocupado
+  uint32_t stallUs;       // Pasada del loop bloqueada cada 200 ms (0 = ninguna)
+};
+
+struct Result {
+  uint32_t fields[16];
+  uint32_t faderLatencyMs;   // Del cambio al primer volcado de esa barra
+  uint32_t meterGapMs;       // Mayor hueco entre volcados de medidores
+  uint32_t faderMoves;
+};
+
+static bool overlaps(const HostPaint& paint, const Widget& widget) {
+  return paint.x < widget.x + widget.w && widget.x < paint.x + paint.w &&
+         paint.y < widget.y + widget.h && widget.y < paint.y + paint.h;
+}
+
+static Result run(const Scenario& scenario) {
+  hostSetupDisplay(ORIENT_270, VIEW_STRIPS_8);
+  MixerScene scene;
+  scene.build(TFT_WIDTH, TFT_HEIGHT, VIEW_STRIPS_8);
+
+  EncoderBankState state;
+  EncoderConfig configs[NUM_ENCODERS];
+  MtcData mtc;
+  TransportState transport;
+  ClockData clock;
+
+  // Frame completo inicial fuera de la medida
+  while (!displayManager.drawMainScreen(state, configs, mtc, 0, transport, clock)) hostMicros += LOOP_US;
+  displayManager.updateFrameStatistics();
+  displayManager.resetFrameStatistics();
+  hostPanel.recordPaints = true;
+  hostPanel.paints.clear();
+
+  Result result = {};
+  uint32_t start = hostMicros;
+  uint32_t nextVu = start, nextFader = start, nextBusy = start, nextStall = start + 200000;
+  uint32_t nextSecond = start + 1000000;
+  uint32_t faderChanged[8] = {};
+  uint32_t lastMeter = start;
+  bool busy = false;
+
+  while (hostMicros - start < RUN_US) {
+    uint32_t loopStart = hostMicros;
+
+    if ((int32_t)(hostMicros - nextBusy) >= 0) {
+      busy = rnd(100) < scenario.busyPercent;
+      displayManager.setMidiBusy(busy);
+      nextBusy += 10000;
+    }
+    if ((int32_t)(hostMicros - nextVu) >= 0) {
+      for (uint8_t ch = 0; ch < 8; ch++) displayManager.setVULevel(ch, rnd(128));
+      nextVu += VU_PERIOD_US;
+    }
+    if ((int32_t)(hostMicros - nextFader) >= 0) {
+      uint8_t ch = rnd(8);
+      // Siempre hacia arriba: sin volver a lo que ya está en pantalla
+      state.dawValue[ch] = (state.dawValue[ch] + 8) % 128;
+      displayManager.markChannelDirty(ch);
+      if (!faderChanged[ch]) faderChanged[ch] = hostMicros;
+      result.faderMoves++;
+      nextFader += FADER_PERIOD_US;
+    }
+
+    size_t seen = hostPanel.paints.size();
+    displayManager.drawMainScreen(state, configs, mtc, 0, transport, clock);
+    for (size_t n = seen; n < hostPanel.paints.size(); n++) {
+      const HostPaint& paint = hostPanel.paints[n];
+      for (uint8_t ch = 0; ch < 8; ch++) {
+        if (faderChanged[ch] && overlaps(paint, scene.channelWidget(ch, WIDGET_FADER))) {
+          result.faderLatencyMs = max(result.faderLatencyMs, (paint.micros - faderChanged[ch]) / 1000);
+          faderChanged[ch] = 0;
+        }
+        if (overlaps(paint, scene.channelWidget(ch, WIDGET_METER))) {
+          result.meterGapMs = max(result.meterGapMs, (paint.micros - lastMeter) / 1000);
+          lastMeter = paint.micros;
+        }
+      }
+    }
+    hostPanel.paints.clear();
+
+    if (scenario.stallUs && (int32_t)(hostMicros - nextStall) >= 0) {
+      hostMicros += scenario.stallUs;   // Escritura en SD, menú...
+      nextStall += 200000;
+    }
+    if ((int32_t)(hostMicros - nextSecond) >= 0) {
+      displayManager.updateFrameStatistics();
+      nextSecond += 1000000;
+    }
+    if (hostMicros - loopStart < LOOP_US) hostMicros = loopStart + LOOP_US;
+  }
+
+  hostPanel.recordPaints = false;
+  displayManager.getFrameDiagnostics(result.fields);
+  return result;
+}
+
+int main() {
+  rndSeed(0xD15A0047);
+
+  const Scenario scenarios[] = {
+    {"MIDI libre", 0, 0},
+    {"MIDI ocupado 30%", 30, 0},
+    {"MIDI ocupado 80%", 80, 0},
+    {"MIDI siempre ocupado", 100, 0},
+    {"loop bloqueado 60 ms", 0, 60000},
+  };
+
+  printf("Regiones en 10 s: fps medidores/faders/texto | perdidos | cedidos a MIDI\n");
+  for (const Scenario& scenario : scenarios) {
+    Result r = run(scenario);
+    const uint32_t* fps = r.fields;
+    const uint32_t* missed = r.fields + REGION_COUNT;
+    const uint32_t* dropped = r.fields + 2 * REGION_COUNT;
+    uint32_t overruns = r.fields[3 * REGION_COUNT];
+    printf("  %-21s %2u/%2u/%2u | %3u/%3u/%3u | %3u/%3u/%3u | fader -> pantalla %3u ms, hueco de medidores %2u ms, "
+           "%u cortes\n",
+           scenario.name, fps[0], fps[1], fps[2], missed[0], missed[1], missed[2], dropped[0], dropped[1], dropped[2],
+           r.faderLatencyMs, r.meterGapMs, overruns);
+
+    bool busy = scenario.busyPercent > 0;
+    uint32_t stallMs = scenario.stallUs / 1000;
+    uint32_t faderBound = DISPLAY_PARTIAL_UPDATE + SLACK_MS + stallMs + (busy ? DISPLAY_MAX_DEFER_MS : 0);
+    uint32_t meterBound = DISPLAY_PARTIAL_UPDATE + SLACK_MS + stallMs;
+
+    CHECK(r.faderLatencyMs <= faderBound, "%s: fader en pantalla a los %u ms (cota %u)", scenario.name,
+          r.faderLatencyMs, faderBound);
+    CHECK(r.meterGapMs <= meterBound, "%s: medidores parados %u ms (cota %u)", scenario.name, r.meterGapMs,
+          meterBound);
+    CHECK(dropped[REGION_METERS] == 0, "%s: %u frames de medidores cedidos", scenario.name, dropped[REGION_METERS]);
+
+    if (!busy) {
+      CHECK(dropped[REGION_FADERS] == 0 && dropped[REGION_LABELS] == 0, "%s: frames cedidos sin MIDI ocupado",
+            scenario.name);
+    } else {
+      CHECK(dropped[REGION_FADERS] > 0, "%s: ningún frame de faders cedido", scenario.name);
+      CHECK(missed[REGION_FADERS] == 0, "%s: frames aplazados contados como perdidos", scenario.name);
+    }
+    if (scenario.busyPercent == 100) {
+      // Cada DISPLAY_MAX_DEFER_MS sale un volcado y el resto de periodos se ceden
+      uint32_t periods = RUN_US / 1000 / DISPLAY_PARTIAL_UPDATE;
+      uint32_t flushes = RUN_US / 1000 / DISPLAY_MAX_DEFER_MS;
+      CHECK(r.faderLatencyMs >= DISPLAY_MAX_DEFER_MS - DISPLAY_PARTIAL_UPDATE,
+            "%s: el fader no esperó (%u ms)", scenario.name, r.faderLatencyMs);
+      CHECK(dropped[REGION_FADERS] >= (periods - flushes) * 9 / 10 && dropped[REGION_FADERS] <= periods,
+            "%s: %u frames de faders cedidos, se esperaban unos %u", scenario.name, dropped[REGION_FADERS],
+            periods - flushes);
+    }
+    if (scenario.stallUs) {
+      CHECK(missed[REGION_METERS] > 0 && missed[REGION_FADERS] > 0, "%s: bloqueos sin frames perdidos",
+            scenario.name);
+    } else {
+      CHECK(missed[REGION_METERS] == 0, "%s: %u frames de medidores perdidos", scenario.name, missed[REGION_METERS]);
+    }
+  }
+
+  printf(failures ? "test_display_scheduler: %d fallos\n" : "test_display_scheduler: OK\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,208 @@
+// Disposición del estado de los encoders, antes y después de separarlo: la
+// tabla antigua (un EncoderConfig con valores y configuración mezclados por
+// encoder) frente a EncoderBankState por banco más la tabla de configuración
+// fría. Mide el procesado de eventos de encoder y la preparación de un frame
+// de la pantalla principal con las dos, y el camino real del firmware.
+// Compilar y ejecutar con extras/test/run_tests.sh
+
+#include "test_util.h"
+#include "encoder_host.h"
+#include <chrono>
+
+typedef std::chrono::steady_clock Clock;
+
+// ---- Antes: la estructura y el procesado de la versión anterior
+struct LegacyEncoderConfig {
+  uint8_t channel : 4;
+  uint8_t control : 7;
+  uint8_t controlType : 2;
+  bool isPan : 1;
+  int8_t value;
+  int8_t dawValue;
+  int8_t minValue;
+  int8_t maxValue;
+  bool isMute : 1;
+  bool isSolo : 1;
+  uint16_t trackColor;
+  char trackName[3];
+};
+
+static LegacyEncoderConfig legacyBanks[MAX_BANKS][NUM_ENCODERS];
+
+// ---- Después: configuración fría y estado caliente por banco
+static EncoderConfig splitConfigs[MAX_BANKS][NUM_ENCODERS];
+static EncoderBankState splitStates[MAX_BANKS];
+
+// Lo que llega a drawVolumeBar/drawPanBar/drawChannelInfo por canal
+struct StripInput {
+  int8_t volume;
+  int8_t pan;
+  uint16_t color;
+  uint16_t panColor;
+  bool highlight;
+  bool mute;
+  bool solo;
+  const char* name;
+};
+
+struct Event {
+  uint8_t encoder;
+  uint8_t bank;
+  int8_t change;
+};
+
+static uint32_t sink = 0;   // Lo "enviado": evita que el compilador quite el trabajo
+
+static void fillTables() {
+  for (uint8_t bank = 0; bank < MAX_BANKS; bank++) {
+    splitStates[bank] = EncoderBankState();
+    for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+      int8_t minValue = rnd(20), maxValue = 107 + rnd(21), value = minValue + rnd(maxValue - minValue + 1);
+      uint16_t color = rnd(0x10000);
+      bool mute = rnd(4) == 0, solo = rnd(8) == 0;
+
+      LegacyEncoderConfig& legacy = legacyBanks[bank][i];
+      legacy = LegacyEncoderConfig();
+      legacy.channel = 1;
+      legacy.control = 20 + i;
+      legacy.controlType = CT_CC;
+      legacy.minValue = minValue;
+      legacy.maxValue = maxValue;
+      legacy.value = legacy.dawValue = value;
+      legacy.isMute = mute;
+      legacy.isSolo = solo;
+      legacy.trackColor = color;
+      strcpy(legacy.trackName, "T");
+
+      EncoderConfig& config = splitConfigs[bank][i];
+      config = EncoderConfig();
+      config.control = 20 + i;
+      config.minValue = minValue;
+      config.maxValue = maxValue;
+      strcpy(config.trackName, "T");
+      EncoderBankState& state = splitStates[bank];
+      state.value[i] = state.dawValue[i] = value;
+      state.trackColor[i] = color;
+      if (mute) state.muteMask |= 1 << i;
+      if (solo) state.soloMask |= 1 << i;
+    }
+  }
+}
+
+static void legacyProcess(const Event& event) {
+  LegacyEncoderConfig& config = legacyBanks[event.bank][event.encoder];
+  config.value = constrain(config.value + event.change, config.minValue, config.maxValue);
+  sink += config.channel + config.control + config.value;
+}
+
+static void splitProcess(const Event& event) {
+  const EncoderConfig& config = splitConfigs[event.bank][event.encoder];
+  EncoderBankState& state = splitStates[event.bank];
+  int8_t value = constrain(state.value[event.encoder] + event.change, config.minValue, config.maxValue);
+  state.value[event.encoder] = value;
+  sink += config.channel + config.control + value;
+}
+
+// Volumen en los encoders 0-7, pan en 8-15, como drawMainScreen
+static void legacyFrame(uint8_t bank, StripInput* strips) {
+  const LegacyEncoderConfig* encoders = legacyBanks[bank];
+  for (uint8_t i = 0; i < 8; i++) {
+    const LegacyEncoderConfig& vol = encoders[i];
+    const LegacyEncoderConfig& pan = encoders[i + 8];
+    strips[i] = {vol.dawValue, pan.dawValue, vol.trackColor, pan.trackColor,
+                 vol.isSolo || vol.isMute, vol.isMute, vol.isSolo, vol.trackName};
+  }
+}
+
+static void splitFrame(uint8_t bank, StripInput* strips) {
+  const EncoderBankState& state = splitStates[bank];
+  const EncoderConfig* configs = splitConfigs[bank];
+  uint16_t highlightMask = state.muteMask | state.soloMask;
+  for (uint8_t i = 0; i < 8; i++) {
+    strips[i] = {state.dawValue[i], state.dawValue[i + 8], state.trackColor[i], state.trackColor[i + 8],
+                 (highlightMask & (1 << i)) != 0, state.isMute(i), state.isSolo(i), configs[i].trackName};
+  }
+}
+
+static uint32_t stripSum(const StripInput* strips) {
+  uint32_t sum = 0;
+  for (uint8_t i = 0; i < 8; i++) {
+    sum += strips[i].volume + strips[i].pan * 3 + strips[i].color + strips[i].panColor * 5 +
+           strips[i].highlight * 7 + strips[i].mute * 11 + strips[i].solo * 13 + strips[i].name[0];
+  }
+  return sum;
+}
+
+template <typename F>
+static double nanosPer(uint32_t count, F body) {
+  Clock::time_point start = Clock::now();
+  body();
+  return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / count;
+}
+
+int main() {
+  rndSeed(0x1A70029);
+  hostSetupEncoders(TAKEOVER_FOLLOW);
+
+  printf("Memoria por banco\n");
+  printf("  antes %zu bytes (%zu por encoder), después %zu de configuración + %zu de estado\n",
+         sizeof(LegacyEncoderConfig) * NUM_ENCODERS, sizeof(LegacyEncoderConfig),
+         sizeof(EncoderConfig) * NUM_ENCODERS, sizeof(EncoderBankState));
+
+  // Eventos repartidos por los 32 bancos, con ráfagas de un mismo encoder
+  std::vector<Event> events(4096);
+  for (Event& event : events) {
+    event = {(uint8_t)rnd(NUM_ENCODERS), (uint8_t)rnd(MAX_BANKS), (int8_t)(rnd(2) ? 1 : -1)};
+  }
+  const uint32_t rounds = 500;
+  const uint32_t total = rounds * events.size();
+
+  printf("Eventos de encoder (%u)\n", total);
+  fillTables();
+  sink = 0;
+  double legacyNs = nanosPer(total, [&] {
+    for (uint32_t round = 0; round < rounds; round++) for (const Event& event : events) legacyProcess(event);
+  });
+  uint32_t legacySink = sink;
+  sink = 0;
+  double splitNs = nanosPer(total, [&] {
+    for (uint32_t round = 0; round < rounds; round++) for (const Event& event : events) splitProcess(event);
+  });
+  printf("  antes %.2f ns/evento, después %.2f ns/evento\n", legacyNs, splitNs);
+  CHECK(sink == legacySink, "las dos tablas no dan los mismos valores (%u frente a %u)", sink, legacySink);
+
+  // El firmware completo, un banco: coalescencia, recogida y turno de salida
+  const uint32_t firmwareEvents = 200000;
+  double firmwareNs = nanosPer(firmwareEvents, [&] {
+    for (uint32_t n = 0; n < firmwareEvents; n++) {
+      const Event& event = events[n % events.size()];
+      encoderManager.processEncoderChange(event.encoder, event.change, 0);
+      encoderManager.updateOutput();
+    }
+  });
+  printf("  firmware (processEncoderChange + updateOutput) %.2f ns/evento, %zu CC enviados\n", firmwareNs,
+         hostSentCCs.size());
+  CHECK(!hostSentCCs.empty(), "el firmware no envió nada");
+
+  printf("Preparación de frame (8 canales de volumen y pan)\n");
+  const uint32_t frames = 200000;
+  StripInput strips[8];
+  uint32_t legacySum = 0, splitSum = 0;
+  legacyNs = nanosPer(frames, [&] {
+    for (uint32_t n = 0; n < frames; n++) {
+      legacyFrame(n % MAX_BANKS, strips);
+      legacySum += stripSum(strips);
+    }
+  });
+  splitNs = nanosPer(frames, [&] {
+    for (uint32_t n = 0; n < frames; n++) {
+      splitFrame(n % MAX_BANKS, strips);
+      splitSum += stripSum(strips);
+    }
+  });
+  printf("  antes %.1f ns/frame, después %.1f ns/frame\n", legacyNs, splitNs);
+  CHECK(legacySum == splitSum, "los frames no coinciden (%u frente a %u)", legacySum, splitSum);
+
+  printf(failures ? "test_encoder_layout: %d fallos\n" : "test_encoder_layout: OK\n", failures);
+  return failures ? 1 : 0;
+}
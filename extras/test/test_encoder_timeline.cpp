@@ -0,0 +1,212 @@
+// Cronologías guionizadas de giros y respuestas del DAW: mientras se toca un
+// encoder, los ecos no pisan lo mostrado ni lo enviado, y al soltarlo el
+// encoder se reengancha según su modo de recogida.
+// Compilar y ejecutar con extras/test/run_tests.sh
+
+#include "test_util.h"
+#include "encoder_host.h"
+
+// DAW que toma los CC del controlador y los devuelve, como valor absoluto,
+// 'latencyMs' después
+struct EchoDaw {
+  struct Echo {
+    uint32_t due;
+    uint8_t track;
+    uint8_t value;
+  };
+
+  uint8_t value[NUM_ENCODERS];
+  uint32_t latencyMs;
+  std::vector<Echo> echoes;
+
+  explicit EchoDaw(uint32_t latency) : latencyMs(latency) { memset(value, 64, sizeof(value)); }
+
+  // Automatización o cambio en el propio DAW: llega sin latencia
+  void set(uint8_t track, uint8_t newValue) {
+    value[track] = newValue;
+    encoderManager.updateFromDAW(track, 0, newValue);
+  }
+
+  void poll() {
+    for (const HostCC& cc : hostSentCCs) {
+      uint8_t track = cc.control - 20;
+      value[track] = cc.value;
+      echoes.push_back({(uint32_t)millis() + latencyMs, track, cc.value});
+    }
+    hostSentCCs.clear();
+
+    for (size_t i = 0; i < echoes.size();) {
+      if ((int32_t)(millis() - echoes[i].due) >= 0) {
+        encoderManager.updateFromDAW(echoes[i].track, 0, echoes[i].value);
+        echoes.erase(echoes.begin() + i);
+      } else {
+        i++;
+      }
+    }
+  }
+};
+
+// Guion: giros en ms relativos al inicio de la cronología
+struct Turn {
+  uint32_t ms;
+  uint8_t track;
+  int8_t change;
+};
+
+static uint32_t timelineStart = 0;
+static uint32_t sentCount = 0;
+static int8_t lowestShown = 127;
+
+static void startTimeline(uint8_t takeover) {
+  hostMicros += 1000000;   // Sin toques de la cronología anterior
+  hostSetupEncoders(takeover);
+  timelineStart = millis();
+  sentCount = 0;
+  lowestShown = 127;
+}
+
+static const EncoderBankState& state() { return encoderManager.getBankState(0); }
+
+// Avanza de milisegundo en milisegundo hasta 'ms', con los giros del guion
+// que caigan en medio; 'watch' es la pista cuyo valor mostrado se sigue
+static void runUntil(EchoDaw& daw, const Turn* turns, size_t count, uint32_t ms, uint8_t watch = 0) {
+  for (uint32_t now = millis() - timelineStart; now < ms; now = millis() - timelineStart) {
+    for (size_t i = 0; i < count; i++) {
+      if (turns[i].ms == now) encoderManager.processEncoderChange(turns[i].track, turns[i].change, 0, hostMicros);
+    }
+    encoderManager.updateOutput();
+    sentCount += hostSentCCs.size();
+    daw.poll();
+    lowestShown = min(lowestShown, state().dawValue[watch]);
+    hostMicros += 1000;
+  }
+}
+
+// Cinco pasos rápidos con eco a 25 ms: lo mostrado sube sin volver atrás
+// con los ecos antiguos y se envían exactamente cinco valores
+static void lateEchoes() {
+  startTimeline(TAKEOVER_FOLLOW);
+  EchoDaw daw(25);
+  const Turn turns[] = {{0, 0, 1}, {10, 0, 1}, {20, 0, 1}, {30, 0, 1}, {40, 0, 1}};
+
+  runUntil(daw, turns, 5, 41);
+  int8_t shownAt41 = state().dawValue[0];
+  lowestShown = 127;
+  runUntil(daw, turns, 5, 200);
+  printf("  FOLLOW, eco a 25 ms: %u envíos, mostrado %d, mínimo tras el último giro %d\n",
+         (unsigned)sentCount, shownAt41, lowestShown);
+  CHECK(shownAt41 == 69 && lowestShown == 69, "un eco antiguo hizo retroceder lo mostrado");
+  CHECK(sentCount == 5, "%u envíos en lugar de 5", (unsigned)sentCount);
+
+  runUntil(daw, turns, 5, 600);
+  CHECK(state().dawValue[0] == 69 && state().value[0] == 69 && state().confirmedValue[0] == 69,
+        "al soltar: mostrado %d, local %d, confirmado %d", state().dawValue[0], state().value[0],
+        state().confirmedValue[0]);
+}
+
+// Subir y volver: el eco de 65 llega entre el 66 y la vuelta a 65. Si
+// marcase 65 como enviado, la vuelta se suprimiría y el DAW quedaría en 66
+static void turnBack() {
+  startTimeline(TAKEOVER_FOLLOW);
+  EchoDaw daw(15);
+  const Turn turns[] = {{0, 0, 1}, {10, 0, 1}, {20, 0, -1}};
+
+  runUntil(daw, turns, 3, 600);
+  printf("  FOLLOW, 64 -> 66 -> 65: DAW %d, mostrado %d, %u envíos\n",
+         daw.value[0], state().dawValue[0], (unsigned)sentCount);
+  CHECK(daw.value[0] == 65, "el DAW se quedó en %d", daw.value[0]);
+  CHECK(state().dawValue[0] == 65 && state().value[0] == 65, "el controlador no acabó en 65");
+}
+
+// El DAW corrige el valor mientras se toca (límite de su parámetro): se
+// retiene y aparece al soltar
+static void dawOverride() {
+  startTimeline(TAKEOVER_FOLLOW);
+  EchoDaw daw(5);
+  const Turn turns[] = {{0, 2, 3}};
+
+  runUntil(daw, turns, 1, 100, 2);
+  daw.set(2, 60);
+  runUntil(daw, turns, 1, 120, 2);
+  int8_t shownTouched = state().dawValue[2];
+  runUntil(daw, turns, 1, 600, 2);
+  printf("  FOLLOW, el DAW fija 60 durante el toque: tocado %d, suelto %d\n",
+         shownTouched, state().dawValue[2]);
+  CHECK(shownTouched == 67, "el valor del DAW pisó la predicción durante el toque");
+  CHECK(state().dawValue[2] == 60 && state().value[2] == 60, "al soltar no se siguió al DAW");
+}
+
+// Automatización durante el toque en recogida: al soltar queda pendiente de
+// recogida contra el valor del DAW, sin salida hasta alcanzarlo
+static void pickupAfterTouch() {
+  startTimeline(TAKEOVER_PICKUP);
+  EchoDaw daw(5);
+  const Turn turns[] = {{0, 1, 2}, {500, 1, 10}, {510, 1, 30}};
+
+  runUntil(daw, turns, 3, 50, 1);
+  daw.set(1, 100);
+  runUntil(daw, turns, 3, 100, 1);
+  int8_t shownTouched = state().dawValue[1];
+  runUntil(daw, turns, 3, 400, 1);
+  bool pending = encoderManager.isPickupPending(1, 0);
+  int8_t shownReleased = state().dawValue[1];
+  uint32_t sentBefore = sentCount;
+
+  runUntil(daw, turns, 3, 505, 1);
+  uint32_t sentBelow = sentCount - sentBefore;
+  runUntil(daw, turns, 3, 900, 1);
+  printf("  PICKUP, DAW a 100 durante el toque: tocado %d, suelto %d, recogida %s, "
+         "envíos por debajo %u, DAW final %d\n", shownTouched, shownReleased, pending ? "sí" : "no",
+         (unsigned)sentBelow, daw.value[1]);
+  CHECK(shownTouched == 66, "la automatización pisó la predicción durante el toque");
+  CHECK(shownReleased == 100 && pending, "al soltar no quedó en recogida contra 100");
+  CHECK(sentBelow == 0, "salida antes de alcanzar el valor del DAW");
+  CHECK(daw.value[1] == 106 && !encoderManager.isPickupPending(1, 0), "no recogió al cruzar 100");
+}
+
+// Salto: el valor local no sigue al DAW y el siguiente giro sale desde él
+static void jump() {
+  startTimeline(TAKEOVER_JUMP);
+  EchoDaw daw(5);
+  const Turn turns[] = {{100, 4, 1}};
+
+  daw.set(4, 90);
+  runUntil(daw, turns, 1, 600, 4);
+  printf("  JUMP, DAW a 90 y un paso: DAW %d, mostrado %d\n", daw.value[4], state().dawValue[4]);
+  CHECK(daw.value[4] == 65 && state().dawValue[4] == 65 && state().value[4] == 65,
+        "el salto no partió del valor local");
+}
+
+// Escalado: la salida avanza hacia el extremo en proporción y los ecos de
+// esos envíos no cortan el acercamiento
+static void scaled() {
+  startTimeline(TAKEOVER_SCALED);
+  EchoDaw daw(5);
+  Turn turns[40];
+  for (uint8_t i = 0; i < 40; i++) turns[i] = {(uint32_t)(100 + i * 10), 5, 1};
+
+  daw.set(5, 96);
+  runUntil(daw, turns, 40, 300, 5);
+  int8_t midway = daw.value[5];
+  runUntil(daw, turns, 40, 1000, 5);
+  printf("  SCALED, DAW a 96: tras 20 pasos DAW %d, tras 40 DAW %d local %d, recogida %s\n",
+         midway, daw.value[5], state().value[5], encoderManager.isPickupPending(5, 0) ? "sí" : "no");
+  CHECK(midway > 96 && midway < 127, "la salida escalada no avanzó desde 96 (%d)", midway);
+  CHECK(daw.value[5] == state().dawValue[5], "lo mostrado no es lo que tiene el DAW");
+}
+
+int main() {
+  hostMicros = 1000000;
+
+  printf("Ecos durante el toque\n");
+  lateEchoes();
+  turnBack();
+  dawOverride();
+  printf("Reenganche al soltar\n");
+  pickupAfterTouch();
+  jump();
+  scaled();
+
+  printf(failures ? "test_encoder_timeline: %d fallos\n" : "test_encoder_timeline: OK\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,221 @@
+// Realimentación secuenciada con un DAW simulado que pierde y desordena
+// mensajes: el controlador debe acabar con los valores del DAW y sin contar
+// dos veces los deltas relativos que siguen a sus propios envíos.
+// Compilar y ejecutar con extras/test/run_tests.sh
+
+#include "test_util.h"
+#include "encoder_host.h"
+
+#define STEP_US            250
+#define HEARTBEAT_MS       100
+#define HISTORY_SIZE       256
+
+// Mensaje en vuelo hacia el controlador (delta o fotograma clave)
+struct Packet {
+  uint32_t due;
+  bool keyframe;
+  ValueDeltaMessage delta;
+  BankStateMessage state;
+};
+
+struct DawPeer {
+  int16_t value[NUM_ENCODERS];
+  uint16_t lastSeq = FEEDBACK_SEQ_MASK;   // La primera secuencia es 0
+  ValueDeltaMessage history[HISTORY_SIZE];
+  uint32_t lastSent = 0;
+  uint8_t lossPercent = 0;
+  std::vector<Packet> inFlight;
+  uint32_t sent = 0, lost = 0, resent = 0, keyframes = 0;
+
+  DawPeer() { for (uint8_t i = 0; i < NUM_ENCODERS; i++) value[i] = 64; }
+
+  void deliver(Packet packet) {
+    sent++;
+    if (rnd(100) < lossPercent) { lost++; return; }
+    packet.due = hostMicros + 1000 + rnd(4000);   // 1-5 ms: llegan desordenados
+    inFlight.push_back(packet);
+  }
+
+  void emit(ValueDeltaMessage msg) {
+    lastSeq = (lastSeq + 1) & FEEDBACK_SEQ_MASK;
+    msg.bank = 0;
+    msg.seq = lastSeq;
+    history[lastSeq % HISTORY_SIZE] = msg;
+    lastSent = hostMicros;
+
+    Packet packet = {};
+    packet.delta = msg;
+    deliver(packet);
+  }
+
+  void emitChange(uint8_t track, int16_t newValue, bool absolute) {
+    newValue = constrain(newValue, 0, 127);
+    int16_t change = newValue - value[track];
+    if (change == 0 && !absolute) return;
+    value[track] = newValue;
+
+    ValueDeltaMessage msg = {};
+    msg.count = 1;
+    msg.deltas[0].track = track;
+    if (absolute) {
+      msg.deltas[0].flags = DELTA_ABSOLUTE;
+      msg.deltas[0].amount = newValue;
+    } else {
+      msg.deltas[0].flags = change < 0 ? DELTA_NEGATIVE : 0;
+      msg.deltas[0].amount = abs(change);
+    }
+    emit(msg);
+  }
+
+  // Automatización del DAW: relativos pequeños y algún absoluto
+  void automate() {
+    uint8_t track = rnd(NUM_ENCODERS);
+    emitChange(track, value[track] + (int16_t)rnd(13) - 6, rnd(8) == 0);
+  }
+
+  // El DAW toma el CC del controlador y lo devuelve como delta relativo
+  void onControlChange(const HostCC& cc) {
+    emitChange(cc.control - 20, cc.value, false);
+  }
+
+  void onRequest(const HostRequest& request) {
+    if (rnd(100) < lossPercent) { lost++; return; }
+    if (request.keyframe) {
+      Packet packet = {};
+      packet.keyframe = true;
+      packet.state.bank = 0;
+      packet.state.sections = BANK_STATE_VALUES | BANK_STATE_SEQ;
+      packet.state.trackMask = 0xFFFF;
+      for (uint8_t i = 0; i < NUM_ENCODERS; i++) packet.state.values[i] = value[i];
+      packet.state.seq = lastSeq;
+      keyframes++;
+      deliver(packet);
+      return;
+    }
+    for (uint16_t seq = request.fromSeq; ; seq = (seq + 1) & FEEDBACK_SEQ_MASK) {
+      Packet packet = {};
+      packet.delta = history[seq % HISTORY_SIZE];
+      resent++;
+      deliver(packet);
+      if (seq == request.toSeq) break;
+    }
+  }
+
+  void heartbeat() {
+    if (hostMicros - lastSent < HEARTBEAT_MS * 1000UL) return;
+    ValueDeltaMessage msg = {};
+    emit(msg);
+  }
+};
+
+// Lo que hace el sketch al recibir cada mensaje (syncBankStateFromDAW y
+// syncValueDeltaFromDAW)
+static void receive(const Packet& packet) {
+  if (packet.keyframe) {
+    encoderManager.applyBankState(packet.state);
+    feedbackManager.onKeyframe(packet.state.bank, packet.state.seq);
+  } else {
+    feedbackManager.onDelta(packet.delta);
+  }
+}
+
+// Una pasada del loop: entregas vencidas, salida de encoders y reintentos
+static void step(DawPeer& daw) {
+  hostMicros += STEP_US;
+
+  for (size_t i = 0; i < daw.inFlight.size();) {
+    if ((int32_t)(hostMicros - daw.inFlight[i].due) >= 0) {
+      Packet packet = daw.inFlight[i];
+      daw.inFlight.erase(daw.inFlight.begin() + i);
+      receive(packet);
+    } else {
+      i++;
+    }
+  }
+
+  encoderManager.updateOutput();
+  feedbackManager.update();
+
+  for (const HostCC& cc : hostSentCCs) daw.onControlChange(cc);
+  hostSentCCs.clear();
+  std::vector<HostRequest> requests;
+  requests.swap(hostRequests);
+  for (const HostRequest& request : requests) daw.onRequest(request);
+
+  daw.heartbeat();
+}
+
+static uint8_t mismatches(const DawPeer& daw) {
+  const EncoderBankState& state = encoderManager.getBankState(0);
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+    if (state.dawValue[i] != daw.value[i] || state.confirmedValue[i] != daw.value[i]) count++;
+  }
+  return count;
+}
+
+// Un giro local seguido del eco relativo del DAW: el valor mostrado es el
+// del DAW, no la predicción más el delta
+static void relativeEcho() {
+  hostSetupEncoders(TAKEOVER_FOLLOW);
+  DawPeer daw;
+  daw.onRequest({true, 0, 0, 0});
+  for (int i = 0; i < 40; i++) step(daw);
+
+  encoderManager.processEncoderChange(3, 5, 0, hostMicros);
+  for (int i = 0; i < 4000; i++) step(daw);   // 1 s: eco recibido y toque liberado
+
+  const EncoderBankState& state = encoderManager.getBankState(0);
+  printf("  giro +5 desde 64 -> DAW %d, mostrado %d, confirmado %d\n",
+         daw.value[3], state.dawValue[3], state.confirmedValue[3]);
+  CHECK(daw.value[3] == 69 && state.dawValue[3] == 69 && state.confirmedValue[3] == 69,
+        "el eco relativo se sumó a la predicción");
+}
+
+// Automatización y giros durante 'seconds' con pérdidas; después silencio
+// hasta converger
+static void lossyRun(uint8_t lossPercent, uint8_t seconds) {
+  hostSetupEncoders(TAKEOVER_FOLLOW);
+  DawPeer daw;
+  daw.lossPercent = lossPercent;
+
+  uint32_t end = hostMicros + seconds * 1000000UL;
+  while ((int32_t)(hostMicros - end) < 0) {
+    if (rnd(40) == 0) daw.automate();                 // ~100 cambios/s
+    if (rnd(400) == 0) {                              // ~10 giros/s
+      int8_t change = (int8_t)rnd(7) - 3;
+      if (change) encoderManager.processEncoderChange(rnd(NUM_ENCODERS), change, 0, hostMicros);
+    }
+    step(daw);
+  }
+
+  // Sin tráfico nuevo: solo latidos, reenvíos y fotogramas clave. Converge
+  // tras la última pasada con alguna pista distinta del DAW
+  uint32_t quietStart = hostMicros;
+  uint32_t converged = 0;
+  while (hostMicros - quietStart < 3000000UL) {
+    step(daw);
+    if (mismatches(daw)) converged = hostMicros - quietStart;
+  }
+
+  printf("  pérdida %2u%%: %lu mensajes, %lu perdidos, %lu reenviados, %lu fotogramas clave; "
+         "converge en %lu ms\n",
+         lossPercent, (unsigned long)daw.sent, (unsigned long)daw.lost, (unsigned long)daw.resent,
+         (unsigned long)daw.keyframes, (unsigned long)(converged / 1000));
+  CHECK(mismatches(daw) == 0, "%u pistas distintas del DAW", mismatches(daw));
+  CHECK(converged < 1000000UL, "sin converger en 1 s");
+}
+
+int main() {
+  rndSeed(0x2468ACE1);
+  printf("Eco relativo tras un giro local\n");
+  relativeEcho();
+
+  printf("DAW con pérdidas\n");
+  lossyRun(0, 5);
+  lossyRun(5, 5);
+  lossyRun(20, 5);
+
+  printf(failures ? "test_feedback_lossy: %d fallos\n" : "test_feedback_lossy: OK\n", failures);
+  return failures ? 1 : 0;
+}
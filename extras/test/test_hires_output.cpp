@@ -0,0 +1,118 @@
+// Salida de 7 frente a 14 bits con giro continuo: bytes por segundo de un
+// encoder en CC, par de CC, NRPN y pitch bend, con el MidiManager real. En
+// el par de CC y en NRPN el MSB solo sale cuando cambia y la selección de
+// parámetro NRPN no se repite mientras se mueve el mismo encoder.
+// Compilar y ejecutar con extras/test/run_tests.sh
+
+#include "test_util.h"
+#include "midi_host.h"
+
+#define LOOP_US          1000
+#define GESTURE_US       1000000
+#define DIN_BYTES_PER_S  3125    // 31250 baudios, 10 bits por byte
+
+struct Mode {
+  const char* name;
+  uint8_t controlType;
+  uint8_t resolution;
+};
+
+struct Count {
+  uint32_t bytes;
+  uint32_t msb;           // CC 7 o Data Entry MSB (6)
+  uint32_t lsb;           // CC 39 o Data Entry LSB (38)
+  uint32_t selects;       // CC 99/98
+  uint32_t repeatedMsb;   // MSB enviado con el mismo valor que el anterior
+};
+
+static Count rotate(const Mode& mode, uint32_t detentUs) {
+  hostSetupMidi(0);
+  hostMicros = 1000000;
+  EncoderConfig& config = encoderManager.getEncoderConfigMutable(0, 0);
+  config.controlType = mode.controlType;
+  config.resolution = mode.resolution;
+  config.control = 7;
+
+  // Ida y vuelta entre los topes a ritmo constante
+  int8_t direction = 1;
+  uint32_t start = hostMicros, nextDetent = hostMicros;
+  while (hostMicros - start < GESTURE_US) {
+    while ((int32_t)(hostMicros - nextDetent) >= 0) {
+      uint8_t value = encoderManager.getEncoderDAWValue(0, 0);
+      if (value >= 127) direction = -1;
+      else if (value == 0) direction = 1;
+      encoderManager.processEncoderChange(0, direction, 0, nextDetent);
+      nextDetent += detentUs;
+    }
+    encoderManager.updateOutput();
+    midiManager.processMidiOutput();
+    hostMicros += LOOP_US;
+  }
+
+  Count count = {};
+  int16_t lastMsb = -1;
+  for (const HostUsbWrite& write : hostUsbWrites) {
+    count.bytes += 3;
+    if ((write.status & 0xF0) != 0xB0) continue;
+    bool nrpn = mode.resolution == RES_NRPN;
+    if (write.data1 == CC_NRPN_MSB || write.data1 == CC_NRPN_LSB) {
+      count.selects++;
+    } else if (write.data1 == (nrpn ? CC_DATA_ENTRY_MSB : 7)) {
+      count.msb++;
+      if (write.data2 == lastMsb) count.repeatedMsb++;
+      lastMsb = write.data2;
+    } else if (write.data1 == (nrpn ? CC_DATA_ENTRY_LSB : 7 + CC_LSB_OFFSET)) {
+      count.lsb++;
+    }
+  }
+  return count;
+}
+
+int main() {
+  rndSeed(0x0B17E035);
+  MidiManager::registerUsbInterface();
+
+  const Mode modes[] = {
+    {"CC 7 bits", CT_CC, RES_7BIT},
+    {"par de CC", CT_CC, RES_14BIT_CC},
+    {"NRPN", CT_CC, RES_NRPN},
+    {"bend 7 bits", CT_PITCH, RES_7BIT},
+    {"bend 14 bits", CT_PITCH, RES_14BIT_CC},
+  };
+  static const uint32_t speeds[] = {10000, 1000};   // Un paso cada 10 ms y cada ms
+
+  for (uint32_t detentUs : speeds) {
+    printf("Giro continuo, un paso cada %u ms\n", detentUs / 1000);
+    uint32_t bytes7 = 0;
+    for (const Mode& mode : modes) {
+      Count count = rotate(mode, detentUs);
+      uint32_t fields[16];
+      encoderManager.getDiagnostics(fields);
+      uint32_t detents = GESTURE_US / detentUs;
+      bool hiRes = mode.resolution != RES_7BIT;
+      if (mode.controlType == CT_CC && !hiRes) bytes7 = count.bytes;
+
+      printf("  %-13s %6u bytes/s (%5.1f%% de DIN, %.2f por paso)", mode.name, count.bytes,
+             100.0 * count.bytes / DIN_BYTES_PER_S, (double)count.bytes / detents);
+      if (mode.controlType == CT_CC && hiRes) {
+        printf(" | MSB %u, LSB %u, selecciones %u | x%.2f frente a 7 bits", count.msb, count.lsb,
+               count.selects, (double)count.bytes / bytes7);
+      }
+      printf("\n");
+
+      CHECK(count.bytes == fields[hiRes ? 4 : 3], "%s: %u bytes escritos y %u contados por el encoder",
+            mode.name, count.bytes, fields[hiRes ? 4 : 3]);
+      if (mode.controlType != CT_CC || !hiRes) continue;
+
+      // Con HIRES_STEP el MSB cambia cada 128 / 16 pasos; el LSB en cada uno
+      CHECK(count.repeatedMsb == 0, "%s: %u MSB repetidos", mode.name, count.repeatedMsb);
+      CHECK(count.lsb >= detents * 9 / 10 && count.msb <= count.lsb * HIRES_STEP / 128 + 2,
+            "%s: %u MSB para %u LSB", mode.name, count.msb, count.lsb);
+      CHECK(count.selects == (mode.resolution == RES_NRPN ? 2u : 0u), "%s: %u mensajes de selección NRPN",
+            mode.name, count.selects);
+    }
+  }
+
+  printf(failures ? "test_hires_output: %d fallos\n" : "test_hires_output: OK\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,173 @@
+// Latencia encoder -> USB: interrupciones sintéticas con su marca de
+// tiempo, el loop modelado (lectura I2C por puerto, updateOutput(),
+// processMidiOutput() y dibujado de pantalla) y el histograma del firmware
+// comparado con la latencia exacta de cada escritura en TinyUSB.
+// Compilar y ejecutar con extras/test/run_tests.sh
+
+#include "test_util.h"
+#include "midi_host.h"
+#include "LatencyHistogram.h"
+#include <algorithm>
+
+// ---- Modelo del loop: tiempos supuestos del ESP32-S3
+#define LOOP_US          1000    // Ritmo del loop
+#define I2C_READ_US      150     // Lectura de un puerto del MCP23017
+#define PORTS            4       // 4 encoders por puerto
+#define DRAW_US          3000    // Frame de pantalla completo
+#define DRAW_PERIOD_US   40000
+
+struct Scenario {
+  const char* name;
+  uint8_t outputRate;       // Mensajes USB por ms (0 = sin límite)
+  uint8_t encoders;         // Encoders girando a la vez
+  uint32_t detentUs;        // Intervalo entre pasos de cada encoder
+  bool drawing;
+  // Cota del modelo: esperar al loop, leer los puertos y, con varios
+  // encoders, la vuelta del turno de salida y el frame en curso
+  uint32_t maxBoundUs;
+};
+
+struct Result {
+  std::vector<uint32_t> exact;
+  const LatencyHistogram* histogram;
+};
+
+static uint32_t exactPercentile(std::vector<uint32_t> values, uint8_t pct) {
+  std::sort(values.begin(), values.end());
+  uint32_t target = ((uint64_t)values.size() * pct + 99) / 100;
+  return values[target ? target - 1 : 0];
+}
+
+// Ráfagas de 60 pasos por encoder en un solo sentido (sin llegar a los
+// topes, así cada entrega cambia el valor y produce una escritura)
+static Result run(const Scenario& scenario) {
+  hostSetupMidi(scenario.outputRate);
+  hostMicros = 1000000;
+
+  uint32_t nextDetent[NUM_ENCODERS];
+  int8_t direction[NUM_ENCODERS];
+  int8_t pendingChange[NUM_ENCODERS] = {};
+  uint32_t portStamp[PORTS] = {};
+  uint32_t oldest[NUM_ENCODERS] = {};
+  uint8_t detentsLeft[NUM_ENCODERS] = {};
+  uint32_t nextDraw = hostMicros + DRAW_PERIOD_US;
+  Result result;
+
+  const uint8_t bursts = 8;
+  for (uint8_t burst = 0; burst < bursts; burst++) {
+    for (uint8_t i = 0; i < scenario.encoders; i++) {
+      direction[i] = encoderManager.getEncoderDAWValue(i, 0) < 64 ? 1 : -1;
+      detentsLeft[i] = 60;
+      nextDetent[i] = hostMicros + rnd(scenario.detentUs);
+    }
+
+    size_t seen = hostUsbWrites.size();
+    for (;;) {
+      uint32_t loopStart = hostMicros;
+
+      // Pasos ocurridos hasta ahora; cada puerto conserva el primero
+      bool active = false;
+      for (uint8_t i = 0; i < scenario.encoders; i++) {
+        while (detentsLeft[i] && (int32_t)(hostMicros - nextDetent[i]) >= 0) {
+          uint8_t port = i / (NUM_ENCODERS / PORTS);
+          if (!portStamp[port]) portStamp[port] = nextDetent[i];
+          pendingChange[i] += direction[i];
+          detentsLeft[i]--;
+          nextDetent[i] += scenario.detentUs / 2 + rnd(scenario.detentUs);
+        }
+        if (detentsLeft[i]) active = true;
+      }
+
+      // Lectura de los puertos con interrupción y entrega de los cambios
+      for (uint8_t port = 0; port < PORTS; port++) {
+        if (!portStamp[port]) continue;
+        hostMicros += I2C_READ_US;
+        for (uint8_t i = port * 4; i < port * 4 + 4; i++) {
+          if (!pendingChange[i]) continue;
+          if (!oldest[i]) oldest[i] = portStamp[port];
+          encoderManager.processEncoderChange(i, pendingChange[i], 0, portStamp[port]);
+          pendingChange[i] = 0;
+        }
+        portStamp[port] = 0;
+      }
+
+      encoderManager.updateOutput();
+      midiManager.processMidiOutput();
+
+      // Latencia exacta: desde el paso más antiguo aún no enviado
+      for (; seen < hostUsbWrites.size(); seen++) {
+        const HostUsbWrite& write = hostUsbWrites[seen];
+        uint8_t i = write.data1 - 20;
+        if ((write.status & 0xF0) != 0xB0 || i >= NUM_ENCODERS || !oldest[i]) continue;
+        result.exact.push_back(write.micros - oldest[i]);
+        oldest[i] = 0;
+      }
+
+      if (scenario.drawing && (int32_t)(hostMicros - nextDraw) >= 0) {
+        hostMicros += DRAW_US;
+        nextDraw += DRAW_PERIOD_US;
+      }
+      if (hostMicros - loopStart < LOOP_US) hostMicros = loopStart + LOOP_US;
+
+      bool waiting = false;
+      for (uint8_t i = 0; i < NUM_ENCODERS; i++) waiting |= oldest[i] != 0;
+      if (!active && !waiting) break;
+    }
+    hostMicros += 50000;   // Pausa entre ráfagas
+  }
+
+  result.histogram = &midiManager.getOutputLatency();
+  return result;
+}
+
+static void check(const Scenario& scenario) {
+  Result result = run(scenario);
+  const LatencyHistogram& histogram = *result.histogram;
+  static const uint8_t pcts[] = {50, 95, 99};
+
+  printf("  %-22s %5lu envíos | p50 %5u (%5u) | p95 %5u (%5u) | p99 %5u (%5u) | máx %5u us (cota %u)\n",
+         scenario.name, (unsigned long)histogram.getCount(), histogram.percentile(50),
+         exactPercentile(result.exact, 50), histogram.percentile(95), exactPercentile(result.exact, 95),
+         histogram.percentile(99), exactPercentile(result.exact, 99), histogram.getMax(), scenario.maxBoundUs);
+
+  CHECK(histogram.getCount() == result.exact.size() && !result.exact.empty(),
+        "%s: %lu registros en el histograma, %zu escrituras", scenario.name,
+        (unsigned long)histogram.getCount(), result.exact.size());
+  // El percentil del histograma es el límite superior de su cubo: nunca
+  // por debajo del exacto y, con 4 cubos por octava, como mucho un 25% más
+  for (uint8_t pct : pcts) {
+    uint32_t exact = exactPercentile(result.exact, pct);
+    uint32_t reported = histogram.percentile(pct);
+    CHECK(reported >= exact && reported <= exact + exact / 4 + 3, "%s: p%u de %u us frente a %u exactos",
+          scenario.name, pct, reported, exact);
+  }
+  uint32_t exactMax = *std::max_element(result.exact.begin(), result.exact.end());
+  CHECK(histogram.getMax() == exactMax, "%s: máximo %u frente a %u", scenario.name, histogram.getMax(), exactMax);
+  CHECK(histogram.getMax() <= scenario.maxBoundUs, "%s: máximo de %u us por encima de la cota de %u",
+        scenario.name, histogram.getMax(), scenario.maxBoundUs);
+  CHECK(histogram.percentile(50) <= histogram.percentile(95) &&
+        histogram.percentile(95) <= histogram.percentile(99) && histogram.percentile(99) <= histogram.getMax(),
+        "%s: percentiles desordenados", scenario.name);
+}
+
+int main() {
+  rndSeed(0x1A7E0043);
+  MidiManager::registerUsbInterface();
+
+  // Cotas: hasta un loop de espera más la lectura de los cuatro puertos;
+  // con 16 encoders, además una vuelta del turno de salida (8 de crédito
+  // por pasada sin límite; 16 / rate ms con él) y, dibujando, un frame
+  const uint32_t wait = LOOP_US + PORTS * I2C_READ_US;
+  const Scenario scenarios[] = {
+    {"giro lento", 0, 1, 20000, false, wait},
+    {"16 encoders sin límite", 0, 16, 1000, false, wait + 2 * LOOP_US},
+    {"16 encoders a 4 msg/ms", 4, 16, 1000, false, wait + (16 / 4) * LOOP_US},
+    {"16 encoders y pantalla", 4, 16, 1000, true, wait + (16 / 4) * LOOP_US + DRAW_US},
+  };
+
+  printf("Latencia encoder -> USB: histograma (exacta)\n");
+  for (const Scenario& scenario : scenarios) check(scenario);
+
+  printf(failures ? "test_latency: %d fallos\n" : "test_latency: OK\n", failures);
+  return failures ? 1 : 0;
+}
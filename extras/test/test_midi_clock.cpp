@@ -0,0 +1,134 @@
+// Reloj MIDI con jitter: tempo estable, cambio de tempo, silencio y posición.
+// Compilar y ejecutar con extras/test/run_tests.sh
+
+#include "test_util.h"
+#include "MidiClock.h"
+
+// xorshift32: la misma secuencia en cada ejecución
+// Llegada de un reloj enviado en 'sent': el host lo entrega en el siguiente
+// frame USB de 1 ms más hasta 300 us de planificación; uno de cada veinte se
+// retrasa hasta 4 ms y el siguiente puede llegar agrupado con él. Con
+// loopPoll la marca es además la siguiente pasada del loop (2-10 ms).
+struct ClockFeed {
+  uint32_t lastArrival = 0;
+  bool loopPoll = false;
+
+  uint32_t arrival(uint32_t sent) {
+    uint32_t t = (sent / 1000 + 1) * 1000 + rnd(300);
+    if (rnd(20) == 0) t += 1000 + rnd(3000);
+    if (loopPoll) t += 2000 + rnd(8000);
+    if (t < lastArrival) t = lastArrival;   // El orden se conserva
+    lastArrival = t;
+    return t;
+  }
+};
+
+struct Run {
+  int minBpmX10 = 1 << 30;
+  int maxBpmX10 = 0;
+};
+
+// Envía 'clocks' relojes a 'bpm' desde 'start' y mide el tempo tras cada uno
+// a partir de 'settle' relojes
+static uint32_t feed(MidiClock& clock, ClockFeed& source, double bpm, uint32_t start,
+                     int clocks, int settle, Run& run) {
+  double period = 60e6 / (bpm * CLOCK_PPQN);
+  uint32_t sent = start;
+  for (int k = 0; k < clocks; k++) {
+    sent = start + (uint32_t)(k * period);
+    hostMicros = source.arrival(sent);
+    clock.onClock(hostMicros);
+    if (k >= settle) {
+      int bpmX10 = clock.getData().bpmX10;
+      run.minBpmX10 = min(run.minBpmX10, bpmX10);
+      run.maxBpmX10 = max(run.maxBpmX10, bpmX10);
+    }
+  }
+  return sent + (uint32_t)period;
+}
+
+// Tolerancia en milésimas del tempo
+static void steadyTempo(double bpm, bool loopPoll, int permille) {
+  MidiClock clock;
+  ClockFeed source;
+  source.loopPoll = loopPoll;
+  Run run;
+
+  feed(clock, source, bpm, 1000000, CLOCK_PPQN * 64, CLOCK_AVERAGE_INTERVALS, run);
+  int expected = (int)lround(bpm * 10);
+  int toleranceX10 = max(1, (int)lround(bpm * 10 * permille / 1000.0));
+  printf("  %5.1f BPM %-12s -> %5.1f .. %5.1f\n", bpm, loopPoll ? "(loop)" : "(recepción)",
+         run.minBpmX10 / 10.0, run.maxBpmX10 / 10.0);
+  CHECK(run.minBpmX10 >= expected - toleranceX10 && run.maxBpmX10 <= expected + toleranceX10,
+        "%.1f BPM fuera de +-%.1f", bpm, toleranceX10 / 10.0);
+}
+
+static void tempoChange() {
+  MidiClock clock;
+  ClockFeed source;
+  Run warmup, after;
+
+  uint32_t t = feed(clock, source, 120, 1000000, CLOCK_PPQN * 8, 0, warmup);
+  // Media negra para reengancharse; desde la tercera negra sin restos del
+  // tempo anterior y con una ventana ya larga (±1%)
+  feed(clock, source, 150, t, CLOCK_PPQN * 8, CLOCK_PPQN * 2, after);
+  printf("  120 -> 150 BPM, desde la 3a negra -> %5.1f .. %5.1f\n",
+         after.minBpmX10 / 10.0, after.maxBpmX10 / 10.0);
+  CHECK(after.minBpmX10 >= 1485 && after.maxBpmX10 <= 1515, "no se enganchó al tempo nuevo");
+}
+
+static void silence() {
+  MidiClock clock;
+  ClockFeed source;
+  Run run;
+
+  uint32_t t = feed(clock, source, 120, 1000000, CLOCK_PPQN * 4, 0, run);
+  CHECK(clock.getData().bpmX10 > 0, "sin tempo tras cuatro negras");
+  hostMicros = t + CLOCK_TIMEOUT_US;
+  CHECK(clock.getData().bpmX10 == 0, "el tempo sigue tras 0,5 s sin reloj");
+
+  // Al volver el reloj no se mezcla el hueco con el tempo nuevo
+  Run resumed;
+  feed(clock, source, 90, hostMicros + 100000, CLOCK_PPQN * 4, CLOCK_MIN_INTERVALS, resumed);
+  printf("  reanuda a 90 BPM tras silencio -> %5.1f .. %5.1f\n",
+         resumed.minBpmX10 / 10.0, resumed.maxBpmX10 / 10.0);
+  CHECK(resumed.minBpmX10 >= 880 && resumed.maxBpmX10 <= 920, "tempo erróneo tras el silencio");
+}
+
+static void position() {
+  MidiClock clock;
+  ClockFeed source;
+  Run run;
+
+  clock.onSongPosition(16);   // Compás 2
+  clock.onContinue();
+  // El primer reloj tras Continue marca la posición; 4 negras más = compás 3
+  feed(clock, source, 120, 1000000, CLOCK_PPQN * 4 + 1, 0, run);
+  const ClockData& data = clock.getData();
+  printf("  SPP 16 + 4 negras -> %lu.%u.%u\n", (unsigned long)data.bar, data.beat, data.sixteenth);
+  CHECK(data.bar == 3 && data.beat == 1 && data.sixteenth == 1, "posición errónea");
+}
+
+int main() {
+  rndSeed(0x12345678);
+  Serial.quiet = true;
+
+  // Marcando al recibir el paquete el error es el jitter de los extremos
+  // entre la ventana (4 negras); marcando en el loop se suma su retraso
+  printf("Tempo estable con jitter USB\n");
+  steadyTempo(60, false, 5);
+  steadyTempo(120, false, 5);
+  steadyTempo(200, false, 5);
+  printf("Tempo estable marcando en el loop\n");
+  steadyTempo(120, true, 10);
+
+  printf("Cambio de tempo\n");
+  tempoChange();
+  printf("Silencio\n");
+  silence();
+  printf("Posición\n");
+  position();
+
+  printf(failures ? "test_midi_clock: %d fallos\n" : "test_midi_clock: OK\n", failures);
+  return failures ? 1 : 0;
+}
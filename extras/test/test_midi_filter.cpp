@@ -0,0 +1,185 @@
+// Filtro MIDI compilado: 50 reglas (primera coincidencia, remapeo de canal
+// y primer byte, escalado sin tocar Note On a velocidad 0 y pitch bend a
+// 14 bits), carga desde una SD simulada y mensajes por segundo en el PC.
+// Compilar y ejecutar con extras/test/run_tests.sh
+
+#include "test_util.h"
+#include "MidiFilter.h"
+#include "FileManager.h"
+#include <chrono>
+#include <set>
+#include <string>
+#include <vector>
+
+// ---- SD en memoria: solo el fichero de reglas
+static std::string rulesFile;
+
+FileManager::FileManager() : sdInitialized(true), sdCardPresent(true), totalSpace(0), freeSpace(0) {}
+FileManager::~FileManager() {}
+
+bool FileManager::fileExists(const char* filename) {
+  return strcmp(filename, MIDI_FILTER_FILENAME) == 0 && !rulesFile.empty();
+}
+
+bool FileManager::readFile(const char* filename, void* data, size_t maxSize, size_t* actualSize) {
+  if (!fileExists(filename) || rulesFile.size() > maxSize) return false;
+  memcpy(data, rulesFile.data(), rulesFile.size());
+  if (actualSize) *actualSize = rulesFile.size();
+  return true;
+}
+
+FileManager fileManager;
+
+typedef std::chrono::steady_clock Clock;
+
+// Las reglas que se comprueban van primero; el resto completa las 50 con
+// reglas uniformes por estado (sin tablas de primer byte)
+static std::string buildRules() {
+  std::string text =
+    "# Reglas de prueba\n"
+    "remap cc 1 10-20 d1=30      # gana a la siguiente en 10-20\n"
+    "drop cc 1 *\n"
+    "remap note 2 * ch=5\n"
+    "scale noteon 3 * min=20 max=100\n"
+    "scale bend 4 * min=32 max=96\n"
+    "thru cc 5 64-69\n"
+    "scale cc 6 7 min=0 max=100 thru\n";
+  char line[48];
+  for (uint8_t ch = 1; ch <= 16; ch++) {
+    snprintf(line, sizeof(line), "drop poly %u *\n", ch);
+    text += line;
+  }
+  for (uint8_t ch = 1; ch <= 16; ch++) {
+    snprintf(line, sizeof(line), "thru press %u *\n", ch);
+    text += line;
+  }
+  for (uint8_t ch = 1; ch <= 11; ch++) {
+    snprintf(line, sizeof(line), "pass pc %u *\n", ch);
+    text += line;
+  }
+  return text;
+}
+
+struct Message {
+  uint8_t status, data1, data2;
+};
+
+static uint8_t run(MidiFilter& filter, Message& msg) {
+  return filter.apply(msg.status, msg.data1, msg.data2);
+}
+
+static void rules(MidiFilter& filter) {
+  Message msg;
+
+  // Primera coincidencia: el remapeo de 10-20 antes que el descarte del canal
+  msg = {0xB0, 15, 99};
+  uint8_t flags = run(filter, msg);
+  CHECK(!(flags & FILTER_DROP) && (flags & FILTER_DATA1) && msg.data1 == 30 && msg.data2 == 99,
+        "CC 15 canal 1: flags %02X, CC %u", flags, msg.data1);
+  msg = {0xB0, 21, 99};
+  CHECK(run(filter, msg) & FILTER_DROP, "CC 21 canal 1 no se descarta");
+
+  // Canal: nota del 2 al 5 con nota y velocidad intactas
+  msg = {0x91, 60, 90};
+  run(filter, msg);
+  CHECK(msg.status == 0x94 && msg.data1 == 60 && msg.data2 == 90, "Note On canal 2 -> %02X %u %u",
+        msg.status, msg.data1, msg.data2);
+  msg = {0x81, 60, 64};
+  run(filter, msg);
+  CHECK(msg.status == 0x84, "Note Off canal 2 -> %02X", msg.status);
+
+  // Escalado de velocidad; a 0 sigue siendo Note Off
+  msg = {0x92, 60, 127};
+  run(filter, msg);
+  CHECK(msg.data2 == 100, "velocidad 127 -> %u", msg.data2);
+  msg = {0x92, 60, 1};
+  run(filter, msg);
+  CHECK(msg.data2 == 21, "velocidad 1 -> %u", msg.data2);
+  msg = {0x92, 60, 0};
+  run(filter, msg);
+  CHECK(msg.status == 0x92 && msg.data2 == 0, "Note On a velocidad 0 -> %02X %u", msg.status, msg.data2);
+
+  // Pitch bend: rango 32-96 en MSB, sin perder los 14 bits
+  std::set<uint16_t> outputs;
+  uint16_t previous = 0;
+  bool monotonic = true;
+  for (uint16_t value = 0; value < 16384; value++) {
+    msg = {0xE3, (uint8_t)(value & 0x7F), (uint8_t)(value >> 7)};
+    run(filter, msg);
+    uint16_t scaled = msg.data1 | (msg.data2 << 7);
+    if (value && scaled < previous) monotonic = false;
+    previous = scaled;
+    outputs.insert(scaled);
+  }
+  uint16_t low = *outputs.begin(), high = *outputs.rbegin();
+  printf("  pitch bend 0-16383 -> %u-%u, %zu valores distintos\n", low, high, outputs.size());
+  uint16_t expectedHigh = (32 << 7) + 16383 * (96 - 32) / 127;
+  CHECK(low == 32 << 7 && high == expectedHigh, "rango %u-%u, se esperaba %u-%u", low, high, 32 << 7,
+        expectedHigh);
+  CHECK(monotonic && outputs.size() > 128 * 32, "escalado del bend a 7 bits o no monótono");
+
+  // Solo los CC 64-69 del canal 5 se reenvían; el CC 7 del 6 escala y reenvía
+  msg = {0xB4, 64, 127};
+  CHECK(run(filter, msg) == FILTER_THRU && msg.data2 == 127, "sustain canal 5 sin thru");
+  msg = {0xB4, 70, 127};
+  CHECK(run(filter, msg) == 0, "CC 70 canal 5 con regla");
+  msg = {0xB5, 7, 127};
+  flags = run(filter, msg);
+  CHECK((flags & FILTER_THRU) && msg.data2 == 100, "volumen canal 6 -> %u", msg.data2);
+
+  // Relleno y sin regla
+  msg = {0xA9, 60, 10};
+  CHECK(run(filter, msg) == FILTER_DROP, "poly canal 10 no se descarta");
+  msg = {0xDF, 50, 0};
+  CHECK(run(filter, msg) == FILTER_THRU && msg.data1 == 50, "presión canal 16 sin thru");
+  msg = {0xCF, 5, 0};
+  CHECK(run(filter, msg) == 0 && msg.status == 0xCF && msg.data1 == 5, "Program Change canal 16 alterado");
+  msg = {0xF8, 0, 0};
+  CHECK(run(filter, msg) == 0, "tiempo real filtrado");
+}
+
+// Mensajes de canal al azar, cada uno copiado antes de aplicar
+static void benchmark(MidiFilter& filter) {
+  std::vector<Message> pool(4096);
+  for (Message& msg : pool) {
+    msg = {(uint8_t)(0x80 + rnd(MIDI_FILTER_STATUS_COUNT)), (uint8_t)rnd(128), (uint8_t)rnd(128)};
+  }
+
+  const uint32_t rounds = 2000;
+  uint32_t dropped = 0;
+  Clock::time_point start = Clock::now();
+  for (uint32_t round = 0; round < rounds; round++) {
+    for (const Message& source : pool) {
+      Message msg = source;
+      dropped += run(filter, msg) & FILTER_DROP;
+    }
+  }
+  double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+  double perSecond = rounds * pool.size() / seconds;
+  printf("  %u reglas: %.0f M mensajes/s (%.1f ns por mensaje), %u descartados\n", filter.getRuleCount(),
+         perSecond / 1e6, 1e9 / perSecond, dropped);
+  CHECK(dropped > 0, "ningún mensaje descartado");
+}
+
+int main() {
+  rndSeed(0x5EED0040);
+  Serial.quiet = true;
+  MidiFilter filter;
+
+  printf("Reglas\n");
+  rulesFile = buildRules();
+  CHECK(filter.loadRules(), "las reglas no compilan");
+  CHECK(filter.getRuleCount() == 50, "%u reglas compiladas", filter.getRuleCount());
+  rules(filter);
+
+  std::string broken = "drop cc 1 *\nremap cc 2 *\n";   // remap sin destino
+  CHECK(!filter.compile(&broken[0]) && filter.getRuleCount() == 1, "regla no válida aceptada");
+
+  printf("Coste en el PC\n");
+  rulesFile = buildRules();
+  filter.loadRules();
+  benchmark(filter);
+
+  printf(failures ? "test_midi_filter: %d fallos\n" : "test_midi_filter: OK\n", failures);
+  return failures ? 1 : 0;
+}
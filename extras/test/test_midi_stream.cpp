@@ -0,0 +1,198 @@
+// MidiStreamParser y MidiStreamWriter: ida y vuelta de mensajes aleatorios
+// con running status, tiempo real intercalado y SysEx, y bytes al azar sin
+// que el parser entregue nada malformado ni pierda la sincronía.
+// Compilar y ejecutar con extras/test/run_tests.sh
+
+#include "test_util.h"
+#include "MidiStream.h"
+#include <vector>
+
+#define SYSEX_CAPACITY  64
+
+struct Message {
+  uint8_t status;
+  uint8_t data1;
+  uint8_t data2;
+  std::vector<uint8_t> sysEx;
+
+  bool operator==(const Message& other) const {
+    return status == other.status && data1 == other.data1 && data2 == other.data2 && sysEx == other.sysEx;
+  }
+};
+
+// Lo que debe salir del parser: el writer manda Note Off a 64 como Note On
+// a 0 si así conserva el running status, y ambos significan lo mismo
+static Message normalized(Message msg) {
+  if ((msg.status & 0xF0) == 0x90 && msg.data2 == 0) {
+    msg.status = 0x80 | (msg.status & 0x0F);
+    msg.data2 = 0x40;
+  }
+  return msg;
+}
+
+static Message randomMessage() {
+  Message msg = {};
+  uint32_t kind = rnd(20);
+  if (kind < 14) {
+    // Canal: pocas combinaciones para que el running status aparezca a menudo
+    static const uint8_t types[] = {0x80, 0x90, 0x90, 0xB0, 0xB0, 0xC0, 0xD0, 0xE0, 0xA0};
+    msg.status = types[rnd(sizeof(types))] | rnd(3);
+    msg.data1 = rnd(128);
+    msg.data2 = MidiStreamParser::dataLength(msg.status) > 1 ? rnd(128) : 0;
+    if ((msg.status & 0xF0) == 0x80 && rnd(2)) msg.data2 = 0x40;
+  } else if (kind < 17) {
+    static const uint8_t common[] = {0xF1, 0xF2, 0xF3, 0xF6};
+    msg.status = common[rnd(sizeof(common))];
+    uint8_t length = MidiStreamParser::dataLength(msg.status);
+    msg.data1 = length > 0 ? rnd(128) : 0;
+    msg.data2 = length > 1 ? rnd(128) : 0;
+  } else {
+    msg.status = 0xF0;
+    msg.sysEx.push_back(0xF0);
+    uint16_t length = rnd(SYSEX_CAPACITY - 1);
+    for (uint16_t i = 0; i < length; i++) msg.sysEx.push_back(rnd(128));
+    msg.sysEx.push_back(0xF7);
+  }
+  return msg;
+}
+
+// En un SysEx solo cuentan sysEx/sysExLength; data1 y data2 no se tocan
+static Message received(const MidiStreamMessage& msg) {
+  if (msg.status == 0xF0) return {msg.status, 0, 0, {msg.sysEx, msg.sysEx + msg.sysExLength}};
+  return {msg.status, msg.data1, msg.data2, {}};
+}
+
+// Mensajes aleatorios codificados con el writer, con relojes y demás tiempo
+// real intercalados entre cualquier par de bytes; el parser devuelve los
+// mismos mensajes en el mismo orden y el tiempo real aparte
+static void roundTrip(uint32_t count) {
+  uint8_t sysExBuffer[SYSEX_CAPACITY];
+  MidiStreamParser parser(sysExBuffer, sizeof(sysExBuffer));
+  MidiStreamWriter writer;
+  std::vector<Message> sent, got;
+  std::vector<uint8_t> stream, realtimeSent, realtimeGot;
+
+  for (uint32_t i = 0; i < count; i++) {
+    Message msg = randomMessage();
+    sent.push_back(normalized(msg));
+    if (msg.status == 0xF0) {
+      writer.resetRunningStatus();
+      stream.insert(stream.end(), msg.sysEx.begin(), msg.sysEx.end());
+      writer.countBytes(msg.sysEx.size());
+    } else {
+      uint8_t out[3];
+      uint8_t length = writer.encode(msg.status, msg.data1, msg.data2, out);
+      stream.insert(stream.end(), out, out + length);
+    }
+  }
+
+  uint32_t channelBytes = 0;
+  for (const Message& msg : sent) {
+    if (msg.status < 0xF0) channelBytes += 1 + MidiStreamParser::dataLength(msg.status);
+  }
+
+  MidiStreamMessage parsed;
+  for (uint8_t byte : stream) {
+    if (rnd(10) == 0) {
+      static const uint8_t realtime[] = {0xF8, 0xFA, 0xFB, 0xFC, 0xFE, 0xFF};
+      uint8_t rt = realtime[rnd(sizeof(realtime))];
+      realtimeSent.push_back(rt);
+      if (parser.parse(rt, parsed)) realtimeGot.push_back(parsed.status);
+    }
+    if (parser.parse(byte, parsed)) got.push_back(received(parsed));
+  }
+
+  size_t matching = 0;
+  while (matching < sent.size() && matching < got.size() && normalized(got[matching]) == sent[matching]) {
+    matching++;
+  }
+  printf("  %lu mensajes, %lu bytes (%lu de estado ahorrados por running status), %lu de tiempo real\n",
+         (unsigned long)count, (unsigned long)stream.size(), (unsigned long)writer.getBytesSaved(),
+         (unsigned long)realtimeSent.size());
+  CHECK(got.size() == sent.size() && matching == sent.size(),
+        "%lu de %lu mensajes iguales (recibidos %lu)", (unsigned long)matching,
+        (unsigned long)sent.size(), (unsigned long)got.size());
+  CHECK(realtimeGot == realtimeSent, "tiempo real perdido o alterado");
+  CHECK(writer.getBytesSaved() > 0 && writer.getBytesSaved() < channelBytes, "sin running status");
+}
+
+// Lo que entregue el parser con bytes al azar tiene que ser un mensaje
+// válido, y tras la basura el primer mensaje con estado sale intacto
+static void fuzz(uint32_t rounds) {
+  uint8_t sysExBuffer[16];   // Pequeño para forzar desbordes
+  MidiStreamParser parser(sysExBuffer, sizeof(sysExBuffer));
+  uint32_t delivered = 0, malformed = 0, resyncFailures = 0;
+
+  for (uint32_t round = 0; round < rounds; round++) {
+    uint32_t length = 1 + rnd(64);
+    for (uint32_t i = 0; i < length; i++) {
+      // Sesgo hacia bytes de estado para recorrer todas las transiciones
+      uint8_t byte = rnd(3) == 0 ? 0x80 | rnd(128) : rnd(128);
+      MidiStreamMessage msg;
+      if (!parser.parse(byte, msg)) continue;
+      delivered++;
+
+      bool ok = msg.status >= 0x80 && msg.status != 0xF4 && msg.status != 0xF5 && msg.status != 0xF7;
+      if (msg.status == 0xF0) {
+        ok = ok && msg.sysEx == sysExBuffer && msg.sysExLength >= 2 &&
+             msg.sysExLength <= sizeof(sysExBuffer) && msg.sysEx[0] == 0xF0 &&
+             msg.sysEx[msg.sysExLength - 1] == 0xF7;
+        for (uint16_t j = 1; ok && j + 1 < msg.sysExLength; j++) ok = msg.sysEx[j] < 0x80;
+      } else {
+        uint8_t dataBytes = msg.status >= 0xF8 ? 0 : MidiStreamParser::dataLength(msg.status);
+        ok = ok && msg.data1 < 0x80 && msg.data2 < 0x80 &&
+             (dataBytes > 0 || msg.data1 == 0) && (dataBytes > 1 || msg.data2 == 0);
+      }
+      if (!ok) malformed++;
+    }
+
+    // Resincronización: un Control Change con su estado
+    const uint8_t cc[] = {0xB5, (uint8_t)rnd(128), (uint8_t)rnd(128)};
+    MidiStreamMessage msg;
+    bool complete = false;
+    for (uint8_t i = 0; i < sizeof(cc); i++) complete = parser.parse(cc[i], msg);
+    if (!complete || msg.status != cc[0] || msg.data1 != cc[1] || msg.data2 != cc[2]) resyncFailures++;
+  }
+
+  printf("  %lu rondas de basura: %lu mensajes entregados, %lu malformados, %lu sin resincronizar\n",
+         (unsigned long)rounds, (unsigned long)delivered, (unsigned long)malformed,
+         (unsigned long)resyncFailures);
+  CHECK(malformed == 0, "%lu mensajes malformados", (unsigned long)malformed);
+  CHECK(resyncFailures == 0, "%lu resincronizaciones fallidas", (unsigned long)resyncFailures);
+}
+
+// SysEx mayor que el buffer: se descarta entero y no arrastra al siguiente
+static void sysExOverflow() {
+  uint8_t sysExBuffer[8];
+  MidiStreamParser parser(sysExBuffer, sizeof(sysExBuffer));
+  MidiStreamMessage msg;
+  uint32_t delivered = 0;
+
+  parser.parse(0xF0, msg);
+  for (uint8_t i = 0; i < 20; i++) delivered += parser.parse(i, msg);
+  delivered += parser.parse(0xF7, msg);
+  CHECK(delivered == 0, "se entregó un SysEx desbordado");
+
+  const uint8_t fits[] = {0xF0, 0x7E, 0x01, 0x02, 0x03, 0x04, 0x05, 0xF7};
+  bool complete = false;
+  for (uint8_t byte : fits) complete = parser.parse(byte, msg);
+  printf("  SysEx de 22 bytes con buffer de 8: descartado; el siguiente de 8 %s\n",
+         complete ? "entregado" : "perdido");
+  CHECK(complete && msg.sysExLength == sizeof(fits) && memcmp(msg.sysEx, fits, sizeof(fits)) == 0,
+        "el SysEx que cabe no se entregó intacto");
+}
+
+int main() {
+  rndSeed(0x9E3779B9);
+  Serial.quiet = true;
+
+  printf("Ida y vuelta\n");
+  roundTrip(20000);
+  printf("Bytes al azar\n");
+  fuzz(20000);
+  printf("Desborde de SysEx\n");
+  sysExOverflow();
+
+  printf(failures ? "test_midi_stream: %d fallos\n" : "test_midi_stream: OK\n", failures);
+  return failures ? 1 : 0;
+}
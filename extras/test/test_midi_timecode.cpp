@@ -0,0 +1,153 @@
+// MIDI Time Code a 24, 25, 29,97 DF y 30 fps: cuartos de frame generados
+// en tiempo real, tiempo decodificado frame a frame (cambios de hora,
+// minutos con y sin descarte) y coste de CPU por frame en el PC.
+// Compilar y ejecutar con extras/test/run_tests.sh
+
+#include "test_util.h"
+#include "MidiTimecode.h"
+#include <chrono>
+
+static const char* rateName(uint8_t rate) {
+  switch (rate) {
+    case MTC_RATE_24: return "24";
+    case MTC_RATE_25: return "25";
+    case MTC_RATE_2997_DF: return "29.97DF";
+    default: return "30";
+  }
+}
+
+static double realFps(uint8_t rate) {
+  return rate == MTC_RATE_2997_DF ? 30000.0 / 1001.0 : MidiTimecode::nominalFps(rate);
+}
+
+// Etiquetas del generador, avanzadas a mano: independiente de la aritmética
+// de frames de MidiTimecode
+struct Label {
+  uint8_t hours, minutes, seconds, frames;
+};
+
+static void advance(Label& label, uint8_t rate) {
+  if (++label.frames < MidiTimecode::nominalFps(rate)) return;
+  label.frames = 0;
+  if (++label.seconds == 60) {
+    label.seconds = 0;
+    if (++label.minutes == 60) {
+      label.minutes = 0;
+      if (++label.hours == 24) label.hours = 0;
+    }
+  }
+  // Drop-frame: cada minuto empieza en el frame 2 salvo los múltiplos de 10
+  if (rate == MTC_RATE_2997_DF && label.seconds == 0 && label.minutes % 10 != 0) label.frames = 2;
+}
+
+static bool same(const MtcData& time, const Label& label) {
+  return time.hours == label.hours && time.minutes == label.minutes &&
+         time.seconds == label.seconds && time.frames == label.frames;
+}
+
+// Pieza 'piece' de la secuencia que codifica 'label'
+static uint8_t quarterFrame(uint8_t piece, const Label& label, uint8_t rate) {
+  uint8_t nibble = 0;
+  switch (piece) {
+    case 0: nibble = label.frames & 0x0F; break;
+    case 1: nibble = label.frames >> 4; break;
+    case 2: nibble = label.seconds & 0x0F; break;
+    case 3: nibble = label.seconds >> 4; break;
+    case 4: nibble = label.minutes & 0x0F; break;
+    case 5: nibble = label.minutes >> 4; break;
+    case 6: nibble = label.hours & 0x0F; break;
+    case 7: nibble = (label.hours >> 4) | (rate << 1); break;
+  }
+  return (piece << 4) | nibble;
+}
+
+// Reproduce 'seconds' desde 'start': tras enganchar, el tiempo mostrado en
+// cada cuarto de frame y a mitad de cada uno es el frame en curso
+static void playback(uint8_t rate, Label start, int seconds) {
+  MidiTimecode mtc;
+  Label current = start;
+  Label sequence = start;   // Tiempo que codifica la secuencia en curso
+  double quarterMicros = 1e6 / (realFps(rate) * MTC_QUARTERS_PER_FRAME);
+  uint32_t origin = hostMicros;
+  int quarters = (int)(seconds * realFps(rate)) * MTC_QUARTERS_PER_FRAME;
+  int checked = 0, wrong = 0, lockedAt = -1;
+  Label firstWrong = {};
+  MtcData shownWrong;
+  std::chrono::nanoseconds cost(0);
+
+  for (int k = 0; k < quarters; k++) {
+    uint8_t piece = k % MTC_PIECES;
+    if (piece == 0) sequence = current;
+    hostMicros = origin + (uint32_t)(k * quarterMicros);
+
+    auto t0 = std::chrono::steady_clock::now();
+    bool completed = mtc.onQuarterFrame(quarterFrame(piece, sequence, rate), hostMicros);
+    MtcData shown = mtc.getDisplayTime(0);
+    cost += std::chrono::steady_clock::now() - t0;
+
+    if (completed && lockedAt < 0) lockedAt = k;
+    if (lockedAt >= 0) {
+      hostMicros += (uint32_t)(quarterMicros / 2);
+      MtcData halfway = mtc.getDisplayTime(0);
+      checked++;
+      if (!same(shown, current) || !same(halfway, current) || shown.frameRate != rate || !shown.isRunning) {
+        if (!wrong++) { firstWrong = current; shownWrong = shown; }
+      }
+    }
+    if (piece % MTC_QUARTERS_PER_FRAME == MTC_QUARTERS_PER_FRAME - 1) advance(current, rate);
+  }
+
+  double nsPerFrame = (double)cost.count() / quarters * MTC_QUARTERS_PER_FRAME;
+  printf("  %-7s %02u:%02u:%02u:%02u -> %02u:%02u:%02u:%02u: enganche en %d cuartos, %d comprobados, "
+         "%d distintos, %.0f ns por frame\n", rateName(rate), start.hours, start.minutes, start.seconds,
+         start.frames, current.hours, current.minutes, current.seconds, current.frames, lockedAt + 1,
+         checked, wrong, nsPerFrame);
+  CHECK(lockedAt == MTC_PIECES - 1, "sin enganche tras la primera secuencia");
+  CHECK(wrong == 0, "se esperaba %02u:%02u:%02u:%02u y se mostró %02u:%02u:%02u:%02u",
+        firstWrong.hours, firstWrong.minutes, firstWrong.seconds, firstWrong.frames,
+        shownWrong.hours, shownWrong.minutes, shownWrong.seconds, shownWrong.frames);
+  // Cuatro cuartos de frame y sus lecturas: en el ESP32 cabe de sobra en
+  // un frame; en el PC solo se vigila que no haya un coste desmedido
+  CHECK(nsPerFrame < 20000, "coste por frame de %.0f ns", nsPerFrame);
+
+  // Sin cuartos de frame el transporte se da por parado
+  hostMicros += MTC_STOP_TIMEOUT_US;
+  CHECK(!mtc.getDisplayTime(0).isRunning, "sigue en marcha tras %u ms sin cuartos de frame",
+        MTC_STOP_TIMEOUT_US / 1000);
+}
+
+// Localización con mensaje de frame completo y offset de visualización
+static void locate(uint8_t rate, Label label, int8_t offset, Label expected) {
+  MidiTimecode mtc;
+  uint8_t frame[MTC_FULL_FRAME_SIZE] = {0xF0, 0x7F, 0x7F, 0x01, 0x01,
+                                        (uint8_t)((rate << 5) | label.hours), label.minutes,
+                                        label.seconds, label.frames, 0xF7};
+  bool accepted = mtc.onFullFrame(frame, sizeof(frame));
+  const MtcData& shown = mtc.getDisplayTime(offset);
+  printf("  %-7s %02u:%02u:%02u:%02u %+d -> %02u:%02u:%02u:%02u\n", rateName(rate), label.hours,
+         label.minutes, label.seconds, label.frames, offset, shown.hours, shown.minutes, shown.seconds,
+         shown.frames);
+  CHECK(accepted && same(shown, expected) && !shown.isRunning, "localización errónea");
+}
+
+int main() {
+  Serial.quiet = true;
+  hostMicros = 1000000;
+
+  printf("Reproducción\n");
+  playback(MTC_RATE_24, {0, 59, 58, 0}, 3);
+  playback(MTC_RATE_25, {12, 34, 56, 10}, 3);
+  playback(MTC_RATE_2997_DF, {0, 0, 58, 0}, 4);    // 00:01:00:02, con descarte
+  playback(MTC_RATE_2997_DF, {0, 9, 58, 0}, 4);    // 00:10:00:00, sin descarte
+  playback(MTC_RATE_30, {23, 59, 58, 0}, 3);       // Vuelta a 00:00:00:00
+
+  printf("Localización\n");
+  locate(MTC_RATE_24, {1, 0, 0, 0}, -1, {0, 59, 59, 23});
+  locate(MTC_RATE_25, {2, 30, 15, 24}, 1, {2, 30, 16, 0});
+  locate(MTC_RATE_2997_DF, {0, 1, 0, 2}, -1, {0, 0, 59, 29});
+  locate(MTC_RATE_2997_DF, {0, 10, 0, 0}, -1, {0, 9, 59, 29});
+  locate(MTC_RATE_30, {0, 0, 0, 0}, -1, {23, 59, 59, 29});
+
+  printf(failures ? "test_midi_timecode: %d fallos\n" : "test_midi_timecode: OK\n", failures);
+  return failures ? 1 : 0;
+}
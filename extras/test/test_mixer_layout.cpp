@@ -0,0 +1,121 @@
+// Disposición de la pantalla principal en las cuatro orientaciones y todas
+// las vistas: además de MixerScene::validate(), cada widget se pinta en un
+// framebuffer del PC para contar píxeles fuera de pantalla o pintados dos
+// veces, y se comprueba que los textos caben. Con MIXER_LAYOUT_DUMP=1 se
+// imprime cada disposición a 1/8 de escala.
+// Compilar y ejecutar con extras/test/run_tests.sh
+
+#include "test_util.h"
+#include "MixerScene.h"
+#include "SmoothFont.h"
+#include <vector>
+
+static const char* const orientationNames[] = {"0", "90", "180", "270"};
+static const char* const viewNames[VIEW_COUNT] = {"8 tiras", "16 tiras", "un canal"};
+static const char widgetGlyphs[WIDGET_TYPE_COUNT] = {'F', 'P', 'v', 'L', 'B', 'T', 'C', 'X'};
+
+// Las mismas dimensiones que DisplayManager::calculateLayout()
+static void screenSize(uint8_t orientation, uint16_t& width, uint16_t& height) {
+  bool portrait = orientation == ORIENT_0 || orientation == ORIENT_180;
+  width = portrait ? TFT_HEIGHT : TFT_WIDTH;
+  height = portrait ? TFT_WIDTH : TFT_HEIGHT;
+}
+
+static void dump(const MixerScene& scene, const std::vector<uint8_t>& owner) {
+  for (uint16_t y = 0; y < scene.getHeight(); y += 8) {
+    printf("    ");
+    for (uint16_t x = 0; x < scene.getWidth(); x += 4) {
+      uint8_t index = owner[y * scene.getWidth() + x];
+      putchar(index ? widgetGlyphs[scene.widget(index - 1).type] : (y < scene.getHeaderHeight() ? '-' : '.'));
+    }
+    putchar('\n');
+  }
+}
+
+// El texto más ancho que dibuja cada widget, con su fuente
+static bool textFits(const Widget& widget, MixerView view) {
+  switch (widget.type) {
+    case WIDGET_TIMECODE:
+      return SmoothText::textWidth("00:00:00:00", SMOOTH_FONT_LARGE) <= widget.w;
+    case WIDGET_CLOCK:
+      return SmoothText::textWidth("999.9 BPM", SMOOTH_FONT_SMALL) <= widget.w;
+    case WIDGET_LABEL:
+      if (view == VIEW_SINGLE) {
+        // Cajas MUTE y SOLO de 70 píxeles separadas 80, y debajo de los textos
+        return widget.w >= 80 + 70 && widget.h >= 130 + 24 &&
+               SmoothText::textWidth("MUTE", SMOOTH_FONT_MEDIUM) <= 70;
+      }
+      return SmoothText::textWidth("16", SMOOTH_FONT_SMALL) <= widget.w &&
+             SmoothText::textWidth("127", SMOOTH_FONT_SMALL) <= widget.w;
+    default:
+      return true;
+  }
+}
+
+static void checkLayout(uint8_t orientation, MixerView view, bool print) {
+  uint16_t width, height;
+  screenSize(orientation, width, height);
+  MixerScene scene;
+  bool valid = scene.build(width, height, view);
+
+  std::vector<uint8_t> owner(width * height, 0);
+  uint32_t outside = 0, overlapped = 0, wrongZone = 0, painted = 0;
+  uint8_t tooSmall = 0, textOverflow = 0, faders = 0, pans = 0, labels = 0;
+
+  for (uint8_t i = 0; i < scene.getWidgetCount(); i++) {
+    const Widget& widget = scene.widget(i);
+    if (!widget.w) continue;
+    bool global = widget.channel == SCENE_NO_CHANNEL;
+
+    for (int32_t y = widget.y; y < widget.y + widget.h; y++) {
+      for (int32_t x = widget.x; x < widget.x + widget.w; x++) {
+        if (x < 0 || y < 0 || x >= width || y >= height) { outside++; continue; }
+        if (global != (y < scene.getHeaderHeight())) wrongZone++;
+        uint8_t& pixel = owner[y * width + x];
+        if (pixel) overlapped++;
+        pixel = i + 1;
+        painted++;
+      }
+    }
+
+    if (widget.type == WIDGET_FADER) faders++;
+    if (widget.type == WIDGET_PAN) pans++;
+    if (widget.type == WIDGET_LABEL) labels++;
+    // Barras de al menos 40 píxeles para que un paso de 127 se distinga
+    if ((widget.type == WIDGET_FADER || widget.type == WIDGET_METER) && widget.h < 40) tooSmall++;
+    if (!textFits(widget, view)) textOverflow++;
+  }
+
+  uint8_t channels = view == VIEW_SINGLE ? 1 : view == VIEW_STRIPS_16 ? NUM_ENCODERS : NUM_ENCODERS / 2;
+  uint8_t expectedFaders = view == VIEW_STRIPS_16 ? NUM_ENCODERS / 2 : channels;
+  uint8_t expectedPans = view == VIEW_STRIPS_16 ? NUM_ENCODERS / 2 : channels;
+
+  printf("  %3s° %ux%u %-9s: cabecera %u, %u widgets, %lu%% de la pantalla ocupada\n",
+         orientationNames[orientation], width, height, viewNames[view], scene.getHeaderHeight(),
+         scene.getWidgetCount(), (unsigned long)(painted * 100 / (width * height)));
+  if (print) dump(scene, owner);
+
+  CHECK(valid, "validate() rechaza la disposición");
+  CHECK(outside == 0 && overlapped == 0 && wrongZone == 0,
+        "%lu píxeles fuera, %lu solapados, %lu al otro lado de la cabecera",
+        (unsigned long)outside, (unsigned long)overlapped, (unsigned long)wrongZone);
+  CHECK(scene.getChannelCount() == channels && labels == channels && faders == expectedFaders &&
+        pans == expectedPans, "%u canales, %u etiquetas, %u faders y %u pans", scene.getChannelCount(),
+        labels, faders, pans);
+  CHECK(tooSmall == 0, "%u barras de menos de 40 píxeles", tooSmall);
+  CHECK(textOverflow == 0, "%u widgets donde el texto no cabe", textOverflow);
+}
+
+int main() {
+  Serial.quiet = true;
+  const char* env = getenv("MIXER_LAYOUT_DUMP");
+  bool print = env && *env == '1';
+
+  for (uint8_t orientation = ORIENT_0; orientation <= ORIENT_270; orientation++) {
+    printf("Orientación %s°\n", orientationNames[orientation]);
+    for (uint8_t view = 0; view < VIEW_COUNT; view++) checkLayout(orientation, (MixerView)view, print);
+  }
+
+  printf(failures ? "test_mixer_layout: %d fallos\n" : "test_mixer_layout: OK\n", failures);
+  return failures ? 1 : 0;
+}
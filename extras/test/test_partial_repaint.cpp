@@ -0,0 +1,148 @@
+// Repintado parcial de faders, pan y medidores en las tres vistas: bytes SPI
+// y tiempo de cada pasada sobre el panel de display_host.h, frente al frame
+// completo y al widget entero. Al final la pantalla pintada a trozos debe ser
+// idéntica, píxel a píxel, a la misma escena dibujada desde cero.
+// Compilar y ejecutar con extras/test/run_tests.sh
+
+#include "test_util.h"
+#include "display_host.h"
+#include <chrono>
+
+typedef std::chrono::steady_clock Clock;
+
+#define STEPS            20
+#define METER_RUN_MS     1000
+#define VU_PERIOD_MS     5
+
+static const char* const viewNames[VIEW_COUNT] = {"8 tiras", "16 tiras", "un canal"};
+
+static EncoderBankState state;
+static EncoderConfig configs[NUM_ENCODERS];
+static MtcData mtc;
+static TransportState transport;
+static ClockData midiClock;
+
+struct Pass {
+  uint64_t bytes;
+  uint32_t spiUs;      // Tiempo de bus simulado
+  double buildUs;      // Tiempo de la pasada en el PC
+};
+
+// Pasadas hasta completar el frame, tras dejar pasar el periodo de las regiones
+static Pass draw(uint32_t waitUs = DISPLAY_UPDATE_INTERVAL * 1000) {
+  hostMicros += waitUs;
+  Pass pass = {hostPanel.spiBytes, hostMicros, 0};
+  Clock::time_point start = Clock::now();
+  while (!displayManager.drawMainScreen(state, configs, mtc, 0, transport, midiClock)) hostMicros += 1000;
+  pass.buildUs = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+  pass.bytes = hostPanel.spiBytes - pass.bytes;
+  pass.spiUs = hostMicros - pass.spiUs - waitUs;
+  return pass;
+}
+
+static uint32_t widgetBytes(const Widget& widget) {
+  return HOST_WINDOW_BYTES + 2 * widget.w * widget.h;
+}
+
+static void measure(MixerView view) {
+  hostSetupDisplay(ORIENT_270, view);
+  state = EncoderBankState();
+  for (uint8_t ch = 0; ch < 8; ch++) displayManager.setVULevel(ch, 0);
+  displayManager.setFocusChannel(0);
+  MixerScene scene;
+  scene.build(TFT_WIDTH, TFT_HEIGHT, view);
+  // La tira del encoder 0 (volumen) y la del 8 (su pan) en esta vista
+  const Widget& fader = scene.channelWidget(0, WIDGET_FADER);
+  const Widget& pan = scene.channelWidget(view == VIEW_STRIPS_16 ? 8 : 0, WIDGET_PAN);
+  const Widget& meter = scene.channelWidget(0, WIDGET_METER);
+
+  printf("%s\n", viewNames[view]);
+  Pass full = draw();
+  printf("  frame completo       %7llu B, %6u us de SPI, %7.1f us en el PC\n", (unsigned long long)full.bytes,
+         full.spiUs, full.buildUs);
+
+  // Volumen y pan paso a paso: solo el tramo de barra o el marcador
+  uint64_t faderBytes = 0, panBytes = 0;
+  double faderUs = 0, panUs = 0;
+  for (uint8_t step = 0; step < STEPS; step++) {
+    state.dawValue[0]++;
+    displayManager.invalidateWidgets(0, WIDGET_BIT(WIDGET_FADER));
+    Pass pass = draw();
+    faderBytes += pass.bytes;
+    faderUs += pass.buildUs;
+
+    state.dawValue[8]++;
+    displayManager.invalidateWidgets(8, WIDGET_BIT(WIDGET_PAN));
+    pass = draw();
+    panBytes += pass.bytes;
+    panUs += pass.buildUs;
+  }
+  printf("  volumen, 1 paso      %7.1f B (widget entero %u), %5.2f us en el PC\n", (double)faderBytes / STEPS,
+         widgetBytes(fader), faderUs / STEPS);
+  if (pan.w) {
+    printf("  pan, 1 paso          %7.1f B (widget entero %u), %5.2f us en el PC\n", (double)panBytes / STEPS,
+           widgetBytes(pan), panUs / STEPS);
+  }
+
+  // Medidores: 8 niveles nuevos cada 5 ms durante un segundo y una pasada
+  // por ms, como el loop
+  uint64_t meterBytes = 0;
+  uint32_t meterPasses = 0, maxSpiUs = 0;
+  double maxBuildUs = 0;
+  for (uint32_t ms = 0; ms < METER_RUN_MS; ms++) {
+    if (ms % VU_PERIOD_MS == 0) {
+      for (uint8_t ch = 0; ch < 8; ch++) displayManager.setVULevel(ch, rnd(128));
+    }
+    hostMicros += 1000;
+    uint64_t bytes = hostPanel.spiBytes;
+    uint32_t spiStart = hostMicros;
+    Clock::time_point start = Clock::now();
+    displayManager.drawMainScreen(state, configs, mtc, 0, transport, midiClock);
+    double buildUs = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    if (hostPanel.spiBytes == bytes) continue;
+    meterBytes += hostPanel.spiBytes - bytes;
+    meterPasses++;
+    maxSpiUs = max(maxSpiUs, (uint32_t)(hostMicros - spiStart));
+    maxBuildUs = max(maxBuildUs, buildUs);
+  }
+  uint32_t meters = view == VIEW_SINGLE ? 1 : 8;
+  printf("  medidores, 1 s       %7llu B en %u pasadas (entero %u), pasada máx %u us de SPI, %.1f us en el PC\n",
+         (unsigned long long)meterBytes, meterPasses, widgetBytes(meter) * meters * meterPasses, maxSpiUs,
+         maxBuildUs);
+
+  CHECK(faderBytes > 0 && faderBytes / STEPS < widgetBytes(fader) / 10, "%s: volumen a %llu B por paso",
+        viewNames[view], (unsigned long long)(faderBytes / STEPS));
+  if (pan.w) {
+    CHECK(panBytes > 0 && panBytes / STEPS < widgetBytes(pan) / 4, "%s: pan a %llu B por paso", viewNames[view],
+          (unsigned long long)(panBytes / STEPS));
+  } else {
+    CHECK(panBytes == 0, "%s: pan sin widget pintado", viewNames[view]);
+  }
+  CHECK(meterPasses > 0 && meterBytes < (uint64_t)widgetBytes(meter) * meters * meterPasses / 4,
+        "%s: medidores a %llu B", viewNames[view], (unsigned long long)meterBytes);
+  CHECK(full.bytes > faderBytes + panBytes, "%s: frame completo de %llu B", viewNames[view],
+        (unsigned long long)full.bytes);
+
+  // Lo pintado a trozos contra la misma escena desde cero, con los medidores
+  // ya caídos del todo (si no, el frame completo los pillaría más abajo)
+  bool falling = true;
+  while (falling) {
+    hostMicros += 1000;
+    falling = !displayManager.drawMainScreen(state, configs, mtc, 0, transport, midiClock);
+    for (uint8_t ch = 0; ch < 8; ch++) falling |= displayManager.getVULevel(ch) > 0;
+  }
+  std::vector<uint16_t> partial = hostPanel.pixels;
+  displayManager.forceFullRedraw();
+  draw();
+  uint32_t differing = 0;
+  for (size_t i = 0; i < partial.size(); i++) differing += partial[i] != hostPanel.pixels[i];
+  CHECK(differing == 0, "%s: %u píxeles distintos del frame completo", viewNames[view], differing);
+}
+
+int main() {
+  rndSeed(0x9A1E0049);
+  for (uint8_t view = 0; view < VIEW_COUNT; view++) measure((MixerView)view);
+
+  printf(failures ? "test_partial_repaint: %d fallos\n" : "test_partial_repaint: OK\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,231 @@
+// Caché de presets en flash sobre una partición simulada en memoria (NOR:
+// escribir solo pasa bits de 1 a 0, borrar por sectores) y una SD simulada:
+// sincronización, desalojo de presets borrados de la SD y coste de carga
+// desde la flash mapeada frente a leer el .prs.
+// Compilar y ejecutar con extras/test/run_tests.sh
+
+#include "test_util.h"
+#include "encoder_host.h"
+#include "PresetCacheManager.h"
+#include "SpiBusManager.h"
+#include <chrono>
+#include <map>
+#include <string>
+
+// ---- Partición "presets" de partitions.csv (1 MB) en memoria
+#define PARTITION_SIZE  0x100000
+
+static std::vector<uint8_t> flash(PARTITION_SIZE, 0xFF);
+static esp_partition_t presetPartition = {ESP_PARTITION_TYPE_DATA, 0x40, 0xC90000, PARTITION_SIZE,
+                                          PRESET_CACHE_SECTOR_SIZE, "presets", false};
+static uint32_t sectorsErased = 0, flashWrites = 0;
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t, esp_partition_subtype_t, const char* label) {
+  return strcmp(label, presetPartition.label) == 0 ? &presetPartition : nullptr;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t*, size_t offset, size_t, esp_partition_mmap_memory_t,
+                             const void** out, esp_partition_mmap_handle_t* handle) {
+  *out = flash.data() + offset;
+  *handle = 1;
+  return ESP_OK;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t) {}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t*, size_t offset, size_t size) {
+  if (offset % PRESET_CACHE_SECTOR_SIZE || size % PRESET_CACHE_SECTOR_SIZE || offset + size > flash.size()) {
+    return ESP_FAIL;
+  }
+  memset(flash.data() + offset, 0xFF, size);
+  sectorsErased += size / PRESET_CACHE_SECTOR_SIZE;
+  return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t*, size_t offset, const void* src, size_t size) {
+  if (offset + size > flash.size()) return ESP_FAIL;
+  const uint8_t* bytes = (const uint8_t*)src;
+  for (size_t i = 0; i < size; i++) flash[offset + i] &= bytes[i];
+  flashWrites++;
+  return ESP_OK;
+}
+
+// ---- SD en memoria: /presets/<nombre>.prs
+static std::map<std::string, std::vector<uint8_t>> sdFiles;
+static bool sdPresent = true;
+
+static std::string presetPath(const char* name) {
+  return std::string(PRESET_DIRECTORY) + "/" + name + ".prs";
+}
+
+FileManager::FileManager() : sdInitialized(true), sdCardPresent(true), totalSpace(0), freeSpace(0) {}
+FileManager::~FileManager() {}
+
+uint8_t FileManager::listPresets(char presetNames[][MAX_PRESET_NAME], uint8_t maxPresets) {
+  if (!sdPresent) return 0;
+  uint8_t count = 0;
+  for (const auto& file : sdFiles) {
+    if (count >= maxPresets) break;
+    std::string name = file.first.substr(strlen(PRESET_DIRECTORY) + 1);
+    name.resize(name.size() - 4);
+    strncpy(presetNames[count], name.c_str(), MAX_PRESET_NAME - 1);
+    presetNames[count][MAX_PRESET_NAME - 1] = '\0';
+    count++;
+  }
+  return count;
+}
+
+bool FileManager::fileExists(const char* filename) {
+  if (!sdPresent) return false;
+  return strcmp(filename, PRESET_DIRECTORY) == 0 || sdFiles.count(filename);
+}
+
+bool FileManager::readFile(const char* filename, void* data, size_t maxSize, size_t* actualSize) {
+  auto file = sdFiles.find(filename);
+  if (!sdPresent || file == sdFiles.end() || file->second.size() > maxSize) return false;
+  memcpy(data, file->second.data(), file->second.size());
+  if (actualSize) *actualSize = file->second.size();
+  return true;
+}
+
+FileManager fileManager;
+PresetCacheManager presetCache;
+
+typedef std::chrono::steady_clock Clock;
+
+// Preset con 'banks' bancos y valores distintos según 'seed'
+static std::vector<uint8_t> makePreset(uint8_t banks, uint8_t seed) {
+  appConfig.bankCount = banks;
+  encoderManager.initialize(&appConfig);
+  encoderManager.resetAllBanks();
+  for (uint8_t bank = 0; bank < banks; bank++) {
+    for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+      EncoderConfig& config = encoderManager.getEncoderConfigMutable(i, bank);
+      config.control = (seed + bank + i) & 0x7F;
+      config.channel = seed % 16;
+    }
+  }
+  std::vector<uint8_t> image(encoderManager.getImageSize());
+  encoderManager.exportImage(image.data(), image.size());
+  return image;
+}
+
+static void savePreset(const char* name, const std::vector<uint8_t>& image) {
+  sdFiles[presetPath(name)] = image;
+}
+
+static void sync() {
+  presetCache.startSync();
+  while (presetCache.isSyncing()) presetCache.update();
+}
+
+static bool loads(const char* name, const std::vector<uint8_t>& expected) {
+  if (!presetCache.loadPreset(name, encoderManager)) return false;
+  std::vector<uint8_t> image(encoderManager.getImageSize());
+  encoderManager.exportImage(image.data(), image.size());
+  return image == expected;
+}
+
+static void syncAndEvict() {
+  std::vector<uint8_t> mix = makePreset(4, 1), drums = makePreset(2, 2), keys = makePreset(8, 3);
+  savePreset("mix", mix);
+  savePreset("drums", drums);
+  savePreset("keys", keys);
+
+  sync();
+  printf("  3 presets en SD -> %u slots; cargan desde la flash: %s\n", presetCache.getUsedSlots(),
+         loads("mix", mix) && loads("drums", drums) && loads("keys", keys) ? "sí" : "no");
+  CHECK(presetCache.getUsedSlots() == 3, "%u slots en uso", presetCache.getUsedSlots());
+  CHECK(loads("mix", mix) && loads("drums", drums) && loads("keys", keys), "imagen distinta de la SD");
+
+  uint32_t erased = sectorsErased, writes = flashWrites;
+  sync();
+  CHECK(sectorsErased == erased && flashWrites == writes, "resincronizar sin cambios escribe la flash");
+
+  // Borrado en la SD: el slot se desaloja sin borrar sectores
+  sdFiles.erase(presetPath("drums"));
+  erased = sectorsErased;
+  sync();
+  printf("  borrado 'drums' de la SD -> %u slots, %u sectores borrados al desalojar\n",
+         presetCache.getUsedSlots(), sectorsErased - erased);
+  CHECK(presetCache.getUsedSlots() == 2 && !presetCache.findPreset("drums"), "'drums' sigue en la caché");
+  CHECK(!presetCache.loadPreset("drums", encoderManager), "'drums' aún se carga");
+  CHECK(sectorsErased == erased, "el desalojo borró sectores");
+  CHECK(loads("mix", mix) && loads("keys", keys), "el desalojo tocó otros slots");
+
+  // Guardado después del listado: está en la SD aunque no en syncNames
+  std::vector<uint8_t> pads = makePreset(3, 4);
+  presetCache.startSync();
+  savePreset("pads", pads);
+  encoderManager.importImage(pads.data(), pads.size());
+  presetCache.storePreset("pads", encoderManager);
+  while (presetCache.isSyncing()) presetCache.update();
+  CHECK(loads("pads", pads), "se desalojó un preset guardado durante la sincronización");
+
+  // SD retirada: el listado vacío no vacía la caché
+  sdPresent = false;
+  sync();
+  sdPresent = true;
+  printf("  sincronización sin SD -> %u slots\n", presetCache.getUsedSlots());
+  CHECK(presetCache.getUsedSlots() == 3, "sin SD se desalojaron slots");
+
+  // El slot desalojado se reutiliza: writeSlot() lo borra antes de escribir
+  std::vector<uint8_t> bass = makePreset(6, 5);
+  savePreset("bass", bass);
+  sync();
+  CHECK(presetCache.getUsedSlots() == 4 && loads("bass", bass), "el slot desalojado no se reutiliza bien");
+
+  // Todos borrados de la SD: la caché queda vacía
+  sdFiles.clear();
+  sync();
+  CHECK(presetCache.getUsedSlots() == 0, "quedan %u slots sin presets en la SD", presetCache.getUsedSlots());
+}
+
+// Carga desde la flash mapeada (checksum + copia a las tablas) y acceso sin
+// copia con findPreset(), frente a la lectura del .prs a 4 MHz (estimada:
+// solo los bits en el bus, sin FAT ni latencia de la tarjeta)
+static void benchmark() {
+  static const uint8_t bankCounts[] = {1, 8, 32};
+  const uint32_t rounds = 2000;
+
+  for (uint8_t banks : bankCounts) {
+    std::vector<uint8_t> image = makePreset(banks, banks);
+    savePreset("bench", image);
+    sync();
+
+    Clock::time_point start = Clock::now();
+    bool ok = true;
+    for (uint32_t i = 0; i < rounds; i++) ok &= presetCache.loadPreset("bench", encoderManager);
+    double loadMicros = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / rounds;
+
+    start = Clock::now();
+    uint32_t touched = 0;
+    for (uint32_t i = 0; i < rounds; i++) {
+      uint8_t count = 0;
+      const EncoderConfig (*configs)[NUM_ENCODERS] = presetCache.findPreset("bench", &count);
+      touched += configs ? configs[count - 1][NUM_ENCODERS - 1].control : 0;
+    }
+    double findMicros = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / rounds;
+    double sdMicros = image.size() * 8.0 / (SPI_SD_CLOCK_HZ / 1e6);
+
+    printf("  %2u bancos (%6zu bytes): loadPreset %7.2f us, findPreset %5.2f us, SD a 4 MHz >= %7.0f us\n",
+           banks, image.size(), loadMicros, findMicros, sdMicros);
+    CHECK(ok && touched > 0, "la caché no sirvió el preset de %u bancos", banks);
+    sdFiles.clear();
+  }
+  sync();
+}
+
+int main() {
+  hostSetupEncoders(TAKEOVER_FOLLOW);
+  CHECK(presetCache.initialize(), "la caché no se inicializó");
+  printf("Caché: %u slots\n", presetCache.getSlotCount());
+
+  printf("Sincronización y desalojo\n");
+  syncAndEvict();
+  printf("Coste de carga en el PC\n");
+  benchmark();
+
+  printf(failures ? "test_preset_cache: %d fallos\n" : "test_preset_cache: OK\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,123 @@
+// Turno de salida de los encoders en el peor gesto: la palma barre los 16
+// encoders a la vez, un paso por encoder y ms durante un segundo, con el
+// presupuesto de salida del firmware. Cada encoder debe salir al menos una
+// vez por vuelta (16 * mensajes / ritmo ms) y la cola no debe perder nada.
+// Compilar y ejecutar con extras/test/run_tests.sh
+
+#include "test_util.h"
+#include "midi_host.h"
+
+#define LOOP_US          250     // Ritmo del loop durante el gesto
+#define DETENT_US        1000    // Un paso por encoder y ms
+#define GESTURE_US       1000000
+
+struct Scenario {
+  const char* name;
+  uint8_t resolution;
+  uint8_t messages;       // Mensajes por envío (messagesPerUpdate)
+};
+
+static void sweep(const Scenario& scenario, uint8_t outputRate) {
+  hostSetupMidi(outputRate);
+  hostMicros = 1000000;
+  // Controles 0-15: el par MSB/LSB solo existe por debajo de 32
+  for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+    EncoderConfig& config = encoderManager.getEncoderConfigMutable(i, 0);
+    config.control = i;
+    config.resolution = scenario.resolution;
+  }
+
+  int8_t direction[NUM_ENCODERS];
+  for (uint8_t i = 0; i < NUM_ENCODERS; i++) direction[i] = 1;
+
+  uint32_t start = hostMicros;
+  uint32_t nextDetent = start;
+  while (hostMicros - start < GESTURE_US) {
+    if ((int32_t)(hostMicros - nextDetent) >= 0) {
+      // Ida y vuelta entre los topes, cada encoder en su sitio del barrido
+      for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+        uint8_t value = encoderManager.getEncoderDAWValue(i, 0);
+        if (value >= 127) direction[i] = -1;
+        else if (value == 0) direction[i] = 1;
+        encoderManager.processEncoderChange(i, direction[i], 0, hostMicros);
+      }
+      nextDetent += DETENT_US;
+    }
+    encoderManager.updateOutput();
+    midiManager.processMidiOutput();
+    hostMicros += LOOP_US;
+  }
+  // Se suelta: lo pendiente sale en las vueltas siguientes
+  for (uint8_t n = 0; n < 200; n++) {
+    encoderManager.updateOutput();
+    midiManager.processMidiOutput();
+    hostMicros += LOOP_US;
+  }
+
+  // Envíos por encoder según su último mensaje: CC 0-15, LSB del par o
+  // Data Entry LSB del parámetro seleccionado
+  uint32_t writes[NUM_ENCODERS] = {};
+  uint16_t lastParam = 0xFFFF;
+  for (const HostUsbWrite& write : hostUsbWrites) {
+    if ((write.status & 0xF0) != 0xB0) continue;
+    if (scenario.resolution == RES_NRPN) {
+      if (write.data1 == CC_NRPN_MSB) lastParam = write.data2 << 7;
+      else if (write.data1 == CC_NRPN_LSB) lastParam |= write.data2;
+      else if (write.data1 == CC_DATA_ENTRY_LSB && lastParam < NUM_ENCODERS) writes[lastParam]++;
+    } else if (scenario.resolution == RES_14BIT_CC) {
+      if (write.data1 >= CC_LSB_OFFSET && write.data1 < CC_LSB_OFFSET + NUM_ENCODERS) {
+        writes[write.data1 - CC_LSB_OFFSET]++;
+      }
+    } else if (write.data1 < NUM_ENCODERS) {
+      writes[write.data1]++;
+    }
+  }
+
+  uint32_t drops = 0;
+  for (uint8_t cable = 0; cable < MIDI_OUTPUT_PORTS; cable++) drops += midiManager.getCableStats(cable).drops;
+
+  uint32_t worst = 0, best = UINT32_MAX, fewest = UINT32_MAX;
+  for (uint8_t i = 0; i < NUM_ENCODERS; i++) {
+    worst = max(worst, encoderManager.getMaxStaleness(i));
+    best = min(best, encoderManager.getMaxStaleness(i));
+    fewest = min(fewest, writes[i]);
+  }
+  uint32_t fields[16];
+  encoderManager.getDiagnostics(fields);
+
+  // Una vuelta completa del turno más el loop en que llegó el paso
+  uint32_t lapUs = NUM_ENCODERS * scenario.messages * 1000 / outputRate;
+  uint32_t boundUs = lapUs + LOOP_US;
+  uint32_t expectedWrites = GESTURE_US / boundUs;
+  printf("  %-6s a %u msg/ms: antigüedad máx %5u us (mín entre encoders %5u, cota %5u), "
+         "%4u envíos por encoder como mínimo, %u aplazados, %u perdidos\n",
+         scenario.name, outputRate, worst, best, boundUs, fewest, fields[8], drops);
+
+  CHECK(worst == fields[9], "%s: el diagnóstico da %u us y los encoders %u", scenario.name, fields[9], worst);
+  CHECK(worst <= boundUs, "%s a %u msg/ms: antigüedad de %u us por encima de la cota de %u", scenario.name,
+        outputRate, worst, boundUs);
+  CHECK(best > 0 && fewest >= expectedWrites, "%s a %u msg/ms: un encoder solo salió %u veces (se esperaban %u)",
+        scenario.name, outputRate, fewest, expectedWrites);
+  CHECK(drops == 0, "%s a %u msg/ms: %u mensajes perdidos en la cola", scenario.name, outputRate, drops);
+  CHECK(fields[8] > 0, "%s a %u msg/ms: el presupuesto no llegó a aplazar nada", scenario.name, outputRate);
+}
+
+int main() {
+  rndSeed(0x5C4ED042);
+  MidiManager::registerUsbInterface();
+
+  const Scenario scenarios[] = {
+    {"CC", RES_7BIT, 1},
+    {"CC14", RES_14BIT_CC, 2},
+    {"NRPN", RES_NRPN, 4},
+  };
+  static const uint8_t rates[] = {4, 8};
+
+  printf("Barrido de palma: 16 encoders, un paso por ms durante 1 s\n");
+  for (uint8_t rate : rates) {
+    for (const Scenario& scenario : scenarios) sweep(scenario, rate);
+  }
+
+  printf(failures ? "test_scheduler: %d fallos\n" : "test_scheduler: OK\n", failures);
+  return failures ? 1 : 0;
+}
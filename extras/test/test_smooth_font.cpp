@@ -0,0 +1,275 @@
+// Fuentes suavizadas: cada glifo de los tres tamaños, recodificado en nibbles
+// y en RLE, pasa por SmoothText y debe dar exactamente su mapa de alfa, en una
+// caja holgada y en una recortada por arriba y por los lados. Comprueba la
+// lectura UTF-8 / Latin-1 de los textos con acentos y mide lo que cuesta
+// decodificar en cada modo.
+// Compilar y ejecutar con extras/test/run_tests.sh
+
+#include "test_util.h"
+#include "SmoothFont.h"
+#include "SmoothFonts.h"
+#include "Strings.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+#define BENCH_CHARS      16      // Caracteres por cadena de la medida
+#define BENCH_ROUNDS     300
+
+static const char* const sizeNames[SMOOTH_FONT_COUNT] = {"small", "medium", "large"};
+static const size_t dataSizes[SMOOTH_FONT_COUNT] = {
+  sizeof(smoothSmallData), sizeof(smoothMediumData), sizeof(smoothLargeData)
+};
+
+typedef std::vector<uint8_t> Alphas;
+
+// Una fuente con los mismos glifos en el modo que se pida
+struct Recoded {
+  std::vector<uint8_t> data;
+  SmoothGlyph glyphs[SMOOTH_GLYPH_COUNT];
+  SmoothFont font;
+};
+
+static uint16_t codePointOf(uint8_t index) {
+  return index < 95 ? 0x20 + index : 0xA0 + index - 95;
+}
+
+static std::string utf8(uint16_t codePoint) {
+  std::string text;
+  if (codePoint < 0x80) {
+    text += (char)codePoint;
+  } else {
+    text += (char)(0xC0 | (codePoint >> 6));
+    text += (char)(0x80 | (codePoint & 0x3F));
+  }
+  return text;
+}
+
+// Decodificador de referencia sobre las tablas generadas; devuelve los bytes leídos
+static size_t decode(const SmoothFont& font, const SmoothGlyph& glyph, Alphas& alphas) {
+  uint16_t pixels = glyph.width * glyph.height;
+  const uint8_t* data = font.data + glyph.offset;
+  alphas.assign(pixels, 0);
+  if (!(font.flags & SMOOTH_RLE)) {
+    for (uint16_t i = 0; i < pixels; i++) alphas[i] = (i & 1) ? (data[i >> 1] & 0x0F) : (data[i >> 1] >> 4);
+    return (pixels + 1) / 2;
+  }
+
+  size_t used = 0;
+  for (uint16_t i = 0; i < pixels; used++) {
+    uint8_t run = (data[used] & 0x0F) + 1;
+    if (i + run > pixels) return 0;   // Racha que se sale del glifo
+    while (run--) alphas[i++] = data[used] >> 4;
+  }
+  return used;
+}
+
+// Igual que pack() y rle() de tools/gen_fonts.py
+static void encode(const Alphas& alphas, bool rle, std::vector<uint8_t>& out) {
+  if (!rle) {
+    for (size_t i = 0; i < alphas.size(); i += 2) {
+      out.push_back((alphas[i] << 4) | (i + 1 < alphas.size() ? alphas[i + 1] : 0));
+    }
+    return;
+  }
+  for (size_t pos = 0; pos < alphas.size();) {
+    uint8_t run = 1;
+    while (pos + run < alphas.size() && alphas[pos + run] == alphas[pos] && run < 16) run++;
+    out.push_back((alphas[pos] << 4) | (run - 1));
+    pos += run;
+  }
+}
+
+static void recode(const SmoothFont& source, const std::vector<Alphas>& bitmaps, bool rle, Recoded& out) {
+  out.data.clear();
+  for (uint8_t i = 0; i < SMOOTH_GLYPH_COUNT; i++) {
+    out.glyphs[i] = source.glyphs[i];
+    out.glyphs[i].offset = out.data.size();
+    encode(bitmaps[i], rle, out.data);
+  }
+  out.font = source;
+  out.font.data = out.data.data();
+  out.font.glyphs = out.glyphs;
+  out.font.flags = rle ? SMOOTH_RLE : 0;
+}
+
+// Azul puro sobre negro: cada nivel de alfa da un color distinto
+static uint16_t blue(uint8_t alpha) {
+  return (31 * alpha + 7) / 15;
+}
+
+// Un glifo en una caja w x h, centrado como lo deja begin(); 0 si coincide
+static uint32_t wrongPixels(SmoothText& text, const SmoothFont& font, uint8_t index, const Alphas& alphas,
+                            uint16_t w, uint16_t h) {
+  const SmoothGlyph& glyph = font.glyphs[index];
+  text.begin(utf8(codePointOf(index)).c_str(), font, w, h, true, 0x001F, 0x0000);
+  int16_t left = glyph.xAdvance < w ? (w - glyph.xAdvance) / 2 : 0;
+  int16_t x = left + glyph.xOffset;
+  int16_t top = ((int16_t)h + font.capHeight) / 2 + glyph.yOffset;
+
+  std::vector<uint16_t> row(w);
+  uint32_t wrong = 0;
+  for (int16_t y = 0; y < (int16_t)h; y++) {
+    text.renderRow(y, row.data(), w);
+    for (int16_t col = 0; col < (int16_t)w; col++) {
+      bool inside = y >= top && y < top + glyph.height && col >= x && col < x + glyph.width;
+      uint8_t alpha = inside ? alphas[(y - top) * glyph.width + col - x] : 0;
+      wrong += row[col] != blue(alpha);
+    }
+  }
+  text.end();
+  return wrong;
+}
+
+static double benchmark(SmoothText& text, const SmoothFont& font, uint64_t& glyphPixels, uint64_t& boxPixels) {
+  std::vector<std::string> strings;
+  std::vector<uint16_t> widths;
+  for (uint8_t first = 0; first < SMOOTH_GLYPH_COUNT; first += BENCH_CHARS) {
+    std::string line;
+    uint16_t width = 0;
+    for (uint8_t i = first; i < SMOOTH_GLYPH_COUNT && i < first + BENCH_CHARS; i++) {
+      line += utf8(codePointOf(i));
+      width += font.glyphs[i].xAdvance;
+      glyphPixels += font.glyphs[i].width * font.glyphs[i].height;
+    }
+    strings.push_back(line);
+    widths.push_back(width);
+  }
+
+  uint16_t height = font.ascent + font.descent;
+  std::vector<uint16_t> row(512);
+  uint32_t sink = 0;
+  Clock::time_point start = Clock::now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (size_t n = 0; n < strings.size(); n++) {
+      text.begin(strings[n].c_str(), font, widths[n], height, false, 0xFFFF, 0x0000);
+      for (uint16_t y = 0; y < height; y++) {
+        text.renderRow(y, row.data(), widths[n]);
+        sink += row[y % widths[n]];
+      }
+      text.end();
+      boxPixels += widths[n] * height;
+    }
+  }
+  double us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+  glyphPixels *= BENCH_ROUNDS;
+  CHECK(sink != 0, "la medida no pintó nada");
+  return us / (BENCH_ROUNDS * strings.size());
+}
+
+static void checkFont(uint8_t id) {
+  const SmoothFont& font = SmoothText::getFont(id);
+  bool nativeRle = font.flags & SMOOTH_RLE;
+
+  // Las tablas: glifos seguidos, sin huecos ni rachas que se salgan
+  std::vector<Alphas> bitmaps(SMOOTH_GLYPH_COUNT);
+  uint32_t badOffsets = 0;
+  for (uint8_t i = 0; i < SMOOTH_GLYPH_COUNT; i++) {
+    size_t used = decode(font, font.glyphs[i], bitmaps[i]);
+    size_t next = i + 1 < SMOOTH_GLYPH_COUNT ? font.glyphs[i + 1].offset : dataSizes[id];
+    badOffsets += font.glyphs[i].offset + used != next;
+  }
+  CHECK(badOffsets == 0, "%s: %u glifos que no acaban donde empieza el siguiente", sizeNames[id], badOffsets);
+
+  Recoded packed, rle;
+  recode(font, bitmaps, false, packed);
+  recode(font, bitmaps, true, rle);
+  const Recoded& native = nativeRle ? rle : packed;
+  CHECK(native.data.size() == dataSizes[id] && memcmp(native.data.data(), font.data, dataSizes[id]) == 0,
+        "%s: recodificar en su modo no da los bytes de SmoothFonts.h", sizeNames[id]);
+
+  // SmoothText en los dos modos: caja holgada y caja recortada (estrecha y
+  // de la altura de las mayúsculas, con filas descartadas por arriba)
+  SmoothText text;
+  uint16_t roomyW = 4 * font.ascent, roomyH = 3 * (font.ascent + font.descent);
+  for (const Recoded* recoded : {&packed, &rle}) {
+    uint32_t wrongGlyphs = 0, firstWrong = 0;
+    for (uint8_t i = 0; i < SMOOTH_GLYPH_COUNT; i++) {
+      uint32_t wrong = wrongPixels(text, recoded->font, i, bitmaps[i], roomyW, roomyH) +
+                       wrongPixels(text, recoded->font, i, bitmaps[i], 4, font.capHeight);
+      if (wrong && !wrongGlyphs++) firstWrong = codePointOf(i);
+    }
+    CHECK(wrongGlyphs == 0, "%s en %s: %u glifos mal decodificados (el primero U+%04X)", sizeNames[id],
+          recoded == &rle ? "RLE" : "nibbles", wrongGlyphs, firstWrong);
+  }
+
+  for (const Recoded* recoded : {&packed, &rle}) {
+    uint64_t glyphPixels = 0, boxPixels = 0;
+    double us = benchmark(text, recoded->font, glyphPixels, boxPixels);
+    double totalNs = us * 1000 * BENCH_ROUNDS * ((SMOOTH_GLYPH_COUNT + BENCH_CHARS - 1) / BENCH_CHARS);
+    printf("  %-6s %-7s %6zu B%s | %6.2f us por cadena de %u, %.2f ns/píxel de glifo, %.2f ns/píxel de caja\n",
+           sizeNames[id], recoded == &rle ? "RLE" : "nibbles", recoded->data.size(),
+           recoded == &native ? " (en flash)" : "           ", us, BENCH_CHARS, totalNs / glyphPixels,
+           totalNs / boxPixels);
+  }
+}
+
+static std::vector<uint16_t> codePoints(const char* text) {
+  std::vector<uint16_t> points;
+  while (*text) points.push_back(SmoothText::nextCodePoint(text));
+  return points;
+}
+
+// El mismo texto con un byte por carácter, como lo escribiría un editor en Latin-1
+static std::string latin1(const std::vector<uint16_t>& points) {
+  std::string text;
+  for (uint16_t point : points) text += (char)point;
+  return text;
+}
+
+static void checkText(const char* text) {
+  std::vector<uint16_t> points = codePoints(text);
+  uint32_t missing = 0;
+  for (uint16_t point : points) missing += smoothGlyphIndex(point) < 0 || (point == '?' && !strchr(text, '?'));
+  CHECK(missing == 0, "\"%s\": %u caracteres sin glifo", text, missing);
+
+  std::string single = latin1(points);
+  CHECK(codePoints(single.c_str()) == points, "\"%s\": en Latin-1 no se lee igual", text);
+  for (uint8_t id = 0; id < SMOOTH_FONT_COUNT; id++) {
+    CHECK(SmoothText::textWidth(text, id) == SmoothText::textWidth(single.c_str(), id),
+          "\"%s\": ancho distinto en Latin-1 (%s)", text, sizeNames[id]);
+  }
+}
+
+int main() {
+  rndSeed(0x5F0A0046);
+
+  printf("Glifos de las tres fuentes en los dos modos\n");
+  for (uint8_t id = 0; id < SMOOTH_FONT_COUNT; id++) checkFont(id);
+
+  printf("Textos UTF-8 y Latin-1\n");
+  using namespace Strings;
+  const char* const strings[] = {
+    str_volume, str_pan, str_mute, str_solo, str_track, str_bank, str_time, str_encoders, str_display, str_midi,
+    str_global, str_system_test, str_exit, str_loading, str_error, str_success, str_warning,
+    // Los del menú y la pantalla
+    "Orientación: 270°", "¿Calibrar expansores I/O?", "Aceleración: ON", "»",
+  };
+  uint32_t accented = 0;
+  for (const char* text : strings) {
+    checkText(text);
+    for (uint16_t point : codePoints(text)) accented += point >= 0x80;
+  }
+  printf("  %zu textos, %u caracteres fuera de ASCII\n", sizeof(strings) / sizeof(strings[0]), accented);
+  CHECK(codePoints(str_success) == std::vector<uint16_t>({0xC9, 'x', 'i', 't', 'o'}), "\"%s\" mal leído",
+        str_success);
+
+  // Cada byte Latin-1 suelto delante de una letra, incluidos los que parecen
+  // el primero de una secuencia UTF-8 de tres o cuatro bytes (à-ï, ð-÷)
+  uint32_t wrongBytes = 0;
+  for (uint16_t byte = 0xA0; byte <= 0xFF; byte++) {
+    char text[3] = {(char)byte, 'a', 0};
+    wrongBytes += codePoints(text) != std::vector<uint16_t>({byte, 'a'});
+  }
+  CHECK(wrongBytes == 0, "%u bytes Latin-1 sueltos mal leídos", wrongBytes);
+
+  // Fuera de Latin-1: un '?' por carácter, sin comerse lo que sigue
+  CHECK(codePoints("5 €") == std::vector<uint16_t>({'5', ' ', '?'}), "euro mal leído");
+  CHECK(codePoints("\xF0\x9F\x8E\xB9 ok") == std::vector<uint16_t>({'?', ' ', 'o', 'k'}), "emoji mal leído");
+  CHECK(codePoints("\xC3" "A") == std::vector<uint16_t>({0xC3, 'A'}), "UTF-8 cortado mal leído");
+
+  printf(failures ? "test_smooth_font: %d fallos\n" : "test_smooth_font: OK\n", failures);
+  return failures ? 1 : 0;
+}
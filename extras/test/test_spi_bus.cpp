@@ -0,0 +1,154 @@
+// Reparto del bus SPI entre la pantalla y la SD: un volcado largo de la
+// pantalla que cede el bus entre trozos frente a transacciones cortas de la
+// SD. Hilos del PC en lugar de tareas y el mutex y los semáforos de FreeRTOS
+// sobre la biblioteca estándar; el tiempo de bus se simula con esperas (como
+// una transferencia DMA, no ocupa la CPU).
+// Compilar y ejecutar con extras/test/run_tests.sh
+
+#include "test_util.h"
+#include "SpiBusManager.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ---- FreeRTOS sobre std: mutex recursivo y semáforo binario
+struct HostSemaphore {
+  std::recursive_timed_mutex mutex;
+  std::mutex lock;
+  std::condition_variable signal;
+  bool given = false;
+};
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() { return new HostSemaphore; }
+SemaphoreHandle_t xSemaphoreCreateBinary() { return new HostSemaphore; }
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t handle, TickType_t ticks) {
+  HostSemaphore* s = (HostSemaphore*)handle;
+  if (ticks == portMAX_DELAY) {
+    s->mutex.lock();
+    return pdTRUE;
+  }
+  return s->mutex.try_lock_for(std::chrono::milliseconds(ticks)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t handle) {
+  ((HostSemaphore*)handle)->mutex.unlock();
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t handle, TickType_t ticks) {
+  HostSemaphore* s = (HostSemaphore*)handle;
+  std::unique_lock<std::mutex> guard(s->lock);
+  if (!s->signal.wait_for(guard, std::chrono::milliseconds(ticks), [s] { return s->given; })) return pdFALSE;
+  s->given = false;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t handle) {
+  HostSemaphore* s = (HostSemaphore*)handle;
+  std::lock_guard<std::mutex> guard(s->lock);
+  s->given = true;
+  s->signal.notify_one();
+  return pdTRUE;
+}
+
+SpiBusManager spiBusManager;
+
+// ---- Carga: la pantalla vuelca frames de 40 trozos de 250 us; la SD lee
+// un bloque de 300 us cada 1-4 ms
+#define FRAME_CHUNKS     40
+#define CHUNK_US         250
+#define SD_BLOCK_US      300
+#define RUN_MS           1500
+
+typedef std::chrono::steady_clock Clock;
+
+static uint32_t elapsedMicros(Clock::time_point since) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - since).count();
+}
+
+struct Result {
+  std::vector<uint32_t> sdWaits;
+  uint32_t frames = 0;
+  uint32_t maxFrameMicros = 0;
+};
+
+static uint32_t percentile(std::vector<uint32_t> values, uint8_t p) {
+  if (values.empty()) return 0;
+  std::sort(values.begin(), values.end());
+  return values[(values.size() - 1) * p / 100];
+}
+
+static Result run(bool yielding) {
+  Result result;
+  std::atomic<bool> stop(false);
+
+  std::thread display([&] {
+    while (!stop) {
+      Clock::time_point start = Clock::now();
+      {
+        SpiBusLock busLock(SPI_DEVICE_TFT);
+        for (uint8_t chunk = 0; chunk < FRAME_CHUNKS; chunk++) {
+          std::this_thread::sleep_for(std::chrono::microseconds(CHUNK_US));
+          if (yielding) spiBusManager.yieldIfContended(SPI_DEVICE_TFT);
+        }
+      }
+      result.frames++;
+      result.maxFrameMicros = max(result.maxFrameMicros, elapsedMicros(start));
+      std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+  });
+
+  std::thread sd([&] {
+    while (!stop) {
+      std::this_thread::sleep_for(std::chrono::microseconds(1000 + rnd(3000)));
+      Clock::time_point start = Clock::now();
+      SpiBusLock busLock(SPI_DEVICE_SD);
+      result.sdWaits.push_back(elapsedMicros(start));
+      std::this_thread::sleep_for(std::chrono::microseconds(SD_BLOCK_US));
+    }
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(RUN_MS));
+  stop = true;
+  display.join();
+  sd.join();
+  return result;
+}
+
+static void report(const char* name, const Result& result) {
+  printf("  %-11s: SD %zu bloques, espera p50 %u us, p99 %u us, máx %u us; pantalla %u frames, "
+         "el más lento %u us\n", name, result.sdWaits.size(), percentile(result.sdWaits, 50),
+         percentile(result.sdWaits, 99), percentile(result.sdWaits, 100), result.frames,
+         result.maxFrameMicros);
+}
+
+int main() {
+  rndSeed(0x13579BDF);
+  Serial.quiet = true;
+  CHECK(spiBusManager.initialize(), "no se inicializó el bus");
+
+  printf("Volcado de pantalla y lecturas de SD durante %u ms\n", RUN_MS);
+  Result baseline = run(false);
+  report("sin ceder", baseline);
+  uint32_t yieldsBefore = spiBusManager.getStats(SPI_DEVICE_TFT).yields;
+  Result shared = run(true);
+  report("cediendo", shared);
+  uint32_t yields = spiBusManager.getStats(SPI_DEVICE_TFT).yields - yieldsBefore;
+  printf("  %u cesiones\n", yields);
+
+  // Solo comparaciones entre las dos pasadas: los tiempos absolutos
+  // dependen de la carga del PC y únicamente se imprimen
+  CHECK(yields > 0, "la pantalla nunca cedió el bus");
+  CHECK(percentile(shared.sdWaits, 99) < percentile(baseline.sdWaits, 99),
+        "ceder no acorta la espera p99 de la SD (%u us frente a %u us)",
+        percentile(shared.sdWaits, 99), percentile(baseline.sdWaits, 99));
+  CHECK(shared.frames > 0 && !shared.sdWaits.empty(), "un dispositivo se quedó sin bus");
+
+  printf(failures ? "test_spi_bus: %d fallos\n" : "test_spi_bus: OK\n", failures);
+  return failures ? 1 : 0;
+}
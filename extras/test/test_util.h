@@ -0,0 +1,28 @@
+// Utilidades comunes de las pruebas en el PC: contador de fallos, CHECK()
+// y un generador xorshift reproducible (cada prueba fija su semilla).
+#ifndef TEST_UTIL_H
+#define TEST_UTIL_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do { \
+  if (!(cond)) { failures++; printf("  FALLO: "); printf(__VA_ARGS__); printf("\n"); } \
+} while (0)
+
+static uint32_t rngState = 0x9E3779B9;
+
+static inline void rndSeed(uint32_t seed) {
+  rngState = seed ? seed : 0x9E3779B9;
+}
+
+static inline uint32_t rnd(uint32_t range) {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return range ? rngState % range : 0;
+}
+
+#endif // TEST_UTIL_H
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""Decodificador del log binario (/logs/sys.bin) generado por LogManager.
+
+Uso: decode_log.py sys.bin [--level DEBUG|INFO|WARN|ERROR]
+"""
+import argparse
+import struct
+import sys
+
+LOG_FILE_MAGIC = 0x474F4C4D
+HEADER = struct.Struct("<IHH")
+RECORD = struct.Struct("<IBB10s")
+
+LEVELS = ["DEBUG", "INFO", "WARN", "ERROR"]
+
+EVENTS = {
+    0: "TEXT",
+    1: "TEXT_CONT",
+    2: "BOOT",
+    3: "OVERFLOW",
+    4: "MIDI_IN",
+    5: "DAW_VALUE",
+    6: "DAW_COLOR",
+    7: "DAW_VALUE_COLOR",
+    8: "DAW_NAME",
+    9: "DAW_BANK_STATE",
+}
+
+
+def unpack_args(payload):
+    a, b, c, d = struct.unpack_from("<BBHI", payload)
+    return a, b, c, d
+
+
+def describe(event, payload):
+    a, b, c, d = unpack_args(payload)
+    name = EVENTS.get(event, "EVT_%d" % event)
+    if name == "BOOT":
+        return "firmware v%d.%d.%d" % (a, b, c)
+    if name == "OVERFLOW":
+        return "%d registros perdidos" % d
+    if name == "MIDI_IN":
+        return "status=0x%02X d1=%d d2=%d" % (a, b, c)
+    if name == "DAW_VALUE":
+        return "track=%d bank=%d value=%d" % (a, b, c)
+    if name == "DAW_COLOR":
+        return "track=%d bank=%d color=0x%04X" % (a, b, c)
+    if name == "DAW_VALUE_COLOR":
+        return "track=%d bank=%d value=%d color=0x%04X" % (a, b, d, c)
+    if name == "DAW_NAME":
+        text = struct.pack("<I", d).split(b"\0")[0].decode("latin-1")
+        return "track=%d bank=%d name=%r" % (a, b, text)
+    if name == "DAW_BANK_STATE":
+        return "bank=%d sections=0x%X tracks=0x%04X changed=0x%04X" % (a, b, c, d)
+    return "a=%d b=%d c=%d d=%d" % (a, b, c, d)
+
+
+def decode(path, min_level):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if len(data) < HEADER.size:
+        sys.exit("archivo demasiado corto")
+    magic, version, record_size = HEADER.unpack_from(data)
+    if magic != LOG_FILE_MAGIC:
+        sys.exit("magic inválido: 0x%08X" % magic)
+    if record_size != RECORD.size:
+        sys.exit("tamaño de registro no soportado: %d" % record_size)
+
+    text = None
+    for offset in range(HEADER.size, len(data) - record_size + 1, record_size):
+        timestamp, level, event, payload = RECORD.unpack_from(data, offset)
+        chars = payload.split(b"\0")[0].decode("latin-1")
+
+        # Los textos largos ocupan varios registros consecutivos
+        if event == 1 and text is not None:
+            text[2] += chars
+            continue
+        if text is not None:
+            emit(*text[:2], "TEXT", text[2], min_level)
+            text = None
+        if event == 0:
+            text = [timestamp, level, chars]
+            continue
+
+        emit(timestamp, level, EVENTS.get(event, "EVT_%d" % event),
+             describe(event, payload), min_level)
+
+    if text is not None:
+        emit(*text[:2], "TEXT", text[2], min_level)
+
+
+def emit(timestamp, level, name, detail, min_level):
+    if level < min_level:
+        return
+    level_name = LEVELS[level] if level < len(LEVELS) else str(level)
+    print("%12.6f %-5s %-16s %s" % (timestamp / 1e6, level_name, name, detail))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("path")
+    parser.add_argument("--level", default="DEBUG", choices=LEVELS)
+    args = parser.parse_args()
+    decode(args.path, LEVELS.index(args.level))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,233 @@
+#!/usr/bin/env python3
+"""Diagnóstico remoto del controlador por SysEx (tipos 0x0A y 0x0B).
+
+Pide las secciones de estadísticas por el puerto USB-MIDI (o cualquier puerto
+MIDI, p. ej. un loopback hacia un sustituto en el host) y las muestra como
+tabla. Sin puerto, --decode interpreta respuestas ya capturadas en hexadecimal.
+
+Uso: diag_cli.py [--port NOMBRE] [--section all|midi|ports|loop|latency|heap|encoders|display|reset]
+                 [--watch SEGUNDOS] [--timeout SEGUNDOS]
+     diag_cli.py --list
+     diag_cli.py --decode "F0 00 21 7B 0B ..." [...]
+
+Necesita mido con un backend (python-rtmidi) para hablar con el puerto.
+"""
+import argparse
+import struct
+import sys
+import time
+
+MANUFACTURER = [0x00, 0x21, 0x7B]
+SYSEX_LATENCY_QUERY = 0x0A
+SYSEX_DIAGNOSTICS = 0x0B
+
+SECTION_MIDI = 0x01
+SECTION_PORT = 0x02
+SECTION_HISTOGRAM = 0x03
+SECTION_HEAP = 0x04
+SECTION_ENCODERS = 0x05
+SECTION_DISPLAY = 0x06
+SECTION_RESET = 0x7F
+
+HISTOGRAM_LOOP = 0
+HISTOGRAM_LATENCY = 1
+
+DISPLAY_FRAMES = 0
+DISPLAY_POWER = 1
+
+PORT_NAMES = ["Principal", "Extensor", "Generico", "DIN"]
+
+# Nombres de los campos en el orden en que los envía el firmware
+# (MidiManager::sendDiagnostics, EncoderManager::getDiagnostics y
+# DisplayManager::getFrameDiagnostics/getPowerDiagnostics). Las secciones con
+# campos distintos según el índice van por (sección, índice)
+FIELDS = {
+    SECTION_MIDI: ["recibidos", "enviados", "sysex", "frames MTC", "errores",
+                   "esperas presupuesto", "NRPN ahorrados", "msg por pista",
+                   "estados de banco", "DIN bytes rx", "DIN estados omitidos"],
+    SECTION_PORT: ["tx", "rx", "bytes tx", "descartes", "esperas", "prioritarios",
+                   "cola max", "cola actual"],
+    SECTION_HISTOGRAM: ["n", "p50 us", "p95 us", "p99 us", "max us"],
+    SECTION_HEAP: ["heap libre", "heap min", "bloque max", "heap total",
+                   "PSRAM libre", "encendido ms", "huecos SysEx"],
+    SECTION_ENCODERS: ["redundantes", "recogida", "takeovers", "bytes 7 bits",
+                       "bytes 14 bits", "pasos relativos", "msg relativos",
+                       "agrupados", "aplazados", "espera max us", "cambio banco max us"],
+    SECTION_DISPLAY: ["fps medidores", "fps faders", "fps texto", "perdidos medidores",
+                      "perdidos faders", "perdidos texto", "cedidos medidores",
+                      "cedidos faders", "cedidos texto", "cortes presupuesto",
+                      "periodo TE us", "campos de texto"],
+    (SECTION_DISPLAY, DISPLAY_POWER): ["ms activa", "ms dormida", "ms despertando",
+                                       "veces dormida", "despertares", "despertar us",
+                                       "despertar max us", "despertar medio us"],
+}
+
+
+def unpack7(data):
+    out = bytearray()
+    pos = 0
+    while pos < len(data):
+        msbs = data[pos]
+        pos += 1
+        for i in range(7):
+            if pos >= len(data):
+                break
+            out.append(data[pos] | (0x80 if msbs & (1 << i) else 0))
+            pos += 1
+    return bytes(out)
+
+
+def read21(data):
+    return (data[0] << 14) | (data[1] << 7) | data[2]
+
+
+def parse_report(message):
+    """Devuelve (tipo, sección, índice, campos) o None si no es nuestro."""
+    data = list(message)
+    if data and data[0] == 0xF0:
+        data = data[1:]
+    if data and data[-1] == 0xF7:
+        data = data[:-1]
+    if len(data) < 4 or data[:3] != MANUFACTURER:
+        return None
+
+    kind = data[3]
+    if kind == SYSEX_LATENCY_QUERY and len(data) >= 4 + 15:
+        fields = [read21(data[4 + i * 3:7 + i * 3]) for i in range(5)]
+        return kind, SECTION_HISTOGRAM, HISTOGRAM_LATENCY, fields
+    if kind == SYSEX_DIAGNOSTICS and len(data) >= 6:
+        raw = unpack7(bytes(data[6:]))
+        count = len(raw) // 4
+        fields = list(struct.unpack("<%dI" % count, raw[:count * 4]))
+        return kind, data[4], data[5], fields
+    return None
+
+
+def title(section, index):
+    if section == SECTION_MIDI:
+        return "MIDI"
+    if section == SECTION_PORT:
+        name = PORT_NAMES[index] if index < len(PORT_NAMES) else str(index)
+        return "Puerto %d (%s)" % (index, name)
+    if section == SECTION_HISTOGRAM:
+        return "Loop" if index == HISTOGRAM_LOOP else "Latencia encoder->USB"
+    if section == SECTION_HEAP:
+        return "Memoria"
+    if section == SECTION_ENCODERS:
+        return "Encoders"
+    if section == SECTION_DISPLAY:
+        return "Pantalla (reposo)" if index == DISPLAY_POWER else "Pantalla"
+    if section == SECTION_RESET:
+        return "Estadísticas a cero"
+    return "Sección 0x%02X" % section
+
+
+def render(report):
+    _, section, index, fields = report
+    print("== %s" % title(section, index))
+    if section == SECTION_RESET:
+        return
+    if not fields:
+        print("   (sin datos)")
+        return
+    names = FIELDS.get((section, index), FIELDS.get(section, []))
+    for i, value in enumerate(fields):
+        name = names[i] if i < len(names) else "campo %d" % i
+        print("   %-22s %12d" % (name, value))
+
+
+def queries(section):
+    """Peticiones (sección, índice) para la opción --section."""
+    if section == "midi":
+        return [(SECTION_MIDI, 0)]
+    if section == "ports":
+        return [(SECTION_PORT, i) for i in range(len(PORT_NAMES))]
+    if section == "loop":
+        return [(SECTION_HISTOGRAM, HISTOGRAM_LOOP)]
+    if section == "latency":
+        return [(SECTION_HISTOGRAM, HISTOGRAM_LATENCY)]
+    if section == "heap":
+        return [(SECTION_HEAP, 0)]
+    if section == "encoders":
+        return [(SECTION_ENCODERS, 0)]
+    if section == "display":
+        return [(SECTION_DISPLAY, DISPLAY_FRAMES), (SECTION_DISPLAY, DISPLAY_POWER)]
+    if section == "reset":
+        return [(SECTION_RESET, 0)]
+    return (queries("midi") + queries("ports") + queries("loop") + queries("latency") +
+            queries("heap") + queries("encoders") + queries("display"))
+
+
+def open_ports(mido, name):
+    inputs = mido.get_input_names()
+    outputs = mido.get_output_names()
+    if name is None:
+        name = "JMY"
+    in_name = next((n for n in inputs if name in n), None)
+    out_name = next((n for n in outputs if name in n), None)
+    if in_name is None or out_name is None:
+        sys.exit("puerto no encontrado: %r (usa --list)" % name)
+    return mido.open_input(in_name), mido.open_output(out_name)
+
+
+def request(inport, outport, mido, section, index, timeout):
+    outport.send(mido.Message("sysex", data=MANUFACTURER + [SYSEX_DIAGNOSTICS, section, index]))
+    deadline = time.time() + timeout
+    while time.time() < deadline:
+        for message in inport.iter_pending():
+            if message.type != "sysex":
+                continue
+            report = parse_report(message.data)
+            if report and report[0] == SYSEX_DIAGNOSTICS and report[1:3] == (section, index):
+                return report
+        time.sleep(0.005)
+    return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--port", help="subcadena del nombre del puerto (por defecto 'JMY')")
+    parser.add_argument("--section", default="all",
+                        choices=["all", "midi", "ports", "loop", "latency", "heap", "encoders", "display",
+                                 "reset"])
+    parser.add_argument("--watch", type=float, help="repetir cada N segundos")
+    parser.add_argument("--timeout", type=float, default=0.5)
+    parser.add_argument("--list", action="store_true", help="listar puertos MIDI")
+    parser.add_argument("--decode", nargs="+", metavar="HEX", help="interpretar respuestas capturadas")
+    args = parser.parse_args()
+
+    if args.decode:
+        for text in args.decode:
+            report = parse_report(bytes.fromhex(text.replace(",", " ")))
+            if report is None:
+                print("no es una respuesta de diagnóstico: %s" % text)
+            else:
+                render(report)
+        return
+
+    try:
+        import mido
+    except ImportError:
+        sys.exit("hace falta mido (pip install mido python-rtmidi)")
+
+    if args.list:
+        print("Entradas: %s" % ", ".join(mido.get_input_names()))
+        print("Salidas:  %s" % ", ".join(mido.get_output_names()))
+        return
+
+    inport, outport = open_ports(mido, args.port)
+    while True:
+        for section, index in queries(args.section):
+            report = request(inport, outport, mido, section, index, args.timeout)
+            if report is None:
+                print("== %s: sin respuesta" % title(section, index))
+            else:
+                render(report)
+        if not args.watch:
+            break
+        time.sleep(args.watch)
+        print()
+
+
+if __name__ == "__main__":
+    main()
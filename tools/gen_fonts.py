@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+"""Generador de las tablas de fuentes suavizadas (SmoothFonts.h).
+
+Rasteriza una fuente TrueType a los tamaños de la interfaz con alfa de 4 bits,
+recorriendo la caja de cada glifo por filas. Cada tamaño se guarda en nibbles
+empaquetados o con RLE (un byte por racha, alfa en el nibble alto y longitud - 1
+en el bajo), lo que ocupe menos: en tamaños pequeños casi todo son bordes
+suavizados y el RLE no compensa. Cubre Latin-1 imprimible (0x20-0x7E y
+0xA0-0xFF), suficiente para los textos en castellano.
+
+Uso: gen_fonts.py [--font DejaVuSans.ttf] [--out SmoothFonts.h]
+
+Muestra por consola la ocupación en flash de cada tamaño. Necesita Pillow.
+"""
+import argparse
+import os
+import sys
+
+# Nombre, tamaño en píxeles (em) y uso en la interfaz
+SIZES = [
+    ("Small", 11, "textos pequeños (equivale a FONT_SIZE_SMALL)"),
+    ("Medium", 18, "menús y diálogos (FONT_SIZE_MEDIUM)"),
+    ("Large", 26, "MTC y títulos (FONT_SIZE_LARGE)"),
+]
+
+RANGES = [(0x20, 0x7E), (0xA0, 0xFF)]
+DEFAULT_FONT = "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf"
+
+
+def code_points():
+    for first, last in RANGES:
+        for cp in range(first, last + 1):
+            yield cp
+
+
+def rle(alpha):
+    out = bytearray()
+    pos = 0
+    while pos < len(alpha):
+        value = alpha[pos]
+        run = 1
+        while pos + run < len(alpha) and alpha[pos + run] == value and run < 16:
+            run += 1
+        out.append((value << 4) | (run - 1))
+        pos += run
+    return out
+
+
+def pack(alpha):
+    out = bytearray()
+    for i in range(0, len(alpha), 2):
+        out.append((alpha[i] << 4) | (alpha[i + 1] if i + 1 < len(alpha) else 0))
+    return out
+
+
+def render_font(ImageFont, Image, ImageDraw, path, size):
+    font = ImageFont.truetype(path, size)
+    ascent, descent = font.getmetrics()
+    bitmaps = []
+
+    for cp in code_points():
+        ch = chr(cp)
+        advance = int(round(font.getlength(ch)))
+        x0, y0, x1, y1 = font.getbbox(ch, anchor="ls")
+        width, height = max(0, x1 - x0), max(0, y1 - y0)
+        alpha = []
+
+        if width and height and cp != 0xA0:
+            image = Image.new("L", (width, height), 0)
+            ImageDraw.Draw(image).text((-x0, -y0), ch, font=font, fill=255, anchor="ls")
+            alpha = [(v * 15 + 127) // 255 for v in image.tobytes()]
+        else:
+            width = height = 0
+            x0 = y0 = 0
+
+        bitmaps.append((cp, alpha, width, height, advance, x0, y0))
+
+    packed = sum(len(pack(b[1])) for b in bitmaps)
+    compressed = sum(len(rle(b[1])) for b in bitmaps)
+    encode = rle if compressed < packed else pack
+
+    data = bytearray()
+    glyphs = []
+    for cp, alpha, width, height, advance, x0, y0 in bitmaps:
+        glyphs.append((cp, len(data), width, height, advance, x0, y0))
+        data += encode(alpha)
+
+    cap_height = -font.getbbox("H", anchor="ls")[1]
+    return {
+        "ascent": ascent, "descent": descent, "cap": cap_height, "rle": encode is rle,
+        "data": data, "glyphs": glyphs, "packed": packed, "compressed": compressed,
+    }
+
+
+def emit(out, name, size, usage, font):
+    out.append("// %s: %d px, %s" % (name, size, usage))
+    out.append("static const uint8_t smooth%sData[%d] = {" % (name, len(font["data"])))
+    data = font["data"]
+    for i in range(0, len(data), 16):
+        out.append("  " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    out.append("};")
+    out.append("")
+    out.append("static const SmoothGlyph smooth%sGlyphs[SMOOTH_GLYPH_COUNT] = {" % name)
+    for cp, offset, width, height, advance, x0, y0 in font["glyphs"]:
+        out.append("  {%5d, %2d, %2d, %2d, %3d, %3d},   // U+%04X" %
+                   (offset, width, height, advance, x0, y0, cp))
+    out.append("};")
+    out.append("")
+    out.append("static const SmoothFont smoothFont%s = {" % name)
+    out.append("  smooth%sData, smooth%sGlyphs, %d, %d, %d, %s" %
+               (name, name, font["cap"], font["ascent"], font["descent"],
+                "SMOOTH_RLE" if font["rle"] else "0"))
+    out.append("};")
+    out.append("")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--font", default=DEFAULT_FONT)
+    parser.add_argument("--out", default=os.path.join(os.path.dirname(__file__), "..", "SmoothFonts.h"))
+    args = parser.parse_args()
+
+    try:
+        from PIL import Image, ImageDraw, ImageFont
+    except ImportError:
+        sys.exit("hace falta Pillow (pip install pillow)")
+
+    fonts = [(name, size, usage, render_font(ImageFont, Image, ImageDraw, args.font, size))
+             for name, size, usage in SIZES]
+
+    out = [
+        "// Generado por tools/gen_fonts.py a partir de %s: no editar a mano" % os.path.basename(args.font),
+        "// Alfa de 4 bits, en nibbles o con RLE según el tamaño (ver SmoothFont.h)",
+        "//",
+        "//   tamaño   glifos   4 bits     RLE        usado   tabla",
+    ]
+    for name, size, _, font in fonts:
+        out.append("//   %-7s %6d %7d B %7d B   %-5s %5d B" %
+                   (name, len(font["glyphs"]), font["packed"], font["compressed"],
+                    "RLE" if font["rle"] else "4bit", len(font["glyphs"]) * 8))
+    out += [
+        "#ifndef SMOOTH_FONTS_H",
+        "#define SMOOTH_FONTS_H",
+        "",
+        '#include "SmoothFont.h"',
+        "",
+    ]
+    for name, size, usage, font in fonts:
+        emit(out, name, size, usage, font)
+    out.append("#endif // SMOOTH_FONTS_H")
+
+    with open(args.out, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+    total = 0
+    print("tamaño   glifos   4 bits     RLE        usado   tabla")
+    for name, size, _, font in fonts:
+        table = len(font["glyphs"]) * 8
+        total += len(font["data"]) + table
+        print("%-7s %6d %7d B %7d B   %-5s %5d B" %
+              (name, len(font["glyphs"]), font["packed"], font["compressed"],
+               "RLE" if font["rle"] else "4bit", table))
+    print("total en flash: %d B" % total)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,159 @@
+/*
+ * Codificador de referencia del estado de banco en bloque (SysEx 0x07) y de
+ * la realimentación secuenciada (SysEx 0x08) para el script de Studio One.
+ * Debe producir exactamente lo que esperan StudioOneProtocol::parseBankState()
+ * y parseValueDelta() en el firmware.
+ *
+ *   F0 00 21 7B 07 <secciones> <banco> <máscara pistas x3>
+ *   [valores] [colores empaquetados] [nombres] [flags empaquetados] [seq x2] F7
+ *
+ *   F0 00 21 7B 08 <banco> <seq MSB> <seq LSB> {<pista|flags> <cantidad>}* F7
+ *
+ * Uso desde node para comparar bytes en el cable:  node studio_one_bank_state.js
+ */
+
+var BANK_STATE = 0x07;
+var VALUE_DELTA = 0x08;
+
+var SECTION_VALUES = 0x01;
+var SECTION_COLORS = 0x02;
+var SECTION_NAMES = 0x04;
+var SECTION_FLAGS = 0x08;
+var SECTION_ALL = 0x0F;
+var SECTION_SEQ = 0x10;
+
+var DELTA_ABSOLUTE = 0x10;
+var DELTA_NEGATIVE = 0x20;
+var SEQ_MASK = 0x3FFF;
+
+var NUM_TRACKS = 16;
+var NAME_CHARS = 5;
+
+// 8 -> 7 bits: por cada grupo de 7 bytes, un byte con los bits altos y los 7 bajos
+function pack7(bytes) {
+    var out = [];
+    for (var group = 0; group < bytes.length; group += 7) {
+        var count = Math.min(7, bytes.length - group);
+        var msbs = 0;
+        for (var i = 0; i < count; i++) {
+            if (bytes[group + i] & 0x80) msbs |= (1 << i);
+        }
+        out.push(msbs);
+        for (var j = 0; j < count; j++) {
+            out.push(bytes[group + j] & 0x7F);
+        }
+    }
+    return out;
+}
+
+function rgb24ToRgb565(rgb) {
+    var r = (rgb >> 16) & 0xFF, g = (rgb >> 8) & 0xFF, b = rgb & 0xFF;
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+// tracks: array de 16 entradas {value, color (RGB24), name, mute, solo} o null
+// si la pista no se envía. Las máscaras mute/solo van siempre para el banco entero.
+// seq: secuencia actual del banco, solo si sections incluye SECTION_SEQ.
+function encodeBankState(bank, sections, tracks, seq) {
+    var trackMask = 0;
+    for (var t = 0; t < NUM_TRACKS; t++) {
+        if (tracks[t]) trackMask |= (1 << t);
+    }
+
+    var msg = [0xF0, 0x00, 0x21, 0x7B, BANK_STATE, sections & (SECTION_ALL | SECTION_SEQ), bank & 0x7F,
+               trackMask & 0x7F, (trackMask >> 7) & 0x7F, (trackMask >> 14) & 0x03];
+
+    var present = tracks.filter(function (track) { return !!track; });
+
+    if (sections & SECTION_VALUES) {
+        present.forEach(function (track) { msg.push(track.value & 0x7F); });
+    }
+
+    if (sections & SECTION_COLORS) {
+        var colors = [];
+        present.forEach(function (track) {
+            var c = rgb24ToRgb565(track.color);
+            colors.push((c >> 8) & 0xFF, c & 0xFF);
+        });
+        msg = msg.concat(pack7(colors));
+    }
+
+    if (sections & SECTION_NAMES) {
+        present.forEach(function (track) {
+            for (var i = 0; i < NAME_CHARS; i++) {
+                var code = i < track.name.length ? track.name.charCodeAt(i) : 0;
+                msg.push(code < 0x80 ? code : 0x3F);
+            }
+        });
+    }
+
+    if (sections & SECTION_FLAGS) {
+        var mute = 0, solo = 0;
+        for (var k = 0; k < NUM_TRACKS; k++) {
+            if (tracks[k] && tracks[k].mute) mute |= (1 << k);
+            if (tracks[k] && tracks[k].solo) solo |= (1 << k);
+        }
+        msg = msg.concat(pack7([mute & 0xFF, mute >> 8, solo & 0xFF, solo >> 8]));
+    }
+
+    if (sections & SECTION_SEQ) {
+        msg.push((seq >> 7) & 0x7F, seq & 0x7F);
+    }
+
+    msg.push(0xF7);
+    return msg;
+}
+
+// El script guarda por banco la secuencia (14 bits, +1 por mensaje) y un
+// historial de los últimos mensajes para atender las peticiones 0x09.
+// changes: [{track, delta}] relativos, o [{track, value}] absolutos.
+// Sin cambios es un latido: permite al controlador detectar pérdidas finales.
+function encodeValueDelta(bank, seq, changes) {
+    var msg = [0xF0, 0x00, 0x21, 0x7B, VALUE_DELTA, bank & 0x7F,
+               (seq >> 7) & 0x7F, seq & 0x7F];
+    changes.forEach(function (change) {
+        if (change.value !== undefined) {
+            msg.push((change.track & 0x0F) | DELTA_ABSOLUTE, change.value & 0x7F);
+        } else {
+            var negative = change.delta < 0;
+            msg.push((change.track & 0x0F) | (negative ? DELTA_NEGATIVE : 0),
+                     Math.min(127, Math.abs(change.delta)));
+        }
+    });
+    msg.push(0xF7);
+    return msg;
+}
+
+// Petición de reenvío del controlador: {bank, from, to}
+function decodeResendRequest(msg) {
+    if (msg.length !== 11 || msg[4] !== 0x09) return null;
+    return { bank: msg[5], from: (msg[6] << 7) | msg[7], to: (msg[8] << 7) | msg[9] };
+}
+
+// Bytes que cuesta el mismo banco con los mensajes por pista (0x01-0x03),
+// contando las peticiones del controlador (8 bytes cada una)
+function perTrackBytes(sections) {
+    var perTrack = 0, requests = 0;
+    if (sections & SECTION_VALUES) { perTrack += 9; requests++; }
+    if (sections & SECTION_COLORS) { perTrack += 11; requests++; }
+    if (sections & SECTION_NAMES) { perTrack += 8 + NAME_CHARS; }
+    return NUM_TRACKS * (perTrack + requests * 8);
+}
+
+if (typeof module !== "undefined") {
+    module.exports = { pack7: pack7, encodeBankState: encodeBankState, encodeValueDelta: encodeValueDelta,
+                       decodeResendRequest: decodeResendRequest, perTrackBytes: perTrackBytes,
+                       SEQ_MASK: SEQ_MASK };
+
+    if (require.main === module) {
+        var tracks = [];
+        for (var t = 0; t < NUM_TRACKS; t++) {
+            tracks.push({ value: t * 8, color: 0x3366CC, name: "Trk" + (t + 1), mute: t === 2, solo: false });
+        }
+        [SECTION_VALUES | SECTION_FLAGS, SECTION_ALL].forEach(function (sections) {
+            var bulk = encodeBankState(0, sections, tracks).length + 8;
+            console.log("secciones 0x" + sections.toString(16) + ": bloque " + bulk +
+                        " B, por pista " + perTrackBytes(sections) + " B");
+        });
+    }
+}